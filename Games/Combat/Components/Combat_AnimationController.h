@@ -380,7 +380,7 @@ private:
 			xTrans.m_fTransitionDuration = 0.15f;
 
 			Flux_TransitionCondition xCond;
-			xCond.m_strParameterName = CombatAnimParams::SPEED;
+			xCond.SetParameterName(CombatAnimParams::SPEED);
 			xCond.m_eParamType = Flux_AnimationParameters::ParamType::Float;
 			xCond.m_eCompareOp = Flux_TransitionCondition::CompareOp::Greater;
 			xCond.m_fThreshold = 0.1f;
@@ -396,7 +396,7 @@ private:
 			xTrans.m_fTransitionDuration = 0.15f;
 
 			Flux_TransitionCondition xCond;
-			xCond.m_strParameterName = CombatAnimParams::SPEED;
+			xCond.SetParameterName(CombatAnimParams::SPEED);
 			xCond.m_eParamType = Flux_AnimationParameters::ParamType::Float;
 			xCond.m_eCompareOp = Flux_TransitionCondition::CompareOp::LessEqual;
 			xCond.m_fThreshold = 0.1f;
@@ -428,7 +428,7 @@ private:
 			xTrans.m_iPriority = 5;
 
 			Flux_TransitionCondition xCond;
-			xCond.m_strParameterName = CombatAnimParams::ATTACK_TRIGGER;
+			xCond.SetParameterName(CombatAnimParams::ATTACK_TRIGGER);
 			xCond.m_eParamType = Flux_AnimationParameters::ParamType::Trigger;
 			xTrans.m_xConditions.PushBack(xCond);
 
@@ -445,7 +445,7 @@ private:
 			xTrans.m_iPriority = 5;
 
 			Flux_TransitionCondition xCond;
-			xCond.m_strParameterName = CombatAnimParams::ATTACK_TRIGGER;
+			xCond.SetParameterName(CombatAnimParams::ATTACK_TRIGGER);
 			xCond.m_eParamType = Flux_AnimationParameters::ParamType::Trigger;
 			xTrans.m_xConditions.PushBack(xCond);
 
@@ -480,7 +480,7 @@ private:
 			xHitTrans.m_iPriority = 100;
 
 			Flux_TransitionCondition xCond;
-			xCond.m_strParameterName = CombatAnimParams::HIT_TRIGGER;
+			xCond.SetParameterName(CombatAnimParams::HIT_TRIGGER);
 			xCond.m_eParamType = Flux_AnimationParameters::ParamType::Trigger;
 			xHitTrans.m_xConditions.PushBack(xCond);
 
@@ -501,7 +501,7 @@ private:
 			xDeathTrans.m_iPriority = 200;
 
 			Flux_TransitionCondition xCond;
-			xCond.m_strParameterName = CombatAnimParams::DEATH_TRIGGER;
+			xCond.SetParameterName(CombatAnimParams::DEATH_TRIGGER);
 			xCond.m_eParamType = Flux_AnimationParameters::ParamType::Trigger;
 			xDeathTrans.m_xConditions.PushBack(xCond);
 
@@ -531,7 +531,7 @@ private:
 		xTrans.m_iPriority = iPriority;
 
 		Flux_TransitionCondition xCond;
-		xCond.m_strParameterName = szTriggerParam;
+		xCond.SetParameterName(szTriggerParam);
 		xCond.m_eParamType = Flux_AnimationParameters::ParamType::Trigger;
 		xTrans.m_xConditions.PushBack(xCond);
 
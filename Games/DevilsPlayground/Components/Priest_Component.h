@@ -560,7 +560,7 @@ private:
 
 		// TargetWithDevil: only set when a perceived villager is currently possessed.
 		Zenith_EntityID xTargetWithDevil = INVALID_ENTITY_ID;
-		const Zenith_Vector<Zenith_PerceivedTarget>* paxPerceived =
+		const Zenith_PerceivedTargetList* paxPerceived =
 			Zenith_PerceptionSystem::GetPerceivedTargets(xSelf);
 		if (paxPerceived != nullptr)
 		{
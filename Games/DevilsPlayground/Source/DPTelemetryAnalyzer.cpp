@@ -163,9 +163,9 @@ namespace DPTelemetryAnalyzer
 				// (see Zenith_Telemetry::Reader::LoadFromFile). v1 was
 				// the original; v2 added Header.axObstacles; v3 added
 				// extended EntitySnapshot + CameraState + perf + build
-				// metadata.
-				if (xH.uVersion != 1u && xH.uVersion != 2u && xH.uVersion != 3u)
-				                              { xR.szReason = "version != 1 && != 2 && != 3"; break; }
+				// metadata; v4 added perf-counter columns.
+				if (xH.uVersion < 1u || xH.uVersion > 4u)
+				                              { xR.szReason = "version not in 1..4"; break; }
 				xR.bPassed = true; xR.szReason = "ok"; break;
 			}
 			case Criterion::HeaderHasSceneName:
@@ -153,8 +153,8 @@ static void Setup_TelemetryRoundTrip()
 	if (xH.uStartUTCMs != 42424242ull) return;
 	if (xH.strSceneName != "TestScene") return;
 	if (xH.uSamplePeriodFrames != 6u) return;
-	// v3 header fields.
-	if (xH.uVersion != 3u) return;
+	// v3 header fields (file is written at the current version, v4).
+	if (xH.uVersion != 4u) return;
 	if (xH.strBuildConfig     != "Test_Config")     return;
 	if (xH.strBuildHash       != "abc1234")         return;
 	if (xH.strPersonalityName != "TestPersonality") return;
@@ -287,7 +287,7 @@ static bool Step_W3ApprehendStartsInRange(int iFrame)
 			Zenith_Maths::Vector3 xP(0.0f), xV(0.0f);
 			W3_TryGetEntityPos(g_xAPriest, xP);
 			W3_TryGetEntityPos(g_xAVillager, xV);
-			const Zenith_Vector<Zenith_PerceivedTarget>* paxPerceived =
+			const Zenith_PerceivedTargetList* paxPerceived =
 				Zenith_PerceptionSystem::GetPerceivedTargets(g_xAPriest);
 			Zenith_Log(LOG_CATEGORY_AI,
 				"W3ApprehendStart: f=%d state=%d possessed=%d acquired=%d distXZ=%.2f perceived=%u",
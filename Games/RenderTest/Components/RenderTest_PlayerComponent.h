@@ -685,7 +685,7 @@ private:
 			xTrans.m_fExitTime = 0.8f;
 
 			Flux_TransitionCondition xCond;
-			xCond.m_strParameterName = "IsGrounded";
+			xCond.SetParameterName("IsGrounded");
 			xCond.m_eParamType = Flux_AnimationParameters::ParamType::Bool;
 			xCond.m_eCompareOp = Flux_TransitionCondition::CompareOp::Equal;
 			xCond.m_bThreshold = true;
@@ -821,7 +821,7 @@ private:
 		xTrans.m_fTransitionDuration = fDuration;
 
 		Flux_TransitionCondition xCond;
-		xCond.m_strParameterName = szParam;
+		xCond.SetParameterName(szParam);
 		xCond.m_eParamType = Flux_AnimationParameters::ParamType::Float;
 		xCond.m_eCompareOp = eOp;
 		xCond.m_fThreshold = fThreshold;
@@ -840,7 +840,7 @@ private:
 		xTrans.m_fTransitionDuration = fDuration;
 
 		Flux_TransitionCondition xCond;
-		xCond.m_strParameterName = szParam;
+		xCond.SetParameterName(szParam);
 		xCond.m_eParamType = Flux_AnimationParameters::ParamType::Bool;
 		xCond.m_eCompareOp = Flux_TransitionCondition::CompareOp::Equal;
 		xCond.m_bThreshold = bExpected;
@@ -859,7 +859,7 @@ private:
 		xTrans.m_iPriority = iPriority;
 
 		Flux_TransitionCondition xCond;
-		xCond.m_strParameterName = szTrigger;
+		xCond.SetParameterName(szTrigger);
 		xCond.m_eParamType = Flux_AnimationParameters::ParamType::Trigger;
 		xTrans.m_xConditions.PushBack(xCond);
 
@@ -893,7 +893,7 @@ private:
 		xTrans.m_iPriority = iPriority;
 
 		Flux_TransitionCondition xCond;
-		xCond.m_strParameterName = szParam;
+		xCond.SetParameterName(szParam);
 		xCond.m_eParamType = Flux_AnimationParameters::ParamType::Bool;
 		xCond.m_eCompareOp = Flux_TransitionCondition::CompareOp::Equal;
 		xCond.m_bThreshold = bExpected;
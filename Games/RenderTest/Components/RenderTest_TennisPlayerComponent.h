@@ -507,7 +507,7 @@ private:
 		xTrans.m_fTransitionDuration = fDuration;
 		xTrans.m_iPriority = iPriority;
 		Flux_TransitionCondition xCond;
-		xCond.m_strParameterName = szTrigger;
+		xCond.SetParameterName(szTrigger);
 		xCond.m_eParamType = Flux_AnimationParameters::ParamType::Trigger;
 		xTrans.m_xConditions.PushBack(xCond);
 		pxSM->GetState(szFrom)->AddTransition(xTrans);
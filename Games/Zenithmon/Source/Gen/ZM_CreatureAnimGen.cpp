@@ -211,7 +211,7 @@ ZM_CreatureClipValidation ZM_ValidateCreatureClip(const Flux_AnimationClip& xCli
 			continue;   // no rotations to finiteness/loop-check
 		}
 
-		const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeys = xChannel.GetRotationKeyframes();
+		const Flux_QuatKeyTrack& xKeys = xChannel.GetRotationKeyframes();
 
 		// Every authored quat finite + ~unit-length.
 		for (u_int u = 0; u < xKeys.GetSize(); ++u)
@@ -47,11 +47,8 @@ void ZM_BakeDawnmereNavmeshStep()
 		return;
 	}
 
-	NavMeshGenerationConfig xConfig;
-	xConfig.m_fCellSize = fZM_DAWNMERE_NAVMESH_CELL_SIZE;
-
-	const Zenith_NavMeshBakeResult xResult = Zenith_NavMeshBaker::BakeToFile(
-		axVertices, auIndices, xConfig, ZM_GetDawnmereNavmeshBakePath());
+	const Zenith_NavMeshBakeResult xResult = Zenith_NavMeshBaker::BakeToFile(axVertices, auIndices,
+		ZM_GetDawnmereNavConfig(fZM_DAWNMERE_NAVMESH_CELL_SIZE), ZM_GetDawnmereNavmeshBakePath());
 
 	// LOUD on failure: the committed asset is what every CI run then tests
 	// against, so a silently-missing bake would surface as a confusing runtime
@@ -187,6 +187,20 @@ ZM_NavEvalGrid ZM_BuildCoverageGrid(
 	return xGrid;
 }
 
+NavMeshGenerationConfig ZM_GetDawnmereNavConfig(float fCellSize)
+{
+	// Leave the agent radius at its default (fZM_NAV_AGENT_RADIUS_PAD), only
+	// override the cell size so the generator's grid matches our prediction.
+	NavMeshGenerationConfig xConfig;
+	xConfig.m_fCellSize = fCellSize;
+
+	// Tiles bake concurrently on the task system and the bytes do not depend
+	// on the worker count. Same cells and polygons as the single-grid bake;
+	// only the seam vertices are duplicated.
+	xConfig.m_bBakeInTiles = true;
+	return xConfig;
+}
+
 ZM_NavEvalResult ZM_EvaluateDawnmereNavGeneration(float fCellSize, bool bUpwardNormals)
 {
 	ZM_NavEvalResult xResult;
@@ -225,13 +239,8 @@ ZM_NavEvalResult ZM_EvaluateDawnmereNavGeneration(float fCellSize, bool bUpwardN
 	}
 	xResult.m_bAttempted = true;
 
-	// Leave the agent radius at its default (fZM_NAV_AGENT_RADIUS_PAD), only
-	// override the cell size so the generator's grid matches our prediction.
-	NavMeshGenerationConfig xConfig;
-	xConfig.m_fCellSize = fCellSize;
-
-	Zenith_NavMesh* pxNavMesh =
-		Zenith_NavMeshGenerator::GenerateFromGeometry(axVertices, auIndices, xConfig);
+	Zenith_NavMesh* pxNavMesh = Zenith_NavMeshGenerator::GenerateFromGeometry(
+		axVertices, auIndices, ZM_GetDawnmereNavConfig(fCellSize));
 
 	if (pxNavMesh == nullptr)
 	{
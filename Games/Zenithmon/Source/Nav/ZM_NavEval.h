@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AI/Navigation/Zenith_NavMeshGenerator.h"
 #include "Collections/Zenith_Vector.h"
 #include "Maths/Zenith_Maths.h"
 
@@ -108,6 +109,13 @@ ZM_NavEvalGrid ZM_BuildCoverageGrid(
 	Zenith_Vector<Zenith_Maths::Vector3>& axVerticesOut,
 	Zenith_Vector<uint32_t>& auIndicesOut);
 
+// The generator config every Dawnmere bake uses: engine defaults (so the agent
+// radius stays fZM_NAV_AGENT_RADIUS_PAD) at fCellSize, baked in tiles. ONE
+// SPELLING for both the committed bake (ZM_NavBake) and the in-memory
+// reference bake below, because SC1b's drift check compares their vertex
+// counts and a tiled bake does not share vertices across tile seams.
+NavMeshGenerationConfig ZM_GetDawnmereNavConfig(float fCellSize);
+
 // The evaluation verdict -- a small POD the orchestrator can quote in a report.
 struct ZM_NavEvalResult
 {
@@ -191,7 +191,7 @@ ZENITH_TEST(ZM_Gen, CreatureAnimGen_ChannelsMatchSkeleton)
 					id, c, strBone.c_str());
 
 				// Every authored quat finite AND ~unit-length.
-				const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeys =
+				const Flux_QuatKeyTrack& xKeys =
 					xChannel.GetRotationKeyframes();
 				for (u_int k = 0; k < xKeys.GetSize(); ++k)
 				{
@@ -436,7 +436,7 @@ ZENITH_TEST(ZM_Gen, CreatureAnimGen_LoopingClipsWrapCleanly)
 			{
 				const Flux_BoneChannel& xChannel = xIt.GetValue();
 				const char* szBone = xChannel.GetBoneName().c_str();
-				const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeys = xChannel.GetRotationKeyframes();
+				const Flux_QuatKeyTrack& xKeys = xChannel.GetRotationKeyframes();
 				ZENITH_ASSERT_GE(xKeys.GetSize(), 2u,
 					"archetype %u looping clip %u channel '%s' needs >= 2 keys to close", (u_int)eArch, (u_int)eClip, szBone);
 
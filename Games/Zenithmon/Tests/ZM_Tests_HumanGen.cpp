@@ -156,7 +156,7 @@ namespace
 		float fDurationTicks, u_int& uFirstBadKey)
 	{
 		uFirstBadKey = 0xFFFFFFFFu;
-		const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeys =
+		const Flux_QuatKeyTrack& xKeys =
 			xChannel.GetRotationKeyframes();
 		if (!std::isfinite(fDurationTicks) || fDurationTicks <= 0.0f || xKeys.GetSize() < 2u)
 		{
@@ -189,7 +189,7 @@ namespace
 		Zenith_HashMap<std::string, Flux_BoneChannel>::Iterator xIt(xChannels);
 		for (; !xIt.Done(); xIt.Next())
 		{
-			const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeys =
+			const Flux_QuatKeyTrack& xKeys =
 				xIt.GetValue().GetRotationKeyframes();
 			if (xKeys.GetSize() < 2u || !HumanQuatFiniteNormalized(xKeys.GetFront().first))
 			{
@@ -232,7 +232,7 @@ namespace
 			if (pxA == nullptr || pxB == nullptr)
 			{
 				const Flux_BoneChannel* pxPresent = pxA != nullptr ? pxA : pxB;
-				const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xPresentKeys =
+				const Flux_QuatKeyTrack& xPresentKeys =
 					pxPresent->GetRotationKeyframes();
 				for (u_int k = 0u; k < xPresentKeys.GetSize(); ++k)
 				{
@@ -249,13 +249,13 @@ namespace
 				continue;
 			}
 
-			const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeysA =
+			const Flux_QuatKeyTrack& xKeysA =
 				pxA->GetRotationKeyframes();
-			const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeysB =
+			const Flux_QuatKeyTrack& xKeysB =
 				pxB->GetRotationKeyframes();
 			if ((xKeysA.GetSize() == 0u) != (xKeysB.GetSize() == 0u))
 			{
-				const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xPresentKeys =
+				const Flux_QuatKeyTrack& xPresentKeys =
 					xKeysA.GetSize() != 0u ? xKeysA : xKeysB;
 				for (u_int k = 0u; k < xPresentKeys.GetSize(); ++k)
 				{
@@ -2464,7 +2464,7 @@ ZENITH_TEST(ZM_Gen, HumanGen_ClipTimingAndPlaybackPolicy)
 				continue;
 			}
 
-			const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeys =
+			const Flux_QuatKeyTrack& xKeys =
 				xChannel.GetRotationKeyframes();
 			ZENITH_ASSERT_LE(fabsf(xKeys.GetFront().second), fHUMAN_ANIM_TICK_TOL,
 				"human clip %u channel '%s' has no first key at tick zero", c, szBone);
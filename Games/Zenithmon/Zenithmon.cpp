@@ -512,7 +512,7 @@ private:
 		xTransition.m_fTransitionDuration = fZM_HUMAN_LOCOMOTION_BLEND_SECONDS;
 
 		Flux_TransitionCondition xCondition;
-		xCondition.m_strParameterName = "Speed";
+		xCondition.SetParameterName("Speed");
 		xCondition.m_eParamType = Flux_AnimationParameters::ParamType::Float;
 		xCondition.m_eCompareOp = eOp;
 		xCondition.m_fThreshold = fThreshold;
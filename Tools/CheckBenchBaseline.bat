@@ -0,0 +1,52 @@
+@echo off
+REM ==========================================================================
+REM CheckBenchBaseline.bat - CI gate for benchmark regressions.
+REM
+REM Runs check_bench_baseline.py against the committed baseline
+REM (Tools/bench_baseline.json). Two modes:
+REM
+REM   CheckBenchBaseline.bat
+REM       RATCHET mode (no live run). Validates the baseline itself: every
+REM       median_ms must be a non-negative number. Unmeasured entries
+REM       (median_ms 0) are listed but do not fail. Always runnable in CI.
+REM
+REM   CheckBenchBaseline.bat --results zenith_bench_results.json
+REM       LIVE mode. Compares a `--bench=all --bench-json=<file>` run against
+REM       the baseline (median + tolerance_pct, item counts). An entry that is
+REM       still unmeasured FAILS here, so live mode only passes once medians
+REM       have been recorded with --update from a real Release run.
+REM
+REM A justified slowdown must update Tools/bench_baseline.json in the same commit.
+REM ==========================================================================
+
+setlocal
+
+set "SCRIPT_DIR=%~dp0"
+
+REM Resolve a Python interpreter. Use && (runtime exit-code) + `if not defined`
+REM (a runtime check) rather than %ERRORLEVEL% inside a parenthesized if/else block:
+REM cmd.exe expands %ERRORLEVEL% for the whole block at PARSE time, so the nested test
+REM would read the stale value from `where py`, not the fresh `where python`.
+set "PYTHON_CMD="
+where py >nul 2>nul && set "PYTHON_CMD=py -3"
+if not defined PYTHON_CMD (
+    where python >nul 2>nul && set "PYTHON_CMD=python"
+)
+if not defined PYTHON_CMD (
+    echo CheckBenchBaseline: Python not found on PATH. Install Python 3.9+ or run via the Windows launcher.
+    exit /b 2
+)
+
+%PYTHON_CMD% "%SCRIPT_DIR%check_bench_baseline.py" %*
+set "EXITCODE=%ERRORLEVEL%"
+
+if %EXITCODE% NEQ 0 (
+    echo.
+    echo ============================================================
+    echo BENCHMARK GATE FAILED
+    echo A benchmark regressed, changed its workload, or has no recorded
+    echo median. See Tools\bench_baseline.json.
+    echo ============================================================
+)
+
+endlocal ^& exit /b %EXITCODE%
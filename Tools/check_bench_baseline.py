@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""
+Benchmark regression gate for the Zenith engine.
+
+Mirrors the memory-budget gate: a committed baseline of per-benchmark median times
+(Tools/bench_baseline.json), and a checker that fails when a benchmark regresses.
+Two modes:
+
+  * RATCHET (default, no --results): pure-JSON validation of the baseline itself —
+    every entry needs a non-negative median_ms. Zero external state; always runnable.
+    Unmeasured entries (median_ms 0) are listed but do not fail here: the baseline
+    may name a benchmark before anyone has run it on the reference machine.
+
+  * LIVE (--results <file>): compares a results file written by
+    `Zenith --bench=<filter> --bench-json=<file>` against the baseline. For each
+    benchmark in both: FAIL if median_ms > baseline median_ms * (1 + tolerance_pct/100),
+    if the run's item count changed between samples (items_stable false), or if the
+    item count differs from the baseline's (the workload changed: re-baseline it).
+    A benchmark the run covered whose baseline is still unmeasured (median_ms 0)
+    FAILS too: a zero would otherwise pass every run and guard nothing.
+    Timings are only compared when the results' build matches the baseline's build
+    (a debug run against a release baseline is meaningless); item checks always run.
+
+  --update: rewrite median_ms / items for every benchmark in --results, adding new
+  entries and recording the results' build.
+
+Benchmarks in the baseline but not in the results are skipped (a filtered run), so
+a results file that matches nothing at all is a failure.
+"""
+
+import argparse
+import json
+import os
+import sys
+
+DEFAULT_BASELINE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "bench_baseline.json")
+
+
+def evaluate_benchmark(actual_median_ms, baseline_median_ms, tolerance_pct):
+    """Pure decision function. Returns (passed: bool, reason: str).
+
+    FAIL if the actual median regresses beyond tolerance vs the recorded baseline
+    median, or if there is no recorded median (baseline_median_ms==0: unmeasured)."""
+    if not baseline_median_ms:
+        return (False, "baseline median is unmeasured (0); record one with --update --results <file>")
+    limit = baseline_median_ms * (1.0 + tolerance_pct / 100.0)
+    if actual_median_ms > limit:
+        return (False, "median %.3f ms regressed beyond baseline %.3f ms (+%.0f%% -> limit %.3f)"
+                % (actual_median_ms, baseline_median_ms, tolerance_pct, limit))
+    return (True, "ok")
+
+
+def load_json(path):
+    with open(path, "r", encoding="utf-8") as f:
+        return json.load(f)
+
+
+def index_results(results):
+    """Return {name: benchmark_dict} from a --bench-json results file."""
+    return {b["name"]: b for b in results.get("benchmarks", [])}
+
+
+def unmeasured_benchmarks(baseline):
+    """Names of baseline entries with no recorded median, sorted."""
+    names = []
+    for name, entry in baseline.get("benchmarks", {}).items():
+        try:
+            if float(entry.get("median_ms", 0)) == 0:
+                names.append(name)
+        except (ValueError, TypeError):
+            pass
+    return sorted(names)
+
+
+def run_ratchet(baseline):
+    failures = []
+    for name, entry in baseline.get("benchmarks", {}).items():
+        try:
+            if float(entry.get("median_ms", 0)) < 0:
+                failures.append("%s: negative baseline median" % name)
+        except (ValueError, TypeError):
+            failures.append("%s: median_ms is not a number" % name)
+    return failures
+
+
+def run_live(baseline, results):
+    tol = float(baseline.get("tolerance_pct", 25.0))
+    compare_times = results.get("build") == baseline.get("build")
+    if not compare_times:
+        print("NOTE: results build '%s' differs from baseline build '%s'; timings not compared."
+              % (results.get("build"), baseline.get("build")))
+
+    actual = index_results(results)
+    failures = []
+    checked = 0
+    for name, entry in baseline.get("benchmarks", {}).items():
+        if name not in actual:
+            continue
+        checked += 1
+        bench = actual[name]
+        if not bench.get("items_stable", True):
+            failures.append("%s: item count changed between samples" % name)
+        baseline_items = int(entry.get("items", 0))
+        if baseline_items and int(bench.get("items", 0)) != baseline_items:
+            failures.append("%s: processed %d items, baseline %d (workload changed? re-baseline)"
+                            % (name, int(bench.get("items", 0)), baseline_items))
+        if not float(entry.get("median_ms", 0.0)):
+            failures.append("%s: baseline median is unmeasured (0); record one with --update --results <file>" % name)
+        elif compare_times:
+            passed, reason = evaluate_benchmark(
+                float(bench.get("median_ms", 0.0)), float(entry.get("median_ms", 0.0)), tol)
+            if not passed:
+                failures.append("%s: %s" % (name, reason))
+    if checked == 0:
+        failures.append("no baseline benchmarks matched the results (empty/mismatched run?)")
+    return failures
+
+
+def run_update(baseline, results, baseline_path):
+    benchmarks = baseline.setdefault("benchmarks", {})
+    updated = 0
+    for name, bench in index_results(results).items():
+        benchmarks[name] = {"median_ms": round(float(bench.get("median_ms", 0.0)), 4),
+                            "items": int(bench.get("items", 0))}
+        updated += 1
+    baseline["build"] = results.get("build", baseline.get("build"))
+    baseline["benchmarks"] = dict(sorted(benchmarks.items()))
+    with open(baseline_path, "w", encoding="utf-8") as f:
+        json.dump(baseline, f, indent=2)
+        f.write("\n")
+    print("Updated %d baseline benchmarks" % updated)
+    return []
+
+
+def main(argv=None):
+    ap = argparse.ArgumentParser(description="Zenith benchmark regression gate")
+    ap.add_argument("--baseline", default=DEFAULT_BASELINE)
+    ap.add_argument("--results", default=None, help="--bench-json results file (LIVE mode)")
+    ap.add_argument("--update", action="store_true", help="rewrite baseline medians from --results")
+    args = ap.parse_args(argv)
+
+    baseline = load_json(args.baseline)
+
+    if args.update:
+        if not args.results:
+            print("ERROR: --update requires --results", file=sys.stderr)
+            return 2
+        run_update(baseline, load_json(args.results), args.baseline)
+        return 0
+
+    if args.results:
+        failures = run_live(baseline, load_json(args.results))
+        mode = "LIVE"
+    else:
+        failures = run_ratchet(baseline)
+        mode = "RATCHET"
+        unmeasured = unmeasured_benchmarks(baseline)
+        if unmeasured:
+            print("NOTE: %d baseline benchmark(s) unmeasured; a LIVE run covering them fails:" % len(unmeasured))
+            for name in unmeasured:
+                print("  - " + name)
+
+    if failures:
+        print("=" * 70)
+        print(" BENCHMARK GATE FAILED (%s)" % mode)
+        print("=" * 70)
+        for f in failures:
+            print("  - " + f)
+        print("\nIf a slowdown is justified, update Tools/bench_baseline.json in the same")
+        print("commit (python Tools/check_bench_baseline.py --update --results <file>).")
+        return 1
+
+    print("Benchmark gate passed (%s)." % mode)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -14,7 +14,9 @@ Rules enforced on ADDED lines only (the historical backlog is ignored):
   4. std::unordered_map / std::unordered_set forbidden in Zenith/. Use
      Zenith_HashMap / Zenith_HashSet. Allowlist via same-line comment:
          // #TODO: Replace with engine hash map   (the legacy form also
-     acceptable during migration)
+     acceptable during migration), or, where the STL container is the point
+     (e.g. a benchmark baseline):
+         // ZENITH_ALLOW_STD_UNORDERED: <reason>
   5. A newly added .cpp file inside Zenith/ must have "#include \"Zenith.h\""
      as its first non-blank, non-comment line.
 
@@ -63,6 +65,7 @@ LEGACY_MAP_MARKER = re.compile(
     r"//\s*(?:#TODO|TODO):\s*Replace\s+(?:std::)?(?:with\s+)?engine\s+hash",
     re.IGNORECASE,
 )
+ALLOW_STD_UNORDERED_MARKER = re.compile(r"//\s*ZENITH_ALLOW_STD_UNORDERED:\s*\S")
 
 
 # ---- Diff parsing ----------------------------------------------------------
@@ -164,7 +167,8 @@ def check_line_violations(path, line_index, line):
             f"(use Zenith_Mutex).",
         ))
 
-    if STD_UMAP_RE.search(code) and not LEGACY_MAP_MARKER.search(line):
+    if (STD_UMAP_RE.search(code) and not LEGACY_MAP_MARKER.search(line)
+            and not ALLOW_STD_UNORDERED_MARKER.search(line)):
         violations.append((
             "std::unordered_map/set",
             f"{path}:{line_index + 1}: std::unordered_map / std::unordered_set "
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Unit tests for the benchmark gate decision logic (Tools/check_bench_baseline.py).
+
+Pure/deterministic — no build, no benchmark run. Run: python Tools/tests/test_check_bench_baseline.py
+"""
+import json
+import os
+import sys
+import tempfile
+import unittest
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from check_bench_baseline import evaluate_benchmark, run_live, run_ratchet, run_update, unmeasured_benchmarks  # noqa: E402
+
+
+def _results(build="release", **benchmarks):
+    return {"schema": 1, "build": build, "warmup": 1, "samples": 5,
+            "benchmarks": [dict({"name": name}, **fields) for name, fields in benchmarks.items()]}
+
+
+class TestEvaluateBenchmark(unittest.TestCase):
+    def test_within_tolerance_passes(self):
+        # baseline 10 ms, tol 25% -> limit 12.5; 12.4 passes
+        ok, _ = evaluate_benchmark(actual_median_ms=12.4, baseline_median_ms=10.0, tolerance_pct=25)
+        self.assertTrue(ok)
+
+    def test_beyond_tolerance_fails(self):
+        ok, reason = evaluate_benchmark(actual_median_ms=12.6, baseline_median_ms=10.0, tolerance_pct=25)
+        self.assertFalse(ok)
+        self.assertIn("regressed", reason)
+
+    def test_faster_passes(self):
+        ok, _ = evaluate_benchmark(actual_median_ms=1.0, baseline_median_ms=10.0, tolerance_pct=0)
+        self.assertTrue(ok)
+
+    def test_zero_baseline_fails_as_unmeasured(self):
+        ok, reason = evaluate_benchmark(actual_median_ms=1.0, baseline_median_ms=0, tolerance_pct=25)
+        self.assertFalse(ok)
+        self.assertIn("unmeasured", reason)
+
+
+class TestLive(unittest.TestCase):
+    BASELINE = {"tolerance_pct": 25.0, "build": "release",
+                "benchmarks": {"nav.pathfind_grid64": {"median_ms": 10.0, "items": 500},
+                               "ecs.query_foreach_10k": {"median_ms": 2.0, "items": 0},
+                               "nav.bake_arena48": {"median_ms": 0, "items": 0}}}
+
+    def test_matching_run_passes(self):
+        results = _results(**{"nav.pathfind_grid64": {"median_ms": 11.0, "items": 500, "items_stable": True}})
+        self.assertEqual(run_live(self.BASELINE, results), [])
+
+    def test_slow_run_fails(self):
+        results = _results(**{"nav.pathfind_grid64": {"median_ms": 20.0, "items": 500, "items_stable": True}})
+        failures = run_live(self.BASELINE, results)
+        self.assertEqual(len(failures), 1)
+        self.assertIn("regressed", failures[0])
+
+    def test_other_build_skips_timings_but_not_items(self):
+        results = _results(build="debug", **{"nav.pathfind_grid64": {"median_ms": 200.0, "items": 499, "items_stable": True}})
+        failures = run_live(self.BASELINE, results)
+        self.assertEqual(len(failures), 1)
+        self.assertIn("499 items", failures[0])
+
+    def test_unstable_items_fail(self):
+        results = _results(**{"ecs.query_foreach_10k": {"median_ms": 1.0, "items": 7, "items_stable": False}})
+        failures = run_live(self.BASELINE, results)
+        self.assertEqual(len(failures), 1)
+        self.assertIn("changed between samples", failures[0])
+
+    def test_unmeasured_baseline_fails_when_covered(self):
+        results = _results(**{"nav.bake_arena48": {"median_ms": 5.0, "items": 1, "items_stable": True}})
+        failures = run_live(self.BASELINE, results)
+        self.assertEqual(len(failures), 1)
+        self.assertIn("unmeasured", failures[0])
+
+    def test_unmeasured_baseline_fails_for_other_build_too(self):
+        results = _results(build="debug", **{"nav.bake_arena48": {"median_ms": 5.0, "items": 1, "items_stable": True}})
+        failures = run_live(self.BASELINE, results)
+        self.assertEqual(len(failures), 1)
+        self.assertIn("unmeasured", failures[0])
+
+    def test_unmatched_results_fail(self):
+        results = _results(**{"tasks.parallel_for_grain64": {"median_ms": 1.0, "items": 1, "items_stable": True}})
+        self.assertEqual(len(run_live(self.BASELINE, results)), 1)
+
+
+class TestRatchetAndUpdate(unittest.TestCase):
+    def test_negative_median_fails(self):
+        self.assertEqual(len(run_ratchet({"benchmarks": {"a.b": {"median_ms": -1}}})), 1)
+
+    def test_unmeasured_entries_are_listed_not_failed(self):
+        baseline = {"benchmarks": {"b.zero": {"median_ms": 0}, "a.zero": {"median_ms": 0}, "c.set": {"median_ms": 1.5}}}
+        self.assertEqual(run_ratchet(baseline), [])
+        self.assertEqual(unmeasured_benchmarks(baseline), ["a.zero", "b.zero"])
+
+    def test_committed_baseline_is_well_formed(self):
+        p = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), "bench_baseline.json")
+        with open(p, "r", encoding="utf-8") as f:
+            self.assertEqual(run_ratchet(json.load(f)), [])
+
+    def test_update_records_medians_items_and_build(self):
+        fd, path = tempfile.mkstemp(suffix=".json")
+        os.close(fd)
+        try:
+            baseline = {"tolerance_pct": 25.0, "build": "release", "benchmarks": {"old.kept": {"median_ms": 3.0, "items": 1}}}
+            results = _results(build="debug", **{"new.added": {"median_ms": 1.23456, "items": 42, "items_stable": True}})
+            run_update(baseline, results, path)
+            with open(path, "r", encoding="utf-8") as f:
+                written = json.load(f)
+            self.assertEqual(written["build"], "debug")
+            self.assertEqual(written["benchmarks"]["new.added"], {"median_ms": 1.2346, "items": 42})
+            self.assertEqual(written["benchmarks"]["old.kept"]["median_ms"], 3.0)
+        finally:
+            os.remove(path)
+
+
+if __name__ == "__main__":
+    unittest.main(verbosity=2)
@@ -168,7 +168,7 @@ void Zenith_UnitTests::TestNavMeshFindNearestPolygonInCell(){
 		Zenith_Maths::Vector3 xNearestOut(0.0f);
 
 		// Pass an index beyond grid bounds -- should return early without modifying outputs
-		uint32_t uInvalidCellIndex = xNavMesh.m_axGridCells.GetSize() + 10;
+		uint32_t uInvalidCellIndex = xNavMesh.GetGridCellCount() + 10;
 		xNavMesh.FindNearestPolygonInCell(uInvalidCellIndex, Zenith_Maths::Vector3(50.0f, 0.0f, 50.0f),
 			fMinDistSq, uPolyOut, xNearestOut);
 
@@ -902,3 +902,152 @@ void Zenith_UnitTests::TestNavMeshLoadFromFileRejectsCorruptFile()
 	}
 }
 
+// ============================================================================
+// Flattened query layout: the CSR spatial grid, per-polygon bounds and the A*
+// search mirror are all derived from m_axPolygons, so each must agree with it
+// (or with a brute-force scan of it) after every kind of edit.
+// ============================================================================
+
+namespace
+{
+	// uCells x uCells unit quads at height fY, offset to (fOriginX, fOriginZ).
+	void NavMeshLayoutAddQuadGrid(Zenith_NavMesh& xMesh, uint32_t uCells, float fOriginX, float fOriginZ, float fY)
+	{
+		const uint32_t uFirst = xMesh.GetVertexCount();
+		for (uint32_t uZ = 0; uZ <= uCells; ++uZ)
+		{
+			for (uint32_t uX = 0; uX <= uCells; ++uX)
+			{
+				xMesh.AddVertex(Zenith_Maths::Vector3(fOriginX + static_cast<float>(uX), fY, fOriginZ + static_cast<float>(uZ)));
+			}
+		}
+
+		const uint32_t uRow = uCells + 1;
+		for (uint32_t uZ = 0; uZ < uCells; ++uZ)
+		{
+			for (uint32_t uX = 0; uX < uCells; ++uX)
+			{
+				const uint32_t uV = uFirst + uZ * uRow + uX;
+				Zenith_Vector<uint32_t> axQuad;
+				axQuad.PushBack(uV); axQuad.PushBack(uV + uRow); axQuad.PushBack(uV + uRow + 1); axQuad.PushBack(uV + 1);
+				xMesh.AddPolygon(axQuad);
+			}
+		}
+	}
+
+	// Every polygon's search node must mirror its center, cost, flags and
+	// full neighbour list (phantom slots included).
+	bool NavMeshSearchLayoutMatches(const Zenith_NavMesh& xMesh)
+	{
+		for (uint32_t uPoly = 0; uPoly < xMesh.GetPolygonCount(); ++uPoly)
+		{
+			const Zenith_NavMeshPolygon& xPoly = xMesh.GetPolygon(uPoly);
+			const Zenith_NavMesh::SearchNode& xNode = xMesh.GetSearchNode(uPoly);
+			if (xNode.m_xCenter != xPoly.m_xCenter || xNode.m_fCost != xPoly.m_fCost || xNode.m_uFlags != xPoly.m_uFlags) return false;
+			if (xNode.m_uNeighbourCount != xPoly.m_axNeighborIndices.GetSize()) return false;
+			for (uint32_t u = 0; u < xNode.m_uNeighbourCount; ++u)
+			{
+				if (xMesh.GetSearchNeighbour(xNode, u) != xPoly.m_axNeighborIndices.Get(u)) return false;
+			}
+		}
+		return true;
+	}
+}
+
+ZENITH_TEST(AI, NavMeshFlatGridMatchesBruteForce) { Zenith_UnitTests::TestNavMeshFlatGridMatchesBruteForce(); }
+void Zenith_UnitTests::TestNavMeshFlatGridMatchesBruteForce()
+{
+	// A 20 m ground plus a raised deck over part of it: several 5 m grid cells,
+	// and cells holding polygons at two heights, so the AABB rejection in
+	// FindNearestPolygonInCell has to use Y as well as XZ.
+	Zenith_NavMesh xMesh;
+	NavMeshLayoutAddQuadGrid(xMesh, 20, 0.0f, 0.0f, 0.0f);
+	NavMeshLayoutAddQuadGrid(xMesh, 6, 7.0f, 7.0f, 3.0f);
+	xMesh.ComputeAdjacency();
+	xMesh.BuildSpatialGrid();
+
+	ZENITH_ASSERT_GT(xMesh.GetGridCellCount(), 1u, "The fixture must span several grid cells");
+	ZENITH_ASSERT_EQ(xMesh.m_auGridCellStart.Get(0), 0u, "The first cell starts the array");
+	ZENITH_ASSERT_EQ(xMesh.m_auGridCellStart.Get(xMesh.GetGridCellCount()), xMesh.m_auGridPolygons.GetSize(),
+		"The last cell ends the array");
+
+	// Each polygon is filed under the cell holding its center.
+	for (uint32_t uPoly = 0; uPoly < xMesh.GetPolygonCount(); ++uPoly)
+	{
+		int32_t iX, iZ;
+		xMesh.GetGridCoords(xMesh.GetPolygon(uPoly).m_xCenter, iX, iZ);
+		const uint32_t uCell = xMesh.GetGridCellIndex(iX, iZ);
+		bool bFound = false;
+		for (uint32_t u = xMesh.m_auGridCellStart.Get(uCell); u < xMesh.m_auGridCellStart.Get(uCell + 1); ++u)
+		{
+			bFound |= xMesh.m_auGridPolygons.Get(u) == uPoly;
+		}
+		ZENITH_ASSERT_TRUE(bFound, "Polygon %u missing from its center's cell", uPoly);
+	}
+
+	// Points hovering over the mesh: the grid query must land on a polygon as
+	// close as the best one found by testing every polygon.
+	const Zenith_Maths::Vector3 axQueries[] = {
+		Zenith_Maths::Vector3(0.2f, 0.5f, 0.2f),
+		Zenith_Maths::Vector3(4.9f, 0.5f, 5.1f),
+		Zenith_Maths::Vector3(9.5f, 2.6f, 9.5f),   // just under the deck
+		Zenith_Maths::Vector3(9.5f, 1.0f, 9.5f),   // nearer the ground
+		Zenith_Maths::Vector3(12.9f, 3.4f, 7.1f),  // deck corner
+		Zenith_Maths::Vector3(19.8f, 0.1f, 19.8f),
+	};
+	for (const Zenith_Maths::Vector3& xQuery : axQueries)
+	{
+		float fBruteDistSq = std::numeric_limits<float>::max();
+		for (uint32_t uPoly = 0; uPoly < xMesh.GetPolygonCount(); ++uPoly)
+		{
+			const Zenith_Maths::Vector3 xClosest = xMesh.GetPolygon(uPoly).GetClosestPoint(xQuery, xMesh.GetVertices());
+			fBruteDistSq = std::min(fBruteDistSq, Zenith_Maths::LengthSq(xQuery - xClosest));
+		}
+
+		uint32_t uPoly = UINT32_MAX;
+		Zenith_Maths::Vector3 xNearest(0.0f);
+		ZENITH_ASSERT_TRUE(xMesh.FindNearestPolygon(xQuery, uPoly, xNearest, 4.0f));
+		ZENITH_ASSERT_EQ_FLOAT(Zenith_Maths::LengthSq(xQuery - xNearest), fBruteDistSq, 0.0001f,
+			"The grid query must find the true nearest surface");
+	}
+}
+
+ZENITH_TEST(AI, NavMeshSearchLayoutTracksMutations) { Zenith_UnitTests::TestNavMeshSearchLayoutTracksMutations(); }
+void Zenith_UnitTests::TestNavMeshSearchLayoutTracksMutations()
+{
+	Zenith_NavMesh xMesh;
+	ZENITH_ASSERT_EQ(xMesh.GetQueryLayoutBytes(), 0ull, "An empty mesh holds no query structures");
+
+	// A 2x2 patch and a detached 2x2 patch 2 m to its +X.
+	NavMeshLayoutAddQuadGrid(xMesh, 2, 0.0f, 0.0f, 0.0f);
+	NavMeshLayoutAddQuadGrid(xMesh, 2, 4.0f, 0.0f, 0.0f);
+	ZENITH_ASSERT_TRUE(NavMeshSearchLayoutMatches(xMesh), "AddPolygon appends a node");
+
+	xMesh.ComputeAdjacency();
+	ZENITH_ASSERT_TRUE(NavMeshSearchLayoutMatches(xMesh), "ComputeAdjacency repacks the neighbours");
+
+	xMesh.BuildSpatialGrid();
+	ZENITH_ASSERT_TRUE(NavMeshSearchLayoutMatches(xMesh), "BuildSpatialGrid carries the centers");
+	ZENITH_ASSERT_GT(xMesh.GetQueryLayoutBytes(), 0ull);
+
+	xMesh.SetPolygonBlocked(1, true);
+	xMesh.SetNeighbor(0, 0, 2);
+	ZENITH_ASSERT_TRUE(xMesh.GetSearchNode(1).IsBlocked());
+	ZENITH_ASSERT_TRUE(NavMeshSearchLayoutMatches(xMesh), "Flag and neighbour edits are mirrored");
+
+	// A stitched portal grows two lists in the middle of the packed array.
+	ZENITH_ASSERT_TRUE(xMesh.StitchPortalAt(Zenith_Maths::Vector3(3.0f, 0.0f, 0.5f),
+		Zenith_Maths::Vector3(1.0f, 0.0f, 0.0f), 1.5f));
+	ZENITH_ASSERT_TRUE(NavMeshSearchLayoutMatches(xMesh), "Phantom neighbours reach the search layout");
+
+	// The layout is rebuilt on load rather than read from the file.
+	Zenith_Vector<uint8_t> auBytes;
+	NavMeshPersistSerializeToBytes(xMesh, auBytes);
+	Zenith_NavMesh xLoaded;
+	ZENITH_ASSERT_TRUE(NavMeshPersistReadBytes(auBytes, xLoaded));
+	ZENITH_ASSERT_TRUE(NavMeshSearchLayoutMatches(xLoaded), "A loaded mesh gets its layout back");
+	ZENITH_ASSERT_EQ(xLoaded.GetQueryLayoutBytes(), xMesh.GetQueryLayoutBytes());
+
+	xLoaded.Clear();
+	ZENITH_ASSERT_EQ(xLoaded.GetQueryLayoutBytes(), 0ull, "Clear drops the query structures");
+}
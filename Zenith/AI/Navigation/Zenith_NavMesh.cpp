@@ -394,11 +394,16 @@ void Zenith_NavMesh::Clear()
 {
 	m_axVertices.Clear();
 	m_axPolygons.Clear();
-	m_axGridCells.Clear();
+	m_axSearchNodes.Clear();
+	m_aiSearchNeighbours.Clear();
+	m_auGridCellStart.Clear();
+	m_auGridPolygons.Clear();
+	m_axPolygonBounds.Clear();
 	m_uGridWidth = 0;
 	m_uGridHeight = 0;
 	m_xBoundsMin = Zenith_Maths::Vector3(0.0f);
 	m_xBoundsMax = Zenith_Maths::Vector3(0.0f);
+	m_uTopologyRevision++;
 	// Rewind the sampling stream too: a reloaded mesh must replay the same
 	// sequence, not continue the previous mesh's.
 	m_ulSampleRngState = k_ulSampleRngSeed;
@@ -416,7 +421,11 @@ uint32_t Zenith_NavMesh::AddPolygon(const Zenith_Vector<uint32_t>& axVertexIndic
 	uint32_t uIndex = m_axPolygons.GetSize();
 
 	Zenith_NavMeshPolygon xPoly;
-	xPoly.m_axVertexIndices = axVertexIndices;
+	xPoly.m_axVertexIndices.Reserve(axVertexIndices.GetSize());
+	for (uint32_t u = 0; u < axVertexIndices.GetSize(); ++u)
+	{
+		xPoly.m_axVertexIndices.PushBack(axVertexIndices.Get(u));
+	}
 
 	// Initialize neighbor indices to -1 (no neighbor)
 	xPoly.m_axNeighborIndices.Clear();
@@ -427,9 +436,47 @@ uint32_t Zenith_NavMesh::AddPolygon(const Zenith_Vector<uint32_t>& axVertexIndic
 	}
 
 	m_axPolygons.PushBack(std::move(xPoly));
+	AppendSearchNode(uIndex);
+	m_uTopologyRevision++;
 	return uIndex;
 }
 
+void Zenith_NavMesh::AppendSearchNode(uint32_t uPoly)
+{
+	Zenith_Assert(uPoly == m_axSearchNodes.GetSize(), "AppendSearchNode: polygon %u is not the next node", uPoly);
+
+	const Zenith_NavMeshPolygon& xPoly = m_axPolygons.Get(uPoly);
+	SearchNode xNode;
+	xNode.m_xCenter = xPoly.m_xCenter;
+	xNode.m_fCost = xPoly.m_fCost;
+	xNode.m_uFlags = xPoly.m_uFlags;
+	xNode.m_uFirstNeighbour = m_aiSearchNeighbours.GetSize();
+	xNode.m_uNeighbourCount = xPoly.m_axNeighborIndices.GetSize();
+	for (uint32_t u = 0; u < xPoly.m_axNeighborIndices.GetSize(); ++u)
+	{
+		m_aiSearchNeighbours.PushBack(xPoly.m_axNeighborIndices.Get(u));
+	}
+	m_axSearchNodes.PushBack(xNode);
+}
+
+void Zenith_NavMesh::RebuildSearchLayout()
+{
+	uint32_t uNeighbourTotal = 0;
+	for (uint32_t u = 0; u < m_axPolygons.GetSize(); ++u)
+	{
+		uNeighbourTotal += m_axPolygons.Get(u).m_axNeighborIndices.GetSize();
+	}
+
+	m_axSearchNodes.Clear();
+	m_aiSearchNeighbours.Clear();
+	m_axSearchNodes.Reserve(m_axPolygons.GetSize());
+	m_aiSearchNeighbours.Reserve(uNeighbourTotal);
+	for (uint32_t u = 0; u < m_axPolygons.GetSize(); ++u)
+	{
+		AppendSearchNode(u);
+	}
+}
+
 void Zenith_NavMesh::SetNeighbor(uint32_t uPoly1, uint32_t uEdge1, uint32_t uPoly2)
 {
 	Zenith_Assert(uPoly1 < m_axPolygons.GetSize(), "Polygon index out of bounds");
@@ -439,6 +486,8 @@ void Zenith_NavMesh::SetNeighbor(uint32_t uPoly1, uint32_t uEdge1, uint32_t uPol
 	Zenith_Assert(uEdge1 < xPoly1.m_axNeighborIndices.GetSize(), "Edge index out of bounds");
 
 	xPoly1.m_axNeighborIndices.Get(uEdge1) = static_cast<int32_t>(uPoly2);
+	m_aiSearchNeighbours.Get(m_axSearchNodes.Get(uPoly1).m_uFirstNeighbour + uEdge1) = static_cast<int32_t>(uPoly2);
+	m_uTopologyRevision++;
 }
 
 void Zenith_NavMesh::ComputeSpatialData()
@@ -467,11 +516,14 @@ void Zenith_NavMesh::ComputeSpatialData()
 	for (uint32_t u = 0; u < m_axPolygons.GetSize(); ++u)
 	{
 		m_axPolygons.Get(u).ComputeSpatialData(m_axVertices);
+		m_axSearchNodes.Get(u).m_xCenter = m_axPolygons.Get(u).m_xCenter;
 	}
 }
 
 void Zenith_NavMesh::ComputeAdjacency()
 {
+	m_uTopologyRevision++;
+
 	// For each polygon, check all other polygons for shared edges
 	for (uint32_t uPoly1 = 0; uPoly1 < m_axPolygons.GetSize(); ++uPoly1)
 	{
@@ -515,10 +567,22 @@ void Zenith_NavMesh::ComputeAdjacency()
 			}
 		}
 	}
+
+	// The reset above drops any stitched phantom slots, so lengths can change.
+	RebuildSearchLayout();
 }
 
 void Zenith_NavMesh::BuildSpatialGrid()
 {
+	m_uTopologyRevision++;  // centers move, so path costs do too
+
+	// Every bake and load ends here, so this is where the search layout is
+	// resynchronised with whatever was written into m_axPolygons directly.
+	RebuildSearchLayout();
+	m_auGridCellStart.Clear();
+	m_auGridPolygons.Clear();
+	m_axPolygonBounds.Clear();
+
 	if (m_axPolygons.GetSize() == 0)
 	{
 		return;
@@ -528,6 +592,45 @@ void Zenith_NavMesh::BuildSpatialGrid()
 	// This is safe to call multiple times as it just recomputes the same values
 	ComputeSpatialData();
 
+	// Per-polygon 3D bounds: XZ for the cell range, Y for query rejection
+	m_axPolygonBounds.Reserve(m_axPolygons.GetSize());
+	for (uint32_t uPoly = 0; uPoly < m_axPolygons.GetSize(); ++uPoly)
+	{
+		m_axPolygonBounds.PushBack(ComputePolygonBounds(m_axPolygons.Get(uPoly)));
+	}
+
+	BinPolygonsIntoGrid();
+}
+
+Zenith_NavMesh::PolygonBounds Zenith_NavMesh::EmptyPolygonBounds()
+{
+	PolygonBounds xBounds;
+	xBounds.m_xMin = Zenith_Maths::Vector3(FLT_MAX);
+	xBounds.m_xMax = Zenith_Maths::Vector3(-FLT_MAX);
+	return xBounds;
+}
+
+Zenith_NavMesh::PolygonBounds Zenith_NavMesh::ComputePolygonBounds(const Zenith_NavMeshPolygon& xPoly) const
+{
+	if (xPoly.m_axVertexIndices.GetSize() == 0)
+	{
+		return EmptyPolygonBounds();
+	}
+
+	PolygonBounds xBounds;
+	ComputePolygonBounds2D(xPoly, m_axVertices, xBounds.m_xMin, xBounds.m_xMax);
+	xBounds.m_xMin.y = xBounds.m_xMax.y = m_axVertices.Get(xPoly.m_axVertexIndices.Get(0)).y;
+	for (uint32_t u = 1; u < xPoly.m_axVertexIndices.GetSize(); ++u)
+	{
+		const float fY = m_axVertices.Get(xPoly.m_axVertexIndices.Get(u)).y;
+		xBounds.m_xMin.y = std::min(xBounds.m_xMin.y, fY);
+		xBounds.m_xMax.y = std::max(xBounds.m_xMax.y, fY);
+	}
+	return xBounds;
+}
+
+void Zenith_NavMesh::BinPolygonsIntoGrid()
+{
 	// Calculate grid dimensions
 	Zenith_Maths::Vector3 xSize = m_xBoundsMax - m_xBoundsMin;
 	m_uGridWidth = static_cast<uint32_t>(std::ceil(xSize.x / m_fGridCellSize)) + 1;
@@ -537,42 +640,297 @@ void Zenith_NavMesh::BuildSpatialGrid()
 	m_uGridWidth = std::min(m_uGridWidth, 256u);
 	m_uGridHeight = std::min(m_uGridHeight, 256u);
 
-	// Allocate grid
-	m_axGridCells.Clear();
-	uint32_t uGridSize = m_uGridWidth * m_uGridHeight;
-	m_axGridCells.Reserve(uGridSize);
-	for (uint32_t u = 0; u < uGridSize; ++u)
+	// Two passes over the same cell ranges: count into the start array, turn
+	// the counts into offsets, then fill. Cells keep polygons in index order.
+	const uint32_t uGridSize = m_uGridWidth * m_uGridHeight;
+	m_auGridCellStart.Clear();
+	m_auGridPolygons.Clear();
+	m_auGridCellStart.Resize(uGridSize + 1, 0u);
+	for (uint32_t uPass = 0; uPass < 2; ++uPass)
 	{
-		m_axGridCells.PushBack(GridCell());
+		if (uPass == 1)
+		{
+			uint32_t uRunning = 0;
+			for (uint32_t u = 0; u <= uGridSize; ++u)
+			{
+				const uint32_t uCount = m_auGridCellStart.Get(u);
+				m_auGridCellStart.Get(u) = uRunning;
+				uRunning += uCount;
+			}
+			m_auGridPolygons.Resize(uRunning, 0u);
+		}
+
+		for (uint32_t uPoly = 0; uPoly < m_axPolygonBounds.GetSize(); ++uPoly)
+		{
+			const PolygonBounds& xBounds = m_axPolygonBounds.Get(uPoly);
+			if (xBounds.m_xMin.x > xBounds.m_xMax.x)
+			{
+				continue;  // Vacant
+			}
+
+			// Get cell range
+			int32_t iMinX, iMinZ, iMaxX, iMaxZ;
+			GetGridCoords(xBounds.m_xMin, iMinX, iMinZ);
+			GetGridCoords(xBounds.m_xMax, iMaxX, iMaxZ);
+
+			for (int32_t iZ = iMinZ; iZ <= iMaxZ; ++iZ)
+			{
+				for (int32_t iX = iMinX; iX <= iMaxX; ++iX)
+				{
+					const uint32_t uCellIndex = GetGridCellIndex(iX, iZ);
+					if (uPass == 0)
+					{
+						m_auGridCellStart.Get(uCellIndex)++;
+					}
+					else
+					{
+						// The start doubles as a write cursor, leaving it at the
+						// cell's end; the shift below restores it.
+						m_auGridPolygons.Get(m_auGridCellStart.Get(uCellIndex)++) = uPoly;
+					}
+				}
+			}
+		}
 	}
 
-	// Add each polygon to all cells it overlaps
-	for (uint32_t uPoly = 0; uPoly < m_axPolygons.GetSize(); ++uPoly)
+	// After the fill each start holds its cell's end, i.e. the next cell's start.
+	for (uint32_t u = uGridSize; u > 0; --u)
 	{
-		const Zenith_NavMeshPolygon& xPoly = m_axPolygons.Get(uPoly);
+		m_auGridCellStart.Get(u) = m_auGridCellStart.Get(u - 1);
+	}
+	m_auGridCellStart.Get(0) = 0;
+}
 
-		// Get polygon bounds
-		Zenith_Maths::Vector3 xPolyMin, xPolyMax;
-		ComputePolygonBounds2D(xPoly, m_axVertices, xPolyMin, xPolyMax);
+void Zenith_NavMesh::SetVertex(uint32_t uIndex, const Zenith_Maths::Vector3& xVertex)
+{
+	Zenith_Assert(uIndex < m_axVertices.GetSize(), "Vertex index out of bounds");
+	m_axVertices.Get(uIndex) = xVertex;
+	m_uTopologyRevision++;
+}
 
-		// Get cell range
-		int32_t iMinX, iMinZ, iMaxX, iMaxZ;
-		GetGridCoords(xPolyMin, iMinX, iMinZ);
-		GetGridCoords(xPolyMax, iMaxX, iMaxZ);
+uint32_t Zenith_NavMesh::AddVacantPolygons(uint32_t uCount, uint32_t uMaxVertices)
+{
+	const uint32_t uFirst = m_axPolygons.GetSize();
+	for (uint32_t u = 0; u < uCount; ++u)
+	{
+		Zenith_NavMeshPolygon xPoly;
+		xPoly.m_uFlags = Zenith_NavMeshPolygon::FLAG_BLOCKED;
+		m_axPolygons.PushBack(std::move(xPoly));
+
+		SearchNode xNode;
+		xNode.m_uFlags = Zenith_NavMeshPolygon::FLAG_BLOCKED;
+		xNode.m_uFirstNeighbour = m_aiSearchNeighbours.GetSize();
+		for (uint32_t uRoom = 0; uRoom < uMaxVertices; ++uRoom)
+		{
+			m_aiSearchNeighbours.PushBack(iZENITH_NAVMESH_NO_NEIGHBOUR);
+		}
+		m_axSearchNodes.PushBack(xNode);
+
+		// Only meaningful once a grid exists; RefreshSpatialGrid reads it.
+		if (m_axPolygonBounds.GetSize() == uFirst + u)
+		{
+			m_axPolygonBounds.PushBack(EmptyPolygonBounds());
+		}
+	}
+	m_uTopologyRevision++;
+	return uFirst;
+}
+
+void Zenith_NavMesh::ReplacePolygon(uint32_t uPoly, const Zenith_Vector<uint32_t>& axVertexIndices)
+{
+	Zenith_Assert(uPoly < m_axPolygons.GetSize(), "Polygon index out of bounds");
+
+	Zenith_NavMeshPolygon& xPoly = m_axPolygons.Get(uPoly);
+	xPoly.m_axVertexIndices.Clear();
+	xPoly.m_axNeighborIndices.Clear();
+	for (uint32_t u = 0; u < axVertexIndices.GetSize(); ++u)
+	{
+		Zenith_Assert(axVertexIndices.Get(u) < m_axVertices.GetSize(), "Vertex index out of bounds");
+		xPoly.m_axVertexIndices.PushBack(axVertexIndices.Get(u));
+		xPoly.m_axNeighborIndices.PushBack(iZENITH_NAVMESH_NO_NEIGHBOUR);
+	}
+	xPoly.m_uFlags = axVertexIndices.GetSize() == 0 ? Zenith_NavMeshPolygon::FLAG_BLOCKED : 0u;
+	xPoly.m_fCost = 1.0f;
+	xPoly.ComputeSpatialData(m_axVertices);
+	m_uTopologyRevision++;
+
+	// The node keeps its place in the packed neighbour array when the new list
+	// fits in the room it already has; otherwise everything is repacked.
+	SearchNode& xNode = m_axSearchNodes.Get(uPoly);
+	const uint32_t uRoomEnd = uPoly + 1 < m_axSearchNodes.GetSize()
+		? m_axSearchNodes.Get(uPoly + 1).m_uFirstNeighbour : m_aiSearchNeighbours.GetSize();
+	if (xPoly.m_axNeighborIndices.GetSize() > uRoomEnd - xNode.m_uFirstNeighbour)
+	{
+		RebuildSearchLayout();
+		return;
+	}
+	xNode.m_xCenter = xPoly.m_xCenter;
+	xNode.m_fCost = xPoly.m_fCost;
+	xNode.m_uFlags = xPoly.m_uFlags;
+	xNode.m_uNeighbourCount = xPoly.m_axNeighborIndices.GetSize();
+	for (uint32_t u = 0; u < xNode.m_uNeighbourCount; ++u)
+	{
+		m_aiSearchNeighbours.Get(xNode.m_uFirstNeighbour + u) = iZENITH_NAVMESH_NO_NEIGHBOUR;
+	}
+}
+
+void Zenith_NavMesh::ClearNeighbor(uint32_t uPoly, uint32_t uEdge)
+{
+	Zenith_Assert(uPoly < m_axPolygons.GetSize(), "Polygon index out of bounds");
+
+	Zenith_NavMeshPolygon& xPoly = m_axPolygons.Get(uPoly);
+	Zenith_Assert(uEdge < xPoly.m_axNeighborIndices.GetSize(), "Edge index out of bounds");
+
+	xPoly.m_axNeighborIndices.Get(uEdge) = iZENITH_NAVMESH_NO_NEIGHBOUR;
+	m_aiSearchNeighbours.Get(m_axSearchNodes.Get(uPoly).m_uFirstNeighbour + uEdge) = iZENITH_NAVMESH_NO_NEIGHBOUR;
+	m_uTopologyRevision++;
+}
+
+void Zenith_NavMesh::RefreshSpatialGrid(const Zenith_Vector<uint32_t>& auPolygons)
+{
+	if (m_auGridCellStart.GetSize() == 0 || m_axPolygonBounds.GetSize() != m_axPolygons.GetSize())
+	{
+		BuildSpatialGrid();
+		return;
+	}
+	m_uTopologyRevision++;
 
-		// Add polygon to all overlapping cells
+	// Sorted and unique, so a cell's old run can be filtered by binary search
+	// and the merged run stays in index order, as a full bin leaves it.
+	m_auRefreshPolygons = auPolygons;
+	uint32_t* const puChanged = m_auRefreshPolygons.GetDataPointer();
+	std::sort(puChanged, puChanged + m_auRefreshPolygons.GetSize());
+	const uint32_t uChanged = static_cast<uint32_t>(
+		std::unique(puChanged, puChanged + m_auRefreshPolygons.GetSize()) - puChanged);
+
+	// Mark the cells each changed polygon covered, then swap in its new bounds.
+	const uint32_t uGridSize = GetGridCellCount();
+	m_auRefreshCells.Clear();
+	m_auRefreshCells.Resize(uGridSize, 0u);
+	auto MarkCells = [this](const PolygonBounds& xBounds)
+	{
+		if (xBounds.m_xMin.x > xBounds.m_xMax.x)
+		{
+			return;
+		}
+		int32_t iMinX, iMinZ, iMaxX, iMaxZ;
+		GetGridCoords(xBounds.m_xMin, iMinX, iMinZ);
+		GetGridCoords(xBounds.m_xMax, iMaxX, iMaxZ);
 		for (int32_t iZ = iMinZ; iZ <= iMaxZ; ++iZ)
 		{
 			for (int32_t iX = iMinX; iX <= iMaxX; ++iX)
 			{
-				uint32_t uCellIndex = GetGridCellIndex(iX, iZ);
-				if (uCellIndex < m_axGridCells.GetSize())
+				m_auRefreshCells.Get(GetGridCellIndex(iX, iZ)) = 1u;
+			}
+		}
+	};
+	for (uint32_t u = 0; u < uChanged; ++u)
+	{
+		const uint32_t uPoly = puChanged[u];
+		MarkCells(m_axPolygonBounds.Get(uPoly));
+		m_axPolygonBounds.Get(uPoly) = ComputePolygonBounds(m_axPolygons.Get(uPoly));
+	}
+
+	// Mesh bounds over the live polygons. When the XZ extent moved, the grid
+	// itself moves, so every polygon is re-binned.
+	PolygonBounds xMesh = EmptyPolygonBounds();
+	for (uint32_t uPoly = 0; uPoly < m_axPolygonBounds.GetSize(); ++uPoly)
+	{
+		const PolygonBounds& xBounds = m_axPolygonBounds.Get(uPoly);
+		xMesh.m_xMin = glm::min(xMesh.m_xMin, xBounds.m_xMin);
+		xMesh.m_xMax = glm::max(xMesh.m_xMax, xBounds.m_xMax);
+	}
+	if (xMesh.m_xMin.x > xMesh.m_xMax.x)
+	{
+		xMesh.m_xMin = xMesh.m_xMax = Zenith_Maths::Vector3(0.0f);
+	}
+	const bool bGridMoved = xMesh.m_xMin.x != m_xBoundsMin.x || xMesh.m_xMin.z != m_xBoundsMin.z
+		|| xMesh.m_xMax.x != m_xBoundsMax.x || xMesh.m_xMax.z != m_xBoundsMax.z;
+	m_xBoundsMin = xMesh.m_xMin;
+	m_xBoundsMax = xMesh.m_xMax;
+	if (bGridMoved)
+	{
+		BinPolygonsIntoGrid();
+		return;
+	}
+	for (uint32_t u = 0; u < uChanged; ++u)
+	{
+		MarkCells(m_axPolygonBounds.Get(puChanged[u]));
+	}
+
+	// Copy unmarked cells' runs as they are; in a marked cell, drop the changed
+	// polygons and merge their new entries back in index order.
+	m_auRefreshCellStart.Clear();
+	m_auRefreshGridPolygons.Clear();
+	m_auRefreshCellStart.Reserve(uGridSize + 1);
+	m_auRefreshGridPolygons.Reserve(m_auGridPolygons.GetSize());
+	for (uint32_t uCell = 0; uCell < uGridSize; ++uCell)
+	{
+		m_auRefreshCellStart.PushBack(m_auRefreshGridPolygons.GetSize());
+		const uint32_t uEnd = m_auGridCellStart.Get(uCell + 1);
+		if (m_auRefreshCells.Get(uCell) == 0u)
+		{
+			for (uint32_t u = m_auGridCellStart.Get(uCell); u < uEnd; ++u)
+			{
+				m_auRefreshGridPolygons.PushBack(m_auGridPolygons.Get(u));
+			}
+			continue;
+		}
+
+		const int32_t iCellX = static_cast<int32_t>(uCell % m_uGridWidth);
+		const int32_t iCellZ = static_cast<int32_t>(uCell / m_uGridWidth);
+		uint32_t uOld = m_auGridCellStart.Get(uCell);
+		uint32_t uNew = 0;
+		for (;;)
+		{
+			// Next surviving old entry and next changed polygon covering this cell.
+			while (uOld < uEnd && std::binary_search(puChanged, puChanged + uChanged, m_auGridPolygons.Get(uOld)))
+			{
+				++uOld;
+			}
+			for (; uNew < uChanged; ++uNew)
+			{
+				const PolygonBounds& xBounds = m_axPolygonBounds.Get(puChanged[uNew]);
+				if (xBounds.m_xMin.x > xBounds.m_xMax.x)
 				{
-					m_axGridCells.Get(uCellIndex).m_axPolygonIndices.PushBack(uPoly);
+					continue;
 				}
+				int32_t iMinX, iMinZ, iMaxX, iMaxZ;
+				GetGridCoords(xBounds.m_xMin, iMinX, iMinZ);
+				GetGridCoords(xBounds.m_xMax, iMaxX, iMaxZ);
+				if (iCellX >= iMinX && iCellX <= iMaxX && iCellZ >= iMinZ && iCellZ <= iMaxZ)
+				{
+					break;
+				}
+			}
+			const bool bOld = uOld < uEnd;
+			const bool bNew = uNew < uChanged;
+			if (!bOld && !bNew)
+			{
+				break;
+			}
+			if (bOld && (!bNew || m_auGridPolygons.Get(uOld) < puChanged[uNew]))
+			{
+				m_auRefreshGridPolygons.PushBack(m_auGridPolygons.Get(uOld++));
+			}
+			else
+			{
+				m_auRefreshGridPolygons.PushBack(puChanged[uNew++]);
 			}
 		}
 	}
+	m_auRefreshCellStart.PushBack(m_auRefreshGridPolygons.GetSize());
+
+	std::swap(m_auGridCellStart, m_auRefreshCellStart);
+	std::swap(m_auGridPolygons, m_auRefreshGridPolygons);
+}
+
+uint64_t Zenith_NavMesh::GetQueryLayoutBytes() const
+{
+	return static_cast<uint64_t>(m_axSearchNodes.GetSize()) * sizeof(SearchNode)
+		+ static_cast<uint64_t>(m_aiSearchNeighbours.GetSize()) * sizeof(int32_t)
+		+ static_cast<uint64_t>(m_axPolygonBounds.GetSize()) * sizeof(PolygonBounds)
+		+ static_cast<uint64_t>(m_auGridCellStart.GetSize() + m_auGridPolygons.GetSize()) * sizeof(uint32_t);
 }
 
 void Zenith_NavMesh::ComputePolygonBounds2D(const Zenith_NavMeshPolygon& xPoly,
@@ -610,18 +968,29 @@ uint32_t Zenith_NavMesh::GetGridCellIndex(int32_t iX, int32_t iZ) const
 void Zenith_NavMesh::FindNearestPolygonInCell(uint32_t uCellIndex, const Zenith_Maths::Vector3& xPoint,
 	float& fMinDistSq, uint32_t& uPolyOut, Zenith_Maths::Vector3& xNearestOut) const
 {
-	if (uCellIndex >= m_axGridCells.GetSize())
+	if (uCellIndex >= GetGridCellCount())
 	{
 		return;
 	}
 
-	const GridCell& xCell = m_axGridCells.Get(uCellIndex);
-
-	for (uint32_t u = 0; u < xCell.m_axPolygonIndices.GetSize(); ++u)
+	const uint32_t uEnd = m_auGridCellStart.Get(uCellIndex + 1);
+	for (uint32_t u = m_auGridCellStart.Get(uCellIndex); u < uEnd; ++u)
 	{
-		uint32_t uPoly = xCell.m_axPolygonIndices.Get(u);
-		const Zenith_NavMeshPolygon& xPoly = m_axPolygons.Get(uPoly);
+		uint32_t uPoly = m_auGridPolygons.Get(u);
 
+		// The AABB distance never exceeds the true one, so a box already
+		// farther than the best hit cannot hold a closer point.
+		const PolygonBounds& xBounds = m_axPolygonBounds.Get(uPoly);
+		const Zenith_Maths::Vector3 xBoxNearest(
+			std::max(xBounds.m_xMin.x, std::min(xPoint.x, xBounds.m_xMax.x)),
+			std::max(xBounds.m_xMin.y, std::min(xPoint.y, xBounds.m_xMax.y)),
+			std::max(xBounds.m_xMin.z, std::min(xPoint.z, xBounds.m_xMax.z)));
+		if (Zenith_Maths::LengthSq(xPoint - xBoxNearest) >= fMinDistSq)
+		{
+			continue;
+		}
+
+		const Zenith_NavMeshPolygon& xPoly = m_axPolygons.Get(uPoly);
 		Zenith_Maths::Vector3 xClosest = xPoly.GetClosestPoint(xPoint, m_axVertices);
 		float fDistSq = Zenith_Maths::LengthSq(xPoint - xClosest);
 
@@ -714,16 +1083,15 @@ uint32_t Zenith_NavMesh::FindPolygonContaining(const Zenith_Maths::Vector3& xPoi
 	GetGridCoords(xPoint, iX, iZ);
 	uint32_t uCellIndex = GetGridCellIndex(iX, iZ);
 
-	if (uCellIndex >= m_axGridCells.GetSize())
+	if (uCellIndex >= GetGridCellCount())
 	{
 		return UINT32_MAX;
 	}
 
-	const GridCell& xCell = m_axGridCells.Get(uCellIndex);
-
-	for (uint32_t u = 0; u < xCell.m_axPolygonIndices.GetSize(); ++u)
+	const uint32_t uEnd = m_auGridCellStart.Get(uCellIndex + 1);
+	for (uint32_t u = m_auGridCellStart.Get(uCellIndex); u < uEnd; ++u)
 	{
-		uint32_t uPoly = xCell.m_axPolygonIndices.Get(u);
+		uint32_t uPoly = m_auGridPolygons.Get(u);
 		const Zenith_NavMeshPolygon& xPoly = m_axPolygons.Get(uPoly);
 
 		// Check vertical distance to polygon plane
@@ -753,8 +1121,26 @@ void Zenith_NavMesh::SetPolygonBlocked(uint32_t uPoly, bool bBlocked) const
 	if (uPoly >= m_axPolygons.GetSize()) return;
 	Zenith_NavMeshPolygon& xPoly =
 		const_cast<Zenith_NavMeshPolygon&>(m_axPolygons.Get(uPoly));
+	if (xPoly.IsBlocked() == bBlocked) return;
 	if (bBlocked) xPoly.m_uFlags |=  Zenith_NavMeshPolygon::FLAG_BLOCKED;
 	else          xPoly.m_uFlags &= ~Zenith_NavMeshPolygon::FLAG_BLOCKED;
+	m_axSearchNodes.Get(uPoly).m_uFlags = xPoly.m_uFlags;
+
+	m_auBlockedJournal[m_uBlockedRevision % uBLOCKED_JOURNAL_SIZE] = uPoly;
+	m_uBlockedRevision++;
+}
+
+bool Zenith_NavMesh::GetBlockedChangesSince(uint32_t uRevision, Zenith_Vector<uint32_t>& axPolygonsOut) const
+{
+	// Unsigned difference, so a wrapped revision counter still measures correctly.
+	const uint32_t uMissed = m_uBlockedRevision - uRevision;
+	if (uMissed > uBLOCKED_JOURNAL_SIZE) return false;
+
+	for (uint32_t u = uRevision; u != m_uBlockedRevision; ++u)
+	{
+		axPolygonsOut.PushBack(m_auBlockedJournal[u % uBLOCKED_JOURNAL_SIZE]);
+	}
+	return true;
 }
 
 bool Zenith_NavMesh::StitchPortalAt(const Zenith_Maths::Vector3& xPoint,
@@ -807,7 +1193,8 @@ bool Zenith_NavMesh::StitchPortalAt(const Zenith_Maths::Vector3& xPoint,
 	// vertex-count is safe by construction:
 	//
 	// * A* (Zenith_Pathfinding::FindPathInternal) iterates the FULL
-	//   m_axNeighborIndices list, so the phantom neighbour is visited.
+	//   neighbour list (via the search layout, repacked below), so the
+	//   phantom neighbour is visited.
 	// * GetPortal (used by GetPortalMidpoint) only scans neighbour slots
 	//   indexed BY EDGE (i.e., u < m_axVertexIndices.GetSize()), so the
 	//   phantom is invisible to it -- and GetPortalMidpoint then falls
@@ -824,6 +1211,9 @@ bool Zenith_NavMesh::StitchPortalAt(const Zenith_Maths::Vector3& xPoint,
 	Zenith_NavMeshPolygon& xMutB = m_axPolygons.Get(uPolyB);
 	xMutA.m_axNeighborIndices.PushBack(static_cast<int32_t>(uPolyB));
 	xMutB.m_axNeighborIndices.PushBack(static_cast<int32_t>(uPolyA));
+	// Both lists grew mid-array; repack (doors stitch once, at OnStart).
+	RebuildSearchLayout();
+	m_uTopologyRevision++;
 	return true;
 }
 
@@ -838,13 +1228,13 @@ uint32_t Zenith_NavMesh::SetBlockedAtPoint(const Zenith_Maths::Vector3& xPoint,
 	int32_t iX, iZ;
 	GetGridCoords(xPoint, iX, iZ);
 	const uint32_t uCellIndex = GetGridCellIndex(iX, iZ);
-	if (uCellIndex >= m_axGridCells.GetSize()) return 0;
+	if (uCellIndex >= GetGridCellCount()) return 0;
 
 	uint32_t uToggled = 0;
-	const GridCell& xCell = m_axGridCells.Get(uCellIndex);
-	for (uint32_t u = 0; u < xCell.m_axPolygonIndices.GetSize(); ++u)
+	const uint32_t uEnd = m_auGridCellStart.Get(uCellIndex + 1);
+	for (uint32_t u = m_auGridCellStart.Get(uCellIndex); u < uEnd; ++u)
 	{
-		const uint32_t uPoly = xCell.m_axPolygonIndices.Get(u);
+		const uint32_t uPoly = m_auGridPolygons.Get(u);
 		const Zenith_NavMeshPolygon& xPoly = m_axPolygons.Get(uPoly);
 		const float fVertDist =
 			std::abs(Zenith_Maths::Dot(xPoint - xPoly.m_xCenter, xPoly.m_xNormal));
@@ -883,16 +1273,15 @@ bool Zenith_NavMesh::Raycast(const Zenith_Maths::Vector3& xStart,
 		GetGridCoords(xPos, iX, iZ);
 		uint32_t uCellIndex = GetGridCellIndex(iX, iZ);
 
-		if (uCellIndex >= m_axGridCells.GetSize())
+		if (uCellIndex >= GetGridCellCount())
 		{
 			continue;
 		}
 
-		const GridCell& xCell = m_axGridCells.Get(uCellIndex);
-
-		for (uint32_t u = 0; u < xCell.m_axPolygonIndices.GetSize(); ++u)
+		const uint32_t uEnd = m_auGridCellStart.Get(uCellIndex + 1);
+		for (uint32_t u = m_auGridCellStart.Get(uCellIndex); u < uEnd; ++u)
 		{
-			uint32_t uPoly = xCell.m_axPolygonIndices.Get(u);
+			uint32_t uPoly = m_auGridPolygons.Get(u);
 			const Zenith_NavMeshPolygon& xPoly = m_axPolygons.Get(uPoly);
 
 			// Ray-plane intersection
@@ -1381,7 +1770,7 @@ Zenith_NavMesh* Zenith_NavMesh::LoadFromFile(const std::string& strPath)
 	}
 
 	Zenith_DataStream xStream;
-	xStream.ReadFromFile(strPath.c_str());
+	xStream.MapFromFile(strPath.c_str());
 	if (!xStream.IsValid())
 	{
 		Zenith_Assert(false, "NavMesh load: unreadable file: %s", strPath.c_str());
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Collections/Zenith_InlineVector.h"
 #include "Collections/Zenith_Vector.h"
 #include "Maths/Zenith_Maths.h"
 #include <cstdint>
@@ -72,17 +73,20 @@ struct Zenith_NavMeshDebugDrawFlags
  */
 struct Zenith_NavMeshPolygon
 {
-	// Indices into the NavMesh vertex array (CCW winding)
-	Zenith_Vector<uint32_t> m_axVertexIndices;
+	// Indices into the NavMesh vertex array (CCW winding). Inline up to
+	// uINLINE_VERTICES so the generator's quads (and most merged polygons)
+	// live in the polygon itself rather than in two heap blocks.
+	static constexpr uint32_t uINLINE_VERTICES = 6;
+	Zenith_InlineVector<uint32_t, uINLINE_VERTICES> m_axVertexIndices;
 
 	// Indices of adjacent polygons (-1 if no neighbor on that edge)
 	// Edge i connects vertices [i] and [(i+1) % vertexCount]
-	Zenith_Vector<int32_t> m_axNeighborIndices;
+	Zenith_InlineVector<int32_t, uINLINE_VERTICES> m_axNeighborIndices;
 
 	// Cached spatial data
-	Zenith_Maths::Vector3 m_xCenter;
-	Zenith_Maths::Vector3 m_xNormal;
-	float m_fArea;
+	Zenith_Maths::Vector3 m_xCenter{ 0.0f };
+	Zenith_Maths::Vector3 m_xNormal{ 0.0f };
+	float m_fArea = 0.0f;
 
 	// For pathfinding
 	uint32_t m_uFlags = 0;  // Custom flags (e.g., walkability modifiers)
@@ -185,6 +189,48 @@ public:
 	 */
 	void BuildSpatialGrid();
 
+	// ========== In-place edits ==========
+	//
+	// For an owner that regenerates part of a built mesh and must keep every
+	// other polygon index valid (Zenith_TiledNavMesh). A VACANT polygon has no
+	// vertices and no neighbours and is BLOCKED; it is left out of the spatial
+	// grid, so no query or search can reach it. Vacant polygons are a runtime
+	// state only: the ZNAV reader rejects them, so do not save such a mesh.
+
+	/**
+	 * Overwrite an existing vertex. Polygons using it keep stale spatial data
+	 * until they are replaced or BuildSpatialGrid runs.
+	 */
+	void SetVertex(uint32_t uIndex, const Zenith_Maths::Vector3& xVertex);
+
+	/**
+	 * Append uCount vacant polygons, each with search-layout room for
+	 * uMaxVertices neighbours so ReplacePolygon can fill it without a repack.
+	 * @return Index of the first new polygon
+	 */
+	uint32_t AddVacantPolygons(uint32_t uCount, uint32_t uMaxVertices);
+
+	/**
+	 * Give polygon uPoly new vertices, or vacate it when axVertexIndices is
+	 * empty. Neighbours reset to -1 and flags and cost to their defaults; its
+	 * spatial data is recomputed from the current vertices. The grid still
+	 * holds the old polygon until RefreshSpatialGrid.
+	 */
+	void ReplacePolygon(uint32_t uPoly, const Zenith_Vector<uint32_t>& axVertexIndices);
+
+	/**
+	 * Clear one neighbour link (one direction only, like SetNeighbor).
+	 */
+	void ClearNeighbor(uint32_t uPoly, uint32_t uEdge);
+
+	/**
+	 * Bring bounds and the spatial grid up to date after ReplacePolygon.
+	 * auPolygons must name every polygon replaced since the last refresh. Only
+	 * the grid cells they covered or now cover are rewritten, unless the mesh's
+	 * XZ bounds moved, which re-bins every polygon.
+	 */
+	void RefreshSpatialGrid(const Zenith_Vector<uint32_t>& auPolygons);
+
 	// ========== Queries ==========
 
 	/**
@@ -335,6 +381,28 @@ public:
 		float fProbeDistance = 0.6f,
 		float fMaxVerticalDist = 1.5f);
 
+	// ========== Change tracking ==========
+	//
+	// Derived structures (Zenith_NavMeshHierarchy) poll these to rebuild only
+	// what changed. The topology revision moves on every edit to polygons,
+	// adjacency or spatial data; the blocked revision moves each time
+	// SetPolygonBlocked actually flips a flag, and the last
+	// uBLOCKED_JOURNAL_SIZE flips are remembered.
+
+	static constexpr uint32_t uBLOCKED_JOURNAL_SIZE = 256;
+
+	uint32_t GetTopologyRevision() const { return m_uTopologyRevision; }
+	uint32_t GetBlockedRevision() const { return m_uBlockedRevision; }
+
+	/**
+	 * Append the polygons whose BLOCKED flag flipped after uRevision (oldest
+	 * first; a polygon toggled twice appears twice).
+	 * @return false when more than uBLOCKED_JOURNAL_SIZE flips have happened
+	 *         since, so the journal no longer covers them - treat every
+	 *         polygon as changed. axPolygonsOut is untouched in that case.
+	 */
+	bool GetBlockedChangesSince(uint32_t uRevision, Zenith_Vector<uint32_t>& axPolygonsOut) const;
+
 	// ========== Accessors ==========
 
 	uint32_t GetVertexCount() const { return m_axVertices.GetSize(); }
@@ -349,6 +417,41 @@ public:
 	const Zenith_Maths::Vector3& GetBoundsMin() const { return m_xBoundsMin; }
 	const Zenith_Maths::Vector3& GetBoundsMax() const { return m_xBoundsMax; }
 
+	// ========== Search layout ==========
+	//
+	// A* reads only a polygon's center, cost, flags and neighbours, so those
+	// are mirrored into one dense node per polygon with every neighbour list
+	// packed end to end. An expansion then touches one 28-byte node and a
+	// contiguous run of ints instead of a whole Zenith_NavMeshPolygon. The
+	// mirror is derived, never serialised: every mutator above keeps it in
+	// step, and BuildSpatialGrid (which ends every bake and load) rebuilds it.
+
+	struct SearchNode
+	{
+		Zenith_Maths::Vector3 m_xCenter{ 0.0f };
+		float m_fCost = 1.0f;
+		uint32_t m_uFlags = 0;
+		uint32_t m_uFirstNeighbour = 0;  // into the packed neighbour array
+		uint32_t m_uNeighbourCount = 0;
+
+		bool IsBlocked() const { return (m_uFlags & Zenith_NavMeshPolygon::FLAG_BLOCKED) != 0u; }
+	};
+
+	const SearchNode& GetSearchNode(uint32_t uPoly) const { return m_axSearchNodes.Get(uPoly); }
+
+	// Neighbour u of xNode (iZENITH_NAVMESH_NO_NEIGHBOUR on an open edge).
+	int32_t GetSearchNeighbour(const SearchNode& xNode, uint32_t u) const
+	{
+		return m_aiSearchNeighbours.Get(xNode.m_uFirstNeighbour + u);
+	}
+
+	/**
+	 * Heap bytes held by the derived query structures: the search layout, the
+	 * per-polygon bounds and the spatial grid. Counted by element, not
+	 * capacity, so the figure is reproducible; 0 for an empty mesh.
+	 */
+	uint64_t GetQueryLayoutBytes() const;
+
 #ifdef ZENITH_INPUT_SIMULATOR
 	// ========== Test instrumentation (MVP-0.4.4) ==========
 	//
@@ -465,28 +568,69 @@ private:
 	bool SampleUniformPointInPolygon(const Zenith_NavMeshPolygon& xPoly,
 		Zenith_Maths::Vector3& xOut) const;
 
+	// See "Change tracking" above. The journal is a ring indexed by revision.
+	// `mutable` for the same reason SetPolygonBlocked is const.
+	uint32_t m_uTopologyRevision = 0;
+	mutable uint32_t m_uBlockedRevision = 0;
+	mutable uint32_t m_auBlockedJournal[uBLOCKED_JOURNAL_SIZE] = {};
+
 	// Bounding box
 	Zenith_Maths::Vector3 m_xBoundsMin;
 	Zenith_Maths::Vector3 m_xBoundsMax;
 
-	// Spatial acceleration grid
-	struct GridCell
+	// Search layout (see the public section). `mutable` because
+	// SetPolygonBlocked is const and must flip the mirrored flag too.
+	mutable Zenith_Vector<SearchNode> m_axSearchNodes;
+	Zenith_Vector<int32_t> m_aiSearchNeighbours;
+
+	// Append uPoly's node and neighbours. Only valid while uPoly is the last
+	// polygon, which is what AddPolygon guarantees.
+	void AppendSearchNode(uint32_t uPoly);
+
+	// Repack the whole layout from m_axPolygons. Needed whenever a neighbour
+	// list changes length (ComputeAdjacency, StitchPortalAt).
+	void RebuildSearchLayout();
+
+	// Spatial acceleration grid, flattened: cell c owns
+	// m_auGridPolygons[m_auGridCellStart[c] .. m_auGridCellStart[c + 1]), so a
+	// query walks one contiguous run per cell. m_axPolygonBounds holds each
+	// polygon's 3D AABB as of the last BuildSpatialGrid, letting
+	// FindNearestPolygonInCell reject a polygon before the exact closest-point
+	// test.
+	struct PolygonBounds
 	{
-		Zenith_Vector<uint32_t> m_axPolygonIndices;
+		Zenith_Maths::Vector3 m_xMin;
+		Zenith_Maths::Vector3 m_xMax;
 	};
 
 	float m_fGridCellSize = 5.0f;
 	uint32_t m_uGridWidth = 0;
 	uint32_t m_uGridHeight = 0;
-	Zenith_Vector<GridCell> m_axGridCells;
+	Zenith_Vector<uint32_t> m_auGridCellStart;
+	Zenith_Vector<uint32_t> m_auGridPolygons;
+	Zenith_Vector<PolygonBounds> m_axPolygonBounds;
+
+	// RefreshSpatialGrid scratch, kept so repeated refreshes reuse capacity.
+	Zenith_Vector<uint32_t> m_auRefreshPolygons;
+	Zenith_Vector<uint8_t> m_auRefreshCells;
+	Zenith_Vector<uint32_t> m_auRefreshCellStart;
+	Zenith_Vector<uint32_t> m_auRefreshGridPolygons;
+
+	// A vacant polygon's bounds: empty, so it covers no grid cell.
+	static PolygonBounds EmptyPolygonBounds();
+	PolygonBounds ComputePolygonBounds(const Zenith_NavMeshPolygon& xPoly) const;
+
+	// Fill the grid from m_axPolygonBounds, sized to the current mesh bounds.
+	void BinPolygonsIntoGrid();
 
 	// Helper to get grid cell for a position
 	void GetGridCoords(const Zenith_Maths::Vector3& xPos, int32_t& iX, int32_t& iZ) const;
 	uint32_t GetGridCellIndex(int32_t iX, int32_t iZ) const;
+	uint32_t GetGridCellCount() const { return m_auGridCellStart.GetSize() > 0 ? m_auGridCellStart.GetSize() - 1 : 0; }
 
 	/**
 	 * Search a single grid cell for the nearest polygon to a point
-	 * @param uCellIndex Index into m_axGridCells
+	 * @param uCellIndex Grid cell index (GetGridCellIndex)
 	 * @param xPoint Query point
 	 * @param fMinDistSq In/out: current minimum distance squared
 	 * @param uPolyOut In/out: current nearest polygon index
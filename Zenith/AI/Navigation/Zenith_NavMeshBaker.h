@@ -18,7 +18,9 @@ class Zenith_NavMesh;
 // component and no generator run.
 //
 // Stateless statics; no cache, no globals. The pipeline is
-//   generate (Zenith_NavMeshGenerator::GenerateFromGeometry)
+//   generate (Zenith_NavMeshGenerator::GenerateFromGeometry; with
+//             xConfig.m_bBakeInTiles the level is cut into tiles baked
+//             concurrently on the task system, same bytes for any core count)
 //     -> serialize (Zenith_NavMesh::WriteToDataStream)
 //     -> write     (Zenith_DataStream::WriteToFile)
 //     -> READ BACK and memcmp
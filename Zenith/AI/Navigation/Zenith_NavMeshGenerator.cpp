@@ -1,5 +1,6 @@
 #include "Zenith.h"
 #include "AI/Navigation/Zenith_NavMeshGenerator.h"
+#include "AI/Zenith_AIWorldHooks.h"
 #include "Profiling/Zenith_Profiling.h"
 #include <algorithm>
 #include <queue>
@@ -20,6 +21,11 @@ Zenith_NavMesh* Zenith_NavMeshGenerator::GenerateFromGeometry(
 	// scopes below let WriteTextReport pinpoint which Recast-style phase
 	// dominates the total (collect / voxelize / filter / regions / contours
 	// / polygon mesh / final navmesh assembly).
+	if (xConfig.m_bBakeInTiles)
+	{
+		return GenerateTiledFromGeometry(axVertices, axIndices, xConfig);
+	}
+
 	Zenith_Profiling::ScopeZone xGenerateScope(ZENITH_PROFILE_ZONE("AI NavMesh Generate"));
 
 	if (axVertices.GetSize() == 0 || axIndices.GetSize() < 3)
@@ -114,6 +120,51 @@ Zenith_NavMesh* Zenith_NavMeshGenerator::GenerateFromGeometry(
 	return pxNavMesh;
 }
 
+Zenith_NavMesh* Zenith_NavMeshGenerator::GenerateTiledFromGeometry(
+	const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+	const Zenith_Vector<uint32_t>& axIndices,
+	const NavMeshGenerationConfig& xConfig)
+{
+	Zenith_Profiling::ScopeZone xGenerateScope(ZENITH_PROFILE_ZONE("AI NavMesh Generate Tiled"));
+
+	if (axVertices.GetSize() == 0 || axIndices.GetSize() < 3)
+	{
+		Zenith_Log(LOG_CATEGORY_AI, "No geometry to generate NavMesh from");
+		return nullptr;
+	}
+
+	const Zenith_NavMeshTileLayout xLayout = ComputeTileLayout(axVertices, xConfig);
+	Zenith_Vector<uint32_t> auTiles;
+	auTiles.Reserve(xLayout.GetTileCount());
+	for (uint32_t uTile = 0; uTile < xLayout.GetTileCount(); ++uTile)
+	{
+		auTiles.PushBack(uTile);
+	}
+
+	Zenith_Vector<Zenith_Vector<uint32_t>> axTileTriangles;
+	{
+		Zenith_Profiling::ScopeZone xScope(ZENITH_PROFILE_ZONE("AI NavMesh Generate / Bin Triangles"));
+		BinTrianglesToTiles(axVertices, axIndices, xLayout, 0, 0, xLayout.m_uTilesX - 1, xLayout.m_uTilesZ - 1, axTileTriangles);
+	}
+
+	Zenith_Vector<Zenith_NavMeshTile> axTiles;
+	GenerateTiles(axVertices, axIndices, xConfig, xLayout, auTiles, axTileTriangles, axTiles);
+
+	Zenith_NavMesh* pxNavMesh = new Zenith_NavMesh();
+	Zenith_Vector<uint32_t> auTileFirstPolygon;
+	AssembleTiles(axTiles, xLayout, xConfig, *pxNavMesh, auTileFirstPolygon);
+	if (pxNavMesh->GetPolygonCount() == 0)
+	{
+		Zenith_Log(LOG_CATEGORY_AI, "No walkable spans found");
+		delete pxNavMesh;
+		return nullptr;
+	}
+
+	Zenith_Log(LOG_CATEGORY_AI, "NavMesh generation complete: %u x %u tiles, %u vertices, %u polygons",
+		xLayout.m_uTilesX, xLayout.m_uTilesZ, pxNavMesh->GetVertexCount(), pxNavMesh->GetPolygonCount());
+	return pxNavMesh;
+}
+
 bool Zenith_NavMeshGenerator::ComputeBounds(
 	const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
 	GenerationContext& xContext)
@@ -152,6 +203,10 @@ bool Zenith_NavMeshGenerator::ComputeBounds(
 	xContext.m_iHeight = std::min(xContext.m_iHeight, iMaxDim);
 	xContext.m_iDepth = std::min(xContext.m_iDepth, iMaxDim);
 
+	// The whole grid is core: every walkable cell emits a polygon.
+	xContext.m_iCoreMaxX = xContext.m_iWidth;
+	xContext.m_iCoreMaxZ = xContext.m_iHeight;
+
 	// Allocate heightfield columns
 	uint32_t uColumnCount = static_cast<uint32_t>(xContext.m_iWidth * xContext.m_iHeight);
 	xContext.m_axColumns.Clear();
@@ -230,10 +285,13 @@ void Zenith_NavMeshGenerator::RasterizeTriangle(
 	float fMinY = std::min({xV0.y, xV1.y, xV2.y});
 	float fMaxY = std::max({xV0.y, xV1.y, xV2.y});
 
-	int32_t iMinX = static_cast<int32_t>((fMinX - xContext.m_xBoundsMin.x) * fInvCellSize);
-	int32_t iMaxX = static_cast<int32_t>((fMaxX - xContext.m_xBoundsMin.x) * fInvCellSize);
-	int32_t iMinZ = static_cast<int32_t>((fMinZ - xContext.m_xBoundsMin.z) * fInvCellSize);
-	int32_t iMaxZ = static_cast<int32_t>((fMaxZ - xContext.m_xBoundsMin.z) * fInvCellSize);
+	// World cell indices, shifted into this context's window (a no-op for the
+	// single-grid bake). Floor, not truncation, so cells left of the origin
+	// stay distinct once a tile window starts there.
+	int32_t iMinX = static_cast<int32_t>(std::floor((fMinX - xContext.m_xBoundsMin.x) * fInvCellSize)) - xContext.m_iCellOffsetX;
+	int32_t iMaxX = static_cast<int32_t>(std::floor((fMaxX - xContext.m_xBoundsMin.x) * fInvCellSize)) - xContext.m_iCellOffsetX;
+	int32_t iMinZ = static_cast<int32_t>(std::floor((fMinZ - xContext.m_xBoundsMin.z) * fInvCellSize)) - xContext.m_iCellOffsetZ;
+	int32_t iMaxZ = static_cast<int32_t>(std::floor((fMaxZ - xContext.m_xBoundsMin.z) * fInvCellSize)) - xContext.m_iCellOffsetZ;
 
 	// Clamp to grid bounds
 	iMinX = std::max(0, std::min(iMinX, xContext.m_iWidth - 1));
@@ -241,9 +299,10 @@ void Zenith_NavMeshGenerator::RasterizeTriangle(
 	iMinZ = std::max(0, std::min(iMinZ, xContext.m_iHeight - 1));
 	iMaxZ = std::max(0, std::min(iMaxZ, xContext.m_iHeight - 1));
 
-	// Rasterize spans
-	uint16_t uMinY = static_cast<uint16_t>((fMinY - xContext.m_xBoundsMin.y) * fInvCellHeight);
-	uint16_t uMaxY = static_cast<uint16_t>((fMaxY - xContext.m_xBoundsMin.y) * fInvCellHeight);
+	// Rasterize spans. A tiled rebuild may see geometry below the Y origin it
+	// was first baked with; clamp rather than wrap.
+	uint16_t uMinY = static_cast<uint16_t>(std::max(0.0f, (fMinY - xContext.m_xBoundsMin.y) * fInvCellHeight));
+	uint16_t uMaxY = static_cast<uint16_t>(std::max(0.0f, (fMaxY - xContext.m_xBoundsMin.y) * fInvCellHeight));
 
 	for (int32_t iZ = iMinZ; iZ <= iMaxZ; ++iZ)
 	{
@@ -317,9 +376,12 @@ bool Zenith_NavMeshGenerator::FilterWalkableSpans(GenerationContext& xContext)
 	const int32_t iAgentHeightCells = static_cast<int32_t>(
 		xContext.m_xConfig.m_fAgentHeight / xContext.m_xConfig.m_fCellHeight) + 1;
 
-	const WalkableSpanStats xBefore = GatherWalkableSpanStats(xContext);
-	Zenith_Log(LOG_CATEGORY_AI, "FilterWalkableSpans: %u walkable spans before filtering, Y range [%.2f, %.2f]",
-		xBefore.m_uCount, xBefore.m_fMinY, xBefore.m_fMaxY);
+	if (xContext.m_bLogStages)
+	{
+		const WalkableSpanStats xBefore = GatherWalkableSpanStats(xContext);
+		Zenith_Log(LOG_CATEGORY_AI, "FilterWalkableSpans: %u walkable spans before filtering, Y range [%.2f, %.2f]",
+			xBefore.m_uCount, xBefore.m_fMinY, xBefore.m_fMaxY);
+	}
 
 	uint32_t uFilteredCount = 0;
 	for (uint32_t u = 0; u < xContext.m_axColumns.GetSize(); ++u)
@@ -336,9 +398,12 @@ bool Zenith_NavMeshGenerator::FilterWalkableSpans(GenerationContext& xContext)
 		}
 	}
 
-	const WalkableSpanStats xAfter = GatherWalkableSpanStats(xContext);
-	Zenith_Log(LOG_CATEGORY_AI, "FilterWalkableSpans: Filtered %u spans, %u remaining, Y range [%.2f, %.2f]",
-		uFilteredCount, xAfter.m_uCount, xAfter.m_fMinY, xAfter.m_fMaxY);
+	if (xContext.m_bLogStages)
+	{
+		const WalkableSpanStats xAfter = GatherWalkableSpanStats(xContext);
+		Zenith_Log(LOG_CATEGORY_AI, "FilterWalkableSpans: Filtered %u spans, %u remaining, Y range [%.2f, %.2f]",
+			uFilteredCount, xAfter.m_uCount, xAfter.m_fMinY, xAfter.m_fMaxY);
+	}
 	return true;
 }
 
@@ -367,7 +432,10 @@ bool Zenith_NavMeshGenerator::BuildCompactHeightfield(GenerationContext& xContex
 
 	if (uTotalSpans == 0)
 	{
-		Zenith_Log(LOG_CATEGORY_AI, "No walkable spans found");
+		if (xContext.m_bLogStages)
+		{
+			Zenith_Log(LOG_CATEGORY_AI, "No walkable spans found");
+		}
 		return false;
 	}
 
@@ -413,7 +481,10 @@ bool Zenith_NavMeshGenerator::BuildCompactHeightfield(GenerationContext& xContex
 		xContext.m_axColumnSpanCounts.Get(u) = uColumnSpanCount;
 	}
 
-	Zenith_Log(LOG_CATEGORY_AI, "Built compact heightfield: %u spans", uTotalSpans);
+	if (xContext.m_bLogStages)
+	{
+		Zenith_Log(LOG_CATEGORY_AI, "Built compact heightfield: %u spans", uTotalSpans);
+	}
 	return true;
 }
 
@@ -468,7 +539,10 @@ bool Zenith_NavMeshGenerator::BuildRegions(GenerationContext& xContext)
 		++uNextRegion;
 	}
 
-	Zenith_Log(LOG_CATEGORY_AI, "Built %u regions", uNextRegion - 1);
+	if (xContext.m_bLogStages)
+	{
+		Zenith_Log(LOG_CATEGORY_AI, "Built %u regions", uNextRegion - 1);
+	}
 	return uNextRegion > 1;
 }
 
@@ -603,11 +677,13 @@ uint32_t Zenith_NavMeshGenerator::GetOrCreateVertex(GenerationContext& xContext,
 		return *puExisting;
 	}
 
+	// Positions come from world cell indices, so two tiles meeting at a seam
+	// produce bit-identical corners there.
 	const float fCellSize = xContext.m_xConfig.m_fCellSize;
 	Zenith_Maths::Vector3 xWorldPos;
-	xWorldPos.x = xContext.m_xBoundsMin.x + iX * fCellSize;
+	xWorldPos.x = xContext.m_xBoundsMin.x + (iX + xContext.m_iCellOffsetX) * fCellSize;
 	xWorldPos.y = fY;
-	xWorldPos.z = xContext.m_xBoundsMin.z + iZ * fCellSize;
+	xWorldPos.z = xContext.m_xBoundsMin.z + (iZ + xContext.m_iCellOffsetZ) * fCellSize;
 
 	uint32_t uIndex = xContext.m_axOutputVertices.GetSize();
 	xContext.m_axOutputVertices.PushBack(xWorldPos);
@@ -621,9 +697,9 @@ Zenith_NavMeshGenerator::HeightCategoryCounts Zenith_NavMeshGenerator::EmitQuads
 	const float fCellHeight = xContext.m_xConfig.m_fCellHeight;
 	HeightCategoryCounts xCounts;
 
-	for (int32_t iZ = 0; iZ < xContext.m_iHeight; ++iZ)
+	for (int32_t iZ = xContext.m_iCoreMinZ; iZ < xContext.m_iCoreMaxZ; ++iZ)
 	{
-		for (int32_t iX = 0; iX < xContext.m_iWidth; ++iX)
+		for (int32_t iX = xContext.m_iCoreMinX; iX < xContext.m_iCoreMaxX; ++iX)
 		{
 			uint32_t uCol = GetColumnIndex(iX, iZ, xContext.m_iWidth);
 			if (uCol >= xContext.m_axColumnSpanCounts.GetSize())
@@ -671,6 +747,8 @@ Zenith_NavMeshGenerator::HeightCategoryCounts Zenith_NavMeshGenerator::EmitQuads
 				axQuadIndices.PushBack(uV1);
 
 				xContext.m_axOutputPolygons.PushBack(std::move(axQuadIndices));
+				xContext.m_auOutputPolygonCells.PushBack(uCol);
+				xContext.m_auOutputPolygonHeights.PushBack(xSpan.m_uY);
 			}
 		}
 	}
@@ -689,6 +767,8 @@ bool Zenith_NavMeshGenerator::BuildPolygonMesh(GenerationContext& xContext)
 {
 	xContext.m_axOutputVertices.Clear();
 	xContext.m_axOutputPolygons.Clear();
+	xContext.m_auOutputPolygonCells.Clear();
+	xContext.m_auOutputPolygonHeights.Clear();
 
 	Zenith_HashMap<uint64_t, uint32_t> xVertexMap;
 	const HeightCategoryCounts xCounts = EmitQuadsFromSpans(xContext, xVertexMap);
@@ -724,7 +804,25 @@ Zenith_NavMesh* Zenith_NavMeshGenerator::BuildNavMesh(GenerationContext& xContex
 	pxNavMesh->ComputeSpatialData();
 
 	// Build adjacency by finding shared edges.
-	//
+	Zenith_Vector<int32_t> aiNeighbours;
+	LinkQuadEdges(xContext.m_axOutputPolygons, aiNeighbours);
+	for (uint32_t u = 0; u < aiNeighbours.GetSize(); ++u)
+	{
+		if (aiNeighbours.Get(u) >= 0)
+		{
+			pxNavMesh->SetNeighbor(u / 4, u % 4, static_cast<uint32_t>(aiNeighbours.Get(u)));
+		}
+	}
+
+	// Build spatial grid for queries
+	pxNavMesh->BuildSpatialGrid();
+
+	return pxNavMesh;
+}
+
+void Zenith_NavMeshGenerator::LinkQuadEdges(const Zenith_Vector<Zenith_Vector<uint32_t>>& axQuads,
+	Zenith_Vector<int32_t>& aiNeighboursOut)
+{
 	// Previously this was an O(N^2 * E^2) double loop -- for a navmesh with
 	// 131,983 polygons (DP GameLevel scale) that's ~1.4e11 operations and
 	// the generator took >5 minutes on a single scene load. Replaced with an
@@ -737,58 +835,500 @@ Zenith_NavMesh* Zenith_NavMeshGenerator::BuildNavMesh(GenerationContext& xContex
 	//
 	// Verified DP GameLevel: 131,983 polygons, adjacency went from
 	// > 5 minutes (timeout) to milliseconds.
+	struct EdgeOwner
+	{
+		uint32_t m_uPoly = UINT32_MAX;
+		uint32_t m_uEdge = UINT32_MAX;
+	};
+	const auto MakeKey = [](uint32_t uA, uint32_t uB) -> uint64_t
+	{
+		const uint32_t uLo = uA < uB ? uA : uB;
+		const uint32_t uHi = uA < uB ? uB : uA;
+		return (static_cast<uint64_t>(uHi) << 32) | static_cast<uint64_t>(uLo);
+	};
+
+	aiNeighboursOut.Clear();
+	aiNeighboursOut.Resize(axQuads.GetSize() * 4, -1);
+
+	Zenith_HashMap<uint64_t, EdgeOwner> xEdgeOwners;
+	for (uint32_t uPoly = 0; uPoly < axQuads.GetSize(); ++uPoly)
 	{
-		struct EdgeOwner
+		const Zenith_Vector<uint32_t>& axQuad = axQuads.Get(uPoly);
+		Zenith_Assert(axQuad.GetSize() == 4, "LinkQuadEdges: polygon %u has %u vertices", uPoly, axQuad.GetSize());
+		for (uint32_t uEdge = 0; uEdge < 4; ++uEdge)
 		{
-			uint32_t m_uPoly = UINT32_MAX;
-			uint32_t m_uEdge = UINT32_MAX;
-		};
-		const auto MakeKey = [](uint32_t uA, uint32_t uB) -> uint64_t
+			const uint64_t uKey = MakeKey(axQuad.Get(uEdge), axQuad.Get((uEdge + 1) % 4));
+
+			if (EdgeOwner* pxExisting = xEdgeOwners.TryGet(uKey))
+			{
+				// Found a polygon that already owns this edge -- stitch
+				// both directions. A truly degenerate mesh could in
+				// principle map three polygons to the same edge; we'd
+				// only stitch the first two found here. That's
+				// acceptable: production-mesh generation produces
+				// manifold geometry, and stitching extras would require
+				// edge->multi-polygon storage.
+				aiNeighboursOut.Get(uPoly * 4 + uEdge) = static_cast<int32_t>(pxExisting->m_uPoly);
+				aiNeighboursOut.Get(pxExisting->m_uPoly * 4 + pxExisting->m_uEdge) = static_cast<int32_t>(uPoly);
+			}
+			else
+			{
+				EdgeOwner xOwner;
+				xOwner.m_uPoly = uPoly;
+				xOwner.m_uEdge = uEdge;
+				xEdgeOwners.Insert(uKey, xOwner);
+			}
+		}
+	}
+}
+
+// TILED GENERATION
+// The world grid is cut into fixed T x T cell tiles. Each tile runs the same
+// voxelize / filter / regions / emit pipeline over its core plus a border of
+// m_uBorderCells on every side, but emits polygons for core cells only, so
+// tiles never overlap. The border lets flood fill see past the seam; spans
+// themselves depend only on the triangles over each column, so a core cell
+// comes out exactly as the single-grid bake would make it.
+namespace
+{
+	int32_t FloorDiv(int32_t iValue, int32_t iDivisor)
+	{
+		return iValue >= 0 ? iValue / iDivisor : -((-iValue + iDivisor - 1) / iDivisor);
+	}
+
+	// Same expression RasterizeTriangle uses, so binning and rasterization
+	// agree on which cell a coordinate falls in.
+	int32_t WorldToCell(float fValue, float fOrigin, float fInvCellSize)
+	{
+		return static_cast<int32_t>(std::floor((fValue - fOrigin) * fInvCellSize));
+	}
+
+	// Everything one GenerateTiles invocation reads. Invocation u writes only
+	// m_paxTilesOut[u], so the tiles need no locking and the result does not
+	// depend on which worker ran which tile.
+	struct TileGenerationJob
+	{
+		const Zenith_Vector<Zenith_Maths::Vector3>* m_paxVertices = nullptr;
+		const Zenith_Vector<uint32_t>* m_pauIndices = nullptr;
+		const NavMeshGenerationConfig* m_pxConfig = nullptr;
+		const Zenith_NavMeshTileLayout* m_pxLayout = nullptr;
+		const Zenith_Vector<uint32_t>* m_pauTiles = nullptr;
+		const Zenith_Vector<Zenith_Vector<uint32_t>>* m_paxTileTriangles = nullptr;
+		Zenith_Vector<Zenith_NavMeshTile>* m_paxTilesOut = nullptr;
+	};
+}
+
+void Zenith_NavMeshGenerator::GenerateTileTaskFunc(void* pData, u_int uInvocationIndex, u_int)
+{
+	const TileGenerationJob& xJob = *static_cast<const TileGenerationJob*>(pData);
+	const uint32_t uTile = xJob.m_pauTiles->Get(uInvocationIndex);
+	const uint32_t uTilesX = xJob.m_pxLayout->m_uTilesX;
+	GenerateTile(*xJob.m_paxVertices, *xJob.m_pauIndices, xJob.m_paxTileTriangles->Get(uTile),
+		*xJob.m_pxConfig, *xJob.m_pxLayout, uTile % uTilesX, uTile / uTilesX,
+		xJob.m_paxTilesOut->Get(uInvocationIndex));
+}
+
+bool Zenith_NavMeshTileLayout::GetTilesOverlapping(const Zenith_Maths::Vector3& xMin, const Zenith_Maths::Vector3& xMax,
+	uint32_t& uMinXOut, uint32_t& uMinZOut, uint32_t& uMaxXOut, uint32_t& uMaxZOut) const
+{
+	if (GetTileCount() == 0)
+	{
+		return false;
+	}
+
+	// Padded tile t covers cells [t * T - B, (t + 1) * T + B).
+	const float fInvCellSize = 1.0f / m_fCellSize;
+	const int32_t iT = static_cast<int32_t>(m_uTileCells);
+	const int32_t iB = static_cast<int32_t>(m_uBorderCells);
+	const int32_t iMinX = FloorDiv(WorldToCell(xMin.x, m_xOrigin.x, fInvCellSize) - iB, iT);
+	const int32_t iMinZ = FloorDiv(WorldToCell(xMin.z, m_xOrigin.z, fInvCellSize) - iB, iT);
+	const int32_t iMaxX = FloorDiv(WorldToCell(xMax.x, m_xOrigin.x, fInvCellSize) + iB, iT);
+	const int32_t iMaxZ = FloorDiv(WorldToCell(xMax.z, m_xOrigin.z, fInvCellSize) + iB, iT);
+
+	if (iMaxX < 0 || iMaxZ < 0 || iMinX >= static_cast<int32_t>(m_uTilesX) || iMinZ >= static_cast<int32_t>(m_uTilesZ))
+	{
+		return false;
+	}
+
+	uMinXOut = static_cast<uint32_t>(std::max(iMinX, 0));
+	uMinZOut = static_cast<uint32_t>(std::max(iMinZ, 0));
+	uMaxXOut = static_cast<uint32_t>(std::min(iMaxX, static_cast<int32_t>(m_uTilesX) - 1));
+	uMaxZOut = static_cast<uint32_t>(std::min(iMaxZ, static_cast<int32_t>(m_uTilesZ) - 1));
+	return true;
+}
+
+Zenith_NavMeshTileLayout Zenith_NavMeshGenerator::ComputeTileLayout(
+	const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+	const NavMeshGenerationConfig& xConfig)
+{
+	Zenith_Assert(xConfig.m_uTileSizeCells > 0, "ComputeTileLayout: tile size must be at least one cell");
+
+	Zenith_NavMeshTileLayout xLayout;
+	if (axVertices.GetSize() == 0)
+	{
+		return xLayout;
+	}
+
+	// Same padded bounds as ComputeBounds, so a tiled bake and a single-grid
+	// bake of one scene share their cell lattice. No 1024-cell clamp: each
+	// tile's grid is bounded by the tile size instead.
+	Zenith_Maths::Vector3 xMin = axVertices.Get(0);
+	Zenith_Maths::Vector3 xMax = axVertices.Get(0);
+	for (uint32_t u = 1; u < axVertices.GetSize(); ++u)
+	{
+		ExpandBoundsToInclude(xMin, xMax, axVertices.Get(u));
+	}
+	xMin -= Zenith_Maths::Vector3(xConfig.m_fAgentRadius);
+	xMax += Zenith_Maths::Vector3(xConfig.m_fAgentRadius);
+
+	const Zenith_Maths::Vector3 xSize = xMax - xMin;
+	const uint32_t uCellsX = std::max(1u, static_cast<uint32_t>(std::ceil(xSize.x / xConfig.m_fCellSize)));
+	const uint32_t uCellsZ = std::max(1u, static_cast<uint32_t>(std::ceil(xSize.z / xConfig.m_fCellSize)));
+
+	xLayout.m_xOrigin = xMin;
+	xLayout.m_fCellSize = xConfig.m_fCellSize;
+	xLayout.m_uTileCells = xConfig.m_uTileSizeCells;
+	xLayout.m_uBorderCells = xConfig.m_uTileBorderCells;
+	xLayout.m_uTilesX = (uCellsX + xLayout.m_uTileCells - 1) / xLayout.m_uTileCells;
+	xLayout.m_uTilesZ = (uCellsZ + xLayout.m_uTileCells - 1) / xLayout.m_uTileCells;
+	return xLayout;
+}
+
+void Zenith_NavMeshGenerator::BinTrianglesToTiles(
+	const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+	const Zenith_Vector<uint32_t>& axIndices,
+	const Zenith_NavMeshTileLayout& xLayout,
+	uint32_t uMinX, uint32_t uMinZ, uint32_t uMaxX, uint32_t uMaxZ,
+	Zenith_Vector<Zenith_Vector<uint32_t>>& axTileTrianglesOut)
+{
+	axTileTrianglesOut.Clear();
+	axTileTrianglesOut.Resize(xLayout.GetTileCount());
+
+	const uint32_t uTriCount = axIndices.GetSize() / 3;
+	for (uint32_t uTri = 0; uTri < uTriCount; ++uTri)
+	{
+		const Zenith_Maths::Vector3& xV0 = axVertices.Get(axIndices.Get(uTri * 3 + 0));
+		const Zenith_Maths::Vector3& xV1 = axVertices.Get(axIndices.Get(uTri * 3 + 1));
+		const Zenith_Maths::Vector3& xV2 = axVertices.Get(axIndices.Get(uTri * 3 + 2));
+		const Zenith_Maths::Vector3 xTriMin(std::min({xV0.x, xV1.x, xV2.x}), 0.0f, std::min({xV0.z, xV1.z, xV2.z}));
+		const Zenith_Maths::Vector3 xTriMax(std::max({xV0.x, xV1.x, xV2.x}), 0.0f, std::max({xV0.z, xV1.z, xV2.z}));
+
+		uint32_t uTileMinX, uTileMinZ, uTileMaxX, uTileMaxZ;
+		if (!xLayout.GetTilesOverlapping(xTriMin, xTriMax, uTileMinX, uTileMinZ, uTileMaxX, uTileMaxZ))
 		{
-			const uint32_t uLo = uA < uB ? uA : uB;
-			const uint32_t uHi = uA < uB ? uB : uA;
-			return (static_cast<uint64_t>(uHi) << 32) | static_cast<uint64_t>(uLo);
-		};
+			continue;
+		}
 
-		Zenith_HashMap<uint64_t, EdgeOwner> xEdgeOwners;
-		const uint32_t uPolyCount = pxNavMesh->GetPolygonCount();
-		for (uint32_t uPoly = 0; uPoly < uPolyCount; ++uPoly)
+		for (uint32_t uZ = std::max(uTileMinZ, uMinZ); uZ <= std::min(uTileMaxZ, uMaxZ); ++uZ)
 		{
-			const Zenith_NavMeshPolygon& xPoly = pxNavMesh->GetPolygon(uPoly);
-			const uint32_t uEdgeCount = xPoly.m_axVertexIndices.GetSize();
-			for (uint32_t uEdge = 0; uEdge < uEdgeCount; ++uEdge)
+			for (uint32_t uX = std::max(uTileMinX, uMinX); uX <= std::min(uTileMaxX, uMaxX); ++uX)
 			{
-				const uint32_t uVa = xPoly.m_axVertexIndices.Get(uEdge);
-				const uint32_t uVb = xPoly.m_axVertexIndices.Get((uEdge + 1) % uEdgeCount);
-				const uint64_t uKey = MakeKey(uVa, uVb);
+				axTileTrianglesOut.Get(uZ * xLayout.m_uTilesX + uX).PushBack(uTri);
+			}
+		}
+	}
+}
 
-				if (EdgeOwner* pxExisting = xEdgeOwners.TryGet(uKey))
-				{
-					// Found a polygon that already owns this edge -- stitch
-					// both directions. A truly degenerate mesh could in
-					// principle map three polygons to the same edge; we'd
-					// only stitch the first two found here. That's
-					// acceptable: production-mesh generation produces
-					// manifold geometry, and stitching extras would require
-					// edge->multi-polygon storage.
-					pxNavMesh->SetNeighbor(uPoly, uEdge, pxExisting->m_uPoly);
-					pxNavMesh->SetNeighbor(pxExisting->m_uPoly, pxExisting->m_uEdge, uPoly);
-				}
-				else
-				{
-					EdgeOwner xOwner;
-					xOwner.m_uPoly = uPoly;
-					xOwner.m_uEdge = uEdge;
-					xEdgeOwners.Insert(uKey, xOwner);
-				}
+void Zenith_NavMeshGenerator::GenerateTiles(
+	const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+	const Zenith_Vector<uint32_t>& axIndices,
+	const NavMeshGenerationConfig& xConfig,
+	const Zenith_NavMeshTileLayout& xLayout,
+	const Zenith_Vector<uint32_t>& auTiles,
+	const Zenith_Vector<Zenith_Vector<uint32_t>>& axTileTriangles,
+	Zenith_Vector<Zenith_NavMeshTile>& axTilesOut)
+{
+	Zenith_Profiling::ScopeZone xScope(ZENITH_PROFILE_ZONE("AI NavMesh Generate / Tiles"));
+
+	axTilesOut.Clear();
+	axTilesOut.Resize(auTiles.GetSize());
+	if (auTiles.GetSize() == 0)
+	{
+		return;
+	}
+
+	// One invocation per tile on the engine task system (synchronously when no
+	// task system is wired -- Zenith_AI_RunDataParallel). Tiles share nothing
+	// mutable, and AssembleTiles merges them in lattice order, so the mesh is
+	// identical for any worker count.
+	TileGenerationJob xJob;
+	xJob.m_paxVertices = &axVertices;
+	xJob.m_pauIndices = &axIndices;
+	xJob.m_pxConfig = &xConfig;
+	xJob.m_pxLayout = &xLayout;
+	xJob.m_pauTiles = &auTiles;
+	xJob.m_paxTileTriangles = &axTileTriangles;
+	xJob.m_paxTilesOut = &axTilesOut;
+	Zenith_AI_RunDataParallel(&GenerateTileTaskFunc, &xJob, auTiles.GetSize());
+}
+
+void Zenith_NavMeshGenerator::GenerateTile(
+	const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+	const Zenith_Vector<uint32_t>& axIndices,
+	const Zenith_Vector<uint32_t>& auTriangles,
+	const NavMeshGenerationConfig& xConfig,
+	const Zenith_NavMeshTileLayout& xLayout,
+	uint32_t uTileX, uint32_t uTileZ,
+	Zenith_NavMeshTile& xTileOut)
+{
+	Zenith_Profiling::ScopeZone xScope(ZENITH_PROFILE_ZONE("AI NavMesh Generate / Tile"));
+
+	const int32_t iT = static_cast<int32_t>(xLayout.m_uTileCells);
+	const int32_t iB = static_cast<int32_t>(xLayout.m_uBorderCells);
+
+	xTileOut.m_axVertices.Clear();
+	xTileOut.m_auQuadVertices.Clear();
+	xTileOut.m_aiQuadNeighbours.Clear();
+	xTileOut.m_auQuadHeights.Clear();
+	xTileOut.m_auCellQuadStart.Clear();
+	xTileOut.m_auCellQuadStart.Resize(xLayout.m_uTileCells * xLayout.m_uTileCells + 1, 0u);
+
+	GenerationContext xContext;
+	xContext.m_xConfig = xConfig;
+	xContext.m_xBoundsMin = xLayout.m_xOrigin;
+	xContext.m_iWidth = iT + 2 * iB;
+	xContext.m_iHeight = iT + 2 * iB;
+	xContext.m_iCellOffsetX = static_cast<int32_t>(uTileX) * iT - iB;
+	xContext.m_iCellOffsetZ = static_cast<int32_t>(uTileZ) * iT - iB;
+	xContext.m_iCoreMinX = iB;
+	xContext.m_iCoreMinZ = iB;
+	xContext.m_iCoreMaxX = iB + iT;
+	xContext.m_iCoreMaxZ = iB + iT;
+	xContext.m_bLogStages = false;
+	xContext.m_axColumns.Resize(static_cast<uint32_t>(xContext.m_iWidth * xContext.m_iHeight), HeightfieldColumn());
+
+	for (uint32_t u = 0; u < auTriangles.GetSize(); ++u)
+	{
+		const uint32_t uTri = auTriangles.Get(u);
+		RasterizeTriangle(
+			axVertices.Get(axIndices.Get(uTri * 3 + 0)),
+			axVertices.Get(axIndices.Get(uTri * 3 + 1)),
+			axVertices.Get(axIndices.Get(uTri * 3 + 2)),
+			xContext);
+	}
+
+	// Contours are skipped: polygon emission never reads them.
+	FilterWalkableSpans(xContext);
+	if (!BuildCompactHeightfield(xContext) || !BuildRegions(xContext))
+	{
+		return;  // Nothing walkable in this tile
+	}
+
+	Zenith_HashMap<uint64_t, uint32_t> xVertexMap;
+	EmitQuadsFromSpans(xContext, xVertexMap);
+
+	xTileOut.m_axVertices = std::move(xContext.m_axOutputVertices);
+	LinkQuadEdges(xContext.m_axOutputPolygons, xTileOut.m_aiQuadNeighbours);
+	const uint32_t uQuadCount = xContext.m_axOutputPolygons.GetSize();
+	for (uint32_t uQuad = 0; uQuad < uQuadCount; ++uQuad)
+	{
+		const Zenith_Vector<uint32_t>& axQuad = xContext.m_axOutputPolygons.Get(uQuad);
+		for (uint32_t u = 0; u < 4; ++u)
+		{
+			xTileOut.m_auQuadVertices.PushBack(axQuad.Get(u));
+		}
+		xTileOut.m_auQuadHeights.PushBack(xContext.m_auOutputPolygonHeights.Get(uQuad));
+
+		// Quads come out in row-major core order, so counting per cell and
+		// prefix-summing yields contiguous per-cell ranges.
+		const int32_t iColumn = static_cast<int32_t>(xContext.m_auOutputPolygonCells.Get(uQuad));
+		const int32_t iCoreX = iColumn % xContext.m_iWidth - iB;
+		const int32_t iCoreZ = iColumn / xContext.m_iWidth - iB;
+		xTileOut.m_auCellQuadStart.Get(static_cast<uint32_t>(iCoreZ * iT + iCoreX) + 1)++;
+	}
+	for (uint32_t u = 1; u < xTileOut.m_auCellQuadStart.GetSize(); ++u)
+	{
+		xTileOut.m_auCellQuadStart.Get(u) += xTileOut.m_auCellQuadStart.Get(u - 1);
+	}
+}
+
+void Zenith_NavMeshGenerator::StitchTileSeam(Zenith_NavMesh& xNavMesh,
+	const Zenith_NavMeshTile& xTileA, uint32_t uFirstA, uint32_t uCellA, uint32_t uEdgeA,
+	const Zenith_NavMeshTile& xTileB, uint32_t uFirstB, uint32_t uCellB, uint32_t uEdgeB,
+	int32_t iMaxStepCells)
+{
+	// Each quad on A's side takes the closest-in-height free quad on B's side
+	// within one step: the rule flood fill uses to join cells into a region.
+	const uint32_t uEndA = xTileA.m_auCellQuadStart.Get(uCellA + 1);
+	const uint32_t uEndB = xTileB.m_auCellQuadStart.Get(uCellB + 1);
+	for (uint32_t uQuadA = xTileA.m_auCellQuadStart.Get(uCellA); uQuadA < uEndA; ++uQuadA)
+	{
+		const int32_t iHeightA = static_cast<int32_t>(xTileA.m_auQuadHeights.Get(uQuadA));
+		uint32_t uBest = UINT32_MAX;
+		int32_t iBestDiff = iMaxStepCells + 1;
+		for (uint32_t uQuadB = xTileB.m_auCellQuadStart.Get(uCellB); uQuadB < uEndB; ++uQuadB)
+		{
+			if (xNavMesh.GetPolygon(uFirstB + uQuadB).m_axNeighborIndices.Get(uEdgeB) >= 0)
+			{
+				continue;  // Already paired with a lower quad of A
+			}
+			const int32_t iDiff = std::abs(static_cast<int32_t>(xTileB.m_auQuadHeights.Get(uQuadB)) - iHeightA);
+			if (iDiff < iBestDiff)
+			{
+				iBestDiff = iDiff;
+				uBest = uQuadB;
 			}
 		}
+
+		if (uBest != UINT32_MAX)
+		{
+			xNavMesh.SetNeighbor(uFirstA + uQuadA, uEdgeA, uFirstB + uBest);
+			xNavMesh.SetNeighbor(uFirstB + uBest, uEdgeB, uFirstA + uQuadA);
+		}
 	}
+}
 
-	// Build spatial grid for queries
-	pxNavMesh->BuildSpatialGrid();
+void Zenith_NavMeshGenerator::AssembleTiles(
+	const Zenith_Vector<Zenith_NavMeshTile>& axTiles,
+	const Zenith_NavMeshTileLayout& xLayout,
+	const NavMeshGenerationConfig& xConfig,
+	Zenith_NavMesh& xNavMeshOut,
+	Zenith_Vector<uint32_t>& auTileFirstPolygonOut)
+{
+	Zenith_Profiling::ScopeZone xScope(ZENITH_PROFILE_ZONE("AI NavMesh Generate / Assemble Tiles"));
+	Zenith_Assert(axTiles.GetSize() == xLayout.GetTileCount(), "AssembleTiles: %u tiles for a %u-tile layout",
+		axTiles.GetSize(), xLayout.GetTileCount());
 
-	return pxNavMesh;
+	xNavMeshOut.Clear();
+	auTileFirstPolygonOut.Clear();
+
+	Zenith_Vector<uint32_t> axQuad;
+	for (uint32_t uTile = 0; uTile < axTiles.GetSize(); ++uTile)
+	{
+		const Zenith_NavMeshTile& xTile = axTiles.Get(uTile);
+		auTileFirstPolygonOut.PushBack(xNavMeshOut.GetPolygonCount());
+
+		const uint32_t uVertexBase = xNavMeshOut.GetVertexCount();
+		for (uint32_t u = 0; u < xTile.m_axVertices.GetSize(); ++u)
+		{
+			xNavMeshOut.AddVertex(xTile.m_axVertices.Get(u));
+		}
+		for (uint32_t uQuad = 0; uQuad < xTile.GetQuadCount(); ++uQuad)
+		{
+			axQuad.Clear();
+			for (uint32_t u = 0; u < 4; ++u)
+			{
+				axQuad.PushBack(uVertexBase + xTile.m_auQuadVertices.Get(uQuad * 4 + u));
+			}
+			xNavMeshOut.AddPolygon(axQuad);
+		}
+	}
+	auTileFirstPolygonOut.PushBack(xNavMeshOut.GetPolygonCount());
+
+	for (uint32_t uTile = 0; uTile < axTiles.GetSize(); ++uTile)
+	{
+		const Zenith_NavMeshTile& xTile = axTiles.Get(uTile);
+		const uint32_t uFirst = auTileFirstPolygonOut.Get(uTile);
+		for (uint32_t u = 0; u < xTile.m_aiQuadNeighbours.GetSize(); ++u)
+		{
+			const int32_t iNeighbour = xTile.m_aiQuadNeighbours.Get(u);
+			if (iNeighbour >= 0)
+			{
+				xNavMeshOut.SetNeighbor(uFirst + u / 4, u % 4, uFirst + static_cast<uint32_t>(iNeighbour));
+			}
+		}
+	}
+
+	// Seams, each from its -X / -Z side.
+	for (uint32_t uTileZ = 0; uTileZ < xLayout.m_uTilesZ; ++uTileZ)
+	{
+		for (uint32_t uTileX = 0; uTileX < xLayout.m_uTilesX; ++uTileX)
+		{
+			const uint32_t uTile = uTileZ * xLayout.m_uTilesX + uTileX;
+			if (axTiles.Get(uTile).GetQuadCount() == 0)
+			{
+				continue;
+			}
+			if (uTileX + 1 < xLayout.m_uTilesX)
+			{
+				StitchTiles(xNavMeshOut, xLayout, xConfig, axTiles.Get(uTile), auTileFirstPolygonOut.Get(uTile),
+					axTiles.Get(uTile + 1), auTileFirstPolygonOut.Get(uTile + 1), true);
+			}
+			const uint32_t uAbove = uTile + xLayout.m_uTilesX;
+			if (uTileZ + 1 < xLayout.m_uTilesZ)
+			{
+				StitchTiles(xNavMeshOut, xLayout, xConfig, axTiles.Get(uTile), auTileFirstPolygonOut.Get(uTile),
+					axTiles.Get(uAbove), auTileFirstPolygonOut.Get(uAbove), false);
+			}
+		}
+	}
+
+	xNavMeshOut.BuildSpatialGrid();
+}
+
+void Zenith_NavMeshGenerator::WriteTileInPlace(const Zenith_NavMeshTile& xTile,
+	uint32_t uFirstVertex, uint32_t uFirstPolygon,
+	Zenith_NavMesh& xNavMesh)
+{
+	for (uint32_t u = 0; u < xTile.m_axVertices.GetSize(); ++u)
+	{
+		xNavMesh.SetVertex(uFirstVertex + u, xTile.m_axVertices.Get(u));
+	}
+
+	Zenith_Vector<uint32_t> axQuad;
+	for (uint32_t uQuad = 0; uQuad < xTile.GetQuadCount(); ++uQuad)
+	{
+		axQuad.Clear();
+		for (uint32_t u = 0; u < 4; ++u)
+		{
+			axQuad.PushBack(uFirstVertex + xTile.m_auQuadVertices.Get(uQuad * 4 + u));
+		}
+		xNavMesh.ReplacePolygon(uFirstPolygon + uQuad, axQuad);
+	}
+
+	for (uint32_t u = 0; u < xTile.m_aiQuadNeighbours.GetSize(); ++u)
+	{
+		const int32_t iNeighbour = xTile.m_aiQuadNeighbours.Get(u);
+		if (iNeighbour >= 0)
+		{
+			xNavMesh.SetNeighbor(uFirstPolygon + u / 4, u % 4, uFirstPolygon + static_cast<uint32_t>(iNeighbour));
+		}
+	}
+}
+
+void Zenith_NavMeshGenerator::StitchTiles(Zenith_NavMesh& xNavMesh,
+	const Zenith_NavMeshTileLayout& xLayout,
+	const NavMeshGenerationConfig& xConfig,
+	const Zenith_NavMeshTile& xTile, uint32_t uFirst,
+	const Zenith_NavMeshTile& xNext, uint32_t uFirstNext,
+	bool bAlongX)
+{
+	// The last core column/row of xTile against the first of xNext: edge 2 to
+	// edge 0 in +X, edge 1 to edge 3 in +Z.
+	const uint32_t uT = xLayout.m_uTileCells;
+	const uint32_t uEdge = bAlongX ? 2u : 1u;
+	const uint32_t uNextEdge = bAlongX ? 0u : 3u;
+	for (uint32_t u = 0; u < uT; ++u)
+	{
+		const uint32_t uCell = bAlongX ? u * uT + (uT - 1) : (uT - 1) * uT + u;
+		const uint32_t uNextCell = bAlongX ? u * uT : u;
+		for (uint32_t uQuad = xTile.m_auCellQuadStart.Get(uCell); uQuad < xTile.m_auCellQuadStart.Get(uCell + 1); ++uQuad)
+		{
+			if (xNavMesh.GetPolygon(uFirst + uQuad).m_axNeighborIndices.Get(uEdge) >= 0)
+			{
+				xNavMesh.ClearNeighbor(uFirst + uQuad, uEdge);
+			}
+		}
+		for (uint32_t uQuad = xNext.m_auCellQuadStart.Get(uNextCell); uQuad < xNext.m_auCellQuadStart.Get(uNextCell + 1); ++uQuad)
+		{
+			if (xNavMesh.GetPolygon(uFirstNext + uQuad).m_axNeighborIndices.Get(uNextEdge) >= 0)
+			{
+				xNavMesh.ClearNeighbor(uFirstNext + uQuad, uNextEdge);
+			}
+		}
+	}
+
+	if (xTile.GetQuadCount() == 0 || xNext.GetQuadCount() == 0)
+	{
+		return;
+	}
+	const int32_t iMaxStepCells = static_cast<int32_t>(xConfig.m_fMaxStepHeight / xConfig.m_fCellHeight);
+	for (uint32_t u = 0; u < uT; ++u)
+	{
+		StitchTileSeam(xNavMesh,
+			xTile, uFirst, bAlongX ? u * uT + (uT - 1) : (uT - 1) * uT + u, uEdge,
+			xNext, uFirstNext, bAlongX ? u * uT : u, uNextEdge, iMaxStepCells);
+	}
 }
 
 int32_t Zenith_NavMeshGenerator::GetColumnIndex(int32_t iX, int32_t iZ, int32_t iWidth)
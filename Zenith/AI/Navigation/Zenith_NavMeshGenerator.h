@@ -29,6 +29,57 @@ struct NavMeshGenerationConfig
 	// Detail mesh (not used in this simplified implementation)
 	float m_fDetailSampleDist = 6.0f;
 	float m_fDetailMaxError = 1.0f;
+
+	// Tiling (Zenith_TiledNavMesh). Each tile voxelizes its core cells plus a
+	// border on every side, so flood fill sees past the seam.
+	uint32_t m_uTileSizeCells = 64;    // Core tile edge in cells
+	uint32_t m_uTileBorderCells = 4;   // Padding rasterized around each core
+
+	// GenerateFromGeometry bakes through the tiled path (tiles generated in
+	// parallel, no 1024-cell clamp). Same cells as the single-grid bake, but
+	// vertices are not shared across tile seams, so existing baked assets
+	// change bytes when this is turned on.
+	bool m_bBakeInTiles = false;
+};
+
+/**
+ * Zenith_NavMeshTileLayout - the fixed lattice a tiled bake is cut into
+ *
+ * Cell (0, 0, 0) starts at m_xOrigin; tile (tx, tz) owns the core cells
+ * [tx * T, (tx + 1) * T) x [tz * T, (tz + 1) * T) for T = m_uTileCells.
+ */
+struct Zenith_NavMeshTileLayout
+{
+	Zenith_Maths::Vector3 m_xOrigin{ 0.0f };
+	float m_fCellSize = 0.0f;
+	uint32_t m_uTileCells = 0;
+	uint32_t m_uBorderCells = 0;
+	uint32_t m_uTilesX = 0;
+	uint32_t m_uTilesZ = 0;
+
+	uint32_t GetTileCount() const { return m_uTilesX * m_uTilesZ; }
+
+	// Tiles whose padded footprint overlaps the XZ box [xMin, xMax] (inclusive
+	// range). Returns false when the box misses the lattice.
+	bool GetTilesOverlapping(const Zenith_Maths::Vector3& xMin, const Zenith_Maths::Vector3& xMax,
+		uint32_t& uMinXOut, uint32_t& uMinZOut, uint32_t& uMaxXOut, uint32_t& uMaxZOut) const;
+};
+
+/**
+ * Zenith_NavMeshTile - one tile's polygons, independent of every other tile
+ *
+ * Polygons are the generator's per-cell quads. Edges run -X, +Z, +X, -Z, so a
+ * neighbour across the +X seam pairs edge 2 with the other tile's edge 0.
+ */
+struct Zenith_NavMeshTile
+{
+	Zenith_Vector<Zenith_Maths::Vector3> m_axVertices;
+	Zenith_Vector<uint32_t> m_auQuadVertices;    // 4 per quad, CCW, tile-local
+	Zenith_Vector<int32_t> m_aiQuadNeighbours;   // 4 per quad, tile-local, -1 if none
+	Zenith_Vector<uint16_t> m_auQuadHeights;     // span top in cells above the origin
+	Zenith_Vector<uint32_t> m_auCellQuadStart;   // T * T + 1 offsets, core cells row-major
+
+	uint32_t GetQuadCount() const { return m_auQuadHeights.GetSize(); }
 };
 
 /**
@@ -64,6 +115,82 @@ public:
 		const Zenith_Vector<uint32_t>& axIndices,
 		const NavMeshGenerationConfig& xConfig);
 
+	/**
+	 * Generate a navigation mesh by baking every tile of the lattice and
+	 * assembling them. Tiles are generated concurrently; the output is
+	 * byte-identical whatever the worker count.
+	 * @return Newly allocated NavMesh (caller owns), or nullptr if nothing is walkable
+	 */
+	static Zenith_NavMesh* GenerateTiledFromGeometry(
+		const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+		const Zenith_Vector<uint32_t>& axIndices,
+		const NavMeshGenerationConfig& xConfig);
+
+	// Tiled generation. A tile reads only the triangles binned to it, so any
+	// subset of tiles can be rebuilt and reassembled without the rest.
+	static Zenith_NavMeshTileLayout ComputeTileLayout(
+		const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+		const NavMeshGenerationConfig& xConfig);
+
+	// Bin every triangle into the tiles its padded footprint overlaps, for
+	// tiles inside [uMinX, uMaxX] x [uMinZ, uMaxZ] only. axTileTrianglesOut is
+	// indexed by tile (tz * tilesX + tx).
+	static void BinTrianglesToTiles(
+		const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+		const Zenith_Vector<uint32_t>& axIndices,
+		const Zenith_NavMeshTileLayout& xLayout,
+		uint32_t uMinX, uint32_t uMinZ, uint32_t uMaxX, uint32_t uMaxZ,
+		Zenith_Vector<Zenith_Vector<uint32_t>>& axTileTrianglesOut);
+
+	// Generate the tiles listed in auTiles into axTilesOut (same order), one
+	// task-system invocation per tile. A tile with nothing walkable comes back
+	// with no quads.
+	static void GenerateTiles(
+		const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+		const Zenith_Vector<uint32_t>& axIndices,
+		const NavMeshGenerationConfig& xConfig,
+		const Zenith_NavMeshTileLayout& xLayout,
+		const Zenith_Vector<uint32_t>& auTiles,
+		const Zenith_Vector<Zenith_Vector<uint32_t>>& axTileTriangles,
+		Zenith_Vector<Zenith_NavMeshTile>& axTilesOut);
+
+	static void GenerateTile(
+		const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+		const Zenith_Vector<uint32_t>& axIndices,
+		const Zenith_Vector<uint32_t>& auTriangles,
+		const NavMeshGenerationConfig& xConfig,
+		const Zenith_NavMeshTileLayout& xLayout,
+		uint32_t uTileX, uint32_t uTileZ,
+		Zenith_NavMeshTile& xTileOut);
+
+	// Rebuild xNavMeshOut from every tile in lattice order: tile-local links,
+	// then seam links between walkable cells within a step of each other.
+	// auTileFirstPolygonOut gets each tile's first polygon plus a final total.
+	static void AssembleTiles(
+		const Zenith_Vector<Zenith_NavMeshTile>& axTiles,
+		const Zenith_NavMeshTileLayout& xLayout,
+		const NavMeshGenerationConfig& xConfig,
+		Zenith_NavMesh& xNavMeshOut,
+		Zenith_Vector<uint32_t>& auTileFirstPolygonOut);
+
+	// Write xTile over slots that already exist in xNavMesh: its vertices from
+	// uFirstVertex and its quads from uFirstPolygon (ReplacePolygon), with its
+	// tile-local links. Seams are StitchTiles' job.
+	static void WriteTileInPlace(const Zenith_NavMeshTile& xTile,
+		uint32_t uFirstVertex, uint32_t uFirstPolygon,
+		Zenith_NavMesh& xNavMesh);
+
+	// Link xTile to its +X neighbour (bAlongX) or +Z neighbour xNext across
+	// their shared seam, given where each tile's polygons start. Links already
+	// on the seam are cleared first, so this also re-stitches a seam after
+	// either side was replaced.
+	static void StitchTiles(Zenith_NavMesh& xNavMesh,
+		const Zenith_NavMeshTileLayout& xLayout,
+		const NavMeshGenerationConfig& xConfig,
+		const Zenith_NavMeshTile& xTile, uint32_t uFirst,
+		const Zenith_NavMeshTile& xNext, uint32_t uFirstNext,
+		bool bAlongX);
+
 private:
 	// Internal data structures
 
@@ -119,6 +246,17 @@ private:
 		int32_t m_iHeight = 0;  // Z cells
 		int32_t m_iDepth = 0;   // Y cells
 
+		// Tiles rasterize a window of the world grid: local cell (0, 0) is
+		// world cell (m_iCellOffsetX, m_iCellOffsetZ) from m_xBoundsMin, and
+		// only the core range [min, max) emits polygons.
+		int32_t m_iCellOffsetX = 0;
+		int32_t m_iCellOffsetZ = 0;
+		int32_t m_iCoreMinX = 0;
+		int32_t m_iCoreMinZ = 0;
+		int32_t m_iCoreMaxX = 0;
+		int32_t m_iCoreMaxZ = 0;
+		bool m_bLogStages = true;
+
 		// Heightfield columns
 		Zenith_Vector<HeightfieldColumn> m_axColumns;
 
@@ -133,6 +271,8 @@ private:
 		// Output vertices and polygons
 		Zenith_Vector<Zenith_Maths::Vector3> m_axOutputVertices;
 		Zenith_Vector<Zenith_Vector<uint32_t>> m_axOutputPolygons;
+		Zenith_Vector<uint32_t> m_auOutputPolygonCells;    // local column of each polygon
+		Zenith_Vector<uint16_t> m_auOutputPolygonHeights;  // span top of each polygon
 	};
 
 	// Pipeline stages
@@ -211,6 +351,20 @@ private:
 
 	static Zenith_NavMesh* BuildNavMesh(GenerationContext& xContext);
 
+	// Zenith_AI_RunDataParallel body for GenerateTiles.
+	static void GenerateTileTaskFunc(void* pData, u_int uInvocationIndex, u_int uNumInvocations);
+
+	// Shared-edge adjacency over the emitted quads: aiNeighboursOut gets 4
+	// entries per quad, the polygon across each edge or -1.
+	static void LinkQuadEdges(const Zenith_Vector<Zenith_Vector<uint32_t>>& axQuads,
+		Zenith_Vector<int32_t>& aiNeighboursOut);
+
+	// Pair the quads of the two core cells on either side of a tile seam.
+	static void StitchTileSeam(Zenith_NavMesh& xNavMesh,
+		const Zenith_NavMeshTile& xTileA, uint32_t uFirstA, uint32_t uCellA, uint32_t uEdgeA,
+		const Zenith_NavMeshTile& xTileB, uint32_t uFirstB, uint32_t uCellB, uint32_t uEdgeB,
+		int32_t iMaxStepCells);
+
 	// Helpers
 	static int32_t GetColumnIndex(int32_t iX, int32_t iZ, int32_t iWidth);
 	static bool IsWalkableSlope(const Zenith_Maths::Vector3& xNormal, float fMaxSlopeDeg);
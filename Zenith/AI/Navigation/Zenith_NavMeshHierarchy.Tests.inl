@@ -0,0 +1,204 @@
+#include "UnitTests/Zenith_UnitTests.h"
+#include "AI/Navigation/Zenith_NavMeshHierarchy.h"
+#include "AI/Navigation/Zenith_PathSearchContext.h"
+#include "AI/Navigation/Zenith_Pathfinding.h"
+
+// Unit tests for the HPA*-style cluster hierarchy and the blocked-flag journal
+// it refreshes from. Grids come from BuildPathSearchGrid in
+// Zenith_PathSearchContext.Tests.inl (same translation unit, included first);
+// polygon (x, z) is index z * size + x.
+
+namespace
+{
+	// Wall down x = uSize / 2 with a single gap in the top row.
+	void BlockHierarchyWall(const Zenith_NavMesh& xNavMesh, uint32_t uSize)
+	{
+		for (uint32_t uZ = 0; uZ + 1 < uSize; uZ++)
+		{
+			xNavMesh.SetPolygonBlocked(uZ * uSize + uSize / 2, true);
+		}
+	}
+}
+
+ZENITH_TEST(AI, NavMeshBlockedJournalRecordsChanges)
+{
+	Zenith_NavMesh xNavMesh;
+	BuildPathSearchGrid(xNavMesh, 8);
+	const uint32_t uTopology = xNavMesh.GetTopologyRevision();
+	const uint32_t uRevision = xNavMesh.GetBlockedRevision();
+
+	xNavMesh.SetPolygonBlocked(3, true);
+	xNavMesh.SetPolygonBlocked(3, true);
+	xNavMesh.SetPolygonBlocked(10, true);
+	xNavMesh.SetPolygonBlocked(3, false);
+	ZENITH_ASSERT_EQ(xNavMesh.GetBlockedRevision(), uRevision + 3, "re-setting an unchanged flag is not a change");
+	ZENITH_ASSERT_EQ(xNavMesh.GetTopologyRevision(), uTopology, "blocking is not a topology edit");
+
+	Zenith_Vector<uint32_t> axChanged;
+	ZENITH_ASSERT_TRUE(xNavMesh.GetBlockedChangesSince(uRevision, axChanged));
+	ZENITH_ASSERT_EQ(axChanged.GetSize(), 3u);
+	ZENITH_ASSERT_EQ(axChanged.Get(0), 3u);
+	ZENITH_ASSERT_EQ(axChanged.Get(1), 10u);
+	ZENITH_ASSERT_EQ(axChanged.Get(2), 3u);
+	axChanged.Clear();  // the query appends
+	ZENITH_ASSERT_TRUE(xNavMesh.GetBlockedChangesSince(xNavMesh.GetBlockedRevision(), axChanged));
+	ZENITH_ASSERT_EQ(axChanged.GetSize(), 0u);
+
+	// Toggle past the journal's capacity: the early revision can no longer be answered.
+	for (uint32_t u = 0; u < Zenith_NavMesh::uBLOCKED_JOURNAL_SIZE + 2; u++)
+	{
+		xNavMesh.SetPolygonBlocked(20, (u & 1u) == 0u);
+	}
+	ZENITH_ASSERT_FALSE(xNavMesh.GetBlockedChangesSince(uRevision, axChanged), "an overrun journal must report it");
+
+	xNavMesh.BuildSpatialGrid();
+	ZENITH_ASSERT_GT(xNavMesh.GetTopologyRevision(), uTopology, "rebuilding spatial data moves polygon centers");
+}
+
+ZENITH_TEST(AI, NavMeshHierarchyPathsStayNearOptimal)
+{
+	const uint32_t uSize = 64;
+	Zenith_NavMesh xNavMesh;
+	BuildPathSearchGrid(xNavMesh, uSize);
+	BlockHierarchyWall(xNavMesh, uSize);
+	// A few short walls so some clusters have several entrances per border.
+	for (uint32_t uX = 4; uX < 28; uX++)
+	{
+		xNavMesh.SetPolygonBlocked(20 * uSize + uX, true);
+		xNavMesh.SetPolygonBlocked(44 * uSize + uX + 36, true);
+	}
+
+	Zenith_NavMeshHierarchyConfig xConfig;
+	xConfig.m_fClusterSize = 8.0f;
+	Zenith_NavMeshHierarchy xHierarchy;
+	xHierarchy.Build(xNavMesh, xConfig);
+	ZENITH_ASSERT_EQ(xHierarchy.GetClusterCount(), 64u);
+	ZENITH_ASSERT_TRUE(xHierarchy.IsBuiltFor(xNavMesh));
+	ZENITH_ASSERT_GT(xHierarchy.GetEntranceCount(), 0u);
+	ZENITH_ASSERT_EQ(xHierarchy.GetNodeCount(), xHierarchy.GetEntranceCount() * 2, "every entrance has a node on each side");
+
+	const Zenith_Maths::Vector3 axEndpoints[][2] = {
+		{ Zenith_Maths::Vector3(0.5f, 0.0f, 0.5f), Zenith_Maths::Vector3(63.5f, 0.0f, 0.5f) },
+		{ Zenith_Maths::Vector3(10.5f, 0.0f, 30.5f), Zenith_Maths::Vector3(50.5f, 0.0f, 60.5f) },
+		{ Zenith_Maths::Vector3(2.5f, 0.0f, 2.5f), Zenith_Maths::Vector3(12.5f, 0.0f, 40.5f) },
+		{ Zenith_Maths::Vector3(40.5f, 0.0f, 50.5f), Zenith_Maths::Vector3(40.5f, 0.0f, 10.5f) },
+		{ Zenith_Maths::Vector3(3.5f, 0.0f, 3.5f), Zenith_Maths::Vector3(5.5f, 0.0f, 4.5f) },
+	};
+
+	Zenith_PathResult xPlain;
+	Zenith_PathResult xHierarchical;
+	for (uint32_t u = 0; u < sizeof(axEndpoints) / sizeof(axEndpoints[0]); u++)
+	{
+		Zenith_Pathfinding::FindPath(xNavMesh, axEndpoints[u][0], axEndpoints[u][1], xPlain);
+		const uint32_t uPlainExpanded = Zenith_PathSearchContext::GetForThisThread().GetExpandedCount();
+		Zenith_Pathfinding::FindPath(xHierarchy, axEndpoints[u][0], axEndpoints[u][1], xHierarchical);
+		const uint32_t uHierarchicalExpanded = Zenith_PathSearchContext::GetForThisThread().GetExpandedCount();
+
+		ZENITH_ASSERT_EQ(xPlain.m_eStatus, Zenith_PathResult::Status::SUCCESS, "query %u", u);
+		ZENITH_ASSERT_EQ(xHierarchical.m_eStatus, Zenith_PathResult::Status::SUCCESS, "query %u", u);
+		ZENITH_ASSERT_LE(xHierarchical.m_fTotalDistance, xPlain.m_fTotalDistance * 1.5f,
+			"query %u: hierarchical %.2f vs optimal %.2f", u, xHierarchical.m_fTotalDistance, xPlain.m_fTotalDistance);
+		ZENITH_ASSERT_LE(uHierarchicalExpanded, uPlainExpanded, "query %u: refining the corridor must not cost more than a full search", u);
+	}
+
+	// Around the long wall the full search floods the near side; the corridor does not.
+	Zenith_Pathfinding::FindPath(xNavMesh, axEndpoints[0][0], axEndpoints[0][1], xPlain);
+	const uint32_t uPlainExpanded = Zenith_PathSearchContext::GetForThisThread().GetExpandedCount();
+	Zenith_Pathfinding::FindPath(xHierarchy, axEndpoints[0][0], axEndpoints[0][1], xHierarchical);
+	ZENITH_ASSERT_LT(Zenith_PathSearchContext::GetForThisThread().GetExpandedCount() * 2, uPlainExpanded);
+}
+
+ZENITH_TEST(AI, NavMeshHierarchyRefreshRebuildsOnlyTouchedClusters)
+{
+	const uint32_t uSize = 64;
+	Zenith_NavMesh xNavMesh;
+	BuildPathSearchGrid(xNavMesh, uSize);
+
+	Zenith_NavMeshHierarchyConfig xConfig;
+	xConfig.m_fClusterSize = 8.0f;
+	Zenith_NavMeshHierarchy xHierarchy;
+	xHierarchy.Build(xNavMesh, xConfig);
+	ZENITH_ASSERT_EQ(xHierarchy.Refresh(), 0u, "a fresh hierarchy has nothing to catch up on");
+
+	// One blocker mid-cluster: its cluster and the four across its borders.
+	xNavMesh.SetPolygonBlocked(27 * uSize + 27, true);
+	const uint32_t uRebuilt = xHierarchy.Refresh();
+	ZENITH_ASSERT_GT(uRebuilt, 0u);
+	ZENITH_ASSERT_LE(uRebuilt, 5u, "rebuilt %u of %u clusters", uRebuilt, xHierarchy.GetClusterCount());
+	ZENITH_ASSERT_EQ(xHierarchy.Refresh(), 0u);
+
+	// Block the wall incrementally; the result must match a from-scratch build.
+	BlockHierarchyWall(xNavMesh, uSize);
+	ZENITH_ASSERT_LT(xHierarchy.Refresh(), xHierarchy.GetClusterCount(), "one column of blockers should not rebuild everything");
+	Zenith_NavMeshHierarchy xRebuilt;
+	xRebuilt.Build(xNavMesh, xConfig);
+	ZENITH_ASSERT_EQ(xHierarchy.GetNodeCount(), xRebuilt.GetNodeCount());
+	ZENITH_ASSERT_EQ(xHierarchy.GetEntranceCount(), xRebuilt.GetEntranceCount());
+
+	const Zenith_Maths::Vector3 xStart(0.5f, 0.0f, 0.5f);
+	const Zenith_Maths::Vector3 xEnd(63.5f, 0.0f, 0.5f);
+	Zenith_PathResult xRefreshed;
+	Zenith_PathResult xFresh;
+	Zenith_Pathfinding::FindPath(xHierarchy, xStart, xEnd, xRefreshed);
+	Zenith_Pathfinding::FindPath(xRebuilt, xStart, xEnd, xFresh);
+	ZENITH_ASSERT_EQ(xRefreshed.m_eStatus, Zenith_PathResult::Status::SUCCESS);
+	ZENITH_ASSERT_EQ_FLOAT(xRefreshed.m_fTotalDistance, xFresh.m_fTotalDistance, 1e-3f);
+	ZENITH_ASSERT_GT(xRefreshed.m_fTotalDistance, 120.0f, "the path must go up through the gap and back");
+
+	// More changes than the journal holds: every cluster is redone.
+	for (uint32_t u = 0; u < Zenith_NavMesh::uBLOCKED_JOURNAL_SIZE + 1; u++)
+	{
+		xNavMesh.SetPolygonBlocked(5 * uSize + 3, (u & 1u) == 0u);
+	}
+	ZENITH_ASSERT_EQ(xHierarchy.Refresh(), xHierarchy.GetClusterCount());
+
+	// Topology edits invalidate the partition itself.
+	xNavMesh.BuildSpatialGrid();
+	ZENITH_ASSERT_FALSE(xHierarchy.IsBuiltFor(xNavMesh));
+	ZENITH_ASSERT_EQ(xHierarchy.Refresh(), xHierarchy.GetClusterCount());
+	ZENITH_ASSERT_TRUE(xHierarchy.IsBuiltFor(xNavMesh));
+}
+
+ZENITH_TEST(AI, NavMeshHierarchyStaleNeverCrossesBlockers)
+{
+	const uint32_t uSize = 32;
+	Zenith_NavMesh xNavMesh;
+	BuildPathSearchGrid(xNavMesh, uSize);
+	Zenith_NavMeshHierarchyConfig xConfig;
+	xConfig.m_fClusterSize = 8.0f;
+	Zenith_NavMeshHierarchy xHierarchy;
+	xHierarchy.Build(xNavMesh, xConfig);
+
+	// Wall goes up with no Refresh: the abstract graph still thinks the way is open.
+	BlockHierarchyWall(xNavMesh, uSize);
+	const Zenith_Maths::Vector3 xStart(0.5f, 0.0f, 0.5f);
+	const Zenith_Maths::Vector3 xEnd(31.5f, 0.0f, 0.5f);
+	Zenith_PathResult xPlain;
+	Zenith_PathResult xStale;
+	Zenith_Pathfinding::FindPath(xNavMesh, xStart, xEnd, xPlain);
+	Zenith_Pathfinding::FindPath(xHierarchy, xStart, xEnd, xStale);
+	ZENITH_ASSERT_EQ(xStale.m_eStatus, Zenith_PathResult::Status::SUCCESS);
+	ZENITH_ASSERT_GT(xStale.m_fTotalDistance, 60.0f, "a stale hierarchy must not walk through the wall");
+	ZENITH_ASSERT_LE(xStale.m_fTotalDistance, xPlain.m_fTotalDistance * 1.5f);
+
+	// Close the gap too: status and partial result are exactly the plain search's.
+	xNavMesh.SetPolygonBlocked((uSize - 1) * uSize + uSize / 2, true);
+	Zenith_Pathfinding::FindPath(xNavMesh, xStart, xEnd, xPlain);
+	Zenith_Pathfinding::FindPath(xHierarchy, xStart, xEnd, xStale);
+	ZENITH_ASSERT_EQ(xStale.m_eStatus, xPlain.m_eStatus);
+	ZENITH_ASSERT_EQ(xStale.m_axWaypoints.GetSize(), xPlain.m_axWaypoints.GetSize());
+	ZENITH_ASSERT_EQ_FLOAT(xStale.m_fTotalDistance, xPlain.m_fTotalDistance, 1e-4f);
+
+	// Batch requests carry the hierarchy through to the workers' searches.
+	xNavMesh.SetPolygonBlocked((uSize - 1) * uSize + uSize / 2, false);
+	xHierarchy.Refresh();
+	Zenith_Pathfinding::PathRequest xRequest;
+	xRequest.m_pxNavMesh = &xNavMesh;
+	xRequest.m_pxHierarchy = &xHierarchy;
+	xRequest.m_xStart = xStart;
+	xRequest.m_xEnd = xEnd;
+	Zenith_Pathfinding::FindPathsBatch(&xRequest, 1);
+	Zenith_Pathfinding::FindPath(xHierarchy, xStart, xEnd, xStale);
+	ZENITH_ASSERT_EQ(xRequest.m_xResult.m_eStatus, Zenith_PathResult::Status::SUCCESS);
+	ZENITH_ASSERT_EQ_FLOAT(xRequest.m_xResult.m_fTotalDistance, xStale.m_fTotalDistance, 1e-4f);
+}
@@ -0,0 +1,533 @@
+#include "Zenith.h"
+#include "AI/Navigation/Zenith_NavMeshHierarchy.h"
+#include "AI/Navigation/Zenith_NavMesh.h"
+#include "AI/Navigation/Zenith_PathSearchContext.h"
+#include "Collections/Zenith_HashMap.h"
+#include "Profiling/Zenith_PerfCounters.h"
+#include "Profiling/Zenith_Profiling.h"
+#include <algorithm>
+#include <cfloat>
+
+namespace
+{
+	// What Zenith_Pathfinding charges to step from uFrom into uTo.
+	float StepCost(const Zenith_NavMesh& xNavMesh, uint32_t uFrom, uint32_t uTo)
+	{
+		const Zenith_NavMesh::SearchNode& xTo = xNavMesh.GetSearchNode(uTo);
+		return Zenith_Maths::Length(xTo.m_xCenter - xNavMesh.GetSearchNode(uFrom).m_xCenter) * xTo.m_fCost;
+	}
+
+	bool AreAdjacentOrSame(const Zenith_NavMesh& xNavMesh, uint32_t uA, uint32_t uB)
+	{
+		if (uA == uB) return true;
+		const Zenith_NavMeshPolygon& xPoly = xNavMesh.GetPolygon(uA);
+		for (uint32_t u = 0; u < xPoly.m_axNeighborIndices.GetSize(); ++u)
+		{
+			if (xPoly.m_axNeighborIndices.Get(u) == static_cast<int32_t>(uB)) return true;
+		}
+		return false;
+	}
+
+	// One adjacent (a, b) polygon pair on a shared cluster border, with its
+	// position along that border.
+	struct BorderLink
+	{
+		float m_fAlong;
+		uint32_t m_uPolygonA;
+		uint32_t m_uPolygonB;
+
+		bool operator<(const BorderLink& xOther) const
+		{
+			if (m_fAlong != xOther.m_fAlong) return m_fAlong < xOther.m_fAlong;
+			if (m_uPolygonA != xOther.m_uPolygonA) return m_uPolygonA < xOther.m_uPolygonA;
+			return m_uPolygonB < xOther.m_uPolygonB;
+		}
+	};
+
+	// Per-thread query scratch: FindCorridor is const and runs on batch workers.
+	struct CorridorScratch
+	{
+		Zenith_Vector<float> m_afFromStart;     // start-cluster node -> cost from the start polygon
+		Zenith_Vector<float> m_afToEnd;         // end-cluster node -> cost to the end polygon
+		Zenith_Vector<uint32_t> m_auClusterStamp;
+		uint32_t m_uStamp = 0;
+	};
+
+	CorridorScratch& GetCorridorScratch()
+	{
+		thread_local static CorridorScratch tl_xScratch;
+		return tl_xScratch;
+	}
+
+	// Build-time only; lives here so Refresh does not allocate it per entrance.
+	Zenith_Vector<BorderLink>& GetBorderScratch()
+	{
+		thread_local static Zenith_Vector<BorderLink> tl_axLinks;
+		return tl_axLinks;
+	}
+
+	uint32_t NextStamp(uint32_t& uStamp, Zenith_Vector<uint32_t>& auStamps)
+	{
+		uStamp++;
+		if (uStamp == 0)
+		{
+			for (uint32_t u = 0; u < auStamps.GetSize(); u++) auStamps.Get(u) = 0;
+			uStamp = 1;
+		}
+		return uStamp;
+	}
+}
+
+void Zenith_NavMeshHierarchy::Build(const Zenith_NavMesh& xNavMesh, const Zenith_NavMeshHierarchyConfig& xConfig)
+{
+	Zenith_Profiling::ScopeZone xProfileScope(ZENITH_PROFILE_ZONE("AI NavMesh Hierarchy Build"));
+
+	m_pxNavMesh = &xNavMesh;
+	m_xConfig = xConfig;
+	Zenith_Assert(m_xConfig.m_fClusterSize > 0.0f, "NavMeshHierarchy: cluster size must be positive");
+	if (m_xConfig.m_fClusterSize <= 0.0f) m_xConfig.m_fClusterSize = Zenith_NavMeshHierarchyConfig().m_fClusterSize;
+
+	m_uTopologyRevision = xNavMesh.GetTopologyRevision();
+	m_uBlockedRevision = xNavMesh.GetBlockedRevision();
+
+	m_axClusters.Clear();
+	m_axPairs.Clear();
+	m_auPolygonCluster.Clear();
+	m_auNodeCluster.Clear();
+
+	const uint32_t uPolygonCount = xNavMesh.GetPolygonCount();
+	if (uPolygonCount == 0)
+	{
+		m_uClustersX = 0;
+		m_uClustersZ = 0;
+		return;
+	}
+
+	// Square cells over the mesh bounds; a polygon belongs to the cell holding its center.
+	const Zenith_Maths::Vector3 xExtent = xNavMesh.GetBoundsMax() - xNavMesh.GetBoundsMin();
+	m_xOrigin = xNavMesh.GetBoundsMin();
+	m_uClustersX = std::max(1u, static_cast<uint32_t>(std::ceil(xExtent.x / m_xConfig.m_fClusterSize)));
+	m_uClustersZ = std::max(1u, static_cast<uint32_t>(std::ceil(xExtent.z / m_xConfig.m_fClusterSize)));
+	m_axClusters.Resize(m_uClustersX * m_uClustersZ);
+
+	m_auPolygonCluster.Resize(uPolygonCount, 0u);
+	for (uint32_t uPoly = 0; uPoly < uPolygonCount; ++uPoly)
+	{
+		const Zenith_Maths::Vector3 xLocal = xNavMesh.GetPolygon(uPoly).m_xCenter - m_xOrigin;
+		const uint32_t uX = std::min(m_uClustersX - 1, static_cast<uint32_t>(std::max(0.0f, xLocal.x / m_xConfig.m_fClusterSize)));
+		const uint32_t uZ = std::min(m_uClustersZ - 1, static_cast<uint32_t>(std::max(0.0f, xLocal.z / m_xConfig.m_fClusterSize)));
+		const uint32_t uCluster = uZ * m_uClustersX + uX;
+		m_auPolygonCluster.Get(uPoly) = uCluster;
+		m_axClusters.Get(uCluster).m_auPolygons.PushBack(uPoly);
+	}
+
+	// One pair per two clusters joined by at least one neighbour link.
+	Zenith_HashMap<uint64_t, uint32_t> xPairIndex;
+	for (uint32_t uPoly = 0; uPoly < uPolygonCount; ++uPoly)
+	{
+		const Zenith_NavMeshPolygon& xPoly = xNavMesh.GetPolygon(uPoly);
+		for (uint32_t u = 0; u < xPoly.m_axNeighborIndices.GetSize(); ++u)
+		{
+			const int32_t iNeighbor = xPoly.m_axNeighborIndices.Get(u);
+			if (iNeighbor < 0) continue;
+			const uint32_t uClusterA = m_auPolygonCluster.Get(uPoly);
+			const uint32_t uClusterB = m_auPolygonCluster.Get(static_cast<uint32_t>(iNeighbor));
+			if (uClusterA == uClusterB) continue;
+
+			const uint32_t uLow = std::min(uClusterA, uClusterB);
+			const uint32_t uHigh = std::max(uClusterA, uClusterB);
+			const uint64_t ulKey = (static_cast<uint64_t>(uLow) << 32) | uHigh;
+			if (xPairIndex.Contains(ulKey)) continue;
+
+			xPairIndex.Insert(ulKey, m_axPairs.GetSize());
+			m_axClusters.Get(uLow).m_auPairs.PushBack(m_axPairs.GetSize());
+			m_axClusters.Get(uHigh).m_auPairs.PushBack(m_axPairs.GetSize());
+			ClusterPair xPair;
+			xPair.m_auCluster[0] = uLow;
+			xPair.m_auCluster[1] = uHigh;
+			m_axPairs.PushBack(std::move(xPair));
+		}
+	}
+
+	m_auClusterMark.Clear();
+	m_auClusterMark.Resize(m_axClusters.GetSize(), 0u);
+	m_auPairMark.Clear();
+	m_auPairMark.Resize(m_axPairs.GetSize(), 0u);
+	m_uMark = 0;
+
+	Zenith_Vector<uint32_t> auAll;
+	auAll.Reserve(m_axClusters.GetSize());
+	for (uint32_t u = 0; u < m_axClusters.GetSize(); ++u) auAll.PushBack(u);
+	RebuildClusters(auAll);
+}
+
+uint32_t Zenith_NavMeshHierarchy::Refresh()
+{
+	if (m_pxNavMesh == nullptr) return 0;
+
+	if (!IsBuiltFor(*m_pxNavMesh))
+	{
+		Build(*m_pxNavMesh, m_xConfig);
+		return m_axClusters.GetSize();
+	}
+	if (m_pxNavMesh->GetBlockedRevision() == m_uBlockedRevision) return 0;
+
+	Zenith_Profiling::ScopeZone xProfileScope(ZENITH_PROFILE_ZONE("AI NavMesh Hierarchy Refresh"));
+
+	Zenith_Vector<uint32_t> auDirty;
+	if (m_pxNavMesh->GetBlockedChangesSince(m_uBlockedRevision, auDirty))
+	{
+		for (uint32_t u = 0; u < auDirty.GetSize(); ++u)
+		{
+			auDirty.Get(u) = m_auPolygonCluster.Get(auDirty.Get(u));
+		}
+	}
+	else
+	{
+		// Journal overrun: too much changed to know what, so redo every cluster.
+		auDirty.Clear();
+		for (uint32_t u = 0; u < m_axClusters.GetSize(); ++u) auDirty.PushBack(u);
+	}
+	m_uBlockedRevision = m_pxNavMesh->GetBlockedRevision();
+
+	return RebuildClusters(auDirty);
+}
+
+bool Zenith_NavMeshHierarchy::IsBuiltFor(const Zenith_NavMesh& xNavMesh) const
+{
+	return m_pxNavMesh == &xNavMesh
+		&& m_uTopologyRevision == xNavMesh.GetTopologyRevision()
+		&& m_auPolygonCluster.GetSize() == xNavMesh.GetPolygonCount();
+}
+
+uint32_t Zenith_NavMeshHierarchy::GetEntranceCount() const
+{
+	uint32_t uCount = 0;
+	for (uint32_t u = 0; u < m_axPairs.GetSize(); ++u)
+	{
+		uCount += m_axPairs.Get(u).m_axEntrances.GetSize();
+	}
+	return uCount;
+}
+
+uint32_t Zenith_NavMeshHierarchy::RebuildClusters(const Zenith_Vector<uint32_t>& auDirty)
+{
+	const uint32_t uMark = NextStamp(m_uMark, m_auClusterMark);
+	if (uMark == 1)
+	{
+		// NextStamp only clears the array it is given; the pair marks share the counter.
+		for (uint32_t u = 0; u < m_auPairMark.GetSize(); ++u) m_auPairMark.Get(u) = 0;
+	}
+
+	// Transitions on every border of a dirty cluster may have moved, and with
+	// them the node sets of the clusters on the far side.
+	Zenith_Vector<uint32_t> auAffected;
+	for (uint32_t u = 0; u < auDirty.GetSize(); ++u)
+	{
+		const Cluster& xCluster = m_axClusters.Get(auDirty.Get(u));
+		for (uint32_t uPairSlot = 0; uPairSlot < xCluster.m_auPairs.GetSize(); ++uPairSlot)
+		{
+			const uint32_t uPair = xCluster.m_auPairs.Get(uPairSlot);
+			if (m_auPairMark.Get(uPair) == uMark) continue;
+			m_auPairMark.Get(uPair) = uMark;
+			RebuildEntrances(uPair);
+
+			for (uint32_t uSide = 0; uSide < 2; ++uSide)
+			{
+				const uint32_t uSideCluster = m_axPairs.Get(uPair).m_auCluster[uSide];
+				if (m_auClusterMark.Get(uSideCluster) == uMark) continue;
+				m_auClusterMark.Get(uSideCluster) = uMark;
+				auAffected.PushBack(uSideCluster);
+			}
+		}
+		if (m_auClusterMark.Get(auDirty.Get(u)) != uMark)
+		{
+			m_auClusterMark.Get(auDirty.Get(u)) = uMark;
+			auAffected.PushBack(auDirty.Get(u));
+		}
+	}
+
+	for (uint32_t u = 0; u < auAffected.GetSize(); ++u)
+	{
+		RebuildNodes(auAffected.Get(u));
+		RebuildIntraCosts(auAffected.Get(u));
+	}
+	RenumberNodes();
+
+	ZENITH_PERF_COUNTER_ADD("AI.HierarchyClustersRebuilt", auAffected.GetSize());
+	return auAffected.GetSize();
+}
+
+void Zenith_NavMeshHierarchy::RebuildEntrances(uint32_t uPair)
+{
+	const Zenith_NavMesh& xNavMesh = *m_pxNavMesh;
+	ClusterPair& xPair = m_axPairs.Get(uPair);
+	xPair.m_axEntrances.Clear();
+
+	// Measure along the shared border: clusters side by side in X share a
+	// border running along Z, and vice versa. Diagonal pairs (touching at a
+	// corner, or joined by a stitched portal) use both.
+	const uint32_t uClusterA = xPair.m_auCluster[0];
+	const uint32_t uClusterB = xPair.m_auCluster[1];
+	const bool bSameColumn = (uClusterA % m_uClustersX) == (uClusterB % m_uClustersX);
+	const bool bSameRow = (uClusterA / m_uClustersX) == (uClusterB / m_uClustersX);
+	const float fAxisX = bSameRow ? 0.0f : 1.0f;
+	const float fAxisZ = bSameColumn ? 0.0f : 1.0f;
+
+	Zenith_Vector<BorderLink>& axLinks = GetBorderScratch();
+	axLinks.Clear();
+	const Cluster& xClusterA = m_axClusters.Get(uClusterA);
+	for (uint32_t uSlot = 0; uSlot < xClusterA.m_auPolygons.GetSize(); ++uSlot)
+	{
+		const uint32_t uPolyA = xClusterA.m_auPolygons.Get(uSlot);
+		const Zenith_NavMeshPolygon& xPolyA = xNavMesh.GetPolygon(uPolyA);
+		if (xPolyA.IsBlocked()) continue;
+		for (uint32_t u = 0; u < xPolyA.m_axNeighborIndices.GetSize(); ++u)
+		{
+			const int32_t iNeighbor = xPolyA.m_axNeighborIndices.Get(u);
+			if (iNeighbor < 0) continue;
+			const uint32_t uPolyB = static_cast<uint32_t>(iNeighbor);
+			if (m_auPolygonCluster.Get(uPolyB) != uClusterB) continue;
+			if (xNavMesh.GetPolygon(uPolyB).IsBlocked()) continue;
+
+			const Zenith_Maths::Vector3 xMid = (xPolyA.m_xCenter + xNavMesh.GetPolygon(uPolyB).m_xCenter) * 0.5f;
+			axLinks.PushBack({ xMid.x * fAxisX + xMid.z * fAxisZ, uPolyA, uPolyB });
+		}
+	}
+	if (axLinks.GetSize() == 0) return;
+	std::sort(axLinks.begin(), axLinks.end());
+
+	// Split into entrances at gaps in the border (consecutive links touching on
+	// neither side) and wherever a run grows past the span limit. Each entrance
+	// is represented by its middle link.
+	uint32_t uRunStart = 0;
+	for (uint32_t u = 1; u <= axLinks.GetSize(); ++u)
+	{
+		bool bEndRun = (u == axLinks.GetSize());
+		if (!bEndRun)
+		{
+			const BorderLink& xPrev = axLinks.Get(u - 1);
+			const BorderLink& xCur = axLinks.Get(u);
+			const bool bContiguous = AreAdjacentOrSame(xNavMesh, xPrev.m_uPolygonA, xCur.m_uPolygonA)
+				|| AreAdjacentOrSame(xNavMesh, xPrev.m_uPolygonB, xCur.m_uPolygonB);
+			bEndRun = !bContiguous || (xCur.m_fAlong - axLinks.Get(uRunStart).m_fAlong > m_xConfig.m_fMaxEntranceSpan);
+		}
+		if (!bEndRun) continue;
+
+		const BorderLink& xMiddle = axLinks.Get((uRunStart + u - 1) / 2);
+		Entrance xEntrance;
+		xEntrance.m_auPolygon[0] = xMiddle.m_uPolygonA;
+		xEntrance.m_auPolygon[1] = xMiddle.m_uPolygonB;
+		xEntrance.m_afCrossCost[0] = StepCost(xNavMesh, xMiddle.m_uPolygonA, xMiddle.m_uPolygonB);
+		xEntrance.m_afCrossCost[1] = StepCost(xNavMesh, xMiddle.m_uPolygonB, xMiddle.m_uPolygonA);
+		xPair.m_axEntrances.PushBack(xEntrance);
+		uRunStart = u;
+	}
+}
+
+void Zenith_NavMeshHierarchy::RebuildNodes(uint32_t uCluster)
+{
+	Cluster& xCluster = m_axClusters.Get(uCluster);
+	xCluster.m_axNodes.Clear();
+	for (uint32_t uPairSlot = 0; uPairSlot < xCluster.m_auPairs.GetSize(); ++uPairSlot)
+	{
+		const uint32_t uPair = xCluster.m_auPairs.Get(uPairSlot);
+		ClusterPair& xPair = m_axPairs.Get(uPair);
+		const uint32_t uSide = (xPair.m_auCluster[0] == uCluster) ? 0u : 1u;
+		for (uint32_t uEntrance = 0; uEntrance < xPair.m_axEntrances.GetSize(); ++uEntrance)
+		{
+			Entrance& xEntrance = xPair.m_axEntrances.Get(uEntrance);
+			xEntrance.m_auNode[uSide] = xCluster.m_axNodes.GetSize();
+
+			Node xNode;
+			xNode.m_uPolygon = xEntrance.m_auPolygon[uSide];
+			xNode.m_uPair = uPair;
+			xNode.m_uEntrance = uEntrance;
+			xNode.m_uSide = uSide;
+			xCluster.m_axNodes.PushBack(xNode);
+		}
+	}
+}
+
+void Zenith_NavMeshHierarchy::RebuildIntraCosts(uint32_t uCluster)
+{
+	Cluster& xCluster = m_axClusters.Get(uCluster);
+	const uint32_t uNodes = xCluster.m_axNodes.GetSize();
+	xCluster.m_afIntraCost.Clear();
+	xCluster.m_afIntraCost.Resize(uNodes * uNodes, FLT_MAX);
+
+	Zenith_PathSearchContext& xSearch = Zenith_PathSearchContext::GetForThisThread();
+	for (uint32_t uFrom = 0; uFrom < uNodes; ++uFrom)
+	{
+		SearchCluster(uCluster, xCluster.m_axNodes.Get(uFrom).m_uPolygon, false, xSearch);
+		for (uint32_t uTo = 0; uTo < uNodes; ++uTo)
+		{
+			const uint32_t uTarget = xCluster.m_axNodes.Get(uTo).m_uPolygon;
+			if (xSearch.IsClosed(uTarget))
+			{
+				xCluster.m_afIntraCost.Get(uFrom * uNodes + uTo) = xSearch.GetNode(uTarget).m_fGCost;
+			}
+		}
+	}
+}
+
+void Zenith_NavMeshHierarchy::RenumberNodes()
+{
+	m_auNodeCluster.Clear();
+	for (uint32_t uCluster = 0; uCluster < m_axClusters.GetSize(); ++uCluster)
+	{
+		Cluster& xCluster = m_axClusters.Get(uCluster);
+		xCluster.m_uFirstNode = m_auNodeCluster.GetSize();
+		for (uint32_t u = 0; u < xCluster.m_axNodes.GetSize(); ++u)
+		{
+			m_auNodeCluster.PushBack(uCluster);
+		}
+	}
+}
+
+uint32_t Zenith_NavMeshHierarchy::GetNodePolygon(uint32_t uNode) const
+{
+	const Cluster& xCluster = m_axClusters.Get(m_auNodeCluster.Get(uNode));
+	return xCluster.m_axNodes.Get(uNode - xCluster.m_uFirstNode).m_uPolygon;
+}
+
+void Zenith_NavMeshHierarchy::SearchCluster(uint32_t uCluster, uint32_t uSource, bool bReverse, Zenith_PathSearchContext& xSearch) const
+{
+	const Zenith_NavMesh& xNavMesh = *m_pxNavMesh;
+	xSearch.Begin(xNavMesh.GetPolygonCount());
+	if (xNavMesh.GetSearchNode(uSource).IsBlocked()) return;
+
+	xSearch.OpenOrImprove(uSource, Zenith_PathSearchContext::uNO_PARENT, 0.0f, 0.0f);
+	while (xSearch.HasOpen())
+	{
+		const uint32_t uCurrent = xSearch.PopCheapest();
+		const float fCurrentCost = xSearch.GetNode(uCurrent).m_fGCost;
+		const Zenith_NavMesh::SearchNode& xNode = xNavMesh.GetSearchNode(uCurrent);
+		for (uint32_t u = 0; u < xNode.m_uNeighbourCount; ++u)
+		{
+			const int32_t iNeighbor = xNavMesh.GetSearchNeighbour(xNode, u);
+			if (iNeighbor < 0) continue;
+			const uint32_t uNeighbor = static_cast<uint32_t>(iNeighbor);
+			if (m_auPolygonCluster.Get(uNeighbor) != uCluster) continue;
+			if (xNavMesh.GetSearchNode(uNeighbor).IsBlocked()) continue;
+
+			const float fStep = bReverse ? StepCost(xNavMesh, uNeighbor, uCurrent) : StepCost(xNavMesh, uCurrent, uNeighbor);
+			xSearch.OpenOrImprove(uNeighbor, uCurrent, fCurrentCost + fStep, 0.0f);
+		}
+	}
+}
+
+bool Zenith_NavMeshHierarchy::FindCorridor(uint32_t uStartPolygon, const Zenith_Maths::Vector3& xStart,
+	uint32_t uEndPolygon, const Zenith_Maths::Vector3& xEnd,
+	Zenith_PathCorridor& xCorridorOut) const
+{
+	if (m_pxNavMesh == nullptr || !IsBuiltFor(*m_pxNavMesh)) return false;
+	const Zenith_NavMesh& xNavMesh = *m_pxNavMesh;
+
+	CorridorScratch& xScratch = GetCorridorScratch();
+	Zenith_PathSearchContext& xSearch = Zenith_PathSearchContext::GetForThisThread();
+
+	// Connect the endpoints to the transitions of their own clusters. The
+	// forward search also yields the direct in-cluster route when start and
+	// end share a cluster.
+	const uint32_t uStartCluster = m_auPolygonCluster.Get(uStartPolygon);
+	const uint32_t uEndCluster = m_auPolygonCluster.Get(uEndPolygon);
+	const Cluster& xStartCluster = m_axClusters.Get(uStartCluster);
+	const Cluster& xEndCluster = m_axClusters.Get(uEndCluster);
+
+	SearchCluster(uStartCluster, uStartPolygon, false, xSearch);
+	xScratch.m_afFromStart.Clear();
+	for (uint32_t u = 0; u < xStartCluster.m_axNodes.GetSize(); ++u)
+	{
+		const uint32_t uPolygon = xStartCluster.m_axNodes.Get(u).m_uPolygon;
+		xScratch.m_afFromStart.PushBack(xSearch.IsClosed(uPolygon) ? xSearch.GetNode(uPolygon).m_fGCost : FLT_MAX);
+	}
+	const float fDirect = (uStartCluster == uEndCluster && xSearch.IsClosed(uEndPolygon))
+		? xSearch.GetNode(uEndPolygon).m_fGCost : FLT_MAX;
+
+	SearchCluster(uEndCluster, uEndPolygon, true, xSearch);
+	xScratch.m_afToEnd.Clear();
+	for (uint32_t u = 0; u < xEndCluster.m_axNodes.GetSize(); ++u)
+	{
+		const uint32_t uPolygon = xEndCluster.m_axNodes.Get(u).m_uPolygon;
+		xScratch.m_afToEnd.PushBack(xSearch.IsClosed(uPolygon) ? xSearch.GetNode(uPolygon).m_fGCost : FLT_MAX);
+	}
+
+	// A* over the transitions, plus two virtual nodes for the endpoints.
+	const uint32_t uNodeCount = m_auNodeCluster.GetSize();
+	const uint32_t uStartNode = uNodeCount;
+	const uint32_t uEndNode = uNodeCount + 1;
+	xSearch.Begin(uNodeCount + 2);
+	xSearch.OpenOrImprove(uStartNode, Zenith_PathSearchContext::uNO_PARENT, 0.0f, Zenith_Maths::Length(xEnd - xStart));
+
+	auto Relax = [&](uint32_t uFrom, uint32_t uTo, float fStep)
+	{
+		if (fStep == FLT_MAX || xSearch.IsClosed(uTo)) return;
+		const float fHCost = (uTo == uEndNode) ? 0.0f
+			: Zenith_Maths::Length(xEnd - xNavMesh.GetPolygon(GetNodePolygon(uTo)).m_xCenter);
+		xSearch.OpenOrImprove(uTo, uFrom, xSearch.GetNode(uFrom).m_fGCost + fStep, fHCost);
+	};
+
+	bool bReached = false;
+	while (xSearch.HasOpen())
+	{
+		const uint32_t uCurrent = xSearch.PopCheapest();
+		if (uCurrent == uEndNode)
+		{
+			bReached = true;
+			break;
+		}
+
+		if (uCurrent == uStartNode)
+		{
+			for (uint32_t u = 0; u < xStartCluster.m_axNodes.GetSize(); ++u)
+			{
+				Relax(uCurrent, xStartCluster.m_uFirstNode + u, xScratch.m_afFromStart.Get(u));
+			}
+			Relax(uCurrent, uEndNode, fDirect);
+			continue;
+		}
+
+		const uint32_t uCluster = m_auNodeCluster.Get(uCurrent);
+		const Cluster& xCluster = m_axClusters.Get(uCluster);
+		const uint32_t uLocal = uCurrent - xCluster.m_uFirstNode;
+		const Node& xNode = xCluster.m_axNodes.Get(uLocal);
+		// Refresh never makes a blocked polygon a transition; this catches flips
+		// it has not seen yet.
+		if (xNavMesh.GetPolygon(xNode.m_uPolygon).IsBlocked()) continue;
+
+		const uint32_t uNodes = xCluster.m_axNodes.GetSize();
+		for (uint32_t u = 0; u < uNodes; ++u)
+		{
+			if (u != uLocal) Relax(uCurrent, xCluster.m_uFirstNode + u, xCluster.m_afIntraCost.Get(uLocal * uNodes + u));
+		}
+
+		const ClusterPair& xPair = m_axPairs.Get(xNode.m_uPair);
+		const Entrance& xEntrance = xPair.m_axEntrances.Get(xNode.m_uEntrance);
+		const uint32_t uOtherSide = 1u - xNode.m_uSide;
+		const Cluster& xOther = m_axClusters.Get(xPair.m_auCluster[uOtherSide]);
+		Relax(uCurrent, xOther.m_uFirstNode + xEntrance.m_auNode[uOtherSide], xEntrance.m_afCrossCost[xNode.m_uSide]);
+
+		if (uCluster == uEndCluster)
+		{
+			Relax(uCurrent, uEndNode, xScratch.m_afToEnd.Get(uLocal));
+		}
+	}
+	ZENITH_PERF_HISTOGRAM_RECORD("AI.AbstractNodesExpanded", xSearch.GetExpandedCount());
+	if (!bReached) return false;
+
+	// Stamp every cluster the abstract path passes through.
+	xScratch.m_auClusterStamp.Resize(std::max(xScratch.m_auClusterStamp.GetSize(), m_axClusters.GetSize()), 0u);
+	const uint32_t uStamp = NextStamp(xScratch.m_uStamp, xScratch.m_auClusterStamp);
+	xScratch.m_auClusterStamp.Get(uStartCluster) = uStamp;
+	xScratch.m_auClusterStamp.Get(uEndCluster) = uStamp;
+	for (uint32_t uNode = xSearch.GetNode(uEndNode).m_uParent; uNode != uStartNode; uNode = xSearch.GetNode(uNode).m_uParent)
+	{
+		xScratch.m_auClusterStamp.Get(m_auNodeCluster.Get(uNode)) = uStamp;
+	}
+
+	xCorridorOut.m_puPolygonCluster = m_auPolygonCluster.GetDataPointer();
+	xCorridorOut.m_puClusterStamp = xScratch.m_auClusterStamp.GetDataPointer();
+	xCorridorOut.m_uStamp = uStamp;
+	return true;
+}
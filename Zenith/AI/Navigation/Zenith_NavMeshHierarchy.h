@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Collections/Zenith_Vector.h"
+#include "Maths/Zenith_Maths.h"
+
+class Zenith_NavMesh;
+class Zenith_PathSearchContext;
+
+struct Zenith_NavMeshHierarchyConfig
+{
+	// Edge length of one square cluster on the XZ plane. Bigger clusters mean a
+	// smaller abstract graph but more work per rebuild and per refinement.
+	float m_fClusterSize = 16.0f;
+
+	// Longest stretch of shared border one transition may stand for. A path
+	// through the border is routed via that transition's polygon, so this is
+	// roughly the worst sideways detour per cluster crossing in the abstract
+	// path (the refined path is never worse than the abstract one).
+	float m_fMaxEntranceSpan = 6.0f;
+};
+
+/**
+ * Zenith_PathCorridor - the clusters one hierarchical query refines through.
+ *
+ * A view into per-thread scratch filled by Zenith_NavMeshHierarchy::FindCorridor;
+ * valid until the next FindCorridor on the same thread.
+ */
+struct Zenith_PathCorridor
+{
+	const uint32_t* m_puPolygonCluster = nullptr;
+	const uint32_t* m_puClusterStamp = nullptr;
+	uint32_t m_uStamp = 0;
+
+	bool Contains(uint32_t uPolygon) const
+	{
+		return m_puClusterStamp[m_puPolygonCluster[uPolygon]] == m_uStamp;
+	}
+};
+
+/**
+ * Zenith_NavMeshHierarchy - optional HPA*-style abstraction over a Zenith_NavMesh
+ *
+ * Polygons are bucketed into square XZ clusters by their centers. Wherever two
+ * clusters touch, the shared border is split into entrances of at most
+ * m_fMaxEntranceSpan, and each entrance contributes one transition: a polygon
+ * on either side, linked by an inter-cluster edge. Inside each cluster every
+ * pair of transition polygons is joined by an edge carrying the cached cost of
+ * the best path between them that stays in the cluster.
+ *
+ * A query (Zenith_Pathfinding::FindPath with a hierarchy) searches that small
+ * graph first, then runs the ordinary polygon A* restricted to the clusters the
+ * abstract path visits. Long queries therefore expand nodes in proportion to
+ * the corridor, not to the world. That shortens the search only: SmoothPath
+ * still runs over the refined path, and on long paths it costs more than the
+ * search does. When the abstract search finds no route, or
+ * the hierarchy is stale for the mesh's topology, the query falls back to the
+ * full search, so the result is never worse than a failure of the plain path.
+ *
+ * Dynamic obstacles. Refresh() reads the mesh's blocked-flag journal and
+ * rebuilds only the clusters whose polygons changed, plus the clusters sharing
+ * a border with them (their transitions may have moved). Blocked polygons
+ * never become transitions and are skipped by every cached search; the final
+ * refinement consults the live flags, so a missed Refresh can cost path
+ * quality but never route through a blocker.
+ *
+ * Threading. Build and Refresh mutate and belong to the owner's thread, between
+ * query batches. FindCorridor is const and uses per-thread scratch.
+ */
+class Zenith_NavMeshHierarchy
+{
+public:
+	// Partition xNavMesh and build every cluster. The mesh must outlive this
+	// object (or the next Build).
+	void Build(const Zenith_NavMesh& xNavMesh, const Zenith_NavMeshHierarchyConfig& xConfig = Zenith_NavMeshHierarchyConfig());
+
+	// Catch up with the mesh: a full Build after topology edits, otherwise a
+	// rebuild of the clusters touched by SetPolygonBlocked since the last call.
+	// Returns the number of clusters rebuilt (0 when already current).
+	uint32_t Refresh();
+
+	// True when built for this mesh's current topology.
+	bool IsBuiltFor(const Zenith_NavMesh& xNavMesh) const;
+	const Zenith_NavMesh* GetNavMesh() const { return m_pxNavMesh; }
+
+	/**
+	 * Abstract search from uStartPolygon to uEndPolygon. On success fills
+	 * xCorridorOut with the clusters the abstract path visits.
+	 * @return false if the hierarchy is stale or no abstract route exists.
+	 */
+	bool FindCorridor(uint32_t uStartPolygon, const Zenith_Maths::Vector3& xStart,
+		uint32_t uEndPolygon, const Zenith_Maths::Vector3& xEnd,
+		Zenith_PathCorridor& xCorridorOut) const;
+
+	uint32_t GetClusterCount() const { return m_axClusters.GetSize(); }
+	uint32_t GetClusterOfPolygon(uint32_t uPolygon) const { return m_auPolygonCluster.Get(uPolygon); }
+	uint32_t GetNodeCount() const { return m_auNodeCluster.GetSize(); }
+	uint32_t GetEntranceCount() const;
+
+private:
+	friend class Zenith_UnitTests;
+
+	struct Entrance
+	{
+		uint32_t m_auPolygon[2] = {};      // side 0 in the pair's first cluster
+		float m_afCrossCost[2] = {};       // step cost from side s to the other side
+		uint32_t m_auNode[2] = {};         // local node index in each side's cluster
+	};
+
+	struct ClusterPair
+	{
+		uint32_t m_auCluster[2] = {};      // lower cluster index first
+		Zenith_Vector<Entrance> m_axEntrances;
+	};
+
+	struct Node
+	{
+		uint32_t m_uPolygon = 0;
+		uint32_t m_uPair = 0;
+		uint32_t m_uEntrance = 0;
+		uint32_t m_uSide = 0;
+	};
+
+	struct Cluster
+	{
+		Zenith_Vector<uint32_t> m_auPolygons;
+		Zenith_Vector<uint32_t> m_auPairs;
+		Zenith_Vector<Node> m_axNodes;
+		Zenith_Vector<float> m_afIntraCost;   // m_axNodes.GetSize() squared, row = from
+		uint32_t m_uFirstNode = 0;            // global id of m_axNodes[0]
+	};
+
+	// Rebuild the given clusters and every cluster bordering them.
+	uint32_t RebuildClusters(const Zenith_Vector<uint32_t>& auDirty);
+	void RebuildEntrances(uint32_t uPair);
+	void RebuildNodes(uint32_t uCluster);
+	void RebuildIntraCosts(uint32_t uCluster);
+	void RenumberNodes();
+	uint32_t GetNodePolygon(uint32_t uNode) const;
+
+	// Dijkstra from uSource over uCluster's unblocked polygons. Forward costs
+	// are what Zenith_Pathfinding charges to walk away from uSource; reverse
+	// costs are to walk from each polygon back to it.
+	void SearchCluster(uint32_t uCluster, uint32_t uSource, bool bReverse, Zenith_PathSearchContext& xSearch) const;
+
+	const Zenith_NavMesh* m_pxNavMesh = nullptr;
+	Zenith_NavMeshHierarchyConfig m_xConfig;
+	uint32_t m_uTopologyRevision = 0;
+	uint32_t m_uBlockedRevision = 0;
+
+	Zenith_Maths::Vector3 m_xOrigin{ 0.0f };
+	uint32_t m_uClustersX = 0;
+	uint32_t m_uClustersZ = 0;
+
+	Zenith_Vector<uint32_t> m_auPolygonCluster;
+	Zenith_Vector<Cluster> m_axClusters;
+	Zenith_Vector<ClusterPair> m_axPairs;
+	Zenith_Vector<uint32_t> m_auNodeCluster;      // global node id -> cluster
+
+	// Rebuild bookkeeping, stamped so marking is O(1) per rebuild.
+	Zenith_Vector<uint32_t> m_auClusterMark;
+	Zenith_Vector<uint32_t> m_auPairMark;
+	uint32_t m_uMark = 0;
+};
@@ -78,9 +78,16 @@ Zenith_NavMeshStats Zenith_NavMeshStats::Compute(const Zenith_NavMesh& xNavMesh)
 			++xStats.m_uBlockedPolygonCount;
 		}
 
+		// Index lists live inside the polygon unless they outgrew their inline room.
 		ulPolygonBytes += sizeof(Zenith_NavMeshPolygon);
-		ulPolygonBytes += static_cast<uint64_t>(xPoly.m_axVertexIndices.GetSize()) * sizeof(uint32_t);
-		ulPolygonBytes += static_cast<uint64_t>(xPoly.m_axNeighborIndices.GetSize()) * sizeof(int32_t);
+		if (!xPoly.m_axVertexIndices.IsInline())
+		{
+			ulPolygonBytes += static_cast<uint64_t>(xPoly.m_axVertexIndices.GetSize()) * sizeof(uint32_t);
+		}
+		if (!xPoly.m_axNeighborIndices.IsInline())
+		{
+			ulPolygonBytes += static_cast<uint64_t>(xPoly.m_axNeighborIndices.GetSize()) * sizeof(int32_t);
+		}
 	}
 
 	if (xStats.m_uPolygonCount > 0u)
@@ -89,7 +96,8 @@ Zenith_NavMeshStats Zenith_NavMeshStats::Compute(const Zenith_NavMesh& xNavMesh)
 	}
 
 	xStats.m_ulApproxMemoryBytes =
-		static_cast<uint64_t>(xStats.m_uVertexCount) * sizeof(Zenith_Maths::Vector3) + ulPolygonBytes;
+		static_cast<uint64_t>(xStats.m_uVertexCount) * sizeof(Zenith_Maths::Vector3) + ulPolygonBytes
+		+ xNavMesh.GetQueryLayoutBytes();
 
 	return xStats;
 }
@@ -44,9 +44,10 @@ struct Zenith_NavMeshStats
 	// Polygons carrying FLAG_BLOCKED (dynamic obstacles; skipped by FindPath).
 	u_int m_uBlockedPolygonCount = 0;
 
-	// Approximate heap footprint of the mesh's vertex/polygon storage. Indicative
-	// (it ignores the spatial grid and container slack), so treat it as an order
-	// of magnitude, not an allocator figure.
+	// Approximate heap footprint of the mesh's vertex/polygon storage plus its
+	// derived query structures (search layout, bounds, spatial grid). Indicative
+	// (it ignores container slack), so treat it as an order of magnitude, not an
+	// allocator figure.
 	uint64_t m_ulApproxMemoryBytes = 0;
 
 	/**
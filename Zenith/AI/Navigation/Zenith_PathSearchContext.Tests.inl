@@ -0,0 +1,161 @@
+#include "UnitTests/Zenith_UnitTests.h"
+#include "AI/Navigation/Zenith_PathSearchContext.h"
+#include "AI/Navigation/Zenith_Pathfinding.h"
+
+// Unit tests for the reusable A* working set. The heap and generation tests use
+// a private context; the steady-state test goes through FindPath and so uses the
+// calling thread's shared one.
+
+namespace
+{
+	// uSize x uSize unit quads on y = 0, sharing vertex indices so
+	// ComputeAdjacency links them.
+	void BuildPathSearchGrid(Zenith_NavMesh& xNavMesh, uint32_t uSize)
+	{
+		for (uint32_t uZ = 0; uZ <= uSize; uZ++)
+		{
+			for (uint32_t uX = 0; uX <= uSize; uX++)
+			{
+				xNavMesh.AddVertex(Zenith_Maths::Vector3(static_cast<float>(uX), 0.0f, static_cast<float>(uZ)));
+			}
+		}
+		for (uint32_t uZ = 0; uZ < uSize; uZ++)
+		{
+			for (uint32_t uX = 0; uX < uSize; uX++)
+			{
+				const uint32_t uCorner = uZ * (uSize + 1) + uX;
+				Zenith_Vector<uint32_t> axQuad;
+				axQuad.PushBack(uCorner);
+				axQuad.PushBack(uCorner + 1);
+				axQuad.PushBack(uCorner + uSize + 2);
+				axQuad.PushBack(uCorner + uSize + 1);
+				xNavMesh.AddPolygon(axQuad);
+			}
+		}
+		xNavMesh.ComputeAdjacency();
+		xNavMesh.BuildSpatialGrid();
+	}
+}
+
+ZENITH_TEST(AI, PathSearchContextHeapOrdersWithDecreaseKey)
+{
+	Zenith_PathSearchContext xSearch;
+	xSearch.Begin(16);
+
+	// Enough entries for three heap levels, inserted out of order.
+	const float afCosts[] = { 9.0f, 3.0f, 14.0f, 7.0f, 1.0f, 12.0f, 5.0f, 11.0f, 2.0f, 8.0f, 13.0f, 6.0f };
+	const uint32_t uCount = sizeof(afCosts) / sizeof(afCosts[0]);
+	for (uint32_t u = 0; u < uCount; u++)
+	{
+		ZENITH_ASSERT_TRUE(xSearch.OpenOrImprove(u, Zenith_PathSearchContext::uNO_PARENT, afCosts[u], 0.0f));
+	}
+
+	// Polygon 2 (cost 14) drops to 0.5 and must now come out first.
+	ZENITH_ASSERT_FALSE(xSearch.OpenOrImprove(2, 0, 20.0f, 0.0f), "a worse cost is not an improvement");
+	ZENITH_ASSERT_TRUE(xSearch.OpenOrImprove(2, 4, 0.5f, 0.0f));
+	ZENITH_ASSERT_EQ(xSearch.GetNode(2).m_uParent, 4u, "decrease-key takes the new parent");
+
+	ZENITH_ASSERT_EQ(xSearch.PopCheapest(), 2u);
+	ZENITH_ASSERT_TRUE(xSearch.IsClosed(2));
+	ZENITH_ASSERT_FALSE(xSearch.OpenOrImprove(2, 0, 0.1f, 0.0f), "closed nodes are never reopened");
+
+	float fLast = 0.5f;
+	uint32_t uPopped = 1;
+	while (xSearch.HasOpen())
+	{
+		const uint32_t uPolygon = xSearch.PopCheapest();
+		ZENITH_ASSERT_GE(xSearch.GetNode(uPolygon).m_fFCost, fLast, "pop order must be non-decreasing in F");
+		fLast = xSearch.GetNode(uPolygon).m_fFCost;
+		uPopped++;
+	}
+	ZENITH_ASSERT_EQ(uPopped, uCount, "each polygon is popped exactly once");
+	ZENITH_ASSERT_EQ(xSearch.GetExpandedCount(), uCount);
+	ZENITH_ASSERT_FALSE(xSearch.IsVisited(15), "never-opened polygons stay unvisited");
+}
+
+ZENITH_TEST(AI, PathSearchContextGenerationsIsolateQueries)
+{
+	Zenith_PathSearchContext xSearch;
+	xSearch.Begin(8);
+	xSearch.OpenOrImprove(0, Zenith_PathSearchContext::uNO_PARENT, 0.0f, 5.0f);
+	xSearch.OpenOrImprove(3, 0, 1.0f, 4.0f);
+	xSearch.PopCheapest();
+	const uint32_t uFirstGeneration = xSearch.GetGeneration();
+
+	// A smaller mesh next: no node from the last query may leak through.
+	xSearch.Begin(4);
+	ZENITH_ASSERT_EQ(xSearch.GetGeneration(), uFirstGeneration + 1);
+	ZENITH_ASSERT_FALSE(xSearch.HasOpen(), "Begin empties the open list");
+	ZENITH_ASSERT_EQ(xSearch.GetExpandedCount(), 0u);
+	for (uint32_t u = 0; u < 8; u++)
+	{
+		ZENITH_ASSERT_FALSE(xSearch.IsVisited(u), "polygon %u is stale from the previous query", u);
+	}
+	const uint32_t uNodeCapacity = xSearch.GetNodeCapacity();
+
+	// Reopening a previously closed polygon works in the new query.
+	ZENITH_ASSERT_TRUE(xSearch.OpenOrImprove(0, Zenith_PathSearchContext::uNO_PARENT, 0.0f, 1.0f));
+	ZENITH_ASSERT_EQ(xSearch.PopCheapest(), 0u);
+
+	// A larger mesh grows the pool, and the new tail starts unvisited too.
+	xSearch.Begin(64);
+	ZENITH_ASSERT_GE(xSearch.GetNodeCapacity(), 64u);
+	ZENITH_ASSERT_GE(xSearch.GetNodeCapacity(), uNodeCapacity);
+	for (uint32_t u = 0; u < 64; u++)
+	{
+		ZENITH_ASSERT_FALSE(xSearch.IsVisited(u));
+	}
+
+	// The scratch path follows parents back to the start.
+	xSearch.OpenOrImprove(10, Zenith_PathSearchContext::uNO_PARENT, 0.0f, 0.0f);
+	xSearch.OpenOrImprove(11, 10, 1.0f, 0.0f);
+	xSearch.OpenOrImprove(12, 11, 2.0f, 0.0f);
+	const Zenith_Vector<uint32_t>& axPath = xSearch.BuildPolygonPath(12);
+	ZENITH_ASSERT_EQ(axPath.GetSize(), 3u);
+	ZENITH_ASSERT_EQ(axPath.Get(0), 10u);
+	ZENITH_ASSERT_EQ(axPath.Get(2), 12u);
+}
+
+ZENITH_TEST(AI, PathfindingSteadyStateReusesCapacity)
+{
+	Zenith_NavMesh xNavMesh;
+	BuildPathSearchGrid(xNavMesh, 16);
+	// Wall down x = 8 with one gap at z = 15, so paths are long and not straight.
+	for (uint32_t uZ = 0; uZ < 15; uZ++)
+	{
+		xNavMesh.SetPolygonBlocked(uZ * 16 + 8, true);
+	}
+
+	const Zenith_Maths::Vector3 xStart(0.5f, 0.0f, 0.5f);
+	const Zenith_Maths::Vector3 xEnd(15.5f, 0.0f, 0.5f);
+
+	Zenith_PathResult xResult;
+	Zenith_Pathfinding::FindPath(xNavMesh, xStart, xEnd, xResult);
+	ZENITH_ASSERT_EQ(xResult.m_eStatus, Zenith_PathResult::Status::SUCCESS);
+	const float fDistance = xResult.m_fTotalDistance;
+	ZENITH_ASSERT_GT(fDistance, 28.0f, "the path must detour up through the gap and back");
+
+	const Zenith_PathSearchContext& xSearch = Zenith_PathSearchContext::GetForThisThread();
+	const uint32_t uNodeCapacity = xSearch.GetNodeCapacity();
+	const uint32_t uHeapCapacity = xSearch.GetHeapCapacity();
+	const uint32_t uWaypointCapacity = xResult.m_axWaypoints.GetCapacity();
+
+	for (uint32_t u = 0; u < 32; u++)
+	{
+		Zenith_Pathfinding::FindPath(xNavMesh, xStart, xEnd, xResult);
+		ZENITH_ASSERT_EQ(xResult.m_eStatus, Zenith_PathResult::Status::SUCCESS);
+		ZENITH_ASSERT_EQ_FLOAT(xResult.m_fTotalDistance, fDistance, 1e-4f, "query %u differs from the first", u);
+	}
+	ZENITH_ASSERT_EQ(xSearch.GetNodeCapacity(), uNodeCapacity, "steady-state queries must not grow the node pool");
+	ZENITH_ASSERT_EQ(xSearch.GetHeapCapacity(), uHeapCapacity, "steady-state queries must not grow the open heap");
+	ZENITH_ASSERT_EQ(xResult.m_axWaypoints.GetCapacity(), uWaypointCapacity, "the in-place overload must reuse waypoint storage");
+
+	// The by-value overload and a FAILED query leave no trace on the next search.
+	const Zenith_PathResult xByValue = Zenith_Pathfinding::FindPath(xNavMesh, xStart, xEnd);
+	ZENITH_ASSERT_EQ_FLOAT(xByValue.m_fTotalDistance, fDistance, 1e-4f);
+	Zenith_Pathfinding::FindPath(xNavMesh, xStart, Zenith_Maths::Vector3(8.5f, 0.0f, 4.5f), xResult);
+	ZENITH_ASSERT_EQ(xResult.m_eStatus, Zenith_PathResult::Status::FAILED, "an endpoint on the wall is refused");
+	ZENITH_ASSERT_EQ(xResult.m_axWaypoints.GetSize(), 0u, "a reused result is cleared on failure");
+	Zenith_Pathfinding::FindPath(xNavMesh, xStart, xEnd, xResult);
+	ZENITH_ASSERT_EQ_FLOAT(xResult.m_fTotalDistance, fDistance, 1e-4f);
+}
@@ -0,0 +1,135 @@
+#include "Zenith.h"
+#include "AI/Navigation/Zenith_PathSearchContext.h"
+
+void Zenith_PathSearchContext::Begin(uint32_t uPolygonCount)
+{
+	if (uPolygonCount > m_axNodes.GetSize())
+	{
+		// New nodes carry generation 0, which no query ever uses.
+		m_axNodes.Resize(uPolygonCount, Node());
+	}
+
+	m_uGeneration++;
+	if (m_uGeneration == 0)
+	{
+		// Wrapped after 2^32 queries: stamps from 2^32 queries ago would read as
+		// current, so pay for one real clear.
+		for (uint32_t u = 0; u < m_axNodes.GetSize(); u++)
+		{
+			m_axNodes.Get(u).m_uGeneration = 0;
+		}
+		m_uGeneration = 1;
+	}
+
+	m_auHeap.Clear();
+	m_uExpanded = 0;
+}
+
+bool Zenith_PathSearchContext::OpenOrImprove(uint32_t uPolygon, uint32_t uParent, float fGCost, float fHCost)
+{
+	Zenith_Assert(uPolygon < m_axNodes.GetSize(), "PathSearchContext: polygon %u outside the pool (%u)", uPolygon, m_axNodes.GetSize());
+
+	Node& xNode = m_axNodes.Get(uPolygon);
+	if (xNode.m_uGeneration == m_uGeneration)
+	{
+		if (xNode.m_uHeapSlot == uCLOSED || fGCost >= xNode.m_fGCost) return false;
+
+		xNode.m_uParent = uParent;
+		xNode.m_fGCost = fGCost;
+		xNode.m_fHCost = fHCost;
+		xNode.m_fFCost = fGCost + fHCost;
+		SiftUp(xNode.m_uHeapSlot);
+		return true;
+	}
+
+	xNode.m_uGeneration = m_uGeneration;
+	xNode.m_uParent = uParent;
+	xNode.m_fGCost = fGCost;
+	xNode.m_fHCost = fHCost;
+	xNode.m_fFCost = fGCost + fHCost;
+	m_auHeap.PushBack(uPolygon);
+	xNode.m_uHeapSlot = m_auHeap.GetSize() - 1;
+	SiftUp(xNode.m_uHeapSlot);
+	return true;
+}
+
+uint32_t Zenith_PathSearchContext::PopCheapest()
+{
+	Zenith_Assert(HasOpen(), "PathSearchContext: PopCheapest on an empty open list");
+
+	const uint32_t uCheapest = m_auHeap.Get(0);
+	const uint32_t uLast = m_auHeap.Get(m_auHeap.GetSize() - 1);
+	m_auHeap.PopBack();
+	if (m_auHeap.GetSize() > 0)
+	{
+		Place(0, uLast);
+		SiftDown(0);
+	}
+
+	m_axNodes.Get(uCheapest).m_uHeapSlot = uCLOSED;
+	m_uExpanded++;
+	return uCheapest;
+}
+
+const Zenith_Vector<uint32_t>& Zenith_PathSearchContext::BuildPolygonPath(uint32_t uTerminal)
+{
+	m_auPolygonPath.Clear();
+	for (uint32_t uPolygon = uTerminal; uPolygon != uNO_PARENT; uPolygon = m_axNodes.Get(uPolygon).m_uParent)
+	{
+		Zenith_Assert(IsVisited(uPolygon), "PathSearchContext: parent chain reaches polygon %u from another query", uPolygon);
+		m_auPolygonPath.PushBack(uPolygon);
+	}
+	m_auPolygonPath.Reverse();
+	return m_auPolygonPath;
+}
+
+Zenith_PathSearchContext& Zenith_PathSearchContext::GetForThisThread()
+{
+	// Function-local so there is no namespace-scope non-trivial global; batch
+	// queries on task workers each get their own.
+	thread_local static Zenith_PathSearchContext tl_xContext;
+	return tl_xContext;
+}
+
+void Zenith_PathSearchContext::Place(uint32_t uSlot, uint32_t uPolygon)
+{
+	m_auHeap.Get(uSlot) = uPolygon;
+	m_axNodes.Get(uPolygon).m_uHeapSlot = uSlot;
+}
+
+void Zenith_PathSearchContext::SiftUp(uint32_t uSlot)
+{
+	const uint32_t uPolygon = m_auHeap.Get(uSlot);
+	while (uSlot > 0)
+	{
+		const uint32_t uParentSlot = (uSlot - 1) / uARITY;
+		const uint32_t uParentPolygon = m_auHeap.Get(uParentSlot);
+		if (!Less(uPolygon, uParentPolygon)) break;
+		Place(uSlot, uParentPolygon);
+		uSlot = uParentSlot;
+	}
+	Place(uSlot, uPolygon);
+}
+
+void Zenith_PathSearchContext::SiftDown(uint32_t uSlot)
+{
+	const uint32_t uPolygon = m_auHeap.Get(uSlot);
+	const uint32_t uSize = m_auHeap.GetSize();
+	for (;;)
+	{
+		const uint32_t uFirstChild = uSlot * uARITY + 1;
+		if (uFirstChild >= uSize) break;
+
+		uint32_t uBestSlot = uFirstChild;
+		const uint32_t uEndChild = uFirstChild + uARITY < uSize ? uFirstChild + uARITY : uSize;
+		for (uint32_t uChild = uFirstChild + 1; uChild < uEndChild; uChild++)
+		{
+			if (Less(m_auHeap.Get(uChild), m_auHeap.Get(uBestSlot))) uBestSlot = uChild;
+		}
+		if (!Less(m_auHeap.Get(uBestSlot), uPolygon)) break;
+
+		Place(uSlot, m_auHeap.Get(uBestSlot));
+		uSlot = uBestSlot;
+	}
+	Place(uSlot, uPolygon);
+}
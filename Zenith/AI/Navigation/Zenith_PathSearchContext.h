@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Collections/Zenith_Vector.h"
+
+//------------------------------------------------------------------------------
+// Zenith_PathSearchContext - reusable A* working set
+//------------------------------------------------------------------------------
+//
+// Everything one A* query needs besides the navmesh: a node per polygon, the
+// open list and a scratch polygon path. Zenith_Pathfinding keeps one per thread
+// (GetForThisThread), so after the first query on a mesh of a given size a
+// search allocates nothing.
+//
+// Node pool. Indexed directly by polygon, sized to the largest mesh this thread
+// has searched, never shrunk. A node belongs to the current query only when its
+// m_uGeneration matches; Begin() bumps the generation instead of clearing the
+// pool, so starting a query is O(1) however large the mesh.
+//
+// Open list. A 4-ary min-heap of polygon indices keyed on F = G + H. Each node
+// stores its heap slot, so lowering a cost sifts the existing entry up
+// (decrease-key) rather than pushing a duplicate. Four children per level
+// halves the depth of a binary heap and keeps siblings on one cache line.
+//
+// Not reentrant: a thread runs one search at a time through its context.
+//------------------------------------------------------------------------------
+class Zenith_PathSearchContext
+{
+public:
+	static constexpr uint32_t uNO_PARENT = UINT32_MAX;
+
+	struct Node
+	{
+		float m_fGCost = 0.0f;                 // cost from start
+		float m_fHCost = 0.0f;                 // heuristic to end
+		float m_fFCost = 0.0f;                 // heap key, G + H
+		uint32_t m_uParent = uNO_PARENT;       // parent polygon
+		uint32_t m_uHeapSlot = uCLOSED;        // index into the heap, or uCLOSED
+		uint32_t m_uGeneration = 0;            // owning query; stale when != current
+	};
+
+	// Start a query over a mesh of uPolygonCount polygons. Grows the node pool if
+	// needed and invalidates every node from the previous query.
+	void Begin(uint32_t uPolygonCount);
+
+	// True once uPolygon has been opened in this query (open or closed).
+	bool IsVisited(uint32_t uPolygon) const { return m_axNodes.Get(uPolygon).m_uGeneration == m_uGeneration; }
+	bool IsClosed(uint32_t uPolygon) const { return IsVisited(uPolygon) && m_axNodes.Get(uPolygon).m_uHeapSlot == uCLOSED; }
+	const Node& GetNode(uint32_t uPolygon) const { return m_axNodes.Get(uPolygon); }
+
+	// Open uPolygon, or lower its cost if it is already open with a higher G.
+	// Returns false (and changes nothing) when the node is closed or fGCost is
+	// not an improvement.
+	bool OpenOrImprove(uint32_t uPolygon, uint32_t uParent, float fGCost, float fHCost);
+
+	bool HasOpen() const { return m_auHeap.GetSize() > 0; }
+	// Remove the open node with the lowest F and close it.
+	uint32_t PopCheapest();
+
+	// Nodes closed since Begin() - the "nodes expanded" statistic.
+	uint32_t GetExpandedCount() const { return m_uExpanded; }
+
+	// Fill the scratch path with the polygons from the start to uTerminal, in
+	// order, and return it. Valid until the next BuildPolygonPath or Begin.
+	const Zenith_Vector<uint32_t>& BuildPolygonPath(uint32_t uTerminal);
+
+	// Capacity probes for the allocation tests.
+	uint32_t GetNodeCapacity() const { return m_axNodes.GetCapacity(); }
+	uint32_t GetHeapCapacity() const { return m_auHeap.GetCapacity(); }
+	uint32_t GetGeneration() const { return m_uGeneration; }
+
+	// The calling thread's context. Constructed on first use, destroyed at thread exit.
+	static Zenith_PathSearchContext& GetForThisThread();
+
+private:
+	static constexpr uint32_t uCLOSED = UINT32_MAX;
+	static constexpr uint32_t uARITY = 4;
+
+	bool Less(uint32_t uPolygonA, uint32_t uPolygonB) const
+	{
+		return m_axNodes.Get(uPolygonA).m_fFCost < m_axNodes.Get(uPolygonB).m_fFCost;
+	}
+	void Place(uint32_t uSlot, uint32_t uPolygon);
+	void SiftUp(uint32_t uSlot);
+	void SiftDown(uint32_t uSlot);
+
+	Zenith_Vector<Node> m_axNodes;
+	Zenith_Vector<uint32_t> m_auHeap;
+	Zenith_Vector<uint32_t> m_auPolygonPath;
+	uint32_t m_uGeneration = 0;
+	uint32_t m_uExpanded = 0;
+};
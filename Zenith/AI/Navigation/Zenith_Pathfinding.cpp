@@ -1,84 +1,49 @@
 #include "Zenith.h"
 #include "AI/Navigation/Zenith_Pathfinding.h"
 #include "AI/Navigation/Zenith_NavMesh.h"
+#include "AI/Navigation/Zenith_NavMeshHierarchy.h"
+#include "AI/Navigation/Zenith_PathSearchContext.h"
 #include "AI/Zenith_AIWorldHooks.h"
+#include "Profiling/Zenith_PerfCounters.h"
 #include "Profiling/Zenith_Profiling.h"
-#include "Collections/Zenith_HashMap.h"
-#include <queue>
-#include <algorithm>
 
 namespace
 {
-	// A* node for the priority queue. Lives at file scope (anonymous namespace)
-	// so file-scope helpers can take it directly without polluting the public
-	// header with <queue> / Zenith_HashMap.
-	struct AStarNode
-	{
-		uint32_t m_uPolygonIndex;
-		uint32_t m_uParentIndex;  // Index into the closed list, or UINT32_MAX for the start node.
-		float m_fGCost;           // Cost from start.
-		float m_fHCost;           // Heuristic to end.
-		float m_fFCost;           // Total cost (G + H).
-
-		bool operator>(const AStarNode& xOther) const
-		{
-			return m_fFCost > xOther.m_fFCost;
-		}
-	};
-
-	using AStarOpenSet = std::priority_queue<AStarNode, std::vector<AStarNode>, std::greater<AStarNode>>;
-
-	// Process one neighbour: skip if closed; compute edge/heuristic costs; add or
-	// update the open-set entry. Encapsulates the inner for-loop of FindPathInternal
-	// so the driver focuses on A* control flow rather than per-edge bookkeeping.
+	// Process one neighbour: skip if closed, blocked or outside the corridor;
+	// compute edge/heuristic costs; open it or lower its cost in the search
+	// context. Encapsulates the inner for-loop of SearchPolygons so the driver
+	// focuses on A* control flow rather than per-edge bookkeeping. Reads the
+	// navmesh's dense search layout, never the full polygon records.
 	void ExpandNeighbor(uint32_t uNeighbor,
-		const AStarNode& xCurrent,
-		uint32_t uCurrentClosedIndex,
+		uint32_t uCurrent,
 		const Zenith_NavMesh& xNavMesh,
 		const Zenith_Maths::Vector3& xCurrentCenter,
 		const Zenith_Maths::Vector3& xEndProjected,
-		AStarOpenSet& xOpenSet,
-		const Zenith_HashMap<uint32_t, bool>& xClosedSet,
-		Zenith_HashMap<uint32_t, float>& xOpenSetGCosts)
+		const Zenith_PathCorridor* pxCorridor,
+		Zenith_PathSearchContext& xSearch)
 	{
-		if (xClosedSet.Contains(uNeighbor)) return;
-
 		Zenith_Assert(uNeighbor < xNavMesh.GetPolygonCount(),
 			"Pathfinding: Neighbor index %u out of bounds", uNeighbor);
 
-		const Zenith_NavMeshPolygon& xNeighborPoly = xNavMesh.GetPolygon(uNeighbor);
+		if (xSearch.IsClosed(uNeighbor)) return;
+		if (pxCorridor != nullptr && !pxCorridor->Contains(uNeighbor)) return;
+
+		const Zenith_NavMesh::SearchNode& xNeighborPoly = xNavMesh.GetSearchNode(uNeighbor);
 
 		// Dynamic-obstacle gate: blocked polygons (closed doors, transient
-		// blockers) are invisible to A*. They are NOT added to the closed set
-		// either, so unblocking later via SetPolygonBlocked(false) makes the
-		// polygon available on the next path query without any rebuild.
+		// blockers) are invisible to A*. They are never opened either, so
+		// unblocking later via SetPolygonBlocked(false) makes the polygon
+		// available on the next path query without any rebuild.
 		if (xNeighborPoly.IsBlocked()) return;
 
 		float fEdgeCost = Zenith_Maths::Length(xNeighborPoly.m_xCenter - xCurrentCenter);
 		fEdgeCost *= xNeighborPoly.m_fCost;  // Apply area cost multiplier.
 
-		const float fNewGCost = xCurrent.m_fGCost + fEdgeCost;
-
-		float* pfOpen = xOpenSetGCosts.TryGet(uNeighbor);
-		if (pfOpen != nullptr)
-		{
-			if (fNewGCost >= *pfOpen) return;
-			*pfOpen = fNewGCost;
-		}
-		else
-		{
-			xOpenSetGCosts[uNeighbor] = fNewGCost;
-		}
+		const float fNewGCost = xSearch.GetNode(uCurrent).m_fGCost + fEdgeCost;
+		if (xSearch.IsVisited(uNeighbor) && fNewGCost >= xSearch.GetNode(uNeighbor).m_fGCost) return;
 
 		const float fHCost = Zenith_Maths::Length(xEndProjected - xNeighborPoly.m_xCenter);
-
-		AStarNode xNeighborNode;
-		xNeighborNode.m_uPolygonIndex = uNeighbor;
-		xNeighborNode.m_uParentIndex = uCurrentClosedIndex;
-		xNeighborNode.m_fGCost = fNewGCost;
-		xNeighborNode.m_fHCost = fHCost;
-		xNeighborNode.m_fFCost = fNewGCost + fHCost;
-		xOpenSet.push(xNeighborNode);
+		xSearch.OpenOrImprove(uNeighbor, uCurrent, fNewGCost, fHCost);
 	}
 
 	struct PathEndpoints
@@ -109,25 +74,73 @@ namespace
 		return true;
 	}
 
-	// Walk the closed-list parent chain from uTerminalIndex back to the start
-	// node and emit a forward-order polygon path.
-	Zenith_Vector<uint32_t> ReconstructPolygonPath(const Zenith_Vector<AStarNode>& axClosedList, uint32_t uTerminalIndex)
+	// A* from the start polygon towards the end polygon, optionally confined
+	// to a hierarchy corridor. Returns the end polygon when bReachedOut, else
+	// the expanded polygon closest to the end (the start polygon if none is
+	// closer). The polygon path is then read from xSearch.
+	uint32_t SearchPolygons(const Zenith_NavMesh& xNavMesh,
+		const PathEndpoints& xEndpoints,
+		const Zenith_PathCorridor* pxCorridor,
+		Zenith_PathSearchContext& xSearch,
+		bool& bReachedOut)
 	{
-		Zenith_Vector<uint32_t> axPolygonPath;
-		uint32_t uTraceIndex = uTerminalIndex;
-		while (uTraceIndex != UINT32_MAX)
+		bReachedOut = false;
+		xSearch.Begin(xNavMesh.GetPolygonCount());
+
+		const float fStartHCost = Zenith_Maths::Length(xEndpoints.m_xEndProjected - xEndpoints.m_xStartProjected);
+		xSearch.OpenOrImprove(xEndpoints.m_uStartPoly, Zenith_PathSearchContext::uNO_PARENT, 0.0f, fStartHCost);
+
+		uint32_t uBestPartialPoly = xEndpoints.m_uStartPoly;
+		float fBestPartialDist = fStartHCost;
+
+		while (xSearch.HasOpen())
 		{
-			axPolygonPath.PushBack(axClosedList.Get(uTraceIndex).m_uPolygonIndex);
-			uTraceIndex = axClosedList.Get(uTraceIndex).m_uParentIndex;
+			const uint32_t uCurrent = xSearch.PopCheapest();
+			const float fCurrentHCost = xSearch.GetNode(uCurrent).m_fHCost;
+
+			if (fCurrentHCost < fBestPartialDist)
+			{
+				fBestPartialDist = fCurrentHCost;
+				uBestPartialPoly = uCurrent;
+			}
+
+			if (uCurrent == xEndpoints.m_uEndPoly)
+			{
+				ZENITH_PERF_HISTOGRAM_RECORD("AI.PathNodesExpanded", xSearch.GetExpandedCount());
+				bReachedOut = true;
+				return uCurrent;
+			}
+
+			const Zenith_NavMesh::SearchNode& xNode = xNavMesh.GetSearchNode(uCurrent);
+			const Zenith_Maths::Vector3& xCurrentCenter = xNode.m_xCenter;
+
+			for (uint32_t u = 0; u < xNode.m_uNeighbourCount; ++u)
+			{
+				const int32_t iNeighbor = xNavMesh.GetSearchNeighbour(xNode, u);
+				if (iNeighbor < 0) continue;
+				ExpandNeighbor(static_cast<uint32_t>(iNeighbor), uCurrent,
+					xNavMesh, xCurrentCenter, xEndpoints.m_xEndProjected, pxCorridor, xSearch);
+			}
 		}
-		axPolygonPath.Reverse();
-		return axPolygonPath;
+
+		ZENITH_PERF_HISTOGRAM_RECORD("AI.PathNodesExpanded", xSearch.GetExpandedCount());
+		return uBestPartialPoly;
 	}
 }
 
 Zenith_PathResult Zenith_Pathfinding::FindPath(const Zenith_NavMesh& xNavMesh,
 	const Zenith_Maths::Vector3& xStart,
 	const Zenith_Maths::Vector3& xEnd)
+{
+	Zenith_PathResult xResult;
+	FindPath(xNavMesh, xStart, xEnd, xResult);
+	return xResult;
+}
+
+void Zenith_Pathfinding::FindPath(const Zenith_NavMesh& xNavMesh,
+	const Zenith_Maths::Vector3& xStart,
+	const Zenith_Maths::Vector3& xEnd,
+	Zenith_PathResult& xResultOut)
 {
 	Zenith_Profiling::ScopeZone xProfileScope(ZENITH_PROFILE_ZONE("AI Pathfinding"));
 #ifdef ZENITH_INPUT_SIMULATOR
@@ -138,7 +151,28 @@ Zenith_PathResult Zenith_Pathfinding::FindPath(const Zenith_NavMesh& xNavMesh,
 	// async-internal recompute path doesn't double-count.
 	Zenith_NavMesh::IncrementQueryCountForTest_Internal();
 #endif
-	return FindPathInternal(xNavMesh, xStart, xEnd);
+	FindPathInternal(xNavMesh, xStart, xEnd, xResultOut);
+}
+
+void Zenith_Pathfinding::FindPath(const Zenith_NavMeshHierarchy& xHierarchy,
+	const Zenith_Maths::Vector3& xStart,
+	const Zenith_Maths::Vector3& xEnd,
+	Zenith_PathResult& xResultOut)
+{
+	Zenith_Assert(xHierarchy.GetNavMesh() != nullptr, "Pathfinding: hierarchy has not been built");
+	if (xHierarchy.GetNavMesh() == nullptr)
+	{
+		xResultOut.m_eStatus = Zenith_PathResult::Status::FAILED;
+		xResultOut.m_axWaypoints.Clear();
+		xResultOut.m_fTotalDistance = 0.0f;
+		return;
+	}
+
+	Zenith_Profiling::ScopeZone xProfileScope(ZENITH_PROFILE_ZONE("AI Pathfinding"));
+#ifdef ZENITH_INPUT_SIMULATOR
+	Zenith_NavMesh::IncrementQueryCountForTest_Internal();
+#endif
+	FindPathInternal(*xHierarchy.GetNavMesh(), xStart, xEnd, xResultOut, &xHierarchy);
 }
 
 void Zenith_Pathfinding::BuildWaypointsFromPolygonPath(const Zenith_NavMesh& xNavMesh,
@@ -161,21 +195,27 @@ void Zenith_Pathfinding::BuildWaypointsFromPolygonPath(const Zenith_NavMesh& xNa
 }
 
 // Internal implementation without profiling (for batch processing)
-Zenith_PathResult Zenith_Pathfinding::FindPathInternal(const Zenith_NavMesh& xNavMesh,
+void Zenith_Pathfinding::FindPathInternal(const Zenith_NavMesh& xNavMesh,
 	const Zenith_Maths::Vector3& xStart,
-	const Zenith_Maths::Vector3& xEnd)
+	const Zenith_Maths::Vector3& xEnd,
+	Zenith_PathResult& xResult,
+	const Zenith_NavMeshHierarchy* pxHierarchy)
 {
-	Zenith_PathResult xResult;
+	// Reset in place: Clear() keeps the waypoint capacity for the next query.
 	xResult.m_eStatus = Zenith_PathResult::Status::FAILED;
+	xResult.m_axWaypoints.Clear();
+	xResult.m_fTotalDistance = 0.0f;
+	// Counted here rather than in FindPath so batch and async queries show up too.
+	ZENITH_PERF_COUNTER_ADD("AI.PathQueries", 1);
 
 	if (xNavMesh.GetPolygonCount() == 0)
 	{
 		Zenith_Log(LOG_CATEGORY_AI, "Pathfinding: NavMesh has 0 polygons");
-		return xResult;
+		return;
 	}
 
 	PathEndpoints xEndpoints;
-	if (!LocaliseEndpoints(xNavMesh, xStart, xEnd, xEndpoints)) return xResult;
+	if (!LocaliseEndpoints(xNavMesh, xStart, xEnd, xEndpoints)) return;
 
 	// Dynamic-obstacle gate at the endpoint level. ExpandNeighbor already
 	// skips FLAG_BLOCKED polygons during A* traversal, but that gate fires
@@ -193,7 +233,7 @@ Zenith_PathResult Zenith_Pathfinding::FindPathInternal(const Zenith_NavMesh& xNa
 			"Pathfinding: endpoint inside blocked polygon (startPoly=%u blocked=%d, endPoly=%u blocked=%d)",
 			xEndpoints.m_uStartPoly, xNavMesh.GetPolygon(xEndpoints.m_uStartPoly).IsBlocked() ? 1 : 0,
 			xEndpoints.m_uEndPoly,   xNavMesh.GetPolygon(xEndpoints.m_uEndPoly).IsBlocked() ? 1 : 0);
-		return xResult;
+		return;
 	}
 
 	// Same polygon — direct path, no A* required.
@@ -203,89 +243,83 @@ Zenith_PathResult Zenith_Pathfinding::FindPathInternal(const Zenith_NavMesh& xNa
 		xResult.m_axWaypoints.PushBack(xEndpoints.m_xStartProjected);
 		xResult.m_axWaypoints.PushBack(xEndpoints.m_xEndProjected);
 		xResult.m_fTotalDistance = Zenith_Maths::Length(xEndpoints.m_xEndProjected - xEndpoints.m_xStartProjected);
-		return xResult;
+		return;
 	}
 
-	AStarOpenSet xOpenSet;
-	Zenith_HashMap<uint32_t, bool> xClosedSet;
-	Zenith_HashMap<uint32_t, float> xOpenSetGCosts;  // Best g-cost seen for nodes still in the open set.
-	Zenith_Vector<AStarNode> axClosedList;
-
-	AStarNode xStartNode;
-	xStartNode.m_uPolygonIndex = xEndpoints.m_uStartPoly;
-	xStartNode.m_uParentIndex = UINT32_MAX;
-	xStartNode.m_fGCost = 0.0f;
-	xStartNode.m_fHCost = Zenith_Maths::Length(xEndpoints.m_xEndProjected - xEndpoints.m_xStartProjected);
-	xStartNode.m_fFCost = xStartNode.m_fGCost + xStartNode.m_fHCost;
-	xOpenSet.push(xStartNode);
-	xOpenSetGCosts[xEndpoints.m_uStartPoly] = 0.0f;
-
-	uint32_t uBestPartialPoly = xEndpoints.m_uStartPoly;
-	uint32_t uBestPartialClosedIndex = 0;
-	float fBestPartialDist = xStartNode.m_fHCost;
-
-	while (!xOpenSet.empty())
+	// Per-thread and reused: after the first query on a mesh this size, the
+	// search itself allocates nothing.
+	Zenith_PathSearchContext& xSearch = Zenith_PathSearchContext::GetForThisThread();
+	bool bReached = false;
+	uint32_t uTerminal = xEndpoints.m_uStartPoly;
+
+	// With a hierarchy, refine inside the abstract corridor first. Anything
+	// short of the goal reruns unrestricted, so FAILED / PARTIAL results are
+	// exactly the plain search's.
+	Zenith_PathCorridor xCorridor;
+	if (pxHierarchy != nullptr && pxHierarchy->IsBuiltFor(xNavMesh) &&
+		pxHierarchy->FindCorridor(xEndpoints.m_uStartPoly, xEndpoints.m_xStartProjected,
+			xEndpoints.m_uEndPoly, xEndpoints.m_xEndProjected, xCorridor))
 	{
-		AStarNode xCurrent = xOpenSet.top();
-		xOpenSet.pop();
-
-		if (xClosedSet.Contains(xCurrent.m_uPolygonIndex)) continue;
-
-		const uint32_t uCurrentClosedIndex = axClosedList.GetSize();
-		axClosedList.PushBack(xCurrent);
-		xClosedSet.Insert(xCurrent.m_uPolygonIndex, true);
-
-		if (xCurrent.m_fHCost < fBestPartialDist)
-		{
-			fBestPartialDist = xCurrent.m_fHCost;
-			uBestPartialPoly = xCurrent.m_uPolygonIndex;
-			uBestPartialClosedIndex = uCurrentClosedIndex;
-		}
-
-		if (xCurrent.m_uPolygonIndex == xEndpoints.m_uEndPoly)
-		{
-			xResult.m_eStatus = Zenith_PathResult::Status::SUCCESS;
-			BuildWaypointsFromPolygonPath(xNavMesh,
-				ReconstructPolygonPath(axClosedList, uCurrentClosedIndex),
-				xEndpoints.m_xStartProjected, xEndpoints.m_xEndProjected, xResult);
-			return xResult;
-		}
-
-		Zenith_Assert(xCurrent.m_uPolygonIndex < xNavMesh.GetPolygonCount(),
-			"Pathfinding: Polygon index %u out of bounds (count=%u)",
-			xCurrent.m_uPolygonIndex, xNavMesh.GetPolygonCount());
-		if (xCurrent.m_uPolygonIndex >= xNavMesh.GetPolygonCount())
-		{
-			continue;  // Skip invalid polygon in release builds.
-		}
-
-		const Zenith_NavMeshPolygon& xPoly = xNavMesh.GetPolygon(xCurrent.m_uPolygonIndex);
-		const Zenith_Maths::Vector3& xCurrentCenter = xPoly.m_xCenter;
+		uTerminal = SearchPolygons(xNavMesh, xEndpoints, &xCorridor, xSearch, bReached);
+	}
+	if (!bReached)
+	{
+		uTerminal = SearchPolygons(xNavMesh, xEndpoints, nullptr, xSearch, bReached);
+	}
 
-		for (uint32_t u = 0; u < xPoly.m_axNeighborIndices.GetSize(); ++u)
-		{
-			const int32_t iNeighbor = xPoly.m_axNeighborIndices.Get(u);
-			if (iNeighbor < 0) continue;
-			ExpandNeighbor(static_cast<uint32_t>(iNeighbor), xCurrent, uCurrentClosedIndex,
-				xNavMesh, xCurrentCenter, xEndpoints.m_xEndProjected,
-				xOpenSet, xClosedSet, xOpenSetGCosts);
-		}
+	if (bReached)
+	{
+		xResult.m_eStatus = Zenith_PathResult::Status::SUCCESS;
+		BuildWaypointsFromPolygonPath(xNavMesh, xSearch.BuildPolygonPath(uTerminal),
+			xEndpoints.m_xStartProjected, xEndpoints.m_xEndProjected, xResult);
+		return;
 	}
 
 	// No complete path — emit partial path to the closest node we expanded.
-	if (uBestPartialPoly == xEndpoints.m_uStartPoly) return xResult;
+	if (uTerminal == xEndpoints.m_uStartPoly) return;
 
 	xResult.m_eStatus = Zenith_PathResult::Status::PARTIAL;
-	const Zenith_NavMeshPolygon& xFinalPoly = xNavMesh.GetPolygon(uBestPartialPoly);
-	BuildWaypointsFromPolygonPath(xNavMesh,
-		ReconstructPolygonPath(axClosedList, uBestPartialClosedIndex),
+	const Zenith_NavMeshPolygon& xFinalPoly = xNavMesh.GetPolygon(uTerminal);
+	BuildWaypointsFromPolygonPath(xNavMesh, xSearch.BuildPolygonPath(uTerminal),
 		xEndpoints.m_xStartProjected, xFinalPoly.m_xCenter, xResult);
-
-	return xResult;
 }
 
 namespace
 {
+	// Sample count for a line-of-sight probe. The fixed count spreads out
+	// with the segment length -- a 47 m shortcut sampled 12 times steps ~4 m
+	// and walks straight over a 1 m blocked wall -- so a dense probe also
+	// keeps samples at most fMAX_SPACING apart. Dense probes are only run on
+	// the shortcut SmoothPath finally keeps, not on every candidate.
+	int SegmentSampleCount(const Zenith_Maths::Vector3& xA, const Zenith_Maths::Vector3& xB, int iFixedSamples, bool bDense)
+	{
+		if (!bDense)
+		{
+			return iFixedSamples;
+		}
+		constexpr float fMAX_SPACING = 0.25f;
+		const int iBySpacing = static_cast<int>(std::ceil(Zenith_Maths::Length(xB - xA) / fMAX_SPACING));
+		return std::max(iFixedSamples, iBySpacing);
+	}
+
+	// FindPolygonContaining, trying the previous sample's polygon first.
+	// Densely spaced samples mostly land in the polygon the last one did,
+	// and one containment test is far cheaper than scanning a grid cell.
+	uint32_t FindSamplePolygon(const Zenith_NavMesh& xNavMesh, const Zenith_Maths::Vector3& xPoint,
+		float fMaxVerticalDist, uint32_t uPrevious)
+	{
+		if (uPrevious != UINT32_MAX)
+		{
+			const Zenith_NavMeshPolygon& xPoly = xNavMesh.GetPolygon(uPrevious);
+			if (std::abs(Zenith_Maths::Dot(xPoint - xPoly.m_xCenter, xPoly.m_xNormal)) <= fMaxVerticalDist &&
+				xPoly.ContainsPoint(xPoint, xNavMesh.GetVertices()))
+			{
+				return uPrevious;
+			}
+		}
+		return xNavMesh.FindPolygonContaining(xPoint, fMaxVerticalDist);
+	}
+
 	// Walks a line segment in `kSamples` steps and returns true if any
 	// sampled point lies inside a polygon flagged FLAG_BLOCKED. Used by
 	// SmoothPath to refuse a shortcut that would slice through a closed
@@ -296,16 +330,19 @@ namespace
 	// around.
 	//
 	// 12 samples gives sub-metre spacing for typical 5–10 m shortcut
-	// candidates without measurably impacting per-path planning cost.
+	// candidates without measurably impacting per-path planning cost;
+	// bDense samples longer segments more finely (see SegmentSampleCount)
+	// so a one-cell blocked strip can't fall between two samples.
 	bool SegmentCrossesBlockedPolygon(const Zenith_NavMesh& xNavMesh,
-		const Zenith_Maths::Vector3& xA, const Zenith_Maths::Vector3& xB)
+		const Zenith_Maths::Vector3& xA, const Zenith_Maths::Vector3& xB, bool bDense)
 	{
-		constexpr int kSamples = 12;
+		const int kSamples = SegmentSampleCount(xA, xB, 12, bDense);
+		uint32_t uPoly = UINT32_MAX;
 		for (int i = 1; i < kSamples; ++i)
 		{
 			const float fT = static_cast<float>(i) / static_cast<float>(kSamples);
 			const Zenith_Maths::Vector3 xP = xA + (xB - xA) * fT;
-			const uint32_t uPoly = xNavMesh.FindPolygonContaining(xP, /*fMaxVerticalDist=*/1.5f);
+			uPoly = FindSamplePolygon(xNavMesh, xP, /*fMaxVerticalDist=*/1.5f, uPoly);
 			if (uPoly == UINT32_MAX) continue;
 			if (xNavMesh.GetPolygon(uPoly).IsBlocked()) return true;
 		}
@@ -331,7 +368,9 @@ namespace
 	// (0.3m) so polygons at the WRONG vertical level don't mask the gap.
 	//
 	// Tuning notes:
-	//   * 24 samples gives ~0.25m spacing for a 6m shortcut. The wall test
+	//   * 24 samples gives ~0.25m spacing for a 6m shortcut; a dense
+	//     probe keeps that spacing on longer shortcuts rather than
+	//     spreading 24 samples thinner. The wall test
 	//     needs at least one sample inside the 0.6m-thick wall footprint;
 	//     0.25m spacing leaves ~0.35m of slack either side of the wall.
 	//   * Vertical tolerance = mean of endpoint Y ± kVERT_SLACK. Picking
@@ -341,15 +380,16 @@ namespace
 	//   * Sample indices 1..N-1 only (skip endpoints) -- endpoints are by
 	//     construction on the navmesh (A* placed them there).
 	bool SegmentExitsNavMesh(const Zenith_NavMesh& xNavMesh,
-		const Zenith_Maths::Vector3& xA, const Zenith_Maths::Vector3& xB)
+		const Zenith_Maths::Vector3& xA, const Zenith_Maths::Vector3& xB, bool bDense)
 	{
-		constexpr int   kSamples    = 24;
+		const int       kSamples    = SegmentSampleCount(xA, xB, 24, bDense);
 		constexpr float kVERT_SLACK = 0.5f;  // half the default 1.0m floor-to-ceiling envelope
+		uint32_t uPoly = UINT32_MAX;
 		for (int i = 1; i < kSamples; ++i)
 		{
 			const float fT = static_cast<float>(i) / static_cast<float>(kSamples);
 			const Zenith_Maths::Vector3 xP = xA + (xB - xA) * fT;
-			const uint32_t uPoly = xNavMesh.FindPolygonContaining(xP, kVERT_SLACK);
+			uPoly = FindSamplePolygon(xNavMesh, xP, kVERT_SLACK, uPoly);
 			if (uPoly == UINT32_MAX) return true;
 		}
 		return false;
@@ -367,8 +407,10 @@ void Zenith_Pathfinding::SmoothPath(Zenith_Vector<Zenith_Maths::Vector3>& axPath
 	// Simple line-of-sight smoothing
 	// A full implementation would use the funnel algorithm
 
-	Zenith_Vector<Zenith_Maths::Vector3> axSmoothed;
-	axSmoothed.PushBack(axPath.Get(0));
+	// Compacted in place: kept waypoints are written to the front, and the
+	// write cursor never passes uCurrent, so nothing is read after being
+	// overwritten and no second buffer is allocated.
+	uint32_t uWrite = 1;
 
 	uint32_t uCurrent = 0;
 	while (uCurrent < axPath.GetSize() - 1)
@@ -389,14 +431,14 @@ void Zenith_Pathfinding::SmoothPath(Zenith_Vector<Zenith_Maths::Vector3>& axPath
 			// cut through it.
 			const bool bBlockedByObstacle =
 				SegmentCrossesBlockedPolygon(xNavMesh,
-					axPath.Get(uCurrent), axPath.Get(u));
+					axPath.Get(uCurrent), axPath.Get(u), false);
 			// Static-geometry gate — see SegmentExitsNavMesh above. The
 			// geometric Raycast also misses HOLES in the navmesh (carved
 			// cells under a wall), so without this check the smoother
 			// shortcuts across walls.
 			const bool bExitsNavMesh =
 				SegmentExitsNavMesh(xNavMesh,
-					axPath.Get(uCurrent), axPath.Get(u));
+					axPath.Get(uCurrent), axPath.Get(u), false);
 			if (!bRaycastBlocked && !bBlockedByObstacle && !bExitsNavMesh)
 			{
 				// Path is geometrically clear, doesn't cross a blocked
@@ -413,11 +455,25 @@ void Zenith_Pathfinding::SmoothPath(Zenith_Vector<Zenith_Maths::Vector3>& axPath
 			}
 		}
 
+		// The candidate probes use a fixed sample count, which a long
+		// shortcut can step straight over a thin blocker with. Re-probe the
+		// kept shortcut densely, backing off a waypoint at a time until it
+		// holds; the next waypoint along the A* route always does.
+		while (uFurthest > uCurrent + 1 &&
+			(SegmentCrossesBlockedPolygon(xNavMesh, axPath.Get(uCurrent), axPath.Get(uFurthest), true) ||
+				SegmentExitsNavMesh(xNavMesh, axPath.Get(uCurrent), axPath.Get(uFurthest), true)))
+		{
+			--uFurthest;
+		}
+
 		uCurrent = uFurthest;
-		axSmoothed.PushBack(axPath.Get(uCurrent));
+		axPath.Get(uWrite++) = axPath.Get(uCurrent);
 	}
 
-	axPath = std::move(axSmoothed);
+	while (axPath.GetSize() > uWrite)
+	{
+		axPath.PopBack();
+	}
 }
 
 float Zenith_Pathfinding::CalculatePathDistance(const Zenith_Vector<Zenith_Maths::Vector3>& axPath)
@@ -480,7 +536,7 @@ void Zenith_Pathfinding::PathfindingTaskFunc(void* pData, u_int uInvocationIndex
 
 	if (xRequest.m_pxNavMesh != nullptr)
 	{
-		xRequest.m_xResult = FindPathInternal(*xRequest.m_pxNavMesh, xRequest.m_xStart, xRequest.m_xEnd);
+		FindPathInternal(*xRequest.m_pxNavMesh, xRequest.m_xStart, xRequest.m_xEnd, xRequest.m_xResult, xRequest.m_pxHierarchy);
 	}
 	else
 	{
@@ -501,10 +557,12 @@ void Zenith_Pathfinding::FindPathsBatch(PathRequest* pxRequests, uint32_t uNumRe
 		Zenith_Profiling::ScopeZone xProfileScope(ZENITH_PROFILE_ZONE("AI Pathfinding"));
 		if (pxRequests[0].m_pxNavMesh != nullptr)
 		{
-			pxRequests[0].m_xResult = FindPathInternal(
+			FindPathInternal(
 				*pxRequests[0].m_pxNavMesh,
 				pxRequests[0].m_xStart,
-				pxRequests[0].m_xEnd);
+				pxRequests[0].m_xEnd,
+				pxRequests[0].m_xResult,
+				pxRequests[0].m_pxHierarchy);
 		}
 		else
 		{
@@ -4,6 +4,7 @@
 #include "Maths/Zenith_Maths.h"
 
 class Zenith_NavMesh;
+class Zenith_NavMeshHierarchy;
 
 /**
  * Zenith_PathResult - Result of a pathfinding query
@@ -42,6 +43,30 @@ public:
 		const Zenith_Maths::Vector3& xStart,
 		const Zenith_Maths::Vector3& xEnd);
 
+	/**
+	 * Find a path into an existing result. The result's waypoint capacity is
+	 * reused, so a caller that keeps one result across queries (and the
+	 * per-thread search context, see Zenith_PathSearchContext) makes no heap
+	 * allocation once both have grown to the largest path seen.
+	 */
+	static void FindPath(const Zenith_NavMesh& xNavMesh,
+		const Zenith_Maths::Vector3& xStart,
+		const Zenith_Maths::Vector3& xEnd,
+		Zenith_PathResult& xResultOut);
+
+	/**
+	 * Find a path on xHierarchy's navmesh, searching its cluster graph first and
+	 * then refining only through the clusters that abstract path visits. Falls
+	 * back to the plain search when the hierarchy is stale or the corridor
+	 * yields no complete path, so SUCCESS / FAILED match FindPath; a SUCCESS
+	 * path may be slightly longer (see Zenith_NavMeshHierarchyConfig).
+	 * Call xHierarchy.Refresh() after blocking polygons to keep it sharp.
+	 */
+	static void FindPath(const Zenith_NavMeshHierarchy& xHierarchy,
+		const Zenith_Maths::Vector3& xStart,
+		const Zenith_Maths::Vector3& xEnd,
+		Zenith_PathResult& xResultOut);
+
 	/**
 	 * Smooth a path using string-pulling (funnel algorithm)
 	 * @param axPath Path to smooth (modified in place)
@@ -56,9 +81,8 @@ public:
 	static float CalculatePathDistance(const Zenith_Vector<Zenith_Maths::Vector3>& axPath);
 
 private:
-	// AStarNode lives in an anonymous namespace in Zenith_Pathfinding.cpp so the
-	// file-scope expand-neighbour helper can take it without leaking <queue> /
-	// <unordered_set> / <unordered_map> into this header.
+	// The A* working set (node pool, open heap) is Zenith_PathSearchContext,
+	// one per thread; only Zenith_Pathfinding.cpp includes it.
 
 	// Get midpoint of shared edge between two polygons
 	static Zenith_Maths::Vector3 GetPortalMidpoint(const Zenith_NavMesh& xNavMesh,
@@ -91,22 +115,28 @@ public:
 		const Zenith_NavMesh* m_pxNavMesh = nullptr;
 		Zenith_Maths::Vector3 m_xStart;
 		Zenith_Maths::Vector3 m_xEnd;
+		// Optional; when built for m_pxNavMesh the request runs hierarchically.
+		const Zenith_NavMeshHierarchy* m_pxHierarchy = nullptr;
 		Zenith_PathResult m_xResult;  // Output - filled by FindPathsBatch
 	};
 
 	/**
 	 * Find multiple paths in parallel using Zenith_DataParallelTask
 	 * Blocks until all paths are computed
-	 * @param pxRequests Array of path requests (results written to m_xResult)
+	 * @param pxRequests Array of path requests (results written to m_xResult in
+	 *        place, reusing its waypoint capacity)
 	 * @param uNumRequests Number of requests in array
 	 */
 	static void FindPathsBatch(PathRequest* pxRequests, uint32_t uNumRequests);
 
 private:
-	// Internal pathfinding without profiling (for batch processing)
-	static Zenith_PathResult FindPathInternal(const Zenith_NavMesh& xNavMesh,
+	// Internal pathfinding without profiling (for batch processing). Overwrites
+	// xResult; the search runs in the calling thread's Zenith_PathSearchContext.
+	static void FindPathInternal(const Zenith_NavMesh& xNavMesh,
 		const Zenith_Maths::Vector3& xStart,
-		const Zenith_Maths::Vector3& xEnd);
+		const Zenith_Maths::Vector3& xEnd,
+		Zenith_PathResult& xResult,
+		const Zenith_NavMeshHierarchy* pxHierarchy = nullptr);
 
 	// Zenith_DataParallelTaskFunction for parallel pathfinding
 	static void PathfindingTaskFunc(void* pData, u_int uInvocationIndex, u_int uNumInvocations);
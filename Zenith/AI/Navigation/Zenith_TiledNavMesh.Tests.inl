@@ -0,0 +1,325 @@
+#include "UnitTests/Zenith_UnitTests.h"
+#include "AI/Navigation/Zenith_TiledNavMesh.h"
+#include "AI/Navigation/Zenith_Pathfinding.h"
+#include "DataStream/Zenith_DataStream.h"
+#include <cstring>
+
+// Unit tests for the tiled navmesh: a tiled bake must produce the same cells
+// as the single-grid bake, seams must be walkable, and a partial rebuild must
+// land exactly where a full rebuild of the changed scene would.
+
+namespace
+{
+	// 0.5 m cells in 8-cell tiles keep a 16 m ground plane at 5 x 5 tiles.
+	NavMeshGenerationConfig TiledNavMeshTestConfig()
+	{
+		NavMeshGenerationConfig xConfig;
+		xConfig.m_fCellSize = 0.5f;
+		xConfig.m_uTileSizeCells = 8;
+		xConfig.m_uTileBorderCells = 2;
+		return xConfig;
+	}
+
+	// Upward-facing quad over [xMin, xMax] in XZ at height fY.
+	void TiledNavMeshAddQuad(Zenith_Vector<Zenith_Maths::Vector3>& axVertices, Zenith_Vector<uint32_t>& auIndices,
+		float fMinX, float fMinZ, float fMaxX, float fMaxZ, float fY)
+	{
+		const uint32_t uV0 = axVertices.GetSize();
+		axVertices.PushBack(Zenith_Maths::Vector3(fMinX, fY, fMinZ));
+		axVertices.PushBack(Zenith_Maths::Vector3(fMaxX, fY, fMinZ));
+		axVertices.PushBack(Zenith_Maths::Vector3(fMinX, fY, fMaxZ));
+		axVertices.PushBack(Zenith_Maths::Vector3(fMaxX, fY, fMaxZ));
+
+		// CCW seen from above (Navigation/CLAUDE.md winding rule).
+		auIndices.PushBack(uV0); auIndices.PushBack(uV0 + 2u); auIndices.PushBack(uV0 + 3u);
+		auIndices.PushBack(uV0); auIndices.PushBack(uV0 + 3u); auIndices.PushBack(uV0 + 1u);
+	}
+
+	// Sum of the polygon center heights in one tile.
+	float TiledNavMeshTileHeightSum(const Zenith_TiledNavMesh& xTiled, uint32_t uTile)
+	{
+		const Zenith_NavMesh& xMesh = xTiled.GetNavMesh();
+		const uint32_t uFirst = xTiled.GetTileFirstPolygon(uTile);
+		float fSum = 0.0f;
+		for (uint32_t u = 0; u < xTiled.GetTilePolygonCount(uTile); ++u)
+		{
+			fSum += xMesh.GetPolygon(uFirst + u).m_xCenter.y;
+		}
+		return fSum;
+	}
+
+	// Polygon index -> (tile << 32 | index within the tile); ~0 for a vacant slot.
+	Zenith_Vector<uint64_t> TiledNavMeshSlotOwners(const Zenith_TiledNavMesh& xTiled)
+	{
+		Zenith_Vector<uint64_t> aulOwners;
+		aulOwners.Resize(xTiled.GetNavMesh().GetPolygonCount(), ~0ull);
+		for (uint32_t uTile = 0; uTile < xTiled.GetTileCount(); ++uTile)
+		{
+			for (uint32_t u = 0; u < xTiled.GetTilePolygonCount(uTile); ++u)
+			{
+				aulOwners.Get(xTiled.GetTileFirstPolygon(uTile) + u) = (static_cast<uint64_t>(uTile) << 32) | u;
+			}
+		}
+		return aulOwners;
+	}
+
+	// True when every tile of xA holds the same quads, linked the same way, as
+	// the same tile of xB, wherever each mesh keeps them.
+	bool TiledNavMeshSameTopology(const Zenith_TiledNavMesh& xA, const Zenith_TiledNavMesh& xB)
+	{
+		if (xA.GetTileCount() != xB.GetTileCount()) return false;
+		const Zenith_Vector<uint64_t> aulOwnersA = TiledNavMeshSlotOwners(xA);
+		const Zenith_Vector<uint64_t> aulOwnersB = TiledNavMeshSlotOwners(xB);
+		for (uint32_t uTile = 0; uTile < xA.GetTileCount(); ++uTile)
+		{
+			if (xA.GetTilePolygonCount(uTile) != xB.GetTilePolygonCount(uTile)) return false;
+			for (uint32_t u = 0; u < xA.GetTilePolygonCount(uTile); ++u)
+			{
+				const Zenith_NavMeshPolygon& xPolyA = xA.GetNavMesh().GetPolygon(xA.GetTileFirstPolygon(uTile) + u);
+				const Zenith_NavMeshPolygon& xPolyB = xB.GetNavMesh().GetPolygon(xB.GetTileFirstPolygon(uTile) + u);
+				if (xPolyA.m_xCenter != xPolyB.m_xCenter) return false;
+				for (uint32_t uEdge = 0; uEdge < 4; ++uEdge)
+				{
+					const int32_t iA = xPolyA.m_axNeighborIndices.Get(uEdge);
+					const int32_t iB = xPolyB.m_axNeighborIndices.Get(uEdge);
+					if ((iA < 0) != (iB < 0)) return false;
+					if (iA >= 0 && aulOwnersA.Get(static_cast<uint32_t>(iA)) != aulOwnersB.Get(static_cast<uint32_t>(iB))) return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// 16 x 16 m of 1 m ground quads at y = 0.
+	void TiledNavMeshBuildGround(Zenith_Vector<Zenith_Maths::Vector3>& axVertices, Zenith_Vector<uint32_t>& auIndices)
+	{
+		axVertices.Clear();
+		auIndices.Clear();
+		for (uint32_t uZ = 0; uZ < 16; ++uZ)
+		{
+			for (uint32_t uX = 0; uX < 16; ++uX)
+			{
+				TiledNavMeshAddQuad(axVertices, auIndices, static_cast<float>(uX), static_cast<float>(uZ),
+					static_cast<float>(uX + 1), static_cast<float>(uZ + 1), 0.0f);
+			}
+		}
+	}
+}
+
+ZENITH_TEST(AI, TiledNavMeshMatchesSingleGridBake)
+{
+	Zenith_Vector<Zenith_Maths::Vector3> axVertices;
+	Zenith_Vector<uint32_t> auIndices;
+	TiledNavMeshBuildGround(axVertices, auIndices);
+	// A low deck: the ground under it loses its clearance, the deck is walkable.
+	TiledNavMeshAddQuad(axVertices, auIndices, 5.0f, 5.0f, 9.0f, 9.0f, 1.0f);
+
+	const NavMeshGenerationConfig xConfig = TiledNavMeshTestConfig();
+	Zenith_TiledNavMesh xTiled;
+	ZENITH_ASSERT_TRUE(xTiled.Build(axVertices, auIndices, xConfig));
+	ZENITH_ASSERT_GT(xTiled.GetTileCount(), 4u, "the test scene must span several tiles");
+
+	Zenith_NavMesh* pxSingle = Zenith_NavMeshGenerator::GenerateFromGeometry(axVertices, auIndices, xConfig);
+	ZENITH_ASSERT_TRUE(pxSingle != nullptr);
+	ZENITH_ASSERT_EQ(xTiled.GetNavMesh().GetPolygonCount(), pxSingle->GetPolygonCount(),
+		"tiles emit exactly the single-grid cells, each once");
+	delete pxSingle;
+
+	// Corner to corner crosses every seam on the diagonal.
+	const Zenith_PathResult xPath = Zenith_Pathfinding::FindPath(xTiled.GetNavMesh(),
+		Zenith_Maths::Vector3(0.5f, 0.0f, 0.5f), Zenith_Maths::Vector3(15.5f, 0.0f, 15.5f));
+	ZENITH_ASSERT_TRUE(xPath.m_eStatus == Zenith_PathResult::Status::SUCCESS, "seams must be stitched");
+}
+
+ZENITH_TEST(AI, TiledNavMeshRebuildMatchesFullBuild)
+{
+	Zenith_Vector<Zenith_Maths::Vector3> axVertices;
+	Zenith_Vector<uint32_t> auIndices;
+	TiledNavMeshBuildGround(axVertices, auIndices);
+
+	const NavMeshGenerationConfig xConfig = TiledNavMeshTestConfig();
+	Zenith_TiledNavMesh xTiled;
+	ZENITH_ASSERT_TRUE(xTiled.Build(axVertices, auIndices, xConfig));
+	const Zenith_NavMesh* pxLive = &xTiled.GetNavMesh();
+	const uint32_t uTopology = xTiled.GetNavMesh().GetTopologyRevision();
+
+	// The deck replaces the ground cells under it one for one, so the tiles
+	// it touches keep their polygon counts; compare their heights instead.
+	Zenith_Vector<float> afHeightsBefore;
+	Zenith_Vector<uint32_t> auFirstBefore;
+	for (uint32_t uTile = 0; uTile < xTiled.GetTileCount(); ++uTile)
+	{
+		afHeightsBefore.PushBack(TiledNavMeshTileHeightSum(xTiled, uTile));
+		auFirstBefore.PushBack(xTiled.GetTileFirstPolygon(uTile));
+	}
+	const uint32_t uPolygonsBefore = xTiled.GetNavMesh().GetPolygonCount();
+
+	// Place a "building" and rebuild only around it.
+	const Zenith_Maths::Vector3 xMin(6.0f, 0.0f, 6.0f);
+	const Zenith_Maths::Vector3 xMax(8.0f, 1.0f, 8.0f);
+	TiledNavMeshAddQuad(axVertices, auIndices, xMin.x, xMin.z, xMax.x, xMax.z, 1.0f);
+	const uint32_t uRebuilt = xTiled.RebuildTilesInBounds(axVertices, auIndices, xMin, xMax);
+	ZENITH_ASSERT_GT(uRebuilt, 0u);
+	ZENITH_ASSERT_LT(uRebuilt, xTiled.GetTileCount(), "a local change must not rebuild the world");
+	ZENITH_ASSERT_TRUE(&xTiled.GetNavMesh() == pxLive, "the mesh is rebuilt in place");
+	ZENITH_ASSERT_GT(xTiled.GetNavMesh().GetTopologyRevision(), uTopology);
+
+	Zenith_TiledNavMesh xFull;
+	ZENITH_ASSERT_TRUE(xFull.Build(axVertices, auIndices, xConfig));
+	ZENITH_ASSERT_EQ(xFull.GetTileCount(), xTiled.GetTileCount());
+	uint32_t uChangedTiles = 0;
+	for (uint32_t uTile = 0; uTile < xTiled.GetTileCount(); ++uTile)
+	{
+		ZENITH_ASSERT_EQ(xTiled.GetTilePolygonCount(uTile), xFull.GetTilePolygonCount(uTile),
+			"tile %u differs from a full rebuild", uTile);
+		if (TiledNavMeshTileHeightSum(xTiled, uTile) != afHeightsBefore.Get(uTile))
+		{
+			++uChangedTiles;
+		}
+	}
+	ZENITH_ASSERT_GT(uChangedTiles, 0u, "the deck must change the tiles under it");
+	ZENITH_ASSERT_TRUE(TiledNavMeshSameTopology(xTiled, xFull), "patched links must match a full rebuild's");
+	for (uint32_t uTile = 0; uTile < xTiled.GetTileCount(); ++uTile)
+	{
+		ZENITH_ASSERT_EQ(xTiled.GetTileFirstPolygon(uTile), auFirstBefore.Get(uTile),
+			"tile %u fits its slots, so no polygon index moves", uTile);
+	}
+	ZENITH_ASSERT_EQ(xTiled.GetNavMesh().GetPolygonCount(), uPolygonsBefore);
+	ZENITH_ASSERT_TRUE(xTiled.GetNavMesh().GetBoundsMin() == xFull.GetNavMesh().GetBoundsMin()
+		&& xTiled.GetNavMesh().GetBoundsMax() == xFull.GetNavMesh().GetBoundsMax());
+
+	// A box that misses the lattice rebuilds nothing.
+	ZENITH_ASSERT_EQ(xTiled.RebuildTilesInBounds(axVertices, auIndices,
+		Zenith_Maths::Vector3(100.0f, 0.0f, 100.0f), Zenith_Maths::Vector3(101.0f, 0.0f, 101.0f)), 0u);
+}
+
+ZENITH_TEST(AI, TiledNavMeshRebuildKeepsBlockedFlags)
+{
+	Zenith_Vector<Zenith_Maths::Vector3> axVertices;
+	Zenith_Vector<uint32_t> auIndices;
+	TiledNavMeshBuildGround(axVertices, auIndices);
+
+	Zenith_TiledNavMesh xTiled;
+	ZENITH_ASSERT_TRUE(xTiled.Build(axVertices, auIndices, TiledNavMeshTestConfig()));
+	ZENITH_ASSERT_GT(xTiled.GetTilePolygonCount(0), 3u);
+
+	// Block a polygon in the first tile, then rebuild the far corner.
+	const uint32_t uLocal = 3;
+	xTiled.GetNavMesh().SetPolygonBlocked(xTiled.GetTileFirstPolygon(0) + uLocal, true);
+	const Zenith_Maths::Vector3 xCorner(15.5f, 0.0f, 15.5f);
+	ZENITH_ASSERT_GT(xTiled.RebuildTilesInBounds(axVertices, auIndices, xCorner, xCorner), 0u);
+
+	ZENITH_ASSERT_TRUE(xTiled.GetNavMesh().GetPolygon(xTiled.GetTileFirstPolygon(0) + uLocal).IsBlocked(),
+		"blocked flags on untouched tiles survive a rebuild");
+
+	// Rebuilding the blocked polygon's own tile re-applies the flag by position.
+	const Zenith_Maths::Vector3 xBlocked = xTiled.GetNavMesh().GetPolygon(xTiled.GetTileFirstPolygon(0) + uLocal).m_xCenter;
+	ZENITH_ASSERT_GT(xTiled.RebuildTilesInBounds(axVertices, auIndices, xBlocked, xBlocked), 0u);
+	const uint32_t uAfter = xTiled.GetNavMesh().FindPolygonContaining(xBlocked);
+	ZENITH_ASSERT_TRUE(uAfter != UINT32_MAX);
+	ZENITH_ASSERT_TRUE(xTiled.GetNavMesh().GetPolygon(uAfter).IsBlocked(),
+		"a rebuilt tile keeps its blocked area");
+	uint32_t uBlockedCount = 0;
+	for (uint32_t uPoly = 0; uPoly < xTiled.GetNavMesh().GetPolygonCount(); ++uPoly)
+	{
+		if (xTiled.GetNavMesh().GetPolygon(uPoly).IsBlocked() && xTiled.GetNavMesh().GetPolygon(uPoly).m_axVertexIndices.GetSize() > 0)
+		{
+			++uBlockedCount;
+		}
+	}
+	ZENITH_ASSERT_EQ(uBlockedCount, 1u, "only the one polygon is blocked");
+}
+
+ZENITH_TEST(AI, TiledNavMeshRebuildMovesAGrownTile)
+{
+	Zenith_Vector<Zenith_Maths::Vector3> axVertices;
+	Zenith_Vector<uint32_t> auIndices;
+	TiledNavMeshBuildGround(axVertices, auIndices);
+
+	const NavMeshGenerationConfig xConfig = TiledNavMeshTestConfig();
+	Zenith_TiledNavMesh xTiled;
+	ZENITH_ASSERT_TRUE(xTiled.Build(axVertices, auIndices, xConfig));
+	Zenith_Vector<uint32_t> auFirstBefore;
+	Zenith_Vector<uint32_t> auCountBefore;
+	for (uint32_t uTile = 0; uTile < xTiled.GetTileCount(); ++uTile)
+	{
+		auFirstBefore.PushBack(xTiled.GetTileFirstPolygon(uTile));
+		auCountBefore.PushBack(xTiled.GetTilePolygonCount(uTile));
+	}
+
+	// A deck high enough to walk under adds a second layer, so the tiles under
+	// it outgrow their slots and move.
+	const Zenith_Maths::Vector3 xMin(6.0f, 0.0f, 6.0f);
+	const Zenith_Maths::Vector3 xMax(8.0f, 2.5f, 8.0f);
+	TiledNavMeshAddQuad(axVertices, auIndices, xMin.x, xMin.z, xMax.x, xMax.z, xMax.y);
+	ZENITH_ASSERT_GT(xTiled.RebuildTilesInBounds(axVertices, auIndices, xMin, xMax), 0u);
+
+	Zenith_TiledNavMesh xFull;
+	ZENITH_ASSERT_TRUE(xFull.Build(axVertices, auIndices, xConfig));
+	ZENITH_ASSERT_TRUE(TiledNavMeshSameTopology(xTiled, xFull), "a moved tile must link like a full rebuild");
+
+	// Only tiles that outgrew their slots move; every other index stays put.
+	uint32_t uMoved = 0;
+	for (uint32_t uTile = 0; uTile < xTiled.GetTileCount(); ++uTile)
+	{
+		if (xTiled.GetTileFirstPolygon(uTile) != auFirstBefore.Get(uTile))
+		{
+			ZENITH_ASSERT_GT(xTiled.GetTilePolygonCount(uTile), auCountBefore.Get(uTile), "tile %u moved without growing", uTile);
+			++uMoved;
+		}
+	}
+	ZENITH_ASSERT_GT(uMoved, 0u, "the deck must grow at least one tile past its slots");
+
+	// The same change again fits the new slots: nothing grows.
+	const uint32_t uPolygons = xTiled.GetNavMesh().GetPolygonCount();
+	ZENITH_ASSERT_GT(xTiled.RebuildTilesInBounds(axVertices, auIndices, xMin, xMax), 0u);
+	ZENITH_ASSERT_EQ(xTiled.GetNavMesh().GetPolygonCount(), uPolygons, "a tile that fits is written in place");
+	ZENITH_ASSERT_TRUE(TiledNavMeshSameTopology(xTiled, xFull));
+
+	// Vacant slots are out of every query: paths still cross the moved tiles.
+	const Zenith_PathResult xPath = Zenith_Pathfinding::FindPath(xTiled.GetNavMesh(),
+		Zenith_Maths::Vector3(0.5f, 0.0f, 0.5f), Zenith_Maths::Vector3(15.5f, 0.0f, 15.5f));
+	ZENITH_ASSERT_TRUE(xPath.m_eStatus == Zenith_PathResult::Status::SUCCESS);
+	uint32_t uNearest = UINT32_MAX;
+	Zenith_Maths::Vector3 xNearest;
+	ZENITH_ASSERT_TRUE(xTiled.GetNavMesh().FindNearestPolygon(Zenith_Maths::Vector3(7.0f, 2.5f, 7.0f), uNearest, xNearest));
+	ZENITH_ASSERT_GT(xTiled.GetNavMesh().GetPolygon(uNearest).m_axVertexIndices.GetSize(), 0u);
+}
+
+ZENITH_TEST(AI, TiledNavMeshParallelBakeMatchesSerial)
+{
+	Zenith_Vector<Zenith_Maths::Vector3> axVertices;
+	Zenith_Vector<uint32_t> auIndices;
+	TiledNavMeshBuildGround(axVertices, auIndices);
+	TiledNavMeshAddQuad(axVertices, auIndices, 3.0f, 9.0f, 12.0f, 11.0f, 1.0f);
+
+	NavMeshGenerationConfig xConfig = TiledNavMeshTestConfig();
+	xConfig.m_bBakeInTiles = true;
+	Zenith_NavMesh* pxParallel = Zenith_NavMeshGenerator::GenerateFromGeometry(axVertices, auIndices, xConfig);
+	ZENITH_ASSERT_TRUE(pxParallel != nullptr);
+
+	// The same tiles, one at a time on this thread, in reverse order.
+	const Zenith_NavMeshTileLayout xLayout = Zenith_NavMeshGenerator::ComputeTileLayout(axVertices, xConfig);
+	Zenith_Vector<Zenith_Vector<uint32_t>> axTileTriangles;
+	Zenith_NavMeshGenerator::BinTrianglesToTiles(axVertices, auIndices, xLayout,
+		0, 0, xLayout.m_uTilesX - 1, xLayout.m_uTilesZ - 1, axTileTriangles);
+	Zenith_Vector<Zenith_NavMeshTile> axTiles;
+	axTiles.Resize(xLayout.GetTileCount());
+	for (uint32_t uTile = xLayout.GetTileCount(); uTile-- > 0;)
+	{
+		Zenith_NavMeshGenerator::GenerateTile(axVertices, auIndices, axTileTriangles.Get(uTile), xConfig, xLayout,
+			uTile % xLayout.m_uTilesX, uTile / xLayout.m_uTilesX, axTiles.Get(uTile));
+	}
+	Zenith_NavMesh xSerial;
+	Zenith_Vector<uint32_t> auTileFirstPolygon;
+	Zenith_NavMeshGenerator::AssembleTiles(axTiles, xLayout, xConfig, xSerial, auTileFirstPolygon);
+
+	Zenith_DataStream xParallelStream;
+	Zenith_DataStream xSerialStream;
+	pxParallel->WriteToDataStream(xParallelStream);
+	xSerial.WriteToDataStream(xSerialStream);
+	ZENITH_ASSERT_EQ(xParallelStream.GetCursor(), xSerialStream.GetCursor());
+	ZENITH_ASSERT_EQ(memcmp(xParallelStream.GetData(), xSerialStream.GetData(), static_cast<size_t>(xSerialStream.GetCursor())), 0,
+		"the parallel bake must be byte-identical to a serial one");
+	delete pxParallel;
+}
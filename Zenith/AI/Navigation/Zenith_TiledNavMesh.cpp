@@ -0,0 +1,184 @@
+#include "Zenith.h"
+#include "AI/Navigation/Zenith_TiledNavMesh.h"
+#include "Profiling/Zenith_Profiling.h"
+
+bool Zenith_TiledNavMesh::Build(const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+	const Zenith_Vector<uint32_t>& axIndices,
+	const NavMeshGenerationConfig& xConfig)
+{
+	Zenith_Profiling::ScopeZone xProfileScope(ZENITH_PROFILE_ZONE("AI NavMesh Tiled Build"));
+
+	m_xConfig = xConfig;
+	m_axTiles.Clear();
+	m_xLayout = Zenith_NavMeshTileLayout();
+	if (axVertices.GetSize() == 0 || axIndices.GetSize() < 3)
+	{
+		Zenith_Log(LOG_CATEGORY_AI, "No geometry to generate NavMesh from");
+		m_xNavMesh.Clear();
+		m_axTileSlots.Clear();
+		return false;
+	}
+
+	m_xLayout = Zenith_NavMeshGenerator::ComputeTileLayout(axVertices, xConfig);
+	m_auDirtyTiles.Clear();
+	for (uint32_t uTile = 0; uTile < m_xLayout.GetTileCount(); ++uTile)
+	{
+		m_auDirtyTiles.PushBack(uTile);
+	}
+
+	Zenith_NavMeshGenerator::BinTrianglesToTiles(axVertices, axIndices, m_xLayout,
+		0, 0, m_xLayout.m_uTilesX - 1, m_xLayout.m_uTilesZ - 1, m_axTileTriangles);
+	Zenith_NavMeshGenerator::GenerateTiles(axVertices, axIndices, m_xConfig, m_xLayout,
+		m_auDirtyTiles, m_axTileTriangles, m_axTiles);
+	Zenith_NavMeshGenerator::AssembleTiles(m_axTiles, m_xLayout, m_xConfig, m_xNavMesh, m_auTileFirstPolygon);
+
+	// Assembly packs the tiles back to back, each exactly as large as it is.
+	m_axTileSlots.Clear();
+	uint32_t uFirstVertex = 0;
+	for (uint32_t uTile = 0; uTile < m_axTiles.GetSize(); ++uTile)
+	{
+		TileSlots xSlots;
+		xSlots.m_uFirstVertex = uFirstVertex;
+		xSlots.m_uVertexCapacity = m_axTiles.Get(uTile).m_axVertices.GetSize();
+		xSlots.m_uFirstPolygon = m_auTileFirstPolygon.Get(uTile);
+		xSlots.m_uPolygonCapacity = m_axTiles.Get(uTile).GetQuadCount();
+		m_axTileSlots.PushBack(xSlots);
+		uFirstVertex += xSlots.m_uVertexCapacity;
+	}
+
+	Zenith_Log(LOG_CATEGORY_AI, "Tiled NavMesh built: %u x %u tiles, %u vertices, %u polygons",
+		m_xLayout.m_uTilesX, m_xLayout.m_uTilesZ, m_xNavMesh.GetVertexCount(), m_xNavMesh.GetPolygonCount());
+	return m_xNavMesh.GetPolygonCount() > 0;
+}
+
+uint32_t Zenith_TiledNavMesh::RebuildTilesInBounds(const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+	const Zenith_Vector<uint32_t>& axIndices,
+	const Zenith_Maths::Vector3& xMin, const Zenith_Maths::Vector3& xMax)
+{
+	Zenith_Profiling::ScopeZone xProfileScope(ZENITH_PROFILE_ZONE("AI NavMesh Tiled Rebuild"));
+
+	uint32_t uMinX, uMinZ, uMaxX, uMaxZ;
+	if (!m_xLayout.GetTilesOverlapping(xMin, xMax, uMinX, uMinZ, uMaxX, uMaxZ))
+	{
+		return 0;
+	}
+
+	m_auDirtyTiles.Clear();
+	for (uint32_t uZ = uMinZ; uZ <= uMaxZ; ++uZ)
+	{
+		for (uint32_t uX = uMinX; uX <= uMaxX; ++uX)
+		{
+			m_auDirtyTiles.PushBack(uZ * m_xLayout.m_uTilesX + uX);
+		}
+	}
+
+	// Stage: every replacement tile exists before the live mesh is touched.
+	Zenith_NavMeshGenerator::BinTrianglesToTiles(axVertices, axIndices, m_xLayout,
+		uMinX, uMinZ, uMaxX, uMaxZ, m_axTileTriangles);
+	Zenith_NavMeshGenerator::GenerateTiles(axVertices, axIndices, m_xConfig, m_xLayout,
+		m_auDirtyTiles, m_axTileTriangles, m_axStagedTiles);
+
+	// Remember where the outgoing tiles were blocked; untouched tiles keep
+	// their polygons, and so their flags, as they are.
+	m_axBlockedCenters.Clear();
+	for (uint32_t u = 0; u < m_auDirtyTiles.GetSize(); ++u)
+	{
+		const uint32_t uTile = m_auDirtyTiles.Get(u);
+		const uint32_t uFirst = m_axTileSlots.Get(uTile).m_uFirstPolygon;
+		for (uint32_t uPoly = uFirst; uPoly < uFirst + m_axTiles.Get(uTile).GetQuadCount(); ++uPoly)
+		{
+			if (m_xNavMesh.GetPolygon(uPoly).IsBlocked())
+			{
+				m_axBlockedCenters.PushBack(m_xNavMesh.GetPolygon(uPoly).m_xCenter);
+			}
+		}
+	}
+
+	// Commit: write each new tile over its slots, re-stitch every seam that
+	// touches one (each once, from its -X / -Z side), then re-bin the grid
+	// cells the changed polygons cover.
+	m_auChangedPolygons.Clear();
+	for (uint32_t u = 0; u < m_auDirtyTiles.GetSize(); ++u)
+	{
+		std::swap(m_axTiles.Get(m_auDirtyTiles.Get(u)), m_axStagedTiles.Get(u));
+		PatchTile(m_auDirtyTiles.Get(u));
+	}
+	for (uint32_t u = 0; u < m_auDirtyTiles.GetSize(); ++u)
+	{
+		const uint32_t uTile = m_auDirtyTiles.Get(u);
+		const uint32_t uX = uTile % m_xLayout.m_uTilesX;
+		const uint32_t uZ = uTile / m_xLayout.m_uTilesX;
+		const uint32_t uStrideZ = m_xLayout.m_uTilesX;
+		auto Stitch = [this](uint32_t uLow, uint32_t uHigh, bool bAlongX)
+		{
+			Zenith_NavMeshGenerator::StitchTiles(m_xNavMesh, m_xLayout, m_xConfig,
+				m_axTiles.Get(uLow), m_axTileSlots.Get(uLow).m_uFirstPolygon,
+				m_axTiles.Get(uHigh), m_axTileSlots.Get(uHigh).m_uFirstPolygon, bAlongX);
+		};
+		if (uX + 1 < m_xLayout.m_uTilesX) Stitch(uTile, uTile + 1, true);
+		if (uZ + 1 < m_xLayout.m_uTilesZ) Stitch(uTile, uTile + uStrideZ, false);
+		if (uX == uMinX && uX > 0) Stitch(uTile - 1, uTile, true);
+		if (uZ == uMinZ && uZ > 0) Stitch(uTile - uStrideZ, uTile, false);
+	}
+	m_xNavMesh.RefreshSpatialGrid(m_auChangedPolygons);
+
+	for (uint32_t u = 0; u < m_axBlockedCenters.GetSize(); ++u)
+	{
+		const uint32_t uPoly = m_xNavMesh.FindPolygonContaining(m_axBlockedCenters.Get(u));
+		if (uPoly != UINT32_MAX)
+		{
+			m_xNavMesh.SetPolygonBlocked(uPoly, true);
+		}
+	}
+
+	return m_auDirtyTiles.GetSize();
+}
+
+void Zenith_TiledNavMesh::PatchTile(uint32_t uTile)
+{
+	const Zenith_NavMeshTile& xTile = m_axTiles.Get(uTile);
+	TileSlots& xSlots = m_axTileSlots.Get(uTile);
+	const Zenith_Vector<uint32_t> axVacant;
+
+	const uint32_t uQuads = xTile.GetQuadCount();
+	const uint32_t uVertices = xTile.m_axVertices.GetSize();
+	// Outgrown ranges move to the end of the mesh, with headroom so the next
+	// small change fits where they land. The two move independently: vertex
+	// indices are private to the tile's polygons, polygon indices are not.
+	if (uVertices > xSlots.m_uVertexCapacity)
+	{
+		xSlots.m_uVertexCapacity = uVertices + uVertices / 4;
+		xSlots.m_uFirstVertex = m_xNavMesh.GetVertexCount();
+		for (uint32_t u = 0; u < xSlots.m_uVertexCapacity; ++u)
+		{
+			m_xNavMesh.AddVertex(xTile.m_axVertices.Get(0));
+		}
+	}
+	if (uQuads > xSlots.m_uPolygonCapacity)
+	{
+		for (uint32_t uPoly = xSlots.m_uFirstPolygon; uPoly < xSlots.m_uFirstPolygon + xSlots.m_uPolygonCapacity; ++uPoly)
+		{
+			if (m_xNavMesh.GetPolygon(uPoly).m_axVertexIndices.GetSize() > 0)
+			{
+				m_xNavMesh.ReplacePolygon(uPoly, axVacant);
+				m_auChangedPolygons.PushBack(uPoly);
+			}
+		}
+		xSlots.m_uPolygonCapacity = uQuads + uQuads / 4;
+		xSlots.m_uFirstPolygon = m_xNavMesh.AddVacantPolygons(xSlots.m_uPolygonCapacity, 4);
+	}
+
+	Zenith_NavMeshGenerator::WriteTileInPlace(xTile, xSlots.m_uFirstVertex, xSlots.m_uFirstPolygon, m_xNavMesh);
+	for (uint32_t uPoly = xSlots.m_uFirstPolygon; uPoly < xSlots.m_uFirstPolygon + uQuads; ++uPoly)
+	{
+		m_auChangedPolygons.PushBack(uPoly);
+	}
+	for (uint32_t uPoly = xSlots.m_uFirstPolygon + uQuads; uPoly < xSlots.m_uFirstPolygon + xSlots.m_uPolygonCapacity; ++uPoly)
+	{
+		if (m_xNavMesh.GetPolygon(uPoly).m_axVertexIndices.GetSize() > 0)
+		{
+			m_xNavMesh.ReplacePolygon(uPoly, axVacant);
+			m_auChangedPolygons.PushBack(uPoly);
+		}
+	}
+}
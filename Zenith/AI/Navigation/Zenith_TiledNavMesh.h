@@ -0,0 +1,100 @@
+#pragma once
+
+#include "AI/Navigation/Zenith_NavMesh.h"
+#include "AI/Navigation/Zenith_NavMeshGenerator.h"
+
+/**
+ * Zenith_TiledNavMesh - a navmesh baked in fixed-size tiles that can be rebuilt
+ * a few at a time
+ *
+ * Build() fixes the tile lattice from the scene bounds and bakes every tile.
+ * When a dynamic obstacle appears, moves or goes away, RebuildTilesInBounds()
+ * re-voxelizes only the tiles whose padded footprint overlaps the changed box
+ * and patches only their polygons into the live mesh.
+ *
+ * Slots. Each tile owns a fixed range of vertex and polygon slots in the mesh.
+ * A rebuilt tile that still fits is written over its own range and the slots
+ * it no longer fills go vacant (see Zenith_NavMesh, "In-place edits"). A tile
+ * that outgrows either range moves that range to the end of the mesh, a
+ * quarter larger than it needs; an outgrown polygon range leaves its old
+ * slots vacant. Either way the
+ * polygons of every tile that was not rebuilt keep their indices and their
+ * blocked flags. Only the seams around rebuilt tiles are re-stitched, and only
+ * the spatial grid cells they cover are re-binned.
+ *
+ * Blocked flags inside a rebuilt tile are re-applied by position: the center
+ * of each blocked polygon blocks whichever new polygon contains it.
+ *
+ * Swapping. Replacement tiles are generated off to the side first; the live
+ * mesh is not touched until all of them exist. The patch happens in place, so
+ * the mesh's address stays valid for agents and hierarchies holding a pointer,
+ * and its topology revision moves on so a Zenith_NavMeshHierarchy rebuilds on
+ * its next Refresh().
+ *
+ * After a rebuild the mesh may hold vacant polygons and unused vertices, which
+ * the ZNAV reader rejects: bake files with Zenith_NavMeshGenerator instead of
+ * saving this mesh. Build() packs it again.
+ *
+ * Threading. Build and RebuildTilesInBounds mutate the mesh and belong to the
+ * owner's thread, between query batches (the same rule as
+ * Zenith_NavMeshHierarchy::Refresh).
+ *
+ * The lattice never grows: geometry outside the bounds seen by Build() is
+ * clipped to the edge tiles. Call Build() again when the level itself changes.
+ */
+class Zenith_TiledNavMesh
+{
+public:
+	/**
+	 * Fix the lattice from axVertices' bounds and bake every tile.
+	 * @return false if nothing walkable was found
+	 */
+	bool Build(const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+		const Zenith_Vector<uint32_t>& axIndices,
+		const NavMeshGenerationConfig& xConfig = NavMeshGenerationConfig());
+
+	/**
+	 * Rebuild the tiles whose padded footprint overlaps the XZ box [xMin, xMax]
+	 * from the scene's current geometry (the whole scene, not just the change).
+	 * @return the number of tiles rebuilt (0 if the box misses the lattice)
+	 */
+	uint32_t RebuildTilesInBounds(const Zenith_Vector<Zenith_Maths::Vector3>& axVertices,
+		const Zenith_Vector<uint32_t>& axIndices,
+		const Zenith_Maths::Vector3& xMin, const Zenith_Maths::Vector3& xMax);
+
+	const Zenith_NavMesh& GetNavMesh() const { return m_xNavMesh; }
+	const Zenith_NavMeshTileLayout& GetLayout() const { return m_xLayout; }
+
+	uint32_t GetTileCount() const { return m_axTiles.GetSize(); }
+	uint32_t GetTileFirstPolygon(uint32_t uTile) const { return m_axTileSlots.Get(uTile).m_uFirstPolygon; }
+	uint32_t GetTilePolygonCount(uint32_t uTile) const { return m_axTiles.Get(uTile).GetQuadCount(); }
+
+private:
+	// Where a tile lives in the mesh. Its quads fill the front of its polygon
+	// range; the rest of the range is vacant.
+	struct TileSlots
+	{
+		uint32_t m_uFirstVertex = 0;
+		uint32_t m_uVertexCapacity = 0;
+		uint32_t m_uFirstPolygon = 0;
+		uint32_t m_uPolygonCapacity = 0;
+	};
+
+	// Write m_axTiles[uTile] into its slots, moving it first if it no longer
+	// fits. Every polygon slot touched is appended to m_auChangedPolygons.
+	void PatchTile(uint32_t uTile);
+
+	NavMeshGenerationConfig m_xConfig;
+	Zenith_NavMeshTileLayout m_xLayout;
+	Zenith_Vector<Zenith_NavMeshTile> m_axTiles;
+	Zenith_Vector<TileSlots> m_axTileSlots;
+	Zenith_NavMesh m_xNavMesh;
+
+	// Rebuild scratch, kept so steady-state rebuilds reuse its capacity.
+	Zenith_Vector<uint32_t> m_auDirtyTiles;
+	Zenith_Vector<Zenith_Vector<uint32_t>> m_axTileTriangles;
+	Zenith_Vector<Zenith_NavMeshTile> m_axStagedTiles;
+	Zenith_Vector<uint32_t> m_auTileFirstPolygon;     // AssembleTiles output
+	Zenith_Vector<uint32_t> m_auChangedPolygons;
+	Zenith_Vector<Zenith_Maths::Vector3> m_axBlockedCenters;
+};
@@ -34,7 +34,7 @@ void Zenith_UnitTests::TestSightConeInRange(){
 	Zenith_PerceptionSystem::Update(0.1f);
 
 	// Check if target is perceived
-	const Zenith_Vector<Zenith_PerceivedTarget>* pxTargets =
+	const Zenith_PerceivedTargetList* pxTargets =
 		Zenith_PerceptionSystem::GetPerceivedTargets(xAgent.GetEntityID());
 
 	bool bFound = pxTargets && pxTargets->GetSize() > 0;
@@ -69,7 +69,7 @@ void Zenith_UnitTests::TestSightConeOutOfRange(){
 	Zenith_PerceptionSystem::SetSightConfig(xAgent.GetEntityID(), xConfig);
 	Zenith_PerceptionSystem::Update(0.1f);
 
-	const Zenith_Vector<Zenith_PerceivedTarget>* pxTargets =
+	const Zenith_PerceivedTargetList* pxTargets =
 		Zenith_PerceptionSystem::GetPerceivedTargets(xAgent.GetEntityID());
 
 	bool bFound = pxTargets && pxTargets->GetSize() > 0;
@@ -105,7 +105,7 @@ void Zenith_UnitTests::TestSightConeOutOfFOV(){
 	Zenith_PerceptionSystem::SetSightConfig(xAgent.GetEntityID(), xConfig);
 	Zenith_PerceptionSystem::Update(0.1f);
 
-	const Zenith_Vector<Zenith_PerceivedTarget>* pxTargets =
+	const Zenith_PerceivedTargetList* pxTargets =
 		Zenith_PerceptionSystem::GetPerceivedTargets(xAgent.GetEntityID());
 
 	// Target is behind, should not be in FOV
@@ -164,7 +164,7 @@ ZENITH_TEST(AI, SightConeFacingNegativeZSeesTargetInFront)
 	Zenith_PerceptionSystem::SetSightConfig(xAgent.GetEntityID(), xConfig);
 	Zenith_PerceptionSystem::Update(0.1f);
 
-	const Zenith_Vector<Zenith_PerceivedTarget>* pxTargets =
+	const Zenith_PerceivedTargetList* pxTargets =
 		Zenith_PerceptionSystem::GetPerceivedTargets(xAgent.GetEntityID());
 
 	bool bFound = false;
@@ -247,7 +247,7 @@ void Zenith_UnitTests::TestHearingStimulusInRange(){
 	Zenith_PerceptionSystem::Update(0.1f);
 
 	// Agent should have heard something
-	const Zenith_Vector<Zenith_PerceivedTarget>* pxTargets =
+	const Zenith_PerceivedTargetList* pxTargets =
 		Zenith_PerceptionSystem::GetPerceivedTargets(xAgent.GetEntityID());
 
 	Zenith_PerceptionSystem::Shutdown();
@@ -287,7 +287,7 @@ void Zenith_UnitTests::TestHearingStimulusOutOfRange(){
 
 	Zenith_PerceptionSystem::Update(0.1f);
 
-	const Zenith_Vector<Zenith_PerceivedTarget>* pxTargets =
+	const Zenith_PerceivedTargetList* pxTargets =
 		Zenith_PerceptionSystem::GetPerceivedTargets(xAgent.GetEntityID());
 
 	bool bHeard = pxTargets && pxTargets->GetSize() > 0;
@@ -324,7 +324,7 @@ void Zenith_UnitTests::TestMemoryRememberTarget(){
 	Zenith_PerceptionSystem::SetSightConfig(xAgent.GetEntityID(), xConfig);
 	Zenith_PerceptionSystem::Update(0.1f);
 
-	const Zenith_Vector<Zenith_PerceivedTarget>* pxTargets =
+	const Zenith_PerceivedTargetList* pxTargets =
 		Zenith_PerceptionSystem::GetPerceivedTargets(xAgent.GetEntityID());
 
 	bool bHasLastKnownPos = false;
@@ -458,7 +458,7 @@ ZENITH_TEST(AIPerceptionScene, SceneDestructionPurgesPerceivedAndPrimaryReferenc
 	Zenith_PerceptionSystem::SetSightConfig(xAgent.GetEntityID(), PerceptionTest_NoLosSightConfig());
 	Zenith_PerceptionSystem::Update(0.1f);
 
-	const Zenith_Vector<Zenith_PerceivedTarget>* pxBefore =
+	const Zenith_PerceivedTargetList* pxBefore =
 		Zenith_PerceptionSystem::GetPerceivedTargets(xAgent.GetEntityID());
 	ZENITH_ASSERT_TRUE(pxBefore != nullptr && pxBefore->GetSize() == 1, "agent must have perceived the target first");
 	ZENITH_ASSERT_TRUE(Zenith_PerceptionSystem::GetPrimaryTarget(xAgent.GetEntityID()) == xTarget.GetEntityID(),
@@ -470,7 +470,7 @@ ZENITH_TEST(AIPerceptionScene, SceneDestructionPurgesPerceivedAndPrimaryReferenc
 	// naming a dead entity forever.
 	g_xEngine.Scenes().UnloadScene(xTargetScene);
 
-	const Zenith_Vector<Zenith_PerceivedTarget>* pxAfter =
+	const Zenith_PerceivedTargetList* pxAfter =
 		Zenith_PerceptionSystem::GetPerceivedTargets(xAgent.GetEntityID());
 	ZENITH_ASSERT_TRUE(pxAfter != nullptr && pxAfter->GetSize() == 0, "memories of a destroyed scene must be purged");
 	ZENITH_ASSERT_FALSE(Zenith_PerceptionSystem::GetPrimaryTarget(xAgent.GetEntityID()).IsValid(),
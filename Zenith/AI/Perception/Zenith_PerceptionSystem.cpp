@@ -405,7 +405,7 @@ void Zenith_PerceptionSystem::UnregisterTarget(Zenith_EntityID xTargetID)
 		for (uint32_t uAgent = 0; uAgent < xBucket.m_axAgents.GetSize(); ++uAgent)
 		{
 			AgentPerceptionData& xData = xBucket.m_axAgents.Get(uAgent).m_xData;
-			Zenith_Vector<Zenith_PerceivedTarget>& axTargets = xData.m_axPerceivedTargets;
+			Zenith_PerceivedTargetList& axTargets = xData.m_axPerceivedTargets;
 			bool bRemovedAny = false;
 			for (uint32_t u = 0; u < axTargets.GetSize(); )
 			{
@@ -447,7 +447,7 @@ void Zenith_PerceptionSystem::SetTargetHostile(Zenith_EntityID xTargetID, bool b
 	}
 }
 
-const Zenith_Vector<Zenith_PerceivedTarget>* Zenith_PerceptionSystem::GetPerceivedTargets(Zenith_EntityID xAgentID)
+const Zenith_PerceivedTargetList* Zenith_PerceptionSystem::GetPerceivedTargets(Zenith_EntityID xAgentID)
 {
 	const AgentPerceptionData* pxData = FindAgentData(xAgentID);
 	if (pxData)
@@ -468,7 +468,7 @@ Zenith_PerceptionSystem::GetLastHeardSoundFor(Zenith_EntityID xAgentID)
 	const AgentPerceptionData* pxData = FindAgentData(xAgentID);
 	if (!pxData) return xResult;
 
-	const Zenith_Vector<Zenith_PerceivedTarget>& axTargets = pxData->m_axPerceivedTargets;
+	const Zenith_PerceivedTargetList& axTargets = pxData->m_axPerceivedTargets;
 	float fBestAge = -1.0f; // sentinel for "no candidate yet"
 	for (uint32_t i = 0; i < axTargets.GetSize(); ++i)
 	{
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Collections/Zenith_InlineVector.h"
 #include "Collections/Zenith_Vector.h"
 #include "Maths/Zenith_Maths.h"
 #include "ZenithECS/Zenith_Entity.h"
@@ -35,6 +36,10 @@ struct Zenith_PerceivedTarget
 	bool m_bHostile = false;
 };
 
+// An agent's perceived targets. Agents track a handful at most, so the list
+// lives inside the agent's perception record rather than in its own block.
+using Zenith_PerceivedTargetList = Zenith_InlineVector<Zenith_PerceivedTarget, 4>;
+
 /**
  * Zenith_SightConfig - Configuration for sight perception
  */
@@ -157,7 +162,7 @@ public:
 	/**
 	 * Get all targets perceived by an agent
 	 */
-	static const Zenith_Vector<Zenith_PerceivedTarget>* GetPerceivedTargets(Zenith_EntityID xAgentID);
+	static const Zenith_PerceivedTargetList* GetPerceivedTargets(Zenith_EntityID xAgentID);
 
 	/**
 	 * EXT-6: typed accessor for the most-recent hearing stimulus delivered to
@@ -242,7 +247,7 @@ private:
 	{
 		Zenith_SightConfig m_xSightConfig;
 		Zenith_HearingConfig m_xHearingConfig;
-		Zenith_Vector<Zenith_PerceivedTarget> m_axPerceivedTargets;
+		Zenith_PerceivedTargetList m_axPerceivedTargets;
 		Zenith_EntityID m_xPrimaryTarget;
 	};
 
@@ -44,7 +44,7 @@ struct Zenith_AIWorldHooks
 	// null when the entity has no agent. Returns a leaf type so callers stay leaf-clean.
 	Zenith_NavMeshAgent* (*m_pfnGetNavMeshAgent)(Zenith_EntityID) = nullptr;
 
-	// Run a data-parallel batch (used by batch pathfinding) on the engine task
+	// Run a data-parallel batch (batch pathfinding, tiled navmesh bakes) on the engine task
 	// system (Zenith_TaskSystem lives engine-side / reaches g_xEngine, so the AI
 	// leaf must not name it). null => the accessor runs the invocations
 	// synchronously on the calling thread, so the leaf needs no task system at all
@@ -5,6 +5,10 @@
 #include <android/log.h>
 #include <fstream>
 #include <filesystem>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #define LOGE(...) ((void)__android_log_print(ANDROID_LOG_ERROR, "Zenith_FileAccess", __VA_ARGS__))
 
@@ -151,6 +155,88 @@ namespace Zenith_FileAccess
 		Zenith_MemoryManagement::Deallocate(pData);
 	}
 
+	// Plain POSIX mmap of a real file; nothing Android-specific, so the same
+	// body serves any POSIX target.
+	static bool MapPosixFile(const char* szPath, MappedFile& xOut)
+	{
+		const int iFD = open(szPath, O_RDONLY | O_CLOEXEC);
+		if (iFD < 0)
+		{
+			return false;
+		}
+
+		struct stat xStat = {};
+		if (fstat(iFD, &xStat) != 0)
+		{
+			close(iFD);
+			return false;
+		}
+		if (xStat.st_size == 0)
+		{
+			// mmap rejects a zero length; an empty view needs no mapping.
+			close(iFD);
+			return true;
+		}
+
+		// The mapping keeps its own reference to the file, so the descriptor
+		// can be closed straight away.
+		void* pView = mmap(nullptr, static_cast<size_t>(xStat.st_size), PROT_READ, MAP_PRIVATE, iFD, 0);
+		close(iFD);
+		if (pView == MAP_FAILED)
+		{
+			return false;
+		}
+
+		xOut.m_pcData = static_cast<const char*>(pView);
+		xOut.m_ulSize = static_cast<uint64_t>(xStat.st_size);
+		return true;
+	}
+
+	bool MapFile(const char* szFilename, MappedFile& xOut)
+	{
+		xOut = MappedFile();
+
+		// Try AAssetManager first (APK assets). AAsset_getBuffer maps an
+		// uncompressed asset straight out of the APK (and inflates a compressed
+		// one once); the AAsset owns that buffer, so it is the handle.
+		if (s_pxAssetManager)
+		{
+			AAsset* pxAsset = AAssetManager_open(s_pxAssetManager, szFilename, AASSET_MODE_BUFFER);
+			if (pxAsset)
+			{
+				const off_t ulAssetLen = AAsset_getLength(pxAsset);
+				const void* pBuffer = ulAssetLen > 0 ? AAsset_getBuffer(pxAsset) : nullptr;
+				if (ulAssetLen > 0 && pBuffer == nullptr)
+				{
+					AAsset_close(pxAsset);
+					return false;
+				}
+				xOut.m_pcData = static_cast<const char*>(pBuffer);
+				xOut.m_ulSize = static_cast<uint64_t>(ulAssetLen);
+				xOut.m_pPlatformHandle = pxAsset;
+				return true;
+			}
+		}
+
+		// Fall back to filesystem (internal storage)
+		char acResolvedPath[ZENITH_MAX_PATH_LENGTH];
+		ResolveWritablePath(szFilename, acResolvedPath, ZENITH_MAX_PATH_LENGTH);
+		return MapPosixFile(acResolvedPath, xOut);
+	}
+
+	void UnmapFile(MappedFile& xFile)
+	{
+		if (xFile.m_pPlatformHandle != nullptr)
+		{
+			AAsset_close(static_cast<AAsset*>(xFile.m_pPlatformHandle));
+		}
+		else if (xFile.m_pcData != nullptr)
+		{
+			munmap(const_cast<char*>(xFile.m_pcData), static_cast<size_t>(xFile.m_ulSize));
+		}
+		xFile = MappedFile();
+	}
+
 	void WriteFile(const char* szFilename, const void* const pData, const uint64_t ulSize)
 	{
 		// Resolve relative paths to writable internal storage
@@ -81,7 +81,6 @@ struct ThreadParams
 
 static void* ThreadInit(void* pParams)
 {
-	g_xEngine.Threading().RegisterThread();
 	const ThreadParams* pxParams = static_cast<const ThreadParams*>(pParams);
 
 	// Copy EVERYTHING out of pxParams BEFORE signalling.
@@ -101,6 +100,9 @@ static void* ThreadInit(void* pParams)
 	memcpy(tl_g_acThreadName, pxParams->m_szName, uNameLen);
 	tl_g_acThreadName[uNameLen] = '\0';
 
+	// After the name copy: RegisterThread hands the name to the profiler.
+	g_xEngine.Threading().RegisterThread();
+
 	// pxParams must not be touched past this point.
 	pxSemaphore->Signal();
 	pfnFunc(pUserData);
@@ -154,3 +156,8 @@ bool Zenith_Multithreading::Platform_IsMainThread()
 {
 	return tl_g_uThreadID == g_xEngine.Threading().GetMainThreadID();
 }
+
+const char* Zenith_Multithreading::Platform_GetCurrentThreadName()
+{
+	return tl_g_acThreadName;
+}
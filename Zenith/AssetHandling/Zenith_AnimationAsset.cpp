@@ -63,7 +63,7 @@ Zenith_Status Zenith_AnimationAsset::LoadFromFile(const std::string& strPath)
 	{
 		// Load from binary .zanim format
 		Zenith_DataStream xStream;
-		xStream.ReadFromFile(strPath.c_str());
+		xStream.MapFromFile(strPath.c_str());
 		if (!xStream.IsValid())
 		{
 			Zenith_Log(LOG_CATEGORY_ANIMATION, "Failed to read animation file: %s", strPath.c_str());
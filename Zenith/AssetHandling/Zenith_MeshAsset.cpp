@@ -129,7 +129,7 @@ Zenith_Result<Zenith_MeshAsset*> Zenith_MeshAsset::LoadFromFile(const char* szPa
 {
 	ZENITH_PROFILE_SCOPE("Mesh Load + Parse");
 	Zenith_DataStream xStream;
-	xStream.ReadFromFile(szPath);
+	xStream.MapFromFile(szPath);
 
 	// Validate file was loaded successfully
 	if (!xStream.IsValid())
@@ -81,7 +81,7 @@ Zenith_Result<Zenith_ModelAsset*> Zenith_ModelAsset::LoadFromFile(const char* sz
 {
 	ZENITH_PROFILE_SCOPE("Model Load + Parse");
 	Zenith_DataStream xStream;
-	xStream.ReadFromFile(szPath);
+	xStream.MapFromFile(szPath);
 
 	// Validate file was loaded successfully
 	if (!xStream.IsValid())
@@ -89,7 +89,7 @@ Zenith_SkeletonAsset& Zenith_SkeletonAsset::operator=(Zenith_SkeletonAsset&& xOt
 Zenith_Result<Zenith_SkeletonAsset*> Zenith_SkeletonAsset::LoadFromFile(const char* szPath)
 {
 	Zenith_DataStream xStream;
-	xStream.ReadFromFile(szPath);
+	xStream.MapFromFile(szPath);
 
 	// Validate file was loaded successfully
 	if (!xStream.IsValid())
@@ -187,7 +187,7 @@ Zenith_Status Zenith_TextureAsset::ParseZtxtr(const std::string& strPath, Zenith
 Zenith_Status Zenith_TextureAsset::LoadCPUData(const std::string& strPath, Flux_SurfaceInfo& xOutInfo, Zenith_Vector<uint8_t>& xOutBytes)
 {
 	Zenith_DataStream xStream;
-	xStream.ReadFromFile(strPath.c_str());
+	xStream.MapFromFile(strPath.c_str());
 	if (!xStream.IsValid())
 	{
 		Zenith_Log(LOG_CATEGORY_ASSET, "Zenith_TextureAsset::LoadCPUData: Failed to read file '%s'", strPath.c_str());
@@ -201,7 +201,7 @@ Zenith_Status Zenith_TextureAsset::LoadFromFile(const std::string& strPath, bool
 {
 	ZENITH_PROFILE_SCOPE("Texture Load + GPU Upload");
 	Zenith_DataStream xStream;
-	xStream.ReadFromFile(strPath.c_str());
+	xStream.MapFromFile(strPath.c_str());
 	if (!xStream.IsValid())
 	{
 		Zenith_Log(LOG_CATEGORY_ASSET, "Zenith_TextureAsset: Failed to read file '%s'", strPath.c_str());
@@ -0,0 +1,437 @@
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+#include "Core/Multithreading/Zenith_Multithreading.h"
+
+/**
+ * Zenith_ConcurrentMemoryPool - Fixed-size pool for type T, for pools hit from many threads
+ *
+ * Same contract as Zenith_MemoryPool (Allocate constructs in place and returns
+ * nullptr when exhausted; Deallocate destroys and returns the slot) without the
+ * mutex. Every thread gets a small magazine of free slot indices in front of a
+ * lock-free shared free list:
+ *
+ * - Allocate / Deallocate touch only the calling thread's magazine: no lock, no
+ *   atomic read-modify-write, one branch for empty / full.
+ * - An empty magazine refills, and a full one spills, uMAGAZINE_BATCH slots at a
+ *   time to the shared list: a Treiber stack of slot indices whose head carries a
+ *   generation tag in its top 32 bits, so a pop that raced a pop-then-push of the
+ *   same slot fails its compare-exchange instead of corrupting the list (ABA).
+ * - Debug builds (ZENITH_ASSERT) keep one atomic state byte per slot and assert
+ *   on double-free and on corrupted free lists. Release builds keep no per-slot
+ *   state at all.
+ *
+ * Magazines are indexed by a small per-thread cache index (at most
+ * uMAX_CACHED_THREADS live threads; further threads go straight to the shared
+ * list). When a thread exits, its magazine in every live pool is returned to
+ * that pool's shared list, then the index passes to the next thread that starts.
+ * Live pools are kept on a registry for this; the registry lock is taken only
+ * at pool construction / destruction and at thread exit, never by Allocate or
+ * Deallocate.
+ *
+ * CAPACITY NOTE: free slots sitting in OTHER threads' magazines are not visible
+ * to an allocating thread, so Allocate can report exhaustion while up to
+ * (threads - 1) * uMAGAZINE_SIZE slots are free elsewhere. Size pools with that
+ * headroom. GetFreeCount is a racy snapshot for statistics only.
+ *
+ * Do not use a pool from a thread_local destructor: the thread's cache index may
+ * already have been released.
+ */
+
+namespace Zenith_ConcurrentMemoryPool_Detail
+{
+	static constexpr u_int uMAX_CACHED_THREADS = 64;
+	static constexpr u_int uNO_CACHE = ~0u;
+
+	// One bit per cache index in use.
+	inline std::atomic<u_int64> g_ulCacheIndicesInUse{ 0 };
+
+	// A live pool, linked into the registry so an exiting thread can return its
+	// magazine. Type-erased: the registry holds pools of every T and uCount.
+	struct PoolRegistration
+	{
+		void (*m_pfnDrainMagazine)(void* pxPool, u_int uCacheIndex) = nullptr;
+		void* m_pxPool = nullptr;
+		PoolRegistration* m_pxPrev = nullptr;
+		PoolRegistration* m_pxNext = nullptr;
+	};
+
+	// NoProfiling: thread exit can run after the profiler has shut down.
+	inline Zenith_Mutex_NoProfiling& GetRegistryMutex()
+	{
+		static Zenith_Mutex_NoProfiling s_xMutex;
+		return s_xMutex;
+	}
+	inline PoolRegistration* g_pxFirstRegisteredPool = nullptr;   // Guarded by GetRegistryMutex.
+
+	inline void RegisterPool(PoolRegistration& xRegistration)
+	{
+		Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(GetRegistryMutex());
+		xRegistration.m_pxPrev = nullptr;
+		xRegistration.m_pxNext = g_pxFirstRegisteredPool;
+		if (g_pxFirstRegisteredPool != nullptr)
+		{
+			g_pxFirstRegisteredPool->m_pxPrev = &xRegistration;
+		}
+		g_pxFirstRegisteredPool = &xRegistration;
+	}
+
+	inline void UnregisterPool(PoolRegistration& xRegistration)
+	{
+		Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(GetRegistryMutex());
+		if (xRegistration.m_pxPrev != nullptr)
+		{
+			xRegistration.m_pxPrev->m_pxNext = xRegistration.m_pxNext;
+		}
+		else
+		{
+			g_pxFirstRegisteredPool = xRegistration.m_pxNext;
+		}
+		if (xRegistration.m_pxNext != nullptr)
+		{
+			xRegistration.m_pxNext->m_pxPrev = xRegistration.m_pxPrev;
+		}
+		xRegistration.m_pxPrev = nullptr;
+		xRegistration.m_pxNext = nullptr;
+	}
+
+	struct ThreadCacheIndex
+	{
+		ThreadCacheIndex()
+		{
+			u_int64 ulInUse = g_ulCacheIndicesInUse.load(std::memory_order_relaxed);
+			while (ulInUse != ~0ull)
+			{
+				u_int uIndex = 0;
+				while ((ulInUse >> uIndex) & 1ull)
+				{
+					uIndex++;
+				}
+				if (g_ulCacheIndicesInUse.compare_exchange_weak(ulInUse, ulInUse | (1ull << uIndex), std::memory_order_acquire))
+				{
+					m_uIndex = uIndex;
+					return;
+				}
+			}
+		}
+
+		~ThreadCacheIndex()
+		{
+			if (m_uIndex == uNO_CACHE)
+			{
+				return;
+			}
+			// Drain before releasing the index, so the next thread to take it starts
+			// with empty magazines. Holding the lock keeps every pool alive meanwhile.
+			{
+				Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(GetRegistryMutex());
+				for (PoolRegistration* pxPool = g_pxFirstRegisteredPool; pxPool != nullptr; pxPool = pxPool->m_pxNext)
+				{
+					pxPool->m_pfnDrainMagazine(pxPool->m_pxPool, m_uIndex);
+				}
+			}
+			g_ulCacheIndicesInUse.fetch_and(~(1ull << m_uIndex), std::memory_order_release);
+		}
+
+		u_int m_uIndex = uNO_CACHE;
+	};
+
+	inline u_int GetThreadCacheIndex()
+	{
+		thread_local ThreadCacheIndex tl_xIndex;
+		return tl_xIndex.m_uIndex;
+	}
+}
+
+template <typename T, u_int uCount>
+class Zenith_ConcurrentMemoryPool
+{
+	static_assert(uCount > 0, "Memory pool must have at least 1 entry");
+	static_assert(uCount < 0xFFFFFFFFu, "Slot indices are 32-bit with ~0 as the list terminator");
+	static_assert(alignof(T) <= alignof(std::max_align_t), "Pool storage is only max_align_t aligned");
+
+public:
+	static constexpr u_int uMAGAZINE_SIZE = 32;
+	static constexpr u_int uMAGAZINE_BATCH = uMAGAZINE_SIZE / 2;
+
+	Zenith_ConcurrentMemoryPool()
+	: m_pxData(static_cast<T*>(Zenith_MemoryManagement::Allocate(uCount * sizeof(T))))
+	, m_puNext(static_cast<std::atomic<u_int32>*>(Zenith_MemoryManagement::Allocate(uCount * sizeof(std::atomic<u_int32>))))
+	, m_pxMagazines(static_cast<Magazine*>(Zenith_MemoryManagement::AllocateAligned(
+		Zenith_ConcurrentMemoryPool_Detail::uMAX_CACHED_THREADS * sizeof(Magazine), alignof(Magazine))))
+	{
+		Zenith_Assert(m_pxData != nullptr && m_puNext != nullptr && m_pxMagazines != nullptr, "ConcurrentMemoryPool: Failed to allocate pool storage");
+
+		// Shared list starts as 0 -> 1 -> ... -> uCount-1.
+		for (u_int u = 0; u < uCount; u++)
+		{
+			new (&m_puNext[u]) std::atomic<u_int32>(u + 1 < uCount ? u + 1 : uEND_OF_LIST);
+		}
+		m_ulHead.store(0, std::memory_order_relaxed);
+		m_uSharedFreeCount.store(uCount, std::memory_order_relaxed);
+
+		for (u_int u = 0; u < Zenith_ConcurrentMemoryPool_Detail::uMAX_CACHED_THREADS; u++)
+		{
+			new (&m_pxMagazines[u]) Magazine();
+		}
+
+#ifdef ZENITH_ASSERT
+		m_pucAllocated = static_cast<std::atomic<u_int8>*>(Zenith_MemoryManagement::Allocate(uCount * sizeof(std::atomic<u_int8>)));
+		for (u_int u = 0; u < uCount; u++)
+		{
+			new (&m_pucAllocated[u]) std::atomic<u_int8>(0);
+		}
+#endif
+
+		m_xRegistration.m_pfnDrainMagazine = &DrainMagazineForExitingThread;
+		m_xRegistration.m_pxPool = this;
+		Zenith_ConcurrentMemoryPool_Detail::RegisterPool(m_xRegistration);
+	}
+
+	~Zenith_ConcurrentMemoryPool()
+	{
+		// First, so no exiting thread is still draining into the lists scanned below.
+		Zenith_ConcurrentMemoryPool_Detail::UnregisterPool(m_xRegistration);
+
+		// No per-slot state in release, so find the live objects by elimination:
+		// everything not on the shared list or in a magazine is still allocated.
+		bool* pbFree = static_cast<bool*>(Zenith_MemoryManagement::Allocate(uCount * sizeof(bool)));
+		for (u_int u = 0; u < uCount; u++)
+		{
+			pbFree[u] = false;
+		}
+		for (u_int32 uSlot = HeadIndex(m_ulHead.load(std::memory_order_acquire)); uSlot != uEND_OF_LIST;
+			uSlot = m_puNext[uSlot].load(std::memory_order_relaxed))
+		{
+			pbFree[uSlot] = true;
+		}
+		for (u_int u = 0; u < Zenith_ConcurrentMemoryPool_Detail::uMAX_CACHED_THREADS; u++)
+		{
+			const Magazine& xMagazine = m_pxMagazines[u];
+			const u_int uMagazineCount = xMagazine.m_uCount.load(std::memory_order_relaxed);
+			for (u_int v = 0; v < uMagazineCount; v++)
+			{
+				pbFree[xMagazine.m_auSlots[v]] = true;
+			}
+		}
+		for (u_int u = 0; u < uCount; u++)
+		{
+			if (!pbFree[u])
+			{
+				(m_pxData + u)->~T();
+			}
+		}
+		Zenith_MemoryManagement::Deallocate(pbFree);
+
+		Zenith_MemoryManagement::Deallocate(m_pxData);
+		Zenith_MemoryManagement::Deallocate(m_puNext);
+		Zenith_MemoryManagement::DeallocateAligned(m_pxMagazines);
+#ifdef ZENITH_ASSERT
+		Zenith_MemoryManagement::Deallocate(m_pucAllocated);
+#endif
+	}
+
+	template<typename... Args>
+	T* Allocate(Args&& ... args)
+	{
+		const u_int uCacheIndex = Zenith_ConcurrentMemoryPool_Detail::GetThreadCacheIndex();
+		u_int32 uSlot;
+		if (uCacheIndex != Zenith_ConcurrentMemoryPool_Detail::uNO_CACHE)
+		{
+			Magazine& xMagazine = m_pxMagazines[uCacheIndex];
+			u_int uMagazineCount = xMagazine.m_uCount.load(std::memory_order_relaxed);
+			if (uMagazineCount == 0)
+			{
+				uMagazineCount = Refill(xMagazine);
+			}
+			if (uMagazineCount == 0)
+			{
+				Zenith_Error(LOG_CATEGORY_CORE, "ConcurrentMemoryPool::Allocate: Pool exhausted (capacity=%u)", uCount);
+				return nullptr;
+			}
+			uSlot = xMagazine.m_auSlots[--uMagazineCount];
+			xMagazine.m_uCount.store(uMagazineCount, std::memory_order_relaxed);
+		}
+		else
+		{
+			uSlot = PopShared();
+			if (uSlot == uEND_OF_LIST)
+			{
+				Zenith_Error(LOG_CATEGORY_CORE, "ConcurrentMemoryPool::Allocate: Pool exhausted (capacity=%u)", uCount);
+				return nullptr;
+			}
+		}
+
+#ifdef ZENITH_ASSERT
+		const u_int8 uWasAllocated = m_pucAllocated[uSlot].exchange(1, std::memory_order_acq_rel);
+		Zenith_Assert(uWasAllocated == 0, "ConcurrentMemoryPool slot %u already allocated - corruption detected", uSlot);
+#endif
+		return (new (m_pxData + uSlot) T(std::forward<Args>(args)...));
+	}
+
+	void Deallocate(T* const pxVal)
+	{
+		Zenith_Assert(pxVal != nullptr, "ConcurrentMemoryPool::Deallocate: Attempted to deallocate null pointer");
+		Zenith_Assert(OwnsPointer(pxVal),
+			"ConcurrentMemoryPool::Deallocate: Object at %p wasn't allocated from this pool (range %p-%p)",
+			static_cast<const void*>(pxVal), static_cast<const void*>(m_pxData), static_cast<const void*>(m_pxData + uCount));
+
+		const u_int32 uSlot = static_cast<u_int32>(pxVal - m_pxData);
+#ifdef ZENITH_ASSERT
+		const u_int8 uWasAllocated = m_pucAllocated[uSlot].exchange(0, std::memory_order_acq_rel);
+		Zenith_Assert(uWasAllocated == 1, "ConcurrentMemoryPool slot %u not allocated - possible double-free", uSlot);
+		if (uWasAllocated == 0)
+		{
+			return;
+		}
+#endif
+		pxVal->~T();
+
+		const u_int uCacheIndex = Zenith_ConcurrentMemoryPool_Detail::GetThreadCacheIndex();
+		if (uCacheIndex == Zenith_ConcurrentMemoryPool_Detail::uNO_CACHE)
+		{
+			PushShared(uSlot, uSlot, 1);
+			return;
+		}
+
+		Magazine& xMagazine = m_pxMagazines[uCacheIndex];
+		u_int uMagazineCount = xMagazine.m_uCount.load(std::memory_order_relaxed);
+		if (uMagazineCount == uMAGAZINE_SIZE)
+		{
+			uMagazineCount = Spill(xMagazine);
+		}
+		xMagazine.m_auSlots[uMagazineCount] = uSlot;
+		xMagazine.m_uCount.store(uMagazineCount + 1, std::memory_order_relaxed);
+	}
+
+	// Racy snapshot (shared list plus every magazine); statistics only.
+	u_int GetFreeCount() const
+	{
+		u_int uFree = m_uSharedFreeCount.load(std::memory_order_relaxed);
+		for (u_int u = 0; u < Zenith_ConcurrentMemoryPool_Detail::uMAX_CACHED_THREADS; u++)
+		{
+			uFree += m_pxMagazines[u].m_uCount.load(std::memory_order_relaxed);
+		}
+		return uFree;
+	}
+
+	u_int GetAllocatedCount() const { return uCount - GetFreeCount(); }
+	u_int GetCapacity() const { return uCount; }
+
+	bool OwnsPointer(const T* pxVal) const
+	{
+		return pxVal >= m_pxData && pxVal < m_pxData + uCount;
+	}
+
+	Zenith_ConcurrentMemoryPool(const Zenith_ConcurrentMemoryPool&) = delete;
+	Zenith_ConcurrentMemoryPool& operator=(const Zenith_ConcurrentMemoryPool&) = delete;
+
+private:
+	static constexpr u_int32 uEND_OF_LIST = 0xFFFFFFFFu;
+
+	// Written only by the thread holding its cache index. The count is atomic
+	// so GetFreeCount and the destructor can read it; its owner uses plain
+	// relaxed loads and stores, never a read-modify-write.
+	struct alignas(64) Magazine
+	{
+		std::atomic<u_int> m_uCount{ 0 };
+		u_int32 m_auSlots[uMAGAZINE_SIZE];
+	};
+
+	static u_int32 HeadIndex(u_int64 ulHead) { return static_cast<u_int32>(ulHead); }
+	static u_int64 MakeHead(u_int32 uIndex, u_int64 ulPreviousHead) { return ((ulPreviousHead >> 32) + 1) << 32 | uIndex; }
+
+	u_int32 PopShared()
+	{
+		u_int64 ulHead = m_ulHead.load(std::memory_order_acquire);
+		for (;;)
+		{
+			const u_int32 uIndex = HeadIndex(ulHead);
+			if (uIndex == uEND_OF_LIST)
+			{
+				return uEND_OF_LIST;
+			}
+			// May read a link another thread is rewriting; the tag makes the
+			// exchange below fail in that case.
+			const u_int32 uNext = m_puNext[uIndex].load(std::memory_order_relaxed);
+			if (m_ulHead.compare_exchange_weak(ulHead, MakeHead(uNext, ulHead), std::memory_order_acquire, std::memory_order_acquire))
+			{
+				m_uSharedFreeCount.fetch_sub(1, std::memory_order_relaxed);
+				return uIndex;
+			}
+		}
+	}
+
+	// Pushes the chain uFirst -> ... -> uLast (already linked) in one exchange.
+	void PushShared(u_int32 uFirst, u_int32 uLast, u_int uChainLength)
+	{
+		u_int64 ulHead = m_ulHead.load(std::memory_order_relaxed);
+		do
+		{
+			m_puNext[uLast].store(HeadIndex(ulHead), std::memory_order_relaxed);
+		} while (!m_ulHead.compare_exchange_weak(ulHead, MakeHead(uFirst, ulHead), std::memory_order_release, std::memory_order_relaxed));
+		m_uSharedFreeCount.fetch_add(uChainLength, std::memory_order_relaxed);
+	}
+
+	u_int Refill(Magazine& xMagazine)
+	{
+		u_int uFilled = 0;
+		while (uFilled < uMAGAZINE_BATCH)
+		{
+			const u_int32 uSlot = PopShared();
+			if (uSlot == uEND_OF_LIST)
+			{
+				break;
+			}
+			xMagazine.m_auSlots[uFilled++] = uSlot;
+		}
+		return uFilled;
+	}
+
+	// Returns the magazine's oldest uMAGAZINE_BATCH slots to the shared list.
+	u_int Spill(Magazine& xMagazine)
+	{
+		for (u_int u = 0; u + 1 < uMAGAZINE_BATCH; u++)
+		{
+			m_puNext[xMagazine.m_auSlots[u]].store(xMagazine.m_auSlots[u + 1], std::memory_order_relaxed);
+		}
+		PushShared(xMagazine.m_auSlots[0], xMagazine.m_auSlots[uMAGAZINE_BATCH - 1], uMAGAZINE_BATCH);
+
+		for (u_int u = uMAGAZINE_BATCH; u < uMAGAZINE_SIZE; u++)
+		{
+			xMagazine.m_auSlots[u - uMAGAZINE_BATCH] = xMagazine.m_auSlots[u];
+		}
+		return uMAGAZINE_SIZE - uMAGAZINE_BATCH;
+	}
+
+	// Called with the registry lock held, on the exiting thread that owns uCacheIndex.
+	static void DrainMagazineForExitingThread(void* pxPool, u_int uCacheIndex)
+	{
+		Zenith_ConcurrentMemoryPool& xPool = *static_cast<Zenith_ConcurrentMemoryPool*>(pxPool);
+		Magazine& xMagazine = xPool.m_pxMagazines[uCacheIndex];
+		const u_int uMagazineCount = xMagazine.m_uCount.load(std::memory_order_relaxed);
+		if (uMagazineCount == 0)
+		{
+			return;
+		}
+		for (u_int u = 0; u + 1 < uMagazineCount; u++)
+		{
+			xPool.m_puNext[xMagazine.m_auSlots[u]].store(xMagazine.m_auSlots[u + 1], std::memory_order_relaxed);
+		}
+		xPool.PushShared(xMagazine.m_auSlots[0], xMagazine.m_auSlots[uMagazineCount - 1], uMagazineCount);
+		xMagazine.m_uCount.store(0, std::memory_order_relaxed);
+	}
+
+	T* m_pxData = nullptr;
+	std::atomic<u_int32>* m_puNext = nullptr;   // Shared-list links, one per slot.
+	Magazine* m_pxMagazines = nullptr;          // One per cache index.
+	Zenith_ConcurrentMemoryPool_Detail::PoolRegistration m_xRegistration;
+#ifdef ZENITH_ASSERT
+	std::atomic<u_int8>* m_pucAllocated = nullptr;
+#endif
+	alignas(64) std::atomic<u_int64> m_ulHead{ 0 };   // Generation tag << 32 | first free slot.
+	std::atomic<u_int> m_uSharedFreeCount{ 0 };
+};
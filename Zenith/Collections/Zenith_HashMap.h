@@ -2,8 +2,18 @@
 
 
 #include "DataStream/Zenith_DataStream.h"
+#include <bit>
+#include <cstring>
 #include <functional>
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define ZENITH_HASHMAP_SSE2
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#include <arm_neon.h>
+#define ZENITH_HASHMAP_NEON
+#endif
+
 // Default hash traits. Delegates to std::hash<K> so existing custom
 // std::hash specialisations (e.g. std::hash<Flux_BarrierKey>) keep working
 // after migration. Specialise Zenith_Hash<MyKey> to bypass the STL hash when
@@ -17,6 +27,90 @@ struct Zenith_Hash
 	}
 };
 
+namespace Zenith_HashMap_Detail
+{
+	// Control bytes, one per slot. A full slot stores the 7-bit tag of its
+	// key's hash, so its top bit is clear; both free states have it set.
+	static constexpr u_int8 uCTRL_EMPTY = 0x80;
+	static constexpr u_int8 uCTRL_DELETED = 0xFE;
+	static constexpr u_int uGROUP_SIZE = 16;
+
+	inline bool IsFull(u_int8 uCtrl) { return (uCtrl & 0x80) == 0; }
+
+	// The control bytes of uGROUP_SIZE consecutive slots, matched all at once.
+	// Every Match returns a bitmask with bit i set for slot i of the group.
+	class Group
+	{
+	public:
+#if defined(ZENITH_HASHMAP_SSE2)
+		explicit Group(const u_int8* puCtrl) : m_xCtrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(puCtrl))) {}
+
+		u_int Match(u_int8 uTag) const
+		{
+			return static_cast<u_int>(_mm_movemask_epi8(_mm_cmpeq_epi8(m_xCtrl, _mm_set1_epi8(static_cast<char>(uTag)))));
+		}
+		u_int MatchEmpty() const { return Match(uCTRL_EMPTY); }
+		u_int MatchEmptyOrDeleted() const { return static_cast<u_int>(_mm_movemask_epi8(m_xCtrl)); }
+
+	private:
+		__m128i m_xCtrl;
+#elif defined(ZENITH_HASHMAP_NEON)
+		explicit Group(const u_int8* puCtrl) : m_xCtrl(vld1q_u8(puCtrl)) {}
+
+		u_int Match(u_int8 uTag) const { return ToMask(vceqq_u8(m_xCtrl, vdupq_n_u8(uTag))); }
+		u_int MatchEmpty() const { return Match(uCTRL_EMPTY); }
+		u_int MatchEmptyOrDeleted() const { return ToMask(vcgeq_u8(m_xCtrl, vdupq_n_u8(0x80))); }
+
+	private:
+		// NEON has no movemask: weight each all-ones lane by its bit and sum each half.
+		static u_int ToMask(uint8x16_t xLanes)
+		{
+			static const u_int8 aucBITS[uGROUP_SIZE] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+			const uint8x16_t xBits = vandq_u8(xLanes, vld1q_u8(aucBITS));
+			return static_cast<u_int>(vaddv_u8(vget_low_u8(xBits))) | (static_cast<u_int>(vaddv_u8(vget_high_u8(xBits))) << 8);
+		}
+
+		uint8x16_t m_xCtrl;
+#else
+		explicit Group(const u_int8* puCtrl) { memcpy(m_aucCtrl, puCtrl, uGROUP_SIZE); }
+
+		u_int Match(u_int8 uTag) const
+		{
+			u_int uMask = 0;
+			for (u_int u = 0; u < uGROUP_SIZE; u++)
+			{
+				uMask |= static_cast<u_int>(m_aucCtrl[u] == uTag) << u;
+			}
+			return uMask;
+		}
+		u_int MatchEmpty() const { return Match(uCTRL_EMPTY); }
+		u_int MatchEmptyOrDeleted() const
+		{
+			u_int uMask = 0;
+			for (u_int u = 0; u < uGROUP_SIZE; u++)
+			{
+				uMask |= static_cast<u_int>(m_aucCtrl[u] >> 7) << u;
+			}
+			return uMask;
+		}
+
+	private:
+		u_int8 m_aucCtrl[uGROUP_SIZE];
+#endif
+	};
+}
+
+// Open-addressing hash map with Swiss-table group probing. Slots are split
+// into aligned groups of 16; each slot's control byte holds a 7-bit tag from
+// its key's hash (or EMPTY / DELETED), and a probe compares a whole group's
+// tags against the key's tag in one SSE2 / NEON instruction. Full keys are
+// compared only on a tag match, so a miss on std::string keys costs almost no
+// string compares. Groups are probed in triangular order; a lookup ends at the
+// first group holding an EMPTY slot.
+//
+// Remove writes EMPTY instead of a tombstone when the slot's group still has
+// an EMPTY slot (no probe chain can run through such a group), so tombstones
+// only accumulate in full groups and are dropped on the next rehash.
 template<typename K, typename V, typename Hasher = Zenith_Hash<K>>
 class Zenith_HashMap
 {
@@ -130,7 +224,7 @@ public:
 		DestroyAll();
 		if (m_puMeta != nullptr)
 		{
-			for (u_int u = 0; u < m_uCapacity; u++) m_puMeta[u] = uMETA_EMPTY;
+			memset(m_puMeta, Zenith_HashMap_Detail::uCTRL_EMPTY, m_uCapacity);
 		}
 		m_uSize = 0;
 		m_uTombstones = 0;
@@ -148,13 +242,13 @@ public:
 	{
 		EnsureCapacityForInsert();
 		u_int uSlot;
-		bool bIsNew = LocateForInsert(xKey, uSlot);
+		u_int8 uTag;
+		bool bIsNew = LocateForInsert(xKey, uSlot, uTag);
 		if (bIsNew)
 		{
 			new (&m_pxKeys[uSlot]) K(xKey);
 			new (&m_pxValues[uSlot]) V(xValue);
-			m_puMeta[uSlot] = uMETA_OCCUPIED;
-			m_uSize++;
+			MarkOccupied(uSlot, uTag);
 		}
 		else
 		{
@@ -168,13 +262,13 @@ public:
 	{
 		EnsureCapacityForInsert();
 		u_int uSlot;
-		bool bIsNew = LocateForInsert(xKey, uSlot);
+		u_int8 uTag;
+		bool bIsNew = LocateForInsert(xKey, uSlot, uTag);
 		if (bIsNew)
 		{
 			new (&m_pxKeys[uSlot]) K(xKey);
 			new (&m_pxValues[uSlot]) V(std::move(xValue));
-			m_puMeta[uSlot] = uMETA_OCCUPIED;
-			m_uSize++;
+			MarkOccupied(uSlot, uTag);
 		}
 		else
 		{
@@ -189,13 +283,13 @@ public:
 	{
 		EnsureCapacityForInsert();
 		u_int uSlot;
-		bool bIsNew = LocateForInsert(xKey, uSlot);
+		u_int8 uTag;
+		bool bIsNew = LocateForInsert(xKey, uSlot, uTag);
 		if (bIsNew)
 		{
 			new (&m_pxKeys[uSlot]) K(xKey);
 			new (&m_pxValues[uSlot]) V(std::forward<Args>(args)...);
-			m_puMeta[uSlot] = uMETA_OCCUPIED;
-			m_uSize++;
+			MarkOccupied(uSlot, uTag);
 		}
 		else
 		{
@@ -211,9 +305,19 @@ public:
 		if (!LocateExisting(xKey, uSlot)) return false;
 		m_pxKeys[uSlot].~K();
 		m_pxValues[uSlot].~V();
-		m_puMeta[uSlot] = uMETA_TOMBSTONE;
 		m_uSize--;
-		m_uTombstones++;
+		// A group with an EMPTY slot never sent a probe on to the next group,
+		// so the slot can go straight back to EMPTY without breaking a chain.
+		const u_int uGroupBase = uSlot & ~(Zenith_HashMap_Detail::uGROUP_SIZE - 1);
+		if (Zenith_HashMap_Detail::Group(m_puMeta + uGroupBase).MatchEmpty() != 0)
+		{
+			m_puMeta[uSlot] = Zenith_HashMap_Detail::uCTRL_EMPTY;
+		}
+		else
+		{
+			m_puMeta[uSlot] = Zenith_HashMap_Detail::uCTRL_DELETED;
+			m_uTombstones++;
+		}
 		return true;
 	}
 
@@ -257,13 +361,13 @@ public:
 	{
 		EnsureCapacityForInsert();
 		u_int uSlot;
-		bool bIsNew = LocateForInsert(xKey, uSlot);
+		u_int8 uTag;
+		bool bIsNew = LocateForInsert(xKey, uSlot, uTag);
 		if (bIsNew)
 		{
 			new (&m_pxKeys[uSlot]) K(xKey);
 			new (&m_pxValues[uSlot]) V();
-			m_puMeta[uSlot] = uMETA_OCCUPIED;
-			m_uSize++;
+			MarkOccupied(uSlot, uTag);
 		}
 		return m_pxValues[uSlot];
 	}
@@ -306,7 +410,7 @@ public:
 		xStream << m_uSize;
 		for (u_int u = 0; u < m_uCapacity; u++)
 		{
-			if (m_puMeta[u] == uMETA_OCCUPIED)
+			if (Zenith_HashMap_Detail::IsFull(m_puMeta[u]))
 			{
 				xStream << m_pxKeys[u];
 				xStream << m_pxValues[u];
@@ -366,7 +470,7 @@ public:
 	private:
 		void AdvanceToOccupied()
 		{
-			while (m_uIndex < m_xMap.m_uCapacity && m_xMap.m_puMeta[m_uIndex] != uMETA_OCCUPIED)
+			while (m_uIndex < m_xMap.m_uCapacity && !Zenith_HashMap_Detail::IsFull(m_xMap.m_puMeta[m_uIndex]))
 			{
 				m_uIndex++;
 			}
@@ -378,10 +482,8 @@ public:
 	};
 
 private:
-	static constexpr u_int uDEFAULT_INITIAL_CAPACITY = 16;
-	static constexpr u_int8 uMETA_EMPTY = 0;
-	static constexpr u_int8 uMETA_OCCUPIED = 1;
-	static constexpr u_int8 uMETA_TOMBSTONE = 2;
+	// At least one group; every capacity is a whole number of groups.
+	static constexpr u_int uDEFAULT_INITIAL_CAPACITY = Zenith_HashMap_Detail::uGROUP_SIZE;
 
 	static u_int RoundUpToPowerOfTwo(u_int uValue)
 	{
@@ -408,7 +510,7 @@ private:
 		Zenith_Assert(m_pxKeys != nullptr && m_pxValues != nullptr && m_puMeta != nullptr,
 			"Zenith_HashMap allocation failed for capacity %u", uCapacity);
 
-		for (u_int u = 0; u < uCapacity; u++) m_puMeta[u] = uMETA_EMPTY;
+		memset(m_puMeta, Zenith_HashMap_Detail::uCTRL_EMPTY, uCapacity);
 		m_uCapacity = uCapacity;
 	}
 
@@ -428,7 +530,7 @@ private:
 		if (m_puMeta == nullptr) return;
 		for (u_int u = 0; u < m_uCapacity; u++)
 		{
-			if (m_puMeta[u] == uMETA_OCCUPIED)
+			if (Zenith_HashMap_Detail::IsFull(m_puMeta[u]))
 			{
 				m_pxKeys[u].~K();
 				m_pxValues[u].~V();
@@ -483,15 +585,15 @@ private:
 		{
 			for (u_int u = 0; u < uOldCapacity; u++)
 			{
-				if (puOldMeta[u] == uMETA_OCCUPIED)
+				if (Zenith_HashMap_Detail::IsFull(puOldMeta[u]))
 				{
 					u_int uSlot;
+					u_int8 uTag;
 					// New table has no duplicates and enough room - always a fresh slot
-					LocateForInsert(pxOldKeys[u], uSlot);
+					LocateForInsert(pxOldKeys[u], uSlot, uTag);
 					new (&m_pxKeys[uSlot]) K(std::move(pxOldKeys[u]));
 					new (&m_pxValues[uSlot]) V(std::move(pxOldValues[u]));
-					m_puMeta[uSlot] = uMETA_OCCUPIED;
-					m_uSize++;
+					MarkOccupied(uSlot, uTag);
 					pxOldKeys[u].~K();
 					pxOldValues[u].~V();
 				}
@@ -502,67 +604,103 @@ private:
 		}
 	}
 
+	// Splits a key's hash into the probe start (high half) and the 7-bit tag
+	// kept in its slot's control byte. The multiply spreads std::hash results
+	// that are the identity for integers (libstdc++) across both.
+	static u_int64 MixHash(const K& xKey)
+	{
+		return Hasher{}(xKey) * 0x9E3779B97F4A7C15ull;
+	}
+	static u_int8 TagOf(u_int64 ulMixed) { return static_cast<u_int8>((ulMixed >> 25) & 0x7F); }
+	u_int FirstGroupOf(u_int64 ulMixed) const
+	{
+		return static_cast<u_int>(ulMixed >> 32) & (m_uCapacity / Zenith_HashMap_Detail::uGROUP_SIZE - 1);
+	}
+
+	void MarkOccupied(u_int uSlot, u_int8 uTag)
+	{
+		if (m_puMeta[uSlot] == Zenith_HashMap_Detail::uCTRL_DELETED)
+		{
+			m_uTombstones--;
+		}
+		m_puMeta[uSlot] = uTag;
+		m_uSize++;
+	}
+
 	// Finds the slot for xKey. Returns true if this will be a new insert
-	// (slot is EMPTY or TOMBSTONE); returns false if the key already exists
-	// (slot is OCCUPIED with a matching key). uSlotOut is the target slot in
-	// either case.
-	bool LocateForInsert(const K& xKey, u_int& uSlotOut) const
+	// (slot is EMPTY or DELETED, and uTagOut is the tag to store); returns
+	// false if the key already exists. uSlotOut is the target slot in either
+	// case.
+	bool LocateForInsert(const K& xKey, u_int& uSlotOut, u_int8& uTagOut) const
 	{
 		Zenith_Assert(m_uCapacity > 0, "Zenith_HashMap::LocateForInsert on empty table");
-		const u_int64 ulHash = Hasher{}(xKey);
-		const u_int uMask = m_uCapacity - 1;
-		u_int uSlot = static_cast<u_int>(ulHash) & uMask;
-		u_int uFirstTombstone = m_uCapacity; // sentinel = none
-
-		for (u_int uProbe = 0; uProbe < m_uCapacity; uProbe++)
+		const u_int64 ulMixed = MixHash(xKey);
+		const u_int8 uTag = TagOf(ulMixed);
+		const u_int uGroupMask = m_uCapacity / Zenith_HashMap_Detail::uGROUP_SIZE - 1;
+		u_int uGroup = FirstGroupOf(ulMixed);
+		u_int uFirstFree = m_uCapacity; // sentinel = none
+		uTagOut = uTag;
+
+		for (u_int uProbe = 0; uProbe <= uGroupMask; uProbe++)
 		{
-			const u_int8 uState = m_puMeta[uSlot];
-			if (uState == uMETA_EMPTY)
+			const u_int uBase = uGroup * Zenith_HashMap_Detail::uGROUP_SIZE;
+			const Zenith_HashMap_Detail::Group xGroup(m_puMeta + uBase);
+			for (u_int uMatch = xGroup.Match(uTag); uMatch != 0; uMatch &= uMatch - 1)
 			{
-				// First empty slot ends the probe chain. If we saw a tombstone
-				// earlier, prefer it to keep the chain short.
-				uSlotOut = (uFirstTombstone != m_uCapacity) ? uFirstTombstone : uSlot;
-				return true;
+				const u_int uSlot = uBase + static_cast<u_int>(std::countr_zero(uMatch));
+				if (m_pxKeys[uSlot] == xKey)
+				{
+					uSlotOut = uSlot;
+					return false;
+				}
 			}
-			if (uState == uMETA_OCCUPIED && m_pxKeys[uSlot] == xKey)
+			// The first free slot on the chain (a DELETED one keeps the chain
+			// short), but only an EMPTY slot proves the key is absent.
+			const u_int uFree = xGroup.MatchEmptyOrDeleted();
+			if (uFree != 0 && uFirstFree == m_uCapacity)
 			{
-				uSlotOut = uSlot;
-				return false;
+				uFirstFree = uBase + static_cast<u_int>(std::countr_zero(uFree));
 			}
-			if (uState == uMETA_TOMBSTONE && uFirstTombstone == m_uCapacity)
+			if (xGroup.MatchEmpty() != 0)
 			{
-				uFirstTombstone = uSlot;
+				uSlotOut = uFirstFree;
+				return true;
 			}
-			uSlot = (uSlot + 1) & uMask;
+			uGroup = (uGroup + uProbe + 1) & uGroupMask;
 		}
 
-		// Table is saturated with OCCUPIED + TOMBSTONE — fall back to tombstone
-		// if we saw one. A saturated all-OCCUPIED table cannot happen because
-		// EnsureCapacityForInsert rehashes before that point.
-		Zenith_Assert(uFirstTombstone != m_uCapacity,
-			"Zenith_HashMap::LocateForInsert: probe exhausted with no empty or tombstone slot");
-		uSlotOut = uFirstTombstone;
+		// Every group is full or DELETED. A table with no free slot at all
+		// cannot happen because EnsureCapacityForInsert rehashes before that.
+		Zenith_Assert(uFirstFree != m_uCapacity,
+			"Zenith_HashMap::LocateForInsert: probe exhausted with no empty or deleted slot");
+		uSlotOut = uFirstFree;
 		return true;
 	}
 
-	// Finds an OCCUPIED slot with a matching key. Returns false if not present.
+	// Finds a full slot with a matching key. Returns false if not present.
 	bool LocateExisting(const K& xKey, u_int& uSlotOut) const
 	{
 		if (m_uCapacity == 0) return false;
-		const u_int64 ulHash = Hasher{}(xKey);
-		const u_int uMask = m_uCapacity - 1;
-		u_int uSlot = static_cast<u_int>(ulHash) & uMask;
+		const u_int64 ulMixed = MixHash(xKey);
+		const u_int8 uTag = TagOf(ulMixed);
+		const u_int uGroupMask = m_uCapacity / Zenith_HashMap_Detail::uGROUP_SIZE - 1;
+		u_int uGroup = FirstGroupOf(ulMixed);
 
-		for (u_int uProbe = 0; uProbe < m_uCapacity; uProbe++)
+		for (u_int uProbe = 0; uProbe <= uGroupMask; uProbe++)
 		{
-			const u_int8 uState = m_puMeta[uSlot];
-			if (uState == uMETA_EMPTY) return false;
-			if (uState == uMETA_OCCUPIED && m_pxKeys[uSlot] == xKey)
+			const u_int uBase = uGroup * Zenith_HashMap_Detail::uGROUP_SIZE;
+			const Zenith_HashMap_Detail::Group xGroup(m_puMeta + uBase);
+			for (u_int uMatch = xGroup.Match(uTag); uMatch != 0; uMatch &= uMatch - 1)
 			{
-				uSlotOut = uSlot;
-				return true;
+				const u_int uSlot = uBase + static_cast<u_int>(std::countr_zero(uMatch));
+				if (m_pxKeys[uSlot] == xKey)
+				{
+					uSlotOut = uSlot;
+					return true;
+				}
 			}
-			uSlot = (uSlot + 1) & uMask;
+			if (xGroup.MatchEmpty() != 0) return false;
+			uGroup = (uGroup + uProbe + 1) & uGroupMask;
 		}
 		return false;
 	}
@@ -590,14 +728,14 @@ private:
 		m_uTombstones = 0;
 		for (u_int u = 0; u < xOther.m_uCapacity; u++)
 		{
-			if (xOther.m_puMeta[u] != uMETA_OCCUPIED) continue;
+			if (!Zenith_HashMap_Detail::IsFull(xOther.m_puMeta[u])) continue;
 			u_int uSlot;
+			u_int8 uTag;
 			// Fresh table, no duplicates possible — always a new slot.
-			LocateForInsert(xOther.m_pxKeys[u], uSlot);
+			LocateForInsert(xOther.m_pxKeys[u], uSlot, uTag);
 			new (&m_pxKeys[uSlot]) K(xOther.m_pxKeys[u]);
 			new (&m_pxValues[uSlot]) V(xOther.m_pxValues[u]);
-			m_puMeta[uSlot] = uMETA_OCCUPIED;
-			m_uSize++;
+			MarkOccupied(uSlot, uTag);
 		}
 	}
 
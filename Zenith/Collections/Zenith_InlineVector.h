@@ -0,0 +1,433 @@
+#pragma once
+
+#include "Collections/Zenith_Vector.h"
+
+// Zenith_InlineVector<T, N> - Zenith_Vector with room for N elements inside
+// the object itself. Up to N elements cost no allocation and no pointer chase
+// into a separate block; past N it spills to the heap (through TAllocator) and
+// grows by doubling, exactly like Zenith_Vector. It never moves back inline on
+// its own: Clear keeps a spilled buffer, as Zenith_Vector keeps its capacity.
+//
+// For the many small per-object lists (a polygon's few vertex indices, a grid
+// cell's handful of polygons) where a Zenith_Vector would spend a whole heap
+// block, and its 8-element default reservation, on two or three entries.
+//
+// Same API and the same DataStream wire format as Zenith_Vector (u_int count,
+// then the elements), so a field can switch type without touching its readers,
+// writers or saved data. m_pxData always points at the live storage (inline or
+// heap), so element access is the same single load as Zenith_Vector's; the
+// cost is that a move or copy must re-point it, and an inline move is O(size).
+template<typename T, u_int N, typename TAllocator = Zenith_HeapVectorAllocator>
+class Zenith_InlineVector
+{
+	static_assert(N > 0, "Zenith_InlineVector needs at least one inline element; use Zenith_Vector");
+
+public:
+	static constexpr u_int uINLINE_CAPACITY = N;
+
+	Zenith_InlineVector() = default;
+
+	explicit Zenith_InlineVector(u_int uCapacity)
+	{
+		Reserve(uCapacity);
+	}
+
+	Zenith_InlineVector(const Zenith_InlineVector& xOther)
+	{
+		CopyFromOther(xOther);
+	}
+
+	Zenith_InlineVector(Zenith_InlineVector&& xOther)
+	{
+		MoveFromOther(std::move(xOther));
+	}
+
+	Zenith_InlineVector& operator=(const Zenith_InlineVector& xOther)
+	{
+		if (this == &xOther) return *this;  // Self-assignment check - prevents use-after-free
+		Clear();
+		CopyFromOther(xOther);
+		return *this;
+	}
+
+	Zenith_InlineVector& operator=(Zenith_InlineVector&& xOther)
+	{
+		if (this == &xOther) return *this;  // Self-assignment check - prevents use-after-free
+		Clear();
+		ReleaseHeap();
+		MoveFromOther(std::move(xOther));
+		return *this;
+	}
+
+	~Zenith_InlineVector()
+	{
+		Clear();
+		ReleaseHeap();
+	}
+
+	u_int GetSize() const { return m_uSize; }
+	u_int GetCapacity() const { return m_uCapacity; }
+
+	// True while the elements live in the object (no heap block held).
+	bool IsInline() const { return m_pxData == InlineData(); }
+
+	void PushBack(const T& xValue)
+	{
+		if (m_uSize >= m_uCapacity)
+		{
+			// xValue may alias an element; copy it before the buffer moves.
+			T xCopy(xValue);
+			Grow();
+			new (&m_pxData[m_uSize]) T(std::move(xCopy));
+		}
+		else
+		{
+			new (&m_pxData[m_uSize]) T(xValue);
+		}
+		m_uSize++;
+	}
+
+	void PushBack(T&& xValue)
+	{
+		if (m_uSize >= m_uCapacity)
+		{
+			T xMoved(std::move(xValue));
+			Grow();
+			new (&m_pxData[m_uSize]) T(std::move(xMoved));
+		}
+		else
+		{
+			new (&m_pxData[m_uSize]) T(std::move(xValue));
+		}
+		m_uSize++;
+	}
+
+	template<typename... Args>
+	void EmplaceBack(Args&&... args)
+	{
+		if (m_uSize >= m_uCapacity) Grow();
+
+		new (&m_pxData[m_uSize]) T(std::forward<Args>(args)...);
+		m_uSize++;
+	}
+
+	T& Get(u_int uIndex)
+	{
+		Zenith_Assert(uIndex < m_uSize, "Index %u out of range (size=%u)", uIndex, m_uSize);
+		return m_pxData[uIndex];
+	}
+
+	const T& Get(u_int uIndex) const
+	{
+		Zenith_Assert(uIndex < m_uSize, "Index %u out of range (size=%u)", uIndex, m_uSize);
+		return m_pxData[uIndex];
+	}
+
+	T& GetFront()
+	{
+		Zenith_Assert(m_uSize > 0, "Vector is empty");
+		return m_pxData[0];
+	}
+
+	const T& GetFront() const
+	{
+		Zenith_Assert(m_uSize > 0, "Vector is empty");
+		return m_pxData[0];
+	}
+
+	T& GetBack()
+	{
+		Zenith_Assert(m_uSize > 0, "Vector is empty");
+		return m_pxData[m_uSize - 1];
+	}
+
+	const T& GetBack() const
+	{
+		Zenith_Assert(m_uSize > 0, "Vector is empty");
+		return m_pxData[m_uSize - 1];
+	}
+
+	T* GetDataPointer() { return m_pxData; }
+	const T* GetDataPointer() const { return m_pxData; }
+
+	T*       begin()       { return m_pxData; }
+	T*       end()         { return m_pxData + m_uSize; }
+	const T* begin() const { return m_pxData; }
+	const T* end()   const { return m_pxData + m_uSize; }
+
+	u_int Find(const T& xValue) const
+	{
+		for (u_int u = 0; u < m_uSize; u++)
+		{
+			if (m_pxData[u] == xValue) return u;
+		}
+		return m_uSize;
+	}
+
+	template<typename Predicate>
+	u_int FindIf(Predicate pfnPredicate) const
+	{
+		for (u_int u = 0; u < m_uSize; u++)
+		{
+			if (pfnPredicate(m_pxData[u])) return u;
+		}
+		return m_uSize;
+	}
+
+	bool Contains(const T& xValue) const { return Find(xValue) != m_uSize; }
+
+	bool Erase(u_int uIndex)
+	{
+		if (uIndex >= m_uSize) return false;
+		Remove(uIndex);
+		return true;
+	}
+
+	bool EraseValue(const T& xValue)
+	{
+		u_int uIndex = Find(xValue);
+		if (uIndex != m_uSize)
+		{
+			Remove(uIndex);
+			return true;
+		}
+		return false;
+	}
+
+	// O(1) swap-and-pop removal - does NOT preserve order
+	void RemoveSwap(u_int uIndex)
+	{
+		Zenith_Assert(uIndex < m_uSize, "RemoveSwap: Index out of range");
+
+		if (uIndex != m_uSize - 1)
+		{
+			m_pxData[uIndex].~T();
+			new (&m_pxData[uIndex]) T(std::move(m_pxData[m_uSize - 1]));
+		}
+
+		m_pxData[m_uSize - 1].~T();
+		m_uSize--;
+	}
+
+	bool EraseSwap(u_int uIndex)
+	{
+		if (uIndex >= m_uSize) return false;
+		RemoveSwap(uIndex);
+		return true;
+	}
+
+	bool EraseValueSwap(const T& xValue)
+	{
+		u_int uIndex = Find(xValue);
+		if (uIndex != m_uSize)
+		{
+			RemoveSwap(uIndex);
+			return true;
+		}
+		return false;
+	}
+
+	// O(n) removal that preserves order
+	void Remove(u_int uIndex)
+	{
+		Zenith_Assert(uIndex < m_uSize, "Index out of range");
+		m_pxData[uIndex].~T();
+		for (u_int u = uIndex; u < m_uSize - 1; u++)
+		{
+			new (&m_pxData[u]) T(std::move(m_pxData[u + 1]));
+			m_pxData[u + 1].~T();
+		}
+		m_uSize--;
+	}
+
+	void Clear()
+	{
+		for (u_int u = 0; u < m_uSize; u++)
+		{
+			m_pxData[u].~T();
+		}
+		m_uSize = 0;
+	}
+
+	void PopBack()
+	{
+		Zenith_Assert(m_uSize > 0, "Cannot pop from empty vector");
+		m_pxData[m_uSize - 1].~T();
+		m_uSize--;
+	}
+
+	void Reverse()
+	{
+		for (u_int u = 0; u < m_uSize / 2; u++)
+		{
+			u_int uOther = m_uSize - 1 - u;
+			T xTemp(std::move(m_pxData[u]));
+			m_pxData[u].~T();
+			new (&m_pxData[u]) T(std::move(m_pxData[uOther]));
+			m_pxData[uOther].~T();
+			new (&m_pxData[uOther]) T(std::move(xTemp));
+		}
+	}
+
+	// std::vector-style resize, as Zenith_Vector::Resize.
+	void Resize(u_int uNewSize, const T& xValue = T())
+	{
+		if (uNewSize > m_uCapacity) Reserve(uNewSize);
+
+		for (u_int u = uNewSize; u < m_uSize; u++) m_pxData[u].~T();
+		for (u_int u = m_uSize; u < uNewSize; u++) new (&m_pxData[u]) T(xValue);
+
+		m_uSize = uNewSize;
+	}
+
+	// Capacities up to N are already met inline; anything larger spills.
+	void Reserve(u_int uNewCapacity)
+	{
+		if (uNewCapacity <= m_uCapacity) return;
+
+		constexpr u_int uMAX_SAFE_CAPACITY = UINT_MAX / sizeof(T);
+		Zenith_Assert(uNewCapacity <= uMAX_SAFE_CAPACITY,
+			"Reserve: capacity %u would overflow when multiplied by sizeof(T)=%zu", uNewCapacity, sizeof(T));
+		if (uNewCapacity > uMAX_SAFE_CAPACITY) return;
+
+		// Invalidate any active iterators - buffer is being reallocated
+		m_uGeneration++;
+
+		T* pNewData = static_cast<T*>(TAllocator::Allocate(uNewCapacity * sizeof(T)));
+		Zenith_Assert(pNewData != nullptr,
+			"Reserve: allocation failed for capacity %u (requested %zu bytes)", uNewCapacity, uNewCapacity * sizeof(T));
+		if (pNewData == nullptr) return;  // Fail gracefully in release builds
+
+		for (u_int u = 0; u < m_uSize; u++)
+		{
+			new (&pNewData[u]) T(std::move(m_pxData[u]));
+			m_pxData[u].~T();
+		}
+		ReleaseHeap();
+		m_pxData = pNewData;
+		m_uCapacity = uNewCapacity;
+	}
+
+	void ReadFromDataStream(Zenith_DataStream& xStream)
+	{
+		Zenith_Vector_Detail::ReadElementsFromDataStream<T>(*this, xStream);
+	}
+
+	void WriteToDataStream(Zenith_DataStream& xStream) const
+	{
+		xStream << m_uSize;
+		for (u_int u = 0; u < m_uSize; u++)
+		{
+			xStream << m_pxData[u];
+		}
+	}
+
+	class Iterator
+	{
+	public:
+		explicit Iterator(const Zenith_InlineVector& xVec)
+		: m_xVec(xVec)
+		, m_uIndex(0)
+		, m_uGeneration(xVec.m_uGeneration)
+		{}
+
+		void Next()
+		{
+			Zenith_Assert(m_uGeneration == m_xVec.m_uGeneration,
+				"Iterator invalidated: vector was reallocated during iteration. Iterator generation: %u, Vector generation %u", m_uGeneration, m_xVec.m_uGeneration);
+			Zenith_Assert(m_uIndex < m_xVec.GetSize(), "Iterated past end of vector of size %u", m_xVec.GetSize());
+			m_uIndex++;
+		}
+
+		bool Done() const
+		{
+			Zenith_Assert(m_uGeneration == m_xVec.m_uGeneration,
+				"Iterator invalidated: vector was reallocated during iteration");
+			return m_uIndex == m_xVec.GetSize();
+		}
+
+		const T& GetData() const
+		{
+			Zenith_Assert(m_uGeneration == m_xVec.m_uGeneration,
+				"Iterator invalidated: vector was reallocated during iteration");
+			return m_xVec.Get(m_uIndex);
+		}
+
+	private:
+		const Zenith_InlineVector& m_xVec;
+		u_int m_uIndex;
+		u_int m_uGeneration;
+	};
+
+private:
+	T* InlineData() { return reinterpret_cast<T*>(m_auInline); }
+	const T* InlineData() const { return reinterpret_cast<const T*>(m_auInline); }
+
+	void Grow()
+	{
+		if (m_uCapacity > UINT_MAX / 2)
+		{
+			constexpr u_int uMAX_SAFE_CAPACITY = UINT_MAX / sizeof(T);
+			Zenith_Assert(uMAX_SAFE_CAPACITY > m_uCapacity, "Grow: cannot grow vector further - at maximum capacity");
+			Reserve(uMAX_SAFE_CAPACITY);
+			return;
+		}
+		Reserve(m_uCapacity * 2);
+	}
+
+	// Frees a spilled buffer (elements already destroyed or moved out) and
+	// returns to the inline storage.
+	void ReleaseHeap()
+	{
+		if (!IsInline())
+		{
+			TAllocator::Deallocate(m_pxData);
+			m_pxData = InlineData();
+			m_uCapacity = N;
+		}
+	}
+
+	// Precondition: *this is empty.
+	void CopyFromOther(const Zenith_InlineVector& xOther)
+	{
+		Reserve(xOther.m_uSize);
+		if (m_uCapacity < xOther.m_uSize) return;  // Reserve failed and asserted
+
+		// Use placement new with copy construction for proper handling of non-trivial types
+		for (u_int u = 0; u < xOther.m_uSize; u++)
+		{
+			new (&m_pxData[u]) T(xOther.m_pxData[u]);
+		}
+		m_uSize = xOther.m_uSize;
+	}
+
+	// Precondition: *this is empty and inline. Leaves xOther empty and inline.
+	void MoveFromOther(Zenith_InlineVector&& xOther)
+	{
+		if (!xOther.IsInline())
+		{
+			// Spilled: take the heap block whole.
+			m_pxData = xOther.m_pxData;
+			m_uCapacity = xOther.m_uCapacity;
+			m_uSize = xOther.m_uSize;
+			xOther.m_pxData = xOther.InlineData();
+			xOther.m_uCapacity = N;
+			xOther.m_uSize = 0;
+			return;
+		}
+
+		for (u_int u = 0; u < xOther.m_uSize; u++)
+		{
+			new (&m_pxData[u]) T(std::move(xOther.m_pxData[u]));
+			xOther.m_pxData[u].~T();
+		}
+		m_uSize = xOther.m_uSize;
+		xOther.m_uSize = 0;
+	}
+
+	T* m_pxData = InlineData();
+	u_int m_uSize = 0;
+	u_int m_uCapacity = N;
+	u_int m_uGeneration = 0;  // Incremented on reallocation to detect iterator invalidation
+	alignas(T) u_int8 m_auInline[N * sizeof(T)];
+};
@@ -1,9 +1,80 @@
 #pragma once
 
 
+#include "Collections/Zenith_Vector_Fwd.h"
 #include "DataStream/Zenith_DataStream.h"
 
-template<typename T>
+// Where a Zenith_Vector's buffer comes from. A policy is a type with static
+//   void* Allocate(size_t ulBytes);   // aligned for any fundamental type
+//   void  Deallocate(void* p);        // p may be null
+// and no state, so the vector stays three words and a generation counter.
+//
+// The default is the bare Zenith_MemoryManagement malloc path. Transient
+// per-frame lists use Zenith_FrameVectorAllocator (Core/Memory/
+// Zenith_FrameAllocator.h) through the Zenith_FrameVector<T> alias instead.
+struct Zenith_HeapVectorAllocator
+{
+	static void* Allocate(size_t ulBytes) { return Zenith_MemoryManagement::Allocate(ulBytes); }
+	static void Deallocate(void* p) { Zenith_MemoryManagement::Deallocate(p); }
+};
+
+namespace Zenith_Vector_Detail
+{
+	// Shared by Zenith_Vector and Zenith_InlineVector: a u_int count followed by
+	// that many elements. The count is validated before anything is reserved so a
+	// corrupted stream cannot trigger a huge allocation, and a short stream leaves
+	// the container empty rather than half-filled.
+	template<typename T, typename TContainer>
+	void ReadElementsFromDataStream(TContainer& xContainer, Zenith_DataStream& xStream)
+	{
+		u_int uSize;
+		xStream >> uSize;
+
+		// Sanity check to prevent allocation of absurd sizes from corrupted data
+		constexpr u_int uMAX_REASONABLE_SIZE = 100000000;
+		Zenith_Assert(uSize <= uMAX_REASONABLE_SIZE,
+			"ReadFromDataStream: Size %u exceeds reasonable limit - possible data corruption", uSize);
+		if (uSize > uMAX_REASONABLE_SIZE)
+		{
+			Zenith_Error(LOG_CATEGORY_CORE, "ReadFromDataStream: Size %u exceeds limit, aborting", uSize);
+			return;
+		}
+
+		// Check for integer overflow
+		constexpr u_int uMAX_SAFE_CAPACITY = UINT_MAX / sizeof(T);
+		if (uSize > uMAX_SAFE_CAPACITY)
+		{
+			Zenith_Error(LOG_CATEGORY_CORE, "ReadFromDataStream: Size %u would overflow allocation", uSize);
+			return;
+		}
+
+		xContainer.Clear();
+		xContainer.Reserve(uSize);
+
+		// Verify Reserve succeeded
+		if (uSize > 0 && xContainer.GetCapacity() < uSize)
+		{
+			Zenith_Error(LOG_CATEGORY_CORE, "ReadFromDataStream: Reserve failed (capacity=%u, needed=%u)", xContainer.GetCapacity(), uSize);
+			return;
+		}
+
+		for (u_int u = 0; u < uSize; u++)
+		{
+			// Check stream has remaining data
+			if (xStream.GetCursor() >= xStream.GetCapacity())
+			{
+				Zenith_Error(LOG_CATEGORY_CORE, "ReadFromDataStream: Premature end of stream at element %u of %u - clearing partial data", u, uSize);
+				xContainer.Clear();  // Clear partial data to prevent inconsistent state
+				return;
+			}
+			T x;
+			xStream >> x;
+			xContainer.PushBack(x);
+		}
+	}
+}
+
+template<typename T, typename TAllocator>
 class Zenith_Vector
 {
 public:
@@ -21,7 +92,7 @@ public:
 			Zenith_Assert(uCapacity <= uMAX_SAFE_CAPACITY,
 				"Vector capacity %u would overflow when multiplied by sizeof(T)=%zu", uCapacity, sizeof(T));
 
-			m_pxData = static_cast<T*>(Zenith_MemoryManagement::Allocate(uCapacity * sizeof(T)));
+			m_pxData = static_cast<T*>(TAllocator::Allocate(uCapacity * sizeof(T)));
 			Zenith_Assert(m_pxData != nullptr,
 				"Vector allocation failed for capacity %u (requested %zu bytes)", uCapacity, uCapacity * sizeof(T));
 		}
@@ -65,7 +136,7 @@ public:
 				"operator=: capacity %u would overflow", uNewCapacity);
 			if (uNewCapacity > uMAX_SAFE_CAPACITY) return *this;  // Fail gracefully
 
-			pNewData = static_cast<T*>(Zenith_MemoryManagement::Allocate(uNewCapacity * sizeof(T)));
+			pNewData = static_cast<T*>(TAllocator::Allocate(uNewCapacity * sizeof(T)));
 			if (pNewData == nullptr)
 			{
 				Zenith_Assert(false, "operator=: allocation failed for capacity %u", uNewCapacity);
@@ -81,7 +152,7 @@ public:
 
 		// New buffer successfully created - now safe to destroy old data
 		Clear();
-		Zenith_MemoryManagement::Deallocate(m_pxData);
+		TAllocator::Deallocate(m_pxData);
 
 		// Take ownership of new data
 		m_pxData = pNewData;
@@ -95,7 +166,7 @@ public:
 	{
 		if (this == &xOther) return *this;  // Self-assignment check - prevents use-after-free
 		Clear();
-		Zenith_MemoryManagement::Deallocate(m_pxData);
+		TAllocator::Deallocate(m_pxData);
 
 		m_pxData = xOther.m_pxData;
 		m_uSize = xOther.m_uSize;
@@ -111,7 +182,7 @@ public:
 	~Zenith_Vector()
 	{
 		Clear();
-		Zenith_MemoryManagement::Deallocate(m_pxData);
+		TAllocator::Deallocate(m_pxData);
 	}
 
 	u_int GetSize() const {return m_uSize;}
@@ -337,7 +408,7 @@ public:
 		m_uGeneration++;
 
 		// Allocate new buffer and move construct existing elements for proper handling of non-trivial types
-		T* pNewData = static_cast<T*>(Zenith_MemoryManagement::Allocate(uNewCapacity * sizeof(T)));
+		T* pNewData = static_cast<T*>(TAllocator::Allocate(uNewCapacity * sizeof(T)));
 		Zenith_Assert(pNewData != nullptr,
 			"Reserve: allocation failed for capacity %u (requested %zu bytes)", uNewCapacity, uNewCapacity * sizeof(T));
 		if (pNewData == nullptr) return;  // Fail gracefully in release builds
@@ -347,57 +418,14 @@ public:
 			new (&pNewData[u]) T(std::move(m_pxData[u]));
 			m_pxData[u].~T();
 		}
-		Zenith_MemoryManagement::Deallocate(m_pxData);
+		TAllocator::Deallocate(m_pxData);
 		m_pxData = pNewData;
 		m_uCapacity = uNewCapacity;
 	}
 
 	void ReadFromDataStream(Zenith_DataStream& xStream)
 	{
-		u_int uSize;
-		xStream >> uSize;
-
-		// Sanity check to prevent allocation of absurd sizes from corrupted data
-		constexpr u_int uMAX_REASONABLE_SIZE = 100000000;
-		Zenith_Assert(uSize <= uMAX_REASONABLE_SIZE,
-			"ReadFromDataStream: Size %u exceeds reasonable limit - possible data corruption", uSize);
-		if (uSize > uMAX_REASONABLE_SIZE)
-		{
-			Zenith_Error(LOG_CATEGORY_CORE, "ReadFromDataStream: Size %u exceeds limit, aborting", uSize);
-			return;
-		}
-
-		// Check for integer overflow
-		constexpr u_int uMAX_SAFE_CAPACITY = UINT_MAX / sizeof(T);
-		if (uSize > uMAX_SAFE_CAPACITY)
-		{
-			Zenith_Error(LOG_CATEGORY_CORE, "ReadFromDataStream: Size %u would overflow allocation", uSize);
-			return;
-		}
-
-		Clear();
-		Reserve(uSize);
-
-		// Verify Reserve succeeded
-		if (uSize > 0 && GetCapacity() < uSize)
-		{
-			Zenith_Error(LOG_CATEGORY_CORE, "ReadFromDataStream: Reserve failed (capacity=%u, needed=%u)", GetCapacity(), uSize);
-			return;
-		}
-
-		for (u_int u = 0; u < uSize; u++)
-		{
-			// Check stream has remaining data
-			if (xStream.GetCursor() >= xStream.GetCapacity())
-			{
-				Zenith_Error(LOG_CATEGORY_CORE, "ReadFromDataStream: Premature end of stream at element %u of %u - clearing partial data", u, uSize);
-				Clear();  // Clear partial data to prevent inconsistent state
-				return;
-			}
-			T x;
-			xStream >> x;
-			PushBack(x);
-		}
+		Zenith_Vector_Detail::ReadElementsFromDataStream<T>(*this, xStream);
 	}
 
 	void WriteToDataStream(Zenith_DataStream& xStream) const
@@ -441,7 +469,7 @@ public:
 		}
 
 	private:
-		const Zenith_Vector<T>& m_xVec;
+		const Zenith_Vector& m_xVec;
 		u_int m_uIndex;
 		u_int m_uGeneration;
 	};
@@ -486,7 +514,7 @@ private:
 		Zenith_Assert(m_uCapacity <= uMAX_SAFE_CAPACITY,
 			"CopyFromOther: capacity %u would overflow", m_uCapacity);
 
-		m_pxData = static_cast<T*>(Zenith_MemoryManagement::Allocate(m_uCapacity * sizeof(T)));
+		m_pxData = static_cast<T*>(TAllocator::Allocate(m_uCapacity * sizeof(T)));
 		Zenith_Assert(m_pxData != nullptr,
 			"CopyFromOther: allocation failed for capacity %u", m_uCapacity);
 		if (m_pxData == nullptr)
@@ -0,0 +1,8 @@
+#pragma once
+
+// Forward declaration of Zenith_Vector, for headers that only name
+// Zenith_Vector<T> (by reference or pointer) and cannot include the definition
+// without a cycle. The default allocator argument lives HERE and only here: a
+// plain `template<typename T> class Zenith_Vector;` no longer matches the class.
+struct Zenith_HeapVectorAllocator;
+template<typename T, typename TAllocator = Zenith_HeapVectorAllocator> class Zenith_Vector;
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+/**
+ * Zenith_WorkStealingDeque - Fixed-capacity Chase-Lev work-stealing deque
+ *
+ * THREAD SAFETY: single OWNER, many THIEVES.
+ * - Push / Pop may ONLY be called by the owning thread (LIFO end, "bottom").
+ * - Steal may be called by any thread concurrently (FIFO end, "top").
+ *
+ * The owner works depth-first on its own freshest items (cache-warm), thieves
+ * take the oldest items (typically the largest remaining pieces of work). The
+ * only contended operation is the last-item race between Pop and Steal, which
+ * is resolved with a single CAS on m_iTop.
+ *
+ * Memory ordering follows Le, Pop, Cohen & Zappa Nardelli, "Correct and
+ * Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013), minus the
+ * growable buffer: capacity is fixed, and Push returns false when full so the
+ * caller can spill elsewhere instead of reallocating under the thieves' feet.
+ *
+ * T must be trivially copyable (task pointers in practice).
+ */
+template<typename T, u_int uCapacity>
+class Zenith_WorkStealingDeque
+{
+	static_assert(uCapacity > 0 && (uCapacity & (uCapacity - 1)) == 0, "WorkStealingDeque capacity must be a power of two");
+	static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque elements must be trivially copyable");
+
+public:
+	Zenith_WorkStealingDeque() = default;
+
+	Zenith_WorkStealingDeque(const Zenith_WorkStealingDeque&) = delete;
+	Zenith_WorkStealingDeque& operator=(const Zenith_WorkStealingDeque&) = delete;
+
+	// Owner only. Returns false (and leaves the deque untouched) when full.
+	bool Push(const T& tItem)
+	{
+		const int64_t iBottom = m_iBottom.load(std::memory_order_relaxed);
+		const int64_t iTop = m_iTop.load(std::memory_order_acquire);
+		if (iBottom - iTop >= static_cast<int64_t>(uCapacity))
+		{
+			return false;
+		}
+
+		m_atBuffer[iBottom & iMASK].store(tItem, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		m_iBottom.store(iBottom + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	// Owner only. Takes the most recently pushed item.
+	bool Pop(T& tOut)
+	{
+		const int64_t iBottom = m_iBottom.load(std::memory_order_relaxed) - 1;
+		m_iBottom.store(iBottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t iTop = m_iTop.load(std::memory_order_relaxed);
+
+		if (iTop > iBottom)
+		{
+			// Empty: undo the speculative decrement.
+			m_iBottom.store(iBottom + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		tOut = m_atBuffer[iBottom & iMASK].load(std::memory_order_relaxed);
+		if (iTop != iBottom)
+		{
+			return true;
+		}
+
+		// Last item: race any concurrent thief for it.
+		const bool bWon = m_iTop.compare_exchange_strong(iTop, iTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		m_iBottom.store(iBottom + 1, std::memory_order_relaxed);
+		return bWon;
+	}
+
+	// Any thread. Takes the oldest item. Retries internally when it loses a CAS
+	// race to another thief, so false always means "observed empty".
+	bool Steal(T& tOut)
+	{
+		while (true)
+		{
+			int64_t iTop = m_iTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64_t iBottom = m_iBottom.load(std::memory_order_acquire);
+			if (iTop >= iBottom)
+			{
+				return false;
+			}
+
+			const T tItem = m_atBuffer[iTop & iMASK].load(std::memory_order_relaxed);
+			if (m_iTop.compare_exchange_strong(iTop, iTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				tOut = tItem;
+				return true;
+			}
+		}
+	}
+
+	// Approximate when called concurrently; exact from the owner with no thieves.
+	u_int GetSize() const
+	{
+		const int64_t iBottom = m_iBottom.load(std::memory_order_acquire);
+		const int64_t iTop = m_iTop.load(std::memory_order_acquire);
+		return iBottom > iTop ? static_cast<u_int>(iBottom - iTop) : 0u;
+	}
+
+	bool IsEmpty() const { return GetSize() == 0; }
+	static constexpr u_int GetCapacity() { return uCapacity; }
+
+private:
+	static constexpr int64_t iMASK = static_cast<int64_t>(uCapacity) - 1;
+
+	// Owner-written and thief-written indices on separate cache lines so the
+	// owner's Push/Pop does not bounce the line every thief is spinning on.
+	alignas(64) std::atomic<int64_t> m_iTop{0};
+	alignas(64) std::atomic<int64_t> m_iBottom{0};
+	alignas(64) std::atomic<T> m_atBuffer[uCapacity];
+};
@@ -0,0 +1,107 @@
+// Unit tests for Zenith_FrameAllocator. #included at the bottom of
+// Zenith_FrameAllocator.cpp (always linked: Zenith_MemoryManagement::BeginFrame
+// calls into it, so MSVC cannot dead-strip the ZENITH_TEST registrations).
+// The lifetime tests advance the frame index, exactly as extra engine frames would.
+
+#include "Collections/Zenith_Vector.h"
+
+ZENITH_TEST(FrameAllocator, AllocationsAreAlignedAndDisjoint)
+{
+	static const size_t aulAlignments[] = { 1u, 4u, 16u, 64u, 256u };
+	unsigned char* apucBlocks[40] = {};
+	size_t aulSizes[40] = {};
+	for (u_int u = 0; u < 40; u++)
+	{
+		const size_t ulAlignment = aulAlignments[u % 5];
+		aulSizes[u] = 1 + (u * 37) % 300;
+		apucBlocks[u] = static_cast<unsigned char*>(Zenith_FrameAllocator::Allocate(aulSizes[u], ulAlignment));
+		ZENITH_ASSERT_TRUE(apucBlocks[u] != nullptr, "Allocate returned null");
+		ZENITH_ASSERT_TRUE((reinterpret_cast<uintptr_t>(apucBlocks[u]) & (ulAlignment - 1)) == 0, "allocation %u is not %zu-aligned", u, ulAlignment);
+		memset(apucBlocks[u], static_cast<int>(u), aulSizes[u]);
+	}
+	for (u_int u = 0; u < 40; u++)
+	{
+		for (size_t ul = 0; ul < aulSizes[u]; ul++)
+		{
+			ZENITH_ASSERT_EQ(apucBlocks[u][ul], static_cast<unsigned char>(u), "allocation %u overlapped by a later one", u);
+		}
+	}
+}
+
+ZENITH_TEST(FrameAllocator, OversizedAllocationGetsItsOwnBlock)
+{
+	const size_t ulSize = Zenith_FrameAllocator::ulBLOCK_BYTES * 2;
+	unsigned char* pucData = static_cast<unsigned char*>(Zenith_FrameAllocator::Allocate(ulSize, 64));
+	ZENITH_ASSERT_TRUE(pucData != nullptr, "oversized Allocate returned null");
+	pucData[0] = 1;
+	pucData[ulSize - 1] = 2;
+	ZENITH_ASSERT_EQ(pucData[0] + pucData[ulSize - 1], 3, "oversized allocation not writable end to end");
+}
+
+ZENITH_TEST(FrameAllocator, DataSurvivesItsFrameLifetime)
+{
+	Zenith_FrameAllocator::BeginFrame();
+	u_int* puKept = Zenith_FrameAllocator::AllocateArray<u_int>(1024);
+	for (u_int u = 0; u < 1024; u++)
+	{
+		puKept[u] = u * 3 + 1;
+	}
+
+	// The next uFRAME_LIFETIME - 1 frames each allocate (and scribble over) their own memory.
+	for (u_int uFrame = 1; uFrame < Zenith_FrameAllocator::uFRAME_LIFETIME; uFrame++)
+	{
+		Zenith_FrameAllocator::BeginFrame();
+		for (u_int u = 0; u < 64; u++)
+		{
+			memset(Zenith_FrameAllocator::Allocate(4096), 0xAB, 4096);
+		}
+	}
+
+	for (u_int u = 0; u < 1024; u++)
+	{
+		ZENITH_ASSERT_EQ(puKept[u], u * 3 + 1, "frame data was recycled before its lifetime ended");
+	}
+}
+
+ZENITH_TEST(FrameAllocator, SteadyStateReusesBlocks)
+{
+	auto RunFrame = []()
+	{
+		Zenith_FrameAllocator::BeginFrame();
+		for (u_int u = 0; u < 200; u++)
+		{
+			Zenith_FrameAllocator::Allocate(2048);
+		}
+	};
+
+	// Warm every generation on this thread, then repeat the same workload.
+	for (u_int u = 0; u < Zenith_FrameAllocator::uFRAME_LIFETIME * 2; u++)
+	{
+		RunFrame();
+	}
+	const u_int uBlocks = Zenith_FrameAllocator::GetBlockCount();
+	for (u_int u = 0; u < Zenith_FrameAllocator::uFRAME_LIFETIME * 4; u++)
+	{
+		RunFrame();
+	}
+	ZENITH_ASSERT_EQ(Zenith_FrameAllocator::GetBlockCount(), uBlocks, "a repeated per-frame workload kept allocating arena blocks");
+	ZENITH_ASSERT_TRUE(Zenith_FrameAllocator::GetReservedBytes() >= 200u * 2048u, "reserved bytes do not cover one frame's workload");
+}
+
+ZENITH_TEST(FrameAllocator, FrameVectorGrowsAndKeepsElements)
+{
+	Zenith_FrameVector<u_int> xValues;
+	for (u_int u = 0; u < 5000; u++)
+	{
+		xValues.PushBack(u ^ 0x55u);
+	}
+	ZENITH_ASSERT_EQ(xValues.GetSize(), 5000u, "FrameVector lost elements while growing");
+	for (u_int u = 0; u < 5000; u++)
+	{
+		ZENITH_ASSERT_EQ(xValues.Get(u), u ^ 0x55u, "FrameVector element %u wrong after growth", u);
+	}
+
+	Zenith_FrameVector<u_int> xMoved(std::move(xValues));
+	ZENITH_ASSERT_EQ(xMoved.GetSize(), 5000u, "FrameVector move lost elements");
+	ZENITH_ASSERT_EQ(xValues.GetSize(), 0u, "moved-from FrameVector not empty");
+}
@@ -0,0 +1,165 @@
+#include "Zenith.h"
+
+#include "Memory/Zenith_FrameAllocator.h"
+
+#include <atomic>
+#include <new>
+
+namespace
+{
+	// Header of an arena block; the usable bytes follow it.
+	struct FrameBlock
+	{
+		FrameBlock* m_pxNext;
+		size_t m_ulCapacity;
+
+		unsigned char* GetData() { return reinterpret_cast<unsigned char*>(this + 1); }
+	};
+	static_assert(sizeof(FrameBlock) % alignof(std::max_align_t) == 0, "FrameBlock must keep its data max-aligned");
+
+	// One of a thread's uFRAME_LIFETIME chains. Blocks are never unlinked; a
+	// recycled chain is bumped through again from its first block.
+	struct FrameChain
+	{
+		FrameBlock* m_pxFirst = nullptr;
+		FrameBlock* m_pxLast = nullptr;
+		FrameBlock* m_pxCurrent = nullptr;
+		size_t m_ulOffset = 0;
+		u_int64 m_ulFrame = ~0ull;   // Frame whose data the chain holds.
+	};
+
+	std::atomic<u_int64> g_ulFrameIndex{ 0 };
+	std::atomic<u_int64> g_ulReservedBytes{ 0 };
+	std::atomic<u_int> g_uBlockCount{ 0 };
+
+	FrameBlock* NewBlock(size_t ulCapacity)
+	{
+		// Attributed like any other allocation, so budgets and reports see the arenas.
+		ZENITH_MEMORY_SCOPE(MEMORY_CATEGORY_FRAME_ARENA);
+		FrameBlock* pxBlock = static_cast<FrameBlock*>(::operator new(sizeof(FrameBlock) + ulCapacity));
+		pxBlock->m_pxNext = nullptr;
+		pxBlock->m_ulCapacity = ulCapacity;
+		g_ulReservedBytes.fetch_add(ulCapacity, std::memory_order_relaxed);
+		g_uBlockCount.fetch_add(1, std::memory_order_relaxed);
+		return pxBlock;
+	}
+
+	struct ThreadArena
+	{
+		~ThreadArena()
+		{
+			Release();
+		}
+
+		void Release()
+		{
+			for (u_int u = 0; u < Zenith_FrameAllocator::uFRAME_LIFETIME; u++)
+			{
+				FrameChain& xChain = m_axChains[u];
+				FrameBlock* pxBlock = xChain.m_pxFirst;
+				while (pxBlock != nullptr)
+				{
+					FrameBlock* pxNext = pxBlock->m_pxNext;
+					g_ulReservedBytes.fetch_sub(pxBlock->m_ulCapacity, std::memory_order_relaxed);
+					g_uBlockCount.fetch_sub(1, std::memory_order_relaxed);
+					::operator delete(pxBlock);
+					pxBlock = pxNext;
+				}
+				xChain = FrameChain();
+			}
+		}
+
+		FrameChain m_axChains[Zenith_FrameAllocator::uFRAME_LIFETIME];
+	};
+
+	thread_local ThreadArena tl_g_xFrameArena;
+
+	unsigned char* TryBump(FrameChain& xChain, size_t ulSize, size_t ulAlignment)
+	{
+		FrameBlock* pxBlock = xChain.m_pxCurrent;
+		const uintptr_t ulBase = reinterpret_cast<uintptr_t>(pxBlock->GetData());
+		const uintptr_t ulAligned = (ulBase + xChain.m_ulOffset + ulAlignment - 1) & ~static_cast<uintptr_t>(ulAlignment - 1);
+		const size_t ulEnd = static_cast<size_t>(ulAligned - ulBase) + ulSize;
+		if (ulEnd > pxBlock->m_ulCapacity)
+		{
+			return nullptr;
+		}
+		xChain.m_ulOffset = ulEnd;
+		return reinterpret_cast<unsigned char*>(ulAligned);
+	}
+}
+
+void Zenith_FrameAllocator::BeginFrame()
+{
+	g_ulFrameIndex.fetch_add(1, std::memory_order_release);
+}
+
+u_int64 Zenith_FrameAllocator::GetFrameIndex()
+{
+	return g_ulFrameIndex.load(std::memory_order_acquire);
+}
+
+void* Zenith_FrameAllocator::Allocate(size_t ulSize, size_t ulAlignment)
+{
+	Zenith_Assert(ulAlignment != 0 && (ulAlignment & (ulAlignment - 1)) == 0, "Zenith_FrameAllocator: alignment %zu is not a power of two", ulAlignment);
+
+	const u_int64 ulFrame = g_ulFrameIndex.load(std::memory_order_acquire);
+	FrameChain& xChain = tl_g_xFrameArena.m_axChains[ulFrame % uFRAME_LIFETIME];
+	if (xChain.m_ulFrame != ulFrame)
+	{
+		// First allocation of this frame on this thread: the chain's previous
+		// contents are uFRAME_LIFETIME (or more) frames old.
+		xChain.m_pxCurrent = xChain.m_pxFirst;
+		xChain.m_ulOffset = 0;
+		xChain.m_ulFrame = ulFrame;
+	}
+
+	// Walk the chain's remaining blocks; those were sized by earlier frames, so
+	// after warm-up one of them fits.
+	while (xChain.m_pxCurrent != nullptr)
+	{
+		if (unsigned char* pucResult = TryBump(xChain, ulSize, ulAlignment))
+		{
+			return pucResult;
+		}
+		xChain.m_pxCurrent = xChain.m_pxCurrent->m_pxNext;
+		xChain.m_ulOffset = 0;
+	}
+
+	const size_t ulNeeded = ulSize + ulAlignment;
+	FrameBlock* pxBlock = NewBlock(ulNeeded > ulBLOCK_BYTES ? ulNeeded : ulBLOCK_BYTES);
+	if (xChain.m_pxLast != nullptr)
+	{
+		xChain.m_pxLast->m_pxNext = pxBlock;
+	}
+	else
+	{
+		xChain.m_pxFirst = pxBlock;
+	}
+	xChain.m_pxLast = pxBlock;
+	xChain.m_pxCurrent = pxBlock;
+	xChain.m_ulOffset = 0;
+
+	unsigned char* pucResult = TryBump(xChain, ulSize, ulAlignment);
+	Zenith_Assert(pucResult != nullptr, "Zenith_FrameAllocator: a fresh block could not hold %zu bytes", ulSize);
+	return pucResult;
+}
+
+void Zenith_FrameAllocator::ReleaseThreadArena()
+{
+	tl_g_xFrameArena.Release();
+}
+
+u_int64 Zenith_FrameAllocator::GetReservedBytes()
+{
+	return g_ulReservedBytes.load(std::memory_order_relaxed);
+}
+
+u_int Zenith_FrameAllocator::GetBlockCount()
+{
+	return g_uBlockCount.load(std::memory_order_relaxed);
+}
+
+#ifdef ZENITH_TESTING
+#include "Memory/Zenith_FrameAllocator.Tests.inl"
+#endif
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Collections/Zenith_Vector_Fwd.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// =============================================================================
+// Zenith_FrameAllocator
+// -----------------------------------------------------------------------------
+// Per-thread bump arenas for transient data: render-gather lists, per-frame
+// scratch, anything rebuilt every frame and thrown away. Allocate is a pointer
+// bump in the calling thread's own arena -- no lock, no atomic, no tracker
+// record -- and there is no per-allocation free. The whole arena of a frame is
+// reclaimed at once.
+//
+// Lifetime. Memory allocated during frame N stays valid until BeginFrame starts
+// frame N + uFRAME_LIFETIME, so a frame's data may be handed to the next one or
+// two (e.g. main thread -> render thread). Each thread keeps uFRAME_LIFETIME
+// block chains and recycles the oldest the first time it allocates in a new
+// frame, so the reset costs nothing on threads that did not allocate.
+//
+// Destructors are NOT run. Store trivially-destructible data, or use the
+// Zenith_Vector / STL adapters below and let the container destroy its
+// elements as usual -- only the buffer is frame memory.
+//
+// Accounting. Arena blocks come from the global operator new under
+// MEMORY_CATEGORY_FRAME_ARENA, so the category tables, the editor panel, the CSV
+// report and Zenith_MemoryBudgets all see the arenas' reserved bytes. Blocks are
+// kept and reused across frames, so after warm-up the steady state makes no
+// heap calls at all.
+//
+// Threads. Any thread may allocate. A thread's blocks are freed when it exits;
+// Zenith_MemoryManagement::Shutdown releases the main thread's before the leak
+// report.
+// =============================================================================
+class Zenith_FrameAllocator
+{
+public:
+	static constexpr u_int uFRAME_LIFETIME = 3;
+	static constexpr size_t ulBLOCK_BYTES = 256 * 1024;
+
+	// Starts the next frame. Called from Zenith_MemoryManagement::BeginFrame.
+	static void BeginFrame();
+	static u_int64 GetFrameIndex();
+
+	// Never returns null (an allocation larger than a block gets a block of its
+	// own). ulAlignment must be a power of two.
+	static void* Allocate(size_t ulSize, size_t ulAlignment = alignof(std::max_align_t));
+
+	template<typename T>
+	static T* AllocateArray(u_int uCount)
+	{
+		return static_cast<T*>(Allocate(sizeof(T) * uCount, alignof(T)));
+	}
+
+	// Frees the calling thread's blocks. Anything it allocated in the last
+	// uFRAME_LIFETIME frames becomes invalid.
+	static void ReleaseThreadArena();
+
+	// Bytes held in arena blocks across every thread, used or not.
+	static u_int64 GetReservedBytes();
+	static u_int GetBlockCount();
+};
+
+// Zenith_Vector allocator policy (see Zenith_HeapVectorAllocator). Growth bumps
+// a new buffer out of the arena and abandons the old one until the frame is
+// recycled, so Reserve up front where the size is known.
+struct Zenith_FrameVectorAllocator
+{
+	static void* Allocate(size_t ulBytes) { return Zenith_FrameAllocator::Allocate(ulBytes); }
+	static void Deallocate(void*) {}
+};
+
+// A Zenith_Vector whose buffer is frame memory. Must not outlive its frame
+// lifetime (see above); a local in a per-frame function is the intended use.
+template<typename T>
+using Zenith_FrameVector = Zenith_Vector<T, Zenith_FrameVectorAllocator>;
+
+// Standard Allocator over the frame arenas, for STL containers and algorithms
+// that take one. Same lifetime rule.
+template<typename T>
+class Zenith_FrameStlAllocator
+{
+public:
+	using value_type = T;
+
+	Zenith_FrameStlAllocator() = default;
+	template<typename U>
+	Zenith_FrameStlAllocator(const Zenith_FrameStlAllocator<U>&) {}
+
+	T* allocate(size_t ulCount)
+	{
+		return static_cast<T*>(Zenith_FrameAllocator::Allocate(sizeof(T) * ulCount, alignof(T)));
+	}
+	void deallocate(T*, size_t) {}
+
+	template<typename U>
+	bool operator==(const Zenith_FrameStlAllocator<U>&) const { return true; }
+	template<typename U>
+	bool operator!=(const Zenith_FrameStlAllocator<U>&) const { return false; }
+};
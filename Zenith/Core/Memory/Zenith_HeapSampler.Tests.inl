@@ -0,0 +1,205 @@
+// Unit tests for the sampling heap profiler. #included at the bottom of
+// Zenith_HeapSampler.cpp. The maths and the snapshot/growth types run at any
+// tier; the end-to-end estimate runs only at LITE, where the allocator hooks
+// exist, and restores the sampler's previous state.
+
+namespace
+{
+	// A fake callstack whose frames are just small distinct integers.
+	void HeapTestFrames(void** apFrames, u_int uFrameCount, uintptr_t uBase)
+	{
+		for (u_int u = 0; u < uFrameCount; u++)
+		{
+			apFrames[u] = reinterpret_cast<void*>(uBase + u);
+		}
+	}
+}
+
+ZENITH_TEST(HeapSampler, EstimateBytesLimits)
+{
+	// Far above the mean every allocation is sampled, so a sample is worth itself.
+	ZENITH_ASSERT_EQ(Zenith_HeapSampler::EstimateBytes(64 * 1024 * 1024, 1024), 64ull * 1024 * 1024);
+	// Far below it the weight tends to the mean: size / (size / mean).
+	const u_int64 ulSmall = Zenith_HeapSampler::EstimateBytes(16, 1024 * 1024);
+	ZENITH_ASSERT_TRUE(ulSmall > 1024 * 1024 && ulSmall < 1024 * 1024 + 64, "a tiny sample must stand for ~one mean interval");
+	// At the mean, P = 1 - 1/e.
+	ZENITH_ASSERT_EQ(Zenith_HeapSampler::EstimateBytes(1000, 1000), 1582ull);
+	ZENITH_ASSERT_EQ(Zenith_HeapSampler::EstimateBytes(0, 1000), 0ull);
+}
+
+ZENITH_TEST(HeapSampler, DrawIntervalIsExponentialAndDeterministic)
+{
+	const u_int64 ulMean = 4096;
+	const u_int uDraws = 20000;
+	u_int64 ulState = 1234;
+	double fSum = 0.0;
+	u_int uBelowMean = 0;
+	for (u_int u = 0; u < uDraws; u++)
+	{
+		const u_int64 ulInterval = Zenith_HeapSampler::DrawInterval(ulState, ulMean);
+		ZENITH_ASSERT_TRUE(ulInterval > 0, "a zero gap would sample the same allocation twice");
+		fSum += static_cast<double>(ulInterval);
+		uBelowMean += (ulInterval < ulMean) ? 1u : 0u;
+	}
+	const double fMean = fSum / uDraws;
+	ZENITH_ASSERT_TRUE(fMean > ulMean * 0.95 && fMean < ulMean * 1.05, "mean gap %.1f, expected ~%llu", fMean,
+		static_cast<unsigned long long>(ulMean));
+	// Exponential, not uniform: P(X < mean) = 1 - 1/e ~ 0.632.
+	const double fBelow = static_cast<double>(uBelowMean) / uDraws;
+	ZENITH_ASSERT_TRUE(fBelow > 0.60 && fBelow < 0.66, "fraction below the mean %.3f, expected ~0.632", fBelow);
+
+	u_int64 ulStateA = 99;
+	u_int64 ulStateB = 99;
+	for (u_int u = 0; u < 8; u++)
+	{
+		ZENITH_ASSERT_EQ(Zenith_HeapSampler::DrawInterval(ulStateA, ulMean), Zenith_HeapSampler::DrawInterval(ulStateB, ulMean));
+	}
+	u_int64 ulZero = 0;
+	ZENITH_ASSERT_TRUE(Zenith_HeapSampler::DrawInterval(ulZero, ulMean) > 0);
+	ZENITH_ASSERT_TRUE(ulZero != 0, "a zero state must be reseeded, not left stuck");
+}
+
+ZENITH_TEST(HeapSampler, SnapshotMergesSamplesBySite)
+{
+	void* apSiteA[4];
+	void* apSiteB[4];
+	void* apSiteAShort[3];
+	HeapTestFrames(apSiteA, 4, 0x1000);
+	HeapTestFrames(apSiteB, 4, 0x2000);
+	HeapTestFrames(apSiteAShort, 3, 0x1000);
+
+	Zenith_HeapSnapshot xSnapshot;
+	xSnapshot.AddSample(apSiteA, 4, 100, 1000);
+	xSnapshot.AddSample(apSiteB, 4, 50, 500);
+	xSnapshot.AddSample(apSiteA, 4, 100, 1000);
+	xSnapshot.AddSample(apSiteAShort, 3, 10, 700);
+	xSnapshot.Finalise();
+
+	ZENITH_ASSERT_EQ(xSnapshot.GetSites().GetSize(), 3u, "same frames merge; a shorter stack is a different site");
+	ZENITH_ASSERT_EQ(xSnapshot.GetEstimatedBytes(), 3200ull);
+
+	u_int uMergedA = 0;
+	for (u_int u = 0; u < xSnapshot.GetSites().GetSize(); u++)
+	{
+		const Zenith_HeapSiteStats& xSite = xSnapshot.GetSites().Get(u);
+		if (xSite.m_uFrameCount == 4 && reinterpret_cast<uintptr_t>(xSite.m_apFrames[0]) == 0x1000)
+		{
+			uMergedA++;
+			ZENITH_ASSERT_EQ(xSite.m_uSamples, 2u);
+			ZENITH_ASSERT_EQ(xSite.m_ulEstimatedBytes, 2000ull);
+			ZENITH_ASSERT_EQ_FLOAT(xSite.m_fEstimatedAllocations, 20.0, 1e-6, "each 100-byte sample standing for 1000 bytes is 10 allocations");
+		}
+	}
+	ZENITH_ASSERT_EQ(uMergedA, 1u);
+
+	// Frames past the cap are dropped, not overrun.
+	void* apDeep[uHEAP_SAMPLE_MAX_FRAMES + 4];
+	HeapTestFrames(apDeep, uHEAP_SAMPLE_MAX_FRAMES + 4, 0x3000);
+	Zenith_HeapSnapshot xDeep;
+	xDeep.AddSample(apDeep, uHEAP_SAMPLE_MAX_FRAMES + 4, 8, 8);
+	xDeep.Finalise();
+	ZENITH_ASSERT_EQ(xDeep.GetSites().Get(0).m_uFrameCount, uHEAP_SAMPLE_MAX_FRAMES);
+}
+
+ZENITH_TEST(HeapSampler, GrowthOrdersLargestFirstAndOmitsUnchanged)
+{
+	void* apFrames[2];
+	Zenith_HeapSnapshot xBefore;
+	Zenith_HeapSnapshot xAfter;
+
+	HeapTestFrames(apFrames, 2, 0x100);   // grows
+	xBefore.AddSample(apFrames, 2, 10, 1000);
+	xAfter.AddSample(apFrames, 2, 10, 5000);
+	HeapTestFrames(apFrames, 2, 0x200);   // unchanged
+	xBefore.AddSample(apFrames, 2, 10, 700);
+	xAfter.AddSample(apFrames, 2, 10, 700);
+	HeapTestFrames(apFrames, 2, 0x300);   // vanishes
+	xBefore.AddSample(apFrames, 2, 10, 3000);
+	HeapTestFrames(apFrames, 2, 0x400);   // new
+	xAfter.AddSample(apFrames, 2, 10, 2000);
+	HeapTestFrames(apFrames, 2, 0x500);   // shrinks
+	xBefore.AddSample(apFrames, 2, 10, 900);
+	xAfter.AddSample(apFrames, 2, 10, 400);
+	xBefore.Finalise();
+	xAfter.Finalise();
+
+	Zenith_Vector<Zenith_HeapSiteGrowth> xGrowth;
+	Zenith_HeapSampler::ComputeGrowth(xBefore, xAfter, xGrowth);
+	ZENITH_ASSERT_EQ(xGrowth.GetSize(), 4u, "the unchanged site must be left out");
+
+	const uintptr_t auExpectedOrder[] = { 0x100, 0x400, 0x500, 0x300 };
+	const int64_t ailExpectedDelta[] = { 4000, 2000, -500, -3000 };
+	for (u_int u = 0; u < 4; u++)
+	{
+		ZENITH_ASSERT_EQ(reinterpret_cast<uintptr_t>(xGrowth.Get(u).m_xSite.m_apFrames[0]), auExpectedOrder[u], "growth entry %u out of order", u);
+		ZENITH_ASSERT_EQ(xGrowth.Get(u).m_ilDeltaBytes, ailExpectedDelta[u]);
+	}
+	ZENITH_ASSERT_EQ(xGrowth.Get(3).m_xSite.m_ulEstimatedBytes, 0ull, "a vanished site is now empty");
+
+	// Empty in, empty out.
+	Zenith_HeapSampler::ComputeGrowth(Zenith_HeapSnapshot(), Zenith_HeapSnapshot(), xGrowth);
+	ZENITH_ASSERT_EQ(xGrowth.GetSize(), 0u);
+}
+
+#if ZENITH_MEMORY_TRACKING_ANY && !ZENITH_MEMORY_TRACKING_FULL
+ZENITH_TEST(HeapSampler, LiveEstimateTracksAllocationsAndFrees)
+{
+	const bool bWasEnabled = Zenith_HeapSampler::IsEnabled();
+	const u_int64 ulPreviousMean = Zenith_HeapSampler::GetMeanInterval();
+
+	// 512 KiB in 256-byte blocks at a 1 KiB mean is ~460 samples: a few percent
+	// of noise, and well inside one thread's slot budget.
+	const u_int uBlocks = 2048;
+	const u_int uBlockSize = 256;
+	Zenith_HeapSampler::Enable(1024);
+
+	Zenith_HeapSnapshot xBefore;
+	Zenith_HeapSampler::TakeSnapshot(xBefore);
+
+	Zenith_Vector<u_int8*> xBlocks;   // Zenith_Vector storage is untracked
+	xBlocks.Reserve(uBlocks);
+	for (u_int u = 0; u < uBlocks; u++)
+	{
+		xBlocks.PushBack(new u_int8[uBlockSize]);
+	}
+
+	Zenith_HeapSnapshot xHeld;
+	Zenith_HeapSampler::TakeSnapshot(xHeld);
+
+	for (u_int u = 0; u < uBlocks; u++)
+	{
+		delete[] xBlocks.Get(u);
+	}
+
+	Zenith_HeapSnapshot xAfter;
+	Zenith_HeapSampler::TakeSnapshot(xAfter);
+
+	if (bWasEnabled)
+	{
+		Zenith_HeapSampler::Enable(ulPreviousMean);
+	}
+	else
+	{
+		Zenith_HeapSampler::Disable();
+	}
+
+	if (xHeld.GetDroppedSamples() != xBefore.GetDroppedSamples())
+	{
+		ZENITH_SKIP("sample buffers were full before the test ran");
+	}
+
+	const double fHeldBytes = static_cast<double>(uBlocks) * uBlockSize;
+	const double fGrowth = static_cast<double>(xHeld.GetEstimatedBytes()) - static_cast<double>(xBefore.GetEstimatedBytes());
+	ZENITH_ASSERT_TRUE(fGrowth > fHeldBytes * 0.7 && fGrowth < fHeldBytes * 1.3,
+		"estimated growth %.0f bytes for %.0f held", fGrowth, fHeldBytes);
+
+	Zenith_Vector<Zenith_HeapSiteGrowth> xGrowth;
+	Zenith_HeapSampler::ComputeGrowth(xBefore, xHeld, xGrowth);
+	ZENITH_ASSERT_TRUE(xGrowth.GetSize() > 0);
+	ZENITH_ASSERT_TRUE(static_cast<double>(xGrowth.Get(0).m_ilDeltaBytes) > fHeldBytes * 0.7,
+		"the test's allocation loop must be the single largest growing site");
+
+	const double fLeft = static_cast<double>(xAfter.GetEstimatedBytes()) - static_cast<double>(xBefore.GetEstimatedBytes());
+	ZENITH_ASSERT_TRUE(fLeft < fHeldBytes * 0.1, "freed blocks must leave the estimate (%.0f bytes remain)", fLeft);
+}
+#endif
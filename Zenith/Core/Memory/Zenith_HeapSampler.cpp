@@ -0,0 +1,470 @@
+#include "Zenith.h"
+
+#include "Memory/Zenith_HeapSampler.h"
+
+#include "Callstack/Zenith_Callstack.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+namespace
+{
+	u_int64 HashFrames(void* const* apFrames, u_int uFrameCount)
+	{
+		// FNV-1a over the return addresses.
+		u_int64 ulHash = 0xCBF29CE484222325ull;
+		for (u_int u = 0; u < uFrameCount; u++)
+		{
+			ulHash ^= reinterpret_cast<uintptr_t>(apFrames[u]);
+			ulHash *= 0x100000001B3ull;
+		}
+		return ulHash;
+	}
+
+	bool SameSite(const Zenith_HeapSiteStats& xA, const Zenith_HeapSiteStats& xB)
+	{
+		return xA.m_ulHash == xB.m_ulHash
+			&& xA.m_uFrameCount == xB.m_uFrameCount
+			&& memcmp(xA.m_apFrames, xB.m_apFrames, xA.m_uFrameCount * sizeof(void*)) == 0;
+	}
+
+	// Total order on sites: hash, then the frames themselves for the (rare) collision.
+	bool SiteLess(const Zenith_HeapSiteStats& xA, const Zenith_HeapSiteStats& xB)
+	{
+		if (xA.m_ulHash != xB.m_ulHash)
+		{
+			return xA.m_ulHash < xB.m_ulHash;
+		}
+		if (xA.m_uFrameCount != xB.m_uFrameCount)
+		{
+			return xA.m_uFrameCount < xB.m_uFrameCount;
+		}
+		return memcmp(xA.m_apFrames, xB.m_apFrames, xA.m_uFrameCount * sizeof(void*)) < 0;
+	}
+
+	void WriteSiteStack(FILE* pxFile, const Zenith_HeapSiteStats& xSite)
+	{
+		char acStack[4096];
+		Zenith_Callstack::FormatCallstack(const_cast<void**>(xSite.m_apFrames), xSite.m_uFrameCount, acStack, sizeof(acStack));
+		fputs(acStack, pxFile);
+	}
+}
+
+// =============================================================================
+// Snapshot + growth (every tier)
+// =============================================================================
+
+void Zenith_HeapSnapshot::AddSample(void* const* apFrames, u_int uFrameCount, u_int64 ulSize, u_int64 ulEstimatedBytes)
+{
+	Zenith_HeapSiteStats xSite;
+	xSite.m_uFrameCount = std::min(uFrameCount, uHEAP_SAMPLE_MAX_FRAMES);
+	memcpy(xSite.m_apFrames, apFrames, xSite.m_uFrameCount * sizeof(void*));
+	xSite.m_ulHash = HashFrames(xSite.m_apFrames, xSite.m_uFrameCount);
+	xSite.m_ulEstimatedBytes = ulEstimatedBytes;
+	xSite.m_fEstimatedAllocations = ulSize > 0 ? static_cast<double>(ulEstimatedBytes) / static_cast<double>(ulSize) : 0.0;
+	xSite.m_uSamples = 1;
+	m_xSites.PushBack(xSite);
+	m_ulEstimatedBytes += ulEstimatedBytes;
+}
+
+void Zenith_HeapSnapshot::Finalise()
+{
+	Zenith_HeapSiteStats* pxSites = m_xSites.GetDataPointer();
+	const u_int uCount = m_xSites.GetSize();
+	std::sort(pxSites, pxSites + uCount, &SiteLess);
+
+	u_int uOut = 0;
+	for (u_int u = 0; u < uCount; u++)
+	{
+		if (uOut > 0 && SameSite(pxSites[uOut - 1], pxSites[u]))
+		{
+			Zenith_HeapSiteStats& xMerged = pxSites[uOut - 1];
+			xMerged.m_ulEstimatedBytes += pxSites[u].m_ulEstimatedBytes;
+			xMerged.m_fEstimatedAllocations += pxSites[u].m_fEstimatedAllocations;
+			xMerged.m_uSamples += pxSites[u].m_uSamples;
+			continue;
+		}
+		pxSites[uOut++] = pxSites[u];
+	}
+	while (m_xSites.GetSize() > uOut)
+	{
+		m_xSites.PopBack();
+	}
+}
+
+void Zenith_HeapSampler::ComputeGrowth(const Zenith_HeapSnapshot& xBefore, const Zenith_HeapSnapshot& xAfter,
+	Zenith_Vector<Zenith_HeapSiteGrowth>& xGrowthOut)
+{
+	xGrowthOut.Clear();
+	const Zenith_Vector<Zenith_HeapSiteStats>& xA = xBefore.GetSites();
+	const Zenith_Vector<Zenith_HeapSiteStats>& xB = xAfter.GetSites();
+
+	// Both lists are sorted by SiteLess, so one merge pass pairs them up.
+	u_int uA = 0;
+	u_int uB = 0;
+	while (uA < xA.GetSize() || uB < xB.GetSize())
+	{
+		Zenith_HeapSiteGrowth xGrowth;
+		if (uB >= xB.GetSize() || (uA < xA.GetSize() && SiteLess(xA.Get(uA), xB.Get(uB))))
+		{
+			const Zenith_HeapSiteStats& xGone = xA.Get(uA++);
+			xGrowth.m_xSite = xGone;
+			xGrowth.m_xSite.m_ulEstimatedBytes = 0;
+			xGrowth.m_xSite.m_fEstimatedAllocations = 0.0;
+			xGrowth.m_xSite.m_uSamples = 0;
+			xGrowth.m_ilDeltaBytes = -static_cast<int64_t>(xGone.m_ulEstimatedBytes);
+			xGrowth.m_fDeltaAllocations = -xGone.m_fEstimatedAllocations;
+		}
+		else if (uA >= xA.GetSize() || SiteLess(xB.Get(uB), xA.Get(uA)))
+		{
+			const Zenith_HeapSiteStats& xNew = xB.Get(uB++);
+			xGrowth.m_xSite = xNew;
+			xGrowth.m_ilDeltaBytes = static_cast<int64_t>(xNew.m_ulEstimatedBytes);
+			xGrowth.m_fDeltaAllocations = xNew.m_fEstimatedAllocations;
+		}
+		else
+		{
+			const Zenith_HeapSiteStats& xOld = xA.Get(uA++);
+			const Zenith_HeapSiteStats& xNew = xB.Get(uB++);
+			xGrowth.m_xSite = xNew;
+			xGrowth.m_ilDeltaBytes = static_cast<int64_t>(xNew.m_ulEstimatedBytes) - static_cast<int64_t>(xOld.m_ulEstimatedBytes);
+			xGrowth.m_fDeltaAllocations = xNew.m_fEstimatedAllocations - xOld.m_fEstimatedAllocations;
+		}
+
+		if (xGrowth.m_ilDeltaBytes != 0 || xGrowth.m_fDeltaAllocations != 0.0)
+		{
+			xGrowthOut.PushBack(xGrowth);
+		}
+	}
+
+	std::stable_sort(xGrowthOut.GetDataPointer(), xGrowthOut.GetDataPointer() + xGrowthOut.GetSize(),
+		[](const Zenith_HeapSiteGrowth& xL, const Zenith_HeapSiteGrowth& xR) { return xL.m_ilDeltaBytes > xR.m_ilDeltaBytes; });
+}
+
+void Zenith_HeapSampler::WriteSnapshotReport(FILE* pxFile, const Zenith_HeapSnapshot& xSnapshot, u_int uMaxSites)
+{
+	if (pxFile == nullptr)
+	{
+		return;
+	}
+
+	// Sites are stored in SiteLess order; the report wants the biggest first.
+	const Zenith_Vector<Zenith_HeapSiteStats>& xSites = xSnapshot.GetSites();
+	Zenith_Vector<u_int> xOrder;
+	xOrder.Reserve(xSites.GetSize());
+	for (u_int u = 0; u < xSites.GetSize(); u++)
+	{
+		xOrder.PushBack(u);
+	}
+	std::stable_sort(xOrder.GetDataPointer(), xOrder.GetDataPointer() + xOrder.GetSize(),
+		[&xSites](u_int uL, u_int uR) { return xSites.Get(uL).m_ulEstimatedBytes > xSites.Get(uR).m_ulEstimatedBytes; });
+
+	fprintf(pxFile, "=== Heap profile (sampled, mean interval %llu bytes) ===\n", static_cast<unsigned long long>(GetMeanInterval()));
+	fprintf(pxFile, "Estimated live: %.2f MB across %u sites   Dropped samples: %llu\n",
+		static_cast<double>(xSnapshot.GetEstimatedBytes()) / (1024.0 * 1024.0), xSites.GetSize(),
+		static_cast<unsigned long long>(xSnapshot.GetDroppedSamples()));
+	for (u_int u = 0; u < xOrder.GetSize() && u < uMaxSites; u++)
+	{
+		const Zenith_HeapSiteStats& xSite = xSites.Get(xOrder.Get(u));
+		fprintf(pxFile, "#%u  %.2f KB  ~%.0f allocs  (%u samples)\n", u + 1,
+			static_cast<double>(xSite.m_ulEstimatedBytes) / 1024.0, xSite.m_fEstimatedAllocations, xSite.m_uSamples);
+		WriteSiteStack(pxFile, xSite);
+	}
+}
+
+void Zenith_HeapSampler::WriteGrowthReport(FILE* pxFile, const Zenith_Vector<Zenith_HeapSiteGrowth>& xGrowth, u_int uMaxSites)
+{
+	if (pxFile == nullptr)
+	{
+		return;
+	}
+
+	int64_t ilNet = 0;
+	for (u_int u = 0; u < xGrowth.GetSize(); u++)
+	{
+		ilNet += xGrowth.Get(u).m_ilDeltaBytes;
+	}
+	fprintf(pxFile, "=== Heap growth (sampled) ===\n");
+	fprintf(pxFile, "Net: %+.2f MB across %u changed sites\n", static_cast<double>(ilNet) / (1024.0 * 1024.0), xGrowth.GetSize());
+	for (u_int u = 0; u < xGrowth.GetSize() && u < uMaxSites; u++)
+	{
+		const Zenith_HeapSiteGrowth& xEntry = xGrowth.Get(u);
+		fprintf(pxFile, "#%u  %+.2f KB  %+.0f allocs  (now %.2f KB)\n", u + 1,
+			static_cast<double>(xEntry.m_ilDeltaBytes) / 1024.0, xEntry.m_fDeltaAllocations,
+			static_cast<double>(xEntry.m_xSite.m_ulEstimatedBytes) / 1024.0);
+		WriteSiteStack(pxFile, xEntry.m_xSite);
+	}
+}
+
+// =============================================================================
+// Sampling maths
+// =============================================================================
+
+u_int64 Zenith_HeapSampler::DrawInterval(u_int64& ulRngState, u_int64 ulMeanBytes)
+{
+	// xorshift64*; the state must never be zero.
+	if (ulRngState == 0)
+	{
+		ulRngState = 0x9E3779B97F4A7C15ull;
+	}
+	ulRngState ^= ulRngState >> 12;
+	ulRngState ^= ulRngState << 25;
+	ulRngState ^= ulRngState >> 27;
+	const u_int64 ulBits = ulRngState * 0x2545F4914F6CDD1Dull;
+
+	// Uniform in (0, 1], so the log is finite.
+	const double fUniform = (static_cast<double>(ulBits >> 11) + 1.0) * (1.0 / 9007199254740992.0);
+	const double fInterval = -std::log(fUniform) * static_cast<double>(ulMeanBytes);
+	return static_cast<u_int64>(fInterval) + 1;
+}
+
+u_int64 Zenith_HeapSampler::EstimateBytes(u_int64 ulSize, u_int64 ulMeanBytes)
+{
+	if (ulSize == 0 || ulMeanBytes == 0)
+	{
+		return ulSize;
+	}
+	const double fSize = static_cast<double>(ulSize);
+	const double fProbability = -std::expm1(-fSize / static_cast<double>(ulMeanBytes));
+	return static_cast<u_int64>(fSize / fProbability + 0.5);
+}
+
+// =============================================================================
+// Sampler (LITE only)
+// =============================================================================
+#if ZENITH_MEMORY_TRACKING_ANY && !ZENITH_MEMORY_TRACKING_FULL
+
+namespace
+{
+	// One sample. Only the owning thread writes a slot, and only while it is not
+	// live, under a sequence lock so TakeSnapshot (any thread) can tell a torn
+	// read from a good one. A free from any thread just clears m_bLive.
+	struct HeapSampleSlot
+	{
+		std::atomic<u_int32> m_uSequence{ 0 };   // odd while being written
+		std::atomic<bool> m_bLive{ false };
+		u_int m_uFrameCount = 0;
+		u_int64 m_ulSize = 0;
+		u_int64 m_ulEstimatedBytes = 0;
+		void* m_apFrames[uHEAP_SAMPLE_MAX_FRAMES] = {};
+	};
+
+	struct HeapSampleBuffer
+	{
+		HeapSampleSlot m_axSlots[Zenith_HeapSampler::uSLOTS_PER_THREAD];
+		u_int m_uNextSlot = 0;   // owner-only scan cursor
+	};
+
+	std::atomic<HeapSampleBuffer*> s_apxBuffers[Zenith_HeapSampler::uMAX_THREADS];
+	std::atomic<u_int> s_uBufferCount{ 0 };
+	std::atomic<u_int64> s_ulDroppedSamples{ 0 };
+	// Bumped by every Enable so each thread redraws its countdown at the new mean.
+	std::atomic<u_int32> s_uEnableGeneration{ 0 };
+
+	constexpr u_int uNO_BUFFER = ~0u;
+
+	thread_local int64_t tl_ilBytesUntilSample = 0;
+	thread_local u_int64 tl_ulRngState = 0;
+	thread_local u_int32 tl_uGeneration = 0;
+	thread_local u_int tl_uBufferIndex = uNO_BUFFER;
+	thread_local bool tl_bBufferClaimed = false;
+	thread_local bool tl_bInSampler = false;
+
+	// The buffer is raw malloc (never tracked, so claiming one cannot recurse
+	// into the sampler) and is never freed.
+	HeapSampleBuffer* ClaimThreadBuffer()
+	{
+		if (tl_bBufferClaimed)
+		{
+			return tl_uBufferIndex != uNO_BUFFER ? s_apxBuffers[tl_uBufferIndex].load(std::memory_order_relaxed) : nullptr;
+		}
+		tl_bBufferClaimed = true;
+
+		const u_int uIndex = s_uBufferCount.fetch_add(1, std::memory_order_relaxed);
+		if (uIndex >= Zenith_HeapSampler::uMAX_THREADS)
+		{
+			return nullptr;
+		}
+		void* pMemory = Zenith_MemoryManagement::Allocate(sizeof(HeapSampleBuffer));
+		if (pMemory == nullptr)
+		{
+			return nullptr;
+		}
+		HeapSampleBuffer* pxBuffer = new (pMemory) HeapSampleBuffer();
+		s_apxBuffers[uIndex].store(pxBuffer, std::memory_order_release);
+		tl_uBufferIndex = uIndex;
+		return pxBuffer;
+	}
+}
+
+void Zenith_HeapSampler::Enable(u_int64 ulMeanIntervalBytes)
+{
+	// Symbols for the reports, and Capture needs it on Windows. Not on the
+	// allocation path: SymInitialize allocates.
+	Zenith_Callstack::Initialise();
+	s_ulMeanIntervalBytes.store(ulMeanIntervalBytes > 0 ? ulMeanIntervalBytes : 1, std::memory_order_relaxed);
+	s_uEnableGeneration.fetch_add(1, std::memory_order_relaxed);
+	s_bEnabled.store(true, std::memory_order_release);
+	Zenith_Log(LOG_CATEGORY_CORE, "Heap sampling enabled, one sample per ~%llu bytes allocated",
+		static_cast<unsigned long long>(GetMeanInterval()));
+}
+
+void Zenith_HeapSampler::Disable()
+{
+	s_bEnabled.store(false, std::memory_order_release);
+}
+
+u_int64 Zenith_HeapSampler::GetDroppedSamples()
+{
+	return s_ulDroppedSamples.load(std::memory_order_relaxed);
+}
+
+bool Zenith_HeapSampler::OnAllocation(u_int64 ulSize, u_int16& uBufferOut, u_int32& uSlotOut)
+{
+	const u_int32 uGeneration = s_uEnableGeneration.load(std::memory_order_relaxed);
+	if (tl_uGeneration != uGeneration)
+	{
+		// First allocation on this thread since Enable: seed from the thread's
+		// own TLS address, and start the countdown rather than sampling.
+		if (tl_ulRngState == 0)
+		{
+			tl_ulRngState = reinterpret_cast<uintptr_t>(&tl_ulRngState) ^ 0x9E3779B97F4A7C15ull;
+		}
+		tl_uGeneration = uGeneration;
+		tl_ilBytesUntilSample = static_cast<int64_t>(DrawInterval(tl_ulRngState, GetMeanInterval()));
+		return false;
+	}
+
+	tl_ilBytesUntilSample -= static_cast<int64_t>(ulSize);
+	if (tl_ilBytesUntilSample > 0 || tl_bInSampler)
+	{
+		return false;
+	}
+
+	tl_bInSampler = true;
+	const u_int64 ulMean = GetMeanInterval();
+	tl_ilBytesUntilSample = static_cast<int64_t>(DrawInterval(tl_ulRngState, ulMean));
+
+	HeapSampleBuffer* pxBuffer = ClaimThreadBuffer();
+	if (pxBuffer == nullptr)
+	{
+		s_ulDroppedSamples.fetch_add(1, std::memory_order_relaxed);
+		tl_bInSampler = false;
+		return false;
+	}
+
+	// Scan from the cursor for a slot whose allocation has been freed.
+	HeapSampleSlot* pxSlot = nullptr;
+	for (u_int u = 0; u < uSLOTS_PER_THREAD; u++)
+	{
+		const u_int uCandidate = (pxBuffer->m_uNextSlot + u) % uSLOTS_PER_THREAD;
+		if (!pxBuffer->m_axSlots[uCandidate].m_bLive.load(std::memory_order_acquire))
+		{
+			pxSlot = &pxBuffer->m_axSlots[uCandidate];
+			pxBuffer->m_uNextSlot = (uCandidate + 1) % uSLOTS_PER_THREAD;
+			uSlotOut = uCandidate;
+			break;
+		}
+	}
+	if (pxSlot == nullptr)
+	{
+		s_ulDroppedSamples.fetch_add(1, std::memory_order_relaxed);
+		tl_bInSampler = false;
+		return false;
+	}
+
+	const u_int32 uSequence = pxSlot->m_uSequence.load(std::memory_order_relaxed);
+	pxSlot->m_uSequence.store(uSequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	// Skip this function, AllocateLite and operator new.
+	pxSlot->m_uFrameCount = Zenith_Callstack::Capture(pxSlot->m_apFrames, uHEAP_SAMPLE_MAX_FRAMES, 3);
+	pxSlot->m_ulSize = ulSize;
+	pxSlot->m_ulEstimatedBytes = EstimateBytes(ulSize, ulMean);
+	pxSlot->m_uSequence.store(uSequence + 2, std::memory_order_release);
+	pxSlot->m_bLive.store(true, std::memory_order_release);
+
+	uBufferOut = static_cast<u_int16>(tl_uBufferIndex);
+	tl_bInSampler = false;
+	return true;
+}
+
+void Zenith_HeapSampler::OnDeallocation(u_int16 uBuffer, u_int32 uSlot)
+{
+	if (uBuffer >= uMAX_THREADS || uSlot >= uSLOTS_PER_THREAD)
+	{
+		return;
+	}
+	HeapSampleBuffer* pxBuffer = s_apxBuffers[uBuffer].load(std::memory_order_acquire);
+	if (pxBuffer != nullptr)
+	{
+		pxBuffer->m_axSlots[uSlot].m_bLive.store(false, std::memory_order_release);
+	}
+}
+
+void Zenith_HeapSampler::TakeSnapshot(Zenith_HeapSnapshot& xOut)
+{
+	xOut = Zenith_HeapSnapshot();
+	xOut.m_ulDroppedSamples = GetDroppedSamples();
+
+	const u_int uBuffers = std::min(s_uBufferCount.load(std::memory_order_acquire), uMAX_THREADS);
+	for (u_int uBuffer = 0; uBuffer < uBuffers; uBuffer++)
+	{
+		// A claimed index can be briefly unpublished while its owner allocates it.
+		const HeapSampleBuffer* pxBuffer = s_apxBuffers[uBuffer].load(std::memory_order_acquire);
+		if (pxBuffer == nullptr)
+		{
+			continue;
+		}
+		for (u_int uSlot = 0; uSlot < uSLOTS_PER_THREAD; uSlot++)
+		{
+			const HeapSampleSlot& xSlot = pxBuffer->m_axSlots[uSlot];
+			const u_int32 uBefore = xSlot.m_uSequence.load(std::memory_order_acquire);
+			if ((uBefore & 1u) != 0u || !xSlot.m_bLive.load(std::memory_order_acquire))
+			{
+				continue;
+			}
+			void* apFrames[uHEAP_SAMPLE_MAX_FRAMES];
+			const u_int uFrameCount = std::min(xSlot.m_uFrameCount, uHEAP_SAMPLE_MAX_FRAMES);
+			memcpy(apFrames, xSlot.m_apFrames, uFrameCount * sizeof(void*));
+			const u_int64 ulSize = xSlot.m_ulSize;
+			const u_int64 ulEstimatedBytes = xSlot.m_ulEstimatedBytes;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (xSlot.m_uSequence.load(std::memory_order_relaxed) != uBefore)
+			{
+				continue;   // rewritten under us: it was freed and reused, so not live as read
+			}
+			xOut.AddSample(apFrames, uFrameCount, ulSize, ulEstimatedBytes);
+		}
+	}
+	xOut.Finalise();
+}
+
+#else // !LITE
+
+void Zenith_HeapSampler::Enable(u_int64 ulMeanIntervalBytes)
+{
+	(void)ulMeanIntervalBytes;
+	Zenith_Warning(LOG_CATEGORY_CORE, "Heap sampling needs the LITE memory tier (ZENITH_MEMORY_TRACKING_LEVEL=1); not enabled");
+}
+
+void Zenith_HeapSampler::Disable()
+{
+}
+
+u_int64 Zenith_HeapSampler::GetDroppedSamples()
+{
+	return 0;
+}
+
+void Zenith_HeapSampler::TakeSnapshot(Zenith_HeapSnapshot& xOut)
+{
+	xOut = Zenith_HeapSnapshot();
+}
+
+#endif
+
+#ifdef ZENITH_TESTING
+#include "Memory/Zenith_HeapSampler.Tests.inl"
+#endif
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Collections/Zenith_Vector.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+
+// =============================================================================
+// Zenith_HeapSampler
+// -----------------------------------------------------------------------------
+// Sampling heap profiler for LITE builds. FULL records every allocation with a
+// callstack under a lock, which is too slow to leave on; this records roughly
+// one allocation per ulMeanIntervalBytes allocated (a Poisson process over
+// bytes, as in tcmalloc), with its callstack, and weights each sample by the
+// bytes it stands for. Summing the weights of the samples still live gives an
+// unbiased estimate of the live heap, broken down by allocation site.
+//
+// Cost. Disabled: one relaxed atomic load per operator new. Enabled: a
+// thread-local countdown per allocation, plus a stack capture for the rare
+// allocation that is sampled. Samples go into the allocating thread's own
+// buffer (no lock); the LITE header of a sampled block names its slot, so the
+// free from any thread is one atomic store.
+//
+// Use. Enable (or --heap-sample[=<mean bytes>]), then TakeSnapshot at two
+// points and ComputeGrowth between them: sites whose live estimate keeps
+// climbing are leaks, or caches that never shrink. --memory-dump writes the
+// live-by-site report and the growth since the previous dump to
+// zenith_heap_profile.txt.
+//
+// Tiers. Sampling hooks the LITE allocator only; at FULL every allocation is
+// already recorded and at OFF nothing is, so Enable there logs and does nothing.
+// The snapshot and growth types work at every tier (and are what the unit
+// tests drive directly).
+//
+// Limits. Each thread holds up to uSLOTS_PER_THREAD live samples and up to
+// uMAX_THREADS threads get a buffer; samples past either limit are dropped and
+// counted (GetDroppedSamples), which biases the estimate low. Buffers are
+// never freed, so samples from threads that have exited still report.
+// =============================================================================
+
+static constexpr u_int uHEAP_SAMPLE_MAX_FRAMES = 16;
+
+// One allocation site (a distinct callstack) in a snapshot.
+struct Zenith_HeapSiteStats
+{
+	u_int64 m_ulHash = 0;
+	u_int m_uFrameCount = 0;
+	void* m_apFrames[uHEAP_SAMPLE_MAX_FRAMES] = {};
+	u_int64 m_ulEstimatedBytes = 0;
+	double m_fEstimatedAllocations = 0.0;   // sum of 1 / P(sampled) over the samples
+	u_int m_uSamples = 0;
+};
+
+struct Zenith_HeapSiteGrowth
+{
+	Zenith_HeapSiteStats m_xSite;        // the later snapshot's site (the earlier one's if it vanished)
+	int64_t m_ilDeltaBytes = 0;
+	double m_fDeltaAllocations = 0.0;
+};
+
+// Live samples aggregated by site. AddSample collects; Finalise sorts by site
+// and merges duplicates (TakeSnapshot does both).
+class Zenith_HeapSnapshot
+{
+public:
+	void AddSample(void* const* apFrames, u_int uFrameCount, u_int64 ulSize, u_int64 ulEstimatedBytes);
+	void Finalise();
+
+	const Zenith_Vector<Zenith_HeapSiteStats>& GetSites() const { return m_xSites; }
+	u_int64 GetEstimatedBytes() const { return m_ulEstimatedBytes; }
+	u_int64 GetDroppedSamples() const { return m_ulDroppedSamples; }
+
+private:
+	friend class Zenith_HeapSampler;
+
+	Zenith_Vector<Zenith_HeapSiteStats> m_xSites;
+	u_int64 m_ulEstimatedBytes = 0;
+	u_int64 m_ulDroppedSamples = 0;
+};
+
+class Zenith_HeapSampler
+{
+public:
+	static constexpr u_int64 ulDEFAULT_MEAN_INTERVAL_BYTES = 512 * 1024;
+	static constexpr u_int uSLOTS_PER_THREAD = 1024;
+	static constexpr u_int uMAX_THREADS = 256;
+
+	// Start/stop taking new samples. Samples already taken stay until freed.
+	static void Enable(u_int64 ulMeanIntervalBytes = ulDEFAULT_MEAN_INTERVAL_BYTES);
+	static void Disable();
+	static bool IsEnabled() { return s_bEnabled.load(std::memory_order_relaxed); }
+	static u_int64 GetMeanInterval() { return s_ulMeanIntervalBytes.load(std::memory_order_relaxed); }
+	static u_int64 GetDroppedSamples();
+
+	// Every live sample, across all threads, aggregated by site.
+	static void TakeSnapshot(Zenith_HeapSnapshot& xOut);
+
+	// Per-site change from xBefore to xAfter (both finalised), largest growth
+	// first; sites that did not change are left out.
+	static void ComputeGrowth(const Zenith_HeapSnapshot& xBefore, const Zenith_HeapSnapshot& xAfter,
+		Zenith_Vector<Zenith_HeapSiteGrowth>& xGrowthOut);
+
+	// Human-readable reports with symbolicated stacks, top uMaxSites sites.
+	static void WriteSnapshotReport(FILE* pxFile, const Zenith_HeapSnapshot& xSnapshot, u_int uMaxSites);
+	static void WriteGrowthReport(FILE* pxFile, const Zenith_Vector<Zenith_HeapSiteGrowth>& xGrowth, u_int uMaxSites);
+
+	// The sampling maths, exposed for the tests.
+	// Next gap in bytes: exponential with the given mean, from an xorshift state.
+	static u_int64 DrawInterval(u_int64& ulRngState, u_int64 ulMeanBytes);
+	// Bytes a sample of ulSize stands for: ulSize / P(sampled) with
+	// P = 1 - exp(-ulSize / ulMeanBytes).
+	static u_int64 EstimateBytes(u_int64 ulSize, u_int64 ulMeanBytes);
+
+#if ZENITH_MEMORY_TRACKING_ANY && !ZENITH_MEMORY_TRACKING_FULL
+	// Allocator hooks, called by the LITE path in Zenith_MemoryManagement.cpp.
+	// OnAllocation returns true when this allocation was sampled and fills the
+	// slot to store in its header; OnDeallocation retires that slot.
+	static bool OnAllocation(u_int64 ulSize, u_int16& uBufferOut, u_int32& uSlotOut);
+	static void OnDeallocation(u_int16 uBuffer, u_int32 uSlot);
+#endif
+
+private:
+	static inline std::atomic<bool> s_bEnabled{ false };
+	static inline std::atomic<u_int64> s_ulMeanIntervalBytes{ ulDEFAULT_MEAN_INTERVAL_BYTES };
+};
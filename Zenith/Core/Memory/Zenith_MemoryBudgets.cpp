@@ -24,6 +24,7 @@ namespace
 		{ MEMORY_CATEGORY_PHYSICS,     128 * kMB },
 		{ MEMORY_CATEGORY_SCENE,       128 * kMB },
 		{ MEMORY_CATEGORY_GPU_STAGING, 128 * kMB },
+		{ MEMORY_CATEGORY_FRAME_ARENA,  64 * kMB },
 		{ MEMORY_CATEGORY_ECS,          64 * kMB },
 		{ MEMORY_CATEGORY_ANIMATION,    64 * kMB },
 		{ MEMORY_CATEGORY_AUDIO,        64 * kMB },
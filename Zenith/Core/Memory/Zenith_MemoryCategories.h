@@ -27,6 +27,7 @@ enum Zenith_MemoryCategory : u_int8
 	MEMORY_CATEGORY_TERRAIN,      // terrain streaming: large, bursty, budgetable
 	MEMORY_CATEGORY_NETWORK,      // forward-looking; zero cost if unused
 	MEMORY_CATEGORY_GPU_STAGING,  // CPU-side upload/staging buffers feeding VMA
+	MEMORY_CATEGORY_FRAME_ARENA,  // Zenith_FrameAllocator blocks (reserved, reused every frame)
 
 	MEMORY_CATEGORY_COUNT
 };
@@ -55,7 +56,8 @@ inline constexpr const char* g_aszMemoryCategoryNames[MEMORY_CATEGORY_COUNT] = {
 	"ECS",
 	"Terrain",
 	"Network",
-	"GPUStaging"
+	"GPUStaging",
+	"FrameArena"
 };
 
 inline const char* GetMemoryCategoryName(Zenith_MemoryCategory eCategory)
@@ -9,7 +9,8 @@
 //                   callstack capture, leak + double-free + guard checks.
 //   LITE (Release): AllocateLite/DeallocateLite — a fixed header placed immediately
 //                   before the user pointer (base recovery + size + category) plus
-//                   lock-free per-category atomic counters. No hashmap/guards/stacks.
+//                   lock-free per-category atomic counters. No hashmap/guards, and
+//                   stacks only for the allocations Zenith_HeapSampler samples.
 //   OFF  (Final):   straight malloc/free.
 //
 // Attribution is the thread-local category scope stack (ZENITH_MEMORY_SCOPE); there
@@ -20,6 +21,7 @@
 
 #include "Zenith.h"
 #include "Zenith_MemoryManagement.h"
+#include "Memory/Zenith_FrameAllocator.h"
 
 #if ZENITH_MEMORY_TRACKING_ANY
 #include "Memory/Zenith_MemoryFrameSample.h"
@@ -31,6 +33,10 @@ static_assert(MEMORY_CATEGORY_COUNT <= ZENITH_MEM_CAT_MAX,
 	"Zenith_MemoryFrameSample per-category arrays are too small for MEMORY_CATEGORY_COUNT — raise ZENITH_MEM_CAT_MAX");
 #endif
 
+#if ZENITH_MEMORY_TRACKING_ANY && !ZENITH_MEMORY_TRACKING_FULL
+#include "Memory/Zenith_HeapSampler.h"
+#endif
+
 #if ZENITH_MEMORY_TRACKING_FULL
 #include "Memory/Zenith_MemoryTracker.h"
 #include "Callstack/Zenith_Callstack.h"
@@ -363,11 +369,11 @@ struct Zenith_LiteHeader
 {
 	u_int32 m_uMagic;
 	u_int8  m_eCategory;
-	u_int8  m_uFlags;      // bit0 = allocated via AllocateAligned (free via _aligned_free)
-	u_int16 m_uReserved0;
-	u_int32 m_uOffset;     // user - real
-	u_int32 m_uReserved1;
-	u_int64 m_ulSize;      // request size
+	u_int8  m_uFlags;        // bit0 = allocated via AllocateAligned (free via _aligned_free), bit1 = heap-sampled
+	u_int16 m_uSampleBuffer; // Zenith_HeapSampler thread buffer, when bit1 is set
+	u_int32 m_uOffset;       // user - real
+	u_int32 m_uSampleSlot;   // slot within that buffer, when bit1 is set
+	u_int64 m_ulSize;        // request size
 };
 static_assert(sizeof(Zenith_LiteHeader) == 24, "Zenith_LiteHeader must be 24 bytes");
 
@@ -409,11 +415,18 @@ void* Zenith_MemoryManagement::AllocateLite(size_t ullSize, size_t ulAlignment,
 	pHeader->m_uMagic = uLITE_MAGIC;
 	pHeader->m_eCategory = static_cast<u_int8>(eResolved);
 	pHeader->m_uFlags = (ulAlignment > 0) ? 1u : 0u;
-	pHeader->m_uReserved0 = 0;
+	pHeader->m_uSampleBuffer = 0;
 	pHeader->m_uOffset = static_cast<u_int32>(ulRoom);
-	pHeader->m_uReserved1 = 0;
+	pHeader->m_uSampleSlot = 0;
 	pHeader->m_ulSize = ullSize;
 
+	// The sampler keeps thread-local state, so it too waits for initialisation.
+	if (Zenith_HeapSampler::IsEnabled() && g_bMemoryManagementInitialised.load(std::memory_order_acquire)
+		&& Zenith_HeapSampler::OnAllocation(ullSize, pHeader->m_uSampleBuffer, pHeader->m_uSampleSlot))
+	{
+		pHeader->m_uFlags |= 2u;
+	}
+
 	s_aulLiteCategoryBytes[eResolved].fetch_add(ullSize, std::memory_order_relaxed);
 	s_aulLiteCategoryCount[eResolved].fetch_add(1, std::memory_order_relaxed);
 	s_ulLiteTotalCount.fetch_add(1, std::memory_order_relaxed);
@@ -460,6 +473,10 @@ void Zenith_MemoryManagement::DeallocateLite(void* p)
 	}
 	s_ulLiteTotalBytes.fetch_sub(pHeader->m_ulSize, std::memory_order_relaxed);
 	s_ulLiteTotalCount.fetch_sub(1, std::memory_order_relaxed);
+	if ((pHeader->m_uFlags & 2u) != 0u)
+	{
+		Zenith_HeapSampler::OnDeallocation(pHeader->m_uSampleBuffer, pHeader->m_uSampleSlot);
+	}
 
 	void* pReal = static_cast<u_int8*>(p) - pHeader->m_uOffset;
 	const bool bAligned = (pHeader->m_uFlags & 1u) != 0u;
@@ -516,6 +533,15 @@ Zenith_MemoryFrameSample Zenith_MemoryManagement::SampleFrame()
 	return xSample;
 }
 
+void Zenith_MemoryManagement::ResetPeak()
+{
+#if ZENITH_MEMORY_TRACKING_FULL
+	Zenith_MemoryTracker::ResetPeak();
+#else // LITE
+	s_ulLitePeakBytes.store(s_ulLiteTotalBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+#endif
+}
+
 void Zenith_MemoryManagement::WriteReport(FILE* pxFile)
 {
 	if (pxFile == nullptr)
@@ -617,6 +643,9 @@ void Zenith_MemoryManagement::Shutdown()
 	// static std::string). The tracker's own bookkeeping is reclaimed by the OS at exit.
 	// Call this as the LAST step of Zenith_Engine::Shutdown(), after every engine-owned
 	// tracked object is freed.
+	// The main thread's frame arena would otherwise only be freed at thread exit,
+	// after this report, and show up as leaks. Worker threads have exited by now.
+	Zenith_FrameAllocator::ReleaseThreadArena();
 #if ZENITH_MEMORY_TRACKING_FULL
 	ReportLeaks();
 #endif
@@ -624,6 +653,8 @@ void Zenith_MemoryManagement::Shutdown()
 
 void Zenith_MemoryManagement::BeginFrame()
 {
+	// Recycles the frame arenas' oldest generation (lazily, per thread).
+	Zenith_FrameAllocator::BeginFrame();
 #if ZENITH_MEMORY_TRACKING_FULL
 	Zenith_MemoryTracker::BeginFrame();   // reset per-frame delta / alloc / dealloc counters
 #endif
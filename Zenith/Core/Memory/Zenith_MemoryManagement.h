@@ -105,6 +105,12 @@ public:
 	// LITE. Never allocates; safe to call on the main thread at the frame boundary.
 	static Zenith_MemoryFrameSample SampleFrame();
 
+	// Restart the total peak from the current live bytes, so a caller can read the
+	// high-water of one stretch of work from the next SampleFrame. Per-category peaks
+	// are untouched. The benchmark runner's tool: the lifetime peak in the reports
+	// is lost, which is why nothing else calls it.
+	static void ResetPeak();
+
 	// Memory reports for --memory-dump and the profiling report's Memory section.
 	// WriteReport is human-readable text; WriteReportCSV is the machine-readable feed
 	// for the CI budget gate — schema: kind,name,bytes,count,peak_bytes,budget_bytes.
@@ -221,6 +221,13 @@ Zenith_MemoryStats Zenith_MemoryTracker::CopyStats()
 	return s_xStats; // copy under the lock — no torn reads while workers allocate
 }
 
+void Zenith_MemoryTracker::ResetPeak()
+{
+	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(Mutex());
+	s_xStats.m_ulPeakAllocated = s_xStats.m_ulTotalAllocated;
+	s_xStats.m_ulPeakAllocationCount = s_xStats.m_ulTotalAllocationCount;
+}
+
 const Zenith_AllocationRecord* Zenith_MemoryTracker::FindAllocation(void* pAddress)
 {
 	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(Mutex());
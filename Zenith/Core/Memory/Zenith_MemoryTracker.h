@@ -84,6 +84,8 @@ public:
 	// allocating worker threads (editor panel, profiler SampleFrame, budgets) must
 	// use this, not the live reference from GetStats().
 	static Zenith_MemoryStats CopyStats();
+	// Peak bytes and count restart from the current totals (see Zenith_MemoryManagement::ResetPeak).
+	static void ResetPeak();
 	static const Zenith_AllocationRecord* FindAllocation(void* pAddress);
 	// Race-free: copies the record BY VALUE under the mutex. Callers that then act on
 	// the record (e.g. DeallocateTracked reading m_pRealAddress) MUST use this, never
@@ -30,6 +30,11 @@ bool Zenith_Multithreading::IsMainThread()
 	return Platform_IsMainThread();
 }
 
+const char* Zenith_Multithreading::GetCurrentThreadName()
+{
+	return Platform_GetCurrentThreadName();
+}
+
 u_int Zenith_Multithreading::AllocateThreadID(bool bMainThread)
 {
 	const u_int uID = m_uNextThreadID.fetch_add(1);
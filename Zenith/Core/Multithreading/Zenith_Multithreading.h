@@ -20,6 +20,8 @@ public:
 	void RegisterThread(const bool bMainThread = false);
 	u_int GetCurrentThreadID();
 	bool IsMainThread();
+	// Name passed to CreateThread; "" for threads it did not create (main).
+	const char* GetCurrentThreadName();
 
 	static constexpr u_int uMAX_THREAD_NAME_LENGTH = 128;
 
@@ -36,6 +38,7 @@ private:
 	void Platform_RegisterThread(const bool bMainThread);
 	u_int Platform_GetCurrentThreadID();
 	bool Platform_IsMainThread();
+	const char* Platform_GetCurrentThreadName();
 };
 
 // Bridge free function: lets headers that run on worker threads (e.g. the inline
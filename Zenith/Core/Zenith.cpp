@@ -13,7 +13,7 @@
 // top-level Core\Zenith*.cpp EXCEPT Zenith.cpp and Zenith_String.cpp, so a NEW
 // Core\Zenith_LogFileSink.cpp would compile into the aggregate engine lib but NOT
 // into ZenithBase -- and the Sentinels would fail to link on an undefined
-// Zenith_LogFileSinkWrite. Putting the implementation HERE, in a file that is
+// Zenith_LogSinkWrite. Putting the implementation HERE, in a file that is
 // already an L0 member, makes the symbol available to every lib with no Sharpmake
 // change and no new link edge. Do not move it out without re-reading that regex.
 //
@@ -50,6 +50,7 @@
 // does for the same call.
 #include "Core/Zenith_Win32.h"
 
+#include <csignal>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
@@ -233,37 +234,553 @@ namespace
 	}
 }
 
+// ============================================================================
+// THE ASYNC WRITER.
+//
+// Writing and flushing every line on the caller, under one lock, made logging a
+// serialisation point: a burst from the task workers queued them all on the
+// same mutex and on an fflush each. While the writer runs, a line instead goes
+// into the calling thread's OWN ring -- single producer, single consumer, no
+// lock -- and the writer thread drains every ring, adds the prefixes, batches
+// the text and issues one fwrite per batch.
+//
+// The caller still formats (one vsnprintf, straight into its ring slot). Packing
+// the raw arguments and formatting on the writer is NOT safe here: a %s argument
+// routinely points at a stack buffer or a temporary string that is gone before
+// the writer runs.
+//
+// Ordering. Each record carries a ticket from one global counter and the writer
+// merges the rings by ticket, so the file reads in the order the lines were
+// logged, across threads.
+//
+// Rings are a fixed static pool (still no allocation), leased to a thread on its
+// first line and returned by the lease's thread_local destructor; the writer
+// hands a returned ring out again once it has drained it. A thread that finds
+// the pool exhausted, or logs while no writer is running, takes the synchronous
+// path -- which drains the rings first, so it never overtakes queued lines.
+//
+// Flushing. stdout is flushed after every writer pass; the file after any pass
+// that wrote a warning or error, and otherwise at most every uFILE_FLUSH_MS. An
+// error is flushed to disk before Zenith_LogImpl returns (Zenith_LogFlush), so
+// the message of an assert or a fatal error is on disk before the debug break.
+// Zenith_DebugBreak, an unhandled SEH exception and SIGABRT also drain whatever
+// is still queued (Zenith_LogFlushForCrash), so the lines leading up to a crash
+// are not left in a ring that dies with the process.
+//
+// A full ring. The producer BLOCKS until the writer has made room, on an event
+// the drain sets, rather than dropping the line: a log that silently loses the
+// lines around a burst is worst exactly when someone is reading it. A ring only
+// fills when one thread outruns the writer by 64 KB, so the wait is rare and
+// bounded by one drain pass.
+// ============================================================================
+namespace
+{
+	constexpr u_int uNUM_LOG_RINGS = 32u;
+	constexpr u_int uLOG_RING_BYTES = 64u * 1024u;
+	constexpr u_int uLOG_TEXT_BYTES = 2048u;   // Zenith_LogImpl's own buffer size.
+	constexpr u_int uLOG_RECORD_ALIGN = 16u;
+	constexpr u_int uWRITER_WAIT_MS = 5u;
+	constexpr u_int uFILE_FLUSH_MS = 100u;
+	constexpr u_int8 uPADDING_CATEGORY = 0xFFu;
+
+	struct LogRecordHeader
+	{
+		u_int64 m_ulSequence;
+		u_int32 m_uSize;          // Whole record, header included; a multiple of uLOG_RECORD_ALIGN.
+		u_int16 m_uTextLength;    // Excluding the terminator.
+		u_int8  m_uCategory;      // uPADDING_CATEGORY: skip to the end of the ring.
+		u_int8  m_uLevel;
+	};
+	static_assert(sizeof(LogRecordHeader) == uLOG_RECORD_ALIGN, "LogRecordHeader must stay one alignment unit");
+
+	constexpr u_int uMAX_LOG_RECORD_BYTES = ((sizeof(LogRecordHeader) + uLOG_TEXT_BYTES + uLOG_RECORD_ALIGN - 1u) / uLOG_RECORD_ALIGN) * uLOG_RECORD_ALIGN;
+	static_assert(uLOG_RING_BYTES % uLOG_RECORD_ALIGN == 0u, "Ring size must be a multiple of the record alignment");
+
+	enum LogRingState : u_int32
+	{
+		LOG_RING_FREE,
+		LOG_RING_LEASED,
+		LOG_RING_ORPHANED,   // Owner thread exited; recycled once drained.
+	};
+
+	struct LogRing
+	{
+		// Byte positions, never wrapped; the offset into m_acData is position % size.
+		alignas(64) std::atomic<u_int64> m_ulHead{ 0 };   // Written by the owner only.
+		alignas(64) std::atomic<u_int64> m_ulTail{ 0 };   // Written by the drainer only.
+		std::atomic<u_int32> m_uState{ LOG_RING_FREE };
+		// Set around each record so Zenith_LogStopAsyncWriter can wait for a line
+		// that is mid-write instead of leaving it behind.
+		std::atomic<bool> m_bWriting{ false };
+		alignas(uLOG_RECORD_ALIGN) unsigned char m_acData[uLOG_RING_BYTES];
+	};
+
+	LogRing g_axLogRings[uNUM_LOG_RINGS];
+	std::atomic<u_int64> g_ulNextLogSequence{ 0 };
+	std::atomic<bool> g_bAsyncRunning{ false };
+	std::atomic<bool> g_bWriterStopRequested{ false };
+	HANDLE g_xWriterThread = nullptr;
+	HANDLE g_xWriterWakeEvent = nullptr;
+	HANDLE g_xRingSpaceEvent = nullptr;   // Manual reset; set after every drain pass.
+	LPTOP_LEVEL_EXCEPTION_FILTER g_pfnPreviousExceptionFilter = nullptr;
+	void (*g_pfnPreviousAbortHandler)(int) = SIG_DFL;
+	u_int64 g_ulLastFileFlushMs = 0;
+
+	// Batches for one drain pass. Drained under the sink mutex, so one of each.
+	char g_acStdoutBatch[uLOG_RING_BYTES];
+	char g_acFileBatch[uLOG_RING_BYTES];
+
+	// Zenith_Mutex_NoProfiling, not Zenith_Mutex: the profiling variant reaches for
+	// engine state, and this runs before the engine exists. Same choice, for the
+	// same reason, as Zenith_MemoryTracker::Mutex and the AssetRegistry's
+	// serializable-type registry mutex -- both of which also run during static init.
+	// Serialises the drainers (writer thread, Zenith_LogFlush) and the synchronous path.
+	Zenith_Mutex_NoProfiling& SinkMutex()
+	{
+		static Zenith_Mutex_NoProfiling s_xMutex;
+		return s_xMutex;
+	}
+
+	const char* LevelName(int eLevel)
+	{
+		static const char* const aszLevel[] = { "INFO", "WARN", "ERROR" };
+		return (eLevel >= 0 && eLevel <= 2) ? aszLevel[eLevel] : "INFO";
+	}
+
+	// This thread's ring. Claimed on the first queued line, released at thread exit.
+	struct LogRingLease
+	{
+		~LogRingLease()
+		{
+			if (m_pxRing != nullptr)
+			{
+				m_pxRing->m_uState.store(LOG_RING_ORPHANED, std::memory_order_release);
+			}
+		}
+
+		LogRing* m_pxRing = nullptr;
+	};
+	thread_local LogRingLease tl_g_xLogRingLease;
+
+	LogRing* GetThreadLogRing()
+	{
+		LogRingLease& xLease = tl_g_xLogRingLease;
+		if (xLease.m_pxRing == nullptr)
+		{
+			for (u_int u = 0; u < uNUM_LOG_RINGS; ++u)
+			{
+				u_int32 uExpected = LOG_RING_FREE;
+				if (g_axLogRings[u].m_uState.compare_exchange_strong(uExpected, LOG_RING_LEASED, std::memory_order_acquire))
+				{
+					xLease.m_pxRing = &g_axLogRings[u];
+					break;
+				}
+			}
+		}
+		return xLease.m_pxRing;
+	}
+
+	void WakeWriter()
+	{
+		if (g_xWriterWakeEvent != nullptr)
+		{
+			::SetEvent(g_xWriterWakeEvent);
+		}
+	}
+
+	// Appends one record to this thread's ring: szText verbatim, or szFormat
+	// formatted in place. False, with nothing written, if no writer is running or
+	// no ring is free.
+	bool QueueLogRecord(Zenith_LogCategory eCategory, int eLevel, const char* szText, const char* szFormat, va_list* pxArgs)
+	{
+		if (!g_bAsyncRunning.load(std::memory_order_relaxed))
+		{
+			return false;
+		}
+		LogRing* pxRing = GetThreadLogRing();
+		if (pxRing == nullptr)
+		{
+			return false;
+		}
+
+		// Flag first, then re-check: paired with the store-then-scan in
+		// Zenith_LogStopAsyncWriter, either this sees the writer stopping or Stop
+		// sees this record in progress and waits for it.
+		pxRing->m_bWriting.store(true, std::memory_order_seq_cst);
+		if (!g_bAsyncRunning.load(std::memory_order_seq_cst))
+		{
+			pxRing->m_bWriting.store(false, std::memory_order_release);
+			return false;
+		}
+
+		// Room for the longest record, contiguous: pad to the start of the ring when
+		// the end cannot hold it.
+		const u_int64 ulHead = pxRing->m_ulHead.load(std::memory_order_relaxed);
+		const u_int uOffset = static_cast<u_int>(ulHead % uLOG_RING_BYTES);
+		const u_int uPadding = (uLOG_RING_BYTES - uOffset < uMAX_LOG_RECORD_BYTES) ? (uLOG_RING_BYTES - uOffset) : 0u;
+		const auto RingIsFull = [&]()
+		{
+			return uLOG_RING_BYTES - (ulHead - pxRing->m_ulTail.load(std::memory_order_acquire)) < uPadding + uMAX_LOG_RECORD_BYTES;
+		};
+		while (RingIsFull())
+		{
+			// Full: block until a drain pass has made room (see the block comment).
+			// Reset before the re-check, so a drain between the two still wakes us.
+			// Still flagged as writing, so Stop has not closed either event yet.
+			::ResetEvent(g_xRingSpaceEvent);
+			WakeWriter();
+			if (RingIsFull())
+			{
+				::WaitForSingleObject(g_xRingSpaceEvent, uWRITER_WAIT_MS);
+			}
+		}
+
+		if (uPadding > 0u)
+		{
+			LogRecordHeader* pxPadding = reinterpret_cast<LogRecordHeader*>(pxRing->m_acData + uOffset);
+			pxPadding->m_ulSequence = 0;
+			pxPadding->m_uSize = uPadding;
+			pxPadding->m_uTextLength = 0;
+			pxPadding->m_uCategory = uPADDING_CATEGORY;
+			pxPadding->m_uLevel = 0;
+		}
+
+		unsigned char* pucRecord = pxRing->m_acData + ((uOffset + uPadding) % uLOG_RING_BYTES);
+		char* szRecordText = reinterpret_cast<char*>(pucRecord + sizeof(LogRecordHeader));
+		int iLength = 0;
+		if (szText != nullptr)
+		{
+			strncpy_s(szRecordText, uLOG_TEXT_BYTES, szText, _TRUNCATE);
+			iLength = static_cast<int>(strlen(szRecordText));
+		}
+		else
+		{
+			iLength = vsnprintf(szRecordText, uLOG_TEXT_BYTES, szFormat, *pxArgs);
+			if (iLength < 0)
+			{
+				szRecordText[0] = '\0';
+				iLength = 0;
+			}
+		}
+		const u_int uTextLength = (static_cast<u_int>(iLength) < uLOG_TEXT_BYTES) ? static_cast<u_int>(iLength) : uLOG_TEXT_BYTES - 1u;
+		const u_int uSize = ((sizeof(LogRecordHeader) + uTextLength + 1u + uLOG_RECORD_ALIGN - 1u) / uLOG_RECORD_ALIGN) * uLOG_RECORD_ALIGN;
+
+		LogRecordHeader* pxHeader = reinterpret_cast<LogRecordHeader*>(pucRecord);
+		pxHeader->m_ulSequence = g_ulNextLogSequence.fetch_add(1, std::memory_order_relaxed);
+		pxHeader->m_uSize = uSize;
+		pxHeader->m_uTextLength = static_cast<u_int16>(uTextLength);
+		pxHeader->m_uCategory = static_cast<u_int8>(eCategory);
+		pxHeader->m_uLevel = static_cast<u_int8>(eLevel);
+
+		const u_int64 ulNewHead = ulHead + uPadding + uSize;
+		pxRing->m_ulHead.store(ulNewHead, std::memory_order_release);
+
+		// Half full: wake the writer now rather than at its next timeout. Still
+		// flagged as writing, so Stop has not closed the event yet.
+		if (ulNewHead - pxRing->m_ulTail.load(std::memory_order_relaxed) > uLOG_RING_BYTES / 2u)
+		{
+			WakeWriter();
+		}
+		pxRing->m_bWriting.store(false, std::memory_order_release);
+		return true;
+	}
+
+	void WriteBatches(u_int& uStdoutBytes, u_int& uFileBytes)
+	{
+		if (uStdoutBytes > 0u)
+		{
+			fwrite(g_acStdoutBatch, 1, uStdoutBytes, stdout);
+			uStdoutBytes = 0u;
+		}
+		if (uFileBytes > 0u)
+		{
+			if (g_pxLogFile != nullptr)
+			{
+				fwrite(g_acFileBatch, 1, uFileBytes, g_pxLogFile);
+			}
+			uFileBytes = 0u;
+		}
+	}
+
+	// Writes every queued record, oldest ticket first. Caller holds SinkMutex.
+	void DrainLogRingsLocked(bool bForceFileFlush)
+	{
+		OpenLogFileOnce();
+
+		u_int uStdoutBytes = 0u;
+		u_int uFileBytes = 0u;
+		int iMaxLevel = -1;
+		for (;;)
+		{
+			LogRing* pxOldestRing = nullptr;
+			const LogRecordHeader* pxOldest = nullptr;
+			for (u_int u = 0; u < uNUM_LOG_RINGS; ++u)
+			{
+				LogRing& xRing = g_axLogRings[u];
+				if (xRing.m_uState.load(std::memory_order_acquire) == LOG_RING_FREE)
+				{
+					continue;
+				}
+				const u_int64 ulHead = xRing.m_ulHead.load(std::memory_order_acquire);
+				u_int64 ulTail = xRing.m_ulTail.load(std::memory_order_relaxed);
+				while (ulTail < ulHead)
+				{
+					const LogRecordHeader* pxHeader = reinterpret_cast<const LogRecordHeader*>(xRing.m_acData + (ulTail % uLOG_RING_BYTES));
+					if (pxHeader->m_uCategory != uPADDING_CATEGORY)
+					{
+						if (pxOldest == nullptr || pxHeader->m_ulSequence < pxOldest->m_ulSequence)
+						{
+							pxOldest = pxHeader;
+							pxOldestRing = &xRing;
+						}
+						break;
+					}
+					ulTail += pxHeader->m_uSize;
+					xRing.m_ulTail.store(ulTail, std::memory_order_release);
+				}
+			}
+			if (pxOldest == nullptr)
+			{
+				break;
+			}
+
+			// The longest line plus both prefixes always fits in what is left.
+			if (uLOG_RING_BYTES - uFileBytes < uMAX_LOG_RECORD_BYTES + 128u)
+			{
+				WriteBatches(uStdoutBytes, uFileBytes);
+			}
+
+			const char* szCategory = Zenith_GetLogCategoryName(static_cast<Zenith_LogCategory>(pxOldest->m_uCategory));
+			const char* szText = reinterpret_cast<const char*>(pxOldest + 1);
+			const int iStdout = snprintf(g_acStdoutBatch + uStdoutBytes, uLOG_RING_BYTES - uStdoutBytes,
+				"[%s] %.*s\n", szCategory, static_cast<int>(pxOldest->m_uTextLength), szText);
+			const int iFile = snprintf(g_acFileBatch + uFileBytes, uLOG_RING_BYTES - uFileBytes,
+				"[%-5s] [%s] %.*s\n", LevelName(pxOldest->m_uLevel), szCategory, static_cast<int>(pxOldest->m_uTextLength), szText);
+			uStdoutBytes += (iStdout > 0) ? static_cast<u_int>(iStdout) : 0u;
+			uFileBytes += (iFile > 0) ? static_cast<u_int>(iFile) : 0u;
+			if (static_cast<int>(pxOldest->m_uLevel) > iMaxLevel)
+			{
+				iMaxLevel = pxOldest->m_uLevel;
+			}
+
+			// Copied out, so the producer may reuse the bytes.
+			pxOldestRing->m_ulTail.fetch_add(pxOldest->m_uSize, std::memory_order_release);
+		}
+
+		WriteBatches(uStdoutBytes, uFileBytes);
+		if (iMaxLevel >= 0)
+		{
+			fflush(stdout);
+		}
+
+		const u_int64 ulNowMs = ::GetTickCount64();
+		if (g_pxLogFile != nullptr && (bForceFileFlush || iMaxLevel >= 1 || (iMaxLevel >= 0 && ulNowMs - g_ulLastFileFlushMs >= uFILE_FLUSH_MS)))
+		{
+			fflush(g_pxLogFile);
+			g_ulLastFileFlushMs = ulNowMs;
+		}
+
+		// A ring whose thread has exited goes back to the pool once it is empty.
+		for (u_int u = 0; u < uNUM_LOG_RINGS; ++u)
+		{
+			LogRing& xRing = g_axLogRings[u];
+			if (xRing.m_uState.load(std::memory_order_acquire) == LOG_RING_ORPHANED
+				&& xRing.m_ulTail.load(std::memory_order_relaxed) == xRing.m_ulHead.load(std::memory_order_acquire))
+			{
+				xRing.m_uState.store(LOG_RING_FREE, std::memory_order_release);
+			}
+		}
+
+		if (g_xRingSpaceEvent != nullptr)
+		{
+			::SetEvent(g_xRingSpaceEvent);
+		}
+	}
+
+	DWORD WINAPI LogWriterThreadMain(LPVOID)
+	{
+		while (!g_bWriterStopRequested.load(std::memory_order_acquire))
+		{
+			::WaitForSingleObject(g_xWriterWakeEvent, uWRITER_WAIT_MS);
+			Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(SinkMutex());
+			DrainLogRingsLocked(false);
+		}
+		return 0;
+	}
+
+	LONG WINAPI LogCrashExceptionFilter(EXCEPTION_POINTERS* pxExceptionInfo)
+	{
+		Zenith_LogFlushForCrash();
+		return (g_pfnPreviousExceptionFilter != nullptr) ? g_pfnPreviousExceptionFilter(pxExceptionInfo) : EXCEPTION_CONTINUE_SEARCH;
+	}
+
+	void LogCrashAbortHandler(int iSignal)
+	{
+		Zenith_LogFlushForCrash();
+		// Back to whatever was there before and re-raise, so the abort still ends the
+		// process (and still reaches a debugger or crash reporter) as it would have.
+		signal(iSignal, g_pfnPreviousAbortHandler);
+		raise(iSignal);
+	}
+}
+
 const char* Zenith_GetLogFilePath()
 {
 	return g_acLogFilePath;
 }
 
-void Zenith_LogFileSinkWrite(const char* szMessage, int eLevel)
+bool Zenith_LogAsyncWriteV(Zenith_LogCategory eCategory, int eLevel, const char* szFormat, va_list xArgs)
 {
-	// Zenith_Mutex_NoProfiling, not Zenith_Mutex: the profiling variant reaches for
-	// engine state, and this runs before the engine exists. Same choice, for the
-	// same reason, as Zenith_MemoryTracker::Mutex and the AssetRegistry's
-	// serializable-type registry mutex — both of which also run during static init.
-	static Zenith_Mutex_NoProfiling s_xMutex;
-	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(s_xMutex);
+	va_list xArgsCopy;
+	va_copy(xArgsCopy, xArgs);
+	const bool bQueued = QueueLogRecord(eCategory, eLevel, nullptr, szFormat, &xArgsCopy);
+	va_end(xArgsCopy);
 
-	OpenLogFileOnce();
-	if (g_pxLogFile == nullptr)
+	if (bQueued && eLevel >= 2)
+	{
+		Zenith_LogFlush();
+	}
+	return bQueued;
+}
+
+void Zenith_LogSinkWrite(Zenith_LogCategory eCategory, int eLevel, const char* szMessage)
+{
+	if (QueueLogRecord(eCategory, eLevel, szMessage, nullptr, nullptr))
 	{
+		if (eLevel >= 2)
+		{
+			Zenith_LogFlush();
+		}
 		return;
 	}
 
-	static const char* const aszLevel[] = { "INFO", "WARN", "ERROR" };
-	const char* szLevel = (eLevel >= 0 && eLevel <= 2) ? aszLevel[eLevel] : "INFO";
+	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(SinkMutex());
+	// Anything already queued was logged first.
+	DrainLogRingsLocked(false);
+
+	const char* szCategory = Zenith_GetLogCategoryName(eCategory);
+	printf("[%s] %s\n", szCategory, szMessage);
+	fflush(stdout);
 
-	fprintf(g_pxLogFile, "[%-5s] %s\n", szLevel, szMessage);
+	if (g_pxLogFile == nullptr)
+	{
+		return;
+	}
+	fprintf(g_pxLogFile, "[%-5s] [%s] %s\n", LevelName(eLevel), szCategory, szMessage);
 
-	// Flush EVERY line, deliberately. The runs worth capturing are the ones that end
-	// in a crash or a hang, and a buffered tail is exactly the part that would be
-	// lost. Zenith_LogImpl already flushes stdout per line, so this does not change
-	// the I/O shape of the engine.
+	// Flush EVERY synchronous line, deliberately. This path covers static init,
+	// engine boot and teardown, where a crash or a hang is most likely and a
+	// buffered tail is exactly the part that would be lost.
 	fflush(g_pxLogFile);
 }
 
+void Zenith_LogFlush()
+{
+	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(SinkMutex());
+	DrainLogRingsLocked(true);
+}
+
+void Zenith_LogFlushForCrash()
+{
+	// TryLock, not Lock: the crashing thread may be the one holding the sink (a
+	// fault inside a drain), and waiting on itself would turn a crash into a hang.
+	// Losing the tail in that case is the lesser evil.
+	if (!SinkMutex().TryLock())
+	{
+		return;
+	}
+	DrainLogRingsLocked(true);
+	SinkMutex().Unlock();
+}
+
+void Zenith_LogStartAsyncWriter()
+{
+	if (g_bAsyncRunning.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	g_bWriterStopRequested.store(false, std::memory_order_release);
+	g_xWriterWakeEvent = ::CreateEventA(nullptr, FALSE, FALSE, nullptr);
+	if (g_xWriterWakeEvent == nullptr)
+	{
+		return;   // Stays synchronous.
+	}
+	g_xRingSpaceEvent = ::CreateEventA(nullptr, TRUE, FALSE, nullptr);
+	if (g_xRingSpaceEvent == nullptr)
+	{
+		::CloseHandle(g_xWriterWakeEvent);
+		g_xWriterWakeEvent = nullptr;
+		return;
+	}
+	g_xWriterThread = ::CreateThread(nullptr, 0, &LogWriterThreadMain, nullptr, 0, nullptr);
+	if (g_xWriterThread == nullptr)
+	{
+		::CloseHandle(g_xRingSpaceEvent);
+		g_xRingSpaceEvent = nullptr;
+		::CloseHandle(g_xWriterWakeEvent);
+		g_xWriterWakeEvent = nullptr;
+		return;
+	}
+
+	// Only while lines can sit in a ring: before Start and after Stop every line is
+	// already on disk when Zenith_LogImpl returns.
+	g_pfnPreviousExceptionFilter = ::SetUnhandledExceptionFilter(&LogCrashExceptionFilter);
+	g_pfnPreviousAbortHandler = signal(SIGABRT, &LogCrashAbortHandler);
+	if (g_pfnPreviousAbortHandler == SIG_ERR)
+	{
+		g_pfnPreviousAbortHandler = SIG_DFL;
+	}
+
+	g_bAsyncRunning.store(true, std::memory_order_seq_cst);
+}
+
+void Zenith_LogStopAsyncWriter()
+{
+	if (!g_bAsyncRunning.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	// New lines take the synchronous path from here on.
+	g_bAsyncRunning.store(false, std::memory_order_seq_cst);
+
+	::SetUnhandledExceptionFilter(g_pfnPreviousExceptionFilter);
+	signal(SIGABRT, g_pfnPreviousAbortHandler);
+	g_pfnPreviousExceptionFilter = nullptr;
+	g_pfnPreviousAbortHandler = SIG_DFL;
+
+	g_bWriterStopRequested.store(true, std::memory_order_release);
+	::SetEvent(g_xWriterWakeEvent);
+	::WaitForSingleObject(g_xWriterThread, INFINITE);
+	::CloseHandle(g_xWriterThread);
+	g_xWriterThread = nullptr;
+
+	// Drain until no producer is still inside QueueLogRecord: a record started
+	// before the store above must land, and it may be waiting on ring space.
+	for (;;)
+	{
+		bool bAnyWriting = false;
+		{
+			Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(SinkMutex());
+			DrainLogRingsLocked(true);
+			for (u_int u = 0; u < uNUM_LOG_RINGS; ++u)
+			{
+				bAnyWriting |= g_axLogRings[u].m_bWriting.load(std::memory_order_seq_cst);
+			}
+		}
+		if (!bAnyWriting)
+		{
+			break;
+		}
+		::SwitchToThread();
+	}
+
+	::CloseHandle(g_xRingSpaceEvent);
+	g_xRingSpaceEvent = nullptr;
+	::CloseHandle(g_xWriterWakeEvent);
+	g_xWriterWakeEvent = nullptr;
+}
+
 #endif   // ZENITH_WINDOWS
 #endif   // ZENITH_LOG
@@ -166,15 +166,44 @@ void Zenith_EditorAddLogMessage(const char* szMessage, int eLevel, Zenith_LogCat
 #endif
 
 #ifdef ZENITH_WINDOWS
-// The always-on log file sink (implemented in Zenith.cpp -- see the block comment
-// there for why it lives in THAT file and not a new one: this declaration is
-// reached from an INLINE function in the PCH, so the symbol must resolve for the
-// L0 leaf and every Sentinel link proof too, and it must NOT ALLOCATE because the
-// first log line of the process comes from a static initialiser).
+// The always-on log sink: stdout plus a file that survives the process
+// (implemented in Zenith.cpp -- see the block comment there for why it lives in
+// THAT file and not a new one: these declarations are reached from an INLINE
+// function in the PCH, so the symbols must resolve for the L0 leaf and every
+// Sentinel link proof too, and they must NOT ALLOCATE because the first log line
+// of the process comes from a static initialiser).
 //
 // Android is excluded because logcat already IS a persistent, timestamped,
 // filterable sink there; other platforms get no sink rather than an untested path.
-void Zenith_LogFileSinkWrite(const char* szMessage, int eLevel);
+//
+// Two modes. Until Zenith_LogStartAsyncWriter (and again after
+// Zenith_LogStopAsyncWriter) every line is written and flushed on the caller,
+// under one lock. While the writer runs, a line is formatted straight into the
+// calling thread's own lock-free ring and a background thread prefixes, batches
+// and writes it, flushing periodically. Errors are flushed before the caller
+// continues, so an assert's message is on disk before the debug break.
+
+// Queues a formatted message (no category prefix) or, with no writer running or
+// no ring free for this thread, writes it synchronously.
+void Zenith_LogSinkWrite(Zenith_LogCategory eCategory, int eLevel, const char* szMessage);
+
+// Formats szFormat straight into this thread's ring. False (and nothing written)
+// when the writer is not running or the thread has no ring; the caller then
+// formats and writes the line itself.
+bool Zenith_LogAsyncWriteV(Zenith_LogCategory eCategory, int eLevel, const char* szFormat, va_list xArgs);
+
+// Writes every queued line and flushes stdout and the file before returning.
+// The crash-flush path: call it from anything about to take the process down.
+void Zenith_LogFlush();
+
+// Zenith_LogFlush for a thread that may already hold the sink (a debug break, an
+// unhandled exception, SIGABRT): skips the drain rather than deadlock on it.
+void Zenith_LogFlushForCrash();
+
+// Engine boot / teardown (Zenith_Engine::InitialiseRuntimeServices /
+// ShutdownRuntimeServices). Stop drains every ring before it returns.
+void Zenith_LogStartAsyncWriter();
+void Zenith_LogStopAsyncWriter();
 
 // Absolute path of this run's log file; empty until the first line is written, and
 // empty forever if the sink could not open one. Never null.
@@ -183,6 +212,22 @@ const char* Zenith_GetLogFilePath();
 
 inline void Zenith_LogImpl(Zenith_LogCategory eCategory, int eLevel, const char* szFormat, ...)
 {
+#if defined(ZENITH_WINDOWS) && !defined(ZENITH_TOOLS)
+	// Fast path: one vsnprintf into this thread's ring, no lock and no I/O. The
+	// tools build formats locally instead, because the editor console needs the
+	// prefixed line on this thread.
+	{
+		va_list args;
+		va_start(args, szFormat);
+		const bool bQueued = Zenith_LogAsyncWriteV(eCategory, eLevel, szFormat, args);
+		va_end(args);
+		if (bQueued)
+		{
+			return;
+		}
+	}
+#endif
+
 	char buffer[2048];
 	char prefixedBuffer[2112];
 
@@ -211,22 +256,21 @@ inline void Zenith_LogImpl(Zenith_LogCategory eCategory, int eLevel, const char*
 	// The category is already in the tag; log the unprefixed message so it is
 	// not repeated on every line.
 	__android_log_write(iPriority, acTag, buffer);
+#elif defined(ZENITH_WINDOWS)
+	// stdout AND a file that survives the process. A hand-launched run has no
+	// redirected stdout, and those are precisely the runs where something
+	// interesting happened. The sink adds the category prefix itself.
+	Zenith_LogSinkWrite(eCategory, eLevel, buffer);
 #else
 	printf("%s\n", prefixedBuffer);
 	fflush(stdout);
-#ifdef ZENITH_WINDOWS
-	// Same line, to a file that survives the process. A hand-launched run has no
-	// redirected stdout, and those are precisely the runs where something
-	// interesting happened.
-	Zenith_LogFileSinkWrite(prefixedBuffer, eLevel);
-#endif
 #endif
 #ifdef ZENITH_TOOLS
 	Zenith_EditorAddLogMessage(prefixedBuffer, eLevel, eCategory);
 #else
 	(void)eLevel;
-	// On Android the prefix lives in the logcat tag, so the composed buffer has
-	// no consumer in a non-tools build -- and warnings are errors here.
+	// On Android and Windows the prefix is added elsewhere, so the composed buffer
+	// has no consumer in a non-tools build -- and warnings are errors here.
 	(void)prefixedBuffer;
 #endif
 }
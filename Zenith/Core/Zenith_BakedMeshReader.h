@@ -31,6 +31,10 @@
 // Zenith/Android/CLAUDE.md's file-access section: any engine-owned file must
 // be reached through Zenith_FileAccess, not std::ifstream/std::filesystem.
 //
+// The file is read through a Zenith_FileAccess::MapFile view rather than
+// ReadFile: every payload is copied straight into its destination, so the
+// whole-file heap copy was pure overhead on the terrain stream-in path.
+//
 // ReadAttribute encodes the .zmesh optional-attribute convention — one leading
 // one-byte present flag, then the payload if present. The two call sites'
 // variants unified exactly: the streaming side's "absent is only OK if we did
@@ -41,22 +45,17 @@ class Zenith_BakedMeshReader
 public:
 	explicit Zenith_BakedMeshReader(const char* szPath)
 	{
-		uint64_t ulFileSize = 0;
-		m_pcData = Zenith_FileAccess::ReadFile(szPath, ulFileSize);
-		if (m_pcData == nullptr || ulFileSize == 0)
+		if (!Zenith_FileAccess::MapFile(szPath, m_xFile) || m_xFile.m_pcData == nullptr)
 		{
 			return;
 		}
-		m_ulRemaining = ulFileSize;
+		m_ulRemaining = m_xFile.m_ulSize;
 		m_bValid = true;
 	}
 
 	~Zenith_BakedMeshReader()
 	{
-		if (m_pcData != nullptr)
-		{
-			Zenith_FileAccess::FreeFileData(m_pcData);
-		}
+		Zenith_FileAccess::UnmapFile(m_xFile);
 	}
 
 	Zenith_BakedMeshReader(const Zenith_BakedMeshReader&) = delete;
@@ -75,7 +74,7 @@ public:
 		{
 			return false;
 		}
-		std::memcpy(pData, m_pcData + m_ulCursor, static_cast<size_t>(ulSize));
+		std::memcpy(pData, m_xFile.m_pcData + m_ulCursor, static_cast<size_t>(ulSize));
 		m_ulCursor += ulSize;
 		m_ulRemaining -= ulSize;
 		return true;
@@ -117,7 +116,7 @@ public:
 	bool IsAtEnd() const { return m_bValid && m_ulRemaining == 0u; }
 
 private:
-	char* m_pcData = nullptr;
+	Zenith_FileAccess::MappedFile m_xFile;
 	uint64_t m_ulCursor = 0;
 	uint64_t m_ulRemaining = 0;
 	bool m_bValid = false;
@@ -2,6 +2,8 @@
 
 #include "Core/Zenith_BenchECS.h"
 
+#include "Core/Zenith_Benchmark.h"
+
 #include "Core/Zenith_Engine.h"
 // Zenith_Scene.h pulls in Zenith_SceneData.h AND Zenith_Entity.inl (the
 // AddComponent / GetComponent / HasComponent / RemoveComponent template
@@ -9,9 +11,11 @@
 #include "ZenithECS/Zenith_Scene.h"
 #include "ZenithECS/Zenith_SceneSystem.h"
 #include "ZenithECS/Zenith_Query.h"
+#include "TaskSystem/Zenith_TaskSystem.h"
 #include "EntityComponent/Components/Zenith_TransformComponent.h"
 #include "EntityComponent/Components/Zenith_LightComponent.h"
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
@@ -29,16 +33,21 @@
 //     subset to give Query<...> a real multi-component combination to filter.
 //   - Zenith_Query<...>(*pxSceneData).ForEach(...) for the hot read loop.
 //   - Add/Remove churn on Zenith_LightComponent each iteration.
+//   - Entity churn: a batch of fresh entities (Transform + Light) created and
+//     DestroyImmediate'd each iteration, so slot recycle and per-entity setup /
+//     teardown cost is measured, not just component add/remove.
+//
+// The three phases are timed separately into *pxTimingsOut (when non-null).
 //
 // Deterministic: every choice is keyed off the loop index, so the processed
 // count is reproducible across runs and machines.
 // ============================================================================
-u_int64 Zenith_BenchECS_RunOnce(u_int uNumEntities, u_int uIters, bool bUseSparse)
+u_int64 Zenith_BenchECS_RunOnce(u_int uNumEntities, u_int uIters, bool bUseSparse, Zenith_BenchECSTimings* pxTimingsOut)
 {
 	// WS10 A/B: pin the Query read path (sparse vs legacy) for this whole pass
-	// and restore the engine's prior toggle value before returning. The
-	// Add/Remove churn below dual-writes the sparse index regardless of path, so
-	// flipping the read path mid-bench is safe.
+	// and restore the engine's prior toggle value before returning. The toggle
+	// only picks how Query iterates (scene entity scan vs driver pool); storage
+	// is the same either way, so flipping it mid-bench is safe.
 	const bool bPrevSparse = g_xEngine.Scenes().AreSparseQueryReadsEnabled();
 	g_xEngine.Scenes().SetSparseQueryReads(bUseSparse);
 
@@ -79,8 +88,16 @@ u_int64 Zenith_BenchECS_RunOnce(u_int uNumEntities, u_int uIters, bool bUseSpars
 	// the benchmark actually did work.
 	u_int64 ulProcessed = 0;
 
+	// Entity-churn batch: an eighth of the population, at least one.
+	const u_int uChurnEntities = (uNumEntities / 8u) > 0u ? (uNumEntities / 8u) : 1u;
+	Zenith_Vector<Zenith_EntityID> xChurnIDs;
+	xChurnIDs.Reserve(uChurnEntities);
+
+	Zenith_BenchECSTimings xTimings;
 	for (u_int uIter = 0; uIter < uIters; ++uIter)
 	{
+		const std::chrono::steady_clock::time_point xIterateStart = std::chrono::steady_clock::now();
+
 		// Hot read loop: iterate every entity that has a Transform (i.e. all of
 		// them). Read the position so the compiler cannot elide the ForEach body,
 		// and count each visit.
@@ -99,9 +116,12 @@ u_int64 Zenith_BenchECS_RunOnce(u_int uNumEntities, u_int uIters, bool bUseSpars
 				++ulProcessed;
 			});
 
+		const std::chrono::steady_clock::time_point xComponentChurnStart = std::chrono::steady_clock::now();
+		xTimings.m_fIterateMs += std::chrono::duration<double, std::milli>(xComponentChurnStart - xIterateStart).count();
+
 		// Add/Remove churn: on even iterations strip the Light from every 4th
 		// entity, on odd iterations put it back. This exercises the swap-and-pop
-		// component-pool path that the future query rework must not regress.
+		// component-pool path and the sparse-index updates that ride on it.
 		const bool bRemovePhase = ((uIter & 1u) == 0u);
 		for (u_int u = 0; u < xEntityIDs.GetSize(); ++u)
 		{
@@ -126,6 +146,32 @@ u_int64 Zenith_BenchECS_RunOnce(u_int uNumEntities, u_int uIters, bool bUseSpars
 				}
 			}
 		}
+
+		const std::chrono::steady_clock::time_point xEntityChurnStart = std::chrono::steady_clock::now();
+		xTimings.m_fComponentChurnMs += std::chrono::duration<double, std::milli>(xEntityChurnStart - xComponentChurnStart).count();
+
+		// Entity churn: create a batch, then destroy it immediately. Slots go
+		// straight back on the free list, so the next iteration recycles them
+		// (generation bump) — the path a stale component index would break.
+		for (u_int u = 0; u < uChurnEntities; ++u)
+		{
+			Zenith_Entity xEntity = g_xEngine.Scenes().CreateEntity(pxSceneData, "BenchChurnEnt");
+			xEntity.AddComponent<Zenith_LightComponent>();
+			xChurnIDs.PushBack(xEntity.GetEntityID());
+		}
+		for (u_int u = 0; u < xChurnIDs.GetSize(); ++u)
+		{
+			Zenith_Entity(pxSceneData, xChurnIDs.Get(u)).DestroyImmediate();
+		}
+		ulProcessed += xChurnIDs.GetSize();
+		xChurnIDs.Clear();
+
+		xTimings.m_fEntityChurnMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - xEntityChurnStart).count();
+	}
+
+	if (pxTimingsOut != nullptr)
+	{
+		*pxTimingsOut = xTimings;
 	}
 
 	g_xEngine.Scenes().UnloadScene(xScene);
@@ -136,10 +182,253 @@ u_int64 Zenith_BenchECS_RunOnce(u_int uNumEntities, u_int uIters, bool bUseSpars
 	return ulProcessed;
 }
 
+// ============================================================================
+// Zenith_BenchECS_RunParallelOnce
+//
+// Serial-vs-parallel pass over the same scene shape as RunOnce (every entity a
+// Transform, every 4th a Light), with NO churn. The write pass steps each
+// Light's position offset through a small damped-spring kernel - heavy enough
+// that splitting the driver pool across workers has something to win, and plain
+// data, so it is safe off the main thread (Transform's setters are not: they
+// bump the scene-graph revision). The read pass goes through ForEachConst.
+// ============================================================================
+namespace
+{
+	// Deterministic in the input, so serial and parallel agree.
+	Zenith_Maths::Vector3 StepOffset(const Zenith_Maths::Vector3& xOffset)
+	{
+		Zenith_Maths::Vector3 xResult = xOffset;
+		Zenith_Maths::Vector3 xVelocity(0.0f, 1.0f, 0.0f);
+		for (u_int uStep = 0; uStep < 16u; ++uStep)
+		{
+			xVelocity = xVelocity * 0.9f - xResult * 0.01f;
+			xResult += xVelocity * 0.016f;
+		}
+		return xResult;
+	}
+}
+
+u_int64 Zenith_BenchECS_RunParallelOnce(u_int uNumEntities, u_int uIters, bool bParallel, double* pfElapsedMsOut)
+{
+	char acSceneName[128];
+	std::snprintf(acSceneName, sizeof(acSceneName), "BenchECSParallel_%u", uNumEntities);
+
+	Zenith_Scene xScene = g_xEngine.Scenes().LoadScene(acSceneName, SCENE_LOAD_ADDITIVE_WITHOUT_LOADING);
+	Zenith_SceneData* pxSceneData = g_xEngine.Scenes().GetSceneData(xScene);
+	Zenith_Assert(pxSceneData != nullptr, "Zenith_BenchECS_RunParallelOnce: empty scene has no scene data");
+
+	for (u_int u = 0; u < uNumEntities; ++u)
+	{
+		char acEntityName[64];
+		std::snprintf(acEntityName, sizeof(acEntityName), "BenchParEnt_%u", u);
+		Zenith_Entity xEntity = g_xEngine.Scenes().CreateEntity(pxSceneData, acEntityName);
+		if ((u & 3u) == 0u)
+		{
+			xEntity.AddComponent<Zenith_LightComponent>().SetPositionOffset(
+				Zenith_Maths::Vector3(static_cast<float>(u), 0.0f, 0.0f));
+		}
+	}
+
+	// The callbacks run on several threads at once, so they only write the
+	// component they are handed. The read pass bumps the shared counter only on
+	// a data-dependent condition that never holds in practice - enough to keep
+	// the reads live without turning the loop into an atomic benchmark.
+	std::atomic<u_int64> ulNegativeScales{0};
+	auto xStepLight = [](Zenith_EntityID, Zenith_LightComponent& xLight)
+	{
+		xLight.SetPositionOffset(StepOffset(xLight.GetPositionOffset()));
+	};
+	auto xReadTransform = [&ulNegativeScales](Zenith_EntityID, const Zenith_TransformComponent& xTransform, const Zenith_LightComponent& xLight)
+	{
+		Zenith_Maths::Vector3 xScale;
+		xTransform.GetScale(xScale);
+		if ((StepOffset(xLight.GetPositionOffset()) * xScale).x < -1.0e30f)
+		{
+			ulNegativeScales.fetch_add(1, std::memory_order_relaxed);
+		}
+	};
+
+	const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+	for (u_int uIter = 0; uIter < uIters; ++uIter)
+	{
+		if (bParallel)
+		{
+			Zenith_Query<Zenith_LightComponent>(*pxSceneData).ForEachParallel(xStepLight);
+			Zenith_Query<Zenith_TransformComponent, Zenith_LightComponent>(*pxSceneData).ForEachConst(xReadTransform);
+		}
+		else
+		{
+			Zenith_Query<Zenith_LightComponent>(*pxSceneData).ForEach(xStepLight);
+			Zenith_Query<const Zenith_TransformComponent, const Zenith_LightComponent>(*pxSceneData).ForEach(xReadTransform);
+		}
+	}
+	if (pfElapsedMsOut != nullptr)
+	{
+		*pfElapsedMsOut = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - xStart).count();
+	}
+
+	const u_int64 ulProcessed = static_cast<u_int64>(uIters) *
+		(Zenith_Query<Zenith_LightComponent>(*pxSceneData).Count() +
+		 Zenith_Query<Zenith_TransformComponent, Zenith_LightComponent>(*pxSceneData).Count()) +
+		ulNegativeScales.load(std::memory_order_relaxed);
+
+	g_xEngine.Scenes().UnloadScene(xScene);
+	return ulProcessed;
+}
+
+// ============================================================================
+// Zenith_BenchECS_RunGroupedOnce
+//
+// The cached-query-group A/B: a Transform+Light query walked every iteration
+// over a mostly unchanged set, the shape of the per-frame Transform+Collider /
+// Transform+Model scans. A 1-in-64 slice of the Lights is stripped or restored
+// each iteration so the grouped pass also pays for group maintenance. Both
+// passes run on the sparse read path; only the query-group toggle differs.
+// ============================================================================
+u_int64 Zenith_BenchECS_RunGroupedOnce(u_int uNumEntities, u_int uIters, bool bGrouped, double* pfElapsedMsOut)
+{
+	const bool bPrevSparse = g_xEngine.Scenes().AreSparseQueryReadsEnabled();
+	const bool bPrevGroups = g_xEngine.Scenes().AreQueryGroupsEnabled();
+	g_xEngine.Scenes().SetSparseQueryReads(true);
+	g_xEngine.Scenes().SetQueryGroupsEnabled(bGrouped);
+
+	char acSceneName[128];
+	std::snprintf(acSceneName, sizeof(acSceneName), "BenchECSGrouped_%u", uNumEntities);
+
+	Zenith_Scene xScene = g_xEngine.Scenes().LoadScene(acSceneName, SCENE_LOAD_ADDITIVE_WITHOUT_LOADING);
+	Zenith_SceneData* pxSceneData = g_xEngine.Scenes().GetSceneData(xScene);
+	Zenith_Assert(pxSceneData != nullptr, "Zenith_BenchECS_RunGroupedOnce: empty scene has no scene data");
+
+	Zenith_Vector<Zenith_EntityID> xLitIDs;
+	for (u_int u = 0; u < uNumEntities; ++u)
+	{
+		char acEntityName[64];
+		std::snprintf(acEntityName, sizeof(acEntityName), "BenchGrpEnt_%u", u);
+		Zenith_Entity xEntity = g_xEngine.Scenes().CreateEntity(pxSceneData, acEntityName);
+		if ((u & 3u) == 0u)
+		{
+			xEntity.AddComponent<Zenith_LightComponent>().SetIntensity(static_cast<float>(u & 15u));
+			xLitIDs.PushBack(xEntity.GetEntityID());
+		}
+	}
+
+	u_int64 ulProcessed = 0;
+	const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+	for (u_int uIter = 0; uIter < uIters; ++uIter)
+	{
+		Zenith_Query<const Zenith_TransformComponent, const Zenith_LightComponent>(*pxSceneData).ForEach(
+			[&ulProcessed](Zenith_EntityID, const Zenith_TransformComponent& xTransform, const Zenith_LightComponent& xLight)
+			{
+				Zenith_Maths::Vector3 xScale;
+				xTransform.GetScale(xScale);
+				ulProcessed += 1u + (xScale.x * xLight.GetIntensity() < 0.0f ? 1u : 0u);
+			});
+
+		// Strip the slice on even iterations, restore it on odd ones.
+		const bool bRemovePhase = ((uIter & 1u) == 0u);
+		for (u_int u = uIter & 63u; u < xLitIDs.GetSize(); u += 64u)
+		{
+			Zenith_Entity xEntity(pxSceneData, xLitIDs.Get(u));
+			if (bRemovePhase && xEntity.HasComponent<Zenith_LightComponent>())
+			{
+				xEntity.RemoveComponent<Zenith_LightComponent>();
+			}
+			else if (!bRemovePhase && !xEntity.HasComponent<Zenith_LightComponent>())
+			{
+				xEntity.AddComponent<Zenith_LightComponent>();
+			}
+		}
+	}
+	if (pfElapsedMsOut != nullptr)
+	{
+		*pfElapsedMsOut = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - xStart).count();
+	}
+
+	g_xEngine.Scenes().UnloadScene(xScene);
+	g_xEngine.Scenes().SetSparseQueryReads(bPrevSparse);
+	g_xEngine.Scenes().SetQueryGroupsEnabled(bPrevGroups);
+	return ulProcessed;
+}
+
+// ============================================================================
+// Zenith_BenchECS_RunChangedOnce
+//
+// The change-detection A/B: a mostly static scene in which 1 in 16 Transforms
+// moves per iteration, followed by a consumer pass over the Transforms. The
+// full pass reads every Transform (what the incremental consumers do today);
+// the changed pass reads only those stamped since its previous pass. Only the
+// consumer loop is timed, the moves are identical in both.
+// ============================================================================
+u_int64 Zenith_BenchECS_RunChangedOnce(u_int uNumEntities, u_int uIters, bool bChangedOnly, double* pfElapsedMsOut)
+{
+	char acSceneName[128];
+	std::snprintf(acSceneName, sizeof(acSceneName), "BenchECSChanged_%u", uNumEntities);
+
+	Zenith_Scene xScene = g_xEngine.Scenes().LoadScene(acSceneName, SCENE_LOAD_ADDITIVE_WITHOUT_LOADING);
+	Zenith_SceneData* pxSceneData = g_xEngine.Scenes().GetSceneData(xScene);
+	Zenith_Assert(pxSceneData != nullptr, "Zenith_BenchECS_RunChangedOnce: empty scene has no scene data");
+
+	Zenith_Vector<Zenith_EntityID> xIDs;
+	for (u_int u = 0; u < uNumEntities; ++u)
+	{
+		char acEntityName[64];
+		std::snprintf(acEntityName, sizeof(acEntityName), "BenchChgEnt_%u", u);
+		xIDs.PushBack(g_xEngine.Scenes().CreateEntity(pxSceneData, acEntityName).GetEntityID());
+	}
+
+	u_int64 ulProcessed = 0;
+	double fElapsedMs = 0.0;
+	u_int uLastSeenTick = g_xEngine.Scenes().AdvanceChangeTick();
+	for (u_int uIter = 0; uIter < uIters; ++uIter)
+	{
+		for (u_int u = uIter & 15u; u < xIDs.GetSize(); u += 16u)
+		{
+			Zenith_Entity(pxSceneData, xIDs.Get(u)).GetComponent<Zenith_TransformComponent>()
+				.SetPosition(Zenith_Maths::Vector3(static_cast<float>(uIter), 0.0f, static_cast<float>(u)));
+		}
+
+		const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+		const u_int uNow = g_xEngine.Scenes().AdvanceChangeTick();
+		Zenith_Query<Zenith_TransformComponent> xQuery(*pxSceneData);
+		if (bChangedOnly)
+		{
+			xQuery.Changed<Zenith_TransformComponent>(uLastSeenTick);
+		}
+		xQuery.ForEach([&ulProcessed](Zenith_EntityID, Zenith_TransformComponent& xTransform)
+			{
+				Zenith_Maths::Vector3 xPos;
+				xTransform.GetPosition(xPos);
+				ulProcessed += 1u + (xPos.x < 0.0f ? 1u : 0u);
+			});
+		uLastSeenTick = uNow;
+		fElapsedMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - xStart).count();
+	}
+	if (pfElapsedMsOut != nullptr)
+	{
+		*pfElapsedMsOut = fElapsedMs;
+	}
+
+	g_xEngine.Scenes().UnloadScene(xScene);
+	return ulProcessed;
+}
+
+// One BENCH line per timed phase of a RunOnce pass.
+static void PrintPhaseTimings(const char* szPath, u_int uNumEntities, u_int uIters, const Zenith_BenchECSTimings& xTimings)
+{
+	std::printf("BENCH ecs.iterate path=%s N=%u iters=%u ms=%.3f\n", szPath, uNumEntities, uIters, xTimings.m_fIterateMs);
+	std::printf("BENCH ecs.component_churn path=%s N=%u iters=%u ms=%.3f\n", szPath, uNumEntities, uIters, xTimings.m_fComponentChurnMs);
+	std::printf("BENCH ecs.entity_churn path=%s N=%u iters=%u ms=%.3f\n", szPath, uNumEntities, uIters, xTimings.m_fEntityChurnMs);
+}
+
+bool Zenith_BenchECS_ForceLink()
+{
+	return true;
+}
+
 // ============================================================================
 // Zenith_BenchECS_Run
 //
-// The --bench-ecs entry point. Runs a fixed iteration count for each canonical
+// The sweep.ecs benchmark. Runs a fixed iteration count for each canonical
 // entity count and prints one parseable BENCH line per count.
 // ============================================================================
 void Zenith_BenchECS_Run()
@@ -156,35 +445,39 @@ void Zenith_BenchECS_Run()
 
 		// WS10 A/B: run the SAME workload twice per N — once with the legacy read
 		// path, once with the sparse fast path — and print one tagged BENCH line
-		// each. The Add/Remove churn is identical (it dual-writes the sparse index
-		// regardless), so the two passes are over the same logical workload.
+		// each. The churn phases are identical, so the two passes are over the
+		// same logical workload.
 
 		// --- legacy ---
+		Zenith_BenchECSTimings xLegacyTimings;
 		const std::chrono::steady_clock::time_point xStartLegacy = std::chrono::steady_clock::now();
-		const u_int64 ulProcessedLegacy = Zenith_BenchECS_RunOnce(uNumEntities, uBENCH_ITERS, /*bUseSparse=*/false);
+		const u_int64 ulProcessedLegacy = Zenith_BenchECS_RunOnce(uNumEntities, uBENCH_ITERS, /*bUseSparse=*/false, &xLegacyTimings);
 		const std::chrono::steady_clock::time_point xEndLegacy = std::chrono::steady_clock::now();
 		const double fLegacyMs = std::chrono::duration<double, std::milli>(xEndLegacy - xStartLegacy).count();
 
 		std::printf("BENCH ecs.query_foreach path=legacy N=%u iters=%u ms=%.3f processed=%llu\n",
 			uNumEntities, uBENCH_ITERS, fLegacyMs,
 			static_cast<unsigned long long>(ulProcessedLegacy));
+		PrintPhaseTimings("legacy", uNumEntities, uBENCH_ITERS, xLegacyTimings);
 		std::fflush(stdout);
 
 		// --- sparse ---
+		Zenith_BenchECSTimings xSparseTimings;
 		const std::chrono::steady_clock::time_point xStartSparse = std::chrono::steady_clock::now();
-		const u_int64 ulProcessedSparse = Zenith_BenchECS_RunOnce(uNumEntities, uBENCH_ITERS, /*bUseSparse=*/true);
+		const u_int64 ulProcessedSparse = Zenith_BenchECS_RunOnce(uNumEntities, uBENCH_ITERS, /*bUseSparse=*/true, &xSparseTimings);
 		const std::chrono::steady_clock::time_point xEndSparse = std::chrono::steady_clock::now();
 		const double fSparseMs = std::chrono::duration<double, std::milli>(xEndSparse - xStartSparse).count();
 
 		std::printf("BENCH ecs.query_foreach path=sparse N=%u iters=%u ms=%.3f processed=%llu\n",
 			uNumEntities, uBENCH_ITERS, fSparseMs,
 			static_cast<unsigned long long>(ulProcessedSparse));
+		PrintPhaseTimings("sparse", uNumEntities, uBENCH_ITERS, xSparseTimings);
 		std::fflush(stdout);
 
 		// Correctness self-check INSIDE the bench: both read paths must visit the
 		// same number of component instances for the identical workload. A
-		// mismatch means the sparse index diverged from the legacy map — a hard
-		// regression — so assert it loudly.
+		// mismatch means the entity-scan and driver-pool walks disagree about
+		// who owns what — a hard regression — so assert it loudly.
 		Zenith_Assert(ulProcessedLegacy == ulProcessedSparse,
 			"BenchECS A/B mismatch at N=%u: legacy processed=%llu, sparse processed=%llu",
 			uNumEntities,
@@ -198,6 +491,141 @@ void Zenith_BenchECS_Run()
 		std::fflush(stdout);
 	}
 
+	// Serial ForEach vs ForEachParallel/ForEachConst over the same workload.
+	for (u_int uCountIndex = 0; uCountIndex < (sizeof(auEntityCounts) / sizeof(auEntityCounts[0])); ++uCountIndex)
+	{
+		const u_int uNumEntities = auEntityCounts[uCountIndex];
+
+		double fSerialMs = 0.0;
+		const u_int64 ulProcessedSerial = Zenith_BenchECS_RunParallelOnce(uNumEntities, uBENCH_ITERS, /*bParallel=*/false, &fSerialMs);
+		std::printf("BENCH ecs.query_foreach_parallel path=serial N=%u iters=%u ms=%.3f processed=%llu\n",
+			uNumEntities, uBENCH_ITERS, fSerialMs, static_cast<unsigned long long>(ulProcessedSerial));
+		std::fflush(stdout);
+
+		double fParallelMs = 0.0;
+		const u_int64 ulProcessedParallel = Zenith_BenchECS_RunParallelOnce(uNumEntities, uBENCH_ITERS, /*bParallel=*/true, &fParallelMs);
+		std::printf("BENCH ecs.query_foreach_parallel path=parallel N=%u iters=%u ms=%.3f processed=%llu workers=%u\n",
+			uNumEntities, uBENCH_ITERS, fParallelMs, static_cast<unsigned long long>(ulProcessedParallel),
+			g_xEngine.Tasks().GetNumWorkerThreads());
+		std::fflush(stdout);
+
+		Zenith_Assert(ulProcessedSerial == ulProcessedParallel,
+			"BenchECS parallel mismatch at N=%u: serial processed=%llu, parallel processed=%llu",
+			uNumEntities,
+			static_cast<unsigned long long>(ulProcessedSerial),
+			static_cast<unsigned long long>(ulProcessedParallel));
+
+		const double fRatio = (fParallelMs > 0.0) ? (fSerialMs / fParallelMs) : 0.0;
+		std::printf("BENCH ecs.query_foreach_parallel.ratio N=%u serial_over_parallel=%.3f\n",
+			uNumEntities, fRatio);
+		std::fflush(stdout);
+	}
+
+	// Cached query groups vs per-entity sparse probing on a stable multi-type query.
+	for (u_int uCountIndex = 0; uCountIndex < (sizeof(auEntityCounts) / sizeof(auEntityCounts[0])); ++uCountIndex)
+	{
+		const u_int uNumEntities = auEntityCounts[uCountIndex];
+
+		double fSparseMs = 0.0;
+		const u_int64 ulProcessedSparse = Zenith_BenchECS_RunGroupedOnce(uNumEntities, uBENCH_ITERS, /*bGrouped=*/false, &fSparseMs);
+		std::printf("BENCH ecs.query_grouped path=sparse N=%u iters=%u ms=%.3f processed=%llu\n",
+			uNumEntities, uBENCH_ITERS, fSparseMs, static_cast<unsigned long long>(ulProcessedSparse));
+		std::fflush(stdout);
+
+		double fGroupedMs = 0.0;
+		const u_int64 ulProcessedGrouped = Zenith_BenchECS_RunGroupedOnce(uNumEntities, uBENCH_ITERS, /*bGrouped=*/true, &fGroupedMs);
+		std::printf("BENCH ecs.query_grouped path=grouped N=%u iters=%u ms=%.3f processed=%llu\n",
+			uNumEntities, uBENCH_ITERS, fGroupedMs, static_cast<unsigned long long>(ulProcessedGrouped));
+		std::fflush(stdout);
+
+		Zenith_Assert(ulProcessedSparse == ulProcessedGrouped,
+			"BenchECS grouped mismatch at N=%u: sparse processed=%llu, grouped processed=%llu",
+			uNumEntities,
+			static_cast<unsigned long long>(ulProcessedSparse),
+			static_cast<unsigned long long>(ulProcessedGrouped));
+
+		const double fRatio = (fGroupedMs > 0.0) ? (fSparseMs / fGroupedMs) : 0.0;
+		std::printf("BENCH ecs.query_grouped.ratio N=%u sparse_over_grouped=%.3f\n",
+			uNumEntities, fRatio);
+		std::fflush(stdout);
+	}
+
+	// Change-filtered vs full consumer pass over a mostly static scene.
+	for (u_int uCountIndex = 0; uCountIndex < (sizeof(auEntityCounts) / sizeof(auEntityCounts[0])); ++uCountIndex)
+	{
+		const u_int uNumEntities = auEntityCounts[uCountIndex];
+
+		double fFullMs = 0.0;
+		const u_int64 ulProcessedFull = Zenith_BenchECS_RunChangedOnce(uNumEntities, uBENCH_ITERS, /*bChangedOnly=*/false, &fFullMs);
+		std::printf("BENCH ecs.query_changed path=full N=%u iters=%u ms=%.3f processed=%llu\n",
+			uNumEntities, uBENCH_ITERS, fFullMs, static_cast<unsigned long long>(ulProcessedFull));
+		std::fflush(stdout);
+
+		double fChangedMs = 0.0;
+		const u_int64 ulProcessedChanged = Zenith_BenchECS_RunChangedOnce(uNumEntities, uBENCH_ITERS, /*bChangedOnly=*/true, &fChangedMs);
+		std::printf("BENCH ecs.query_changed path=changed N=%u iters=%u ms=%.3f processed=%llu\n",
+			uNumEntities, uBENCH_ITERS, fChangedMs, static_cast<unsigned long long>(ulProcessedChanged));
+		std::fflush(stdout);
+
+		const double fRatio = (fChangedMs > 0.0) ? (fFullMs / fChangedMs) : 0.0;
+		std::printf("BENCH ecs.query_changed.ratio N=%u full_over_changed=%.3f\n",
+			uNumEntities, fRatio);
+		std::fflush(stdout);
+	}
+
 	std::printf("BENCH ecs.end\n");
 	std::fflush(stdout);
 }
+
+// ============================================================================
+// Registry entries (--bench=ecs)
+//
+// One entity count per workload, sampled by Zenith_Benchmark; the sweep above
+// stays the place for the full size matrix and the A/B ratios. Each body times
+// only the helper's own hot loops, so scene creation and teardown stay out of
+// the sample.
+// ============================================================================
+namespace
+{
+	constexpr u_int uREGISTRY_ITERS = 10;
+
+	void BenchQueryForEach(Zenith_BenchmarkContext& xContext)
+	{
+		Zenith_BenchECSTimings xTimings;
+		xContext.SetItemsProcessed(Zenith_BenchECS_RunOnce(static_cast<u_int>(xContext.GetArg()), uREGISTRY_ITERS, true, &xTimings));
+		xContext.SetElapsedMs(xTimings.m_fIterateMs + xTimings.m_fComponentChurnMs + xTimings.m_fEntityChurnMs);
+	}
+
+	void BenchQueryForEachParallel(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(Zenith_BenchECS_RunParallelOnce(static_cast<u_int>(xContext.GetArg()), uREGISTRY_ITERS, true, &fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+
+	void BenchQueryGrouped(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(Zenith_BenchECS_RunGroupedOnce(static_cast<u_int>(xContext.GetArg()), uREGISTRY_ITERS, true, &fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+
+	void BenchQueryChanged(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(Zenith_BenchECS_RunChangedOnce(static_cast<u_int>(xContext.GetArg()), uREGISTRY_ITERS, true, &fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+
+	// The printed sweep above as one sample; see Zenith_BenchECS.h.
+	void BenchSweep(Zenith_BenchmarkContext&)
+	{
+		Zenith_BenchECS_Run();
+	}
+}
+
+ZENITH_BENCHMARK(ecs, query_foreach_10k, &BenchQueryForEach, 10000);
+ZENITH_BENCHMARK(ecs, query_foreach_parallel_10k, &BenchQueryForEachParallel, 10000);
+ZENITH_BENCHMARK(ecs, query_grouped_10k, &BenchQueryGrouped, 10000);
+ZENITH_BENCHMARK(ecs, query_changed_10k, &BenchQueryChanged, 10000);
+ZENITH_BENCHMARK(sweep, ecs, &BenchSweep, 0);
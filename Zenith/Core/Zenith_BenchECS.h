@@ -8,12 +8,20 @@
 // Query<...>().ForEach + Add/Remove churn) and prints parseable timing lines:
 //
 //   BENCH ecs.query_foreach N=<n> iters=<m> ms=<elapsed>
+//   BENCH ecs.iterate / ecs.component_churn / ecs.entity_churn path=<p> N=<n> iters=<m> ms=<elapsed>
+//   BENCH ecs.query_foreach_parallel path=<serial|parallel> N=<n> iters=<m> ms=<elapsed>
+//   BENCH ecs.query_grouped path=<sparse|grouped> N=<n> iters=<m> ms=<elapsed>
+//   BENCH ecs.query_changed path=<full|changed> N=<n> iters=<m> ms=<elapsed>
 //
-// This is the before/after measurement backstop for the future sparse-set
-// query rework. It performs NO Vulkan / Flux / GPU work, so it runs cleanly in
-// a headless process. Wire it up via the --bench-ecs command-line flag (see
-// Zenith_Main.cpp): the flag runs Zenith_BenchECS_Run() after engine init and
-// then exits cleanly.
+// This is the before/after measurement backstop for ECS storage changes: the
+// per-phase lines split one pass into query iteration, component Add/Remove
+// churn and entity create/destroy churn, so a storage change (e.g. dropping the
+// per-entity component map for the pools' sparse index) can be compared phase by
+// phase against a run of the previous revision. It performs NO Vulkan / Flux /
+// GPU work, so it runs cleanly in a headless process. The full sweep is the
+// registered benchmark sweep.ecs: `--bench=sweep.ecs --bench-samples=1
+// --bench-warmup=0` runs Zenith_BenchECS_Run() once after engine init and exits.
+// The sampled ecs.* entries (--bench=ecs) live beside it in Zenith_BenchECS.cpp.
 // ============================================================================
 
 // Run the full benchmark sweep: a fixed iteration count for each of the
@@ -21,16 +29,53 @@
 // count. Cleans up every scene it creates. Safe to call after engine init.
 void Zenith_BenchECS_Run();
 
+// Nothing outside this TU calls into it in a shipping link, so the --bench
+// dispatch in Zenith_Main.cpp calls this to keep the registrations.
+bool Zenith_BenchECS_ForceLink();
+
 // Test/measurement helper: run a SINGLE benchmark pass for the given entity
 // count and iteration count. Creates an empty additive scene, populates it,
-// runs the Query<...>().ForEach + Add/Remove churn, tears the scene down, and
-// returns the total number of component instances visited across all
-// iterations (the "processed count"). Used both by Zenith_BenchECS_Run (for
+// runs the Query<...>().ForEach + Add/Remove + entity churn, tears the scene
+// down, and returns the total number of component instances visited plus
+// entities churned across all iterations (the "processed count"). Used both by Zenith_BenchECS_Run (for
 // the printed sweep) and by the Core/BenchECSSmoke unit test (tiny N/iters).
 //
 // WS10: bUseSparse selects the Query READ path for the hot ForEach loops. The
 // flag is pinned via g_xEngine.Scenes().SetSparseQueryReads(bUseSparse) around
-// the hot loops and the prior value restored before return. The Add/Remove
-// churn always dual-writes the sparse index regardless of path. Defaults to
+// the hot loops and the prior value restored before return. Only the read
+// path differs; the churn phases are identical under both. Defaults to
 // true (sparse) so the existing Core/BenchECSSmoke call site is unchanged.
-u_int64 Zenith_BenchECS_RunOnce(u_int uNumEntities, u_int uIters, bool bUseSparse = true);
+//
+// pxTimingsOut (optional) receives the time spent in each phase, summed over
+// all iterations.
+struct Zenith_BenchECSTimings
+{
+	double m_fIterateMs = 0.0;         // Query ForEach loops
+	double m_fComponentChurnMs = 0.0;  // Light Add/Remove on every 4th entity
+	double m_fEntityChurnMs = 0.0;     // create + DestroyImmediate of N/8 entities
+};
+u_int64 Zenith_BenchECS_RunOnce(u_int uNumEntities, u_int uIters, bool bUseSparse = true, Zenith_BenchECSTimings* pxTimingsOut = nullptr);
+
+// Test/measurement helper for the parallel-query lines: build the same scene
+// shape as RunOnce, then run a Light update + Transform/Light read pass uIters
+// times, either through ForEach (bParallel == false) or ForEachParallel /
+// ForEachConst. No Add/Remove churn. Writes the time spent in the query loops to
+// *pfElapsedMsOut when non-null and returns the processed count, which is the
+// same for both variants. Used by Zenith_BenchECS_Run and Core/BenchECSParallelSmoke.
+u_int64 Zenith_BenchECS_RunParallelOnce(u_int uNumEntities, u_int uIters, bool bParallel, double* pfElapsedMsOut = nullptr);
+
+// Test/measurement helper for the query-group lines: same scene shape again,
+// walking Query<Transform, Light> uIters times with a small Light strip/restore
+// slice between walks, with the cached query groups on (bGrouped) or off. Writes
+// the elapsed time to *pfElapsedMsOut when non-null and returns the processed
+// count, which is the same for both variants. Used by Zenith_BenchECS_Run and
+// Core/BenchECSGroupedSmoke.
+u_int64 Zenith_BenchECS_RunGroupedOnce(u_int uNumEntities, u_int uIters, bool bGrouped, double* pfElapsedMsOut = nullptr);
+
+// Test/measurement helper for the change-detection lines: N Transform-only
+// entities, 1 in 16 moved per iteration, then a Query<Transform> consumer pass
+// that reads every entity (bChangedOnly == false) or only the ones stamped since
+// its previous pass (Changed<Transform>). Writes the consumer time to
+// *pfElapsedMsOut when non-null and returns the number of entities the consumer
+// visited. Used by Zenith_BenchECS_Run and Core/BenchECSChangedSmoke.
+u_int64 Zenith_BenchECS_RunChangedOnce(u_int uNumEntities, u_int uIters, bool bChangedOnly, double* pfElapsedMsOut = nullptr);
@@ -0,0 +1,484 @@
+#include "Zenith.h"
+
+#include "Core/Zenith_BenchEngine.h"
+
+#include "Core/Zenith_Benchmark.h"
+#include "AI/Navigation/Zenith_NavMesh.h"
+#include "AI/Navigation/Zenith_NavMeshGenerator.h"
+#include "AI/Navigation/Zenith_NavMeshHierarchy.h"
+#include "AI/Navigation/Zenith_Pathfinding.h"
+#include "DataStream/Zenith_DataStream.h"
+#include "Flux/MeshAnimation/Flux_AnimationClip.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+namespace
+{
+	double ElapsedMsSince(std::chrono::steady_clock::time_point xStart)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - xStart).count();
+	}
+
+	// ------------------------------------------------------------------------
+	// Pathfinding
+	// ------------------------------------------------------------------------
+
+	// Walls fill every 8th column except for one gap, at the far end of
+	// alternate walls, so a path across the grid has to zig-zag through them.
+	bool IsWallCell(u_int uX, u_int uZ, u_int uGridSize)
+	{
+		if (uX % 8 != 4)
+		{
+			return false;
+		}
+		const u_int uGapZ = ((uX / 8) % 2 == 0) ? uGridSize - 2 : 1;
+		return uZ != uGapZ;
+	}
+
+	// One 1 m quad per open cell, neighbours wired straight from the grid
+	// (ComputeAdjacency is all-pairs, far slower than the queries it serves).
+	void BuildGridNavMesh(Zenith_NavMesh& xNavMesh, u_int uGridSize)
+	{
+		const u_int uStride = uGridSize + 1;
+		for (u_int uZ = 0; uZ <= uGridSize; uZ++)
+		{
+			for (u_int uX = 0; uX <= uGridSize; uX++)
+			{
+				xNavMesh.AddVertex(Zenith_Maths::Vector3(static_cast<float>(uX), 0.0f, static_cast<float>(uZ)));
+			}
+		}
+
+		Zenith_Vector<int32_t> xCellToPoly;
+		xCellToPoly.Resize(uGridSize * uGridSize, -1);
+		Zenith_Vector<uint32_t> axPolygon;
+		for (u_int uZ = 0; uZ < uGridSize; uZ++)
+		{
+			for (u_int uX = 0; uX < uGridSize; uX++)
+			{
+				if (IsWallCell(uX, uZ, uGridSize))
+				{
+					continue;
+				}
+				// CCW seen from above: -z edge, +x edge, +z edge, -x edge.
+				const uint32_t uV0 = uZ * uStride + uX;
+				axPolygon.Clear();
+				axPolygon.PushBack(uV0);
+				axPolygon.PushBack(uV0 + 1);
+				axPolygon.PushBack(uV0 + 1 + uStride);
+				axPolygon.PushBack(uV0 + uStride);
+				xCellToPoly.Get(uZ * uGridSize + uX) = static_cast<int32_t>(xNavMesh.AddPolygon(axPolygon));
+			}
+		}
+
+		static const int aiEDGE_DX[4] = { 0, 1, 0, -1 };
+		static const int aiEDGE_DZ[4] = { -1, 0, 1, 0 };
+		for (u_int uZ = 0; uZ < uGridSize; uZ++)
+		{
+			for (u_int uX = 0; uX < uGridSize; uX++)
+			{
+				const int32_t iPoly = xCellToPoly.Get(uZ * uGridSize + uX);
+				if (iPoly < 0)
+				{
+					continue;
+				}
+				for (u_int uEdge = 0; uEdge < 4; uEdge++)
+				{
+					const int iX = static_cast<int>(uX) + aiEDGE_DX[uEdge];
+					const int iZ = static_cast<int>(uZ) + aiEDGE_DZ[uEdge];
+					if (iX < 0 || iZ < 0 || iX >= static_cast<int>(uGridSize) || iZ >= static_cast<int>(uGridSize))
+					{
+						continue;
+					}
+					const int32_t iNeighbour = xCellToPoly.Get(static_cast<u_int>(iZ) * uGridSize + static_cast<u_int>(iX));
+					if (iNeighbour >= 0)
+					{
+						xNavMesh.SetNeighbor(static_cast<uint32_t>(iPoly), uEdge, static_cast<uint32_t>(iNeighbour));
+					}
+				}
+			}
+		}
+		xNavMesh.BuildSpatialGrid();
+	}
+
+	// Centre of the nearest open cell at or after (uX, uZ) along x.
+	Zenith_Maths::Vector3 OpenCellCentre(u_int uX, u_int uZ, u_int uGridSize)
+	{
+		if (IsWallCell(uX, uZ, uGridSize))
+		{
+			uX = (uX + 1) % uGridSize;
+		}
+		return Zenith_Maths::Vector3(static_cast<float>(uX) + 0.5f, 0.0f, static_cast<float>(uZ) + 0.5f);
+	}
+
+	// ------------------------------------------------------------------------
+	// Navmesh bake
+	// ------------------------------------------------------------------------
+
+	// Two triangles, wound so a quad given CCW from above faces up.
+	void AddQuad(Zenith_Vector<Zenith_Maths::Vector3>& axVertices, Zenith_Vector<uint32_t>& auIndices,
+		const Zenith_Maths::Vector3& xA, const Zenith_Maths::Vector3& xB, const Zenith_Maths::Vector3& xC, const Zenith_Maths::Vector3& xD)
+	{
+		const uint32_t uBase = axVertices.GetSize();
+		axVertices.PushBack(xA);
+		axVertices.PushBack(xB);
+		axVertices.PushBack(xC);
+		axVertices.PushBack(xD);
+		auIndices.PushBack(uBase); auIndices.PushBack(uBase + 1); auIndices.PushBack(uBase + 2);
+		auIndices.PushBack(uBase); auIndices.PushBack(uBase + 2); auIndices.PushBack(uBase + 3);
+	}
+
+	void BuildArenaGeometry(u_int uGroundMetres, Zenith_Vector<Zenith_Maths::Vector3>& axVertices, Zenith_Vector<uint32_t>& auIndices)
+	{
+		for (u_int uZ = 0; uZ < uGroundMetres; uZ++)
+		{
+			for (u_int uX = 0; uX < uGroundMetres; uX++)
+			{
+				const float fX = static_cast<float>(uX);
+				const float fZ = static_cast<float>(uZ);
+				AddQuad(axVertices, auIndices,
+					Zenith_Maths::Vector3(fX, 0.0f, fZ), Zenith_Maths::Vector3(fX, 0.0f, fZ + 1.0f),
+					Zenith_Maths::Vector3(fX + 1.0f, 0.0f, fZ + 1.0f), Zenith_Maths::Vector3(fX + 1.0f, 0.0f, fZ));
+			}
+		}
+
+		// A ring of 1.5 m x 2.5 m pillars: holes and regions for the generator to trace.
+		static constexpr u_int uPILLARS = 12;
+		static constexpr float fHALF_WIDTH = 0.75f;
+		static constexpr float fHEIGHT = 2.5f;
+		const float fCentre = static_cast<float>(uGroundMetres) * 0.5f;
+		const float fRadius = static_cast<float>(uGroundMetres) * 0.3f;
+		for (u_int u = 0; u < uPILLARS; u++)
+		{
+			const float fAngle = 6.2831853f * static_cast<float>(u) / uPILLARS;
+			const float fX0 = fCentre + fRadius * std::cos(fAngle) - fHALF_WIDTH;
+			const float fZ0 = fCentre + fRadius * std::sin(fAngle) - fHALF_WIDTH;
+			const float fX1 = fX0 + 2.0f * fHALF_WIDTH;
+			const float fZ1 = fZ0 + 2.0f * fHALF_WIDTH;
+			AddQuad(axVertices, auIndices,
+				Zenith_Maths::Vector3(fX0, fHEIGHT, fZ0), Zenith_Maths::Vector3(fX0, fHEIGHT, fZ1),
+				Zenith_Maths::Vector3(fX1, fHEIGHT, fZ1), Zenith_Maths::Vector3(fX1, fHEIGHT, fZ0));
+			AddQuad(axVertices, auIndices,
+				Zenith_Maths::Vector3(fX0, 0.0f, fZ0), Zenith_Maths::Vector3(fX0, fHEIGHT, fZ0),
+				Zenith_Maths::Vector3(fX1, fHEIGHT, fZ0), Zenith_Maths::Vector3(fX1, 0.0f, fZ0));
+			AddQuad(axVertices, auIndices,
+				Zenith_Maths::Vector3(fX1, 0.0f, fZ0), Zenith_Maths::Vector3(fX1, fHEIGHT, fZ0),
+				Zenith_Maths::Vector3(fX1, fHEIGHT, fZ1), Zenith_Maths::Vector3(fX1, 0.0f, fZ1));
+			AddQuad(axVertices, auIndices,
+				Zenith_Maths::Vector3(fX1, 0.0f, fZ1), Zenith_Maths::Vector3(fX1, fHEIGHT, fZ1),
+				Zenith_Maths::Vector3(fX0, fHEIGHT, fZ1), Zenith_Maths::Vector3(fX0, 0.0f, fZ1));
+			AddQuad(axVertices, auIndices,
+				Zenith_Maths::Vector3(fX0, 0.0f, fZ1), Zenith_Maths::Vector3(fX0, fHEIGHT, fZ1),
+				Zenith_Maths::Vector3(fX0, fHEIGHT, fZ0), Zenith_Maths::Vector3(fX0, 0.0f, fZ0));
+		}
+	}
+
+	// Rolling hills of 1 m quads: gentle enough that almost every cell is
+	// walkable, so the bake is dominated by voxelisation and region work.
+	void BuildTerrainGeometry(u_int uTerrainMetres, Zenith_Vector<Zenith_Maths::Vector3>& axVertices, Zenith_Vector<uint32_t>& auIndices)
+	{
+		const auto Height = [](u_int uX, u_int uZ)
+		{
+			return 1.5f * std::sin(static_cast<float>(uX) * 0.05f) * std::cos(static_cast<float>(uZ) * 0.07f);
+		};
+		for (u_int uZ = 0; uZ < uTerrainMetres; uZ++)
+		{
+			for (u_int uX = 0; uX < uTerrainMetres; uX++)
+			{
+				const float fX = static_cast<float>(uX);
+				const float fZ = static_cast<float>(uZ);
+				AddQuad(axVertices, auIndices,
+					Zenith_Maths::Vector3(fX, Height(uX, uZ), fZ), Zenith_Maths::Vector3(fX, Height(uX, uZ + 1), fZ + 1.0f),
+					Zenith_Maths::Vector3(fX + 1.0f, Height(uX + 1, uZ + 1), fZ + 1.0f), Zenith_Maths::Vector3(fX + 1.0f, Height(uX + 1, uZ), fZ));
+			}
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	// Animation
+	// ------------------------------------------------------------------------
+
+	static constexpr u_int uCLIP_KEYS = 30;
+
+	void BuildBenchClip(Flux_AnimationClip& xClip, u_int uBones)
+	{
+		xClip.SetName("BenchClip");
+		xClip.SetTicksPerSecond(uCLIP_KEYS);
+		xClip.SetDuration(1.0f);
+
+		char acName[32];
+		for (u_int uBone = 0; uBone < uBones; uBone++)
+		{
+			snprintf(acName, sizeof(acName), "BenchBone_%03u", uBone);
+			Flux_BoneChannel xChannel;
+			xChannel.SetBoneName(acName);
+			for (u_int uKey = 0; uKey < uCLIP_KEYS; uKey++)
+			{
+				const float fTick = static_cast<float>(uKey);
+				const float fPhase = static_cast<float>(uBone) * 0.37f + fTick * 0.21f;
+				xChannel.AddPositionKeyframe(fTick, Zenith_Maths::Vector3(std::sin(fPhase), 0.5f * std::cos(fPhase), 0.1f * uBone));
+				xChannel.AddRotationKeyframe(fTick, Zenith_Maths::AngleAxis(fPhase, Zenith_Maths::Vector3(0.0f, 1.0f, 0.0f)));
+				xChannel.AddScaleKeyframe(fTick, Zenith_Maths::Vector3(1.0f + 0.1f * std::sin(fPhase)));
+			}
+			xChannel.SortKeyframes();
+			xClip.AddBoneChannel(acName, std::move(xChannel));
+		}
+	}
+
+	// Shared by the flat and hierarchical pathfinding workloads, which must
+	// issue identical queries for their timings to compare. Each query is a
+	// whole FindPath, smoothing included, and on these long grid paths
+	// SmoothPath's line-of-sight probes take most of the time: a change to
+	// the search itself moves these totals far less than it moves the search.
+	u_int64 RunPathQueries(const Zenith_NavMesh& xNavMesh, const Zenith_NavMeshHierarchy* pxHierarchy,
+		u_int uGridSize, u_int uQueries, double* pfElapsedMsOut)
+	{
+		// One result for every query, as a long-lived agent would hold: the first
+		// query sizes it and the per-thread search context, the rest allocate nothing.
+		Zenith_PathResult xResult;
+		u_int64 ulWaypoints = 0;
+		const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+		for (u_int uQuery = 0; uQuery < uQueries; uQuery++)
+		{
+			// Start on the left third, end on the right third: every path crosses walls.
+			const u_int uThird = uGridSize / 3;
+			const Zenith_Maths::Vector3 xStartPos = OpenCellCentre((uQuery * 5) % uThird, (uQuery * 11) % uGridSize, uGridSize);
+			const Zenith_Maths::Vector3 xEndPos = OpenCellCentre(uGridSize - 1 - (uQuery * 7) % uThird, (uQuery * 13 + 3) % uGridSize, uGridSize);
+			if (pxHierarchy != nullptr)
+			{
+				Zenith_Pathfinding::FindPath(*pxHierarchy, xStartPos, xEndPos, xResult);
+			}
+			else
+			{
+				Zenith_Pathfinding::FindPath(xNavMesh, xStartPos, xEndPos, xResult);
+			}
+			if (xResult.m_eStatus == Zenith_PathResult::Status::SUCCESS)
+			{
+				ulWaypoints += xResult.m_axWaypoints.GetSize();
+			}
+		}
+		if (pfElapsedMsOut != nullptr)
+		{
+			*pfElapsedMsOut = ElapsedMsSince(xStart);
+		}
+		return ulWaypoints;
+	}
+
+	// Keeps the sampled matrices observable so the loop is not optimised away.
+	volatile float s_fAnimationSink = 0.0f;
+}
+
+bool Zenith_BenchEngine_ForceLink()
+{
+	return true;
+}
+
+u_int64 Zenith_BenchEngine_PathfindOnce(u_int uGridSize, u_int uQueries, double* pfElapsedMsOut)
+{
+	Zenith_NavMesh xNavMesh;
+	BuildGridNavMesh(xNavMesh, uGridSize);
+	return RunPathQueries(xNavMesh, nullptr, uGridSize, uQueries, pfElapsedMsOut);
+}
+
+u_int64 Zenith_BenchEngine_PathfindHierarchicalOnce(u_int uGridSize, u_int uQueries, double* pfElapsedMsOut)
+{
+	Zenith_NavMesh xNavMesh;
+	BuildGridNavMesh(xNavMesh, uGridSize);
+	// Built once per level in practice, so it is setup here, not measured.
+	Zenith_NavMeshHierarchy xHierarchy;
+	xHierarchy.Build(xNavMesh);
+	return RunPathQueries(xNavMesh, &xHierarchy, uGridSize, uQueries, pfElapsedMsOut);
+}
+
+u_int64 Zenith_BenchEngine_NearestPolygonOnce(u_int uGridSize, u_int uQueries, double* pfElapsedMsOut)
+{
+	Zenith_NavMesh xNavMesh;
+	BuildGridNavMesh(xNavMesh, uGridSize);
+
+	u_int64 ulHits = 0;
+	const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+	for (u_int uQuery = 0; uQuery < uQueries; uQuery++)
+	{
+		// Scattered tenth-of-a-cell positions hovering over the floor; the ones
+		// over wall gaps exercise the ring search as well.
+		const float fX = static_cast<float>((uQuery * 37) % (uGridSize * 10)) * 0.1f;
+		const float fZ = static_cast<float>((uQuery * 53 + 7) % (uGridSize * 10)) * 0.1f;
+		uint32_t uPoly = 0;
+		Zenith_Maths::Vector3 xNearest;
+		if (xNavMesh.FindNearestPolygon(Zenith_Maths::Vector3(fX, 0.5f, fZ), uPoly, xNearest, 2.0f))
+		{
+			ulHits++;
+		}
+	}
+	if (pfElapsedMsOut != nullptr)
+	{
+		*pfElapsedMsOut = ElapsedMsSince(xStart);
+	}
+	return ulHits;
+}
+
+u_int64 Zenith_BenchEngine_BakeOnce(u_int uGroundMetres, double* pfElapsedMsOut)
+{
+	Zenith_Vector<Zenith_Maths::Vector3> axVertices;
+	Zenith_Vector<uint32_t> auIndices;
+	BuildArenaGeometry(uGroundMetres, axVertices, auIndices);
+
+	const NavMeshGenerationConfig xConfig;
+	const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+	Zenith_NavMesh* pxNavMesh = Zenith_NavMeshGenerator::GenerateFromGeometry(axVertices, auIndices, xConfig);
+	if (pfElapsedMsOut != nullptr)
+	{
+		*pfElapsedMsOut = ElapsedMsSince(xStart);
+	}
+
+	const u_int64 ulPolygons = pxNavMesh != nullptr ? pxNavMesh->GetPolygonCount() : 0;
+	delete pxNavMesh;
+	return ulPolygons;
+}
+
+u_int64 Zenith_BenchEngine_BakeTerrainOnce(u_int uTerrainMetres, bool bTiled, double* pfElapsedMsOut)
+{
+	Zenith_Vector<Zenith_Maths::Vector3> axVertices;
+	Zenith_Vector<uint32_t> auIndices;
+	BuildTerrainGeometry(uTerrainMetres, axVertices, auIndices);
+
+	NavMeshGenerationConfig xConfig;
+	xConfig.m_bBakeInTiles = bTiled;
+	const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+	Zenith_NavMesh* pxNavMesh = Zenith_NavMeshGenerator::GenerateFromGeometry(axVertices, auIndices, xConfig);
+	if (pfElapsedMsOut != nullptr)
+	{
+		*pfElapsedMsOut = ElapsedMsSince(xStart);
+	}
+
+	const u_int64 ulPolygons = pxNavMesh != nullptr ? pxNavMesh->GetPolygonCount() : 0;
+	delete pxNavMesh;
+	return ulPolygons;
+}
+
+u_int64 Zenith_BenchEngine_SampleAnimationOnce(u_int uBones, u_int uSamples, double* pfElapsedMsOut)
+{
+	Flux_AnimationClip xClip;
+	BuildBenchClip(xClip, uBones);
+
+	u_int64 ulSamples = 0;
+	float fSum = 0.0f;
+	const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+	for (u_int uSample = 0; uSample < uSamples; uSample++)
+	{
+		// Sweep the clip, landing between keys so every sample interpolates.
+		const float fTicks = static_cast<float>(uSample) * static_cast<float>(uCLIP_KEYS - 1) / static_cast<float>(uSamples);
+		for (Zenith_HashMap<std::string, Flux_BoneChannel>::Iterator xIt(xClip.GetBoneChannels()); !xIt.Done(); xIt.Next())
+		{
+			const Zenith_Maths::Matrix4 xLocal = xIt.GetValue().Sample(fTicks);
+			fSum += xLocal[3][0] + xLocal[0][0];
+			ulSamples++;
+		}
+	}
+	if (pfElapsedMsOut != nullptr)
+	{
+		*pfElapsedMsOut = ElapsedMsSince(xStart);
+	}
+	s_fAnimationSink = fSum;
+	return ulSamples;
+}
+
+u_int64 Zenith_BenchEngine_SerialiseClipOnce(u_int uBones, u_int uRoundTrips, double* pfElapsedMsOut)
+{
+	Flux_AnimationClip xClip;
+	BuildBenchClip(xClip, uBones);
+
+	Zenith_DataStream xStream;
+	u_int64 ulBytes = 0;
+	bool bIntact = true;
+	const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+	for (u_int uTrip = 0; uTrip < uRoundTrips; uTrip++)
+	{
+		xStream.SetCursor(0);
+		xClip.WriteToDataStream(xStream);
+		ulBytes += xStream.GetCursor();
+
+		xStream.SetCursor(0);
+		Flux_AnimationClip xRead;
+		xRead.ReadFromDataStream(xStream);
+		bIntact = bIntact && xRead.GetBoneChannels().GetSize() == uBones;
+	}
+	if (pfElapsedMsOut != nullptr)
+	{
+		*pfElapsedMsOut = ElapsedMsSince(xStart);
+	}
+	return bIntact ? ulBytes : 0;
+}
+
+// ============================================================================
+// Registry entries
+// ============================================================================
+namespace
+{
+	void BenchPathfind(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(Zenith_BenchEngine_PathfindOnce(static_cast<u_int>(xContext.GetArg()), 64, &fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+
+	void BenchPathfindHierarchical(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(Zenith_BenchEngine_PathfindHierarchicalOnce(static_cast<u_int>(xContext.GetArg()), 64, &fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+
+	void BenchNearestPolygon(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(Zenith_BenchEngine_NearestPolygonOnce(static_cast<u_int>(xContext.GetArg()), 4096, &fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+
+	void BenchBake(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(Zenith_BenchEngine_BakeOnce(static_cast<u_int>(xContext.GetArg()), &fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+
+	void BenchBakeTerrain(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(Zenith_BenchEngine_BakeTerrainOnce(static_cast<u_int>(xContext.GetArg()), false, &fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+
+	void BenchBakeTerrainTiled(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(Zenith_BenchEngine_BakeTerrainOnce(static_cast<u_int>(xContext.GetArg()), true, &fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+
+	void BenchSampleAnimation(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(Zenith_BenchEngine_SampleAnimationOnce(static_cast<u_int>(xContext.GetArg()), 512, &fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+
+	void BenchSerialiseClip(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(Zenith_BenchEngine_SerialiseClipOnce(static_cast<u_int>(xContext.GetArg()), 32, &fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+}
+
+ZENITH_BENCHMARK(nav, pathfind_grid64, &BenchPathfind, 64);
+ZENITH_BENCHMARK(nav, pathfind_grid256, &BenchPathfind, 256);
+ZENITH_BENCHMARK(nav, pathfind_hpa_grid256, &BenchPathfindHierarchical, 256);
+ZENITH_BENCHMARK(nav, nearest_poly_grid256, &BenchNearestPolygon, 256);
+ZENITH_BENCHMARK(nav, bake_arena48, &BenchBake, 48);
+ZENITH_BENCHMARK(nav, bake_terrain256, &BenchBakeTerrain, 256);
+ZENITH_BENCHMARK(nav, bake_tiled_terrain256, &BenchBakeTerrainTiled, 256);
+ZENITH_BENCHMARK(anim, sample_64bones, &BenchSampleAnimation, 64);
+ZENITH_BENCHMARK(serialise, anim_clip_64bones, &BenchSerialiseClip, 64);
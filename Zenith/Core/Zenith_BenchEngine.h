@@ -0,0 +1,55 @@
+#pragma once
+
+// ============================================================================
+// Zenith_BenchEngine
+//
+// Zenith_Benchmark registrations for engine systems that have no benchmark TU
+// of their own. Every workload is procedural and GPU-free:
+//
+//   nav.pathfind_grid64      - FindPath queries across a 64x64-cell navmesh
+//                              walled into a serpentine, so paths are long.
+//   nav.bake_arena48         - NavMeshGenerator on a 48 m ground grid with
+//                              a ring of pillars (voxelise, regions, contours,
+//                              polygons, adjacency).
+//   nav.bake_terrain256      - the same generator on 256 m of rolling hills.
+//   nav.bake_tiled_terrain256 - that terrain baked as tiles across the task
+//                              system; same polygon count as the single grid.
+//   anim.sample_64bones      - Flux_BoneChannel sampling of a 64-bone clip
+//                              with 30 position/rotation/scale keys per bone.
+//   serialise.anim_clip_64bones - the same clip written to a Zenith_DataStream
+//                              and read back.
+//
+// Nothing else references this TU, so the --bench dispatch in Zenith_Main.cpp
+// calls Zenith_BenchEngine_ForceLink to keep the registrations in the link.
+// ============================================================================
+
+bool Zenith_BenchEngine_ForceLink();
+
+// Test/measurement helpers: one run of each workload at the given size. Each
+// writes the time spent in the measured section (setup excluded) to
+// *pfElapsedMsOut when non-null and returns the processed count, which is
+// deterministic for a given size. Used by the registrations and by the
+// Core/BenchEngineSmoke unit test.
+
+// Total waypoints over uQueries paths on a uGridSize x uGridSize-cell navmesh.
+u_int64 Zenith_BenchEngine_PathfindOnce(u_int uGridSize, u_int uQueries, double* pfElapsedMsOut = nullptr);
+
+// The same queries through a Zenith_NavMeshHierarchy (built outside the timing).
+u_int64 Zenith_BenchEngine_PathfindHierarchicalOnce(u_int uGridSize, u_int uQueries, double* pfElapsedMsOut = nullptr);
+
+// FindNearestPolygon hits over uQueries points on the same uGridSize navmesh.
+u_int64 Zenith_BenchEngine_NearestPolygonOnce(u_int uGridSize, u_int uQueries, double* pfElapsedMsOut = nullptr);
+
+// Polygon count of the baked navmesh (0 if generation failed).
+u_int64 Zenith_BenchEngine_BakeOnce(u_int uGroundMetres, double* pfElapsedMsOut = nullptr);
+
+// Polygon count of a bake of uTerrainMetres x uTerrainMetres rolling hills,
+// single-grid or tiled (0 if generation failed).
+u_int64 Zenith_BenchEngine_BakeTerrainOnce(u_int uTerrainMetres, bool bTiled, double* pfElapsedMsOut = nullptr);
+
+// uBones * uSamples channel samples.
+u_int64 Zenith_BenchEngine_SampleAnimationOnce(u_int uBones, u_int uSamples, double* pfElapsedMsOut = nullptr);
+
+// Bytes written over uRoundTrips write + read passes; 0 if a read-back clip
+// lost channels.
+u_int64 Zenith_BenchEngine_SerialiseClipOnce(u_int uBones, u_int uRoundTrips, double* pfElapsedMsOut = nullptr);
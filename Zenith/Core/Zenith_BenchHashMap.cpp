@@ -0,0 +1,360 @@
+#include "Zenith.h"
+
+#include "Core/Zenith_BenchHashMap.h"
+
+#include "Core/Zenith_Benchmark.h"
+
+#include "Collections/Zenith_HashMap.h"
+#include "Collections/Zenith_Vector.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace
+{
+	// The Zenith_HashMap core before group probing: linear probing over a
+	// one-byte EMPTY / OCCUPIED / TOMBSTONE array, comparing the full key at
+	// every occupied slot. Only what the benchmark calls.
+	template<typename K, typename V>
+	class LinearProbeMap
+	{
+	public:
+		LinearProbeMap() = default;
+		~LinearProbeMap()
+		{
+			for (u_int u = 0; u < m_uCapacity; u++)
+			{
+				if (m_puMeta[u] == uOCCUPIED)
+				{
+					m_pxKeys[u].~K();
+					m_pxValues[u].~V();
+				}
+			}
+			Free(m_pxKeys, m_pxValues, m_puMeta);
+		}
+
+		LinearProbeMap(const LinearProbeMap&) = delete;
+		LinearProbeMap& operator=(const LinearProbeMap&) = delete;
+
+		void Insert(const K& xKey, const V& xValue)
+		{
+			if (m_uCapacity == 0)
+			{
+				Rehash(16);
+			}
+			else if ((m_uSize + m_uTombstones) * 4 >= m_uCapacity * 3)
+			{
+				Rehash((m_uSize * 8 >= m_uCapacity * 3) ? m_uCapacity * 2 : m_uCapacity);
+			}
+			const u_int uMask = m_uCapacity - 1;
+			u_int uSlot = static_cast<u_int>(Zenith_Hash<K>{}(xKey)) & uMask;
+			u_int uFirstTombstone = m_uCapacity;
+			for (u_int uProbe = 0; uProbe < m_uCapacity; uProbe++)
+			{
+				if (m_puMeta[uSlot] == uEMPTY)
+				{
+					break;
+				}
+				if (m_puMeta[uSlot] == uOCCUPIED && m_pxKeys[uSlot] == xKey)
+				{
+					m_pxValues[uSlot] = xValue;
+					return;
+				}
+				if (m_puMeta[uSlot] == uTOMBSTONE && uFirstTombstone == m_uCapacity)
+				{
+					uFirstTombstone = uSlot;
+				}
+				uSlot = (uSlot + 1) & uMask;
+			}
+			if (uFirstTombstone != m_uCapacity)
+			{
+				uSlot = uFirstTombstone;
+			}
+			new (&m_pxKeys[uSlot]) K(xKey);
+			new (&m_pxValues[uSlot]) V(xValue);
+			m_puMeta[uSlot] = uOCCUPIED;
+			m_uSize++;
+		}
+
+		V* TryGet(const K& xKey)
+		{
+			const u_int uSlot = Locate(xKey);
+			return uSlot == m_uCapacity ? nullptr : &m_pxValues[uSlot];
+		}
+
+		bool Remove(const K& xKey)
+		{
+			const u_int uSlot = Locate(xKey);
+			if (uSlot == m_uCapacity) return false;
+			m_pxKeys[uSlot].~K();
+			m_pxValues[uSlot].~V();
+			m_puMeta[uSlot] = uTOMBSTONE;
+			m_uSize--;
+			m_uTombstones++;
+			return true;
+		}
+
+	private:
+		static constexpr u_int8 uEMPTY = 0;
+		static constexpr u_int8 uOCCUPIED = 1;
+		static constexpr u_int8 uTOMBSTONE = 2;
+
+		u_int Locate(const K& xKey) const
+		{
+			if (m_uCapacity == 0) return m_uCapacity;
+			const u_int uMask = m_uCapacity - 1;
+			u_int uSlot = static_cast<u_int>(Zenith_Hash<K>{}(xKey)) & uMask;
+			for (u_int uProbe = 0; uProbe < m_uCapacity; uProbe++)
+			{
+				if (m_puMeta[uSlot] == uEMPTY) return m_uCapacity;
+				if (m_puMeta[uSlot] == uOCCUPIED && m_pxKeys[uSlot] == xKey) return uSlot;
+				uSlot = (uSlot + 1) & uMask;
+			}
+			return m_uCapacity;
+		}
+
+		void Rehash(u_int uNewCapacity)
+		{
+			K* pxOldKeys = m_pxKeys;
+			V* pxOldValues = m_pxValues;
+			u_int8* puOldMeta = m_puMeta;
+			const u_int uOldCapacity = m_uCapacity;
+
+			m_pxKeys = static_cast<K*>(Zenith_MemoryManagement::Allocate(uNewCapacity * sizeof(K)));
+			m_pxValues = static_cast<V*>(Zenith_MemoryManagement::Allocate(uNewCapacity * sizeof(V)));
+			m_puMeta = static_cast<u_int8*>(Zenith_MemoryManagement::Allocate(uNewCapacity));
+			memset(m_puMeta, uEMPTY, uNewCapacity);
+			m_uCapacity = uNewCapacity;
+			m_uSize = 0;
+			m_uTombstones = 0;
+
+			for (u_int u = 0; u < uOldCapacity; u++)
+			{
+				if (puOldMeta[u] == uOCCUPIED)
+				{
+					Insert(pxOldKeys[u], pxOldValues[u]);
+					pxOldKeys[u].~K();
+					pxOldValues[u].~V();
+				}
+			}
+			Free(pxOldKeys, pxOldValues, puOldMeta);
+		}
+
+		static void Free(K* pxKeys, V* pxValues, u_int8* puMeta)
+		{
+			if (puMeta == nullptr) return;
+			Zenith_MemoryManagement::Deallocate(pxKeys);
+			Zenith_MemoryManagement::Deallocate(pxValues);
+			Zenith_MemoryManagement::Deallocate(puMeta);
+		}
+
+		K* m_pxKeys = nullptr;
+		V* m_pxValues = nullptr;
+		u_int8* m_puMeta = nullptr;
+		u_int m_uSize = 0;
+		u_int m_uTombstones = 0;
+		u_int m_uCapacity = 0;
+	};
+
+	// std::unordered_map behind the same three calls. The reference point the
+	// engine maps are measured against, so it stays a std container on purpose.
+	template<typename K, typename V>
+	class StdMap
+	{
+	public:
+		void Insert(const K& xKey, const V& xValue) { m_xMap[xKey] = xValue; }
+		V* TryGet(const K& xKey)
+		{
+			auto xIt = m_xMap.find(xKey);
+			return xIt == m_xMap.end() ? nullptr : &xIt->second;
+		}
+		bool Remove(const K& xKey) { return m_xMap.erase(xKey) != 0; }
+
+	private:
+		std::unordered_map<K, V> m_xMap; // ZENITH_ALLOW_STD_UNORDERED: benchmark baseline
+	};
+
+	struct PhaseTimes
+	{
+		double m_afMs[4] = {};
+	};
+	const char* const aszPHASES[4] = { "insert", "find_hit", "find_miss", "erase" };
+
+	// Keys [0, N) are inserted; [N, 2N) are the misses.
+	u_int64 MakeIntKey(u_int u)
+	{
+		return (static_cast<u_int64>(u) * 0x9E3779B1ull) ^ 0x5bd1e995ull;
+	}
+
+	std::string MakeStringKey(u_int u)
+	{
+		char acKey[64];
+		snprintf(acKey, sizeof(acKey), "Assets/Meshes/Prop_%08u.zmesh", u);
+		return std::string(acKey);
+	}
+
+	template<typename TMap, typename K>
+	u_int64 RunPhases(const Zenith_Vector<K>& xKeys, u_int uNumKeys, PhaseTimes& xTimesOut)
+	{
+		TMap xMap;
+		u_int64 ulCorrect = 0;
+		std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+		auto EndPhase = [&xStart, &xTimesOut](u_int uPhase)
+		{
+			const std::chrono::steady_clock::time_point xNow = std::chrono::steady_clock::now();
+			xTimesOut.m_afMs[uPhase] = std::chrono::duration<double, std::milli>(xNow - xStart).count();
+			xStart = xNow;
+		};
+
+		for (u_int u = 0; u < uNumKeys; u++)
+		{
+			xMap.Insert(xKeys.Get(u), u);
+		}
+		EndPhase(0);
+
+		for (u_int u = 0; u < uNumKeys; u++)
+		{
+			const u_int* puValue = xMap.TryGet(xKeys.Get(u));
+			ulCorrect += (puValue != nullptr && *puValue == u) ? 1 : 0;
+		}
+		EndPhase(1);
+
+		for (u_int u = 0; u < uNumKeys; u++)
+		{
+			ulCorrect += (xMap.TryGet(xKeys.Get(uNumKeys + u)) == nullptr) ? 1 : 0;
+		}
+		EndPhase(2);
+
+		for (u_int u = 0; u < uNumKeys; u++)
+		{
+			ulCorrect += xMap.Remove(xKeys.Get(u)) ? 1 : 0;
+		}
+		EndPhase(3);
+		return ulCorrect;
+	}
+
+	template<typename K>
+	u_int64 RunMap(const char* szMap, const Zenith_Vector<K>& xKeys, u_int uNumKeys, PhaseTimes& xTimesOut)
+	{
+		if (strcmp(szMap, "swiss") == 0)
+		{
+			return RunPhases<Zenith_HashMap<K, u_int>>(xKeys, uNumKeys, xTimesOut);
+		}
+		if (strcmp(szMap, "linear") == 0)
+		{
+			return RunPhases<LinearProbeMap<K, u_int>>(xKeys, uNumKeys, xTimesOut);
+		}
+		Zenith_Assert(strcmp(szMap, "std") == 0, "BenchHashMap: unknown map '%s'", szMap);
+		return RunPhases<StdMap<K, u_int>>(xKeys, uNumKeys, xTimesOut);
+	}
+
+	u_int64 RunKeyType(const char* szMap, u_int uNumKeys, bool bStringKeys, PhaseTimes& xTimesOut)
+	{
+		if (bStringKeys)
+		{
+			Zenith_Vector<std::string> xKeys(uNumKeys * 2);
+			for (u_int u = 0; u < uNumKeys * 2; u++)
+			{
+				xKeys.PushBack(MakeStringKey(u));
+			}
+			return RunMap(szMap, xKeys, uNumKeys, xTimesOut);
+		}
+		Zenith_Vector<u_int64> xKeys(uNumKeys * 2);
+		for (u_int u = 0; u < uNumKeys * 2; u++)
+		{
+			xKeys.PushBack(MakeIntKey(u));
+		}
+		return RunMap(szMap, xKeys, uNumKeys, xTimesOut);
+	}
+}
+
+u_int64 Zenith_BenchHashMap_RunOnce(const char* szMap, u_int uNumKeys, bool bStringKeys)
+{
+	PhaseTimes xTimes;
+	return RunKeyType(szMap, uNumKeys, bStringKeys, xTimes);
+}
+
+bool Zenith_BenchHashMap_ForceLink()
+{
+	return true;
+}
+
+// ============================================================================
+// Zenith_BenchHashMap_Run
+//
+// The sweep.hashmap benchmark. One BENCH line per op per map per size.
+// ============================================================================
+void Zenith_BenchHashMap_Run()
+{
+	static const u_int auKeyCounts[] = { 1024u, 16384u, 262144u };
+	static const char* const aszMaps[] = { "swiss", "linear", "std" };
+
+	std::printf("BENCH hashmap.begin\n");
+	std::fflush(stdout);
+
+	for (u_int uKeyType = 0; uKeyType < 2; uKeyType++)
+	{
+		const bool bStringKeys = (uKeyType == 1);
+		for (u_int uCountIndex = 0; uCountIndex < (sizeof(auKeyCounts) / sizeof(auKeyCounts[0])); ++uCountIndex)
+		{
+			const u_int uNumKeys = auKeyCounts[uCountIndex];
+			for (u_int uMap = 0; uMap < (sizeof(aszMaps) / sizeof(aszMaps[0])); ++uMap)
+			{
+				PhaseTimes xTimes;
+				const u_int64 ulCorrect = RunKeyType(aszMaps[uMap], uNumKeys, bStringKeys, xTimes);
+				for (u_int uPhase = 0; uPhase < 4; uPhase++)
+				{
+					std::printf("BENCH hashmap.%s map=%s key=%s N=%u ms=%.3f ns_per_op=%.1f\n", aszPHASES[uPhase], aszMaps[uMap],
+						bStringKeys ? "string" : "u64", uNumKeys, xTimes.m_afMs[uPhase], xTimes.m_afMs[uPhase] * 1000000.0 / uNumKeys);
+				}
+				std::fflush(stdout);
+
+				// Correctness self-check: every hit found, every miss missed, every erase erased.
+				Zenith_Assert(ulCorrect == 3ull * uNumKeys, "BenchHashMap (%s, %s keys, N=%u): %llu of %llu lookups wrong",
+					aszMaps[uMap], bStringKeys ? "string" : "u64", uNumKeys,
+					static_cast<unsigned long long>(3ull * uNumKeys - ulCorrect), static_cast<unsigned long long>(3ull * uNumKeys));
+			}
+		}
+	}
+
+	std::printf("BENCH hashmap.end\n");
+	std::fflush(stdout);
+}
+
+// ============================================================================
+// Registry entries (--bench=hashmap)
+//
+// Zenith_HashMap on both key types, plus std::unordered_map on u64 keys as a
+// yardstick for the machine. Each sample is one insert / find_hit / find_miss /
+// erase pass, with key generation excluded.
+// ============================================================================
+namespace
+{
+	template<bool bStringKeys>
+	void BenchSwiss(Zenith_BenchmarkContext& xContext)
+	{
+		PhaseTimes xTimes;
+		xContext.SetItemsProcessed(RunKeyType("swiss", static_cast<u_int>(xContext.GetArg()), bStringKeys, xTimes));
+		xContext.SetElapsedMs(xTimes.m_afMs[0] + xTimes.m_afMs[1] + xTimes.m_afMs[2] + xTimes.m_afMs[3]);
+	}
+
+	void BenchStdU64(Zenith_BenchmarkContext& xContext)
+	{
+		PhaseTimes xTimes;
+		xContext.SetItemsProcessed(RunKeyType("std", static_cast<u_int>(xContext.GetArg()), false, xTimes));
+		xContext.SetElapsedMs(xTimes.m_afMs[0] + xTimes.m_afMs[1] + xTimes.m_afMs[2] + xTimes.m_afMs[3]);
+	}
+
+	// The printed sweep above as one sample; see Zenith_BenchHashMap.h.
+	void BenchSweep(Zenith_BenchmarkContext&)
+	{
+		Zenith_BenchHashMap_Run();
+	}
+}
+
+ZENITH_BENCHMARK(hashmap, swiss_u64_64k, &BenchSwiss<false>, 65536);
+ZENITH_BENCHMARK(hashmap, swiss_string_64k, &BenchSwiss<true>, 65536);
+ZENITH_BENCHMARK(hashmap, std_u64_64k, &BenchStdU64, 65536);
+ZENITH_BENCHMARK(sweep, hashmap, &BenchSweep, 0);
@@ -0,0 +1,40 @@
+#pragma once
+
+// ============================================================================
+// Zenith_BenchHashMap
+//
+// A GPU-free micro-benchmark for Zenith_HashMap's group-probing lookup. Compares
+// three maps on the same key sets:
+//
+//   swiss  - Zenith_HashMap (tag bytes matched 16 slots at a time).
+//   linear - the previous Zenith_HashMap core (linear probing, full key compare
+//            on every occupied slot), kept inside the benchmark as a baseline.
+//   std    - std::unordered_map.
+//
+// Registered as sweep.hashmap, so `--bench=sweep.hashmap` runs
+// Zenith_BenchHashMap_Run() after engine init and then exits cleanly. Prints
+// parseable lines:
+//
+//   BENCH hashmap.<op> map=<swiss|linear|std> key=<u64|string> N=<n> ms=<elapsed> ns_per_op=<avg>
+//
+//   insert   - N distinct keys into an empty map (no Reserve).
+//   find_hit - every inserted key looked up once.
+//   find_miss - N keys that are not in the map.
+//   erase    - every inserted key removed.
+//
+// String keys look like asset paths ("Assets/Meshes/Prop_00001234.zmesh"): a
+// shared prefix, so key compares that a tag byte avoids are not free.
+// ============================================================================
+
+// Run every op on every map at N = 1K, 16K and 256K, for both key types.
+void Zenith_BenchHashMap_Run();
+
+// Link anchor for the --bench dispatch (see Zenith_BenchECS_ForceLink).
+bool Zenith_BenchHashMap_ForceLink();
+
+// Test/measurement helper: one insert / find_hit / find_miss / erase pass of
+// uNumKeys keys on the chosen map ("swiss", "linear" or "std"), string keys if
+// bStringKeys. Returns hits + (misses that correctly missed) + erased, i.e.
+// 3 * uNumKeys for a correct map. Used by Zenith_BenchHashMap_Run and by the
+// Core/BenchHashMapSmoke unit test.
+u_int64 Zenith_BenchHashMap_RunOnce(const char* szMap, u_int uNumKeys, bool bStringKeys);
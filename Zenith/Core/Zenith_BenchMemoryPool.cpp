@@ -0,0 +1,190 @@
+#include "Zenith.h"
+
+#include "Core/Zenith_BenchMemoryPool.h"
+
+#include "Core/Zenith_Benchmark.h"
+
+#include "Collections/Zenith_ConcurrentMemoryPool.h"
+#include "Collections/Zenith_MemoryPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+	constexpr u_int uMAX_BURST = 64;
+	constexpr u_int uMAX_BENCH_THREADS = 64;
+	// Every thread's largest burst, plus the magazines' worth of slots other
+	// threads may be holding (see the capacity note on Zenith_ConcurrentMemoryPool).
+	constexpr u_int uPOOL_CAPACITY = uMAX_BENCH_THREADS * (uMAX_BURST + 32);
+
+	struct BenchObject
+	{
+		explicit BenchObject(u_int uTag) : m_uTag(uTag), m_uCheck(~uTag) {}
+
+		u_int m_uTag;
+		u_int m_uCheck;
+		u_int64 m_aulPayload[2] = {};
+	};
+
+	using MutexPool = Zenith_MemoryPool<BenchObject, uPOOL_CAPACITY>;
+	using ConcurrentPool = Zenith_ConcurrentMemoryPool<BenchObject, uPOOL_CAPACITY>;
+
+	template<typename TPool>
+	u_int64 RunBursts(TPool& xPool, u_int uThread, u_int uBursts)
+	{
+		BenchObject* apxBurst[uMAX_BURST];
+		u_int64 ulIntact = 0;
+		for (u_int uBurst = 0; uBurst < uBursts; uBurst++)
+		{
+			const u_int uSize = 1 + (uBurst * 29 + uThread * 7) % uMAX_BURST;
+			u_int uAllocated = 0;
+			for (; uAllocated < uSize; uAllocated++)
+			{
+				apxBurst[uAllocated] = xPool.Allocate((uThread << 16) | uAllocated);
+				if (apxBurst[uAllocated] == nullptr)
+				{
+					break;
+				}
+			}
+			for (u_int u = 0; u < uAllocated; u++)
+			{
+				const u_int uExpected = (uThread << 16) | u;
+				if (apxBurst[u]->m_uTag == uExpected && apxBurst[u]->m_uCheck == ~uExpected)
+				{
+					ulIntact++;
+				}
+				xPool.Deallocate(apxBurst[u]);
+			}
+		}
+		return ulIntact;
+	}
+
+	template<typename TPool>
+	u_int64 RunThreads(u_int uThreads, u_int uBursts, double& fMsOut)
+	{
+		TPool* pxPool = new TPool();
+		std::atomic<u_int64> ulIntact{ 0 };
+		std::atomic<bool> bGo{ false };
+
+		std::thread axThreads[uMAX_BENCH_THREADS];
+		for (u_int u = 0; u < uThreads; u++)
+		{
+			axThreads[u] = std::thread([pxPool, u, uBursts, &ulIntact, &bGo]()
+			{
+				while (!bGo.load(std::memory_order_acquire))
+				{
+					std::this_thread::yield();
+				}
+				ulIntact.fetch_add(RunBursts(*pxPool, u, uBursts), std::memory_order_relaxed);
+			});
+		}
+
+		const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+		bGo.store(true, std::memory_order_release);
+		for (u_int u = 0; u < uThreads; u++)
+		{
+			axThreads[u].join();
+		}
+		fMsOut = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - xStart).count();
+
+		delete pxPool;
+		return ulIntact.load(std::memory_order_relaxed);
+	}
+
+	u_int64 ExpectedOps(u_int uThreads, u_int uBursts)
+	{
+		u_int64 ulOps = 0;
+		for (u_int uThread = 0; uThread < uThreads; uThread++)
+		{
+			for (u_int uBurst = 0; uBurst < uBursts; uBurst++)
+			{
+				ulOps += 1 + (uBurst * 29 + uThread * 7) % uMAX_BURST;
+			}
+		}
+		return ulOps;
+	}
+}
+
+u_int64 Zenith_BenchMemoryPool_RunOnce(u_int uThreads, u_int uBursts, bool bConcurrent)
+{
+	Zenith_Assert(uThreads > 0 && uThreads <= uMAX_BENCH_THREADS, "BenchMemoryPool: %u threads is out of range", uThreads);
+	double fMs = 0.0;
+	return bConcurrent ? RunThreads<ConcurrentPool>(uThreads, uBursts, fMs) : RunThreads<MutexPool>(uThreads, uBursts, fMs);
+}
+
+bool Zenith_BenchMemoryPool_ForceLink()
+{
+	return true;
+}
+
+// ============================================================================
+// Zenith_BenchMemoryPool_Run
+//
+// The sweep.pool benchmark. One BENCH line per pool per thread count.
+// ============================================================================
+void Zenith_BenchMemoryPool_Run()
+{
+	static constexpr u_int uBENCH_BURSTS = 20000;
+
+	const u_int uHardwareThreads = std::thread::hardware_concurrency();
+	u_int auThreadCounts[] = { 1u, 2u, 4u, 8u, uHardwareThreads };
+
+	std::printf("BENCH pool.begin hw_threads=%u bursts=%u max_burst=%u\n", uHardwareThreads, uBENCH_BURSTS, uMAX_BURST);
+	std::fflush(stdout);
+
+	for (u_int uCountIndex = 0; uCountIndex < (sizeof(auThreadCounts) / sizeof(auThreadCounts[0])); ++uCountIndex)
+	{
+		const u_int uThreads = std::min(std::max(auThreadCounts[uCountIndex], 1u), uMAX_BENCH_THREADS);
+		const u_int64 ulExpected = ExpectedOps(uThreads, uBENCH_BURSTS);
+		for (u_int uPool = 0; uPool < 2; uPool++)
+		{
+			const bool bConcurrent = (uPool == 1);
+			double fMs = 0.0;
+			const u_int64 ulIntact = bConcurrent
+				? RunThreads<ConcurrentPool>(uThreads, uBENCH_BURSTS, fMs)
+				: RunThreads<MutexPool>(uThreads, uBENCH_BURSTS, fMs);
+			const double fMopsPerSecond = (fMs > 0.0) ? (static_cast<double>(ulExpected) / (fMs * 1000.0)) : 0.0;
+			std::printf("BENCH pool.churn pool=%s threads=%u ops=%llu ms=%.3f mops_per_s=%.2f\n",
+				bConcurrent ? "concurrent" : "mutex", uThreads, static_cast<unsigned long long>(ulExpected), fMs, fMopsPerSecond);
+			std::fflush(stdout);
+
+			// Correctness self-check: every object came back exactly as constructed.
+			Zenith_Assert(ulIntact == ulExpected, "BenchMemoryPool (%s, %u threads): %llu of %llu objects were corrupted or not allocated",
+				bConcurrent ? "concurrent" : "mutex", uThreads, static_cast<unsigned long long>(ulExpected - ulIntact), static_cast<unsigned long long>(ulExpected));
+		}
+	}
+
+	std::printf("BENCH pool.end\n");
+	std::fflush(stdout);
+}
+
+// ============================================================================
+// Registry entries (--bench=pool): both pools at four threads. Thread creation
+// is outside RunThreads' timed region.
+// ============================================================================
+namespace
+{
+	constexpr u_int uREGISTRY_BURSTS = 5000;
+
+	template<typename TPool>
+	void BenchChurn(Zenith_BenchmarkContext& xContext)
+	{
+		double fMs = 0.0;
+		xContext.SetItemsProcessed(RunThreads<TPool>(static_cast<u_int>(xContext.GetArg()), uREGISTRY_BURSTS, fMs));
+		xContext.SetElapsedMs(fMs);
+	}
+
+	// The printed sweep above as one sample; see Zenith_BenchMemoryPool.h.
+	void BenchSweep(Zenith_BenchmarkContext&)
+	{
+		Zenith_BenchMemoryPool_Run();
+	}
+}
+
+ZENITH_BENCHMARK(pool, mutex_churn_4t, &BenchChurn<MutexPool>, 4);
+ZENITH_BENCHMARK(pool, concurrent_churn_4t, &BenchChurn<ConcurrentPool>, 4);
+ZENITH_BENCHMARK(sweep, pool, &BenchSweep, 0);
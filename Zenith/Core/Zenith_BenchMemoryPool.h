@@ -0,0 +1,30 @@
+#pragma once
+
+// ============================================================================
+// Zenith_BenchMemoryPool
+//
+// A multi-threaded alloc/free throughput benchmark for the two fixed-size pools:
+// the mutex-guarded Zenith_MemoryPool and the thread-caching
+// Zenith_ConcurrentMemoryPool. Sibling of Zenith_BenchTaskSystem; registered as
+// sweep.pool, so `--bench=sweep.pool` runs Zenith_BenchMemoryPool_Run() after
+// engine init and then exits cleanly. Prints parseable lines:
+//
+//   BENCH pool.churn pool=<mutex|concurrent> threads=<t> ops=<n> ms=<elapsed> mops_per_s=<rate>
+//
+// Every thread repeatedly allocates a burst of objects (1..64, varying), touches
+// each one and frees the burst -- the shape of event or particle-burst traffic.
+// One op is one Allocate plus its Deallocate. Threads are plain std::threads, not
+// task workers, so the thread count is exact and the task system is not involved.
+// ============================================================================
+
+// Run both pools at 1, 2, 4, 8 and hardware_concurrency threads.
+void Zenith_BenchMemoryPool_Run();
+
+// Link anchor for the --bench dispatch (see Zenith_BenchECS_ForceLink).
+bool Zenith_BenchMemoryPool_ForceLink();
+
+// Test/measurement helper: uThreads threads each run uBursts bursts on the chosen
+// pool. Returns the number of alloc/free pairs that saw their object intact
+// (every one of them, unless the pool is broken). Used by Zenith_BenchMemoryPool_Run
+// and by the Core/BenchMemoryPoolSmoke unit test.
+u_int64 Zenith_BenchMemoryPool_RunOnce(u_int uThreads, u_int uBursts, bool bConcurrent);
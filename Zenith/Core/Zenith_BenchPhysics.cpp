@@ -0,0 +1,179 @@
+#include "Zenith.h"
+
+#include "Core/Zenith_BenchPhysics.h"
+
+#include "Core/Zenith_Benchmark.h"
+#include "Core/Zenith_Engine.h"
+#include "Physics/Zenith_Physics.h"
+#include "TaskSystem/Zenith_JoltJobSystem.h"
+
+#include <Jolt/Core/JobSystemThreadPool.h>
+#include <Jolt/Core/TempAllocator.h>
+#include <Jolt/Physics/PhysicsSettings.h>
+#include <Jolt/Physics/PhysicsSystem.h>
+#include <Jolt/Physics/Body/BodyCreationSettings.h>
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+	// Object layers of Zenith_Physics::InitialiseJoltSystem.
+	constexpr JPH::ObjectLayer uLAYER_NON_MOVING = 0;
+	constexpr JPH::ObjectLayer uLAYER_MOVING = 1;
+
+	constexpr u_int uBOXES_PER_STACK = 8;
+	constexpr float fBOX_HALF_EXTENT = 0.5f;
+	constexpr float fSTACK_SPACING = 1.5f;
+	constexpr float fDROP_HEIGHT = 1.0f;
+
+	JPH::JobSystem* CreateJobSystem(bool bTaskSystemJobs)
+	{
+		if (bTaskSystemJobs)
+		{
+			return new Zenith_JoltJobSystem(g_xEngine.Tasks(), JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
+		}
+		// What Zenith_Physics creates when no factory is installed.
+		const u_int uNumThreads = std::max(1u, std::thread::hardware_concurrency() - 1);
+		return new JPH::JobSystemThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, uNumThreads);
+	}
+
+	// uNumBodies boxes in stacks of uBOXES_PER_STACK on a square grid. Every
+	// other box in a stack is nudged sideways, so the stacks topple into their
+	// neighbours instead of settling straight down.
+	void PopulateWorld(JPH::PhysicsSystem& xSystem, u_int uNumBodies, Zenith_Vector<JPH::BodyID>& xBodiesOut, Zenith_Vector<float>& xStartHeightsOut)
+	{
+		JPH::BodyInterface& xBodies = xSystem.GetBodyInterfaceNoLock();
+
+		JPH::RefConst<JPH::Shape> xGroundShape = new JPH::BoxShape(JPH::Vec3(500.0f, 1.0f, 500.0f));
+		JPH::BodyCreationSettings xGround(xGroundShape, JPH::RVec3(0.0f, -1.0f, 0.0f), JPH::Quat::sIdentity(), JPH::EMotionType::Static, uLAYER_NON_MOVING);
+		xBodies.CreateAndAddBody(xGround, JPH::EActivation::DontActivate);
+
+		JPH::RefConst<JPH::Shape> xBoxShape = new JPH::BoxShape(JPH::Vec3(fBOX_HALF_EXTENT, fBOX_HALF_EXTENT, fBOX_HALF_EXTENT));
+		const u_int uNumStacks = (uNumBodies + uBOXES_PER_STACK - 1) / uBOXES_PER_STACK;
+		u_int uStacksPerRow = 1;
+		while (uStacksPerRow * uStacksPerRow < uNumStacks)
+		{
+			uStacksPerRow++;
+		}
+		const float fGridOrigin = -0.5f * fSTACK_SPACING * static_cast<float>(uStacksPerRow - 1);
+
+		xBodiesOut.Reserve(uNumBodies);
+		xStartHeightsOut.Reserve(uNumBodies);
+		for (u_int u = 0; u < uNumBodies; u++)
+		{
+			const u_int uStack = u / uBOXES_PER_STACK;
+			const u_int uLevel = u % uBOXES_PER_STACK;
+			const float fX = fGridOrigin + fSTACK_SPACING * static_cast<float>(uStack % uStacksPerRow) + ((uLevel & 1u) ? 0.3f : 0.0f);
+			const float fZ = fGridOrigin + fSTACK_SPACING * static_cast<float>(uStack / uStacksPerRow);
+			const float fY = fDROP_HEIGHT + fBOX_HALF_EXTENT + static_cast<float>(uLevel) * (2.0f * fBOX_HALF_EXTENT + 0.05f);
+
+			JPH::BodyCreationSettings xBox(xBoxShape, JPH::RVec3(fX, fY, fZ), JPH::Quat::sIdentity(), JPH::EMotionType::Dynamic, uLAYER_MOVING);
+			xBodiesOut.PushBack(xBodies.CreateAndAddBody(xBox, JPH::EActivation::Activate));
+			xStartHeightsOut.PushBack(fY);
+		}
+
+		xSystem.OptimizeBroadPhase();
+	}
+
+	double RunPass(u_int uNumBodies, u_int uSteps, bool bTaskSystemJobs, u_int64& ulFellOut)
+	{
+		JPH::TempAllocatorImpl* pxTempAllocator = new JPH::TempAllocatorImpl(32 * 1024 * 1024);
+		JPH::JobSystem* pxJobSystem = CreateJobSystem(bTaskSystemJobs);
+		JPH::PhysicsSystem* pxSystem = new JPH::PhysicsSystem();
+		Zenith_Physics::InitialiseJoltSystem(*pxSystem);
+
+		Zenith_Vector<JPH::BodyID> xBodies;
+		Zenith_Vector<float> xStartHeights;
+		PopulateWorld(*pxSystem, uNumBodies, xBodies, xStartHeights);
+
+		const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+		for (u_int uStep = 0; uStep < uSteps; uStep++)
+		{
+			pxSystem->Update(static_cast<float>(Zenith_Physics::s_fDesiredFramerate), 1, pxTempAllocator, pxJobSystem);
+		}
+		const double fMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - xStart).count();
+
+		const JPH::BodyInterface& xBodyInterface = pxSystem->GetBodyInterfaceNoLock();
+		ulFellOut = 0;
+		for (u_int u = 0; u < xBodies.GetSize(); u++)
+		{
+			if (static_cast<float>(xBodyInterface.GetPosition(xBodies.Get(u)).GetY()) < xStartHeights.Get(u) - 0.01f)
+			{
+				ulFellOut++;
+			}
+		}
+
+		// The system owns (and frees) its bodies.
+		delete pxSystem;
+		delete pxJobSystem;
+		delete pxTempAllocator;
+		return fMs;
+	}
+}
+
+u_int64 Zenith_BenchPhysics_RunOnce(u_int uNumBodies, u_int uSteps, bool bTaskSystemJobs)
+{
+	u_int64 ulFell = 0;
+	RunPass(uNumBodies, uSteps, bTaskSystemJobs, ulFell);
+	return ulFell;
+}
+
+bool Zenith_BenchPhysics_ForceLink()
+{
+	return true;
+}
+
+// ============================================================================
+// Zenith_BenchPhysics_Run
+//
+// The sweep.physics benchmark. One BENCH line per job system per body count.
+// ============================================================================
+void Zenith_BenchPhysics_Run()
+{
+	static constexpr u_int uBENCH_STEPS = 240;
+	static const u_int auBodyCounts[] = { 256u, 1024u, 4096u };
+
+	std::printf("BENCH physics.begin workers=%u hw_threads=%u steps=%u\n", g_xEngine.Tasks().GetNumWorkerThreads(),
+		std::thread::hardware_concurrency(), uBENCH_STEPS);
+	std::fflush(stdout);
+
+	for (u_int uCountIndex = 0; uCountIndex < (sizeof(auBodyCounts) / sizeof(auBodyCounts[0])); ++uCountIndex)
+	{
+		const u_int uNumBodies = auBodyCounts[uCountIndex];
+		for (u_int uJobs = 0; uJobs < 2; uJobs++)
+		{
+			const bool bTaskSystemJobs = (uJobs == 1);
+			u_int64 ulFell = 0;
+			const double fMs = RunPass(uNumBodies, uBENCH_STEPS, bTaskSystemJobs, ulFell);
+			const double fStepsPerSecond = (fMs > 0.0) ? (uBENCH_STEPS * 1000.0 / fMs) : 0.0;
+			std::printf("BENCH physics.step jobs=%s N=%u steps=%u ms=%.3f steps_per_s=%.1f\n",
+				bTaskSystemJobs ? "task_system" : "thread_pool", uNumBodies, uBENCH_STEPS, fMs, fStepsPerSecond);
+			std::fflush(stdout);
+
+			// Correctness self-check: every box starts above the ground, so after
+			// four simulated seconds every one of them must have come down.
+			Zenith_Assert(ulFell == uNumBodies, "BenchPhysics (%s) at N=%u: only %llu of the boxes fell",
+				bTaskSystemJobs ? "task_system" : "thread_pool", uNumBodies, static_cast<unsigned long long>(ulFell));
+		}
+	}
+
+	std::printf("BENCH physics.end\n");
+	std::fflush(stdout);
+}
+
+// ============================================================================
+// Registry entries (--bench=sweep.physics)
+// ============================================================================
+namespace
+{
+	// The printed sweep above as one sample; see Zenith_BenchPhysics.h.
+	void BenchSweep(Zenith_BenchmarkContext&)
+	{
+		Zenith_BenchPhysics_Run();
+	}
+}
+
+ZENITH_BENCHMARK(sweep, physics, &BenchSweep, 0);
@@ -0,0 +1,29 @@
+#pragma once
+
+// ============================================================================
+// Zenith_BenchPhysics
+//
+// A headless physics benchmark comparing Jolt's own JobSystemThreadPool with
+// the Zenith_JoltJobSystem bridge onto the engine's task system. Sibling of
+// Zenith_BenchTaskSystem; registered as sweep.physics, so
+// `--bench=sweep.physics` runs Zenith_BenchPhysics_Run() after engine init and
+// then exits cleanly. Prints parseable lines:
+//
+//   BENCH physics.step jobs=<thread_pool|task_system> N=<n> steps=<m> ms=<elapsed> steps_per_s=<rate>
+//
+// Each pass builds a detached JPH::PhysicsSystem with the engine's layers
+// (Zenith_Physics::InitialiseJoltSystem), drops N boxes in staggered stacks
+// onto a static ground slab so they topple into each other, and times m fixed
+// 1/60 s steps. The live engine physics world is not touched.
+// ============================================================================
+
+// Run both job systems over the canonical body counts (256, 1024, 4096).
+void Zenith_BenchPhysics_Run();
+
+// Link anchor for the --bench dispatch (see Zenith_BenchECS_ForceLink).
+bool Zenith_BenchPhysics_ForceLink();
+
+// Test/measurement helper: run one pass of uNumBodies boxes for uSteps steps on
+// the chosen job system and return how many boxes ended lower than they started.
+// Used by Zenith_BenchPhysics_Run and by the Core/BenchPhysicsSmoke unit test.
+u_int64 Zenith_BenchPhysics_RunOnce(u_int uNumBodies, u_int uSteps, bool bTaskSystemJobs);
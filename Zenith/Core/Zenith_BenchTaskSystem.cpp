@@ -0,0 +1,303 @@
+#include "Zenith.h"
+
+#include "Core/Zenith_BenchTaskSystem.h"
+
+#include "Core/Zenith_Benchmark.h"
+
+#include "Core/Zenith_Engine.h"
+#include "TaskSystem/Zenith_TaskSystem.h"
+
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+	struct BenchCounter
+	{
+		std::atomic<u_int64> m_ulExecuted{0};
+	};
+
+	void CountTask(void* pData)
+	{
+		static_cast<BenchCounter*>(pData)->m_ulExecuted.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void EmptyTask(void*)
+	{
+	}
+
+	// Owns uCount counting tasks. Zenith_Task has no default constructor, so
+	// the set holds pointers; construction happens outside every timed region.
+	class BenchTaskSet
+	{
+	public:
+		BenchTaskSet(u_int uCount, BenchCounter& xCounter)
+		{
+			m_xTasks.Reserve(uCount);
+			for (u_int u = 0; u < uCount; u++)
+			{
+				m_xTasks.PushBack(new Zenith_Task(ZENITH_PROFILE_ZONE("Bench Task"), CountTask, &xCounter));
+			}
+		}
+
+		~BenchTaskSet()
+		{
+			for (u_int u = 0; u < m_xTasks.GetSize(); u++)
+			{
+				delete m_xTasks.Get(u);
+			}
+		}
+
+		BenchTaskSet(const BenchTaskSet&) = delete;
+		BenchTaskSet& operator=(const BenchTaskSet&) = delete;
+
+		void SubmitAll()
+		{
+			for (u_int u = 0; u < m_xTasks.GetSize(); u++)
+			{
+				g_xEngine.Tasks().SubmitTask(m_xTasks.Get(u));
+			}
+		}
+
+		void SubmitAllReversed()
+		{
+			for (u_int u = m_xTasks.GetSize(); u > 0; u--)
+			{
+				g_xEngine.Tasks().SubmitTask(m_xTasks.Get(u - 1));
+			}
+		}
+
+		void WaitAll()
+		{
+			for (u_int u = 0; u < m_xTasks.GetSize(); u++)
+			{
+				m_xTasks.Get(u)->WaitUntilComplete();
+			}
+		}
+
+		void LinkAsChain()
+		{
+			for (u_int u = 1; u < m_xTasks.GetSize(); u++)
+			{
+				m_xTasks.Get(u)->DependsOn(*m_xTasks.Get(u - 1));
+			}
+		}
+
+	private:
+		Zenith_Vector<Zenith_Task*> m_xTasks;
+	};
+
+	// Root of the steal pass: runs on a worker, so every child it submits goes
+	// into that worker's own deque and the rest of the pool has to steal.
+	void FanOutRoot(void* pData)
+	{
+		BenchTaskSet* pxChildren = static_cast<BenchTaskSet*>(pData);
+		pxChildren->SubmitAll();
+		pxChildren->WaitAll();
+	}
+
+	double ElapsedMs(const std::chrono::steady_clock::time_point& xStart)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - xStart).count();
+	}
+
+	double RunSpawnPass(u_int uNumTasks, u_int uIters, BenchCounter& xCounter)
+	{
+		BenchTaskSet xTasks(uNumTasks, xCounter);
+		const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+		for (u_int uIter = 0; uIter < uIters; uIter++)
+		{
+			xTasks.SubmitAll();
+			xTasks.WaitAll();
+		}
+		return ElapsedMs(xStart);
+	}
+
+	double RunStealPass(u_int uNumTasks, u_int uIters, BenchCounter& xCounter, u_int64& ulStealsOut)
+	{
+		BenchTaskSet xChildren(uNumTasks, xCounter);
+		Zenith_Task xRoot(ZENITH_PROFILE_ZONE("Bench Fan Out"), FanOutRoot, &xChildren);
+
+		const u_int64 ulStealsBefore = g_xEngine.Tasks().GetStealCount();
+		const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+		for (u_int uIter = 0; uIter < uIters; uIter++)
+		{
+			g_xEngine.Tasks().SubmitTask(&xRoot);
+			xRoot.WaitUntilComplete();
+		}
+		const double fMs = ElapsedMs(xStart);
+		ulStealsOut = g_xEngine.Tasks().GetStealCount() - ulStealsBefore;
+		return fMs;
+	}
+
+	double RunGraphPass(u_int uNumTasks, u_int uIters, BenchCounter& xCounter)
+	{
+		BenchTaskSet xChain(uNumTasks, xCounter);
+		xChain.LinkAsChain();
+
+		const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+		for (u_int uIter = 0; uIter < uIters; uIter++)
+		{
+			// Tail first: every task but the head is parked on its predecessor,
+			// so the chain is driven purely by dependency release.
+			xChain.SubmitAllReversed();
+			xChain.WaitAll();
+		}
+		return ElapsedMs(xStart);
+	}
+
+	struct ParallelForBenchData
+	{
+		float* m_pfValues = nullptr;
+	};
+
+	void ScaleRange(void* pData, u_int uBegin, u_int uEnd)
+	{
+		float* pfValues = static_cast<ParallelForBenchData*>(pData)->m_pfValues;
+		for (u_int u = uBegin; u < uEnd; u++)
+		{
+			pfValues[u] = pfValues[u] * 0.5f + 1.0f;
+		}
+	}
+
+	double RunParallelForPass(u_int uNumElements, u_int uGrainSize, u_int uIters)
+	{
+		ParallelForBenchData xData;
+		xData.m_pfValues = new float[uNumElements];
+		for (u_int u = 0; u < uNumElements; u++)
+		{
+			xData.m_pfValues[u] = static_cast<float>(u);
+		}
+
+		const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+		for (u_int uIter = 0; uIter < uIters; uIter++)
+		{
+			g_xEngine.Tasks().ParallelFor(ZENITH_PROFILE_ZONE("Bench Task"), ScaleRange, &xData, uNumElements, uGrainSize);
+		}
+		const double fMs = ElapsedMs(xStart);
+		delete[] xData.m_pfValues;
+		return fMs;
+	}
+
+	double RunLatencyPass(u_int uIters)
+	{
+		Zenith_Task xTask(ZENITH_PROFILE_ZONE("Bench Task"), EmptyTask, nullptr);
+		const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+		for (u_int uIter = 0; uIter < uIters; uIter++)
+		{
+			g_xEngine.Tasks().SubmitTask(&xTask);
+			xTask.WaitUntilComplete();
+		}
+		return ElapsedMs(xStart);
+	}
+}
+
+u_int64 Zenith_BenchTaskSystem_RunOnce(u_int uNumTasks, u_int uIters)
+{
+	BenchCounter xCounter;
+	u_int64 ulSteals = 0;
+	RunSpawnPass(uNumTasks, uIters, xCounter);
+	RunStealPass(uNumTasks, uIters, xCounter, ulSteals);
+	RunGraphPass(uNumTasks, uIters, xCounter);
+	return xCounter.m_ulExecuted.load(std::memory_order_relaxed);
+}
+
+bool Zenith_BenchTaskSystem_ForceLink()
+{
+	return true;
+}
+
+// ============================================================================
+// Zenith_BenchTaskSystem_Run
+//
+// The sweep.tasks benchmark. One BENCH line per pass per task count, plus a
+// single round-trip latency line.
+// ============================================================================
+void Zenith_BenchTaskSystem_Run()
+{
+	static constexpr u_int uBENCH_ITERS = 20;
+	static constexpr u_int uLATENCY_ITERS = 10000;
+	static const u_int auTaskCounts[] = { 256u, 4096u, 65536u };
+
+	std::printf("BENCH tasks.begin workers=%u iters=%u\n", g_xEngine.Tasks().GetNumWorkerThreads(), uBENCH_ITERS);
+	std::fflush(stdout);
+
+	for (u_int uCountIndex = 0; uCountIndex < (sizeof(auTaskCounts) / sizeof(auTaskCounts[0])); ++uCountIndex)
+	{
+		const u_int uNumTasks = auTaskCounts[uCountIndex];
+		BenchCounter xCounter;
+
+		const double fSpawnMs = RunSpawnPass(uNumTasks, uBENCH_ITERS, xCounter);
+		const double fTasksPerMs = (fSpawnMs > 0.0) ? (static_cast<double>(uNumTasks) * uBENCH_ITERS / fSpawnMs) : 0.0;
+		std::printf("BENCH tasks.spawn N=%u iters=%u ms=%.3f tasks_per_ms=%.1f\n", uNumTasks, uBENCH_ITERS, fSpawnMs, fTasksPerMs);
+		std::fflush(stdout);
+
+		u_int64 ulSteals = 0;
+		const double fStealMs = RunStealPass(uNumTasks, uBENCH_ITERS, xCounter, ulSteals);
+		std::printf("BENCH tasks.steal N=%u iters=%u ms=%.3f steals=%llu\n", uNumTasks, uBENCH_ITERS, fStealMs,
+			static_cast<unsigned long long>(ulSteals));
+		std::fflush(stdout);
+
+		const double fGraphMs = RunGraphPass(uNumTasks, uBENCH_ITERS, xCounter);
+		std::printf("BENCH tasks.graph N=%u iters=%u ms=%.3f\n", uNumTasks, uBENCH_ITERS, fGraphMs);
+		std::fflush(stdout);
+
+		// Correctness self-check: every pass must run every task body exactly once
+		// per iteration. A shortfall means a task was lost in a deque or parked
+		// forever on a dependency.
+		const u_int64 ulExpected = static_cast<u_int64>(uNumTasks) * uBENCH_ITERS * 3u;
+		Zenith_Assert(xCounter.m_ulExecuted.load() == ulExpected,
+			"BenchTaskSystem at N=%u executed %llu task bodies, expected %llu", uNumTasks,
+			static_cast<unsigned long long>(xCounter.m_ulExecuted.load()), static_cast<unsigned long long>(ulExpected));
+	}
+
+	static constexpr u_int uPARALLEL_FOR_ELEMENTS = 1u << 20;
+	static const u_int auGrainSizes[] = { 1u, 64u, 4096u };
+	for (u_int uGrainIndex = 0; uGrainIndex < (sizeof(auGrainSizes) / sizeof(auGrainSizes[0])); ++uGrainIndex)
+	{
+		const double fParallelForMs = RunParallelForPass(uPARALLEL_FOR_ELEMENTS, auGrainSizes[uGrainIndex], uBENCH_ITERS);
+		std::printf("BENCH tasks.parallel_for N=%u grain=%u iters=%u ms=%.3f\n", uPARALLEL_FOR_ELEMENTS, auGrainSizes[uGrainIndex], uBENCH_ITERS, fParallelForMs);
+		std::fflush(stdout);
+	}
+
+	const double fLatencyMs = RunLatencyPass(uLATENCY_ITERS);
+	std::printf("BENCH tasks.latency iters=%u us_per_roundtrip=%.3f\n", uLATENCY_ITERS, fLatencyMs * 1000.0 / uLATENCY_ITERS);
+	std::printf("BENCH tasks.end\n");
+	std::fflush(stdout);
+}
+
+// ============================================================================
+// Registry entries (--bench=tasks)
+// ============================================================================
+namespace
+{
+	constexpr u_int uREGISTRY_ITERS = 4;
+
+	// Spawn + steal + graph at one task count: the scheduler's throughput paths.
+	void BenchSpawnStealGraph(Zenith_BenchmarkContext& xContext)
+	{
+		const u_int uNumTasks = static_cast<u_int>(xContext.GetArg());
+		BenchCounter xCounter;
+		u_int64 ulSteals = 0;
+		const double fMs = RunSpawnPass(uNumTasks, uREGISTRY_ITERS, xCounter)
+			+ RunStealPass(uNumTasks, uREGISTRY_ITERS, xCounter, ulSteals)
+			+ RunGraphPass(uNumTasks, uREGISTRY_ITERS, xCounter);
+		xContext.SetElapsedMs(fMs);
+		xContext.SetItemsProcessed(xCounter.m_ulExecuted.load(std::memory_order_relaxed));
+	}
+
+	void BenchParallelFor(Zenith_BenchmarkContext& xContext)
+	{
+		xContext.SetElapsedMs(RunParallelForPass(1u << 20, static_cast<u_int>(xContext.GetArg()), uREGISTRY_ITERS));
+	}
+
+	// The printed sweep above as one sample; see Zenith_BenchTaskSystem.h.
+	void BenchSweep(Zenith_BenchmarkContext&)
+	{
+		Zenith_BenchTaskSystem_Run();
+	}
+}
+
+ZENITH_BENCHMARK(tasks, spawn_steal_graph_4k, &BenchSpawnStealGraph, 4096);
+ZENITH_BENCHMARK(tasks, parallel_for_grain64, &BenchParallelFor, 64);
+ZENITH_BENCHMARK(sweep, tasks, &BenchSweep, 0);
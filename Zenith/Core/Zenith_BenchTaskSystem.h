@@ -0,0 +1,34 @@
+#pragma once
+
+// ============================================================================
+// Zenith_BenchTaskSystem
+//
+// A deterministic, GPU-free micro-benchmark for the work-stealing scheduler in
+// Zenith_TaskSystem. Sibling of Zenith_BenchECS; registered as sweep.tasks, so
+// `--bench=sweep.tasks` runs Zenith_BenchTaskSystem_Run() after engine init and
+// then exits cleanly. Prints parseable lines:
+//
+//   BENCH tasks.spawn   N=<n> iters=<m> ms=<elapsed> tasks_per_ms=<rate>
+//   BENCH tasks.steal   N=<n> iters=<m> ms=<elapsed> steals=<count>
+//   BENCH tasks.graph   N=<n> iters=<m> ms=<elapsed>
+//   BENCH tasks.parallel_for N=<n> grain=<g> iters=<m> ms=<elapsed>
+//   BENCH tasks.latency iters=<m> us_per_roundtrip=<avg>
+//
+//   spawn   - N independent tasks submitted from the main thread, then waited.
+//   steal   - ONE root task fans N children out from a worker thread; they land
+//             in that worker's deque, so every other worker has to steal them.
+//   graph   - a chain of N tasks linked with DependsOn, submitted tail-first.
+//   parallel_for - ParallelFor over 1M floats at grain 1 / 64 / 4096.
+//   latency - submit one empty task and wait for it, repeated.
+// ============================================================================
+
+// Run the full sweep over the canonical task counts (256, 4096, 65536).
+void Zenith_BenchTaskSystem_Run();
+
+// Link anchor for the --bench dispatch (see Zenith_BenchECS_ForceLink).
+bool Zenith_BenchTaskSystem_ForceLink();
+
+// Test/measurement helper: run one spawn + steal + graph pass of uNumTasks tasks,
+// uIters times, and return the total number of task bodies executed. Used by
+// Zenith_BenchTaskSystem_Run and by the TaskSystem/BenchTaskSystemSmoke unit test.
+u_int64 Zenith_BenchTaskSystem_RunOnce(u_int uNumTasks, u_int uIters);
@@ -0,0 +1,145 @@
+// Unit tests for the benchmark runner's statistics, filter and results file.
+// #included at the bottom of Zenith_Benchmark.cpp. Cases here are LOCAL (never
+// registered), so running them does not add to a --bench sweep.
+
+namespace
+{
+	u_int s_uBenchTestCalls = 0;
+
+	void BenchTestCountingBody(Zenith_BenchmarkContext& xContext)
+	{
+		s_uBenchTestCalls++;
+		xContext.SetElapsedMs(static_cast<double>(s_uBenchTestCalls));
+		xContext.SetItemsProcessed(xContext.GetArg());
+	}
+
+	void BenchTestUnstableBody(Zenith_BenchmarkContext& xContext)
+	{
+		s_uBenchTestCalls++;
+		xContext.SetItemsProcessed(s_uBenchTestCalls);
+	}
+
+	void BenchTestManualTimingBody(Zenith_BenchmarkContext& xContext)
+	{
+		// Never started: a manual region that is only stopped times nothing.
+		xContext.StopTiming();
+		xContext.StartTiming();
+		xContext.StopTiming();
+	}
+}
+
+ZENITH_TEST(Benchmark, ComputeStatsMedianPercentileAndSpread)
+{
+	double afOdd[] = { 5.0, 1.0, 3.0, 2.0, 4.0 };
+	const Zenith_BenchmarkStats xOdd = Zenith_Benchmark::ComputeStats(afOdd, 5);
+	ZENITH_ASSERT_EQ(xOdd.m_uSamples, 5u);
+	ZENITH_ASSERT_EQ_FLOAT(xOdd.m_fMedianMs, 3.0, 1e-6, "odd count: the middle sample");
+	ZENITH_ASSERT_EQ_FLOAT(xOdd.m_fP95Ms, 5.0, 1e-6, "nearest rank ceil(0.95 * 5) = 5");
+	ZENITH_ASSERT_EQ_FLOAT(xOdd.m_fMeanMs, 3.0, 1e-6);
+	ZENITH_ASSERT_EQ_FLOAT(xOdd.m_fStdDevMs, 1.5811388, 1e-5, "sample stddev of 1..5 is sqrt(2.5)");
+	ZENITH_ASSERT_EQ_FLOAT(xOdd.m_fMinMs, 1.0, 1e-6);
+	ZENITH_ASSERT_EQ_FLOAT(xOdd.m_fMaxMs, 5.0, 1e-6);
+	ZENITH_ASSERT_EQ_FLOAT(afOdd[0], 1.0, 1e-6, "ComputeStats sorts in place");
+
+	double afEven[] = { 4.0, 1.0, 3.0, 2.0 };
+	const Zenith_BenchmarkStats xEven = Zenith_Benchmark::ComputeStats(afEven, 4);
+	ZENITH_ASSERT_EQ_FLOAT(xEven.m_fMedianMs, 2.5, 1e-6, "even count: mean of the middle two");
+
+	double afTwenty[20];
+	for (u_int u = 0; u < 20; u++)
+	{
+		afTwenty[u] = static_cast<double>(20 - u);
+	}
+	const Zenith_BenchmarkStats xTwenty = Zenith_Benchmark::ComputeStats(afTwenty, 20);
+	ZENITH_ASSERT_EQ_FLOAT(xTwenty.m_fP95Ms, 19.0, 1e-6, "p95 of 1..20 is the 19th sample, not the max");
+
+	double afOne[] = { 7.0 };
+	const Zenith_BenchmarkStats xOne = Zenith_Benchmark::ComputeStats(afOne, 1);
+	ZENITH_ASSERT_EQ_FLOAT(xOne.m_fP95Ms, 7.0, 1e-6);
+	ZENITH_ASSERT_EQ_FLOAT(xOne.m_fStdDevMs, 0.0, 1e-9, "one sample has no spread");
+
+	const Zenith_BenchmarkStats xNone = Zenith_Benchmark::ComputeStats(nullptr, 0);
+	ZENITH_ASSERT_EQ(xNone.m_uSamples, 0u);
+}
+
+ZENITH_TEST(Benchmark, FilterMatchesAllCategoryAndFullName)
+{
+	ZENITH_ASSERT_TRUE(Zenith_Benchmark::MatchesFilter("all", "nav", "pathfind_grid64"));
+	ZENITH_ASSERT_TRUE(Zenith_Benchmark::MatchesFilter("nav", "nav", "pathfind_grid64"));
+	ZENITH_ASSERT_TRUE(Zenith_Benchmark::MatchesFilter("nav.pathfind_grid64", "nav", "pathfind_grid64"));
+	ZENITH_ASSERT_TRUE(Zenith_Benchmark::MatchesFilter("ecs,nav.pathfind_grid64", "nav", "pathfind_grid64"), "later tokens must be checked");
+	ZENITH_ASSERT_TRUE(Zenith_Benchmark::MatchesFilter("ecs,nav", "ecs", "query_foreach_10k"));
+
+	ZENITH_ASSERT_FALSE(Zenith_Benchmark::MatchesFilter("na", "nav", "pathfind_grid64"), "a category must match whole");
+	ZENITH_ASSERT_FALSE(Zenith_Benchmark::MatchesFilter("nav.pathfind", "nav", "pathfind_grid64"), "a full name must match whole");
+	ZENITH_ASSERT_FALSE(Zenith_Benchmark::MatchesFilter("nav.pathfind_grid64x", "nav", "pathfind_grid64"));
+	ZENITH_ASSERT_FALSE(Zenith_Benchmark::MatchesFilter("ecs", "nav", "pathfind_grid64"));
+	ZENITH_ASSERT_FALSE(Zenith_Benchmark::MatchesFilter("", "nav", "pathfind_grid64"));
+	ZENITH_ASSERT_FALSE(Zenith_Benchmark::MatchesFilter(nullptr, "nav", "pathfind_grid64"));
+}
+
+ZENITH_TEST(Benchmark, RunCaseWarmsUpAndChecksItems)
+{
+	Zenith_BenchmarkCase xCounting = { "benchtest", "counting", &BenchTestCountingBody, 42, nullptr };
+	s_uBenchTestCalls = 0;
+	const Zenith_BenchmarkResult xResult = Zenith_Benchmark::RunCase(xCounting, 2, 3);
+	ZENITH_ASSERT_EQ(s_uBenchTestCalls, 5u, "two warmup runs plus three timed runs");
+	ZENITH_ASSERT_EQ(xResult.m_xStats.m_uSamples, 3u);
+	ZENITH_ASSERT_EQ_FLOAT(xResult.m_xStats.m_fMinMs, 3.0, 1e-6, "warmup runs must not be sampled");
+	ZENITH_ASSERT_EQ_FLOAT(xResult.m_xStats.m_fMedianMs, 4.0, 1e-6, "SetElapsedMs must replace the measured time");
+	ZENITH_ASSERT_EQ(xResult.m_ulItemsProcessed, 42ull);
+	ZENITH_ASSERT_TRUE(xResult.m_bItemsStable);
+
+	Zenith_BenchmarkCase xUnstable = { "benchtest", "unstable", &BenchTestUnstableBody, 0, nullptr };
+	s_uBenchTestCalls = 0;
+	ZENITH_ASSERT_FALSE(Zenith_Benchmark::RunCase(xUnstable, 0, 2).m_bItemsStable, "a changing item count must be flagged");
+
+	Zenith_BenchmarkCase xManual = { "benchtest", "manual", &BenchTestManualTimingBody, 0, nullptr };
+	const Zenith_BenchmarkResult xManualResult = Zenith_Benchmark::RunCase(xManual, 0, 1);
+	ZENITH_ASSERT_TRUE(xManualResult.m_xStats.m_fMaxMs < 1.0, "only the empty Start/Stop region may be timed");
+}
+
+ZENITH_TEST(Benchmark, ResultsJSONCarriesEveryField)
+{
+	FILE* pxFile = Zenith_TestOpenTempFile();
+	if (pxFile == nullptr)
+	{
+		ZENITH_SKIP("no temp file available for the results round-trip");
+	}
+
+	Zenith_BenchmarkCase xCase = { "benchtest", "json", &BenchTestCountingBody, 9, nullptr };
+	Zenith_Vector<Zenith_BenchmarkResult> xResults;
+	Zenith_BenchmarkResult xResult;
+	xResult.m_pxCase = &xCase;
+	xResult.m_xStats.m_uSamples = 3;
+	xResult.m_xStats.m_fMedianMs = 1.5;
+	xResult.m_xStats.m_fP95Ms = 2.25;
+	xResult.m_ulItemsProcessed = 9;
+	xResults.PushBack(xResult);
+	xResult.m_bHasPeakBytes = true;
+	xResult.m_ulPeakBytes = 4096;
+	xResults.PushBack(xResult);
+
+	Zenith_BenchmarkOptions xOptions;
+	xOptions.m_uWarmupRuns = 1;
+	xOptions.m_uSampleRuns = 3;
+	Zenith_Benchmark::WriteResultsJSON(pxFile, xResults, xOptions);
+
+	fflush(pxFile);
+	fseek(pxFile, 0, SEEK_END);
+	const long lSize = ftell(pxFile);
+	fseek(pxFile, 0, SEEK_SET);
+	Zenith_Vector<char> xText;
+	xText.Resize(static_cast<u_int>(lSize) + 1, '\0');
+	if (lSize > 0) { const size_t uRead = fread(xText.GetDataPointer(), 1, static_cast<size_t>(lSize), pxFile); (void)uRead; }
+	fclose(pxFile);
+	const char* szText = xText.GetDataPointer();
+
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, "\"schema\": 1"));
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, "\"warmup\": 1,\n  \"samples\": 3"));
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, "{\"name\": \"benchtest.json\", \"arg\": 9, \"median_ms\": 1.5000, \"p95_ms\": 2.2500"),
+		"each result must lead with its full name, arg and timings");
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, "\"items\": 9, \"items_stable\": true, \"peak_bytes\": null},"),
+		"an untracked build must write a null peak, and results must be comma-separated");
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, "\"peak_bytes\": 4096}\n  ]\n}\n"), "the last result must close the array and object");
+}
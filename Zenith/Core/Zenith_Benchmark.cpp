@@ -0,0 +1,279 @@
+#include "Zenith.h"
+
+#include "Core/Zenith_Benchmark.h"
+
+#include "Core/Zenith_PlatformStdio.h"
+#include "Memory/Zenith_MemoryFrameSample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+	double ElapsedMs(std::chrono::steady_clock::time_point xStart, std::chrono::steady_clock::time_point xEnd)
+	{
+		return std::chrono::duration<double, std::milli>(xEnd - xStart).count();
+	}
+
+	// Full names are "<category>.<name>"; these compare without building one.
+	bool FullNameEquals(const char* szToken, size_t ulTokenLength, const char* szCategory, const char* szName)
+	{
+		const size_t ulCategoryLength = strlen(szCategory);
+		return ulTokenLength == ulCategoryLength + 1 + strlen(szName)
+			&& strncmp(szToken, szCategory, ulCategoryLength) == 0
+			&& szToken[ulCategoryLength] == '.'
+			&& strncmp(szToken + ulCategoryLength + 1, szName, ulTokenLength - ulCategoryLength - 1) == 0;
+	}
+
+	bool CaseNameLess(const Zenith_BenchmarkCase* pxA, const Zenith_BenchmarkCase* pxB)
+	{
+		const int iCategory = strcmp(pxA->m_szCategory, pxB->m_szCategory);
+		return iCategory != 0 ? iCategory < 0 : strcmp(pxA->m_szName, pxB->m_szName) < 0;
+	}
+
+#ifdef ZENITH_DEBUG
+	constexpr const char* szBUILD = "debug";
+#else
+	constexpr const char* szBUILD = "release";
+#endif
+}
+
+void Zenith_BenchmarkContext::StartTiming()
+{
+	m_bManualTiming = true;
+	m_bTimingRunning = true;
+	m_xTimingStart = std::chrono::steady_clock::now();
+}
+
+void Zenith_BenchmarkContext::StopTiming()
+{
+	if (!m_bTimingRunning)
+	{
+		return;
+	}
+	m_fTimedMs += ElapsedMs(m_xTimingStart, std::chrono::steady_clock::now());
+	m_bTimingRunning = false;
+}
+
+void Zenith_Benchmark::Register(Zenith_BenchmarkCase* pxCase)
+{
+	pxCase->m_pxNext = s_pxFirstCase;
+	s_pxFirstCase = pxCase;
+}
+
+bool Zenith_Benchmark::MatchesFilter(const char* szFilter, const char* szCategory, const char* szName)
+{
+	if (szFilter == nullptr)
+	{
+		return false;
+	}
+
+	const char* szToken = szFilter;
+	while (*szToken != '\0')
+	{
+		const char* szComma = strchr(szToken, ',');
+		const size_t ulLength = szComma != nullptr ? static_cast<size_t>(szComma - szToken) : strlen(szToken);
+
+		if ((ulLength == 3 && strncmp(szToken, "all", 3) == 0)
+			|| (ulLength == strlen(szCategory) && strncmp(szToken, szCategory, ulLength) == 0)
+			|| FullNameEquals(szToken, ulLength, szCategory, szName))
+		{
+			return true;
+		}
+
+		if (szComma == nullptr)
+		{
+			break;
+		}
+		szToken = szComma + 1;
+	}
+	return false;
+}
+
+Zenith_BenchmarkStats Zenith_Benchmark::ComputeStats(double* pfSamplesMs, u_int uCount)
+{
+	Zenith_BenchmarkStats xStats;
+	xStats.m_uSamples = uCount;
+	if (uCount == 0)
+	{
+		return xStats;
+	}
+
+	std::sort(pfSamplesMs, pfSamplesMs + uCount);
+	xStats.m_fMinMs = pfSamplesMs[0];
+	xStats.m_fMaxMs = pfSamplesMs[uCount - 1];
+	xStats.m_fMedianMs = (uCount % 2 == 1)
+		? pfSamplesMs[uCount / 2]
+		: 0.5 * (pfSamplesMs[uCount / 2 - 1] + pfSamplesMs[uCount / 2]);
+
+	// Nearest rank: the smallest sample with at least 95% of samples at or below it.
+	const u_int uRank = static_cast<u_int>(std::ceil(0.95 * uCount));
+	xStats.m_fP95Ms = pfSamplesMs[(uRank > 0 ? uRank : 1) - 1];
+
+	double fSum = 0.0;
+	for (u_int u = 0; u < uCount; u++)
+	{
+		fSum += pfSamplesMs[u];
+	}
+	xStats.m_fMeanMs = fSum / uCount;
+
+	if (uCount > 1)
+	{
+		double fSquares = 0.0;
+		for (u_int u = 0; u < uCount; u++)
+		{
+			const double fDelta = pfSamplesMs[u] - xStats.m_fMeanMs;
+			fSquares += fDelta * fDelta;
+		}
+		xStats.m_fStdDevMs = std::sqrt(fSquares / (uCount - 1));
+	}
+	return xStats;
+}
+
+Zenith_BenchmarkResult Zenith_Benchmark::RunCase(const Zenith_BenchmarkCase& xCase, u_int uWarmupRuns, u_int uSampleRuns)
+{
+	Zenith_BenchmarkResult xResult;
+	xResult.m_pxCase = &xCase;
+
+#if ZENITH_MEMORY_TRACKING_ANY
+	Zenith_MemoryManagement::ResetPeak();
+	const u_int64 ulBaseBytes = Zenith_MemoryManagement::SampleFrame().m_ulTotalBytes;
+#endif
+
+	Zenith_Vector<double> xSamplesMs;
+	xSamplesMs.Reserve(uSampleRuns);
+	for (u_int uRun = 0; uRun < uWarmupRuns + uSampleRuns; uRun++)
+	{
+		Zenith_BenchmarkContext xContext(xCase.m_ulArg);
+		const std::chrono::steady_clock::time_point xStart = std::chrono::steady_clock::now();
+		xCase.m_pfnBody(xContext);
+		const std::chrono::steady_clock::time_point xEnd = std::chrono::steady_clock::now();
+		xContext.StopTiming();
+
+		if (uRun < uWarmupRuns)
+		{
+			continue;
+		}
+
+		double fMs = ElapsedMs(xStart, xEnd);
+		if (xContext.m_fOverrideMs >= 0.0)
+		{
+			fMs = xContext.m_fOverrideMs;
+		}
+		else if (xContext.m_bManualTiming)
+		{
+			fMs = xContext.m_fTimedMs;
+		}
+		xSamplesMs.PushBack(fMs);
+
+		if (uRun == uWarmupRuns)
+		{
+			xResult.m_ulItemsProcessed = xContext.m_ulItemsProcessed;
+		}
+		else if (xContext.m_ulItemsProcessed != xResult.m_ulItemsProcessed)
+		{
+			xResult.m_bItemsStable = false;
+		}
+	}
+
+#if ZENITH_MEMORY_TRACKING_ANY
+	const u_int64 ulPeakBytes = Zenith_MemoryManagement::SampleFrame().m_ulPeakBytes;
+	xResult.m_bHasPeakBytes = true;
+	xResult.m_ulPeakBytes = ulPeakBytes > ulBaseBytes ? ulPeakBytes - ulBaseBytes : 0;
+#endif
+
+	xResult.m_xStats = ComputeStats(xSamplesMs.GetDataPointer(), xSamplesMs.GetSize());
+	return xResult;
+}
+
+u_int Zenith_Benchmark::RunAll(const Zenith_BenchmarkOptions& xOptions)
+{
+	Zenith_Vector<const Zenith_BenchmarkCase*> xSelected;
+	for (const Zenith_BenchmarkCase* pxCase = s_pxFirstCase; pxCase != nullptr; pxCase = pxCase->m_pxNext)
+	{
+		if (MatchesFilter(xOptions.m_szFilter, pxCase->m_szCategory, pxCase->m_szName))
+		{
+			xSelected.PushBack(pxCase);
+		}
+	}
+	std::sort(xSelected.GetDataPointer(), xSelected.GetDataPointer() + xSelected.GetSize(), &CaseNameLess);
+
+	std::printf("BENCH begin filter=%s benchmarks=%u warmup=%u samples=%u build=%s\n",
+		xOptions.m_szFilter, xSelected.GetSize(), xOptions.m_uWarmupRuns, xOptions.m_uSampleRuns, szBUILD);
+	std::fflush(stdout);
+
+	Zenith_Vector<Zenith_BenchmarkResult> xResults;
+	xResults.Reserve(xSelected.GetSize());
+	for (u_int u = 0; u < xSelected.GetSize(); u++)
+	{
+		const Zenith_BenchmarkCase& xCase = *xSelected.Get(u);
+		const Zenith_BenchmarkResult xResult = RunCase(xCase, xOptions.m_uWarmupRuns, xOptions.m_uSampleRuns);
+		xResults.PushBack(xResult);
+
+		const Zenith_BenchmarkStats& xStats = xResult.m_xStats;
+		std::printf("BENCH %s.%s arg=%llu median_ms=%.3f p95_ms=%.3f stddev_ms=%.3f min_ms=%.3f max_ms=%.3f samples=%u items=%llu",
+			xCase.m_szCategory, xCase.m_szName, static_cast<unsigned long long>(xCase.m_ulArg),
+			xStats.m_fMedianMs, xStats.m_fP95Ms, xStats.m_fStdDevMs, xStats.m_fMinMs, xStats.m_fMaxMs, xStats.m_uSamples,
+			static_cast<unsigned long long>(xResult.m_ulItemsProcessed));
+		if (xResult.m_bHasPeakBytes)
+		{
+			std::printf(" peak_bytes=%llu", static_cast<unsigned long long>(xResult.m_ulPeakBytes));
+		}
+		std::printf("\n");
+		std::fflush(stdout);
+
+		Zenith_Assert(xResult.m_bItemsStable, "Benchmark %s.%s processed a different item count on different runs",
+			xCase.m_szCategory, xCase.m_szName);
+	}
+
+	if (xOptions.m_szJSONPath != nullptr)
+	{
+		FILE* pxFile = Zenith_PlatformStdio::OpenFile(xOptions.m_szJSONPath, "w");
+		if (pxFile != nullptr)
+		{
+			WriteResultsJSON(pxFile, xResults, xOptions);
+			fclose(pxFile);
+			Zenith_Log(LOG_CATEGORY_CORE, "Benchmark results written to %s", xOptions.m_szJSONPath);
+		}
+		else
+		{
+			Zenith_Warning(LOG_CATEGORY_CORE, "Could not open benchmark results file %s", xOptions.m_szJSONPath);
+		}
+	}
+
+	std::printf("BENCH end\n");
+	std::fflush(stdout);
+	return xSelected.GetSize();
+}
+
+void Zenith_Benchmark::WriteResultsJSON(FILE* pxFile, const Zenith_Vector<Zenith_BenchmarkResult>& xResults, const Zenith_BenchmarkOptions& xOptions)
+{
+	// Names are C identifiers joined by '.', so nothing here needs escaping.
+	fprintf(pxFile, "{\n  \"schema\": 1,\n  \"build\": \"%s\",\n  \"warmup\": %u,\n  \"samples\": %u,\n  \"benchmarks\": [",
+		szBUILD, xOptions.m_uWarmupRuns, xOptions.m_uSampleRuns);
+	for (u_int u = 0; u < xResults.GetSize(); u++)
+	{
+		const Zenith_BenchmarkResult& xResult = xResults.Get(u);
+		const Zenith_BenchmarkStats& xStats = xResult.m_xStats;
+		fprintf(pxFile, "%s\n    {\"name\": \"%s.%s\", \"arg\": %llu, \"median_ms\": %.4f, \"p95_ms\": %.4f, \"mean_ms\": %.4f, "
+			"\"stddev_ms\": %.4f, \"min_ms\": %.4f, \"max_ms\": %.4f, \"samples\": %u, \"items\": %llu, \"items_stable\": %s, ",
+			u == 0 ? "" : ",", xResult.m_pxCase->m_szCategory, xResult.m_pxCase->m_szName,
+			static_cast<unsigned long long>(xResult.m_pxCase->m_ulArg),
+			xStats.m_fMedianMs, xStats.m_fP95Ms, xStats.m_fMeanMs, xStats.m_fStdDevMs, xStats.m_fMinMs, xStats.m_fMaxMs,
+			xStats.m_uSamples, static_cast<unsigned long long>(xResult.m_ulItemsProcessed), xResult.m_bItemsStable ? "true" : "false");
+		if (xResult.m_bHasPeakBytes)
+		{
+			fprintf(pxFile, "\"peak_bytes\": %llu}", static_cast<unsigned long long>(xResult.m_ulPeakBytes));
+		}
+		else
+		{
+			fprintf(pxFile, "\"peak_bytes\": null}");
+		}
+	}
+	fprintf(pxFile, "%s]\n}\n", xResults.GetSize() > 0 ? "\n  " : "");
+}
+
+#ifdef ZENITH_TESTING
+#include "Core/Zenith_Benchmark.Tests.inl"
+#endif
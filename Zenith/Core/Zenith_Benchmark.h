@@ -0,0 +1,158 @@
+#pragma once
+
+#include "Collections/Zenith_Vector.h"
+
+#include <chrono>
+#include <cstdio>
+
+// ============================================================================
+// Zenith_Benchmark
+//
+// One registry and runner for every engine micro-benchmark, so a regression in
+// any hot system shows up in the same place on every commit. Benchmarks are
+// plain functions registered with ZENITH_BENCHMARK next to the code they
+// measure (same static-registrar shape as ZENITH_TEST), and run with:
+//
+//   --bench=<filter>          comma-separated: "all", a category ("ecs"), or a
+//                             full name ("nav.pathfind_grid64")
+//   --bench-samples=<n>       timed runs per benchmark (default 5)
+//   --bench-warmup=<n>        untimed runs first (default 1)
+//   --bench-json[=path]       results file (default "zenith_bench_results.json")
+//
+// after engine init, then the process exits. On a Null-backend build nothing
+// touches a GPU, so the whole sweep runs headless. Each benchmark prints one
+// parseable line:
+//
+//   BENCH <category>.<name> arg=<n> median_ms=<m> p95_ms=<p> stddev_ms=<s> min_ms=<a> max_ms=<b> samples=<k> items=<i> peak_bytes=<h>
+//
+// and the JSON file carries the same numbers. Tools/check_bench_baseline.py
+// compares a results file against Tools/bench_baseline.json.
+//
+// peak_bytes is the tracked-heap high-water above the level the benchmark
+// started at, across its warmup and timed runs; it is only measured when memory
+// tracking is compiled in (null in the JSON, absent from the line, otherwise).
+//
+// The older printed comparison sweeps (Zenith_BenchECS_Run and friends) are
+// registered in the "sweep" category, one sample per full sweep: run one with
+// --bench=sweep.ecs --bench-samples=1 --bench-warmup=0.
+//
+// Registrations in a static library are dropped by the linker unless something
+// references their object file: benchmark TUs that nothing else reaches expose a
+// ForceLink anchor that the --bench dispatch in Zenith_Main.cpp calls.
+// ============================================================================
+
+// Handed to a benchmark body once per run.
+class Zenith_BenchmarkContext
+{
+public:
+	explicit Zenith_BenchmarkContext(u_int64 ulArg) : m_ulArg(ulArg) {}
+
+	// The value given at registration (an entity count, a grid size...).
+	u_int64 GetArg() const { return m_ulArg; }
+
+	// Narrow the timed region to exclude setup and teardown. Without either call
+	// the whole body is timed. Start/Stop pairs may repeat; the regions sum.
+	void StartTiming();
+	void StopTiming();
+
+	// For bodies whose helper already times its own hot loop: this run's time,
+	// replacing whatever the runner measured.
+	void SetElapsedMs(double fMs) { m_fOverrideMs = fMs; }
+
+	// Units of work this run did. Reported with the result, and required to be
+	// the same on every timed run: a deterministic workload that processes a
+	// different count is broken, not slow.
+	void SetItemsProcessed(u_int64 ulItems) { m_ulItemsProcessed = ulItems; }
+
+private:
+	friend class Zenith_Benchmark;
+
+	u_int64 m_ulArg = 0;
+	u_int64 m_ulItemsProcessed = 0;
+	double m_fOverrideMs = -1.0;
+	double m_fTimedMs = 0.0;
+	bool m_bManualTiming = false;
+	bool m_bTimingRunning = false;
+	std::chrono::steady_clock::time_point m_xTimingStart;
+};
+
+struct Zenith_BenchmarkCase
+{
+	const char* m_szCategory;
+	const char* m_szName;
+	void (*m_pfnBody)(Zenith_BenchmarkContext&);
+	u_int64 m_ulArg;
+	Zenith_BenchmarkCase* m_pxNext;
+};
+
+struct Zenith_BenchmarkStats
+{
+	u_int m_uSamples = 0;
+	double m_fMedianMs = 0.0;
+	double m_fP95Ms = 0.0;     // nearest-rank
+	double m_fMeanMs = 0.0;
+	double m_fStdDevMs = 0.0;  // sample (n - 1) standard deviation
+	double m_fMinMs = 0.0;
+	double m_fMaxMs = 0.0;
+};
+
+struct Zenith_BenchmarkResult
+{
+	const Zenith_BenchmarkCase* m_pxCase = nullptr;
+	Zenith_BenchmarkStats m_xStats;
+	u_int64 m_ulItemsProcessed = 0;
+	bool m_bItemsStable = true;
+	bool m_bHasPeakBytes = false;
+	u_int64 m_ulPeakBytes = 0;
+};
+
+struct Zenith_BenchmarkOptions
+{
+	const char* m_szFilter = "all";
+	u_int m_uWarmupRuns = 1;
+	u_int m_uSampleRuns = 5;
+	const char* m_szJSONPath = nullptr;   // nullptr: no results file
+};
+
+class Zenith_Benchmark
+{
+public:
+	static void Register(Zenith_BenchmarkCase* pxCase);
+
+	// Registration order is reverse of declaration; RunAll sorts by name.
+	static const Zenith_BenchmarkCase* GetFirstCase() { return s_pxFirstCase; }
+
+	// Runs every registered benchmark the filter selects, in name order, prints
+	// a BENCH line for each and writes the results file when a path is set.
+	// Returns how many benchmarks ran.
+	static u_int RunAll(const Zenith_BenchmarkOptions& xOptions);
+
+	static Zenith_BenchmarkResult RunCase(const Zenith_BenchmarkCase& xCase, u_int uWarmupRuns, u_int uSampleRuns);
+
+	static bool MatchesFilter(const char* szFilter, const char* szCategory, const char* szName);
+
+	// Sorts pfSamplesMs in place.
+	static Zenith_BenchmarkStats ComputeStats(double* pfSamplesMs, u_int uCount);
+
+	static void WriteResultsJSON(FILE* pxFile, const Zenith_Vector<Zenith_BenchmarkResult>& xResults, const Zenith_BenchmarkOptions& xOptions);
+
+private:
+	static inline Zenith_BenchmarkCase* s_pxFirstCase = nullptr;
+};
+
+struct Zenith_BenchmarkRegistrar
+{
+	Zenith_BenchmarkRegistrar(Zenith_BenchmarkCase* pxCase)
+	{
+		Zenith_Benchmark::Register(pxCase);
+	}
+};
+
+// Registers pfnBody as "<category>.<name>", called with ulArg. One body can be
+// registered several times under different names and args.
+#define ZENITH_BENCHMARK(category, name, pfnBody, ulArg)                              \
+	static Zenith_BenchmarkCase g_xZenithBenchCase_##category##_##name = {            \
+		#category, #name, (pfnBody), (ulArg), nullptr                                 \
+	};                                                                                \
+	static Zenith_BenchmarkRegistrar g_xZenithBenchReg_##category##_##name(           \
+		&g_xZenithBenchCase_##category##_##name)
@@ -98,6 +98,13 @@ void Zenith_UnitTests::TestCommandLineParseDefaults()
 	ZENITH_ASSERT_FALSE(xFlags.m_bSkipBootCapture, "no flags must leave the boot capture on");
 	ZENITH_ASSERT_NULL(xFlags.m_szUnitTestTimings, "no flags must leave the unit-test timings path null");
 	ZENITH_ASSERT_FALSE(xFlags.m_bExitAfterUnitTests, "no flags must leave exit-after-unit-tests off");
+	ZENITH_ASSERT_NULL(xFlags.m_szProfileTrace, "no flags must leave the profile trace path null");
+	ZENITH_ASSERT_NULL(xFlags.m_szPerfCounters, "no flags must leave the perf counters path null");
+	ZENITH_ASSERT_NULL(xFlags.m_szBenchFilter, "no flags must not ask for a benchmark sweep");
+	ZENITH_ASSERT_NULL(xFlags.m_szBenchJSON, "no flags must leave the benchmark results path null");
+	ZENITH_ASSERT_EQ(xFlags.m_uBenchSamples, 5u, "benchmark samples must default to 5");
+	ZENITH_ASSERT_EQ(xFlags.m_uBenchWarmup, 1u, "benchmark warmup must default to 1");
+	ZENITH_ASSERT_EQ(xFlags.m_ulHeapSampleBytes, 0ull, "no flags must leave heap sampling off");
 }
 
 ZENITH_TEST(CommandLine, ParseEveryBareFlag) { Zenith_UnitTests::TestCommandLineParseEveryBareFlag(); }
@@ -209,6 +216,134 @@ void Zenith_UnitTests::TestCommandLineParsePrefixedFlags()
 		ZENITH_ASSERT_NULL(xFlags.m_szBootProfileDump,
 			"--skip-boot-capture must not be captured by the --boot-profile-dump prefix");
 	}
+
+	// --profile-trace shares the bare / "=path" resolution.
+	{
+		char szExe[]   = "zenith.exe";
+		char szTrace[] = "--profile-trace";
+		char* apszArgv[] = { szExe, szTrace };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_STREQ(xFlags.m_szProfileTrace, "zenith_profile_trace.json",
+			"the bare --profile-trace form must use the default filename");
+	}
+	{
+		char szExe[]   = "zenith.exe";
+		char szTrace[] = "--profile-trace=D:/artifacts/soak.json";
+		char* apszArgv[] = { szExe, szTrace };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_STREQ(xFlags.m_szProfileTrace, "D:/artifacts/soak.json",
+			"--profile-trace=path must use the path after the '='");
+	}
+
+	// So does --perf-counters.
+	{
+		char szExe[]      = "zenith.exe";
+		char szCounters[] = "--perf-counters";
+		char* apszArgv[] = { szExe, szCounters };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_STREQ(xFlags.m_szPerfCounters, "zenith_perf_counters.json",
+			"the bare --perf-counters form must use the default filename");
+	}
+	{
+		char szExe[]      = "zenith.exe";
+		char szCounters[] = "--perf-counters=D:/artifacts/soak_counters.json";
+		char* apszArgv[] = { szExe, szCounters };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_STREQ(xFlags.m_szPerfCounters, "D:/artifacts/soak_counters.json",
+			"--perf-counters=path must use the path after the '='");
+	}
+}
+
+// The benchmark flags share the "--bench" stem with the retired --bench-ecs
+// family (now the sweep.* registrations); none of the table entries may read
+// one of those as a filter.
+ZENITH_TEST(CommandLine, ParseBenchFlags) { Zenith_UnitTests::TestCommandLineParseBenchFlags(); }
+void Zenith_UnitTests::TestCommandLineParseBenchFlags()
+{
+	{
+		char szExe[]     = "zenith.exe";
+		char szBench[]   = "--bench=ecs,nav.pathfind_grid64";
+		char szSamples[] = "--bench-samples=9";
+		char szWarmup[]  = "--bench-warmup=0";
+		char szJSON[]    = "--bench-json=D:/artifacts/bench.json";
+		char* apszArgv[] = { szExe, szBench, szSamples, szWarmup, szJSON };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_STREQ(xFlags.m_szBenchFilter, "ecs,nav.pathfind_grid64", "--bench=filter must keep the whole filter");
+		ZENITH_ASSERT_EQ(xFlags.m_uBenchSamples, 9u);
+		ZENITH_ASSERT_EQ(xFlags.m_uBenchWarmup, 0u, "a zero warmup is legal");
+		ZENITH_ASSERT_STREQ(xFlags.m_szBenchJSON, "D:/artifacts/bench.json");
+	}
+	{
+		char szExe[]     = "zenith.exe";
+		char szBench[]   = "--bench";
+		char szSamples[] = "--bench-samples=0";
+		char szJSON[]    = "--bench-json";
+		char* apszArgv[] = { szExe, szBench, szSamples, szJSON };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_STREQ(xFlags.m_szBenchFilter, "all", "bare --bench must run everything");
+		ZENITH_ASSERT_EQ(xFlags.m_uBenchSamples, 1u, "samples must clamp to at least one");
+		ZENITH_ASSERT_STREQ(xFlags.m_szBenchJSON, "zenith_bench_results.json", "bare --bench-json must use the default filename");
+	}
+	{
+		char szExe[]   = "zenith.exe";
+		char szBench[] = "--bench=";
+		char* apszArgv[] = { szExe, szBench };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_STREQ(xFlags.m_szBenchFilter, "all", "an empty filter must be the bare form");
+	}
+	{
+		char szExe[]  = "zenith.exe";
+		char szECS[]  = "--bench-ecs";
+		char szPool[] = "--bench-pool";
+		char* apszArgv[] = { szExe, szECS, szPool };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_NULL(xFlags.m_szBenchFilter, "the legacy --bench-* flags must not start a registry sweep");
+		ZENITH_ASSERT_NULL(xFlags.m_szBenchJSON);
+	}
+}
+
+// --heap-sample used to be read with atoll in Zenith_Main, so a typo such as
+// "=64k" silently became 64 bytes and "=abc" the default. Malformed values now
+// leave sampling off.
+ZENITH_TEST(CommandLine, ParseHeapSample) { Zenith_UnitTests::TestCommandLineParseHeapSample(); }
+void Zenith_UnitTests::TestCommandLineParseHeapSample()
+{
+	{
+		char szExe[]    = "zenith.exe";
+		char szSample[] = "--heap-sample";
+		char* apszArgv[] = { szExe, szSample };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_EQ(xFlags.m_ulHeapSampleBytes, Zenith_HeapSampler::ulDEFAULT_MEAN_INTERVAL_BYTES,
+			"bare --heap-sample must use the sampler's default interval");
+		ZENITH_ASSERT_NULL(xFlags.m_szHeapSampleRejected);
+	}
+	{
+		char szExe[]    = "zenith.exe";
+		char szSample[] = "--heap-sample=65536";
+		char* apszArgv[] = { szExe, szSample };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_EQ(xFlags.m_ulHeapSampleBytes, 65536ull);
+	}
+	const char* aszMalformed[] = { "--heap-sample=", "--heap-sample=0", "--heap-sample=-4096",
+		"--heap-sample=64k", "--heap-sample= 4096", "--heap-sample=abc" };
+	for (const char* szMalformed : aszMalformed)
+	{
+		char szExe[]    = "zenith.exe";
+		char szSample[64];
+		std::snprintf(szSample, sizeof(szSample), "%s", szMalformed);
+		char* apszArgv[] = { szExe, szSample };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_EQ(xFlags.m_ulHeapSampleBytes, 0ull, "%s must leave heap sampling off", szMalformed);
+		ZENITH_ASSERT_NOT_NULL(xFlags.m_szHeapSampleRejected, "%s must be reported as rejected", szMalformed);
+	}
+	{
+		char szExe[]    = "zenith.exe";
+		char szSample[] = "--heap-samples";
+		char* apszArgv[] = { szExe, szSample };
+		const Zenith_CommandLine::Flags xFlags = ParseArgvFixture(apszArgv);
+		ZENITH_ASSERT_EQ(xFlags.m_ulHeapSampleBytes, 0ull, "a longer flag sharing the prefix must not enable sampling");
+		ZENITH_ASSERT_NULL(xFlags.m_szHeapSampleRejected);
+	}
 }
 
 // ============================================================================
@@ -1,6 +1,7 @@
 #include "Zenith.h"
 
 #include "Core/Zenith_CommandLine.h"
+#include "Memory/Zenith_HeapSampler.h"
 
 #include <cstring>
 #include <cstdlib>
@@ -21,6 +22,13 @@ namespace
     bool        s_bSkipBootCapture  = false;
     const char* s_szUnitTestTimings = nullptr;
     bool        s_bExitAfterUnitTests = false;
+    const char* s_szProfileTrace    = nullptr;
+    const char* s_szPerfCounters    = nullptr;
+    const char* s_szBenchFilter     = nullptr;
+    const char* s_szBenchJSON       = nullptr;
+    u_int       s_uBenchSamples     = 5;
+    u_int       s_uBenchWarmup      = 1;
+    u_int64     s_ulHeapSampleBytes = 0;
     Zenith_IndirectCountMode s_eIndirectCountMode = Zenith_IndirectCountMode::Auto;
 
     // --boot-profile-dump with no "=path" writes here. A file-scope literal, not a
@@ -28,6 +36,9 @@ namespace
     // argv-derived paths beside it.
     const char* const szDEFAULT_BOOT_PROFILE_DUMP = "zenith_boot_profile_dump.txt";
     const char* const szDEFAULT_UNIT_TEST_TIMINGS = "zenith_unit_test_timings.txt";
+    const char* const szDEFAULT_PROFILE_TRACE     = "zenith_profile_trace.json";
+    const char* const szDEFAULT_PERF_COUNTERS     = "zenith_perf_counters.json";
+    const char* const szDEFAULT_BENCH_JSON        = "zenith_bench_results.json";
 }
 
 namespace
@@ -77,6 +88,63 @@ namespace
     {
         x.m_szUnitTestTimings = Zenith_CommandLine::ResolveBootProfileDumpArg(szArg, szDEFAULT_UNIT_TEST_TIMINGS);
     }
+    void ApplyProfileTrace(Flags& x, const char* szArg)
+    {
+        x.m_szProfileTrace = Zenith_CommandLine::ResolveBootProfileDumpArg(szArg, szDEFAULT_PROFILE_TRACE);
+    }
+    void ApplyPerfCounters(Flags& x, const char* szArg)
+    {
+        x.m_szPerfCounters = Zenith_CommandLine::ResolveBootProfileDumpArg(szArg, szDEFAULT_PERF_COUNTERS);
+    }
+    void ApplyBenchAll(Flags& x, const char*)           { x.m_szBenchFilter = "all"; }
+    void ApplyBenchFilter(Flags& x, const char* szArg)
+    {
+        // "--bench=" with nothing after it is the bare form.
+        const char* szValue = std::strchr(szArg, '=') + 1;
+        x.m_szBenchFilter = (szValue[0] != '\0') ? szValue : "all";
+    }
+    void ApplyBenchJSON(Flags& x, const char* szArg)
+    {
+        x.m_szBenchJSON = Zenith_CommandLine::ResolveBootProfileDumpArg(szArg, szDEFAULT_BENCH_JSON);
+    }
+    void ApplyBenchSamples(Flags& x, const char* szArg)
+    {
+        const int iSamples = std::atoi(std::strchr(szArg, '=') + 1);
+        x.m_uBenchSamples = iSamples > 0 ? static_cast<u_int>(iSamples) : 1u;
+    }
+    void ApplyBenchWarmup(Flags& x, const char* szArg)
+    {
+        const int iWarmup = std::atoi(std::strchr(szArg, '=') + 1);
+        x.m_uBenchWarmup = iWarmup > 0 ? static_cast<u_int>(iWarmup) : 0u;
+    }
+    void ApplyHeapSample(Flags& x, const char* szArg)
+    {
+        // The prefix also catches "--heap-samples" and the like; only the bare
+        // flag and its "=<bytes>" form select the sampler.
+        constexpr size_t ulNAME_LENGTH = sizeof("--heap-sample") - 1;
+        const char* szTail = szArg + ulNAME_LENGTH;
+        if (szTail[0] == '\0')
+        {
+            x.m_ulHeapSampleBytes = Zenith_HeapSampler::ulDEFAULT_MEAN_INTERVAL_BYTES;
+            x.m_szHeapSampleRejected = nullptr;
+            return;
+        }
+        if (szTail[0] != '=') return;
+
+        // strtoull alone would accept leading whitespace, a sign and trailing
+        // junk, so insist on digits all the way through.
+        const char* szValue = szTail + 1;
+        char* pcEnd = nullptr;
+        const unsigned long long ullBytes = std::strtoull(szValue, &pcEnd, 10);
+        if (szValue[0] < '0' || szValue[0] > '9' || *pcEnd != '\0' || ullBytes == 0)
+        {
+            x.m_ulHeapSampleBytes = 0;
+            x.m_szHeapSampleRejected = szValue;
+            return;
+        }
+        x.m_ulHeapSampleBytes = static_cast<u_int64>(ullBytes);
+        x.m_szHeapSampleRejected = nullptr;
+    }
     void ApplyIndirectCountMode(Flags& x, const char* szArg)
     {
         // The bare form (`--indirect-count-mode` with no '=') and an unknown
@@ -120,6 +188,17 @@ namespace
         { "--unit-test-timings",     FlagArity::Prefixed, &ApplyUnitTestTimings    },
         { "--exit-after-unit-tests", FlagArity::Bare,     &ApplyExitAfterUnitTests },
         { "--indirect-count-mode",   FlagArity::Prefixed, &ApplyIndirectCountMode  },
+        { "--profile-trace",         FlagArity::Prefixed, &ApplyProfileTrace       },
+        { "--perf-counters",         FlagArity::Prefixed, &ApplyPerfCounters       },
+        // The benchmark prefixes all carry their '=' (except --bench-json, whose
+        // bare form is legal), so a retired spelling such as --bench-ecs is
+        // ignored instead of being read as a filter.
+        { "--bench",                 FlagArity::Bare,     &ApplyBenchAll           },
+        { "--bench=",                FlagArity::Prefixed, &ApplyBenchFilter        },
+        { "--bench-json",            FlagArity::Prefixed, &ApplyBenchJSON          },
+        { "--bench-samples=",        FlagArity::Prefixed, &ApplyBenchSamples       },
+        { "--bench-warmup=",         FlagArity::Prefixed, &ApplyBenchWarmup        },
+        { "--heap-sample",           FlagArity::Prefixed, &ApplyHeapSample         },
     };
 
     // True when szArg selects xSpec. Prefixed specs match on their own length,
@@ -186,8 +265,21 @@ namespace Zenith_CommandLine
         s_bSkipBootCapture    = xFlags.m_bSkipBootCapture;
         s_szUnitTestTimings   = xFlags.m_szUnitTestTimings;
         s_bExitAfterUnitTests = xFlags.m_bExitAfterUnitTests;
+        s_szProfileTrace      = xFlags.m_szProfileTrace;
+        s_szPerfCounters      = xFlags.m_szPerfCounters;
+        s_szBenchFilter       = xFlags.m_szBenchFilter;
+        s_szBenchJSON         = xFlags.m_szBenchJSON;
+        s_uBenchSamples       = xFlags.m_uBenchSamples;
+        s_uBenchWarmup        = xFlags.m_uBenchWarmup;
+        s_ulHeapSampleBytes   = xFlags.m_ulHeapSampleBytes;
         s_eIndirectCountMode  = xFlags.m_eIndirectCountMode;
 
+        if (xFlags.m_szHeapSampleRejected != nullptr)
+        {
+            Zenith_Warning(LOG_CATEGORY_CORE, "--heap-sample=%s is not a positive byte count; heap sampling stays off",
+                xFlags.m_szHeapSampleRejected);
+        }
+
         s_bParsed = true;
     }
 
@@ -250,6 +342,46 @@ namespace Zenith_CommandLine
         return s_bSkipBootCapture;
     }
 
+    const char* GetProfileTracePath()
+    {
+        if (!s_bParsed) return nullptr;
+        return s_szProfileTrace;
+    }
+
+    const char* GetPerfCountersPath()
+    {
+        if (!s_bParsed) return nullptr;
+        return s_szPerfCounters;
+    }
+
+    const char* GetBenchFilter()
+    {
+        if (!s_bParsed) return nullptr;
+        return s_szBenchFilter;
+    }
+
+    const char* GetBenchJSONPath()
+    {
+        if (!s_bParsed) return nullptr;
+        return s_szBenchJSON;
+    }
+
+    u_int GetBenchSamples()
+    {
+        return s_uBenchSamples;
+    }
+
+    u_int GetBenchWarmup()
+    {
+        return s_uBenchWarmup;
+    }
+
+    u_int64 GetHeapSampleMeanBytes()
+    {
+        if (!s_bParsed) return 0;
+        return s_ulHeapSampleBytes;
+    }
+
     const char* GetUnitTestTimingsPath()
     {
         if (!s_bParsed) return nullptr;
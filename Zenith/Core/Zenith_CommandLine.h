@@ -21,7 +21,7 @@
 // NOTE --exit-after-frames is NOT a general "quit after N frames" switch: it is
 // consumed only inside Zenith_AutomatedTestRunner's Stepping phase, so it does
 // nothing without an --automated-test selection flag. To boot and quit, use
-// --exit-after-unit-tests (below) or --bench-ecs.
+// --exit-after-unit-tests (below) or --bench.
 //
 // Other engine CLI flags (--list-automated-tests, --automated-test,
 // --all-automated-tests, --exit-after-frames, --fixed-dt,
@@ -67,6 +67,17 @@ namespace Zenith_CommandLine
         bool        m_bSkipBootCapture    = false;
         const char* m_szUnitTestTimings   = nullptr;
         bool        m_bExitAfterUnitTests = false;
+        const char* m_szProfileTrace      = nullptr;
+        const char* m_szPerfCounters      = nullptr;
+        const char* m_szBenchFilter       = nullptr;
+        const char* m_szBenchJSON         = nullptr;
+        u_int       m_uBenchSamples       = 5;
+        u_int       m_uBenchWarmup        = 1;
+        // --heap-sample[=<mean bytes>]: 0 when absent. A value that is not a
+        // positive decimal byte count leaves sampling off and is kept in
+        // m_szHeapSampleRejected so Parse can say why.
+        u_int64     m_ulHeapSampleBytes   = 0;
+        const char* m_szHeapSampleRejected = nullptr;
         // --indirect-count-mode=auto|native|padded|single (Phase 1 of the
         // terrain indirect-count compatibility plan). Stored as a small enum
         // so the parser owns the vocabulary — Core must not include or return
@@ -153,6 +164,35 @@ namespace Zenith_CommandLine
     const char* GetBootProfileDumpPath();
     bool        IsBootCaptureSkipped();
 
+    // `--profile-trace[=path]`: stream every profiled frame to a Chrome trace JSON
+    // file (default "zenith_profile_trace.json") from Zenith_Profiling::Initialise
+    // until shutdown. Parsed here so the trace also covers boot. nullptr when absent.
+    const char* GetProfileTracePath();
+
+    // `--perf-counters[=path]`: write the Zenith_PerfCounters summary as JSON at
+    // shutdown (default "zenith_perf_counters.json"), plus a CSV beside it with the
+    // extension swapped. nullptr when absent.
+    const char* GetPerfCountersPath();
+
+    // Benchmark sweep: `--bench=<filter>` (or bare `--bench` for "all"),
+    // `--bench-samples=<n>`, `--bench-warmup=<n>`, `--bench-json[=path]`. The
+    // filter is handed to Zenith_Benchmark::RunAll as-is (comma-separated
+    // categories and full names); nullptr when no sweep was asked for, in which
+    // case the other three are ignored. The json path defaults to
+    // "zenith_bench_results.json" for the bare form and is nullptr when absent.
+    // Samples are clamped to at least 1. See Core/Zenith_Benchmark.h.
+    const char* GetBenchFilter();
+    const char* GetBenchJSONPath();
+    u_int       GetBenchSamples();
+    u_int       GetBenchWarmup();
+
+    // `--heap-sample[=<mean bytes>]`: Poisson-sample allocations with their
+    // callstacks (Core/Memory/Zenith_HeapSampler.h) every <mean bytes> on
+    // average; the bare form uses the sampler's default interval. Returns 0 when
+    // absent, or when the value was malformed ("=0", "=-1", "=64k"), which is
+    // rejected with a warning rather than read as some other rate.
+    u_int64     GetHeapSampleMeanBytes();
+
     // `--unit-test-timings[=path]`: dump every registered unit test with its wall
     // clock, slowest first, at the end of the boot-time RunAllTests batch. Same
     // parse-here rationale as the boot flags — the batch runs inside Zenith_Init.
@@ -173,7 +213,7 @@ namespace Zenith_CommandLine
     //
     // Exiting here (rather than from inside RunAllTests) means the engine is fully
     // initialised, so teardown runs the normal ordered shutdown. Same run-then-exit
-    // shape as --bench-ecs.
+    // shape as --bench.
     bool IsExitAfterUnitTestsRequested();
 
     // `--indirect-count-mode=auto|native|padded|single`: the boot-time immutable
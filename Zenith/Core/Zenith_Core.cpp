@@ -41,6 +41,8 @@
 #include "Input/Zenith_Pointers.h"
 #include "Physics/Zenith_Physics.h"
 #include "Physics/Zenith_PhysicsMeshGenerator.h"
+#include "TaskSystem/Zenith_FrameGraph.h"
+#include "Profiling/Zenith_PerfCounters.h"
 
 
 void Zenith_Core::UpdateTimers()
@@ -190,120 +192,318 @@ static void PumpAutomatedTest(bool& bShouldUpdateGameLogic)
 #endif
 }
 
+// ---- Per-frame engine systems -------------------------------------------------
+// Everything between the UI input phase and the render graph runs as one
+// Zenith_FrameGraph, registered below in the order it used to run in. Each system
+// declares what it reads and writes, so the graph only serialises the pairs that
+// genuinely conflict; the rest overlap on the task system. Anything that runs ECS
+// queries stays main-thread (the query main-thread rule), so today the overlap is
+// the camera-only shadow cascade fit running alongside the snapshot rebuild.
+// Each frame's system timings and critical path go to the profiler's frame-system
+// channel (Zenith_Profiling::GetFrameSystems, and the --profiling-dump report).
+
 // Physics + scene simulation (only in Playing mode / non-tools), then tear down
 // per-frame simulated input AFTER the scene/script update has consumed it
 // (clears the mouse-wheel delta — see Zenith_InputSimulator::EndOfFrameTickComplete).
-static void UpdateGameLogic(bool bShouldUpdateGameLogic)
+static void PhysicsSystem(void*)
 {
-	if (bShouldUpdateGameLogic)
-	{
-		ZENITH_PROFILING_FUNCTION_WRAPPER(g_xEngine.Physics().Update, ZENITH_PROFILE_ZONE("Physics"), g_xEngine.Frame().GetDt());
-
-		// Scene-graph transform cache (Phase 1): sync any body that the simulation just
-		// moved into the owning Transform's cache + invalidate its subtree, BEFORE Scene
-		// Update runs animation/game logic that reads BuildModelMatrix. Must sit between
-		// Physics().Update() and Scenes().Update().
-		Zenith_SyncPhysicsTransforms();
-
-		// Immediately after the sweep, so the poses it just committed are the ones
-		// inspected: report (once per fall) any DYNAMIC body that has left the world.
-		// This is the per-body counterpart to Zenith_ValidateTerrainPhysicsBodies'
-		// whole-world check — see Zenith_FallenBodyWatch.h for why one does not
-		// substitute for the other.
-		Zenith_TickFallenBodyWatch(g_xEngine.Frame().GetDt());
-
-		ZENITH_PROFILING_FUNCTION_WRAPPER(g_xEngine.Scenes().Update, ZENITH_PROFILE_ZONE("Scene Update"), g_xEngine.Frame().GetDt());
-
-		// Optional engine-driven AI manager tick (opt-in, default off). Most games
-		// drive the AI managers from their own components in a game-specific order;
-		// a game with no such constraint opts in via Zenith_AI::SetEngineTickEnabled.
-		if (Zenith_AI::IsEngineTickEnabled())
-		{
-			ZENITH_PROFILING_FUNCTION_WRAPPER(Zenith_AI::Update, ZENITH_PROFILE_ZONE("AI Update"), g_xEngine.Frame().GetDt());
-		}
+	g_xEngine.Physics().Update(g_xEngine.Frame().GetDt());
+}
+
+// Scene-graph transform cache (Phase 1): sync any body that the simulation just
+// moved into the owning Transform's cache + invalidate its subtree, BEFORE Scene
+// Update runs animation/game logic that reads BuildModelMatrix. Must sit between
+// Physics().Update() and Scenes().Update().
+static void PhysicsTransformSyncSystem(void*)
+{
+	Zenith_SyncPhysicsTransforms();
+}
+
+// Immediately after the sweep, so the poses it just committed are the ones
+// inspected: report (once per fall) any DYNAMIC body that has left the world.
+// This is the per-body counterpart to Zenith_ValidateTerrainPhysicsBodies'
+// whole-world check — see Zenith_FallenBodyWatch.h for why one does not
+// substitute for the other.
+static void FallenBodyWatchSystem(void*)
+{
+	Zenith_TickFallenBodyWatch(g_xEngine.Frame().GetDt());
+}
+
+static void SceneUpdateSystem(void*)
+{
+	g_xEngine.Scenes().Update(g_xEngine.Frame().GetDt());
+}
+
+// Optional engine-driven AI manager tick (opt-in, default off). Most games
+// drive the AI managers from their own components in a game-specific order;
+// a game with no such constraint opts in via Zenith_AI::SetEngineTickEnabled.
+static void AIUpdateSystem(void*)
+{
+	Zenith_AI::Update(g_xEngine.Frame().GetDt());
+}
 
 #ifdef ZENITH_TOOLS
-		// AI debug visualisation, driven by the AI/* debug variables. NOT inside
-		// the IsEngineTickEnabled() branch above: most games tick the AI managers
-		// from their own components, and the panel toggles have to work for them
-		// too. Self-gating and read-only — see Zenith_AI::DebugDraw.
-		Zenith_AI::DebugDraw();
+// AI debug visualisation, driven by the AI/* debug variables. NOT gated on
+// IsEngineTickEnabled() like the AI update: most games tick the AI managers
+// from their own components, and the panel toggles have to work for them
+// too. Self-gating and read-only — see Zenith_AI::DebugDraw.
+static void AIDebugDrawSystem(void*)
+{
+	Zenith_AI::DebugDraw();
+}
 #endif
-	}
+
 #ifdef ZENITH_INPUT_SIMULATOR
+static void InputSimulatorTickCompleteSystem(void*)
+{
 	Zenith_InputSimulator::EndOfFrameTickComplete();
-#endif
 }
+#endif
 
 // Upload frame constants (windowed), then — only when submitting render work
-// (skipped during scene transitions, to avoid recording
-// against incomplete scene state) — the UI frame, the ImGui frame, and the
-// render-graph execute bracketed by the SetRenderTasksActive window (so scene
-// reads on render-worker threads know the window is open).
-static void SubmitRenderWork(bool bSubmitRenderWork)
+// (skipped during scene transitions, to avoid recording against incomplete scene
+// state) — the UI frame, the ImGui frame, and the render-graph inputs below.
+static void UploadFrameConstantsSystem(void*)
 {
 	g_xEngine.FluxGraphics().UploadFrameConstants();
+}
 
-	if (!bSubmitRenderWork) return;
-
-	// Physics debug primitives only while stopped, so play mode doesn't flood them.
-	#ifdef ZENITH_TOOLS
-	if (g_xEngine.Editor().GetEditorMode() == EditorMode::Stopped)
-	{
-		Zenith_PhysicsDebugDraw::QueueAll();
-	}
-	#endif
+#ifdef ZENITH_TOOLS
+// Physics debug primitives only while stopped, so play mode doesn't flood them.
+static void PhysicsDebugDrawSystem(void*)
+{
+	Zenith_PhysicsDebugDraw::QueueAll();
+}
+#endif
 
-	// UI frame (quad/text submission) must precede ExecuteRenderGraph, which
-	// consumes the submissions. The two-pass structure + deferred-LoadScene drain
-	// lives inside Zenith_UISystem::Update.
-	ZENITH_PROFILING_FUNCTION_WRAPPER(g_xEngine.UI().Update, ZENITH_PROFILE_ZONE("UI Update"), g_xEngine.Frame().GetDt());
+// UI frame (quad/text submission) must precede ExecuteRenderGraph, which
+// consumes the submissions. The two-pass structure + deferred-LoadScene drain
+// lives inside Zenith_UISystem::Update.
+static void UIUpdateSystem(void*)
+{
+	g_xEngine.UI().Update(g_xEngine.Frame().GetDt());
+}
 
-	// W22: ordering constraint documented on Flux_RenderGraph::Execute.
-	#ifdef ZENITH_TOOLS
-	ZENITH_PROFILING_FUNCTION_WRAPPER(g_xEngine.Editor().RenderImGuiFrame, ZENITH_PROFILE_ZONE("ImGUI"));
-	#endif
+#ifdef ZENITH_TOOLS
+// W22: ordering constraint documented on Flux_RenderGraph::Execute.
+static void ImGuiSystem(void*)
+{
+	g_xEngine.Editor().RenderImGuiFrame();
+}
+#endif
 
-	// Scene-graph snapshot (Phase 2): the renderer owns the uncullled master list and
-	// rebuilds it EXACTLY ONCE here — after UI().Update() drained deferred scene loads
-	// and after ImGui transform edits, immediately before the render-task window opens.
-	// Rebuilding here (not in a pass Prepare) means every consumer derives from the same
-	// fresh list regardless of which passes are enabled, and no entry can dangle from an
-	// entity a late scene-load destroyed. The epoch is passed explicitly.
-	ZENITH_PROFILING_FUNCTION_WRAPPER(g_xEngine.FluxRenderer().RebuildSceneSnapshot,
-		ZENITH_PROFILE_ZONE("Snapshot::Build"), g_xEngine.Scenes().GetRenderMutationEpoch(),
+// Scene-graph snapshot (Phase 2): the renderer owns the uncullled master list and
+// rebuilds it EXACTLY ONCE here — after UI().Update() drained deferred scene loads
+// and after ImGui transform edits, immediately before the render-task window opens.
+// Rebuilding here (not in a pass Prepare) means every consumer derives from the same
+// fresh list regardless of which passes are enabled, and no entry can dangle from an
+// entity a late scene-load destroyed. The epoch is passed explicitly.
+static void SnapshotBuildSystem(void*)
+{
+	g_xEngine.FluxRenderer().RebuildSceneSnapshot(g_xEngine.Scenes().GetRenderMutationEpoch(),
 		g_xEngine.FluxGraphics().GetViewProjMatrix(), g_xEngine.FluxGraphics().IsCameraValid());
+}
 
-	// Compute the sun cascade view×proj matrices here (main thread, before the render-task
-	// window) rather than in the shadow cascade-0 Prepare. Camera-derived like the snapshot
-	// frustum above, and hoisting it ahead of the render graph's Prepare phase means the unified
-	// mesh cull's Prepare — which runs earlier in topological order once the cascade passes read
-	// its cull-output buffers (Stage 2) — sees up-to-date cascade frustums. Behaviour-preserving
-	// for the non-unified shadow path: nothing consumes the matrices before the graph executes.
-	// (UpdateShadowMatrices profiles itself internally.)
-	if (Zenith_GraphicsOptions::Get().m_bShadowsEnabled)
-	{
-		g_xEngine.Shadows().UpdateShadowMatrices();
-	}
+// Compute the sun cascade view×proj matrices here (before the render-task window)
+// rather than in the shadow cascade-0 Prepare. Camera-derived like the snapshot
+// frustum above, and hoisting it ahead of the render graph's Prepare phase means the unified
+// mesh cull's Prepare — which runs earlier in topological order once the cascade passes read
+// its cull-output buffers (Stage 2) — sees up-to-date cascade frustums. Behaviour-preserving
+// for the non-unified shadow path: nothing consumes the matrices before the graph executes.
+// It reads only the uploaded camera constants and the shadow debug variables, so it is the
+// one any-thread system: it runs on a worker alongside the snapshot rebuild.
+// (UpdateShadowMatrices profiles itself internally.)
+static void ShadowMatricesSystem(void*)
+{
+	g_xEngine.Shadows().UpdateShadowMatrices();
+}
 
 #ifdef ZENITH_TOOLS
-	// Phase 3: queue the scene-graph debug overlays (world-AABB wireframes + cull stats)
-	// from the just-rebuilt snapshot, before the render graph records the Primitives pass.
+// Phase 3: queue the scene-graph debug overlays (world-AABB wireframes + cull stats)
+// from the just-rebuilt snapshot, before the render graph records the Primitives pass.
+static void SceneGraphDebugOverlaysSystem(void*)
+{
 	Zenith_SceneGraphDebug::QueueOverlays(g_xEngine.FluxRenderer().GetSceneSnapshot(),
 		g_xEngine.Scenes().GetRenderMutationEpoch());
+}
 #endif
 
-	// Stage 0 (inert): build the unified GPU-driven mesh scene (bucket topology + GPU-scene
-	// records) from the just-rebuilt snapshot, on the main thread before the render-task
-	// window opens — the same single-writer placement as the snapshot rebuild. Its
-	// RequestGraphRebuild (Stage 1+) would land before ConsumeGraphRebuildRequest at the
-	// top of ExecuteRenderGraph, giving a same-frame rebuild. Sampled by nothing until
-	// Stage 1; gated on the Render/UnifiedMesh/Enabled toggle.
+// Stage 0 (inert): build the unified GPU-driven mesh scene (bucket topology + GPU-scene
+// records) from the just-rebuilt snapshot, on the main thread before the render-task
+// window opens — the same single-writer placement as the snapshot rebuild. Its
+// RequestGraphRebuild (Stage 1+) would land before ConsumeGraphRebuildRequest at the
+// top of ExecuteRenderGraph, giving a same-frame rebuild. Sampled by nothing until
+// Stage 1; gated on the Render/UnifiedMesh/Enabled toggle.
+static void UnifiedMeshSyncSystem(void*)
+{
+	g_xEngine.FluxRenderer().SyncUnifiedBucketsFromSnapshot();
+}
+
+namespace
+{
+	struct FrameSystems
+	{
+		explicit FrameSystems(Zenith_TaskSystem& xTasks)
+			: m_xGraph(xTasks)
+		{
+		}
+
+		Zenith_FrameGraph m_xGraph;
+
+		// Systems switched on and off per frame by RunFrameSystems.
+		Zenith_Vector<u_int> m_xGameLogicSystems;
+		Zenith_Vector<u_int> m_xRenderSubmitSystems;
+		u_int m_uAIUpdate = Zenith_FrameGraph::uINVALID_SYSTEM;
+		u_int m_uPhysicsDebugDraw = Zenith_FrameGraph::uINVALID_SYSTEM;
+		u_int m_uShadowMatrices = Zenith_FrameGraph::uINVALID_SYSTEM;
+	};
+
+	// Resources are coarse on purpose: "Scene" is every scene's entities and
+	// components, so a system that runs scene queries or scripts reads or writes
+	// it as a whole. Split one only once a system that would overlap needs it.
+	void BuildFrameSystems(FrameSystems& xSystems)
 	{
-		Zenith_Profiling::ScopeZone xUnifiedSyncProfile(ZENITH_PROFILE_ZONE("UnifiedMesh::Sync"));
-		g_xEngine.FluxRenderer().SyncUnifiedBucketsFromSnapshot();
+		Zenith_FrameGraph& xGraph = xSystems.m_xGraph;
+		const Zenith_FrameResource xPhysics        = xGraph.RegisterResource("Physics");
+		const Zenith_FrameResource xScene          = xGraph.RegisterResource("Scene");
+		const Zenith_FrameResource xAI             = xGraph.RegisterResource("AI");
+		const Zenith_FrameResource xInput          = xGraph.RegisterResource("Input");
+		const Zenith_FrameResource xDebugDraw      = xGraph.RegisterResource("DebugPrimitives");
+		const Zenith_FrameResource xFrameConstants = xGraph.RegisterResource("FrameConstants");
+		const Zenith_FrameResource xUI             = xGraph.RegisterResource("UI");
+		const Zenith_FrameResource xDebugVariables = xGraph.RegisterResource("DebugVariables");
+		const Zenith_FrameResource xSnapshot       = xGraph.RegisterResource("SceneSnapshot");
+		const Zenith_FrameResource xShadows        = xGraph.RegisterResource("ShadowCascades");
+		const Zenith_FrameResource xRenderViews    = xGraph.RegisterResource("RenderViews");
+		const Zenith_FrameResource xUnifiedMesh    = xGraph.RegisterResource("UnifiedMesh");
+
+		// Game logic.
+		{
+			Zenith_FrameGraph::SystemDesc xDesc("Physics", &PhysicsSystem, nullptr);
+			xSystems.m_xGameLogicSystems.PushBack(xGraph.AddSystem(xDesc.Reads(xScene).Writes(xPhysics)));
+		}
+		{
+			Zenith_FrameGraph::SystemDesc xDesc("Physics Transform Sync", &PhysicsTransformSyncSystem, nullptr);
+			xSystems.m_xGameLogicSystems.PushBack(xGraph.AddSystem(xDesc.Reads(xPhysics).Writes(xScene)));
+		}
+		{
+			Zenith_FrameGraph::SystemDesc xDesc("Fallen Body Watch", &FallenBodyWatchSystem, nullptr);
+			xSystems.m_xGameLogicSystems.PushBack(xGraph.AddSystem(xDesc.Reads(xPhysics).Reads(xScene)));
+		}
+		{
+			// Scripts can touch anything game-side.
+			Zenith_FrameGraph::SystemDesc xDesc("Scene Update", &SceneUpdateSystem, nullptr);
+			xDesc.Reads(xInput).Writes(xScene).Writes(xPhysics).Writes(xAI).Writes(xDebugDraw);
+			xSystems.m_xGameLogicSystems.PushBack(xGraph.AddSystem(xDesc));
+		}
+		{
+			Zenith_FrameGraph::SystemDesc xDesc("AI Update", &AIUpdateSystem, nullptr);
+			xSystems.m_uAIUpdate = xGraph.AddSystem(xDesc.Writes(xAI).Writes(xScene));
+		}
+#ifdef ZENITH_TOOLS
+		{
+			Zenith_FrameGraph::SystemDesc xDesc("AI Debug Draw", &AIDebugDrawSystem, nullptr);
+			xSystems.m_xGameLogicSystems.PushBack(xGraph.AddSystem(xDesc.Reads(xAI).Reads(xScene).Writes(xDebugDraw)));
+		}
+#endif
+#ifdef ZENITH_INPUT_SIMULATOR
+		{
+			// Runs whether or not game logic did.
+			Zenith_FrameGraph::SystemDesc xDesc("Input Simulator Tick Complete", &InputSimulatorTickCompleteSystem, nullptr);
+			xGraph.AddSystem(xDesc.Writes(xInput));
+		}
+#endif
+
+		// Render submission inputs.
+		{
+			Zenith_FrameGraph::SystemDesc xDesc("Upload Frame Constants", &UploadFrameConstantsSystem, nullptr);
+			xGraph.AddSystem(xDesc.Reads(xScene).Writes(xFrameConstants));
+		}
+#ifdef ZENITH_TOOLS
+		{
+			Zenith_FrameGraph::SystemDesc xDesc("Physics Debug Draw", &PhysicsDebugDrawSystem, nullptr);
+			xSystems.m_uPhysicsDebugDraw = xGraph.AddSystem(xDesc.Reads(xPhysics).Writes(xDebugDraw));
+		}
+#endif
+		{
+			// Writes Scene: drains deferred LoadScene requests.
+			Zenith_FrameGraph::SystemDesc xDesc("UI Update", &UIUpdateSystem, nullptr);
+			xSystems.m_xRenderSubmitSystems.PushBack(xGraph.AddSystem(xDesc.Reads(xInput).Writes(xUI).Writes(xScene)));
+		}
+#ifdef ZENITH_TOOLS
+		{
+			Zenith_FrameGraph::SystemDesc xDesc("ImGUI", &ImGuiSystem, nullptr);
+			xDesc.Writes(xScene).Writes(xDebugVariables).Writes(xDebugDraw).Writes(xRenderViews);
+			xSystems.m_xRenderSubmitSystems.PushBack(xGraph.AddSystem(xDesc));
+		}
+#endif
+		{
+			Zenith_FrameGraph::SystemDesc xDesc("Snapshot::Build", &SnapshotBuildSystem, nullptr);
+			xSystems.m_xRenderSubmitSystems.PushBack(xGraph.AddSystem(xDesc.Reads(xScene).Reads(xFrameConstants).Writes(xSnapshot)));
+		}
+		{
+			// Reads Scene so a scene load drained by the UI update lands first.
+			Zenith_FrameGraph::SystemDesc xDesc("Shadow Matrices", &ShadowMatricesSystem, nullptr);
+			xDesc.Reads(xScene).Reads(xFrameConstants).Reads(xDebugVariables).Writes(xShadows).Writes(xRenderViews).AnyThread();
+			xSystems.m_uShadowMatrices = xGraph.AddSystem(xDesc);
+		}
+#ifdef ZENITH_TOOLS
+		{
+			Zenith_FrameGraph::SystemDesc xDesc("Scene Graph Debug Overlays", &SceneGraphDebugOverlaysSystem, nullptr);
+			xSystems.m_xRenderSubmitSystems.PushBack(xGraph.AddSystem(xDesc.Reads(xSnapshot).Reads(xScene).Writes(xDebugDraw)));
+		}
+#endif
+		{
+			// Writes RenderViews: the material preview controller stages its view here.
+			Zenith_FrameGraph::SystemDesc xDesc("UnifiedMesh::Sync", &UnifiedMeshSyncSystem, nullptr);
+			xSystems.m_xRenderSubmitSystems.PushBack(xGraph.AddSystem(xDesc.Reads(xSnapshot).Writes(xUnifiedMesh).Writes(xRenderViews)));
+		}
+
+		xGraph.Build();
 	}
 
+	FrameSystems& GetFrameSystems()
+	{
+		static FrameSystems ls_xSystems(g_xEngine.Tasks());
+		if (!ls_xSystems.m_xGraph.IsBuilt())
+		{
+			BuildFrameSystems(ls_xSystems);
+		}
+		return ls_xSystems;
+	}
+}
+
+static void RunFrameSystems(bool bShouldUpdateGameLogic, bool bSubmitRenderWork)
+{
+	FrameSystems& xSystems = GetFrameSystems();
+	Zenith_FrameGraph& xGraph = xSystems.m_xGraph;
+
+	for (u_int u = 0; u < xSystems.m_xGameLogicSystems.GetSize(); u++)
+	{
+		xGraph.SetSystemEnabled(xSystems.m_xGameLogicSystems.Get(u), bShouldUpdateGameLogic);
+	}
+	xGraph.SetSystemEnabled(xSystems.m_uAIUpdate, bShouldUpdateGameLogic && Zenith_AI::IsEngineTickEnabled());
+
+	for (u_int u = 0; u < xSystems.m_xRenderSubmitSystems.GetSize(); u++)
+	{
+		xGraph.SetSystemEnabled(xSystems.m_xRenderSubmitSystems.Get(u), bSubmitRenderWork);
+	}
+	xGraph.SetSystemEnabled(xSystems.m_uShadowMatrices, bSubmitRenderWork && Zenith_GraphicsOptions::Get().m_bShadowsEnabled);
+#ifdef ZENITH_TOOLS
+	xGraph.SetSystemEnabled(xSystems.m_uPhysicsDebugDraw, bSubmitRenderWork && g_xEngine.Editor().GetEditorMode() == EditorMode::Stopped);
+#endif
+
+	xGraph.Execute();
+	xGraph.PublishReport(g_xEngine.Profiling());
+}
+
+// The render-graph execute, bracketed by the SetRenderTasksActive window (so scene
+// reads on render-worker threads know the window is open). Its inputs were built
+// by RunFrameSystems.
+static void SubmitRenderWork(bool bSubmitRenderWork)
+{
+	if (!bSubmitRenderWork) return;
+
 	g_xEngine.Scenes().SetRenderTasksActive(true);
 	ExecuteRenderGraph();
 	g_xEngine.Scenes().SetRenderTasksActive(false);
@@ -336,7 +536,12 @@ static void EndFrameSubmitAndPresent(bool bSubmitRenderWork)
 #if ZENITH_MEMORY_TRACKING_ANY
 	// Feed the once-per-frame memory snapshot into the profiler's Memory tab/HUD/report.
 	// SampleFrame() is a pure counter read; PushMemorySample skips itself while paused.
-	xEngine.Profiling().PushMemorySample(Zenith_MemoryManagement::SampleFrame());
+	const Zenith_MemoryFrameSample xMemSample = Zenith_MemoryManagement::SampleFrame();
+	xEngine.Profiling().PushMemorySample(xMemSample);
+	// Same sample as perf-counter gauges so soak dumps and telemetry carry it.
+	// Per-frame allocation counts are FULL-tier only; LITE reports 0.
+	ZENITH_PERF_GAUGE_SET("Memory.TrackedBytes", xMemSample.m_ulTotalBytes);
+	ZENITH_PERF_GAUGE_SET("Memory.FrameAllocations", xMemSample.m_uFrameAllocations);
 #endif
 
 	// Boot milestone "FirstPresentSubmitted", latched below. The predicate is snapshotted
@@ -429,7 +634,7 @@ void Zenith_Core::Zenith_MainLoop()
 		ZENITH_PROFILE_ZONE("UI Input"), g_xEngine.Actions(), g_xEngine.Pointers(),
 		g_xEngine.Frame().GetDt());
 
-	UpdateGameLogic(bShouldUpdateGameLogic);
+	RunFrameSystems(bShouldUpdateGameLogic, bSubmitRenderWork);
 	SubmitRenderWork(bSubmitRenderWork);
 	EndFrameSubmitAndPresent(bSubmitRenderWork);
 
@@ -90,6 +90,8 @@
 #include "Flux/RenderViews/Flux_MaterialPreviewController.h"
 #endif
 #include "Physics/Zenith_Physics.h"
+#include "Physics/Zenith_PhysicsWorldHooks.h"
+#include "TaskSystem/Zenith_JoltJobSystem.h"
 #include "UnitTests/Zenith_UnitTests.h"
 
 #ifdef ZENITH_WINDOWS
@@ -460,6 +462,13 @@ namespace
 
 void Zenith_Engine::InitialiseRuntimeServices()
 {
+#ifdef ZENITH_WINDOWS
+	// From here on log lines are queued per thread and written by the log
+	// writer thread (Zenith.cpp). Everything before this -- static init
+	// included -- was written synchronously.
+	Zenith_LogStartAsyncWriter();
+#endif
+
 	// multithreading registry (thread-ID allocator +
 	// main-thread ID) lives on the engine now. Allocate BEFORE
 	// g_xEngine.Threading().RegisterThread(true) below, which reads
@@ -591,6 +600,13 @@ void Zenith_Engine::InitialiseRendererAndPhysics()
 	// piece of state it used to keep as Zenith_Physics::s_*.
 	Zenith_Assert(m_pxPhysics == nullptr, "Zenith_Engine::Initialise called twice without Shutdown");
 	m_pxPhysics = new Zenith_Physics();
+	// Jolt's jobs run on the engine's worker pool rather than a second thread
+	// pool of Jolt's own. Installed BEFORE Initialise, which creates the job
+	// system; Physics deletes it at Shutdown, before the task system goes down.
+	Zenith_Physics_SetJobSystemFactory([](u_int uMaxJobs, u_int uMaxBarriers) -> JPH::JobSystem*
+	{
+		return new Zenith_JoltJobSystem(g_xEngine.Tasks(), uMaxJobs, uMaxBarriers);
+	});
 	g_xEngine.Physics().Initialise();
 }
 
@@ -713,6 +729,13 @@ void Zenith_Engine::InitialiseECS()
 	{
 		Zenith_PerceptionSystem::OnEntityOwnerSceneChanged(xEntityID, xOldScene, xNewScene);
 	};
+	// Query::ForEachParallel / ForEachConst chunk the driver pool over the task
+	// system; the calling thread (main, or a worker running a system) participates
+	// and blocks until done.
+	xHooks.m_pfnRunParallelFor = [](void (*pfnRange)(void*, u_int, u_int), void* pData, u_int uCount, u_int uGrainSize)
+	{
+		g_xEngine.Tasks().ParallelFor(ZENITH_PROFILE_ZONE("ECS Query Parallel"), pfnRange, pData, uCount, uGrainSize);
+	};
 	g_xEngine.Scenes().SetRuntimeHooks(xHooks);
 
 	// Install the AI-leaf world hooks (see AI/Zenith_AIWorldHooks.h): the AI core's
@@ -1265,4 +1288,10 @@ void Zenith_Engine::Shutdown()
 	Zenith_MemoryManagement::Shutdown();
 
 	Zenith_Log(LOG_CATEGORY_CORE, "Shutdown complete");
+
+#ifdef ZENITH_WINDOWS
+	// Drains every queued line; anything logged after this (static destruction)
+	// is written synchronously again.
+	Zenith_LogStopAsyncWriter();
+#endif
 }
@@ -21,7 +21,7 @@ ZENITH_TEST(Core, BootDumpCoordinatorOnce)
 	ZENITH_ASSERT_FALSE(ClaimBootProfileDump("other.txt", bLatch), "a different path cannot re-open a claimed latch");
 
 	// The shutdown fallback is the only call site that fires on an early-exit run
-	// (--bench-ecs, --list-automated-tests). It must be able to win outright.
+	// (--bench, --list-automated-tests). It must be able to win outright.
 	bool bFallbackOnly = false;
 	ZENITH_ASSERT_TRUE(ClaimBootProfileDump("boot.txt", bFallbackOnly), "the shutdown fallback must win when it is the only caller");
 
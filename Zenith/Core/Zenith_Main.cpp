@@ -1,11 +1,19 @@
 #include "Zenith.h"
 
 #include "Core/Zenith_BenchECS.h"
+#include "Core/Zenith_BenchEngine.h"
+#include "Core/Zenith_BenchHashMap.h"
+#include "Core/Zenith_BenchMemoryPool.h"
+#include "Core/Zenith_BenchPhysics.h"
+#include "Core/Zenith_BenchTaskSystem.h"
+#include "Core/Zenith_Benchmark.h"
 #include "Core/Zenith_CommandLine.h"
 #include "Core/Zenith_Engine.h"
 #include "Core/Zenith_GraphicsOptions.h"
 #include "Core/Zenith_PlatformStdio.h"
+#include "Memory/Zenith_HeapSampler.h"
 #include "ZenithECS/Zenith_SceneSystem.h"
+#include "Profiling/Zenith_PerfCounters.h"
 #include "Profiling/Zenith_Profiling.h"
 #ifdef ZENITH_TOOLS
 // The boot artifact embeds the automation steps executed so far — frame 1 runs step 1.
@@ -43,7 +51,7 @@ static void WriteBootProfileSections(FILE* pxFile)
 // three fires first writes stdout AND the dump file exactly once:
 //   (a) the main loop, on the first iteration after the first frame completes
 //   (b) the --memory-capture loop, which exits without ever reaching the main loop
-//   (c) Zenith_FullShutdown, covering --bench-ecs / --list-automated-tests / early
+//   (c) Zenith_FullShutdown, covering --bench / --list-automated-tests / early
 //       exits -- milestones that never happened simply print as N/A.
 // Must run BEFORE Zenith_Shutdown in case (c): the profiler is gone after it.
 // The coordinator's decision half, split out so the once-only contract is testable
@@ -77,6 +85,42 @@ static void TryWriteBootProfileDump(const char* szReason)
 	}
 }
 
+// Benchmark TUs are only reached through their static registrars, which a
+// static-library link drops unless something references the object file.
+static bool ForceLinkBenchmarks()
+{
+	return Zenith_BenchECS_ForceLink()
+		&& Zenith_BenchEngine_ForceLink()
+		&& Zenith_BenchHashMap_ForceLink()
+		&& Zenith_BenchMemoryPool_ForceLink()
+		&& Zenith_BenchPhysics_ForceLink()
+		&& Zenith_BenchTaskSystem_ForceLink();
+}
+
+// --bench=<filter>: sample every selected Zenith_Benchmark registration (warmup,
+// repeated runs, median / p95 / stddev), optionally write the results file, then
+// exit through the ordered teardown. The full printed sweeps are registrations
+// too (sweep.ecs, sweep.tasks, ...), so this is the only benchmark entry point.
+// Returns without doing anything when no --bench flag was given.
+static void RunBenchmarksIfRequested()
+{
+	const char* szFilter = Zenith_CommandLine::GetBenchFilter();
+	if (szFilter == nullptr) return;
+
+	static const bool ls_bBenchmarksLinked = ForceLinkBenchmarks();
+	(void)ls_bBenchmarksLinked;
+
+	Zenith_BenchmarkOptions xOptions;
+	xOptions.m_szFilter = szFilter;
+	xOptions.m_uSampleRuns = Zenith_CommandLine::GetBenchSamples();
+	xOptions.m_uWarmupRuns = Zenith_CommandLine::GetBenchWarmup();
+	xOptions.m_szJSONPath = Zenith_CommandLine::GetBenchJSONPath();
+	const u_int uRan = Zenith_Benchmark::RunAll(xOptions);
+	Zenith_Core::Zenith_FullShutdown();
+	// A filter that selected nothing is a typo; fail so a CI job notices.
+	std::exit(uRan > 0 ? 0 : 1);
+}
+
 // Phase 0: Zenith_Init / Zenith_Shutdown bodies moved into
 // Zenith_Engine::Initialise / Shutdown (see Zenith_Engine.cpp). These
 // stay as thin forwarders so every existing caller (Android_Main.cpp,
@@ -87,7 +131,7 @@ void Zenith_Core::Zenith_Init(const Zenith_BootMarkerBundle* pxMarkers)
 
 	// Boot is over. Sealing HERE (in the shared forwarder rather than in
 	// Zenith_Main) covers Windows, Android and the automated-test driver alike, and
-	// lands before --bench-ecs / --memory-capture by construction.
+	// lands before --bench / --memory-capture by construction.
 	g_xEngine.Profiling().EndBootCapture(pxMarkers);
 }
 
@@ -109,11 +153,18 @@ void Zenith_Core::Zenith_Shutdown()
 // to call one function.
 void Zenith_Core::Zenith_FullShutdown()
 {
-	// Last chance to emit the boot artifact: the early-exit paths (--bench-ecs,
+	// Last chance to emit the boot artifact: the early-exit paths (--bench,
 	// --list-automated-tests, test-not-found) funnel through here and never reach the
 	// main loop. No-op when the dump was already written, or never requested.
 	TryWriteBootProfileDump("orderly shutdown");
 
+	// Before teardown, so the summary is the run as it ended (and headless soak
+	// runs, which never open the profiler window, still get their counters).
+	if (const char* szPerfCountersPath = Zenith_CommandLine::GetPerfCountersPath())
+	{
+		Zenith_PerfCounters::WriteDump(szPerfCountersPath);
+	}
+
 	g_xEngine.Scenes().SetMainLoopRunning(false);
 	Zenith_Shutdown();
 	delete Zenith_Window::GetInstance();
@@ -133,6 +184,16 @@ void Zenith_Core::Zenith_Main()
 	Project_SetGraphicsOptions(Zenith_GraphicsOptions::Get());
 	Zenith_CommandLine::Parse(__argc, __argv);
 
+#if ZENITH_MEMORY_TRACKING_ANY
+	// --heap-sample[=<mean bytes>]: Poisson-sample allocations with their callstacks
+	// (Zenith_HeapSampler). Before Zenith_Init so boot allocations are covered;
+	// --memory-dump then adds zenith_heap_profile.txt. LITE builds only.
+	if (const u_int64 ulHeapSampleBytes = Zenith_CommandLine::GetHeapSampleMeanBytes())
+	{
+		Zenith_HeapSampler::Enable(ulHeapSampleBytes);
+	}
+#endif
+
 	xBootMarkers.Add("WindowCreateBegin", Zenith_Profiling_Detail::GetTimestamp());
 	Zenith_Window::Initialise("Zenith", Zenith_GraphicsOptions::Get().m_uWindowWidth, Zenith_GraphicsOptions::Get().m_uWindowHeight);
 	xBootMarkers.Add("WindowCreateEnd", Zenith_Profiling_Detail::GetTimestamp());
@@ -142,26 +203,13 @@ void Zenith_Core::Zenith_Main()
 	// One reach for the whole function (the loops below hit it several times each).
 	Zenith_Profiling& xProfiling = g_xEngine.Profiling();
 
-	// --bench-ecs: run the GPU-free ECS micro-benchmark once (after engine init
-	// so the scene system / component registry are live) then exit cleanly.
-	// Mirrors the run-then-exit pattern used by --list-automated-tests: go
-	// through Zenith_FullShutdown so GPU/Jolt/audio/window resources release in
-	// the normal order, then std::exit(0). When the flag is absent, behaviour is
-	// completely unchanged.
-	for (int i = 1; i < __argc; ++i)
-	{
-		if (std::strcmp(__argv[i], "--bench-ecs") == 0)
-		{
-			Zenith_BenchECS_Run();
-			Zenith_Core::Zenith_FullShutdown();
-			std::exit(0);
-		}
-	}
+	// --bench=<filter>: run the selected Zenith_Benchmark registrations and exit.
+	RunBenchmarksIfRequested();
 
 	// --exit-after-unit-tests: the boot ZENITH_TEST batch has already run and logged
 	// its tally (it lives inside Zenith_Init, in InitialiseProject), so there is
 	// nothing left for the unit gate to wait for. Exit through the normal ordered
-	// teardown, exactly like --bench-ecs above.
+	// teardown, exactly like --bench above.
 	//
 	// This flag exists because `--exit-after-frames N` looks like it should do this
 	// and DOESN'T: it is consumed only inside Zenith_AutomatedTestRunner's Stepping
@@ -170,7 +218,7 @@ void Zenith_Core::Zenith_Main()
 	// consequently idled until its watchdog killed the process — which is why every
 	// unit-gate run cost the entire -TimeoutSec regardless of the result.
 	//
-	// Deliberately AFTER the --bench-ecs block: both are run-then-exit switches, and
+	// Deliberately AFTER the --bench block: both are run-then-exit switches, and
 	// if somebody passes both, the benchmark they explicitly asked for still runs.
 	if (Zenith_CommandLine::IsExitAfterUnitTestsRequested())
 	{
@@ -211,16 +259,19 @@ void Zenith_Core::Zenith_Main()
 	// --memory-dump: every 120 frames, dump the memory report (per-category + unified
 	// sources) to stdout, a truncated zenith_memory_dump.txt, AND a machine-readable
 	// zenith_memory_dump.csv (the feed the CI budget gate consumes). Mirrors --profiling-dump.
+	// With --heap-sample it also writes zenith_heap_profile.txt: the sampled live heap by
+	// callsite, then each site's growth since the previous dump.
 	bool bMemoryDump = false;
 	for (int i = 1; i < __argc; ++i)
 		if (std::strcmp(__argv[i], "--memory-dump") == 0) { bMemoryDump = true; break; }
 	u_int uMemoryDumpFrame = 0;
+	Zenith_HeapSnapshot xPreviousHeapSnapshot;
 
 	// --memory-capture[=N]: run N headless frames so allocations settle, dump the memory
 	// report (stdout) + the machine-readable zenith_memory_dump.csv (the CI budget-gate
 	// LIVE-mode feed), then exit cleanly through the normal teardown. Deterministic and
 	// bounded — the Tier-A capture (CPU categories + Jolt; VRAM is 0 headless). Mirrors
-	// the --bench-ecs run-then-exit pattern.
+	// the --bench run-then-exit pattern.
 	for (int i = 1; i < __argc; ++i)
 	{
 		if (std::strncmp(__argv[i], "--memory-capture", 16) == 0)
@@ -292,6 +343,22 @@ void Zenith_Core::Zenith_Main()
 				Zenith_MemoryManagement::WriteReportCSV(pxMemCsv);
 				fclose(pxMemCsv);
 			}
+			if (Zenith_HeapSampler::IsEnabled())
+			{
+				Zenith_HeapSnapshot xHeapSnapshot;
+				Zenith_HeapSampler::TakeSnapshot(xHeapSnapshot);
+				Zenith_Vector<Zenith_HeapSiteGrowth> xGrowth;
+				Zenith_HeapSampler::ComputeGrowth(xPreviousHeapSnapshot, xHeapSnapshot, xGrowth);
+				FILE* pxHeapTxt = Zenith_PlatformStdio::OpenFile("zenith_heap_profile.txt", "w");
+				if (pxHeapTxt)
+				{
+					Zenith_HeapSampler::WriteSnapshotReport(pxHeapTxt, xHeapSnapshot, 50);
+					fprintf(pxHeapTxt, "\n");
+					Zenith_HeapSampler::WriteGrowthReport(pxHeapTxt, xGrowth, 50);
+					fclose(pxHeapTxt);
+				}
+				xPreviousHeapSnapshot = std::move(xHeapSnapshot);
+			}
 		}
 #endif
 		xProfiling.EndFrame();
@@ -0,0 +1,109 @@
+// Unit tests for Zenith_Name. #included at the bottom of Zenith_Name.cpp (always
+// linked: Flux_AnimationParameters interns its parameter names through it).
+// The intern table is process-wide, so tests use names no other code interns
+// and never assume the table starts empty.
+
+#include "Collections/Zenith_HashMap.h"
+#include "DataStream/Zenith_DataStream.h"
+
+#include <thread>
+
+static_assert(Zenith_Name::HashString("") == 0, "The empty string is none");
+static_assert(Zenith_Name::HashString("a") == 0xaf63dc4c8601ec8cull, "FNV-1a 64 reference value");
+
+ZENITH_TEST(Name, CompileTimeHashMatchesRuntime)
+{
+	const Zenith_Name xCompileTime = ZENITH_NAME("NameTest_Speed");
+	const Zenith_Name xRuntime(std::string("NameTest_Speed"));
+	ZENITH_ASSERT_EQ(xCompileTime.GetID(), xRuntime.GetID(), "ZENITH_NAME and the runtime constructor disagree");
+	ZENITH_ASSERT_TRUE(xCompileTime == xRuntime);
+	ZENITH_ASSERT_TRUE(Zenith_Name::HashOnly("NameTest_Speed") == xRuntime);
+	ZENITH_ASSERT_TRUE(Zenith_Name("NameTest_Speed") == xRuntime, "const char* and std::string constructors disagree");
+	ZENITH_ASSERT_FALSE(Zenith_Name("NameTest_Sped") == xRuntime);
+}
+
+ZENITH_TEST(Name, InternedStringRoundTrips)
+{
+	const Zenith_Name xName("NameTest_RoundTrip");
+	ZENITH_ASSERT_EQ(strcmp(xName.GetString(), "NameTest_RoundTrip"), 0, "GetString returned '%s'", xName.GetString());
+	const u_int uCountBefore = Zenith_Name::GetInternedCount();
+
+	// Interning the same string again returns the same storage and adds nothing.
+	const Zenith_Name xAgain(std::string("NameTest_RoundTrip"));
+	ZENITH_ASSERT_TRUE(xAgain.GetString() == xName.GetString(), "re-interning moved the string");
+	ZENITH_ASSERT_EQ(Zenith_Name::GetInternedCount(), uCountBefore);
+}
+
+ZENITH_TEST(Name, NoneAndUninterned)
+{
+	const Zenith_Name xDefault;
+	ZENITH_ASSERT_TRUE(xDefault.IsNone());
+	ZENITH_ASSERT_EQ(xDefault.GetID(), 0ull);
+	ZENITH_ASSERT_EQ(strcmp(xDefault.GetString(), ""), 0);
+	ZENITH_ASSERT_TRUE(Zenith_Name("") == xDefault, "the empty string is not none");
+	ZENITH_ASSERT_TRUE(Zenith_Name(static_cast<const char*>(nullptr)) == xDefault, "null is not none");
+
+	// HashOnly must not take the intern path.
+	const u_int uCountBefore = Zenith_Name::GetInternedCount();
+	const Zenith_Name xHashed = Zenith_Name::HashOnly("NameTest_NeverInterned");
+	ZENITH_ASSERT_FALSE(xHashed.IsNone());
+	ZENITH_ASSERT_EQ(Zenith_Name::GetInternedCount(), uCountBefore, "HashOnly interned its string");
+	ZENITH_ASSERT_EQ(strcmp(xHashed.GetString(), "<unnamed>"), 0, "GetString returned '%s'", xHashed.GetString());
+}
+
+ZENITH_TEST(Name, WorksAsHashMapKeyAndSerialisesAsID)
+{
+	Zenith_HashMap<Zenith_Name, u_int> xMap;
+	xMap.Insert(Zenith_Name("NameTest_KeyA"), 1);
+	xMap.Insert(Zenith_Name("NameTest_KeyB"), 2);
+	ZENITH_ASSERT_EQ(xMap.Get(Zenith_Name::HashOnly("NameTest_KeyB")), 2u);
+	ZENITH_ASSERT_FALSE(xMap.Contains(Zenith_Name::HashOnly("NameTest_KeyC")));
+
+	Zenith_DataStream xStream(64);
+	xStream << Zenith_Name("NameTest_KeyA");
+	ZENITH_ASSERT_EQ(xStream.GetCursor(), static_cast<uint64_t>(sizeof(u_int64)), "Zenith_Name should serialise as its 8-byte ID");
+	xStream.SetCursor(0);
+	Zenith_Name xRead;
+	xStream >> xRead;
+	ZENITH_ASSERT_TRUE(xRead == Zenith_Name::HashOnly("NameTest_KeyA"));
+	ZENITH_ASSERT_EQ(strcmp(xRead.GetString(), "NameTest_KeyA"), 0, "ID read back does not resolve to its string");
+}
+
+ZENITH_TEST(Name, ConcurrentInterningIsStable)
+{
+	static constexpr u_int uTHREADS = 8;
+	static constexpr u_int uNAMES = 256;
+	const char* aaszSeen[uTHREADS][uNAMES] = {};
+
+	std::thread axThreads[uTHREADS];
+	for (u_int uThread = 0; uThread < uTHREADS; uThread++)
+	{
+		axThreads[uThread] = std::thread([uThread, &aaszSeen]()
+		{
+			char szName[64];
+			// Each thread walks the names from a different starting point so
+			// first-interns of the same string genuinely race.
+			for (u_int u = 0; u < uNAMES; u++)
+			{
+				const u_int uIndex = (u + uThread * 31) % uNAMES;
+				snprintf(szName, sizeof(szName), "NameTest_Concurrent_%u", uIndex);
+				aaszSeen[uThread][uIndex] = Zenith_Name(szName).GetString();
+			}
+		});
+	}
+	for (std::thread& xThread : axThreads)
+	{
+		xThread.join();
+	}
+
+	char szExpected[64];
+	for (u_int u = 0; u < uNAMES; u++)
+	{
+		snprintf(szExpected, sizeof(szExpected), "NameTest_Concurrent_%u", u);
+		ZENITH_ASSERT_EQ(strcmp(aaszSeen[0][u], szExpected), 0, "name %u interned as '%s'", u, aaszSeen[0][u]);
+		for (u_int uThread = 1; uThread < uTHREADS; uThread++)
+		{
+			ZENITH_ASSERT_TRUE(aaszSeen[uThread][u] == aaszSeen[0][u], "threads 0 and %u got different storage for name %u", uThread, u);
+		}
+	}
+}
@@ -0,0 +1,120 @@
+#include "Zenith.h"
+
+#include "Core/Zenith_Name.h"
+
+#include "Collections/Zenith_HashMap.h"
+#include "Core/Multithreading/Zenith_Multithreading.h"
+
+#include <cstring>
+
+namespace
+{
+	// ID -> interned copy of the string. Strings are packed into blocks that are
+	// never freed, so every pointer handed out stays valid for the process.
+	// Blocks come from Zenith_MemoryManagement::Allocate (untracked malloc): the
+	// table outlives the leak report by design.
+	class NameTable
+	{
+	public:
+		static constexpr size_t ulBLOCK_BYTES = 64 * 1024;
+
+		const char* Intern(u_int64 ulID, const char* szName, size_t ulLength)
+		{
+			Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xMutex);
+			if (const char* const* pszExisting = m_xStrings.TryGet(ulID))
+			{
+				Zenith_Assert(strlen(*pszExisting) == ulLength && memcmp(*pszExisting, szName, ulLength) == 0,
+					"Zenith_Name: '%.*s' and '%s' hash to the same ID %llx", static_cast<int>(ulLength), szName, *pszExisting,
+					static_cast<unsigned long long>(ulID));
+				return *pszExisting;
+			}
+
+			char* pcCopy = AllocateString(ulLength + 1);
+			memcpy(pcCopy, szName, ulLength);
+			pcCopy[ulLength] = '\0';
+			m_xStrings.Insert(ulID, pcCopy);
+			return pcCopy;
+		}
+
+		const char* Find(u_int64 ulID)
+		{
+			Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xMutex);
+			const char* const* pszString = m_xStrings.TryGet(ulID);
+			return pszString != nullptr ? *pszString : nullptr;
+		}
+
+		u_int GetCount()
+		{
+			Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xMutex);
+			return m_xStrings.GetSize();
+		}
+
+	private:
+		char* AllocateString(size_t ulBytes)
+		{
+			if (ulBytes > ulBLOCK_BYTES / 4)
+			{
+				// Long strings get their own allocation rather than wasting a block's tail.
+				return static_cast<char*>(Zenith_MemoryManagement::Allocate(ulBytes));
+			}
+			if (m_pcBlock == nullptr || m_ulBlockUsed + ulBytes > ulBLOCK_BYTES)
+			{
+				m_pcBlock = static_cast<char*>(Zenith_MemoryManagement::Allocate(ulBLOCK_BYTES));
+				m_ulBlockUsed = 0;
+			}
+			char* pcResult = m_pcBlock + m_ulBlockUsed;
+			m_ulBlockUsed += ulBytes;
+			return pcResult;
+		}
+
+		Zenith_Mutex_NoProfiling m_xMutex;
+		Zenith_HashMap<u_int64, const char*> m_xStrings;
+		char* m_pcBlock = nullptr;
+		size_t m_ulBlockUsed = 0;
+	};
+
+	// Function-local so names constructed during static initialisation work.
+	NameTable& GetNameTable()
+	{
+		static NameTable s_xTable;
+		return s_xTable;
+	}
+}
+
+Zenith_Name::Zenith_Name(const char* szName)
+{
+	const size_t ulLength = szName != nullptr ? strlen(szName) : 0;
+	m_ulID = HashString(std::string_view(szName != nullptr ? szName : "", ulLength));
+	if (m_ulID != 0)
+	{
+		GetNameTable().Intern(m_ulID, szName, ulLength);
+	}
+}
+
+Zenith_Name::Zenith_Name(const std::string& strName)
+: m_ulID(HashString(strName))
+{
+	if (m_ulID != 0)
+	{
+		GetNameTable().Intern(m_ulID, strName.c_str(), strName.size());
+	}
+}
+
+const char* Zenith_Name::GetString() const
+{
+	if (m_ulID == 0)
+	{
+		return "";
+	}
+	const char* szString = GetNameTable().Find(m_ulID);
+	return szString != nullptr ? szString : "<unnamed>";
+}
+
+u_int Zenith_Name::GetInternedCount()
+{
+	return GetNameTable().GetCount();
+}
+
+#ifdef ZENITH_TESTING
+#include "Core/Zenith_Name.Tests.inl"
+#endif
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// =============================================================================
+// Zenith_Name
+// -----------------------------------------------------------------------------
+// An interned string identifier: a 64-bit FNV-1a hash of the string, compared
+// and hashed as a single integer. Use it for names that hot code looks up by
+// key -- animation parameters, bone names, blackboard keys -- so the per-frame
+// path neither hashes nor allocates a std::string.
+//
+// Construction.
+//   ZENITH_NAME("Speed")        the hash is computed at compile time.
+//   Zenith_Name(strName)        hashes at run time and interns the string, so
+//                               GetString() can map the ID back. Use it where
+//                               names are authored or loaded.
+//   Zenith_Name::HashOnly(sz)   hashes without touching the intern table (no
+//                               lock); for looking up a name that was interned
+//                               elsewhere.
+//
+// The default-constructed name (ID 0) is "none" and equals the empty string.
+//
+// Intern table. Thread-safe, append-only, and lives for the whole process. It
+// asserts if two different strings ever hash to the same ID. GetString() is for
+// logs, the editor and debugging; it returns "" for none and "<unnamed>" for an
+// ID no one interned (e.g. one read from a stream).
+//
+// Serialisation. Zenith_Name is trivially copyable, so Zenith_DataStream writes
+// it as its raw 8-byte ID and assets can store names directly. A stream written
+// that way only round-trips the ID; write the string as well where a reader
+// needs it (tools, the editor).
+// =============================================================================
+class Zenith_Name
+{
+public:
+	static constexpr u_int64 ulFNV_OFFSET_BASIS = 0xcbf29ce484222325ull;
+	static constexpr u_int64 ulFNV_PRIME = 0x100000001b3ull;
+
+	static constexpr u_int64 HashString(std::string_view strName)
+	{
+		if (strName.empty())
+		{
+			return 0;
+		}
+		u_int64 ulHash = ulFNV_OFFSET_BASIS;
+		for (const char c : strName)
+		{
+			ulHash ^= static_cast<u_int64>(static_cast<unsigned char>(c));
+			ulHash *= ulFNV_PRIME;
+		}
+		// 0 is reserved for none.
+		return ulHash == 0 ? 1 : ulHash;
+	}
+
+	constexpr Zenith_Name() = default;
+	explicit Zenith_Name(const char* szName);
+	explicit Zenith_Name(const std::string& strName);
+
+	static constexpr Zenith_Name FromID(u_int64 ulID)
+	{
+		Zenith_Name xName;
+		xName.m_ulID = ulID;
+		return xName;
+	}
+
+	static constexpr Zenith_Name HashOnly(std::string_view strName)
+	{
+		return FromID(HashString(strName));
+	}
+
+	constexpr u_int64 GetID() const { return m_ulID; }
+	constexpr bool IsNone() const { return m_ulID == 0; }
+
+	// The interned string, or "" / "<unnamed>" (see above). The pointer stays
+	// valid for the life of the process.
+	const char* GetString() const;
+
+	constexpr bool operator==(const Zenith_Name& xOther) const { return m_ulID == xOther.m_ulID; }
+	constexpr bool operator!=(const Zenith_Name& xOther) const { return m_ulID != xOther.m_ulID; }
+	constexpr bool operator<(const Zenith_Name& xOther) const { return m_ulID < xOther.m_ulID; }
+
+	// Number of distinct interned strings (stats and tests).
+	static u_int GetInternedCount();
+
+private:
+	u_int64 m_ulID = 0;
+};
+
+static_assert(std::is_trivially_copyable<Zenith_Name>::value, "Zenith_Name is serialised as its raw ID");
+
+// Compile-time name from a string literal. Debug builds also intern the
+// literal, once per call site, so GetString() resolves it in logs.
+#ifdef ZENITH_ASSERT
+#define ZENITH_NAME(szLiteral) ([]() -> Zenith_Name { static const Zenith_Name s_xName(szLiteral); return s_xName; }())
+#else
+#define ZENITH_NAME(szLiteral) (Zenith_Name::FromID(std::integral_constant<u_int64, Zenith_Name::HashString(szLiteral)>::value))
+#endif
+
+// The ID is already a well-mixed hash.
+namespace std
+{
+	template<>
+	struct hash<Zenith_Name>
+	{
+		size_t operator()(const Zenith_Name& xName) const noexcept
+		{
+			return static_cast<size_t>(xName.GetID());
+		}
+	};
+}
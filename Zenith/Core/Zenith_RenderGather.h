@@ -2,6 +2,7 @@
 
 #include "Maths/Zenith_Maths.h"
 #include "Collections/Zenith_Vector.h"
+#include "Memory/Zenith_FrameAllocator.h" // gather lists live for one frame: Zenith_FrameVector
 #include "Core/Zenith_ParticleData.h" // neutral per-particle render data (used by the particle gather)
 
 // ---------------------------------------------------------------------------
@@ -44,7 +45,7 @@ struct Zenith_LightRenderData
 // The EC side sets this to its gatherer; Flux_DynamicLights calls it each frame.
 // Defined (and pointed at the gatherer) in the EC TU that owns the light gather,
 // so the linker pulls that TU in to resolve this symbol.
-using Zenith_LightGatherFn = void (*)(Zenith_Vector<Zenith_LightRenderData>& xOut);
+using Zenith_LightGatherFn = void (*)(Zenith_FrameVector<Zenith_LightRenderData>& xOut);
 extern Zenith_LightGatherFn g_pfnZenithLightGather;
 
 // The main camera's render inputs, resolved + extracted EC-side so Flux_Graphics
@@ -79,5 +80,5 @@ struct Zenith_ParticleEmitterRenderData
 
 // fDt is forwarded so the EC-side gatherer can drive the per-emitter particle tick (the
 // renderer used to call xEmitter.Update(fDt) itself).
-using Zenith_ParticleGatherFn = void (*)(float fDt, Zenith_Vector<Zenith_ParticleEmitterRenderData>& xOut);
+using Zenith_ParticleGatherFn = void (*)(float fDt, Zenith_FrameVector<Zenith_ParticleEmitterRenderData>& xOut);
 extern Zenith_ParticleGatherFn g_pfnZenithParticleGather;
@@ -31,7 +31,9 @@ public:
 		, m_ulDataSize(other.m_ulDataSize)
 		, m_ulCursor(other.m_ulCursor)
 		, m_pData(other.m_pData)
+		, m_xMapping(other.m_xMapping)
 	{
+		other.m_xMapping = Zenith_FileAccess::MappedFile();
 		other.m_pData = nullptr;
 		other.m_bOwnsData = false;
 		other.m_ulDataSize = 0;
@@ -43,15 +45,14 @@ public:
 	{
 		if (this != &other)
 		{
-			if (m_bOwnsData && m_pData)
-			{
-				Zenith_MemoryManagement::Deallocate(m_pData);
-			}
+			ReleaseData();
 			m_pData = other.m_pData;
+			m_xMapping = other.m_xMapping;
 			m_ulDataSize = other.m_ulDataSize;
 			m_ulCursor = other.m_ulCursor;
 			m_bOwnsData = other.m_bOwnsData;
 
+			other.m_xMapping = Zenith_FileAccess::MappedFile();
 			other.m_pData = nullptr;
 			other.m_bOwnsData = false;
 			other.m_ulDataSize = 0;
@@ -66,10 +67,7 @@ public:
 
 	~Zenith_DataStream()
 	{
-		if (m_bOwnsData && m_pData)
-		{
-			Zenith_MemoryManagement::Deallocate(m_pData);
-		}
+		ReleaseData();
 	}
 
 	void SkipBytes(const u_int uNumBytes)
@@ -106,8 +104,14 @@ public:
 		return m_bOwnsData;
 	}
 
+	// True for a stream over a MapFromFile view: read-only, writes are refused.
+	bool IsMapped() const
+	{
+		return m_xMapping.m_pcData != nullptr;
+	}
+
 	// Returns true if the stream contains valid data (non-null pointer and non-zero size)
-	// Use this after ReadFromFile() to verify the file was loaded successfully
+	// Use this after ReadFromFile() / MapFromFile() to verify the file was loaded successfully
 	bool IsValid() const
 	{
 		return m_pData != nullptr && m_ulDataSize > 0;
@@ -126,6 +130,11 @@ public:
 	void WriteData(const void* pData, uint64_t ulSize)
 	{
 		Zenith_Assert(pData != nullptr, "pData cannot be null");
+		if (IsMapped())
+		{
+			Zenith_Assert(false, "DataStream::WriteData: stream is a read-only file mapping");
+			return;
+		}
 		uint64_t ulNewCursor = m_ulCursor + ulSize;
 		while (ulNewCursor > m_ulDataSize)
 		{
@@ -178,6 +187,11 @@ public:
 	template<typename T, std::enable_if_t<std::is_trivially_copyable<T>::value, int> = 0>
 	void operator<<(const T& x)
 	{
+		if (IsMapped())
+		{
+			Zenith_Assert(false, "DataStream::operator<<: stream is a read-only file mapping");
+			return;
+		}
 		uint64_t ulNewCursor = m_ulCursor + sizeof(T);
 		while (ulNewCursor > m_ulDataSize)
 		{
@@ -363,10 +377,7 @@ public:
 		// A default-constructed stream already owns its initial write buffer.
 		// Release that allocation (or a prior file buffer) before adopting the
 		// newly-read bytes; assigning m_pData directly leaks it on every load.
-		if (m_bOwnsData && m_pData != nullptr)
-		{
-			Zenith_MemoryManagement::Deallocate(m_pData);
-		}
+		ReleaseData();
 		m_pData = pFileData;
 		m_ulDataSize = ulFileSize;
 
@@ -377,6 +388,26 @@ public:
 		m_ulCursor = 0;
 	}
 
+	// Zero-copy alternative to ReadFromFile for read-only parsing: the stream
+	// reads straight out of a Zenith_FileAccess::MapFile view, released when the
+	// stream is destroyed or reloaded. Large assets parse without a second
+	// whole-file copy on the heap. A missing file leaves the stream invalid
+	// (check IsValid()) without asserting, so callers can fall back or report.
+	void MapFromFile(const char* szFilename)
+	{
+		Zenith_Assert(szFilename != nullptr && szFilename[0] != '\0',
+			"MapFromFile: Invalid filename");
+
+		ReleaseData();
+		m_bOwnsData = false;
+		m_ulCursor = 0;
+		if (Zenith_FileAccess::MapFile(szFilename, m_xMapping))
+		{
+			m_pData = const_cast<char*>(m_xMapping.m_pcData);
+			m_ulDataSize = m_xMapping.m_ulSize;
+		}
+	}
+
 	void WriteToFile(const char* szFilename)
 	{
 		Zenith_Assert(szFilename != nullptr && szFilename[0] != '\0',
@@ -388,6 +419,18 @@ public:
 	}
 
 private:
+	// Drop whatever backs the stream: an owned buffer or a file mapping.
+	void ReleaseData()
+	{
+		if (m_bOwnsData && m_pData)
+		{
+			Zenith_MemoryManagement::Deallocate(m_pData);
+		}
+		Zenith_FileAccess::UnmapFile(m_xMapping);
+		m_pData = nullptr;
+		m_ulDataSize = 0;
+	}
+
 	void Resize()
 	{
 		if (!m_bOwnsData)
@@ -416,4 +459,5 @@ private:
 	uint64_t m_ulDataSize = 0;
 	uint64_t m_ulCursor = 0;
 	bool m_bOwnsData = false;
+	Zenith_FileAccess::MappedFile m_xMapping;
 };
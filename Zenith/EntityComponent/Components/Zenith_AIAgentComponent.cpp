@@ -155,6 +155,9 @@ void Zenith_AIAgentComponent::RenderPropertiesPanel()
 #include "AI/Navigation/Zenith_NavMeshAgent.Tests.inl"
 #include "AI/Navigation/Zenith_NavMeshGenerator.Tests.inl"
 #include "AI/Navigation/Zenith_Pathfinding.Tests.inl"
+#include "AI/Navigation/Zenith_PathSearchContext.Tests.inl"
+#include "AI/Navigation/Zenith_NavMeshHierarchy.Tests.inl"
+#include "AI/Navigation/Zenith_TiledNavMesh.Tests.inl"
 #include "AI/Perception/Zenith_PerceptionSystem.Tests.inl"
 #include "AI/Squad/Zenith_Formation.Tests.inl"
 #include "AI/Squad/Zenith_Squad.Tests.inl"
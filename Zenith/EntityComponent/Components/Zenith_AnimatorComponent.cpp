@@ -222,39 +222,39 @@ void Zenith_AnimatorComponent::OnDestroy()
 // State Machine Parameter Shortcuts
 //=============================================================================
 
-void Zenith_AnimatorComponent::SetFloat(const std::string& strName, float fValue)
+void Zenith_AnimatorComponent::SetFloat(Zenith_Name xName, float fValue)
 {
-	Controller().SetFloat(strName, fValue);
+	Controller().SetFloat(xName, fValue);
 }
 
-void Zenith_AnimatorComponent::SetInt(const std::string& strName, int32_t iValue)
+void Zenith_AnimatorComponent::SetInt(Zenith_Name xName, int32_t iValue)
 {
-	Controller().SetInt(strName, iValue);
+	Controller().SetInt(xName, iValue);
 }
 
-void Zenith_AnimatorComponent::SetBool(const std::string& strName, bool bValue)
+void Zenith_AnimatorComponent::SetBool(Zenith_Name xName, bool bValue)
 {
-	Controller().SetBool(strName, bValue);
+	Controller().SetBool(xName, bValue);
 }
 
-void Zenith_AnimatorComponent::SetTrigger(const std::string& strName)
+void Zenith_AnimatorComponent::SetTrigger(Zenith_Name xName)
 {
-	Controller().SetTrigger(strName);
+	Controller().SetTrigger(xName);
 }
 
-float Zenith_AnimatorComponent::GetFloat(const std::string& strName) const
+float Zenith_AnimatorComponent::GetFloat(Zenith_Name xName) const
 {
-	return Controller().GetFloat(strName);
+	return Controller().GetFloat(xName);
 }
 
-int32_t Zenith_AnimatorComponent::GetInt(const std::string& strName) const
+int32_t Zenith_AnimatorComponent::GetInt(Zenith_Name xName) const
 {
-	return Controller().GetInt(strName);
+	return Controller().GetInt(xName);
 }
 
-bool Zenith_AnimatorComponent::GetBool(const std::string& strName) const
+bool Zenith_AnimatorComponent::GetBool(Zenith_Name xName) const
 {
-	return Controller().GetBool(strName);
+	return Controller().GetBool(xName);
 }
 
 //=============================================================================
@@ -699,12 +699,12 @@ void Zenith_AnimatorComponent::RenderParametersSection()
 		return;
 
 	Flux_AnimationParameters& xParams = xController.GetStateMachine().GetParameters();
-	const Zenith_HashMap<std::string, Flux_AnimationParameters::Parameter>& xParamMap = xParams.GetParameters();
+	const Zenith_HashMap<Zenith_Name, Flux_AnimationParameters::Parameter>& xParamMap = xParams.GetParameters();
 
-	for (Zenith_HashMap<std::string, Flux_AnimationParameters::Parameter>::Iterator xIt(xParamMap); !xIt.Done(); xIt.Next())
+	for (Zenith_HashMap<Zenith_Name, Flux_AnimationParameters::Parameter>::Iterator xIt(xParamMap); !xIt.Done(); xIt.Next())
 	{
-		const std::string& strParamName = xIt.GetKey();
 		const Flux_AnimationParameters::Parameter& xParam = xIt.GetValue();
+		const std::string& strParamName = xParam.m_strName;
 		ImGui::PushID(strParamName.c_str());
 
 		switch (xParam.m_eType)
@@ -3,6 +3,7 @@
 #include "Maths/Zenith_Maths.h"   // Zenith_Maths::Vector3 in the IK accessor signatures
                                   // (previously pulled in transitively via the
                                   // now-removed Flux_AnimationController.h include).
+#include "Core/Zenith_Name.h"
 #include <string>
 #include <cstdint>
 
@@ -31,7 +32,7 @@ enum Flux_AnimationUpdateMode : uint8_t;
 class Zenith_ModelComponent;
 
 // Forward declarations for RegisterProperties (cycle-avoidance — see TransformComponent.h).
-template<typename T> class Zenith_Vector;
+#include "Collections/Zenith_Vector_Fwd.h"
 struct Zenith_PropertyDescriptor;
 
 //=============================================================================
@@ -103,13 +104,21 @@ public:
 	const Flux_AnimationController& GetController() const;
 
 	// ========== State Machine Parameter Shortcuts ==========
-	void SetFloat(const std::string& strName, float fValue);
-	void SetInt(const std::string& strName, int32_t iValue);
-	void SetBool(const std::string& strName, bool bValue);
-	void SetTrigger(const std::string& strName);
-	float GetFloat(const std::string& strName) const;
-	int32_t GetInt(const std::string& strName) const;
-	bool GetBool(const std::string& strName) const;
+	void SetFloat(Zenith_Name xName, float fValue);
+	void SetInt(Zenith_Name xName, int32_t iValue);
+	void SetBool(Zenith_Name xName, bool bValue);
+	void SetTrigger(Zenith_Name xName);
+	float GetFloat(Zenith_Name xName) const;
+	int32_t GetInt(Zenith_Name xName) const;
+	bool GetBool(Zenith_Name xName) const;
+
+	void SetFloat(const std::string& strName, float fValue) { SetFloat(Zenith_Name::HashOnly(strName), fValue); }
+	void SetInt(const std::string& strName, int32_t iValue) { SetInt(Zenith_Name::HashOnly(strName), iValue); }
+	void SetBool(const std::string& strName, bool bValue) { SetBool(Zenith_Name::HashOnly(strName), bValue); }
+	void SetTrigger(const std::string& strName) { SetTrigger(Zenith_Name::HashOnly(strName)); }
+	float GetFloat(const std::string& strName) const { return GetFloat(Zenith_Name::HashOnly(strName)); }
+	int32_t GetInt(const std::string& strName) const { return GetInt(Zenith_Name::HashOnly(strName)); }
+	bool GetBool(const std::string& strName) const { return GetBool(Zenith_Name::HashOnly(strName)); }
 
 	// ========== Convenience ==========
 #ifdef ZENITH_TOOLS
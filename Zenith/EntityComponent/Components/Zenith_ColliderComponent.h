@@ -23,7 +23,7 @@ class Flux_MeshGeometry;
 struct PhysicsMeshConfig;
 
 // Forward declarations for RegisterProperties (cycle-avoidance — see TransformComponent.h).
-template<typename T> class Zenith_Vector;
+#include "Collections/Zenith_Vector_Fwd.h"
 struct Zenith_PropertyDescriptor;
 
 class Zenith_ColliderComponent {
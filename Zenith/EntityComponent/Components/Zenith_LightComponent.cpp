@@ -337,7 +337,7 @@ void Zenith_LightComponent::RenderTransformOffsets()
 // ---------------------------------------------------------------------------
 static Zenith_SceneSystem& LightingScenes() { return g_xEngine.Scenes(); }
 
-static void Zenith_GatherLightsImpl(Zenith_Vector<Zenith_LightRenderData>& xOut)
+static void Zenith_GatherLightsImpl(Zenith_FrameVector<Zenith_LightRenderData>& xOut)
 {
 	LightingScenes().QueryAllScenes<Zenith_LightComponent, Zenith_TransformComponent>()
 		.ForEach([&xOut](Zenith_EntityID uID, Zenith_LightComponent& xLight, Zenith_TransformComponent&)
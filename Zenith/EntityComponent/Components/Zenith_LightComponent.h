@@ -9,7 +9,7 @@
 #endif
 
 // Forward declarations for RegisterProperties (cycle-avoidance — see TransformComponent.h).
-template<typename T> class Zenith_Vector;
+#include "Collections/Zenith_Vector_Fwd.h"
 struct Zenith_PropertyDescriptor;
 
 // Light type enumeration
@@ -10,7 +10,7 @@ class Flux_MeshInstance;
 class Flux_SkeletonInstance;
 
 // Forward declarations for RegisterProperties (cycle-avoidance — see TransformComponent.h).
-template<typename T> class Zenith_Vector;
+#include "Collections/Zenith_Vector_Fwd.h"
 struct Zenith_PropertyDescriptor;
 
 // Owns a renderable Flux_ModelInstance and nothing else. The instance is populated
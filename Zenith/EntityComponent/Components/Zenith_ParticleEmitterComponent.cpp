@@ -552,7 +552,7 @@ void Zenith_ParticleEmitterComponent::RenderPropertiesPanel()
 // have their instances built by the compute shader, so they are ticked but not
 // returned). Identical to the loop Flux_Particles used to run itself.
 // ---------------------------------------------------------------------------
-static void Zenith_GatherParticleEmittersImpl(float fDt, Zenith_Vector<Zenith_ParticleEmitterRenderData>& xOut)
+static void Zenith_GatherParticleEmittersImpl(float fDt, Zenith_FrameVector<Zenith_ParticleEmitterRenderData>& xOut)
 {
 	g_xEngine.Scenes().QueryAllScenes<Zenith_ParticleEmitterComponent>()
 		.ForEach([&xOut, fDt](Zenith_EntityID, Zenith_ParticleEmitterComponent& xEmitter)
@@ -134,8 +134,11 @@ void Zenith_TransformComponent::SetPosition(const Zenith_Maths::Vector3& xPos)
 	}
 
 	// Moving this entity changes its world matrix and every descendant's — invalidate
-	// the cached world matrices of the whole subtree (Phase 1 scene-graph cache).
+	// the cached world matrices of the whole subtree (Phase 1 scene-graph cache) and
+	// stamp the component so Query::Changed<Transform> consumers see the move. The
+	// stamp is local-pose only: descendants are not stamped.
 	Zenith_SceneData::BumpHierarchyRevision(m_xOwningEntity.GetEntityID());
+	m_xOwningEntity.MarkChanged<Zenith_TransformComponent>();
 }
 
 void Zenith_TransformComponent::SetRotation(const Zenith_Maths::Quat& xRot)
@@ -150,6 +153,7 @@ void Zenith_TransformComponent::SetRotation(const Zenith_Maths::Quat& xRot)
 	}
 
 	Zenith_SceneData::BumpHierarchyRevision(m_xOwningEntity.GetEntityID());
+	m_xOwningEntity.MarkChanged<Zenith_TransformComponent>();
 }
 
 void Zenith_TransformComponent::SetScale(const Zenith_Maths::Vector3& xScale)
@@ -173,6 +177,7 @@ void Zenith_TransformComponent::SetScale(const Zenith_Maths::Vector3& xScale)
 	// Scale changed (we early-returned above if it didn't) — invalidate this entity's
 	// subtree cached world matrices (Phase 1 scene-graph cache).
 	Zenith_SceneData::BumpHierarchyRevision(m_xOwningEntity.GetEntityID());
+	m_xOwningEntity.MarkChanged<Zenith_TransformComponent>();
 }
 
 void Zenith_TransformComponent::GetPosition(Zenith_Maths::Vector3& xPos)
@@ -248,6 +253,7 @@ void Zenith_TransformComponent::CommitPhysicsTransformToCache()
 	if (bMoved)
 	{
 		Zenith_SceneData::BumpHierarchyRevision(m_xOwningEntity.GetEntityID());
+		m_xOwningEntity.MarkChanged<Zenith_TransformComponent>();
 	}
 }
 
@@ -275,6 +281,7 @@ void Zenith_TransformComponent::SyncPhysicsPoseAndInvalidate()
 	m_xPosition = xBodyPos;
 	m_xRotation = xBodyRot;
 	Zenith_SceneData::BumpHierarchyRevision(m_xOwningEntity.GetEntityID());
+	m_xOwningEntity.MarkChanged<Zenith_TransformComponent>();
 }
 
 void Zenith_TransformComponent::BuildModelMatrix(Zenith_Maths::Matrix4& xMatOut)
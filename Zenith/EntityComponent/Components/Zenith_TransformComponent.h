@@ -7,7 +7,7 @@
 // Forward declarations for RegisterProperties() — full definition lives in
 // Zenith_ComponentMeta.h, which we cannot include here without a cycle
 // (ComponentMeta -> Scene -> SceneData -> TransformComponent).
-template<typename T> class Zenith_Vector;
+#include "Collections/Zenith_Vector_Fwd.h"
 struct Zenith_PropertyDescriptor;
 
 #ifdef ZENITH_TOOLS
@@ -101,7 +101,10 @@ namespace
 	void RunDataParallel(void (*pfnInvoke)(void*, u_int, u_int), void* pUserData, u_int uCount)
 	{
 		// Run the batch on the engine task system (calling thread joins). Used by
-		// batch pathfinding. The profile index tags the work as AI pathfinding.
+		// batch pathfinding and tiled navmesh generation. Runners claim indices
+		// from the one task, so a batch costs at most one queue entry per worker
+		// however many requests or tiles it holds. The profile index tags the
+		// task as AI pathfinding; tile work carries its own inner zone.
 		Zenith_DataParallelTask xTask(ZENITH_PROFILE_ZONE("AI Pathfinding"), pfnInvoke, pUserData, uCount, /*bCallingThreadJoins=*/true);
 		g_xEngine.Tasks().SubmitDataParallelTask(&xTask);
 		xTask.WaitUntilComplete();
@@ -367,7 +367,7 @@ namespace
 			axOut.Clear();
 			// Copy immediately - the returned pointer aliases live system
 			// storage that mutates on register/unregister.
-			if (const Zenith_Vector<Zenith_PerceivedTarget>* paxTargets
+			if (const Zenith_PerceivedTargetList* paxTargets
 				= Zenith_PerceptionSystem::GetPerceivedTargets(xAgent.GetEntityID()))
 			{
 				for (u_int u = 0; u < paxTargets->GetSize(); ++u)
@@ -45,6 +45,27 @@ namespace Zenith_FileAccess
 	// Free data returned by ReadFile
 	void FreeFileData(char* pData);
 
+	// Read-only view of a whole file, filled by MapFile. The bytes are the OS's
+	// own mapping (or, for an Android APK asset, the asset's buffer), so nothing
+	// is copied and the page cache decides what stays resident. Writing through
+	// m_pcData faults.
+	struct MappedFile
+	{
+		const char* m_pcData = nullptr;
+		uint64_t m_ulSize = 0;
+		void* m_pPlatformHandle = nullptr;	// platform bookkeeping for UnmapFile
+	};
+
+	// Map szFilename read-only into xOut. Returns false (and leaves xOut empty)
+	// if the file cannot be opened or mapped. An empty file maps successfully
+	// with m_pcData == nullptr and m_ulSize == 0. Pair with UnmapFile. Do not
+	// rewrite the file in place while it is mapped: Windows refuses the open,
+	// and on POSIX a read past a truncated end raises SIGBUS.
+	bool MapFile(const char* szFilename, MappedFile& xOut);
+
+	// Release a view from MapFile and reset xFile. Safe on an empty MappedFile.
+	void UnmapFile(MappedFile& xFile);
+
 	// Write data to file (tools-only on Android, uses filesystem)
 	void WriteFile(const char* szFilename, const void* const pData, const uint64_t ulSize);
 
@@ -11,6 +11,7 @@
 #include "Core/Zenith_RenderGather.h"
 #include "Maths/Zenith_FrustumCulling.h"
 #include "Core/Zenith_GraphicsOptions.h"
+#include "Memory/Zenith_FrameAllocator.h"
 
 #include <cmath>
 #include <algorithm>
@@ -376,7 +377,7 @@ static std::optional<PendingLight> ProcessDirectionalLightCandidate(const Zenith
 // Over the cap: priority-sort descending, keep the top uMAX_LIGHTS, then
 // stage that subset directional-first.
 static void StageLightsWithPriority(Flux_DynamicLightsImpl& xImpl, const Flux_GraphicsImpl& xFluxGraphics, u_int& uLightCount,
-	const Zenith_Vector<PendingLight>& xPending, u_int uTotal)
+	const Zenith_FrameVector<PendingLight>& xPending, u_int uTotal)
 {
 	const u_int uMAX_LIGHTS = Flux_DynamicLightsImpl::uMAX_LIGHTS;
 
@@ -466,14 +467,14 @@ void Flux_DynamicLightsImpl::GatherLightsFromScene()
 	const Zenith_Frustum& xFrustum = m_xCameraFrustum;
 
 	// Collect candidates first, then priority-sort if we exceed the cap.
-	// Single allocation per frame would be ideal — Zenith_Vector grows
-	// geometrically so amortised cost is fine for typical light counts.
-	Zenith_Vector<PendingLight> xPending;
+	// Frame memory: the reserve below is a bump in this thread's arena, not a
+	// heap round-trip every frame.
+	Zenith_FrameVector<PendingLight> xPending;
 	xPending.Reserve(uMAX_LIGHTS * 2);
 
 	// Wave 3: lights arrive from the EC-side gatherer as renderer-neutral data.
 	// The renderer keeps the intensity threshold + frustum cull + candidate build.
-	Zenith_Vector<Zenith_LightRenderData> xLights;
+	Zenith_FrameVector<Zenith_LightRenderData> xLights;
 	if (g_pfnZenithLightGather) g_pfnZenithLightGather(xLights);
 
 	for (u_int uLight = 0; uLight < xLights.GetSize(); ++uLight)
@@ -307,7 +307,7 @@ bool Flux_AnimationTexture::Export(const std::string& strPath) const
 Flux_AnimationTexture* Flux_AnimationTexture::LoadFromFile(const std::string& strPath)
 {
 	Zenith_DataStream xStream;
-	xStream.ReadFromFile(strPath.c_str());
+	xStream.MapFromFile(strPath.c_str());
 
 	if (!xStream.IsValid())
 	{
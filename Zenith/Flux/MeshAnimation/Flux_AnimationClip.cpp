@@ -12,7 +12,8 @@
 // On-disk format unchanged: uint32 count, then per key the value components then the
 // float time. Byte-identical to the former hand-rolled count+loop blocks.
 //=============================================================================
-void Flux_WriteVec3Keys(Zenith_DataStream& xStream, const Zenith_Vector<std::pair<Zenith_Maths::Vector3, float>>& xKeys)
+template<typename TKeys>
+void Flux_WriteVec3Keys(Zenith_DataStream& xStream, const TKeys& xKeys)
 {
 	xStream << static_cast<uint32_t>(xKeys.GetSize());
 	for (const auto& xKey : xKeys)
@@ -24,7 +25,8 @@ void Flux_WriteVec3Keys(Zenith_DataStream& xStream, const Zenith_Vector<std::pai
 	}
 }
 
-void Flux_ReadVec3Keys(Zenith_DataStream& xStream, Zenith_Vector<std::pair<Zenith_Maths::Vector3, float>>& xKeys)
+template<typename TKeys>
+void Flux_ReadVec3Keys(Zenith_DataStream& xStream, TKeys& xKeys)
 {
 	uint32_t uCount = 0;
 	xStream >> uCount;
@@ -41,7 +43,8 @@ void Flux_ReadVec3Keys(Zenith_DataStream& xStream, Zenith_Vector<std::pair<Zenit
 	}
 }
 
-void Flux_WriteQuatKeys(Zenith_DataStream& xStream, const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeys)
+template<typename TKeys>
+void Flux_WriteQuatKeys(Zenith_DataStream& xStream, const TKeys& xKeys)
 {
 	xStream << static_cast<uint32_t>(xKeys.GetSize());
 	for (const auto& xKey : xKeys)
@@ -54,7 +57,8 @@ void Flux_WriteQuatKeys(Zenith_DataStream& xStream, const Zenith_Vector<std::pai
 	}
 }
 
-void Flux_ReadQuatKeys(Zenith_DataStream& xStream, Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeys)
+template<typename TKeys>
+void Flux_ReadQuatKeys(Zenith_DataStream& xStream, TKeys& xKeys)
 {
 	uint32_t uCount = 0;
 	xStream >> uCount;
@@ -72,6 +76,15 @@ void Flux_ReadQuatKeys(Zenith_DataStream& xStream, Zenith_Vector<std::pair<Zenit
 	}
 }
 
+template void Flux_WriteVec3Keys(Zenith_DataStream&, const Zenith_Vector<std::pair<Zenith_Maths::Vector3, float>>&);
+template void Flux_ReadVec3Keys(Zenith_DataStream&, Zenith_Vector<std::pair<Zenith_Maths::Vector3, float>>&);
+template void Flux_WriteQuatKeys(Zenith_DataStream&, const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>&);
+template void Flux_ReadQuatKeys(Zenith_DataStream&, Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>&);
+template void Flux_WriteVec3Keys(Zenith_DataStream&, const Flux_Vec3KeyTrack&);
+template void Flux_ReadVec3Keys(Zenith_DataStream&, Flux_Vec3KeyTrack&);
+template void Flux_WriteQuatKeys(Zenith_DataStream&, const Flux_QuatKeyTrack&);
+template void Flux_ReadQuatKeys(Zenith_DataStream&, Flux_QuatKeyTrack&);
+
 //=============================================================================
 // Flux_AnimationEvent
 //=============================================================================
@@ -4,6 +4,7 @@
 #include "DataStream/Zenith_DataStream.h"
 #include "Collections/Zenith_HashMap.h"
 #include "Collections/Zenith_HashSet.h"
+#include "Collections/Zenith_InlineVector.h"
 #include "Collections/Zenith_Vector.h"
 #include <string>
 #include <functional>
@@ -20,17 +21,25 @@ class Flux_MeshGeometry;
 //=============================================================================
 // Timestamped-keyframe (value, time) vector serialization helpers.
 //
-// The MeshAnimation system stores keyframes as Zenith_Vector<std::pair<V, float>>
+// The MeshAnimation system stores keyframes as (value, time) pairs
 // (V = Vector3 for position/scale, Quat for rotation) and serializes them with the
 // recurring "uint32 count, then per key: value components then float time" block.
 // These collapse that count+loop (and the Clear/Reserve/PushBack read scaffolding)
 // to one call per vector. The on-disk format is unchanged — byte-identical to the
 // former hand-rolled loops (Vec3: x,y,z,time; Quat: w,x,y,z,time).
+//
+// TKeys is a Zenith_Vector or a bone channel's Flux_*KeyTrack; both are
+// instantiated in Flux_AnimationClip.cpp.
 //=============================================================================
-void Flux_WriteVec3Keys(Zenith_DataStream& xStream, const Zenith_Vector<std::pair<Zenith_Maths::Vector3, float>>& xKeys);
-void Flux_ReadVec3Keys (Zenith_DataStream& xStream, Zenith_Vector<std::pair<Zenith_Maths::Vector3, float>>& xKeys);
-void Flux_WriteQuatKeys(Zenith_DataStream& xStream, const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeys);
-void Flux_ReadQuatKeys (Zenith_DataStream& xStream, Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& xKeys);
+template<typename TKeys> void Flux_WriteVec3Keys(Zenith_DataStream& xStream, const TKeys& xKeys);
+template<typename TKeys> void Flux_ReadVec3Keys (Zenith_DataStream& xStream, TKeys& xKeys);
+template<typename TKeys> void Flux_WriteQuatKeys(Zenith_DataStream& xStream, const TKeys& xKeys);
+template<typename TKeys> void Flux_ReadQuatKeys (Zenith_DataStream& xStream, TKeys& xKeys);
+
+// A bone channel's keyframe tracks. Static bones carry one or two keys per
+// track, so those stay inside the channel; only animated tracks allocate.
+using Flux_Vec3KeyTrack = Zenith_InlineVector<std::pair<Zenith_Maths::Vector3, float>, 2>;
+using Flux_QuatKeyTrack = Zenith_InlineVector<std::pair<Zenith_Maths::Quat, float>, 2>;
 
 //=============================================================================
 // Animation Event
@@ -74,9 +83,9 @@ public:
 	bool HasScaleKeyframes() const { return m_xScales.GetSize() != 0; }
 
 	// Get keyframe data for export
-	const Zenith_Vector<std::pair<Zenith_Maths::Vector3, float>>& GetPositionKeyframes() const { return m_xPositions; }
-	const Zenith_Vector<std::pair<Zenith_Maths::Quat, float>>& GetRotationKeyframes() const { return m_xRotations; }
-	const Zenith_Vector<std::pair<Zenith_Maths::Vector3, float>>& GetScaleKeyframes() const { return m_xScales; }
+	const Flux_Vec3KeyTrack& GetPositionKeyframes() const { return m_xPositions; }
+	const Flux_QuatKeyTrack& GetRotationKeyframes() const { return m_xRotations; }
+	const Flux_Vec3KeyTrack& GetScaleKeyframes() const { return m_xScales; }
 
 	void WriteToDataStream(Zenith_DataStream& xStream) const;
 	void ReadFromDataStream(Zenith_DataStream& xStream);
@@ -105,9 +114,9 @@ private:
 	std::string m_strBoneName;
 
 	// Keyframes stored as (value, timestamp) pairs
-	Zenith_Vector<std::pair<Zenith_Maths::Vector3, float>> m_xPositions;
-	Zenith_Vector<std::pair<Zenith_Maths::Quat, float>> m_xRotations;
-	Zenith_Vector<std::pair<Zenith_Maths::Vector3, float>> m_xScales;
+	Flux_Vec3KeyTrack m_xPositions;
+	Flux_QuatKeyTrack m_xRotations;
+	Flux_Vec3KeyTrack m_xScales;
 };
 
 //=============================================================================
@@ -151,15 +151,25 @@ public:
 	void SetUpdateMode(Flux_AnimationUpdateMode eMode) { m_eUpdateMode = eMode; }
 	Flux_AnimationUpdateMode GetUpdateMode() const { return m_eUpdateMode; }
 
-	// State machine parameter shortcuts
-	void SetFloat(const std::string& strName, float fValue);
-	void SetInt(const std::string& strName, int32_t iValue);
-	void SetBool(const std::string& strName, bool bValue);
-	void SetTrigger(const std::string& strName);
-
-	float GetFloat(const std::string& strName) const;
-	int32_t GetInt(const std::string& strName) const;
-	bool GetBool(const std::string& strName) const;
+	// State machine parameter shortcuts. Pass a ZENITH_NAME / cached
+	// Zenith_Name from per-frame code; the string forms hash on every call.
+	void SetFloat(Zenith_Name xName, float fValue);
+	void SetInt(Zenith_Name xName, int32_t iValue);
+	void SetBool(Zenith_Name xName, bool bValue);
+	void SetTrigger(Zenith_Name xName);
+
+	float GetFloat(Zenith_Name xName) const;
+	int32_t GetInt(Zenith_Name xName) const;
+	bool GetBool(Zenith_Name xName) const;
+
+	void SetFloat(const std::string& strName, float fValue) { SetFloat(Zenith_Name::HashOnly(strName), fValue); }
+	void SetInt(const std::string& strName, int32_t iValue) { SetInt(Zenith_Name::HashOnly(strName), iValue); }
+	void SetBool(const std::string& strName, bool bValue) { SetBool(Zenith_Name::HashOnly(strName), bValue); }
+	void SetTrigger(const std::string& strName) { SetTrigger(Zenith_Name::HashOnly(strName)); }
+
+	float GetFloat(const std::string& strName) const { return GetFloat(Zenith_Name::HashOnly(strName)); }
+	int32_t GetInt(const std::string& strName) const { return GetInt(Zenith_Name::HashOnly(strName)); }
+	bool GetBool(const std::string& strName) const { return GetBool(Zenith_Name::HashOnly(strName)); }
 
 	// IK target shortcuts
 	void SetIKTarget(const std::string& strChainName, const Zenith_Maths::Vector3& xPosition, float fWeight = 1.0f);
@@ -292,43 +302,43 @@ private:
 //=============================================================================
 // Inline implementations
 //=============================================================================
-inline void Flux_AnimationController::SetFloat(const std::string& strName, float fValue)
+inline void Flux_AnimationController::SetFloat(Zenith_Name xName, float fValue)
 {
 	if (m_pxStateMachine)
-		m_pxStateMachine->GetParameters().SetFloat(strName, fValue);
+		m_pxStateMachine->GetParameters().SetFloat(xName, fValue);
 }
 
-inline void Flux_AnimationController::SetInt(const std::string& strName, int32_t iValue)
+inline void Flux_AnimationController::SetInt(Zenith_Name xName, int32_t iValue)
 {
 	if (m_pxStateMachine)
-		m_pxStateMachine->GetParameters().SetInt(strName, iValue);
+		m_pxStateMachine->GetParameters().SetInt(xName, iValue);
 }
 
-inline void Flux_AnimationController::SetBool(const std::string& strName, bool bValue)
+inline void Flux_AnimationController::SetBool(Zenith_Name xName, bool bValue)
 {
 	if (m_pxStateMachine)
-		m_pxStateMachine->GetParameters().SetBool(strName, bValue);
+		m_pxStateMachine->GetParameters().SetBool(xName, bValue);
 }
 
-inline void Flux_AnimationController::SetTrigger(const std::string& strName)
+inline void Flux_AnimationController::SetTrigger(Zenith_Name xName)
 {
 	if (m_pxStateMachine)
-		m_pxStateMachine->GetParameters().SetTrigger(strName);
+		m_pxStateMachine->GetParameters().SetTrigger(xName);
 }
 
-inline float Flux_AnimationController::GetFloat(const std::string& strName) const
+inline float Flux_AnimationController::GetFloat(Zenith_Name xName) const
 {
-	return m_pxStateMachine ? m_pxStateMachine->GetParameters().GetFloat(strName) : 0.0f;
+	return m_pxStateMachine ? m_pxStateMachine->GetParameters().GetFloat(xName) : 0.0f;
 }
 
-inline int32_t Flux_AnimationController::GetInt(const std::string& strName) const
+inline int32_t Flux_AnimationController::GetInt(Zenith_Name xName) const
 {
-	return m_pxStateMachine ? m_pxStateMachine->GetParameters().GetInt(strName) : 0;
+	return m_pxStateMachine ? m_pxStateMachine->GetParameters().GetInt(xName) : 0;
 }
 
-inline bool Flux_AnimationController::GetBool(const std::string& strName) const
+inline bool Flux_AnimationController::GetBool(Zenith_Name xName) const
 {
-	return m_pxStateMachine ? m_pxStateMachine->GetParameters().GetBool(strName) : false;
+	return m_pxStateMachine ? m_pxStateMachine->GetParameters().GetBool(xName) : false;
 }
 
 inline void Flux_AnimationController::SetIKTarget(const std::string& strChainName,
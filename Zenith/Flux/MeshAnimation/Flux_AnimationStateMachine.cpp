@@ -59,7 +59,7 @@ void Flux_AnimationParameters::AddFloat(const std::string& strName, float fDefau
 	xParam.m_eType = ParamType::Float;
 	xParam.m_strName = strName;
 	xParam.m_fValue = fDefault;
-	m_xParameters[strName] = xParam;
+	m_xParameters[Zenith_Name(strName)] = xParam;
 }
 
 void Flux_AnimationParameters::AddInt(const std::string& strName, int32_t iDefault)
@@ -68,7 +68,7 @@ void Flux_AnimationParameters::AddInt(const std::string& strName, int32_t iDefau
 	xParam.m_eType = ParamType::Int;
 	xParam.m_strName = strName;
 	xParam.m_iValue = iDefault;
-	m_xParameters[strName] = xParam;
+	m_xParameters[Zenith_Name(strName)] = xParam;
 }
 
 void Flux_AnimationParameters::AddBool(const std::string& strName, bool bDefault)
@@ -77,7 +77,7 @@ void Flux_AnimationParameters::AddBool(const std::string& strName, bool bDefault
 	xParam.m_eType = ParamType::Bool;
 	xParam.m_strName = strName;
 	xParam.m_bValue = bDefault;
-	m_xParameters[strName] = xParam;
+	m_xParameters[Zenith_Name(strName)] = xParam;
 }
 
 void Flux_AnimationParameters::AddTrigger(const std::string& strName)
@@ -86,72 +86,72 @@ void Flux_AnimationParameters::AddTrigger(const std::string& strName)
 	xParam.m_eType = ParamType::Trigger;
 	xParam.m_strName = strName;
 	xParam.m_bValue = false;
-	m_xParameters[strName] = xParam;
+	m_xParameters[Zenith_Name(strName)] = xParam;
 }
 
-void Flux_AnimationParameters::SetFloat(const std::string& strName, float fValue)
+void Flux_AnimationParameters::SetFloat(Zenith_Name xName, float fValue)
 {
-	Parameter* pxParam = m_xParameters.TryGet(strName);
+	Parameter* pxParam = m_xParameters.TryGet(xName);
 	if (pxParam && pxParam->m_eType == ParamType::Float)
 		pxParam->m_fValue = fValue;
 }
 
-void Flux_AnimationParameters::SetInt(const std::string& strName, int32_t iValue)
+void Flux_AnimationParameters::SetInt(Zenith_Name xName, int32_t iValue)
 {
-	Parameter* pxParam = m_xParameters.TryGet(strName);
+	Parameter* pxParam = m_xParameters.TryGet(xName);
 	if (pxParam && pxParam->m_eType == ParamType::Int)
 		pxParam->m_iValue = iValue;
 }
 
-void Flux_AnimationParameters::SetBool(const std::string& strName, bool bValue)
+void Flux_AnimationParameters::SetBool(Zenith_Name xName, bool bValue)
 {
-	Parameter* pxParam = m_xParameters.TryGet(strName);
+	Parameter* pxParam = m_xParameters.TryGet(xName);
 	if (pxParam && pxParam->m_eType == ParamType::Bool)
 		pxParam->m_bValue = bValue;
 }
 
-void Flux_AnimationParameters::SetTrigger(const std::string& strName)
+void Flux_AnimationParameters::SetTrigger(Zenith_Name xName)
 {
-	Parameter* pxParam = m_xParameters.TryGet(strName);
+	Parameter* pxParam = m_xParameters.TryGet(xName);
 	if (pxParam && pxParam->m_eType == ParamType::Trigger)
 		pxParam->m_bValue = true;
 }
 
-float Flux_AnimationParameters::GetFloat(const std::string& strName) const
+float Flux_AnimationParameters::GetFloat(Zenith_Name xName) const
 {
-	const Parameter* pxParam = m_xParameters.TryGet(strName);
+	const Parameter* pxParam = m_xParameters.TryGet(xName);
 	if (pxParam && pxParam->m_eType == ParamType::Float)
 		return pxParam->m_fValue;
 	return 0.0f;
 }
 
-int32_t Flux_AnimationParameters::GetInt(const std::string& strName) const
+int32_t Flux_AnimationParameters::GetInt(Zenith_Name xName) const
 {
-	const Parameter* pxParam = m_xParameters.TryGet(strName);
+	const Parameter* pxParam = m_xParameters.TryGet(xName);
 	if (pxParam && pxParam->m_eType == ParamType::Int)
 		return pxParam->m_iValue;
 	return 0;
 }
 
-bool Flux_AnimationParameters::GetBool(const std::string& strName) const
+bool Flux_AnimationParameters::GetBool(Zenith_Name xName) const
 {
-	const Parameter* pxParam = m_xParameters.TryGet(strName);
+	const Parameter* pxParam = m_xParameters.TryGet(xName);
 	if (pxParam && pxParam->m_eType == ParamType::Bool)
 		return pxParam->m_bValue;
 	return false;
 }
 
-bool Flux_AnimationParameters::PeekTrigger(const std::string& strName) const
+bool Flux_AnimationParameters::PeekTrigger(Zenith_Name xName) const
 {
-	const Parameter* pxParam = m_xParameters.TryGet(strName);
+	const Parameter* pxParam = m_xParameters.TryGet(xName);
 	if (pxParam && pxParam->m_eType == ParamType::Trigger)
 		return pxParam->m_bValue;
 	return false;
 }
 
-bool Flux_AnimationParameters::ConsumeTrigger(const std::string& strName)
+bool Flux_AnimationParameters::ConsumeTrigger(Zenith_Name xName)
 {
-	Parameter* pxParam = m_xParameters.TryGet(strName);
+	Parameter* pxParam = m_xParameters.TryGet(xName);
 	if (pxParam && pxParam->m_eType == ParamType::Trigger)
 	{
 		bool bWasSet = pxParam->m_bValue;
@@ -161,14 +161,14 @@ bool Flux_AnimationParameters::ConsumeTrigger(const std::string& strName)
 	return false;
 }
 
-bool Flux_AnimationParameters::HasParameter(const std::string& strName) const
+bool Flux_AnimationParameters::HasParameter(Zenith_Name xName) const
 {
-	return m_xParameters.Contains(strName);
+	return m_xParameters.Contains(xName);
 }
 
 Flux_AnimationParameters::ParamType Flux_AnimationParameters::GetParameterType(const std::string& strName) const
 {
-	const Parameter* pxParam = m_xParameters.TryGet(strName);
+	const Parameter* pxParam = m_xParameters.TryGet(Zenith_Name::HashOnly(strName));
 	if (pxParam)
 		return pxParam->m_eType;
 	return ParamType::Float;
@@ -176,12 +176,12 @@ Flux_AnimationParameters::ParamType Flux_AnimationParameters::GetParameterType(c
 
 void Flux_AnimationParameters::RemoveParameter(const std::string& strName)
 {
-	m_xParameters.Remove(strName);
+	m_xParameters.Remove(Zenith_Name::HashOnly(strName));
 }
 
 void Flux_AnimationParameters::ResetTriggers()
 {
-	for (Zenith_HashMap<std::string, Parameter>::Iterator xIt(m_xParameters); !xIt.Done(); xIt.Next())
+	for (Zenith_HashMap<Zenith_Name, Parameter>::Iterator xIt(m_xParameters); !xIt.Done(); xIt.Next())
 	{
 		Parameter& xParam = xIt.GetValueMutable();
 		if (xParam.m_eType == ParamType::Trigger)
@@ -228,7 +228,7 @@ void Flux_AnimationParameters::WriteToDataStream(Zenith_DataStream& xStream) con
 	uint32_t uNumParams = static_cast<uint32_t>(m_xParameters.GetSize());
 	xStream << uNumParams;
 
-	for (Zenith_HashMap<std::string, Parameter>::Iterator xIt(m_xParameters); !xIt.Done(); xIt.Next())
+	for (Zenith_HashMap<Zenith_Name, Parameter>::Iterator xIt(m_xParameters); !xIt.Done(); xIt.Next())
 	{
 		const Parameter& xParam = xIt.GetValue();
 		xStream << xParam.m_strName;
@@ -263,29 +263,35 @@ void Flux_AnimationParameters::ReadFromDataStream(Zenith_DataStream& xStream)
 		xParam.m_eType = static_cast<ParamType>(uType);
 		ReadParamValueFromStream(xStream, xParam.m_eType, xParam.m_fValue, xParam.m_iValue, xParam.m_bValue);
 
-		m_xParameters[xParam.m_strName] = xParam;
+		m_xParameters[Zenith_Name(xParam.m_strName)] = xParam;
 	}
 }
 
 //=============================================================================
 // Flux_TransitionCondition
 //=============================================================================
+void Flux_TransitionCondition::SetParameterName(const std::string& strName)
+{
+	m_strParameterName = strName;
+	m_xParameterName = Zenith_Name(strName);
+}
+
 bool Flux_TransitionCondition::Evaluate(const Flux_AnimationParameters& xParams) const
 {
-	if (!xParams.HasParameter(m_strParameterName))
+	if (!xParams.HasParameter(m_xParameterName))
 		return false;
 
 	switch (m_eParamType)
 	{
 	case Flux_AnimationParameters::ParamType::Float:
-		return CompareNumericValues(xParams.GetFloat(m_strParameterName), m_fThreshold, m_eCompareOp);
+		return CompareNumericValues(xParams.GetFloat(m_xParameterName), m_fThreshold, m_eCompareOp);
 
 	case Flux_AnimationParameters::ParamType::Int:
-		return CompareNumericValues(xParams.GetInt(m_strParameterName), m_iThreshold, m_eCompareOp);
+		return CompareNumericValues(xParams.GetInt(m_xParameterName), m_iThreshold, m_eCompareOp);
 
 	case Flux_AnimationParameters::ParamType::Bool:
 	{
-		bool bValue = xParams.GetBool(m_strParameterName);
+		bool bValue = xParams.GetBool(m_xParameterName);
 		switch (m_eCompareOp)
 		{
 		case CompareOp::Equal:    return bValue == m_bThreshold;
@@ -299,7 +305,7 @@ bool Flux_TransitionCondition::Evaluate(const Flux_AnimationParameters& xParams)
 	{
 		// Only peek at trigger value - consumption happens in CanTransition
 		// after ALL conditions pass, to avoid losing triggers on partial matches
-		return xParams.PeekTrigger(m_strParameterName);
+		return xParams.PeekTrigger(m_xParameterName);
 	}
 	}
 
@@ -316,7 +322,9 @@ void Flux_TransitionCondition::WriteToDataStream(Zenith_DataStream& xStream) con
 
 void Flux_TransitionCondition::ReadFromDataStream(Zenith_DataStream& xStream)
 {
-	xStream >> m_strParameterName;
+	std::string strName;
+	xStream >> strName;
+	SetParameterName(strName);
 
 	uint8_t uOp = 0, uType = 0;
 	xStream >> uOp;
@@ -350,7 +358,7 @@ bool Flux_StateTransition::CanTransition(Flux_AnimationParameters& xParams,
 	for (Zenith_Vector<Flux_TransitionCondition>::Iterator xIt(m_xConditions); !xIt.Done(); xIt.Next())
 	{
 		if (xIt.GetData().m_eParamType == Flux_AnimationParameters::ParamType::Trigger)
-			xParams.ConsumeTrigger(xIt.GetData().m_strParameterName);
+			xParams.ConsumeTrigger(xIt.GetData().GetParameterID());
 	}
 
 	return true;
@@ -2,6 +2,7 @@
 #include "Flux_BonePose.h"
 #include "Flux_BlendTree.h"
 #include "Collections/Zenith_HashMap.h"
+#include "Core/Zenith_Name.h"
 #include <variant>
 
 // Callback typedefs for state lifecycle hooks (replaces std::function)
@@ -16,6 +17,9 @@ class Flux_AnimationStateMachine;
 //=============================================================================
 // Flux_AnimationParameters
 // Container for animation parameters (floats, ints, bools, triggers)
+// Keyed by Zenith_Name. The std::string overloads hash the name without
+// interning it; per-frame callers can pass a ZENITH_NAME / cached Zenith_Name
+// and skip the hash as well.
 //=============================================================================
 class Flux_AnimationParameters
 {
@@ -49,31 +53,41 @@ public:
 	void AddTrigger(const std::string& strName);
 
 	// Setters
-	void SetFloat(const std::string& strName, float fValue);
-	void SetInt(const std::string& strName, int32_t iValue);
-	void SetBool(const std::string& strName, bool bValue);
-	void SetTrigger(const std::string& strName);
+	void SetFloat(Zenith_Name xName, float fValue);
+	void SetInt(Zenith_Name xName, int32_t iValue);
+	void SetBool(Zenith_Name xName, bool bValue);
+	void SetTrigger(Zenith_Name xName);
+	void SetFloat(const std::string& strName, float fValue) { SetFloat(Zenith_Name::HashOnly(strName), fValue); }
+	void SetInt(const std::string& strName, int32_t iValue) { SetInt(Zenith_Name::HashOnly(strName), iValue); }
+	void SetBool(const std::string& strName, bool bValue) { SetBool(Zenith_Name::HashOnly(strName), bValue); }
+	void SetTrigger(const std::string& strName) { SetTrigger(Zenith_Name::HashOnly(strName)); }
 
 	// Getters
-	float GetFloat(const std::string& strName) const;
-	int32_t GetInt(const std::string& strName) const;
-	bool GetBool(const std::string& strName) const;
+	float GetFloat(Zenith_Name xName) const;
+	int32_t GetInt(Zenith_Name xName) const;
+	bool GetBool(Zenith_Name xName) const;
+	float GetFloat(const std::string& strName) const { return GetFloat(Zenith_Name::HashOnly(strName)); }
+	int32_t GetInt(const std::string& strName) const { return GetInt(Zenith_Name::HashOnly(strName)); }
+	bool GetBool(const std::string& strName) const { return GetBool(Zenith_Name::HashOnly(strName)); }
 
 	// Check if trigger is set without consuming it
-	bool PeekTrigger(const std::string& strName) const;
+	bool PeekTrigger(Zenith_Name xName) const;
+	bool PeekTrigger(const std::string& strName) const { return PeekTrigger(Zenith_Name::HashOnly(strName)); }
 
 	// Trigger consumption (returns true if trigger was set, then resets it)
-	bool ConsumeTrigger(const std::string& strName);
+	bool ConsumeTrigger(Zenith_Name xName);
+	bool ConsumeTrigger(const std::string& strName) { return ConsumeTrigger(Zenith_Name::HashOnly(strName)); }
 
 	// Check if parameter exists
-	bool HasParameter(const std::string& strName) const;
+	bool HasParameter(Zenith_Name xName) const;
+	bool HasParameter(const std::string& strName) const { return HasParameter(Zenith_Name::HashOnly(strName)); }
 	ParamType GetParameterType(const std::string& strName) const;
 
 	// Remove parameter
 	void RemoveParameter(const std::string& strName);
 
-	// Get all parameters
-	const Zenith_HashMap<std::string, Parameter>& GetParameters() const { return m_xParameters; }
+	// Get all parameters (the display name is Parameter::m_strName)
+	const Zenith_HashMap<Zenith_Name, Parameter>& GetParameters() const { return m_xParameters; }
 
 	// Reset all triggers (called at end of frame)
 	void ResetTriggers();
@@ -87,7 +101,7 @@ public:
 	static void ReadParamValueFromStream(Zenith_DataStream& xStream, ParamType eType, float& fVal, int32_t& iVal, bool& bVal);
 
 private:
-	Zenith_HashMap<std::string, Parameter> m_xParameters;
+	Zenith_HashMap<Zenith_Name, Parameter> m_xParameters;
 };
 
 //=============================================================================
@@ -106,7 +120,6 @@ struct Flux_TransitionCondition
 		LessEqual
 	};
 
-	std::string m_strParameterName;
 	CompareOp m_eCompareOp = CompareOp::Equal;
 	Flux_AnimationParameters::ParamType m_eParamType = Flux_AnimationParameters::ParamType::Float;
 
@@ -119,12 +132,22 @@ struct Flux_TransitionCondition
 
 	Flux_TransitionCondition() : m_fThreshold(0.0f) {}
 
+	// The parameter this condition reads. The name is interned once here, so
+	// evaluating the condition every frame never hashes the string.
+	void SetParameterName(const std::string& strName);
+	const std::string& GetParameterName() const { return m_strParameterName; }
+	Zenith_Name GetParameterID() const { return m_xParameterName; }
+
 	// Evaluate this condition against parameter values
 	bool Evaluate(const Flux_AnimationParameters& xParams) const;
 
 	// Serialization
 	void WriteToDataStream(Zenith_DataStream& xStream) const;
 	void ReadFromDataStream(Zenith_DataStream& xStream);
+
+private:
+	std::string m_strParameterName;
+	Zenith_Name m_xParameterName;
 };
 
 //=============================================================================
@@ -492,7 +492,12 @@ void Flux_MeshGeometry::LoadFromFile(const char* szPath, Flux_MeshGeometry& xGeo
 {
 	Zenith_Profiling::ScopeZone xProfileScope(ZENITH_PROFILE_ZONE("Flux Mesh Geometry Load From File"));
 	Zenith_DataStream xStream;
-	xStream.ReadFromFile(szPath);
+	xStream.MapFromFile(szPath);
+	if (!xStream.IsValid())
+	{
+		Zenith_Error(LOG_CATEGORY_MESH, "Flux_MeshGeometry::LoadFromFile: failed to read '%s'", szPath);
+		return;
+	}
 
 	xStream >> xGeometryOut.m_xBufferLayout.GetElements();
 	xGeometryOut.m_xBufferLayout.CalculateOffsetsAndStrides();
@@ -143,7 +143,10 @@ void Flux_ParticlesImpl::UpdateEmittersAndBuildInstanceBuffer(float fDt)
 	// QueueSpawn calls PreExecuteCompute drains a few lines later in Render — so it
 	// runs whenever EITHER path is enabled, and only the instance BUILD below is
 	// gated on the CPU option.
-	Zenith_Vector<Zenith_ParticleEmitterRenderData> xEmitters;
+	//
+	// The list is rebuilt every frame and dropped at the end of this call, so its
+	// buffer is frame memory rather than a heap round-trip.
+	Zenith_FrameVector<Zenith_ParticleEmitterRenderData> xEmitters;
 	if (g_pfnZenithParticleGather) g_pfnZenithParticleGather(fDt, xEmitters);
 
 	if (!Zenith_GraphicsOptions::Get().m_bCPUParticlesEnabled)
@@ -12,6 +12,7 @@
 // compute commands; UploadFrustumPlanesForFrame extracts the camera frustum).
 #include "Flux/Flux_GraphicsImpl.h" // FluxGraphics().GetCameraPosition() in UploadFrustumPlanesForFrame
 #include "Maths/Zenith_FrustumCulling.h"
+#include "Profiling/Zenith_PerfCounters.h"
 #include <algorithm>
 #include <fstream>
 #include <limits>
@@ -970,6 +971,8 @@ Flux_TerrainStreamInResult Flux_TerrainStreamingManagerImpl::StreamInLOD(Flux_Te
 		ulIndexDataSize,
 		ulIndexOffsetBytes
 	);
+	ZENITH_PERF_COUNTER_ADD("Terrain.BytesStreamed", ulVertexDataSize + ulIndexDataSize);
+	ZENITH_PERF_COUNTER_ADD("Terrain.ChunksStreamedIn", 1);
 
 	// Update residency
 	Flux_TerrainChunkResidency& xResidency = xState.m_axChunkResidency[uChunkIndex];
@@ -995,6 +998,7 @@ void Flux_TerrainStreamingManagerImpl::EvictLOD(Flux_TerrainStreamingState& xSta
 
 	if (xResidency.m_aeStates[uLODLevel] != Flux_TerrainLODResidencyState::RESIDENT)
 		return;
+	ZENITH_PERF_COUNTER_ADD("Terrain.ChunksEvicted", 1);
 
 	// Free allocations (convert absolute to relative offsets). LOW-LOD counts
 	// now live on the state itself (Wave-18 relocation).
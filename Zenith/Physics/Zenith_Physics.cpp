@@ -9,6 +9,8 @@
 #include "Physics/Zenith_Physics.h"
 #include "Physics/Zenith_PhysicsMeshGenerator.h"
 #include "Physics/Zenith_PhysicsWorldHooks.h"
+#include "Profiling/Zenith_PerfCounters.h"
+#include "Profiling/Zenith_Profiling.h"
 #include "ZenithECS/Zenith_ComponentMeta.h"
 #include "ZenithECS/Zenith_SceneSystem.h"
 #include "ZenithECS/Zenith_Scene.h"
@@ -360,6 +362,7 @@ void QueueCollisionEventInternal(Zenith_EntityID xEntityID1, Zenith_EntityID xEn
 	if (xSelf.m_xDeferredEvents.GetSize() >= uMAX_DEFERRED_COLLISION_EVENTS)
 	{
 		xSelf.m_uDroppedEventCount++;
+		ZENITH_PERF_COUNTER_ADD("Physics.DroppedCollisionEvents", 1);
 		Zenith_Assert(false, "Deferred collision event queue overflow (%u events) - events are being dropped", uMAX_DEFERRED_COLLISION_EVENTS);
 		return;
 	}
@@ -462,20 +465,31 @@ void Zenith_Physics::Initialise()
 
 	m_pxTempAllocator = new JPH::TempAllocatorImpl(10 * 1024 * 1024);
 
-	// Ensure we have at least 1 worker thread to avoid deadlock
-	// Jolt Physics requires worker threads to process physics jobs
-	uint32_t uNumThreads = std::max(1u, std::thread::hardware_concurrency() - 1);
-	m_pxJobSystem = new JPH::JobSystemThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, uNumThreads);
+	// The engine installs a factory that runs physics jobs on its own worker
+	// pool. Without one (headless / SentinelPhysics) Jolt gets its own threads.
+	m_pxJobSystem = Zenith_Physics_CreateJobSystem(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
+	if (m_pxJobSystem == nullptr)
+	{
+		// Ensure we have at least 1 worker thread to avoid deadlock
+		// Jolt Physics requires worker threads to process physics jobs
+		uint32_t uNumThreads = std::max(1u, std::thread::hardware_concurrency() - 1);
+		m_pxJobSystem = new JPH::JobSystemThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, uNumThreads);
+	}
 
 	m_pxPhysicsSystem = new JPH::PhysicsSystem();
-	m_pxPhysicsSystem->Init(s_uMaxBodies, s_uNumBodyMutexes, s_uMaxBodyPairs, s_uMaxContactConstraints,
-		s_xBroadPhaseLayerInterface, s_xObjectVsBroadPhaseLayerFilter, s_xObjectLayerPairFilter);
-
-	m_pxPhysicsSystem->SetGravity(JPH::Vec3(0.0f, -9.81f, 0.0f));
+	InitialiseJoltSystem(*m_pxPhysicsSystem);
 
 	m_pxPhysicsSystem->SetContactListener(&m_xContactListener);
 }
 
+void Zenith_Physics::InitialiseJoltSystem(JPH::PhysicsSystem& xSystem)
+{
+	xSystem.Init(s_uMaxBodies, s_uNumBodyMutexes, s_uMaxBodyPairs, s_uMaxContactConstraints,
+		s_xBroadPhaseLayerInterface, s_xObjectVsBroadPhaseLayerFilter, s_xObjectLayerPairFilter);
+
+	xSystem.SetGravity(JPH::Vec3(0.0f, -9.81f, 0.0f));
+}
+
 void Zenith_Physics::Update(float fDt)
 {
 	m_fTimestepAccumulator += fDt;
@@ -516,6 +530,7 @@ void Zenith_Physics::Update(float fDt)
 	while (m_fTimestepAccumulator >= s_fDesiredFramerate
 		&& uSubsteps < uMAX_SUBSTEPS_PER_UPDATE)
 	{
+		ZENITH_PROFILE_SCOPE("Physics Step");
 		m_pxPhysicsSystem->Update(static_cast<float>(s_fDesiredFramerate), 1, m_pxTempAllocator, m_pxJobSystem);
 		m_fTimestepAccumulator -= s_fDesiredFramerate;
 		++uSubsteps;
@@ -906,6 +921,8 @@ public:
 static Zenith_Physics::RaycastResult RaycastImpl(const Zenith_Maths::Vector3& xOrigin,
 	const Zenith_Maths::Vector3& xDirection, float fMaxDistance, JPH::PhysicsSystem* pxSystem, const JPH::BodyFilter& xBodyFilter)
 {
+	ZENITH_PERF_COUNTER_ADD("Physics.Raycasts", 1);
+
 	Zenith_Physics::RaycastResult xResult;
 	xResult.m_bHit = false;
 
@@ -141,11 +141,19 @@ public:
 	// Initialise / after Shutdown — callers null-check.
 	JPH::PhysicsSystem* GetJoltSystem() { return m_pxPhysicsSystem; }
 
+	// Initialises xSystem with the live system's limits, collision layers
+	// (object layer 0 = static, 1 = moving) and gravity, so a detached system
+	// (the physics benchmark) simulates like the live one. Needs Initialise to
+	// have run: Jolt's allocators and type registry must already be installed.
+	static void InitialiseJoltSystem(JPH::PhysicsSystem& xSystem);
+
 private:
 	// Heap-allocated Jolt singletons — reachable outside the physics layer
 	// only through GetJoltSystem().
 	JPH::TempAllocatorImpl*   m_pxTempAllocator = nullptr;
-	JPH::JobSystemThreadPool* m_pxJobSystem     = nullptr;
+	// Made by the factory installed with Zenith_Physics_SetJobSystemFactory
+	// (the engine's task-system bridge); Jolt's own thread pool when none is.
+	JPH::JobSystem*           m_pxJobSystem     = nullptr;
 	JPH::PhysicsSystem*       m_pxPhysicsSystem = nullptr;
 
 public:
@@ -28,3 +28,24 @@ void Zenith_Physics_FireBodyPoseChanged(Zenith_EntityID xEntity)
 		Hooks().m_pfnOnBodyPoseChanged(xEntity);
 	}
 }
+
+// Same function-local-static shape as Hooks() above.
+static Zenith_PhysicsJobSystemFactory& JobSystemFactory()
+{
+	static Zenith_PhysicsJobSystemFactory s_pfnFactory = nullptr;
+	return s_pfnFactory;
+}
+
+void Zenith_Physics_SetJobSystemFactory(Zenith_PhysicsJobSystemFactory pfnFactory)
+{
+	JobSystemFactory() = pfnFactory;
+}
+
+JPH::JobSystem* Zenith_Physics_CreateJobSystem(u_int uMaxJobs, u_int uMaxBarriers)
+{
+	if (JobSystemFactory())
+	{
+		return JobSystemFactory()(uMaxJobs, uMaxBarriers);
+	}
+	return nullptr;
+}
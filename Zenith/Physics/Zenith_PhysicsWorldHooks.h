@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ZenithECS/Zenith_Entity.h"   // Zenith_EntityID
+#include "Physics/Zenith_Physics_Fwd.h" // JPH::JobSystem
 
 // =============================================================================
 // Zenith_PhysicsWorldHooks -- leaf-safe runtime hook for the Physics core
@@ -38,3 +39,22 @@ void Zenith_Physics_SetWorldHooks(const Zenith_PhysicsWorldHooks& xHooks);
 
 // Null-safe fire helper the Physics core calls.
 void Zenith_Physics_FireBodyPoseChanged(Zenith_EntityID xEntity);
+
+// =============================================================================
+// Job-system factory. Jolt schedules each physics step as jobs on a
+// JPH::JobSystem; the engine installs a factory that builds one on its own task
+// system so physics does not run a second thread pool. Zenith_Physics::Initialise
+// calls it (after Jolt's allocators are installed, which the job system needs)
+// and owns the result. Kept out of Zenith_PhysicsWorldHooks because it has to be
+// installed before Physics::Initialise, well before the world hooks are.
+// A null factory (the default) means Jolt's own JobSystemThreadPool.
+// =============================================================================
+
+using Zenith_PhysicsJobSystemFactory = JPH::JobSystem* (*)(u_int uMaxJobs, u_int uMaxBarriers);
+
+// Composition-root install (Zenith_Engine::InitialiseRendererAndPhysics). Takes
+// effect at the next Initialise / Reset.
+void Zenith_Physics_SetJobSystemFactory(Zenith_PhysicsJobSystemFactory pfnFactory);
+
+// Null-safe create helper the Physics core calls. nullptr when no factory is installed.
+JPH::JobSystem* Zenith_Physics_CreateJobSystem(u_int uMaxJobs, u_int uMaxBarriers);
@@ -11,6 +11,7 @@ namespace JPH
 	class BodyID;
 	class PhysicsSystem;
 	class TempAllocatorImpl;
+	class JobSystem;
 	class JobSystemThreadPool;
 	class ContactListener;
 }
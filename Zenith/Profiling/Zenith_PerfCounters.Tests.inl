@@ -0,0 +1,124 @@
+#include "UnitTests/Zenith_UnitTests.h"
+
+// Unit tests for the perf-counter registry. #included at the bottom of
+// Zenith_PerfCounters.cpp. The registry is process-global, so each test uses its
+// own names and reads frame deltas rather than assuming an empty table. EndFrame
+// is called directly; the tests run on the main thread before the frame loop.
+
+#include <thread>
+
+ZENITH_TEST(PerfCounters, BucketsAndPercentiles)
+{
+	ZENITH_ASSERT_EQ(Zenith_PerfCounters::BucketOf(0), 0u);
+	ZENITH_ASSERT_EQ(Zenith_PerfCounters::BucketOf(1), 1u);
+	ZENITH_ASSERT_EQ(Zenith_PerfCounters::BucketOf(2), 2u);
+	ZENITH_ASSERT_EQ(Zenith_PerfCounters::BucketOf(3), 2u);
+	ZENITH_ASSERT_EQ(Zenith_PerfCounters::BucketOf(1024), 11u);
+	ZENITH_ASSERT_EQ(Zenith_PerfCounters::BucketOf(~0ull), Zenith_PerfCounters::uHISTOGRAM_BUCKETS - 1, "huge values clamp into the last bucket");
+	for (u_int u = 1; u < Zenith_PerfCounters::uHISTOGRAM_BUCKETS - 1; u++)
+	{
+		ZENITH_ASSERT_EQ(Zenith_PerfCounters::BucketOf(Zenith_PerfCounters::BucketLowerBound(u)), u, "bucket %u must start at its lower bound", u);
+	}
+
+	u_int64 aulBuckets[Zenith_PerfCounters::uHISTOGRAM_BUCKETS] = {};
+	ZENITH_ASSERT_EQ_FLOAT(Zenith_PerfCounters::EstimatePercentile(aulBuckets, 0, 0.5), 0.0, 1e-9, "no samples, no estimate");
+
+	// 100 samples spread evenly over [64, 128): the median lands mid-bucket.
+	aulBuckets[Zenith_PerfCounters::BucketOf(64)] = 100;
+	ZENITH_ASSERT_EQ_FLOAT(Zenith_PerfCounters::EstimatePercentile(aulBuckets, 127, 0.5), 96.0, 1e-9);
+	// The upper end is capped by the observed maximum.
+	ZENITH_ASSERT_EQ_FLOAT(Zenith_PerfCounters::EstimatePercentile(aulBuckets, 100, 0.99), 100.0, 1e-9);
+
+	// 90 zeros and 10 large values: p50 is zero, p95 is in the large bucket.
+	u_int64 aulSkewed[Zenith_PerfCounters::uHISTOGRAM_BUCKETS] = {};
+	aulSkewed[0] = 90;
+	aulSkewed[Zenith_PerfCounters::BucketOf(4096)] = 10;
+	ZENITH_ASSERT_EQ_FLOAT(Zenith_PerfCounters::EstimatePercentile(aulSkewed, 8000, 0.50), 0.0, 1e-9);
+	const double fP95 = Zenith_PerfCounters::EstimatePercentile(aulSkewed, 8000, 0.95);
+	ZENITH_ASSERT_TRUE(fP95 >= 4096.0 && fP95 <= 8000.0, "p95 %.1f must sit inside the [4096, 8192) bucket", fP95);
+}
+
+ZENITH_TEST(PerfCounters, RegisterDedupesAndRejectsKindMismatch)
+{
+	const Zenith_PerfCounterID uA = Zenith_PerfCounters::Register("Test.PerfCounters.Dedupe", Zenith_PerfCounterKind::Counter);
+	ZENITH_ASSERT_TRUE(uA != ZENITH_PERF_COUNTER_NULL);
+	ZENITH_ASSERT_EQ(Zenith_PerfCounters::Register("Test.PerfCounters.Dedupe", Zenith_PerfCounterKind::Counter), uA, "same name, same id");
+	ZENITH_ASSERT_EQ(Zenith_PerfCounters::Find("Test.PerfCounters.Dedupe"), uA);
+	ZENITH_ASSERT_EQ(Zenith_PerfCounters::Register("Test.PerfCounters.Dedupe", Zenith_PerfCounterKind::Gauge), ZENITH_PERF_COUNTER_NULL,
+		"a name keeps the kind it was registered with");
+	ZENITH_ASSERT_EQ(Zenith_PerfCounters::Find("Test.PerfCounters.NeverRegistered"), ZENITH_PERF_COUNTER_NULL);
+	ZENITH_ASSERT_EQ(Zenith_PerfCounters::Register("", Zenith_PerfCounterKind::Counter), ZENITH_PERF_COUNTER_NULL);
+	ZENITH_ASSERT_STREQ(Zenith_PerfCounters::GetStats(uA).m_szName, "Test.PerfCounters.Dedupe");
+
+	// A null id is a no-op, which is what a refused registration hands the macros.
+	Zenith_PerfCounters::Add(ZENITH_PERF_COUNTER_NULL, 1);
+	Zenith_PerfCounters::Set(ZENITH_PERF_COUNTER_NULL, 1.0);
+	Zenith_PerfCounters::Record(ZENITH_PERF_COUNTER_NULL, 1);
+}
+
+ZENITH_TEST(PerfCounters, CounterMergesAcrossThreads)
+{
+	const Zenith_PerfCounterID uID = Zenith_PerfCounters::Register("Test.PerfCounters.Threads", Zenith_PerfCounterKind::Counter);
+	Zenith_PerfCounters::EndFrame();   // settle anything recorded before the test
+
+	const u_int uThreads = 4;
+	const u_int uAddsPerThread = 10000;
+	std::thread axThreads[uThreads];
+	for (u_int u = 0; u < uThreads; u++)
+	{
+		axThreads[u] = std::thread([uID]()
+		{
+			for (u_int uAdd = 0; uAdd < uAddsPerThread; uAdd++)
+			{
+				Zenith_PerfCounters::Add(uID, 1);
+			}
+		});
+	}
+	for (u_int u = 0; u < uThreads; u++)
+	{
+		axThreads[u].join();
+	}
+	Zenith_PerfCounters::Add(uID, 5);
+
+	Zenith_PerfCounters::EndFrame();
+	const Zenith_PerfCounterStats& xStats = Zenith_PerfCounters::GetStats(uID);
+	ZENITH_ASSERT_EQ_FLOAT(xStats.m_fLastFrame, static_cast<double>(uThreads * uAddsPerThread + 5), 1e-9,
+		"exited threads' blocks must still be merged");
+
+	// The next frame reports only what happened in it.
+	Zenith_PerfCounters::EndFrame();
+	ZENITH_ASSERT_EQ_FLOAT(xStats.m_fLastFrame, 0.0, 1e-9);
+	ZENITH_ASSERT_EQ_FLOAT(xStats.m_fMaxFrame, static_cast<double>(uThreads * uAddsPerThread + 5), 1e-9);
+}
+
+ZENITH_TEST(PerfCounters, GaugeAndHistogramFrameStats)
+{
+	const Zenith_PerfCounterID uGauge = Zenith_PerfCounters::Register("Test.PerfCounters.Gauge", Zenith_PerfCounterKind::Gauge);
+	const Zenith_PerfCounterID uHistogram = Zenith_PerfCounters::Register("Test.PerfCounters.Histogram", Zenith_PerfCounterKind::Histogram);
+	Zenith_PerfCounters::EndFrame();
+
+	Zenith_PerfCounters::Set(uGauge, 10.0);
+	Zenith_PerfCounters::Set(uGauge, 42.5);   // last write wins
+	for (u_int u = 1; u <= 100; u++)
+	{
+		Zenith_PerfCounters::Record(uHistogram, u);
+	}
+	Zenith_PerfCounters::EndFrame();
+
+	const Zenith_PerfCounterStats& xGauge = Zenith_PerfCounters::GetStats(uGauge);
+	ZENITH_ASSERT_EQ_FLOAT(xGauge.m_fLastFrame, 42.5, 1e-9);
+
+	const Zenith_PerfCounterStats& xHistogram = Zenith_PerfCounters::GetStats(uHistogram);
+	ZENITH_ASSERT_EQ_FLOAT(xHistogram.m_fLastFrame, 100.0, 1e-9, "a histogram's frame value is its sample count");
+	const Zenith_PerfCounters::HistogramStats& xBuckets = Zenith_PerfCounters::GetHistogramStats(xHistogram);
+	ZENITH_ASSERT_EQ(xBuckets.m_ulLastFrameSum, 5050ull);
+	ZENITH_ASSERT_EQ(xBuckets.m_ulMax, 100ull);
+	const double fP50 = Zenith_PerfCounters::EstimatePercentile(xBuckets.m_aulTotal, xBuckets.m_ulMax, 0.5);
+	ZENITH_ASSERT_TRUE(fP50 >= 32.0 && fP50 <= 64.0, "p50 %.1f of 1..100 must land in the [32, 64) bucket", fP50);
+
+	// Gauges hold their level; histograms report zero samples on a quiet frame.
+	Zenith_PerfCounters::EndFrame();
+	ZENITH_ASSERT_EQ_FLOAT(xGauge.m_fLastFrame, 42.5, 1e-9);
+	ZENITH_ASSERT_EQ_FLOAT(xHistogram.m_fLastFrame, 0.0, 1e-9);
+	ZENITH_ASSERT_EQ(xBuckets.m_ulTotalSamples, 100ull);
+}
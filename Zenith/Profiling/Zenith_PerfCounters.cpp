@@ -0,0 +1,585 @@
+#include "Zenith.h"
+
+#include "Profiling/Zenith_PerfCounters.h"
+
+#include "Core/Multithreading/Zenith_Multithreading.h"
+#include "Core/Zenith_PlatformStdio.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <new>
+#include <string>
+
+namespace
+{
+	using Zenith_PerfCounterHistogramStats = Zenith_PerfCounters::HistogramStats;
+
+	constexpr u_int uMAX_IDS = Zenith_PerfCounters::uMAX_PERF_COUNTERS;
+	constexpr u_int uMAX_GAUGES = Zenith_PerfCounters::uMAX_GAUGES;
+	constexpr u_int uMAX_HISTOGRAMS = Zenith_PerfCounters::uMAX_HISTOGRAMS;
+	constexpr u_int uBUCKETS = Zenith_PerfCounters::uHISTOGRAM_BUCKETS;
+	constexpr u_int uMAX_THREADS = Zenith_PerfCounters::uMAX_THREADS;
+
+	// One thread's cumulative values. Counters are indexed by id, histograms by
+	// their own slot. Only ever grows; EndFrame diffs successive merges.
+	struct ThreadBlock
+	{
+		std::atomic<u_int64> m_aulCounters[uMAX_IDS];
+		std::atomic<u_int64> m_aaulBuckets[uMAX_HISTOGRAMS][uBUCKETS];
+		std::atomic<u_int64> m_aulHistogramSum[uMAX_HISTOGRAMS];
+		std::atomic<u_int64> m_aulHistogramMax[uMAX_HISTOGRAMS];
+	};
+
+	struct Descriptor
+	{
+		char m_acName[Zenith_PerfCounters::uMAX_NAME] = {};
+		u_int m_uSlot = 0;   // gauge or histogram slot; counters use their id
+	};
+
+	// Registration (mutex-guarded writes; the count is published with release so
+	// lock-free readers only ever see filled-in entries).
+	Descriptor g_axDescriptors[uMAX_IDS];
+	std::atomic<u_int> g_uRegistered{ 0 };
+	u_int g_uGaugeCount = 0;
+	u_int g_uHistogramCount = 0;
+	bool g_bWarnedFull = false;
+
+	// Recording.
+	std::atomic<ThreadBlock*> g_apxBlocks[uMAX_THREADS];
+	std::atomic<u_int> g_uBlocksClaimed{ 0 };
+	ThreadBlock g_xOverflowBlock;                         // shared by threads past uMAX_THREADS
+	std::atomic<u_int64> g_aulGaugeBits[uMAX_GAUGES];     // std::bit_cast<u_int64>(double)
+	thread_local ThreadBlock* tl_pxBlock = nullptr;
+	thread_local bool tl_bSharedBlock = false;
+
+	// Merge state (main thread).
+	Zenith_PerfCounterStats g_axStats[uMAX_IDS];
+	Zenith_PerfCounterHistogramStats g_axHistogramStats[uMAX_HISTOGRAMS];
+	u_int64 g_aulPreviousCounters[uMAX_IDS] = {};
+	u_int64 g_ulMergedFrames = 0;
+
+	Zenith_Mutex_NoProfiling& GetRegistryMutex()
+	{
+		// Function-local: macros may register from static initialisers in other TUs.
+		static Zenith_Mutex_NoProfiling s_xMutex;
+		return s_xMutex;
+	}
+
+	ThreadBlock& GetThreadBlock()
+	{
+		if (tl_pxBlock)
+		{
+			return *tl_pxBlock;
+		}
+
+		const u_int uIndex = g_uBlocksClaimed.fetch_add(1, std::memory_order_relaxed);
+		if (uIndex >= uMAX_THREADS)
+		{
+			tl_pxBlock = &g_xOverflowBlock;
+			tl_bSharedBlock = true;
+			return g_xOverflowBlock;
+		}
+
+		// Untracked and never freed: a thread's totals outlive it, and counting the
+		// allocation would feed back into the Memory.* gauges.
+		void* pMemory = Zenith_MemoryManagement::Allocate(sizeof(ThreadBlock));
+		ThreadBlock* pxBlock = new (pMemory) ThreadBlock();
+		g_apxBlocks[uIndex].store(pxBlock, std::memory_order_release);
+		tl_pxBlock = pxBlock;
+		return *pxBlock;
+	}
+
+	// Single writer on an owned block, so a plain load + store is enough and keeps
+	// the line exclusive to this core. The overflow block is shared: use RMWs.
+	void Accumulate(std::atomic<u_int64>& xValue, u_int64 ulDelta)
+	{
+		if (tl_bSharedBlock)
+		{
+			xValue.fetch_add(ulDelta, std::memory_order_relaxed);
+			return;
+		}
+		xValue.store(xValue.load(std::memory_order_relaxed) + ulDelta, std::memory_order_relaxed);
+	}
+
+	void RaiseMax(std::atomic<u_int64>& xMax, u_int64 ulValue)
+	{
+		u_int64 ulCurrent = xMax.load(std::memory_order_relaxed);
+		if (!tl_bSharedBlock)
+		{
+			if (ulValue > ulCurrent)
+			{
+				xMax.store(ulValue, std::memory_order_relaxed);
+			}
+			return;
+		}
+		while (ulValue > ulCurrent && !xMax.compare_exchange_weak(ulCurrent, ulValue, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	template<typename Fn>
+	void ForEachBlock(Fn&& xFn)
+	{
+		const u_int uClaimed = std::min(g_uBlocksClaimed.load(std::memory_order_relaxed), uMAX_THREADS);
+		for (u_int u = 0; u < uClaimed; u++)
+		{
+			// Null while a new thread is between claiming and publishing; its values
+			// are cumulative, so they simply land in a later merge.
+			const ThreadBlock* pxBlock = g_apxBlocks[u].load(std::memory_order_acquire);
+			if (pxBlock)
+			{
+				xFn(*pxBlock);
+			}
+		}
+		xFn(g_xOverflowBlock);
+	}
+
+	void PushFrameValue(Zenith_PerfCounterStats& xStats, double fValue)
+	{
+		xStats.m_fLastFrame = fValue;
+		if (xStats.m_ulFrames == 0)
+		{
+			xStats.m_fMinFrame = fValue;
+			xStats.m_fMaxFrame = fValue;
+		}
+		else
+		{
+			xStats.m_fMinFrame = std::min(xStats.m_fMinFrame, fValue);
+			xStats.m_fMaxFrame = std::max(xStats.m_fMaxFrame, fValue);
+		}
+		xStats.m_fSumFrames += fValue;
+		xStats.m_ulFrames++;
+
+		xStats.m_afHistory[xStats.m_uHistoryHead] = static_cast<float>(fValue);
+		xStats.m_uHistoryHead = (xStats.m_uHistoryHead + 1) % Zenith_PerfCounterStats::uHISTORY;
+	}
+
+	const char* KindName(Zenith_PerfCounterKind eKind)
+	{
+		switch (eKind)
+		{
+		case Zenith_PerfCounterKind::Counter:   return "counter";
+		case Zenith_PerfCounterKind::Gauge:     return "gauge";
+		case Zenith_PerfCounterKind::Histogram: return "histogram";
+		}
+		return "unknown";
+	}
+
+	double MeanPerFrame(const Zenith_PerfCounterStats& xStats)
+	{
+		return xStats.m_ulFrames > 0 ? xStats.m_fSumFrames / static_cast<double>(xStats.m_ulFrames) : 0.0;
+	}
+
+	// A gauge is a level, so its "total" is where it ended; everything else sums.
+	double Total(const Zenith_PerfCounterStats& xStats)
+	{
+		return xStats.m_eKind == Zenith_PerfCounterKind::Gauge ? xStats.m_fLastFrame : xStats.m_fSumFrames;
+	}
+
+	// Registry names are engine identifiers, but a stray quote must not break the file.
+	void WriteJSONString(FILE* pxFile, const char* sz)
+	{
+		fputc('"', pxFile);
+		for (; *sz; ++sz)
+		{
+			if (*sz == '"' || *sz == '\\')
+			{
+				fputc('\\', pxFile);
+			}
+			fputc(*sz, pxFile);
+		}
+		fputc('"', pxFile);
+	}
+}
+
+// =============================================================================
+// Registration
+// =============================================================================
+
+Zenith_PerfCounterID Zenith_PerfCounters::Register(const char* szName, Zenith_PerfCounterKind eKind)
+{
+	if (!szName || !szName[0])
+	{
+		return ZENITH_PERF_COUNTER_NULL;
+	}
+
+	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(GetRegistryMutex());
+
+	const u_int uCount = g_uRegistered.load(std::memory_order_relaxed);
+	for (u_int u = 0; u < uCount; u++)
+	{
+		if (strncmp(g_axDescriptors[u].m_acName, szName, uMAX_NAME - 1) == 0)
+		{
+			if (g_axStats[u].m_eKind != eKind)
+			{
+				Zenith_Warning(LOG_CATEGORY_CORE, "PerfCounters: '%s' is a %s; cannot use it as a %s",
+					szName, KindName(g_axStats[u].m_eKind), KindName(eKind));
+				return ZENITH_PERF_COUNTER_NULL;
+			}
+			return u;
+		}
+	}
+
+	const bool bFull = uCount >= uMAX_IDS
+		|| (eKind == Zenith_PerfCounterKind::Gauge && g_uGaugeCount >= uMAX_GAUGES)
+		|| (eKind == Zenith_PerfCounterKind::Histogram && g_uHistogramCount >= uMAX_HISTOGRAMS);
+	if (bFull)
+	{
+		if (!g_bWarnedFull)
+		{
+			g_bWarnedFull = true;
+			Zenith_Warning(LOG_CATEGORY_CORE, "PerfCounters: no room for %s '%s' (%u ids, %u gauges, %u histograms); further registrations are dropped",
+				KindName(eKind), szName, uMAX_IDS, uMAX_GAUGES, uMAX_HISTOGRAMS);
+		}
+		return ZENITH_PERF_COUNTER_NULL;
+	}
+
+	Descriptor& xDescriptor = g_axDescriptors[uCount];
+	strncpy(xDescriptor.m_acName, szName, uMAX_NAME - 1);
+	xDescriptor.m_acName[uMAX_NAME - 1] = '\0';
+
+	Zenith_PerfCounterStats& xStats = g_axStats[uCount];
+	xStats.m_szName = xDescriptor.m_acName;
+	xStats.m_eKind = eKind;
+	if (eKind == Zenith_PerfCounterKind::Gauge)
+	{
+		xDescriptor.m_uSlot = g_uGaugeCount++;
+		g_aulGaugeBits[xDescriptor.m_uSlot].store(std::bit_cast<u_int64>(0.0), std::memory_order_relaxed);
+	}
+	else if (eKind == Zenith_PerfCounterKind::Histogram)
+	{
+		xDescriptor.m_uSlot = g_uHistogramCount++;
+		xStats.m_uHistogram = xDescriptor.m_uSlot;
+	}
+	else
+	{
+		xDescriptor.m_uSlot = uCount;
+	}
+
+	g_uRegistered.store(uCount + 1, std::memory_order_release);
+	return uCount;
+}
+
+Zenith_PerfCounterID Zenith_PerfCounters::Find(const char* szName)
+{
+	const u_int uCount = g_uRegistered.load(std::memory_order_acquire);
+	for (u_int u = 0; u < uCount; u++)
+	{
+		if (strncmp(g_axDescriptors[u].m_acName, szName, uMAX_NAME - 1) == 0)
+		{
+			return u;
+		}
+	}
+	return ZENITH_PERF_COUNTER_NULL;
+}
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+void Zenith_PerfCounters::Add(Zenith_PerfCounterID uID, u_int64 ulDelta)
+{
+	if (uID >= uMAX_IDS)
+	{
+		return;
+	}
+	Zenith_Assert(g_axStats[uID].m_eKind == Zenith_PerfCounterKind::Counter, "PerfCounters: '%s' is not a counter", g_axStats[uID].m_szName);
+	Accumulate(GetThreadBlock().m_aulCounters[uID], ulDelta);
+}
+
+void Zenith_PerfCounters::Set(Zenith_PerfCounterID uID, double fValue)
+{
+	if (uID >= uMAX_IDS)
+	{
+		return;
+	}
+	Zenith_Assert(g_axStats[uID].m_eKind == Zenith_PerfCounterKind::Gauge, "PerfCounters: '%s' is not a gauge", g_axStats[uID].m_szName);
+	g_aulGaugeBits[g_axDescriptors[uID].m_uSlot].store(std::bit_cast<u_int64>(fValue), std::memory_order_relaxed);
+}
+
+void Zenith_PerfCounters::Record(Zenith_PerfCounterID uID, u_int64 ulValue)
+{
+	if (uID >= uMAX_IDS)
+	{
+		return;
+	}
+	Zenith_Assert(g_axStats[uID].m_eKind == Zenith_PerfCounterKind::Histogram, "PerfCounters: '%s' is not a histogram", g_axStats[uID].m_szName);
+	const u_int uSlot = g_axDescriptors[uID].m_uSlot;
+	ThreadBlock& xBlock = GetThreadBlock();
+	Accumulate(xBlock.m_aaulBuckets[uSlot][BucketOf(ulValue)], 1);
+	Accumulate(xBlock.m_aulHistogramSum[uSlot], ulValue);
+	RaiseMax(xBlock.m_aulHistogramMax[uSlot], ulValue);
+}
+
+// =============================================================================
+// Merge
+// =============================================================================
+
+void Zenith_PerfCounters::EndFrame()
+{
+	const u_int uCount = g_uRegistered.load(std::memory_order_acquire);
+
+	for (u_int uID = 0; uID < uCount; uID++)
+	{
+		Zenith_PerfCounterStats& xStats = g_axStats[uID];
+		const u_int uSlot = g_axDescriptors[uID].m_uSlot;
+
+		switch (xStats.m_eKind)
+		{
+		case Zenith_PerfCounterKind::Counter:
+		{
+			u_int64 ulTotal = 0;
+			ForEachBlock([&](const ThreadBlock& xBlock) { ulTotal += xBlock.m_aulCounters[uID].load(std::memory_order_relaxed); });
+			PushFrameValue(xStats, static_cast<double>(ulTotal - g_aulPreviousCounters[uID]));
+			g_aulPreviousCounters[uID] = ulTotal;
+			break;
+		}
+		case Zenith_PerfCounterKind::Gauge:
+			PushFrameValue(xStats, std::bit_cast<double>(g_aulGaugeBits[uSlot].load(std::memory_order_relaxed)));
+			break;
+		case Zenith_PerfCounterKind::Histogram:
+		{
+			HistogramStats& xHistogram = g_axHistogramStats[uSlot];
+			u_int64 aulTotal[uBUCKETS] = {};
+			u_int64 ulSum = 0;
+			ForEachBlock([&](const ThreadBlock& xBlock)
+			{
+				for (u_int uBucket = 0; uBucket < uBUCKETS; uBucket++)
+				{
+					aulTotal[uBucket] += xBlock.m_aaulBuckets[uSlot][uBucket].load(std::memory_order_relaxed);
+				}
+				ulSum += xBlock.m_aulHistogramSum[uSlot].load(std::memory_order_relaxed);
+				xHistogram.m_ulMax = std::max(xHistogram.m_ulMax, xBlock.m_aulHistogramMax[uSlot].load(std::memory_order_relaxed));
+			});
+
+			u_int64 ulFrameSamples = 0;
+			u_int64 ulTotalSamples = 0;
+			for (u_int uBucket = 0; uBucket < uBUCKETS; uBucket++)
+			{
+				xHistogram.m_aulLastFrame[uBucket] = aulTotal[uBucket] - xHistogram.m_aulTotal[uBucket];
+				xHistogram.m_aulTotal[uBucket] = aulTotal[uBucket];
+				ulFrameSamples += xHistogram.m_aulLastFrame[uBucket];
+				ulTotalSamples += aulTotal[uBucket];
+			}
+			xHistogram.m_ulLastFrameSum = ulSum - xHistogram.m_ulTotalSum;
+			xHistogram.m_ulTotalSum = ulSum;
+			xHistogram.m_ulTotalSamples = ulTotalSamples;
+			PushFrameValue(xStats, static_cast<double>(ulFrameSamples));
+			break;
+		}
+		}
+	}
+
+	g_ulMergedFrames++;
+}
+
+u_int64 Zenith_PerfCounters::GetMergedFrames()
+{
+	return g_ulMergedFrames;
+}
+
+u_int Zenith_PerfCounters::GetCount()
+{
+	return g_uRegistered.load(std::memory_order_acquire);
+}
+
+const Zenith_PerfCounterStats& Zenith_PerfCounters::GetStats(Zenith_PerfCounterID uID)
+{
+	Zenith_Assert(uID < GetCount(), "PerfCounters: id %u out of range", uID);
+	return g_axStats[uID];
+}
+
+const Zenith_PerfCounters::HistogramStats& Zenith_PerfCounters::GetHistogramStats(const Zenith_PerfCounterStats& xStats)
+{
+	Zenith_Assert(xStats.m_eKind == Zenith_PerfCounterKind::Histogram, "PerfCounters: '%s' is not a histogram", xStats.m_szName);
+	return g_axHistogramStats[xStats.m_uHistogram];
+}
+
+// =============================================================================
+// Bucketing
+// =============================================================================
+
+u_int Zenith_PerfCounters::BucketOf(u_int64 ulValue)
+{
+	return std::min(static_cast<u_int>(std::bit_width(ulValue)), uBUCKETS - 1);
+}
+
+u_int64 Zenith_PerfCounters::BucketLowerBound(u_int uBucket)
+{
+	return uBucket == 0 ? 0 : (1ull << (uBucket - 1));
+}
+
+double Zenith_PerfCounters::EstimatePercentile(const u_int64* aulBuckets, u_int64 ulMax, double fFraction)
+{
+	u_int64 ulSamples = 0;
+	for (u_int u = 0; u < uBUCKETS; u++)
+	{
+		ulSamples += aulBuckets[u];
+	}
+	if (ulSamples == 0)
+	{
+		return 0.0;
+	}
+
+	const double fTarget = std::clamp(fFraction, 0.0, 1.0) * static_cast<double>(ulSamples);
+	double fBelow = 0.0;
+	for (u_int u = 0; u < uBUCKETS; u++)
+	{
+		if (aulBuckets[u] == 0)
+		{
+			continue;
+		}
+		const double fInBucket = static_cast<double>(aulBuckets[u]);
+		if (fBelow + fInBucket >= fTarget)
+		{
+			if (u == 0)
+			{
+				return 0.0;
+			}
+			const double fLow = static_cast<double>(BucketLowerBound(u));
+			const double fHigh = (u == uBUCKETS - 1) ? std::max(fLow, static_cast<double>(ulMax)) : fLow * 2.0;
+			const double fEstimate = fLow + (fHigh - fLow) * ((fTarget - fBelow) / fInBucket);
+			return std::min(fEstimate, static_cast<double>(ulMax));
+		}
+		fBelow += fInBucket;
+	}
+	return static_cast<double>(ulMax);
+}
+
+// =============================================================================
+// Reports
+// =============================================================================
+
+void Zenith_PerfCounters::WriteReport(FILE* pxFile)
+{
+	const u_int uCount = GetCount();
+	if (uCount == 0)
+	{
+		return;
+	}
+
+	fprintf(pxFile, "\n=== Perf Counters (%llu frames merged; histograms: samples per frame, value percentiles over the run) ===\n",
+		static_cast<unsigned long long>(g_ulMergedFrames));
+	fprintf(pxFile, "%-40s %-9s %14s %14s %14s %14s %16s\n", "Name", "Kind", "Last", "Mean/frame", "Min", "Max", "Total");
+	fprintf(pxFile, "---------------------------------------- --------- -------------- -------------- -------------- -------------- ----------------\n");
+	for (u_int u = 0; u < uCount; u++)
+	{
+		const Zenith_PerfCounterStats& xStats = g_axStats[u];
+		fprintf(pxFile, "%-40s %-9s %14.2f %14.2f %14.2f %14.2f %16.2f\n", xStats.m_szName, KindName(xStats.m_eKind),
+			xStats.m_fLastFrame, MeanPerFrame(xStats), xStats.m_fMinFrame, xStats.m_fMaxFrame, Total(xStats));
+		if (xStats.m_eKind == Zenith_PerfCounterKind::Histogram)
+		{
+			const HistogramStats& xHistogram = g_axHistogramStats[xStats.m_uHistogram];
+			const double fMean = xHistogram.m_ulTotalSamples > 0
+				? static_cast<double>(xHistogram.m_ulTotalSum) / static_cast<double>(xHistogram.m_ulTotalSamples) : 0.0;
+			fprintf(pxFile, "%-40s %-9s mean %.1f  p50 %.1f  p95 %.1f  p99 %.1f  max %llu\n", "", "",
+				fMean,
+				EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.50),
+				EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.95),
+				EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.99),
+				static_cast<unsigned long long>(xHistogram.m_ulMax));
+		}
+	}
+}
+
+void Zenith_PerfCounters::WriteJSON(FILE* pxFile)
+{
+	const u_int uCount = GetCount();
+	fprintf(pxFile, "{\n  \"frames\": %llu,\n  \"counters\": [", static_cast<unsigned long long>(g_ulMergedFrames));
+	for (u_int u = 0; u < uCount; u++)
+	{
+		const Zenith_PerfCounterStats& xStats = g_axStats[u];
+		fprintf(pxFile, "%s\n    { \"name\": ", u == 0 ? "" : ",");
+		WriteJSONString(pxFile, xStats.m_szName);
+		fprintf(pxFile, ", \"kind\": \"%s\", \"last\": %.17g, \"mean_per_frame\": %.17g, \"min\": %.17g, \"max\": %.17g, \"total\": %.17g",
+			KindName(xStats.m_eKind), xStats.m_fLastFrame, MeanPerFrame(xStats), xStats.m_fMinFrame, xStats.m_fMaxFrame, Total(xStats));
+		if (xStats.m_eKind == Zenith_PerfCounterKind::Histogram)
+		{
+			const HistogramStats& xHistogram = g_axHistogramStats[xStats.m_uHistogram];
+			fprintf(pxFile, ", \"samples\": %llu, \"sum\": %llu, \"value_max\": %llu, \"p50\": %.17g, \"p95\": %.17g, \"p99\": %.17g, \"buckets\": [",
+				static_cast<unsigned long long>(xHistogram.m_ulTotalSamples),
+				static_cast<unsigned long long>(xHistogram.m_ulTotalSum),
+				static_cast<unsigned long long>(xHistogram.m_ulMax),
+				EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.50),
+				EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.95),
+				EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.99));
+			// Trailing empty buckets are left out; bucket i starts at BucketLowerBound(i).
+			u_int uLast = uBUCKETS;
+			while (uLast > 0 && xHistogram.m_aulTotal[uLast - 1] == 0)
+			{
+				uLast--;
+			}
+			for (u_int uBucket = 0; uBucket < uLast; uBucket++)
+			{
+				fprintf(pxFile, "%s%llu", uBucket == 0 ? "" : ", ", static_cast<unsigned long long>(xHistogram.m_aulTotal[uBucket]));
+			}
+			fprintf(pxFile, "]");
+		}
+		fprintf(pxFile, " }");
+	}
+	fprintf(pxFile, "\n  ]\n}\n");
+}
+
+void Zenith_PerfCounters::WriteCSV(FILE* pxFile)
+{
+	fprintf(pxFile, "name,kind,last,mean_per_frame,min,max,total,p50,p95,p99,value_max\n");
+	const u_int uCount = GetCount();
+	for (u_int u = 0; u < uCount; u++)
+	{
+		const Zenith_PerfCounterStats& xStats = g_axStats[u];
+		fprintf(pxFile, "%s,%s,%.17g,%.17g,%.17g,%.17g,%.17g", xStats.m_szName, KindName(xStats.m_eKind),
+			xStats.m_fLastFrame, MeanPerFrame(xStats), xStats.m_fMinFrame, xStats.m_fMaxFrame, Total(xStats));
+		if (xStats.m_eKind == Zenith_PerfCounterKind::Histogram)
+		{
+			const HistogramStats& xHistogram = g_axHistogramStats[xStats.m_uHistogram];
+			fprintf(pxFile, ",%.17g,%.17g,%.17g,%llu\n",
+				EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.50),
+				EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.95),
+				EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.99),
+				static_cast<unsigned long long>(xHistogram.m_ulMax));
+		}
+		else
+		{
+			fprintf(pxFile, ",,,,\n");
+		}
+	}
+}
+
+bool Zenith_PerfCounters::WriteDump(const char* szJSONPath)
+{
+	std::string strCSVPath = szJSONPath;
+	const size_t ulDot = strCSVPath.find_last_of('.');
+	const size_t ulSlash = strCSVPath.find_last_of("/\\");
+	if (ulDot != std::string::npos && (ulSlash == std::string::npos || ulDot > ulSlash))
+	{
+		strCSVPath.resize(ulDot);
+	}
+	strCSVPath += ".csv";
+
+	FILE* pxJSON = Zenith_PlatformStdio::OpenFile(szJSONPath, "w");
+	if (!pxJSON)
+	{
+		Zenith_Warning(LOG_CATEGORY_CORE, "PerfCounters: could not open '%s' for writing", szJSONPath);
+		return false;
+	}
+	WriteJSON(pxJSON);
+	fclose(pxJSON);
+
+	FILE* pxCSV = Zenith_PlatformStdio::OpenFile(strCSVPath.c_str(), "w");
+	if (!pxCSV)
+	{
+		Zenith_Warning(LOG_CATEGORY_CORE, "PerfCounters: could not open '%s' for writing", strCSVPath.c_str());
+		return false;
+	}
+	WriteCSV(pxCSV);
+	fclose(pxCSV);
+
+	Zenith_Log(LOG_CATEGORY_CORE, "[PerfCounters] %u counters over %llu frames written to %s and %s",
+		GetCount(), static_cast<unsigned long long>(g_ulMergedFrames), szJSONPath, strCSVPath.c_str());
+	return true;
+}
+
+#ifdef ZENITH_TESTING
+#include "Profiling/Zenith_PerfCounters.Tests.inl"
+#endif
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstdio>
+
+// Same compile-time master switch as Zenith_Profiling.h (kept in step here so this
+// header does not have to pull the whole profiler in). When 0 the recording macros
+// below compile to nothing; the registry itself still builds, inert.
+#ifndef ZENITH_PROFILING_ENABLED
+#define ZENITH_PROFILING_ENABLED 1
+#endif
+
+// =============================================================================
+// Zenith_PerfCounters
+// -----------------------------------------------------------------------------
+// One registry for the engine's scalar performance signals, so a soak run can
+// answer "how many paths / raycasts / streamed bytes / allocations per frame"
+// without a debugger. Three kinds, all registered by name on first use:
+//
+//   Counter   - a running sum. ZENITH_PERF_COUNTER_ADD("Physics.Raycasts", 1).
+//               Reported per frame (the delta) and in total.
+//   Gauge     - a level, last write wins. ZENITH_PERF_GAUGE_SET("Memory.TrackedBytes", x).
+//   Histogram - a distribution of u_int64 samples in power-of-two buckets.
+//               ZENITH_PERF_HISTOGRAM_RECORD("AI.PathNodesExpanded", n).
+//               Reported as samples per frame plus p50 / p95 / p99 / max.
+//
+// Cost. Recording is one cached-id check and a relaxed load + store into the
+// calling thread's own block: no lock, no shared cache line, no RMW. Threads past
+// uMAX_THREADS share one overflow block through fetch_add instead.
+//
+// Merge. EndFrame (called by Zenith_Profiling::EndFrame, main thread) sums every
+// thread's block. Blocks only ever grow, so each merge is the difference from the
+// previous one and nothing is reset under a producer's feet. Blocks are never
+// freed, so counts from threads that have exited still report.
+//
+// Consumers. The profiler window's Counters tab and --profiling-dump read the
+// merged stats; Zenith_Telemetry::Recorder stores each counter's last-frame value
+// in every FrameSample; --perf-counters[=path] writes a JSON summary (plus a CSV
+// beside it) at shutdown.
+//
+// Names are copied, so any string is lifetime-safe. A name keeps the kind it was
+// first registered with; re-registering it as another kind is refused.
+// =============================================================================
+
+using Zenith_PerfCounterID = u_int;
+static constexpr Zenith_PerfCounterID ZENITH_PERF_COUNTER_NULL = 0xFFFFFFFFu;
+
+enum class Zenith_PerfCounterKind : u_int8
+{
+	Counter,
+	Gauge,
+	Histogram,
+};
+
+// Merged view of one registration, updated once per EndFrame. Main-thread reads only.
+struct Zenith_PerfCounterStats
+{
+	static constexpr u_int uHISTORY = 256;   // matches the profiler's frame history
+
+	const char* m_szName = nullptr;          // owned by the registry, process lifetime
+	Zenith_PerfCounterKind m_eKind = Zenith_PerfCounterKind::Counter;
+	u_int m_uHistogram = ~0u;                // index for GetHistogramStats (histograms only)
+
+	// Per-frame value: a counter's delta, a gauge's level, a histogram's sample count.
+	double m_fLastFrame = 0.0;
+	double m_fMinFrame = 0.0;
+	double m_fMaxFrame = 0.0;
+	double m_fSumFrames = 0.0;               // mean per frame = m_fSumFrames / m_ulFrames
+	u_int64 m_ulFrames = 0;                  // frames merged since registration
+
+	float m_afHistory[uHISTORY] = {};        // per-frame value ring, oldest at m_uHistoryHead
+	u_int m_uHistoryHead = 0;
+};
+
+class Zenith_PerfCounters
+{
+public:
+	static constexpr u_int uMAX_PERF_COUNTERS = 128;   // all kinds together
+	static constexpr u_int uMAX_GAUGES = 64;
+	static constexpr u_int uMAX_HISTOGRAMS = 32;
+	static constexpr u_int uMAX_NAME = 64;
+	static constexpr u_int uMAX_THREADS = 64;
+	// Bucket 0 holds zero; bucket b holds [2^(b-1), 2^b); the last also takes everything above.
+	static constexpr u_int uHISTOGRAM_BUCKETS = 48;
+
+	struct HistogramStats
+	{
+		u_int64 m_aulLastFrame[uHISTOGRAM_BUCKETS] = {};
+		u_int64 m_aulTotal[uHISTOGRAM_BUCKETS] = {};
+		u_int64 m_ulLastFrameSum = 0;
+		u_int64 m_ulTotalSum = 0;
+		u_int64 m_ulTotalSamples = 0;
+		u_int64 m_ulMax = 0;                 // exact, over the whole run
+	};
+
+	// Returns the existing id for a known name (ZENITH_PERF_COUNTER_NULL when the
+	// kinds differ), otherwise registers it. Null when the table is full. Any thread.
+	static Zenith_PerfCounterID Register(const char* szName, Zenith_PerfCounterKind eKind);
+	static Zenith_PerfCounterID Find(const char* szName);
+
+	// Recording, any thread. A null id is ignored.
+	static void Add(Zenith_PerfCounterID uID, u_int64 ulDelta);
+	static void Set(Zenith_PerfCounterID uID, double fValue);
+	static void Record(Zenith_PerfCounterID uID, u_int64 ulValue);
+
+	// Fold every thread's block into the stats. Main thread, once per frame.
+	static void EndFrame();
+	static u_int64 GetMergedFrames();
+
+	// Registrations in registration order; ids are indices into this list.
+	static u_int GetCount();
+	static const Zenith_PerfCounterStats& GetStats(Zenith_PerfCounterID uID);
+	static const HistogramStats& GetHistogramStats(const Zenith_PerfCounterStats& xStats);
+
+	// Reports. The text table feeds --profiling-dump; JSON and CSV are the shutdown dump.
+	static void WriteReport(FILE* pxFile);
+	static void WriteJSON(FILE* pxFile);
+	static void WriteCSV(FILE* pxFile);
+	// JSON to szJSONPath, CSV to the same path with its extension replaced by ".csv".
+	static bool WriteDump(const char* szJSONPath);
+
+	// Bucketing maths, exposed for the tests.
+	static u_int BucketOf(u_int64 ulValue);
+	static u_int64 BucketLowerBound(u_int uBucket);
+	// Linear interpolation inside the bucket holding the fFraction quantile, capped at ulMax.
+	static double EstimatePercentile(const u_int64* aulBuckets, u_int64 ulMax, double fFraction);
+};
+
+// Call-site macros. The static local registers the name exactly once (C++11
+// thread-safe static init); every later call pays one guard check.
+#if ZENITH_PROFILING_ENABLED
+	#define ZENITH_PERF_COUNTER_ADD(szName, ulDelta) \
+		do { \
+			static const Zenith_PerfCounterID s_uPerfCounterID = \
+				Zenith_PerfCounters::Register(szName, Zenith_PerfCounterKind::Counter); \
+			Zenith_PerfCounters::Add(s_uPerfCounterID, static_cast<u_int64>(ulDelta)); \
+		} while (0)
+
+	#define ZENITH_PERF_GAUGE_SET(szName, fValue) \
+		do { \
+			static const Zenith_PerfCounterID s_uPerfCounterID = \
+				Zenith_PerfCounters::Register(szName, Zenith_PerfCounterKind::Gauge); \
+			Zenith_PerfCounters::Set(s_uPerfCounterID, static_cast<double>(fValue)); \
+		} while (0)
+
+	#define ZENITH_PERF_HISTOGRAM_RECORD(szName, ulValue) \
+		do { \
+			static const Zenith_PerfCounterID s_uPerfCounterID = \
+				Zenith_PerfCounters::Register(szName, Zenith_PerfCounterKind::Histogram); \
+			Zenith_PerfCounters::Record(s_uPerfCounterID, static_cast<u_int64>(ulValue)); \
+		} while (0)
+#else
+	#define ZENITH_PERF_COUNTER_ADD(szName, ulDelta)      ((void)0)
+	#define ZENITH_PERF_GAUGE_SET(szName, fValue)         ((void)0)
+	#define ZENITH_PERF_HISTOGRAM_RECORD(szName, ulValue) ((void)0)
+#endif
@@ -0,0 +1,164 @@
+#include "UnitTests/Zenith_UnitTests.h"
+
+// ============================================================================
+// Streaming trace tests. The formatters are static and engine-free, so these
+// drive them straight into a temp file with a LOCAL profiler for zone names;
+// no writer thread is started.
+// ============================================================================
+
+#if ZENITH_PROFILING_ENABLED
+
+namespace
+{
+	void ReadTraceFile(FILE* pxFile, Zenith_Vector<char>& xOut)
+	{
+		fflush(pxFile);
+		fseek(pxFile, 0, SEEK_END);
+		const long lSize = ftell(pxFile);
+		fseek(pxFile, 0, SEEK_SET);
+		xOut.Resize(static_cast<u_int>(lSize) + 1, '\0');
+		if (lSize > 0) { const size_t uRead = fread(xOut.GetDataPointer(), 1, static_cast<size_t>(lSize), pxFile); (void)uRead; }
+	}
+}
+
+// One batch carrying every kind of record formats to the expected trace events.
+ZENITH_TEST(ProfileTrace, WriteBatchFormatsEveryRecord)
+{
+	FILE* pxFile = Zenith_TestOpenTempFile();
+	if (pxFile == nullptr)
+	{
+		ZENITH_SKIP("no temp file available for the trace round-trip");
+	}
+
+	Zenith_Profiling* pxProfiling = new Zenith_Profiling();
+	const Zenith_ProfileZoneID uZone = pxProfiling->RegisterZone("TraceTestZone");
+	const u_int64 uTicksPerMs = static_cast<u_int64>(1.0e6 / Zenith_Profiling_Detail::GetTicksToNs());
+
+	Zenith_ProfileTraceStream::Batch* pxBatch = new Zenith_ProfileTraceStream::Batch();
+	{
+		Zenith_ProfileTraceStream::TraceEvent xPlain;
+		xPlain.m_uBeginTicks = 1000 + uTicksPerMs;
+		xPlain.m_uEndTicks = 1000 + 3 * uTicksPerMs;
+		xPlain.m_uZoneID = uZone;
+		xPlain.m_uThreadID = 3;
+		pxBatch->m_xEvents.PushBack(xPlain);
+
+		Zenith_ProfileTraceStream::TraceEvent xLabelled = xPlain;
+		xLabelled.m_uLabelOffset = pxBatch->AddLabel("Shadow \"Cascade\"");
+		pxBatch->m_xEvents.PushBack(xLabelled);
+
+		Zenith_ProfileTraceStream::ThreadName xName;
+		xName.m_uThreadID = 3;
+		snprintf(xName.m_acName, sizeof(xName.m_acName), "TraceTestWorker");
+		pxBatch->m_xThreadNames.PushBack(xName);
+
+		Zenith_ProfileTraceStream::Instant xInstant;
+		xInstant.m_szName = "TraceTestMilestone";
+		xInstant.m_uTicks = 1000;
+		pxBatch->m_xInstants.PushBack(xInstant);
+
+		Zenith_Profiling::GPUPass xPass;
+		xPass.m_szName = "TraceTestGPUPass";
+		xPass.m_fMilliseconds = 0.5;
+		xPass.m_uExecIndex = 7;
+		pxBatch->m_xGPUPasses.PushBack(xPass);
+		pxBatch->m_uGPUBaseTicks = 1000;
+	}
+
+	bool bFirst = true;
+	Zenith_ProfileTraceStream::WriteHeader(pxFile, bFirst);
+	Zenith_ProfileTraceStream::WriteBatch(pxFile, *pxBatch, *pxProfiling, 1000, bFirst);
+	Zenith_ProfileTraceStream::WriteFooter(pxFile);
+
+	Zenith_Vector<char> xText;
+	ReadTraceFile(pxFile, xText);
+	fclose(pxFile);
+	const char* szText = xText.GetDataPointer();
+
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), "the file must open the trace-event array");
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, "\n]}"), "the footer must close the array and object");
+	// uTicksPerMs is truncated, so derive the expected microseconds the same way.
+	const double fBeginUs = static_cast<double>(uTicksPerMs) * Zenith_Profiling_Detail::GetTicksToNs() / 1.0e3;
+	char acExpected[256];
+	snprintf(acExpected, sizeof(acExpected), "{\"name\":\"TraceTestZone\",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":3}",
+		fBeginUs, 3.0 * fBeginUs - fBeginUs);
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, acExpected), "an unlabelled zone must be a complete event in microseconds from the origin");
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, "{\"name\":\"Shadow \\\"Cascade\\\"\",\"cat\":\"TraceTestZone\""),
+		"a labelled zone must be named by its (escaped) label under the zone's category");
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, "\"tid\":3,\"args\":{\"name\":\"TraceTestWorker\"}"), "thread names must be thread_name metadata");
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, "{\"name\":\"TraceTestMilestone\",\"cat\":\"marker\",\"ph\":\"i\""), "instants must be instant events");
+	ZENITH_ASSERT_NOT_NULL(strstr(szText, "{\"name\":\"TraceTestGPUPass\",\"cat\":\"gpu\",\"ph\":\"X\",\"ts\":0.000,\"dur\":500.000"),
+		"GPU passes must start at the batch's GPU base");
+	ZENITH_ASSERT_NULL(strstr(szText, ",\n,"), "no empty array entries");
+	ZENITH_ASSERT_NULL(strstr(szText, "[,"), "no leading separator");
+
+	delete pxBatch;
+	delete pxProfiling;
+}
+
+ZENITH_TEST(ProfileTrace, JSONStringEscaping)
+{
+	FILE* pxFile = Zenith_TestOpenTempFile();
+	if (pxFile == nullptr)
+	{
+		ZENITH_SKIP("no temp file available for the escaping round-trip");
+	}
+
+	Zenith_ProfileTraceStream::WriteJSONString(pxFile, "a\"b\\c\nd\te");
+	Zenith_ProfileTraceStream::WriteJSONString(pxFile, nullptr);
+
+	Zenith_Vector<char> xText;
+	ReadTraceFile(pxFile, xText);
+	fclose(pxFile);
+	ZENITH_ASSERT_EQ(strcmp(xText.GetDataPointer(), "\"a\\\"b\\\\c\\u000ad\\u0009e\"\"\""), 0, "escaped as '%s'", xText.GetDataPointer());
+}
+
+// The pool never grows: once every batch is out, frames are dropped and counted.
+ZENITH_TEST(ProfileTrace, BatchPoolDropsWhenExhausted)
+{
+	Zenith_Profiling* pxProfiling = new Zenith_Profiling();
+	Zenith_ProfileTraceStream* pxStream = new Zenith_ProfileTraceStream(*pxProfiling, 0);
+
+	for (u_int u = 0; u < Zenith_ProfileTraceStream::uMAX_QUEUED_BATCHES; ++u)
+	{
+		ZENITH_ASSERT_NOT_NULL(pxStream->AcquireBatch(), "batch %u of the pool must be available", u);
+	}
+	ZENITH_ASSERT_NULL(pxStream->AcquireBatch(), "an exhausted pool must drop the frame");
+	ZENITH_ASSERT_EQ(pxStream->GetDroppedFrames(), 1ull);
+
+	ZENITH_ASSERT_TRUE(pxStream->MarkThreadSeen(5));
+	ZENITH_ASSERT_FALSE(pxStream->MarkThreadSeen(5), "a thread must be named once");
+
+	// Never begun: the dtor's End is a no-op.
+	delete pxStream;
+	delete pxProfiling;
+}
+
+// AddLabel copies into the batch arena and refuses past the cap.
+ZENITH_TEST(ProfileTrace, BatchLabelArena)
+{
+	Zenith_ProfileTraceStream::Batch* pxBatch = new Zenith_ProfileTraceStream::Batch();
+	ZENITH_ASSERT_EQ(pxBatch->AddLabel(nullptr), Zenith_ProfileTraceStream::uNO_LABEL);
+
+	char acLabel[] = "TransientLabel";
+	const u_int uOffset = pxBatch->AddLabel(acLabel);
+	acLabel[0] = 'X';
+	ZENITH_ASSERT_EQ(strcmp(pxBatch->m_xLabels.GetDataPointer() + uOffset, "TransientLabel"), 0, "the label must be copied, not referenced");
+
+	char acLong[1024];
+	memset(acLong, 'L', sizeof(acLong) - 1);
+	acLong[sizeof(acLong) - 1] = '\0';
+	u_int uLast = 0;
+	for (u_int u = 0; u < 64; ++u)
+	{
+		uLast = pxBatch->AddLabel(acLong);
+	}
+	ZENITH_ASSERT_EQ(uLast, Zenith_ProfileTraceStream::uNO_LABEL, "the arena must cap at uMAX_LABEL_BYTES");
+	ZENITH_ASSERT_TRUE(pxBatch->m_xLabels.GetSize() <= Zenith_ProfileTraceStream::uMAX_LABEL_BYTES);
+
+	pxBatch->Reset();
+	ZENITH_ASSERT_EQ(pxBatch->m_xLabels.GetSize(), 0u);
+	delete pxBatch;
+}
+
+#endif // ZENITH_PROFILING_ENABLED
@@ -0,0 +1,344 @@
+#include "Zenith.h"
+
+#include "Profiling/Zenith_ProfileTrace.h"
+
+#include "Core/Multithreading/Zenith_Multithreading.h"
+
+#include <cstring>
+
+#if ZENITH_MEMORY_TRACKING_ANY
+#include "Memory/Zenith_MemoryCategories.h"
+#endif
+
+#if ZENITH_PROFILING_ENABLED
+
+// --- Batch -------------------------------------------------------------------
+
+void Zenith_ProfileTraceStream::Batch::Reset()
+{
+	m_xEvents.Clear();
+	m_xLabels.Clear();
+	m_xThreadNames.Clear();
+	m_xInstants.Clear();
+	m_xGPUPasses.Clear();
+	m_uGPUBaseTicks = 0;
+	m_pxBootEvents = nullptr;
+#if ZENITH_MEMORY_TRACKING_ANY
+	m_bHasMemorySample = false;
+	m_uMemorySampleTicks = 0;
+#endif
+}
+
+u_int Zenith_ProfileTraceStream::Batch::AddLabel(const char* szLabel)
+{
+	if (szLabel == nullptr) return uNO_LABEL;
+
+	const u_int uLength = static_cast<u_int>(strlen(szLabel));
+	const u_int uOffset = m_xLabels.GetSize();
+	if (uOffset + uLength + 1 > uMAX_LABEL_BYTES) return uNO_LABEL;
+
+	m_xLabels.Resize(uOffset + uLength + 1, '\0');
+	memcpy(m_xLabels.GetDataPointer() + uOffset, szLabel, uLength);
+	return uOffset;
+}
+
+// --- Stream ------------------------------------------------------------------
+
+Zenith_ProfileTraceStream::Zenith_ProfileTraceStream(const Zenith_Profiling& xNames, const u_int64 uOriginTicks)
+	: m_xNames(xNames)
+	, m_uOriginTicks(uOriginTicks)
+	, m_xWorkSem(0, uMAX_QUEUED_BATCHES + 1)
+	, m_xExitSem(0, 1)
+{
+	for (u_int u = 0; u < uMAX_QUEUED_BATCHES; ++u)
+	{
+		m_apxFree[u] = &m_axBatches[u];
+	}
+	m_uFreeCount = uMAX_QUEUED_BATCHES;
+}
+
+Zenith_ProfileTraceStream::~Zenith_ProfileTraceStream()
+{
+	End();
+}
+
+void Zenith_ProfileTraceStream::Begin(FILE* pxFile, const bool bOwnsFile, Zenith_Multithreading& xThreading)
+{
+	Zenith_Assert(!m_bRunning, "ProfileTraceStream::Begin: already running");
+	m_pxFile = pxFile;
+	m_bOwnsFile = bOwnsFile;
+	WriteHeader(m_pxFile, m_bFirstEvent);
+
+	m_bRunning = true;
+	xThreading.CreateThread("ProfileTrace", &WriterThreadMain, this);
+}
+
+void Zenith_ProfileTraceStream::End()
+{
+	if (!m_bRunning) return;
+
+	{
+		Zenith_ScopedMutexLock_T xLock(m_xMutex);
+		m_bStopRequested = true;
+	}
+	m_xWorkSem.Signal();
+	m_xExitSem.Wait();   // the writer has drained the queue and is gone
+	m_bRunning = false;
+
+	WriteFooter(m_pxFile);
+	fflush(m_pxFile);
+	if (m_bOwnsFile)
+	{
+		fclose(m_pxFile);
+	}
+	m_pxFile = nullptr;
+}
+
+Zenith_ProfileTraceStream::Batch* Zenith_ProfileTraceStream::AcquireBatch()
+{
+	Zenith_ScopedMutexLock_T xLock(m_xMutex);
+	if (m_uFreeCount == 0)
+	{
+		++m_uDroppedFrames;
+		return nullptr;
+	}
+	return m_apxFree[--m_uFreeCount];
+}
+
+void Zenith_ProfileTraceStream::SubmitBatch(Batch* pxBatch)
+{
+	{
+		Zenith_ScopedMutexLock_T xLock(m_xMutex);
+		for (u_int u = 0; u < m_xPendingInstants.GetSize(); ++u)
+		{
+			pxBatch->m_xInstants.PushBack(m_xPendingInstants.Get(u));
+		}
+		m_xPendingInstants.Clear();
+
+		m_apxQueued[(m_uQueueHead + m_uQueueCount) % uMAX_QUEUED_BATCHES] = pxBatch;
+		++m_uQueueCount;
+	}
+	m_xWorkSem.Signal();
+}
+
+void Zenith_ProfileTraceStream::AddInstant(const char* szName, const u_int64 uTicks)
+{
+	Zenith_ScopedMutexLock_T xLock(m_xMutex);
+	Instant xInstant;
+	xInstant.m_szName = szName;
+	xInstant.m_uTicks = uTicks;
+	m_xPendingInstants.PushBack(xInstant);
+}
+
+bool Zenith_ProfileTraceStream::MarkThreadSeen(const u_int uThreadID)
+{
+	if (uThreadID >= Zenith_Profiling::uMAX_PROFILE_THREADS || m_abThreadSeen[uThreadID]) return false;
+	m_abThreadSeen[uThreadID] = true;
+	return true;
+}
+
+void Zenith_ProfileTraceStream::WriterThreadMain(const void* pUserData)
+{
+	Zenith_ProfileTraceStream* pxSelf = static_cast<Zenith_ProfileTraceStream*>(const_cast<void*>(pUserData));
+	pxSelf->RunWriter();
+
+	// Free this thread's profiler ring before End returns, or Shutdown finds it
+	// still registered. Nothing may touch pxSelf after the signal.
+	Zenith_Profiling_Detail::UnregisterThread();
+	pxSelf->m_xExitSem.Signal();
+}
+
+void Zenith_ProfileTraceStream::RunWriter()
+{
+	for (;;)
+	{
+		m_xWorkSem.Wait();
+
+		Batch* pxBatch = nullptr;
+		{
+			Zenith_ScopedMutexLock_T xLock(m_xMutex);
+			if (m_uQueueCount == 0)
+			{
+				// Every batch signal was consumed with its batch, so this is the stop.
+				if (m_bStopRequested) return;
+				continue;
+			}
+			pxBatch = m_apxQueued[m_uQueueHead];
+			m_uQueueHead = (m_uQueueHead + 1) % uMAX_QUEUED_BATCHES;
+			--m_uQueueCount;
+		}
+
+		WriteBatch(m_pxFile, *pxBatch, m_xNames, m_uOriginTicks, m_bFirstEvent);
+		// A crash mid-soak is exactly when the tail matters.
+		fflush(m_pxFile);
+		m_uWrittenFrames.fetch_add(1, std::memory_order_relaxed);
+
+		pxBatch->Reset();
+		Zenith_ScopedMutexLock_T xLock(m_xMutex);
+		m_apxFree[m_uFreeCount++] = pxBatch;
+	}
+}
+
+// --- Formatting --------------------------------------------------------------
+
+static double TicksToTraceUs(const u_int64 uTicks, const u_int64 uOriginTicks)
+{
+	return static_cast<double>(static_cast<int64_t>(uTicks - uOriginTicks)) * Zenith_Profiling_Detail::GetTicksToNs() / 1.0e3;
+}
+
+static void WriteSeparator(FILE* pxFile, bool& bFirst)
+{
+	fputs(bFirst ? "\n" : ",\n", pxFile);
+	bFirst = false;
+}
+
+static void WriteCompleteEvent(FILE* pxFile, bool& bFirst, const char* szName, const char* szCategory,
+	const u_int64 uBeginTicks, const u_int64 uEndTicks, const u_int uTrackID, const u_int64 uOriginTicks)
+{
+	const double fBeginUs = TicksToTraceUs(uBeginTicks, uOriginTicks);
+	const double fEndUs = TicksToTraceUs(uEndTicks, uOriginTicks);
+	WriteSeparator(pxFile, bFirst);
+	fputs("{\"name\":", pxFile);
+	Zenith_ProfileTraceStream::WriteJSONString(pxFile, szName);
+	fputs(",\"cat\":", pxFile);
+	Zenith_ProfileTraceStream::WriteJSONString(pxFile, szCategory);
+	fprintf(pxFile, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+		fBeginUs, fEndUs > fBeginUs ? fEndUs - fBeginUs : 0.0, uTrackID);
+}
+
+static void WriteThreadNameEvent(FILE* pxFile, bool& bFirst, const u_int uTrackID, const char* szName)
+{
+	WriteSeparator(pxFile, bFirst);
+	fprintf(pxFile, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", uTrackID);
+	Zenith_ProfileTraceStream::WriteJSONString(pxFile, szName);
+	fputs("}}", pxFile);
+}
+
+void Zenith_ProfileTraceStream::WriteJSONString(FILE* pxFile, const char* szText)
+{
+	fputc('"', pxFile);
+	for (const char* pc = szText != nullptr ? szText : ""; *pc != '\0'; ++pc)
+	{
+		const unsigned char uc = static_cast<unsigned char>(*pc);
+		if (uc == '"' || uc == '\\')
+		{
+			fputc('\\', pxFile);
+			fputc(uc, pxFile);
+		}
+		else if (uc < 0x20)
+		{
+			fprintf(pxFile, "\\u%04x", uc);
+		}
+		else
+		{
+			fputc(uc, pxFile);
+		}
+	}
+	fputc('"', pxFile);
+}
+
+void Zenith_ProfileTraceStream::WriteHeader(FILE* pxFile, bool& bFirst)
+{
+	fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", pxFile);
+	bFirst = true;
+	WriteSeparator(pxFile, bFirst);
+	fputs("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Zenith\"}}", pxFile);
+	WriteThreadNameEvent(pxFile, bFirst, uGPU_TRACK_ID, "GPU");
+}
+
+void Zenith_ProfileTraceStream::WriteFooter(FILE* pxFile)
+{
+	fputs("\n]}\n", pxFile);
+}
+
+void Zenith_ProfileTraceStream::WriteBatch(FILE* pxFile, const Batch& xBatch, const Zenith_Profiling& xNames, const u_int64 uOriginTicks, bool& bFirst)
+{
+	for (u_int u = 0; u < xBatch.m_xThreadNames.GetSize(); ++u)
+	{
+		const ThreadName& xName = xBatch.m_xThreadNames.Get(u);
+		WriteThreadNameEvent(pxFile, bFirst, xName.m_uThreadID, xName.m_acName);
+	}
+
+	if (xBatch.m_pxBootEvents != nullptr)
+	{
+		for (u_int u = 0; u < xBatch.m_pxBootEvents->GetSize(); ++u)
+		{
+			const Zenith_Profiling::BootRawEvent& xRaw = xBatch.m_pxBootEvents->Get(u);
+			WriteCompleteEvent(pxFile, bFirst, xNames.GetZoneName(xRaw.m_xEvent.m_uZoneID), "boot",
+				xRaw.m_xEvent.m_uBeginTicks, xRaw.m_xEvent.m_uEndTicks, xRaw.m_uThreadID, uOriginTicks);
+		}
+	}
+
+	for (u_int u = 0; u < xBatch.m_xInstants.GetSize(); ++u)
+	{
+		const Instant& xInstant = xBatch.m_xInstants.Get(u);
+		WriteSeparator(pxFile, bFirst);
+		fputs("{\"name\":", pxFile);
+		WriteJSONString(pxFile, xInstant.m_szName);
+		fprintf(pxFile, ",\"cat\":\"marker\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":1,\"tid\":0}",
+			TicksToTraceUs(xInstant.m_uTicks, uOriginTicks));
+	}
+
+	for (u_int u = 0; u < xBatch.m_xEvents.GetSize(); ++u)
+	{
+		const TraceEvent& xEvent = xBatch.m_xEvents.Get(u);
+		const char* szZone = xNames.GetZoneName(xEvent.m_uZoneID);
+		if (xEvent.m_uLabelOffset != uNO_LABEL)
+		{
+			WriteCompleteEvent(pxFile, bFirst, xBatch.m_xLabels.GetDataPointer() + xEvent.m_uLabelOffset, szZone,
+				xEvent.m_uBeginTicks, xEvent.m_uEndTicks, xEvent.m_uThreadID, uOriginTicks);
+		}
+		else
+		{
+			WriteCompleteEvent(pxFile, bFirst, szZone, "cpu",
+				xEvent.m_uBeginTicks, xEvent.m_uEndTicks, xEvent.m_uThreadID, uOriginTicks);
+		}
+	}
+
+	// GPU passes have durations but no timestamps: lay them end to end.
+	double fGPUUs = TicksToTraceUs(xBatch.m_uGPUBaseTicks, uOriginTicks);
+	for (u_int u = 0; u < xBatch.m_xGPUPasses.GetSize(); ++u)
+	{
+		const Zenith_Profiling::GPUPass& xPass = xBatch.m_xGPUPasses.Get(u);
+		const double fDurationUs = xPass.m_fMilliseconds * 1.0e3;
+		WriteSeparator(pxFile, bFirst);
+		fputs("{\"name\":", pxFile);
+		WriteJSONString(pxFile, xPass.m_szName);
+		fprintf(pxFile, ",\"cat\":\"gpu\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"exec\":%u}}",
+			fGPUUs, fDurationUs, uGPU_TRACK_ID, xPass.m_uExecIndex);
+		fGPUUs += fDurationUs;
+	}
+
+#if ZENITH_MEMORY_TRACKING_ANY
+	if (xBatch.m_bHasMemorySample)
+	{
+		const Zenith_MemoryFrameSample& xSample = xBatch.m_xMemorySample;
+		const double fTs = TicksToTraceUs(xBatch.m_uMemorySampleTicks, uOriginTicks);
+		WriteSeparator(pxFile, bFirst);
+		fprintf(pxFile, "{\"name\":\"Memory\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{\"total_mb\":%.3f,\"allocations\":%llu}}",
+			fTs, static_cast<double>(xSample.m_ulTotalBytes) / (1024.0 * 1024.0),
+			static_cast<unsigned long long>(xSample.m_ulTotalAllocations));
+
+		const u_int uCategories = xSample.m_uCategoryCount < static_cast<u_int>(MEMORY_CATEGORY_COUNT)
+			? xSample.m_uCategoryCount : static_cast<u_int>(MEMORY_CATEGORY_COUNT);
+		if (uCategories > 0)
+		{
+			WriteSeparator(pxFile, bFirst);
+			fprintf(pxFile, "{\"name\":\"Memory by category (MB)\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{", fTs);
+			for (u_int c = 0; c < uCategories; ++c)
+			{
+				if (c > 0) fputc(',', pxFile);
+				WriteJSONString(pxFile, g_aszMemoryCategoryNames[c]);
+				fprintf(pxFile, ":%.3f", static_cast<double>(xSample.m_aulCategoryBytes[c]) / (1024.0 * 1024.0));
+			}
+			fputs("}}", pxFile);
+		}
+	}
+#endif
+}
+
+#endif // ZENITH_PROFILING_ENABLED
+
+#ifdef ZENITH_TESTING
+#include "Profiling/Zenith_ProfileTrace.Tests.inl"
+#endif
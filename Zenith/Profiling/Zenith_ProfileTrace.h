@@ -0,0 +1,164 @@
+#pragma once
+
+#include "Profiling/Zenith_Profiling.h"
+
+#include <cstdio>
+
+// ============================================================================
+// Zenith_ProfileTraceStream
+//
+// Continuous capture of everything the profiler sees to a Chrome trace-event
+// JSON file, for sessions far longer than the uFRAME_HISTORY window (soak tests
+// hunting an intermittent hitch). The file opens in chrome://tracing and in the
+// Perfetto UI (ui.perfetto.dev), which imports the JSON format directly.
+//
+// Started by --profile-trace[=path] or Zenith_Profiling::BeginTraceCapture.
+//
+// Threading. The per-thread rings keep their single consumer: EndFrame drains
+// them exactly as before, then copies the frame's events into a Batch and
+// queues it. A writer thread formats and writes batches, so the main thread
+// never formats text or touches the disk. Batches are a fixed pool: when the
+// writer falls uMAX_QUEUED_BATCHES frames behind, a frame is dropped (and
+// counted) rather than stalling the game or growing memory.
+//
+// What lands in the file:
+//   - every CPU zone, one complete ("X") event per scope, on its thread's track
+//     (runtime labels become the event name, the zone its category);
+//   - thread names ("Main", or the name given to CreateThread);
+//   - GPU passes, on a "GPU" track. The readback is deferred, so each capture
+//     is laid out back to back from the start of the frame that published it:
+//     durations are exact, placement is approximate;
+//   - memory samples as counters (total and per category);
+//   - the sealed boot capture (raw events and phase markers) once, plus
+//     milestones recorded after the seal, as instant events.
+//
+// Timestamps are microseconds from profiler construction (the boot capture's
+// fallback origin). Platform markers taken before the engine existed land at
+// negative times, which both viewers accept.
+// ============================================================================
+class Zenith_ProfileTraceStream
+{
+public:
+	static constexpr u_int uMAX_QUEUED_BATCHES = 16;
+	static constexpr u_int uMAX_LABEL_BYTES    = 32 * 1024;   // per batch
+	// Synthetic track id for GPU passes, past any real profiler thread id.
+	static constexpr u_int uGPU_TRACK_ID = Zenith_Profiling::uMAX_PROFILE_THREADS;
+	static constexpr u_int uNO_LABEL     = ~0u;
+
+	struct TraceEvent
+	{
+		u_int64 m_uBeginTicks = 0;
+		u_int64 m_uEndTicks = 0;
+		Zenith_ProfileZoneID m_uZoneID = ZENITH_PROFILE_ZONE_NULL;
+		u_int m_uThreadID = 0;
+		u_int m_uLabelOffset = uNO_LABEL;   // into Batch::m_xLabels
+	};
+
+	struct ThreadName
+	{
+		u_int m_uThreadID = 0;
+		char  m_acName[Zenith_Profiling::uMAX_THREAD_NAME] = {};
+	};
+
+	// Instant event: boot phase markers and milestones (static-literal names).
+	struct Instant
+	{
+		const char* m_szName = nullptr;
+		u_int64     m_uTicks = 0;
+	};
+
+	// One frame's worth of work for the writer. Filled on the main thread,
+	// written and recycled by the writer. Clear() keeps capacity, so a warmed-up
+	// pool never reallocates.
+	struct Batch
+	{
+		void Reset();
+
+		// Copies szLabel into m_xLabels; uNO_LABEL when null or the arena is full
+		// (the event then falls back to its zone name).
+		u_int AddLabel(const char* szLabel);
+
+		Zenith_Vector<TraceEvent> m_xEvents;
+		Zenith_Vector<char>       m_xLabels;
+		Zenith_Vector<ThreadName> m_xThreadNames;
+		Zenith_Vector<Instant>    m_xInstants;
+
+		Zenith_Vector<Zenith_Profiling::GPUPass> m_xGPUPasses;
+		u_int64 m_uGPUBaseTicks = 0;
+
+		// Sealed boot capture: immutable after the seal and outlives the stream
+		// (Shutdown ends the stream before freeing it).
+		const Zenith_Vector<Zenith_Profiling::BootRawEvent>* m_pxBootEvents = nullptr;
+
+#if ZENITH_MEMORY_TRACKING_ANY
+		bool m_bHasMemorySample = false;
+		u_int64 m_uMemorySampleTicks = 0;
+		Zenith_MemoryFrameSample m_xMemorySample{};
+#endif
+	};
+
+	// xNames resolves zone ids on the writer thread (the zone table is reader-safe).
+	Zenith_ProfileTraceStream(const Zenith_Profiling& xNames, u_int64 uOriginTicks);
+	~Zenith_ProfileTraceStream();
+	Zenith_ProfileTraceStream(const Zenith_ProfileTraceStream&) = delete;
+	Zenith_ProfileTraceStream& operator=(const Zenith_ProfileTraceStream&) = delete;
+
+	// Writes the file header and starts the writer thread on xThreading. Takes
+	// ownership of pxFile when bOwnsFile (closed by End).
+	void Begin(FILE* pxFile, bool bOwnsFile, Zenith_Multithreading& xThreading);
+
+	// Writes everything still queued, the file footer, and joins the writer.
+	void End();
+
+	// Main thread. Null when every batch is still queued: the caller skips the
+	// frame (counted in GetDroppedFrames).
+	Batch* AcquireBatch();
+	void   SubmitBatch(Batch* pxBatch);
+
+	// Queues an instant event into the next submitted batch. Any thread.
+	void AddInstant(const char* szName, u_int64 uTicks);
+
+	// Main thread: true the first time a thread id is seen, so the caller names it once.
+	bool MarkThreadSeen(u_int uThreadID);
+
+	u_int64 GetWrittenFrames() const { return m_uWrittenFrames.load(std::memory_order_relaxed); }
+	u_int64 GetDroppedFrames() const { return m_uDroppedFrames; }
+
+	// Formatting, writer-thread side. Static + engine-free so the tests drive it
+	// against a temp file without a writer thread.
+	// bFirst tracks the JSON array separator across calls; WriteHeader clears it.
+	static void WriteHeader(FILE* pxFile, bool& bFirst);
+	static void WriteFooter(FILE* pxFile);
+	static void WriteBatch(FILE* pxFile, const Batch& xBatch, const Zenith_Profiling& xNames, u_int64 uOriginTicks, bool& bFirst);
+	static void WriteJSONString(FILE* pxFile, const char* szText);
+
+private:
+	static void WriterThreadMain(const void* pUserData);
+	void RunWriter();
+
+	const Zenith_Profiling& m_xNames;
+	const u_int64 m_uOriginTicks;
+
+	FILE* m_pxFile = nullptr;
+	bool  m_bOwnsFile = false;
+	bool  m_bRunning = false;
+	bool  m_bFirstEvent = true;   // writer-owned
+
+	// Pool + FIFO of batch pointers, under m_xMutex. m_xWorkSem counts queued
+	// batches plus the stop request; m_xExitSem is signalled by the writer last.
+	Zenith_Mutex_NoProfiling m_xMutex;
+	Batch  m_axBatches[uMAX_QUEUED_BATCHES];
+	Batch* m_apxFree[uMAX_QUEUED_BATCHES] = {};
+	u_int  m_uFreeCount = 0;
+	Batch* m_apxQueued[uMAX_QUEUED_BATCHES] = {};
+	u_int  m_uQueueHead = 0;
+	u_int  m_uQueueCount = 0;
+	bool   m_bStopRequested = false;
+	Zenith_Vector<Instant> m_xPendingInstants;
+	Zenith_Semaphore m_xWorkSem;
+	Zenith_Semaphore m_xExitSem;
+
+	bool m_abThreadSeen[Zenith_Profiling::uMAX_PROFILE_THREADS] = {};   // main thread
+	u_int64 m_uDroppedFrames = 0;                                       // main thread
+	std::atomic<u_int64> m_uWrittenFrames{ 0 };
+};
@@ -1,11 +1,14 @@
 #include "Zenith.h"
 
 #include "Profiling/Zenith_Profiling.h"
+#include "Profiling/Zenith_ProfileTrace.h"
+#include "Profiling/Zenith_PerfCounters.h"
 
 #include "Core/Zenith_EditorWindowNames.h"
 
 #include "Core/Zenith_CommandLine.h"
 #include "Core/Zenith_Engine.h"
+#include "Core/Zenith_PlatformStdio.h"
 #include "Core/Multithreading/Zenith_Multithreading.h"
 #include "DebugVariables/Zenith_DebugVariables.h"
 
@@ -398,6 +401,110 @@ static void CopyInto(Zenith_Profiling::Snapshot& xDst, const Zenith_Profiling::S
 	xDst.m_uEndTicks = xSrc.m_uEndTicks;
 }
 
+// --- Streaming trace: batch fill (main thread) ------------------------------
+// The writer thread owns all formatting and I/O; these only copy into a pooled
+// batch. A null batch means the writer is uMAX_QUEUED_BATCHES frames behind: the
+// frame is dropped (the stream counts it) and anything not yet streamed (thread
+// names, GPU capture, memory sample) stays pending for the next one.
+
+static void AddTraceThreadName(Zenith_ProfileTraceStream::Batch& xBatch, const Zenith_Profiling& xSelf, const u_int uThreadID)
+{
+	Zenith_ProfileTraceStream::ThreadName xName;
+	xName.m_uThreadID = uThreadID;
+	xSelf.GetThreadName(uThreadID, xName.m_acName, sizeof(xName.m_acName));
+	xBatch.m_xThreadNames.PushBack(xName);
+}
+
+static void SubmitTraceFrame(Zenith_Profiling& xSelf, Zenith_ProfileTraceStream& xStream, const Zenith_Profiling::Snapshot& xFrame)
+{
+	Zenith_ProfileTraceStream::Batch* pxBatch = xStream.AcquireBatch();
+	if (pxBatch == nullptr) return;
+
+	for (Zenith_HashMap<u_int, Zenith_Vector<Zenith_Profiling::Event>>::Iterator xIt(xFrame.m_xThreadEvents); !xIt.Done(); xIt.Next())
+	{
+		const u_int uThreadID = xIt.GetKey();
+		const Zenith_Vector<Zenith_Profiling::Event>& xEvents = xIt.GetValue();
+		if (xEvents.GetSize() == 0) continue;
+
+		if (xStream.MarkThreadSeen(uThreadID))
+		{
+			AddTraceThreadName(*pxBatch, xSelf, uThreadID);
+		}
+		for (u_int u = 0; u < xEvents.GetSize(); ++u)
+		{
+			const Zenith_Profiling::Event& xEvent = xEvents.Get(u);
+			Zenith_ProfileTraceStream::TraceEvent xTrace;
+			xTrace.m_uBeginTicks = xEvent.m_uBeginTicks;
+			xTrace.m_uEndTicks = xEvent.m_uEndTicks;
+			xTrace.m_uZoneID = xEvent.m_uZoneID;
+			xTrace.m_uThreadID = uThreadID;
+			xTrace.m_uLabelOffset = pxBatch->AddLabel(xEvent.m_szLabel);
+			pxBatch->m_xEvents.PushBack(xTrace);
+		}
+	}
+
+	if (xSelf.m_uGPUCaptureSerial != xSelf.m_uTraceGPUSerial)
+	{
+		for (u_int u = 0; u < xSelf.m_xGPUPasses.GetSize(); ++u)
+		{
+			pxBatch->m_xGPUPasses.PushBack(xSelf.m_xGPUPasses.Get(u));
+		}
+		pxBatch->m_uGPUBaseTicks = xFrame.m_uBeginTicks;
+		xSelf.m_uTraceGPUSerial = xSelf.m_uGPUCaptureSerial;
+	}
+
+#if ZENITH_MEMORY_TRACKING_ANY
+	if (xSelf.m_bTraceMemoryPending)
+	{
+		pxBatch->m_bHasMemorySample = true;
+		pxBatch->m_xMemorySample = xSelf.m_xTraceMemSample;
+		pxBatch->m_uMemorySampleTicks = xSelf.m_uTraceMemoryTicks;
+		xSelf.m_bTraceMemoryPending = false;
+	}
+#endif
+
+	xStream.SubmitBatch(pxBatch);
+}
+
+// Once per stream, after the seal: the raw boot timeline (immutable from the seal
+// until Shutdown, which ends the stream first), its markers and milestones, and
+// the names of every thread that has registered so far.
+static void SubmitTraceBoot(Zenith_Profiling& xSelf, Zenith_ProfileTraceStream& xStream)
+{
+	const Zenith_Profiling::BootCapture* pxCapture = xSelf.GetBootCapture();
+	if (pxCapture == nullptr) return;
+	Zenith_ProfileTraceStream::Batch* pxBatch = xStream.AcquireBatch();
+	if (pxBatch == nullptr) return;
+
+	pxBatch->m_pxBootEvents = &pxCapture->m_xRawEvents;
+	for (u_int u = 0; u < pxCapture->m_uMarkerCount; ++u)
+	{
+		Zenith_ProfileTraceStream::Instant xInstant;
+		xInstant.m_szName = pxCapture->m_axMarkers[u].m_szName;
+		xInstant.m_uTicks = pxCapture->m_axMarkers[u].m_uTicks;
+		pxBatch->m_xInstants.PushBack(xInstant);
+	}
+	for (u_int u = 0; u < pxCapture->m_uMilestoneCount; ++u)
+	{
+		Zenith_ProfileTraceStream::Instant xInstant;
+		xInstant.m_szName = pxCapture->m_axMilestones[u].m_szName;
+		xInstant.m_uTicks = pxCapture->m_axMilestones[u].m_uTicks;
+		pxBatch->m_xInstants.PushBack(xInstant);
+	}
+
+	const Zenith_Profiling::BootControlBlock* pxControl = xSelf.GetControlBlock();
+	for (u_int uThreadID = 0; uThreadID < Zenith_Profiling::uMAX_PROFILE_THREADS; ++uThreadID)
+	{
+		if (pxControl->m_abThreadRegistered[uThreadID] && xStream.MarkThreadSeen(uThreadID))
+		{
+			AddTraceThreadName(*pxBatch, xSelf, uThreadID);
+		}
+	}
+
+	xStream.SubmitBatch(pxBatch);
+	xSelf.m_bTraceBootWritten = true;
+}
+
 // --- Boot capture storage -------------------------------------------------
 // Engine-free by construction: every method below touches only the struct, so a
 // unit test can drive truncation, late routing and drop accounting with a local
@@ -685,12 +792,21 @@ void Zenith_Profiling::Initialise(Zenith_Multithreading& xThreading)
 	}
 
 	m_bInitialised = true;
+
+	if (const char* szTracePath = Zenith_CommandLine::GetProfileTracePath())
+	{
+		BeginTraceCapture(szTracePath);
+	}
 }
 
 void Zenith_Profiling::Shutdown()
 {
 	if (m_pxControl == nullptr) return;
 
+	// First: the writer thread unregisters on exit, and its queued batches still
+	// reference the boot capture.
+	EndTraceCapture();
+
 	const u_int uMainID = m_pxThreading ? m_pxThreading->GetMainThreadID() : ~0u;
 	bool bAllRingsFreed = true;
 
@@ -762,9 +878,10 @@ Zenith_Profiling::ThreadBuffer* Zenith_Profiling::GetThreadBuffer(const u_int uT
 void Zenith_Profiling::RegisterThread()
 {
 	// Runs during engine bootstrap BEFORE Initialise() stores m_pxThreading (the
-	// main thread registers first), so the thread-id query goes through
+	// main thread registers first), so the thread queries go through
 	// g_xEngine.Threading().
-	const u_int uThreadID = g_xEngine.Threading().GetCurrentThreadID();
+	Zenith_Multithreading& xThreading = g_xEngine.Threading();
+	const u_int uThreadID = xThreading.GetCurrentThreadID();
 	if (uThreadID >= uMAX_PROFILE_THREADS)
 	{
 		Zenith_Warning(LOG_CATEGORY_CORE, "Profiling: thread id %u >= uMAX_PROFILE_THREADS (%u); this thread will not be profiled", uThreadID, uMAX_PROFILE_THREADS);
@@ -786,9 +903,30 @@ void Zenith_Profiling::RegisterThread()
 		pxBuf->m_pxControl = m_pxControl;   // stamped once, never cleared
 		m_pxControl->m_apxThreadBuffers[uThreadID].store(pxBuf, std::memory_order_release);
 	}
+	snprintf(m_pxControl->m_aacThreadNames[uThreadID], uMAX_THREAD_NAME, "%s", xThreading.GetCurrentThreadName());
+	m_pxControl->m_abThreadRegistered[uThreadID] = true;
 	tl_pxBuffer = pxBuf;
 }
 
+void Zenith_Profiling::GetThreadName(const u_int uThreadID, char* acOut, const size_t ulSize) const
+{
+	if (uThreadID == m_uMainThreadID)
+	{
+		snprintf(acOut, ulSize, "Main");
+		return;
+	}
+	if (m_pxControl != nullptr && uThreadID < uMAX_PROFILE_THREADS)
+	{
+		Zenith_ScopedMutexLock_T xLock(m_pxControl->m_xMutex);
+		if (m_pxControl->m_aacThreadNames[uThreadID][0] != '\0')
+		{
+			snprintf(acOut, ulSize, "%s", m_pxControl->m_aacThreadNames[uThreadID]);
+			return;
+		}
+	}
+	snprintf(acOut, ulSize, "Thread %u", uThreadID);
+}
+
 void Zenith_Profiling::UnregisterThread()
 {
 	// Producer-thread exit: FLUSH this thread's ring (it can hold the only record of
@@ -935,6 +1073,11 @@ void Zenith_Profiling::EndBootCapture(const Zenith_BootMarkerBundle* pxBundle)
 	}
 
 	LogBootSummaryLine(m_pxBootCapture, uOriginTicks, uCutoffTicks);
+
+	if (m_pxTraceStream != nullptr && !m_bTraceBootWritten && IsBootCaptureSealed())
+	{
+		SubmitTraceBoot(*this, *m_pxTraceStream);
+	}
 }
 
 void Zenith_Profiling::AddBootMarker(const char* szName)
@@ -950,6 +1093,12 @@ void Zenith_Profiling::AddBootMarker(const char* szName, const u_int64 uTicks)
 	const u_int uState = m_pxControl->m_uState.load(std::memory_order_relaxed);
 	if (uState == BOOT_CAPTURE_DISABLED || uState == BOOT_CAPTURE_DEAD) return;
 	m_pxBootCapture->AddMarker(szName, uTicks);
+
+	// The trace already holds the sealed capture; later markers go in as instants.
+	if (m_pxTraceStream != nullptr && m_bTraceBootWritten)
+	{
+		m_pxTraceStream->AddInstant(szName, uTicks);
+	}
 }
 
 void Zenith_Profiling::RecordBootMilestone(const char* szName)
@@ -959,7 +1108,14 @@ void Zenith_Profiling::RecordBootMilestone(const char* szName)
 	Zenith_ScopedMutexLock_T xLock(m_pxControl->m_xMutex);
 	const u_int uState = m_pxControl->m_uState.load(std::memory_order_relaxed);
 	if (uState == BOOT_CAPTURE_DISABLED || uState == BOOT_CAPTURE_DEAD) return;
-	m_pxBootCapture->SetMilestone(szName, Zenith_Profiling_Detail::GetTimestamp());
+	const bool bFirst = m_pxBootCapture->FindMilestone(szName) == nullptr;
+	const u_int64 uTicks = Zenith_Profiling_Detail::GetTimestamp();
+	m_pxBootCapture->SetMilestone(szName, uTicks);
+
+	if (bFirst && m_pxTraceStream != nullptr && m_bTraceBootWritten)
+	{
+		m_pxTraceStream->AddInstant(szName, uTicks);
+	}
 }
 
 bool Zenith_Profiling::IsBootCaptureSealed() const
@@ -993,18 +1149,36 @@ void Zenith_Profiling::BeginFrame()
 
 void Zenith_Profiling::EndFrame()
 {
+	// Counters merge every frame, paused or not, so a frame's delta is never lumped
+	// into the next one.
+	Zenith_PerfCounters::EndFrame();
+
 	// Close TOTAL_FRAME so its event lands in a ring, then drain.
 	EndProfileZone(m_uTotalFrameZone);
 	m_pxAccumulator->m_uEndTicks = Zenith_Profiling_Detail::GetTimestamp();
 
 	if (dbg_bPauseRequested)
 	{
-		// Paused: drain-and-discard (no back-pressure) and freeze the display.
-		DrainAllRings(*this, nullptr);
+		// Paused: drain-and-discard (no back-pressure) and freeze the display. A
+		// running trace keeps recording: the accumulator is reset at BeginFrame and
+		// never published while paused.
+		if (m_pxTraceStream != nullptr)
+		{
+			DrainAllRings(*this, m_pxAccumulator);
+			SubmitTraceFrame(*this, *m_pxTraceStream, *m_pxAccumulator);
+		}
+		else
+		{
+			DrainAllRings(*this, nullptr);
+		}
 		return;
 	}
 
 	DrainAllRings(*this, m_pxAccumulator);
+	if (m_pxTraceStream != nullptr)
+	{
+		SubmitTraceFrame(*this, *m_pxTraceStream, *m_pxAccumulator);
+	}
 
 	// Publish via O(1) pointer swap. The displaced display storage becomes next
 	// frame's accumulator and is reused (no container assignment, no realloc).
@@ -1036,11 +1210,58 @@ void Zenith_Profiling::EndFrame()
 #endif
 }
 
+// --- Streaming trace --------------------------------------------------------
+
+bool Zenith_Profiling::BeginTraceCapture(const char* szPath)
+{
+	if (m_pxTraceStream != nullptr || m_pxControl == nullptr || m_pxThreading == nullptr) return false;
+
+	FILE* pxFile = Zenith_PlatformStdio::OpenFile(szPath, "wb");
+	if (pxFile == nullptr)
+	{
+		Zenith_Warning(LOG_CATEGORY_CORE, "Profiling: could not open trace file '%s'", szPath);
+		return false;
+	}
+
+	m_pxTraceStream = new Zenith_ProfileTraceStream(*this, m_pxControl->m_uInitTicks);
+	m_uTraceGPUSerial = m_uGPUCaptureSerial;   // only captures published from now on
+	m_bTraceMemoryPending = false;
+	m_bTraceBootWritten = false;
+	m_pxTraceStream->Begin(pxFile, true, *m_pxThreading);
+	Zenith_Log(LOG_CATEGORY_CORE, "[Profiling] Trace capture started: %s", szPath);
+
+	// Started after the seal (from the UI): the boot capture goes in first.
+	if (IsBootCaptureSealed())
+	{
+		SubmitTraceBoot(*this, *m_pxTraceStream);
+	}
+	return true;
+}
+
+void Zenith_Profiling::EndTraceCapture()
+{
+	if (m_pxTraceStream == nullptr) return;
+
+	m_pxTraceStream->End();
+	Zenith_Log(LOG_CATEGORY_CORE, "[Profiling] Trace capture ended: %llu frames written, %llu dropped",
+		static_cast<unsigned long long>(m_pxTraceStream->GetWrittenFrames()),
+		static_cast<unsigned long long>(m_pxTraceStream->GetDroppedFrames()));
+	delete m_pxTraceStream;
+	m_pxTraceStream = nullptr;
+}
+
 #if ZENITH_MEMORY_TRACKING_ANY
 void Zenith_Profiling::PushMemorySample(const Zenith_MemoryFrameSample& xSample)
 {
 	// Skip while paused so the Memory tab freezes with the CPU/GPU timeline (the last
 	// sample + history persist). Main-thread only — no locking, just a POD copy + ring push.
+	// A running trace takes every sample, paused or not.
+	if (m_pxTraceStream != nullptr)
+	{
+		m_xTraceMemSample = xSample;
+		m_uTraceMemoryTicks = Zenith_Profiling_Detail::GetTimestamp();
+		m_bTraceMemoryPending = true;
+	}
 	if (dbg_bPauseRequested)
 	{
 		return;
@@ -1180,6 +1401,24 @@ void Zenith_Profiling::EndGPUCapture()
 	m_fWorstGPUMs = std::max(m_fWorstGPUMs, fMs);
 }
 
+// --- Frame system graph channel (main thread only) ----------------------------
+// Zenith_FrameGraph republishes every frame; Clear() keeps capacity.
+void Zenith_Profiling::BeginFrameSystemCapture()
+{
+	m_xFrameSystems.Clear();
+}
+
+void Zenith_Profiling::AddFrameSystem(const FrameSystem& xSystem)
+{
+	m_xFrameSystems.PushBack(xSystem);
+}
+
+void Zenith_Profiling::EndFrameSystemCapture(double fWallMs, double fCriticalPathMs)
+{
+	m_fFrameSystemWallMs = fWallMs;
+	m_fFrameSystemCriticalPathMs = fCriticalPathMs;
+}
+
 bool Zenith_Profiling::GetDisplayLabeledZoneTotalMs(const char* szZoneName,
 	const char* szLabel, double& fMillisecondsOut) const
 {
@@ -1484,6 +1723,32 @@ namespace
 		}
 	}
 
+	// Engine frame systems (Zenith_FrameGraph) in registration order. "crit" marks
+	// the critical path; serial is what the same systems would cost back to back,
+	// so serial / wall is the overlap the graph bought.
+	void WriteFrameSystemsSection(FILE* pFile, const Zenith_Vector<Zenith_Profiling::FrameSystem>& xSystems,
+		double fWallMs, double fCriticalPathMs)
+	{
+		if (xSystems.GetSize() == 0)
+			return;
+
+		double fSerialMs = 0.0;
+		for (u_int i = 0; i < xSystems.GetSize(); ++i) fSerialMs += xSystems.Get(i).m_fMilliseconds;
+
+		fprintf(pFile, "\n=== Frame Systems (Zenith_FrameGraph, registration order) ===\n");
+		fprintf(pFile, "Wall: %.3f ms  Critical path: %.3f ms  Serial: %.3f ms across %u systems\n\n",
+			fWallMs, fCriticalPathMs, fSerialMs, xSystems.GetSize());
+		fprintf(pFile, "%-32s %6s %10s %10s %5s\n", "System", "thread", "start (ms)", "ms", "crit");
+		fprintf(pFile, "-------------------------------- ------ ---------- ---------- -----\n");
+		for (u_int i = 0; i < xSystems.GetSize(); ++i)
+		{
+			const Zenith_Profiling::FrameSystem& xSystem = xSystems.Get(i);
+			fprintf(pFile, "%-32s %6s %10.3f %10.3f %5s\n", xSystem.m_szName ? xSystem.m_szName : "(unnamed)",
+				xSystem.m_bMainThread ? "main" : "any", xSystem.m_fStartMs, xSystem.m_fMilliseconds,
+				xSystem.m_bOnCriticalPath ? "*" : "");
+		}
+	}
+
 	// Per-pass CPU RECORD cost (by label = pass DebugName), sorted by CPU cost, with
 	// the matched GPU cost alongside — closes the gap where the "Flux Record Pass"
 	// zone aggregated away WHICH pass is expensive to record on the CPU. Pass names
@@ -1553,6 +1818,8 @@ void Zenith_Profiling::WriteTextReport(FILE* pFile)
 	WriteHeadlineAndZoneTable(pFile, *this, fDisplayFrameMs, uThreadCount, uTotalEvents, xSorted, xStats);
 	WriteGPUPassesSection(pFile, m_xGPUPasses, m_fGPUTotalMs);
 	WritePerPassCPUVsGPUSection(pFile, xLabelStats, m_xGPUPasses);
+	WriteFrameSystemsSection(pFile, m_xFrameSystems, m_fFrameSystemWallMs, m_fFrameSystemCriticalPathMs);
+	Zenith_PerfCounters::WriteReport(pFile);
 
 #if ZENITH_MEMORY_TRACKING_ANY
 	// Combined CPU+GPU+memory snapshot: a single --profiling-dump now also covers memory.
@@ -1788,15 +2055,6 @@ static void DeriveCategory(const char* szName, char* acOut, u_int uOutSize)
 	}
 }
 
-// Friendly lane label: the main thread reads "Main", others "Thread N".
-static void FormatThreadLaneName(char* pszOut, size_t uSize, u_int uThreadID, u_int uMainThreadID)
-{
-	if (uThreadID == uMainThreadID)
-		snprintf(pszOut, uSize, "Main");
-	else
-		snprintf(pszOut, uSize, "Thread %u", uThreadID);
-}
-
 // Aggregated per-zone statistics for the displayed frame, summed across all threads,
 // with a substring filter and total-time-descending sort.
 // Takes the snapshot EXPLICITLY rather than reaching for the display one, so the same
@@ -2568,6 +2826,89 @@ static void RenderBootView(Zenith_Profiling& xSelf, BootViewState& xState)
 	}
 }
 
+struct CountersViewState
+{
+	char m_acFilter[64] = "";
+	Zenith_PerfCounterID m_uSelected = ZENITH_PERF_COUNTER_NULL;
+};
+
+// Counters tab: every Zenith_PerfCounters registration with its merged per-frame
+// stats. Click a row to plot its last uFRAME_HISTORY frames above the table.
+static void RenderCountersView(CountersViewState& xState)
+{
+	const u_int uCount = Zenith_PerfCounters::GetCount();
+	if (uCount == 0)
+	{
+		ImGui::TextDisabled("No counters registered.");
+		return;
+	}
+
+	if (xState.m_uSelected < uCount)
+	{
+		const Zenith_PerfCounterStats& xSelected = Zenith_PerfCounters::GetStats(xState.m_uSelected);
+		float fMax = 1.0f;
+		for (u_int i = 0; i < Zenith_PerfCounterStats::uHISTORY; ++i) fMax = std::max(fMax, xSelected.m_afHistory[i]);
+		char acOverlay[96];
+		snprintf(acOverlay, sizeof(acOverlay), "%s  (max %.1f)", xSelected.m_szName, fMax);
+		ImGui::PlotLines("##CounterHistory", xSelected.m_afHistory, static_cast<int>(Zenith_PerfCounterStats::uHISTORY),
+			static_cast<int>(xSelected.m_uHistoryHead), acOverlay, 0.0f, fMax * 1.1f, ImVec2(-1.0f, 60.0f));
+	}
+
+	ImGui::SetNextItemWidth(200.0f);
+	ImGui::InputText("Filter##Counters", xState.m_acFilter, sizeof(xState.m_acFilter));
+	ImGui::SameLine();
+	ImGui::TextDisabled("%llu frames merged", static_cast<unsigned long long>(Zenith_PerfCounters::GetMergedFrames()));
+
+	if (!ImGui::BeginTable("CountersTable", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable))
+		return;
+	ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+	ImGui::TableSetupColumn("Kind", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+	ImGui::TableSetupColumn("Last", ImGuiTableColumnFlags_WidthFixed, 90.0f);
+	ImGui::TableSetupColumn("Mean", ImGuiTableColumnFlags_WidthFixed, 90.0f);
+	ImGui::TableSetupColumn("Min", ImGuiTableColumnFlags_WidthFixed, 90.0f);
+	ImGui::TableSetupColumn("Max", ImGuiTableColumnFlags_WidthFixed, 90.0f);
+	ImGui::TableSetupColumn("Distribution", ImGuiTableColumnFlags_WidthFixed, 220.0f);
+	ImGui::TableHeadersRow();
+
+	for (Zenith_PerfCounterID uID = 0; uID < uCount; ++uID)
+	{
+		const Zenith_PerfCounterStats& xStats = Zenith_PerfCounters::GetStats(uID);
+		if (xState.m_acFilter[0] != '\0' && strstr(xStats.m_szName, xState.m_acFilter) == nullptr) continue;
+
+		const double fMean = xStats.m_ulFrames > 0 ? xStats.m_fSumFrames / static_cast<double>(xStats.m_ulFrames) : 0.0;
+		ImGui::TableNextRow();
+		ImGui::TableSetColumnIndex(0);
+		ImGui::PushID(static_cast<int>(uID));
+		if (ImGui::Selectable(xStats.m_szName, xState.m_uSelected == uID, ImGuiSelectableFlags_SpanAllColumns))
+		{
+			xState.m_uSelected = uID;
+		}
+		ImGui::PopID();
+		ImGui::TableSetColumnIndex(1);
+		ImGui::TextUnformatted(xStats.m_eKind == Zenith_PerfCounterKind::Counter ? "counter"
+			: xStats.m_eKind == Zenith_PerfCounterKind::Gauge ? "gauge" : "histogram");
+		ImGui::TableSetColumnIndex(2); ImGui::Text("%.1f", xStats.m_fLastFrame);
+		ImGui::TableSetColumnIndex(3); ImGui::Text("%.1f", fMean);
+		ImGui::TableSetColumnIndex(4); ImGui::Text("%.1f", xStats.m_fMinFrame);
+		ImGui::TableSetColumnIndex(5); ImGui::Text("%.1f", xStats.m_fMaxFrame);
+		ImGui::TableSetColumnIndex(6);
+		if (xStats.m_eKind == Zenith_PerfCounterKind::Histogram)
+		{
+			const Zenith_PerfCounters::HistogramStats& xHistogram = Zenith_PerfCounters::GetHistogramStats(xStats);
+			ImGui::Text("p50 %.0f  p95 %.0f  p99 %.0f  max %llu",
+				Zenith_PerfCounters::EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.50),
+				Zenith_PerfCounters::EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.95),
+				Zenith_PerfCounters::EstimatePercentile(xHistogram.m_aulTotal, xHistogram.m_ulMax, 0.99),
+				static_cast<unsigned long long>(xHistogram.m_ulMax));
+		}
+		else if (xStats.m_eKind == Zenith_PerfCounterKind::Counter)
+		{
+			ImGui::Text("total %.0f", xStats.m_fSumFrames);
+		}
+	}
+	ImGui::EndTable();
+}
+
 void Zenith_Profiling::RenderToImGui()
 {
 	ImGui::Begin(szEDITOR_WINDOW_PROFILING);
@@ -2577,6 +2918,7 @@ void Zenith_Profiling::RenderToImGui()
 	static u_int ls_uSelectedThreadID = 0;
 	static GPUViewState ls_xGPUView;
 	static BootViewState ls_xBootView;
+	static CountersViewState ls_xCountersView;
 
 	// Frame statistics (the previous, published frame).
 	const float fFrameDurationMs = static_cast<float>(TickDeltaToMs(m_pxDisplay->m_uBeginTicks, m_pxDisplay->m_uEndTicks));
@@ -2609,6 +2951,19 @@ void Zenith_Profiling::RenderToImGui()
 #endif
 	ImGui::SameLine();
 	if (ImGui::Button("Reset Worst")) m_fWorstFrameMs = 0.0f;
+	ImGui::SameLine();
+	if (m_pxTraceStream == nullptr)
+	{
+		if (ImGui::Button("Start Trace")) BeginTraceCapture("zenith_profile_trace.json");
+	}
+	else
+	{
+		if (ImGui::Button("Stop Trace")) EndTraceCapture();
+		ImGui::SameLine();
+		ImGui::Text("Tracing: %llu frames, %llu dropped",
+			static_cast<unsigned long long>(m_pxTraceStream->GetWrittenFrames()),
+			static_cast<unsigned long long>(m_pxTraceStream->GetDroppedFrames()));
+	}
 	ImGui::Separator();
 
 	if (ImGui::BeginTabBar("ProfilingTabs"))
@@ -2651,6 +3006,14 @@ void Zenith_Profiling::RenderToImGui()
 			ImGui::EndTabItem();
 		}
 
+		// Counters tab: Zenith_PerfCounters (paths, raycasts, streamed bytes, ...)
+		// merged once per frame; per-frame value, run min/max and histogram percentiles.
+		if (ImGui::BeginTabItem("Counters"))
+		{
+			RenderCountersView(ls_xCountersView);
+			ImGui::EndTabItem();
+		}
+
 #if ZENITH_MEMORY_TRACKING_ANY
 		// Memory tab: per-frame tracked-bytes history + per-category live breakdown,
 		// from Zenith_MemoryManagement::SampleFrame() pushed each frame by the main loop.
@@ -2712,7 +3075,7 @@ static TimelineHoveredEvent RenderTimelineEvents(const TimelineRenderContext& xC
 		const float fThreadBaseY = xCtx.xCanvasPos.y + uThreadID * xCtx.fThreadHeight;
 
 		char acLabel[64];
-		FormatThreadLaneName(acLabel, sizeof(acLabel), uThreadID, xSelf.m_uMainThreadID);
+		xSelf.GetThreadName(uThreadID, acLabel, sizeof(acLabel));
 		xCtx.pxDrawList->AddText(ImVec2(xCtx.xCanvasPos.x, fThreadBaseY), IM_COL32_WHITE, acLabel);
 
 		const u_int uEventCount = xEvents.GetSize();
@@ -3183,6 +3546,9 @@ void Zenith_Profiling::EndBootCapture(const Zenith_BootMarkerBundle*) {}
 void Zenith_Profiling::AddBootMarker(const char*) {}
 void Zenith_Profiling::AddBootMarker(const char*, const u_int64) {}
 void Zenith_Profiling::RecordBootMilestone(const char*) {}
+void Zenith_Profiling::GetThreadName(const u_int uThreadID, char* acOut, const size_t ulSize) const { snprintf(acOut, ulSize, "Thread %u", uThreadID); }
+bool Zenith_Profiling::BeginTraceCapture(const char*) { return false; }
+void Zenith_Profiling::EndTraceCapture() {}
 bool Zenith_Profiling::IsBootCaptureSealed() const { return false; }
 void Zenith_Profiling::WriteBootReport(FILE*) {}
 void Zenith_Profiling::WriteDisplayFrameZoneTable(FILE*, const char*) const {}
@@ -3196,6 +3562,9 @@ void Zenith_Profiling::WriteTextReport(FILE*) {}
 void Zenith_Profiling::BeginGPUCapture() {}
 void Zenith_Profiling::AddGPUPass(const char*, double, u_int) {}
 void Zenith_Profiling::EndGPUCapture() {}
+void Zenith_Profiling::BeginFrameSystemCapture() {}
+void Zenith_Profiling::AddFrameSystem(const FrameSystem&) {}
+void Zenith_Profiling::EndFrameSystemCapture(double, double) {}
 bool Zenith_Profiling::GetDisplayLabeledZoneTotalMs(const char*, const char*, double& fMillisecondsOut) const { fMillisecondsOut = 0.0; return false; }
 #if ZENITH_MEMORY_TRACKING_ANY
 void Zenith_Profiling::PushMemorySample(const Zenith_MemoryFrameSample&) {}
@@ -24,6 +24,7 @@
 #endif
 
 class Zenith_Multithreading;
+class Zenith_ProfileTraceStream;
 
 // Boot markers gathered by the platform entry point BEFORE the engine exists, handed
 // to Zenith_Core::Zenith_Init by pointer and imported into the boot capture just
@@ -148,6 +149,7 @@ public:
 	static constexpr u_int uRING_CAPACITY       = 8 * 1024;
 	static constexpr u_int uMAX_PROFILE_DEPTH   = 64;
 	static constexpr u_int uFRAME_HISTORY       = 256;
+	static constexpr u_int uMAX_THREAD_NAME     = 32;
 
 	// Declared in full below (it needs uMAX_ZONES). ThreadBuffer only holds a pointer.
 	struct BootControlBlock;
@@ -255,6 +257,19 @@ public:
 	// control block so the routing path reaches it through one pointer.
 	ThreadBuffer* GetThreadBuffer(const u_int uThreadID) const;
 
+	// Display name of a registered thread: the name it was created with, "Main" for
+	// the main thread, else "Thread <id>".
+	void GetThreadName(const u_int uThreadID, char* acOut, const size_t ulSize) const;
+
+	// ---- Streaming trace capture -------------------------------------------
+	// Writes every frame (plus the sealed boot capture, GPU passes and memory
+	// samples) to a Chrome trace-event JSON file on a background thread until
+	// EndTraceCapture, for sessions longer than the in-memory history. Main thread.
+	// --profile-trace[=path] starts one at Initialise. See Zenith_ProfileTrace.h.
+	bool BeginTraceCapture(const char* szPath);
+	void EndTraceCapture();
+	bool IsTraceCaptureActive() const { return m_pxTraceStream != nullptr; }
+
 	// ---- GPU per-pass timing channel ---------------------------------------
 	// Populated by the render backend's deferred timestamp readback: one entry per
 	// Flux_RenderGraph pass that ran, in execution order, with its GPU milliseconds.
@@ -282,6 +297,26 @@ public:
 	bool GetDisplayLabeledZoneTotalMs(const char* szZoneName, const char* szLabel,
 		double& fMillisecondsOut) const;
 
+	// ---- Frame system graph channel -----------------------------------------
+	// Published once per frame by Zenith_FrameGraph::PublishReport: one entry per
+	// engine system that ran, in registration order, with its start offset into
+	// the graph and its duration, plus the graph's wall-clock and critical-path
+	// totals. Main thread only, like the GPU channel.
+	struct FrameSystem
+	{
+		const char* m_szName = nullptr;     // static-lifetime system name
+		double      m_fStartMs = 0.0;
+		double      m_fMilliseconds = 0.0;
+		bool        m_bMainThread = true;
+		bool        m_bOnCriticalPath = false;
+	};
+	void BeginFrameSystemCapture();
+	void AddFrameSystem(const FrameSystem& xSystem);
+	void EndFrameSystemCapture(double fWallMs, double fCriticalPathMs);
+	const Zenith_Vector<FrameSystem>& GetFrameSystems() const { return m_xFrameSystems; }
+	double GetFrameSystemWallMs() const { return m_fFrameSystemWallMs; }
+	double GetFrameSystemCriticalPathMs() const { return m_fFrameSystemCriticalPathMs; }
+
 #if ZENITH_MEMORY_TRACKING_ANY
 	// ---- Memory channel ----------------------------------------------------
 	// The main loop calls PushMemorySample once per frame with a POD snapshot from
@@ -363,6 +398,11 @@ public:
 	double m_fGPUBuildingTotalMs = 0.0;
 	u_int64 m_uGPUCaptureSerial = 0;
 
+	// Last published frame system graph (see the frame-system channel API).
+	Zenith_Vector<FrameSystem> m_xFrameSystems;
+	double m_fFrameSystemWallMs = 0.0;
+	double m_fFrameSystemCriticalPathMs = 0.0;
+
 	// Rolling history of total GPU ms per read-back frame (mirrors the CPU frame
 	// history); pushed in EndGPUCapture, plotted in the GPU viz tab.
 	float  m_afGPUHistoryMs[uFRAME_HISTORY]{};
@@ -398,6 +438,17 @@ public:
 	// Main-thread id (captured at Initialise) so the timeline can label its lane "Main".
 	u_int m_uMainThreadID = ~0u;
 
+	// Streaming trace (null when not capturing). m_uTraceGPUSerial is the last GPU
+	// capture streamed; m_bTraceMemoryPending is set by PushMemorySample.
+	Zenith_ProfileTraceStream* m_pxTraceStream = nullptr;
+	u_int64 m_uTraceGPUSerial = 0;
+	bool    m_bTraceMemoryPending = false;
+	bool    m_bTraceBootWritten = false;
+#if ZENITH_MEMORY_TRACKING_ANY
+	Zenith_MemoryFrameSample m_xTraceMemSample{};
+	u_int64 m_uTraceMemoryTicks = 0;
+#endif
+
 	// ======================= Boot capture ===================================
 	// The frame profiler cannot see boot: nothing drains the 8K per-thread rings
 	// until the first EndFrame, so a ring saturates and every newer event is
@@ -532,6 +583,12 @@ public:
 		std::atomic<u_int64> m_uFirstFrameOriginTicks{ 0 };
 		u_int64              m_uInitTicks = 0;   // fallback origin when no bundle arrives
 
+		// Thread names, copied at RegisterThread (under m_xMutex) from the name the
+		// thread was created with. Slots are never cleared, so the trace can name a
+		// thread that has already exited.
+		char m_aacThreadNames[uMAX_PROFILE_THREADS][uMAX_THREAD_NAME]{};
+		bool m_abThreadRegistered[uMAX_PROFILE_THREADS]{};
+
 		Zenith_Profiling* m_pxProfiling = nullptr;   // nulled under m_xMutex at Shutdown
 	};
 
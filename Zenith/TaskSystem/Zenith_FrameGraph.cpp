@@ -0,0 +1,280 @@
+#include "Zenith.h"
+
+#include "TaskSystem/Zenith_FrameGraph.h"
+
+// An any-thread system's task. Persistent for the graph's lifetime so the
+// DependsOn edges set up by Build survive every resubmit.
+class Zenith_FrameGraph::SystemTask : public Zenith_Task
+{
+public:
+	SystemTask(Zenith_ProfileZoneID uProfileZoneID, Zenith_FrameGraph* pxGraph, u_int uSystem)
+		: Zenith_Task(uProfileZoneID, nullptr)
+		, m_pxGraph(pxGraph)
+		, m_uSystem(uSystem)
+	{
+	}
+
+	// RunSystem opens the system's profile zone itself (main-thread systems need
+	// it too), so this skips the base class's.
+	virtual void DoTask() override
+	{
+		m_pxGraph->RunSystem(m_pxGraph->m_xSystems.Get(m_uSystem));
+		FinishTask();
+	}
+
+private:
+	Zenith_FrameGraph* m_pxGraph;
+	u_int m_uSystem;
+};
+
+Zenith_FrameGraph::~Zenith_FrameGraph()
+{
+	Zenith_Assert(!m_bExecuting, "Zenith_FrameGraph destroyed while executing");
+	for (u_int u = 0; u < m_xSystems.GetSize(); u++)
+	{
+		delete m_xSystems.Get(u).m_pxTask;
+	}
+}
+
+Zenith_FrameResource Zenith_FrameGraph::RegisterResource(const char* szName)
+{
+	Zenith_Assert(!m_bBuilt, "Zenith_FrameGraph::RegisterResource after Build");
+	for (u_int u = 0; u < m_uNumResources; u++)
+	{
+		if (strcmp(m_aszResourceNames[u], szName) == 0)
+		{
+			return u;
+		}
+	}
+	Zenith_Assert(m_uNumResources < uMAX_RESOURCES, "Zenith_FrameGraph: more than %u resources", uMAX_RESOURCES);
+	m_aszResourceNames[m_uNumResources] = szName;
+	return m_uNumResources++;
+}
+
+u_int Zenith_FrameGraph::AddSystem(const SystemDesc& xDesc)
+{
+	Zenith_Assert(!m_bBuilt, "Zenith_FrameGraph::AddSystem after Build");
+	Zenith_Assert(m_xSystems.GetSize() < uMAX_SYSTEMS, "Zenith_FrameGraph: more than %u systems", uMAX_SYSTEMS);
+	Zenith_Assert(xDesc.m_pfnFunc != nullptr, "Zenith_FrameGraph::AddSystem: system '%s' has no function", xDesc.m_szName);
+	m_xSystems.PushBack({ xDesc });
+	return m_xSystems.GetSize() - 1;
+}
+
+void Zenith_FrameGraph::Build()
+{
+	Zenith_Assert(!m_bBuilt, "Zenith_FrameGraph::Build called twice");
+
+	for (u_int uSystem = 0; uSystem < m_xSystems.GetSize(); uSystem++)
+	{
+		System& xSystem = m_xSystems.Get(uSystem);
+		const SystemDesc& xDesc = xSystem.m_xDesc;
+
+		// Nearest conflict first, so an edge to an earlier system that a nearer
+		// one already waits on is recognised as implied and dropped.
+		for (u_int uEarlier = uSystem; uEarlier-- > 0;)
+		{
+			const System& xEarlier = m_xSystems.Get(uEarlier);
+			const bool bConflict = ((xEarlier.m_xDesc.m_ulWrites & (xDesc.m_ulReads | xDesc.m_ulWrites)) != 0)
+				|| ((xEarlier.m_xDesc.m_ulReads & xDesc.m_ulWrites) != 0);
+			if (!bConflict || (xSystem.m_ulAncestors & (1ull << uEarlier)) != 0)
+			{
+				continue;
+			}
+
+			xSystem.m_ulPredecessors |= 1ull << uEarlier;
+			xSystem.m_ulAncestors |= xEarlier.m_ulAncestors | (1ull << uEarlier);
+			if (xEarlier.m_xDesc.m_bMainThread)
+			{
+				xSystem.m_ulMainPredecessors |= 1ull << uEarlier;
+			}
+		}
+
+		xSystem.m_uProfileZoneID = Zenith_Profiling_Detail::RegisterZone(xDesc.m_szName);
+		if (!xDesc.m_bMainThread)
+		{
+			xSystem.m_pxTask = new SystemTask(xSystem.m_uProfileZoneID, this, uSystem);
+		}
+	}
+
+	// Task edges between any-thread systems. A main-thread predecessor is
+	// honoured by not submitting the task until it has run (SubmitReadyTasks).
+	for (u_int uSystem = 0; uSystem < m_xSystems.GetSize(); uSystem++)
+	{
+		System& xSystem = m_xSystems.Get(uSystem);
+		if (xSystem.m_pxTask == nullptr) continue;
+
+		for (u_int uPredecessor = 0; uPredecessor < uSystem; uPredecessor++)
+		{
+			const System& xPredecessor = m_xSystems.Get(uPredecessor);
+			if ((xSystem.m_ulPredecessors & (1ull << uPredecessor)) != 0 && xPredecessor.m_pxTask != nullptr)
+			{
+				xSystem.m_pxTask->DependsOn(*xPredecessor.m_pxTask);
+			}
+		}
+	}
+
+	m_bBuilt = true;
+}
+
+void Zenith_FrameGraph::SetSystemEnabled(u_int uSystem, bool bEnabled)
+{
+	Zenith_Assert(!m_bExecuting, "Zenith_FrameGraph::SetSystemEnabled during Execute");
+	m_xSystems.Get(uSystem).m_bEnabled = bEnabled;
+}
+
+bool Zenith_FrameGraph::DependsOn(u_int uSystem, u_int uPredecessor) const
+{
+	return (m_xSystems.Get(uSystem).m_ulAncestors & (1ull << uPredecessor)) != 0;
+}
+
+void Zenith_FrameGraph::RunSystem(System& xSystem)
+{
+	if (!xSystem.m_bEnabled)
+	{
+		xSystem.m_ulBeginTicks = 0;
+		xSystem.m_ulEndTicks = 0;
+		return;
+	}
+
+	xSystem.m_ulBeginTicks = Zenith_Profiling_Detail::GetTimestamp();
+	{
+		Zenith_Profiling::ScopeZone xProfileScope(xSystem.m_uProfileZoneID);
+		xSystem.m_xDesc.m_pfnFunc(xSystem.m_xDesc.m_pData);
+	}
+	xSystem.m_ulEndTicks = Zenith_Profiling_Detail::GetTimestamp();
+}
+
+void Zenith_FrameGraph::SubmitReadyTasks(u_int64 ulMainDone, u_int64& ulSubmitted)
+{
+	for (u_int uSystem = 0; uSystem < m_xSystems.GetSize(); uSystem++)
+	{
+		const System& xSystem = m_xSystems.Get(uSystem);
+		if (xSystem.m_pxTask == nullptr || (ulSubmitted & (1ull << uSystem)) != 0) continue;
+		if ((xSystem.m_ulMainPredecessors & ~ulMainDone) != 0) continue;
+
+		ulSubmitted |= 1ull << uSystem;
+		m_xTasks.SubmitTask(xSystem.m_pxTask);
+	}
+}
+
+void Zenith_FrameGraph::Execute()
+{
+	Zenith_Assert(m_bBuilt, "Zenith_FrameGraph::Execute before Build");
+	Zenith_Assert(!m_bExecuting, "Zenith_FrameGraph::Execute is not re-entrant");
+	m_bExecuting = true;
+
+	const u_int64 ulBeginTicks = Zenith_Profiling_Detail::GetTimestamp();
+	u_int64 ulMainDone = 0;
+	u_int64 ulSubmitted = 0;
+
+	for (u_int uSystem = 0; uSystem < m_xSystems.GetSize(); uSystem++)
+	{
+		System& xSystem = m_xSystems.Get(uSystem);
+		if (!xSystem.m_xDesc.m_bMainThread) continue;
+
+		// Everything unblocked by the main-thread systems so far goes out before
+		// this one runs, so the workers have it for the whole of its duration.
+		SubmitReadyTasks(ulMainDone, ulSubmitted);
+
+		for (u_int uPredecessor = 0; uPredecessor < uSystem; uPredecessor++)
+		{
+			const System& xPredecessor = m_xSystems.Get(uPredecessor);
+			if ((xSystem.m_ulPredecessors & (1ull << uPredecessor)) != 0 && xPredecessor.m_pxTask != nullptr)
+			{
+				xPredecessor.m_pxTask->WaitUntilComplete();
+			}
+		}
+
+		RunSystem(xSystem);
+		ulMainDone |= 1ull << uSystem;
+	}
+
+	SubmitReadyTasks(ulMainDone, ulSubmitted);
+	for (u_int uSystem = 0; uSystem < m_xSystems.GetSize(); uSystem++)
+	{
+		if (m_xSystems.Get(uSystem).m_pxTask != nullptr)
+		{
+			m_xSystems.Get(uSystem).m_pxTask->WaitUntilComplete();
+		}
+	}
+
+	ComputeTimings(ulBeginTicks, Zenith_Profiling_Detail::GetTimestamp());
+	m_bExecuting = false;
+}
+
+void Zenith_FrameGraph::ComputeTimings(u_int64 ulBeginTicks, u_int64 ulEndTicks)
+{
+	const double fTicksToMs = Zenith_Profiling_Detail::GetTicksToNs() * 1.0e-6;
+	m_fWallMs = static_cast<double>(ulEndTicks - ulBeginTicks) * fTicksToMs;
+
+	// Longest duration-weighted path. A main-thread system also waits on the
+	// main-thread system before it, whether or not they share a resource.
+	double afPathMs[uMAX_SYSTEMS];
+	u_int auPathPrevious[uMAX_SYSTEMS];
+	u_int uPreviousMain = uINVALID_SYSTEM;
+	u_int uPathEnd = uINVALID_SYSTEM;
+	m_fCriticalPathMs = 0.0;
+
+	for (u_int uSystem = 0; uSystem < m_xSystems.GetSize(); uSystem++)
+	{
+		System& xSystem = m_xSystems.Get(uSystem);
+		SystemTiming& xTiming = xSystem.m_xTiming;
+		xTiming.m_bRan = xSystem.m_ulEndTicks != 0;
+		xTiming.m_bOnCriticalPath = false;
+		xTiming.m_fStartMs = xTiming.m_bRan ? static_cast<double>(xSystem.m_ulBeginTicks - ulBeginTicks) * fTicksToMs : 0.0;
+		xTiming.m_fMilliseconds = xTiming.m_bRan ? static_cast<double>(xSystem.m_ulEndTicks - xSystem.m_ulBeginTicks) * fTicksToMs : 0.0;
+
+		u_int64 ulWaitsOn = xSystem.m_ulPredecessors;
+		if (xSystem.m_xDesc.m_bMainThread && uPreviousMain != uINVALID_SYSTEM)
+		{
+			ulWaitsOn |= 1ull << uPreviousMain;
+		}
+
+		double fLongestBefore = 0.0;
+		auPathPrevious[uSystem] = uINVALID_SYSTEM;
+		for (u_int uPredecessor = 0; uPredecessor < uSystem; uPredecessor++)
+		{
+			if ((ulWaitsOn & (1ull << uPredecessor)) != 0 && afPathMs[uPredecessor] > fLongestBefore)
+			{
+				fLongestBefore = afPathMs[uPredecessor];
+				auPathPrevious[uSystem] = uPredecessor;
+			}
+		}
+		afPathMs[uSystem] = fLongestBefore + xTiming.m_fMilliseconds;
+
+		if (afPathMs[uSystem] > m_fCriticalPathMs)
+		{
+			m_fCriticalPathMs = afPathMs[uSystem];
+			uPathEnd = uSystem;
+		}
+		if (xSystem.m_xDesc.m_bMainThread)
+		{
+			uPreviousMain = uSystem;
+		}
+	}
+
+	for (u_int uSystem = uPathEnd; uSystem != uINVALID_SYSTEM; uSystem = auPathPrevious[uSystem])
+	{
+		SystemTiming& xTiming = m_xSystems.Get(uSystem).m_xTiming;
+		xTiming.m_bOnCriticalPath = xTiming.m_bRan;
+	}
+}
+
+void Zenith_FrameGraph::PublishReport(Zenith_Profiling& xProfiling) const
+{
+	xProfiling.BeginFrameSystemCapture();
+	for (u_int uSystem = 0; uSystem < m_xSystems.GetSize(); uSystem++)
+	{
+		const System& xSystem = m_xSystems.Get(uSystem);
+		if (!xSystem.m_xTiming.m_bRan) continue;
+
+		Zenith_Profiling::FrameSystem xEntry;
+		xEntry.m_szName = xSystem.m_xDesc.m_szName;
+		xEntry.m_fStartMs = xSystem.m_xTiming.m_fStartMs;
+		xEntry.m_fMilliseconds = xSystem.m_xTiming.m_fMilliseconds;
+		xEntry.m_bMainThread = xSystem.m_xDesc.m_bMainThread;
+		xEntry.m_bOnCriticalPath = xSystem.m_xTiming.m_bOnCriticalPath;
+		xProfiling.AddFrameSystem(xEntry);
+	}
+	xProfiling.EndFrameSystemCapture(m_fWallMs, m_fCriticalPathMs);
+}
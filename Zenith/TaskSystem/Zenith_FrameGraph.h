@@ -0,0 +1,163 @@
+#pragma once
+
+#include "TaskSystem/Zenith_TaskSystem.h"
+
+class Zenith_Profiling;
+
+//------------------------------------------------------------------------------
+// Zenith_FrameGraph - the per-frame engine systems as a dependency graph
+//------------------------------------------------------------------------------
+//
+// Each system is a function plus the resources it reads and writes. Build()
+// orders every pair of conflicting systems (write/write or read/write on any
+// resource) by registration order and drops edges already implied by others,
+// so the registration order is the sequential order the systems used to run
+// in and everything that does not conflict is free to overlap.
+//
+// Systems are either main-thread (run in registration order on the thread that
+// calls Execute - anything that runs ECS queries or structural changes has to
+// be) or any-thread (a Zenith_Task on the task system, dispatched as soon as
+// every predecessor has finished). The calling thread helps run tasks while it
+// waits on an any-thread predecessor, so a graph that is all main-thread costs
+// no more than calling the functions in order.
+//
+// Usage:
+//   Zenith_FrameGraph xGraph(g_xEngine.Tasks());
+//   const Zenith_FrameResource xScene = xGraph.RegisterResource("Scene");
+//   const Zenith_FrameResource xShadows = xGraph.RegisterResource("ShadowCascades");
+//   ...
+//   Zenith_FrameGraph::SystemDesc xDesc("Shadow Matrices", &UpdateShadows, nullptr);
+//   xDesc.Reads(xScene).Writes(xShadows).AnyThread();
+//   const u_int uShadows = xGraph.AddSystem(xDesc);
+//   ...
+//   xGraph.Build();
+//
+//   // per frame
+//   xGraph.SetSystemEnabled(uShadows, bShadowsEnabled);
+//   xGraph.Execute();
+//   xGraph.PublishReport(g_xEngine.Profiling());
+//
+// A disabled system keeps its place in the graph (successors still wait for
+// its predecessors) but its function is not called and it is left out of the
+// report.
+//
+// Every Execute times each system and computes the frame's critical path: the
+// chain of systems, through the dependency edges and the main thread's own
+// serial order, whose durations add up to the longest total. That is the
+// lower bound on the graph's wall-clock time however many workers there are,
+// and so the list of systems worth optimising or splitting next.
+//------------------------------------------------------------------------------
+
+using Zenith_FrameSystemFunction = void(*)(void* pData);
+
+// Bit index of a resource registered on one graph. Only meaningful to that graph.
+using Zenith_FrameResource = u_int;
+
+class Zenith_FrameGraph
+{
+public:
+	static constexpr u_int uMAX_SYSTEMS = 64;
+	static constexpr u_int uMAX_RESOURCES = 64;
+	static constexpr u_int uINVALID_SYSTEM = 0xFFFFFFFFu;
+
+	struct SystemDesc
+	{
+		SystemDesc(const char* szName, Zenith_FrameSystemFunction pfnFunc, void* pData)
+			: m_szName(szName)
+			, m_pfnFunc(pfnFunc)
+			, m_pData(pData)
+		{
+		}
+
+		SystemDesc& Reads(Zenith_FrameResource uResource) { m_ulReads |= 1ull << uResource; return *this; }
+		SystemDesc& Writes(Zenith_FrameResource uResource) { m_ulWrites |= 1ull << uResource; return *this; }
+		SystemDesc& AnyThread() { m_bMainThread = false; return *this; }
+
+		const char* m_szName;  // static literal, never owned
+		Zenith_FrameSystemFunction m_pfnFunc;
+		void* m_pData;
+		u_int64 m_ulReads = 0;
+		u_int64 m_ulWrites = 0;
+		bool m_bMainThread = true;
+	};
+
+	// One system's timing from the last Execute, in milliseconds from its start.
+	struct SystemTiming
+	{
+		double m_fStartMs = 0.0;
+		double m_fMilliseconds = 0.0;
+		bool m_bRan = false;
+		bool m_bOnCriticalPath = false;
+	};
+
+	// Any-thread systems are submitted to xTasks, which must outlive the graph.
+	explicit Zenith_FrameGraph(Zenith_TaskSystem& xTasks)
+		: m_xTasks(xTasks)
+	{
+	}
+	~Zenith_FrameGraph();
+	Zenith_FrameGraph(const Zenith_FrameGraph&) = delete;
+	Zenith_FrameGraph& operator=(const Zenith_FrameGraph&) = delete;
+
+	// Interns szName (content-deduped) as a resource of this graph. Only before Build.
+	Zenith_FrameResource RegisterResource(const char* szName);
+
+	// Appends a system and returns its index. Only before Build.
+	u_int AddSystem(const SystemDesc& xDesc);
+
+	// Derives the dependency edges and creates the tasks for the any-thread
+	// systems. Once built, the graph's shape is fixed.
+	void Build();
+	bool IsBuilt() const { return m_bBuilt; }
+
+	void SetSystemEnabled(u_int uSystem, bool bEnabled);
+
+	// Runs every system once and waits for all of them. Call from the thread
+	// the main-thread systems belong on; not re-entrant.
+	void Execute();
+
+	// Introspection (tools/tests).
+	u_int GetNumSystems() const { return m_xSystems.GetSize(); }
+	const char* GetSystemName(u_int uSystem) const { return m_xSystems.Get(uSystem).m_xDesc.m_szName; }
+	// True when uPredecessor must finish before uSystem starts, directly or
+	// through other systems.
+	bool DependsOn(u_int uSystem, u_int uPredecessor) const;
+	const SystemTiming& GetTiming(u_int uSystem) const { return m_xSystems.Get(uSystem).m_xTiming; }
+	double GetWallMs() const { return m_fWallMs; }
+	double GetCriticalPathMs() const { return m_fCriticalPathMs; }
+
+	// Hands the last Execute's timings and critical path to the profiler's
+	// frame-system channel (see Zenith_Profiling::AddFrameSystem).
+	void PublishReport(Zenith_Profiling& xProfiling) const;
+
+private:
+	class SystemTask;
+
+	struct System
+	{
+		SystemDesc m_xDesc;
+		bool m_bEnabled = true;
+		u_int64 m_ulPredecessors = 0;      // direct edges only (transitively reduced)
+		u_int64 m_ulAncestors = 0;         // everything that must finish first
+		u_int64 m_ulMainPredecessors = 0;  // the main-thread subset of m_ulPredecessors
+		SystemTask* m_pxTask = nullptr;    // any-thread systems only
+		Zenith_ProfileZoneID m_uProfileZoneID = ZENITH_PROFILE_ZONE_NULL;
+		u_int64 m_ulBeginTicks = 0;
+		u_int64 m_ulEndTicks = 0;
+		SystemTiming m_xTiming;
+	};
+
+	void RunSystem(System& xSystem);
+	void SubmitReadyTasks(u_int64 ulMainDone, u_int64& ulSubmitted);
+	void ComputeTimings(u_int64 ulBeginTicks, u_int64 ulEndTicks);
+
+	Zenith_TaskSystem& m_xTasks;
+	Zenith_Vector<System> m_xSystems;
+	const char* m_aszResourceNames[uMAX_RESOURCES] = {};
+	u_int m_uNumResources = 0;
+	bool m_bBuilt = false;
+	bool m_bExecuting = false;
+
+	double m_fWallMs = 0.0;
+	double m_fCriticalPathMs = 0.0;
+};
@@ -0,0 +1,138 @@
+#include "Zenith.h"
+
+#include "TaskSystem/Zenith_JoltJobSystem.h"
+
+#include <new>
+#include <thread>
+
+Zenith_JoltJobSystem::JobTask::JobTask()
+	: Zenith_Task(ZENITH_PROFILE_ZONE("Physics Job"), nullptr)
+{
+}
+
+void Zenith_JoltJobSystem::JobTask::DoTask()
+{
+	Job* pxJob = m_pxJob;
+#if ZENITH_PROFILING_ENABLED
+	Zenith_Profiling_Detail::BeginProfileZone(m_uProfileZoneID, nullptr);
+	pxJob->Execute();
+	Zenith_Profiling_Detail::EndProfileZone(m_uProfileZoneID);
+#else
+	pxJob->Execute();
+#endif
+	// May free the job and hand its slot to another CreateJob, which then
+	// waits for the FinishTask below before it touches this task.
+	pxJob->Release();
+	FinishTask();
+}
+
+Zenith_JoltJobSystem::Zenith_JoltJobSystem(Zenith_TaskSystem& xTasks, u_int uMaxJobs, u_int uMaxBarriers)
+	: JPH::JobSystemWithBarrier(uMaxBarriers)
+	, m_xTasks(xTasks)
+	, m_uMaxJobs(uMaxJobs)
+{
+	Zenith_Assert(uMaxJobs > 0, "Zenith_JoltJobSystem: needs at least one job slot");
+
+	m_pxSlots = new JobSlot[uMaxJobs];
+	m_xFreeSlots.Reserve(uMaxJobs);
+	// Pushed in reverse so the first jobs of a step take the lowest slots.
+	for (u_int u = uMaxJobs; u > 0; u--)
+	{
+		m_xFreeSlots.PushBack(u - 1);
+	}
+}
+
+Zenith_JoltJobSystem::~Zenith_JoltJobSystem()
+{
+	// A task can still be between releasing its job and signalling completion.
+	for (u_int u = 0; u < m_uMaxJobs; u++)
+	{
+		m_pxSlots[u].m_xTask.WaitUntilComplete();
+	}
+	Zenith_Assert(m_xFreeSlots.GetSize() == m_uMaxJobs,
+		"~Zenith_JoltJobSystem: %u job(s) still referenced", m_uMaxJobs - m_xFreeSlots.GetSize());
+
+	delete[] m_pxSlots;
+	m_pxSlots = nullptr;
+}
+
+int Zenith_JoltJobSystem::GetMaxConcurrency() const
+{
+	return static_cast<int>(m_xTasks.GetNumWorkerThreads() + 1);
+}
+
+u_int Zenith_JoltJobSystem::AcquireSlot()
+{
+	bool bReported = false;
+	for (;;)
+	{
+		{
+			Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xFreeSlotsMutex);
+			if (m_xFreeSlots.GetSize() > 0)
+			{
+				const u_int uSlot = m_xFreeSlots.GetBack();
+				m_xFreeSlots.PopBack();
+				return uSlot;
+			}
+		}
+
+		// Same policy as JobSystemThreadPool: running out is a sizing bug, but
+		// jobs in flight will free slots, so help them along rather than fail.
+		Zenith_Assert(bReported, "Zenith_JoltJobSystem: all %u job slots in use - raise the job count", m_uMaxJobs);
+		bReported = true;
+		if (!m_xTasks.TryRunPendingTask())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+Zenith_JoltJobSystem::JobSlot& Zenith_JoltJobSystem::SlotOf(Job* pxJob)
+{
+	JobSlot* pxSlot = reinterpret_cast<JobSlot*>(pxJob);
+	Zenith_Assert(pxSlot >= m_pxSlots && pxSlot < m_pxSlots + m_uMaxJobs, "Zenith_JoltJobSystem: job does not belong to this job system");
+	return *pxSlot;
+}
+
+JPH::JobHandle Zenith_JoltJobSystem::CreateJob(const char* szName, JPH::ColorArg xColour, const JobFunction& xJobFunction, JPH::uint32 uNumDependencies)
+{
+	JobSlot& xSlot = m_pxSlots[AcquireSlot()];
+
+	// Recycles the task that ran the slot's previous job (no-op if it never ran).
+	xSlot.m_xTask.WaitUntilComplete();
+
+	Job* pxJob = new (xSlot.m_acJobStorage) Job(szName, xColour, this, xJobFunction, uNumDependencies);
+
+	// The handle takes the first reference before the job can run and drop one.
+	JobHandle xHandle(pxJob);
+	if (uNumDependencies == 0)
+	{
+		QueueJob(pxJob);
+	}
+	return xHandle;
+}
+
+void Zenith_JoltJobSystem::QueueJob(Job* pxJob)
+{
+	JobSlot& xSlot = SlotOf(pxJob);
+	pxJob->AddRef();
+	xSlot.m_xTask.m_pxJob = pxJob;
+	m_xTasks.SubmitTask(&xSlot.m_xTask);
+}
+
+void Zenith_JoltJobSystem::QueueJobs(Job** ppxJobs, JPH::uint uNumJobs)
+{
+	for (JPH::uint u = 0; u < uNumJobs; u++)
+	{
+		QueueJob(ppxJobs[u]);
+	}
+}
+
+void Zenith_JoltJobSystem::FreeJob(Job* pxJob)
+{
+	const u_int uSlot = static_cast<u_int>(&SlotOf(pxJob) - m_pxSlots);
+	pxJob->~Job();
+
+	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xFreeSlotsMutex);
+	m_xFreeSlots.PushBack(uSlot);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "TaskSystem/Zenith_TaskSystem.h"
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+
+//------------------------------------------------------------------------------
+// Zenith_JoltJobSystem - Jolt's JPH::JobSystem on top of Zenith_TaskSystem
+//------------------------------------------------------------------------------
+//
+// Jolt schedules a physics step as a graph of jobs. Jolt's own
+// JobSystemThreadPool runs them on a second set of hw_concurrency-1 threads,
+// which then compete with the engine workers for the same cores. This bridge
+// runs every job as a Zenith_Task on the engine's pool instead, so physics
+// shares one set of workers with the rest of the frame and every job shows up
+// as a "Physics Job" profile zone.
+//
+// Barriers come from JPH::JobSystemWithBarrier. The thread that calls
+// PhysicsSystem::Update runs any ready job in the barrier itself while it
+// waits. The engine task queued for a job that thread already ran finds it
+// done, so running it again is a no-op.
+//
+// Job storage is a fixed array of uMaxJobs slots, each holding the JPH job and
+// the persistent Zenith_Task that runs it. A slot returns to the free list when
+// Jolt drops its last reference to the job. That can happen inside the slot's
+// own task, just before the task signals completion, so CreateJob waits on the
+// slot's task before it reuses the slot.
+//
+// Jolt's allocation hooks must be installed before construction (the barriers
+// are allocated through them), so Zenith_Physics::Initialise creates the job
+// system through the factory installed with Zenith_Physics_SetJobSystemFactory.
+//------------------------------------------------------------------------------
+
+class Zenith_JoltJobSystem final : public JPH::JobSystemWithBarrier
+{
+public:
+	JPH_OVERRIDE_NEW_DELETE
+
+	Zenith_JoltJobSystem(Zenith_TaskSystem& xTasks, u_int uMaxJobs, u_int uMaxBarriers);
+	virtual ~Zenith_JoltJobSystem() override;
+
+	// Engine workers plus the thread that waits on the barrier.
+	virtual int GetMaxConcurrency() const override;
+	virtual JobHandle CreateJob(const char* szName, JPH::ColorArg xColour, const JobFunction& xJobFunction, JPH::uint32 uNumDependencies = 0) override;
+
+protected:
+	virtual void QueueJob(Job* pxJob) override;
+	virtual void QueueJobs(Job** ppxJobs, JPH::uint uNumJobs) override;
+	virtual void FreeJob(Job* pxJob) override;
+
+private:
+	// Runs one queued job. Holds the reference QueueJob took and drops it once
+	// the job has run.
+	class JobTask : public Zenith_Task
+	{
+	public:
+		JobTask();
+
+		virtual void DoTask() override;
+
+		Job* m_pxJob = nullptr;
+	};
+
+	// The job storage comes first, so a Job* is also its slot's address.
+	struct JobSlot
+	{
+		alignas(Job) unsigned char m_acJobStorage[sizeof(Job)];
+		JobTask m_xTask;
+	};
+
+	u_int AcquireSlot();
+	JobSlot& SlotOf(Job* pxJob);
+
+	Zenith_TaskSystem& m_xTasks;
+	JobSlot* m_pxSlots = nullptr;
+	u_int m_uMaxJobs = 0;
+
+	Zenith_Vector<u_int> m_xFreeSlots;
+	Zenith_Mutex_NoProfiling m_xFreeSlotsMutex;
+};
@@ -0,0 +1,564 @@
+#include "UnitTests/Zenith_UnitTests.h"
+#include "Core/Zenith_BenchTaskSystem.h"
+#include "TaskSystem/Zenith_FrameGraph.h"
+#include "TaskSystem/Zenith_JoltJobSystem.h"
+
+// ============================================================================
+// Work-stealing scheduler + task-dependency tests.
+//
+// Included at the bottom of Zenith_TaskSystem.cpp (always linked: the engine
+// owns the task system) so the ZENITH_TEST registrations survive dead-stripping.
+// Every test drives the LIVE g_xEngine.Tasks() pool, so each one waits on every
+// task it submits before returning: a task left in flight would trip the
+// empty-queue asserts in Shutdown.
+// ============================================================================
+
+namespace
+{
+	// Records the order task bodies ran in, one slot per task.
+	struct TaskOrderRecorder
+	{
+		std::atomic<u_int> m_uNextSequence{0};
+		u_int m_auSequence[8] = {};
+	};
+
+	struct OrderedTaskData
+	{
+		TaskOrderRecorder* m_pxRecorder = nullptr;
+		u_int m_uSlot = 0;
+	};
+
+	void RecordOrderTask(void* pData)
+	{
+		OrderedTaskData* pxData = static_cast<OrderedTaskData*>(pData);
+		pxData->m_pxRecorder->m_auSequence[pxData->m_uSlot] = pxData->m_pxRecorder->m_uNextSequence.fetch_add(1, std::memory_order_acq_rel);
+	}
+
+	struct NestedWaitData
+	{
+		std::atomic<u_int> m_uChildRuns{0};
+	};
+
+	void NestedChildTask(void* pData)
+	{
+		static_cast<NestedWaitData*>(pData)->m_uChildRuns.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Submits children from whatever thread it runs on and blocks on them. With
+	// every worker inside one of these, only help-while-waiting makes progress.
+	void NestedParentTask(void* pData)
+	{
+		constexpr u_int uNUM_CHILDREN = 32;
+		NestedWaitData* pxData = static_cast<NestedWaitData*>(pData);
+		Zenith_Task* apxChildren[uNUM_CHILDREN];
+		for (u_int u = 0; u < uNUM_CHILDREN; u++)
+		{
+			apxChildren[u] = new Zenith_Task(ZENITH_PROFILE_ZONE("Unit Test Task"), NestedChildTask, pxData);
+			g_xEngine.Tasks().SubmitTask(apxChildren[u]);
+		}
+		for (u_int u = 0; u < uNUM_CHILDREN; u++)
+		{
+			apxChildren[u]->WaitUntilComplete();
+			delete apxChildren[u];
+		}
+	}
+}
+
+// Owner pops newest-first, thieves take oldest-first, and a full deque refuses
+// the push rather than overwriting.
+ZENITH_TEST(TaskSystem, WorkStealingDequeOwnerLifoThiefFifo)
+{
+	Zenith_WorkStealingDeque<u_int, 4>* pxDeque = new Zenith_WorkStealingDeque<u_int, 4>();
+	u_int uOut = 0;
+
+	ZENITH_ASSERT_FALSE(pxDeque->Pop(uOut), "Pop on an empty deque must fail");
+	ZENITH_ASSERT_FALSE(pxDeque->Steal(uOut), "Steal on an empty deque must fail");
+
+	for (u_int u = 1; u <= 4; u++)
+	{
+		ZENITH_ASSERT_TRUE(pxDeque->Push(u), "Push %u should fit in a capacity-4 deque", u);
+	}
+	ZENITH_ASSERT_FALSE(pxDeque->Push(5u), "Push into a full deque must fail");
+	ZENITH_ASSERT_EQ(pxDeque->GetSize(), 4u, "Size after filling");
+
+	ZENITH_ASSERT_TRUE(pxDeque->Pop(uOut), "Pop should succeed");
+	ZENITH_ASSERT_EQ(uOut, 4u, "Owner Pop must return the newest item");
+	ZENITH_ASSERT_TRUE(pxDeque->Steal(uOut), "Steal should succeed");
+	ZENITH_ASSERT_EQ(uOut, 1u, "Steal must return the oldest item");
+	ZENITH_ASSERT_TRUE(pxDeque->Steal(uOut), "Steal should succeed");
+	ZENITH_ASSERT_EQ(uOut, 2u, "Second steal returns the next oldest");
+	ZENITH_ASSERT_TRUE(pxDeque->Pop(uOut), "Pop of the last item should succeed");
+	ZENITH_ASSERT_EQ(uOut, 3u, "Last item");
+	ZENITH_ASSERT_TRUE(pxDeque->IsEmpty(), "Deque should be empty");
+
+	// Wrap-around: indices keep growing past the capacity.
+	for (u_int u = 0; u < 10; u++)
+	{
+		ZENITH_ASSERT_TRUE(pxDeque->Push(100u + u), "Push after wrap");
+		ZENITH_ASSERT_TRUE(pxDeque->Steal(uOut), "Steal after wrap");
+		ZENITH_ASSERT_EQ(uOut, 100u + u, "Wrapped item round-trips");
+	}
+
+	delete pxDeque;
+}
+
+// A chain C <- B <- A submitted tail-first must still run A, B, C in order: the
+// successors park on their dependency counters until the predecessor finishes.
+ZENITH_TEST(TaskSystem, DependsOnRunsSuccessorAfterPredecessor)
+{
+	TaskOrderRecorder xRecorder;
+	OrderedTaskData axData[3];
+	for (u_int u = 0; u < 3; u++)
+	{
+		axData[u].m_pxRecorder = &xRecorder;
+		axData[u].m_uSlot = u;
+	}
+
+	Zenith_Task xA(ZENITH_PROFILE_ZONE("Unit Test Task"), RecordOrderTask, &axData[0]);
+	Zenith_Task xB(ZENITH_PROFILE_ZONE("Unit Test Task"), RecordOrderTask, &axData[1]);
+	Zenith_Task xC(ZENITH_PROFILE_ZONE("Unit Test Task"), RecordOrderTask, &axData[2]);
+	xB.DependsOn(xA);
+	xC.DependsOn(xB);
+
+	g_xEngine.Tasks().SubmitTask(&xC);
+	g_xEngine.Tasks().SubmitTask(&xB);
+	g_xEngine.Tasks().SubmitTask(&xA);
+	xC.WaitUntilComplete();
+	xB.WaitUntilComplete();
+	xA.WaitUntilComplete();
+
+	ZENITH_ASSERT_EQ(xRecorder.m_uNextSequence.load(), 3u, "Every task in the chain should run exactly once");
+	ZENITH_ASSERT_EQ(xRecorder.m_auSequence[0], 0u, "A must run first");
+	ZENITH_ASSERT_EQ(xRecorder.m_auSequence[1], 1u, "B must run after A");
+	ZENITH_ASSERT_EQ(xRecorder.m_auSequence[2], 2u, "C must run after B");
+
+	// Edges persist across recycling: the same graph runs again, in order.
+	g_xEngine.Tasks().SubmitTask(&xA);
+	g_xEngine.Tasks().SubmitTask(&xB);
+	g_xEngine.Tasks().SubmitTask(&xC);
+	xA.WaitUntilComplete();
+	xB.WaitUntilComplete();
+	xC.WaitUntilComplete();
+
+	ZENITH_ASSERT_EQ(xRecorder.m_uNextSequence.load(), 6u, "Resubmitted chain should run each task once more");
+	ZENITH_ASSERT_LT(xRecorder.m_auSequence[0], xRecorder.m_auSequence[1], "A before B on resubmit");
+	ZENITH_ASSERT_LT(xRecorder.m_auSequence[1], xRecorder.m_auSequence[2], "B before C on resubmit");
+}
+
+// Diamond A -> {B, C} -> D: D has two predecessors and must wait for both.
+ZENITH_TEST(TaskSystem, DiamondGraphJoinsAllPredecessors)
+{
+	TaskOrderRecorder xRecorder;
+	OrderedTaskData axData[4];
+	for (u_int u = 0; u < 4; u++)
+	{
+		axData[u].m_pxRecorder = &xRecorder;
+		axData[u].m_uSlot = u;
+	}
+
+	Zenith_Task xA(ZENITH_PROFILE_ZONE("Unit Test Task"), RecordOrderTask, &axData[0]);
+	Zenith_Task xB(ZENITH_PROFILE_ZONE("Unit Test Task"), RecordOrderTask, &axData[1]);
+	Zenith_Task xC(ZENITH_PROFILE_ZONE("Unit Test Task"), RecordOrderTask, &axData[2]);
+	Zenith_Task xD(ZENITH_PROFILE_ZONE("Unit Test Task"), RecordOrderTask, &axData[3]);
+	xB.DependsOn(xA);
+	xC.DependsOn(xA);
+	xD.DependsOn(xB);
+	xD.DependsOn(xC);
+
+	g_xEngine.Tasks().SubmitTask(&xD);
+	g_xEngine.Tasks().SubmitTask(&xC);
+	g_xEngine.Tasks().SubmitTask(&xB);
+	g_xEngine.Tasks().SubmitTask(&xA);
+	xD.WaitUntilComplete();
+	xC.WaitUntilComplete();
+	xB.WaitUntilComplete();
+	xA.WaitUntilComplete();
+
+	ZENITH_ASSERT_EQ(xRecorder.m_uNextSequence.load(), 4u, "Every task in the diamond should run exactly once");
+	ZENITH_ASSERT_EQ(xRecorder.m_auSequence[0], 0u, "A must run first");
+	ZENITH_ASSERT_EQ(xRecorder.m_auSequence[3], 3u, "D must run last, after both B and C");
+}
+
+// A fan-out wider than the inline successor storage: every edge must hold, the
+// ones past the inline slots included.
+ZENITH_TEST(TaskSystem, WideFanOutKeepsEverySuccessor)
+{
+	constexpr u_int uNUM_SUCCESSORS = 40;
+	struct Data
+	{
+		std::atomic<u_int> m_uPredecessorDone{0};
+		std::atomic<u_int> m_uRunsAfter{0};
+	} xData;
+
+	Zenith_Task xPredecessor(ZENITH_PROFILE_ZONE("Unit Test Task"),
+		[](void* pData) { static_cast<Data*>(pData)->m_uPredecessorDone.store(1, std::memory_order_release); }, &xData);
+	Zenith_Task* apxSuccessors[uNUM_SUCCESSORS];
+	for (u_int u = 0; u < uNUM_SUCCESSORS; u++)
+	{
+		apxSuccessors[u] = new Zenith_Task(ZENITH_PROFILE_ZONE("Unit Test Task"),
+			[](void* pData)
+			{
+				Data* pxData = static_cast<Data*>(pData);
+				if (pxData->m_uPredecessorDone.load(std::memory_order_acquire) == 1)
+				{
+					pxData->m_uRunsAfter.fetch_add(1, std::memory_order_relaxed);
+				}
+			}, &xData);
+		apxSuccessors[u]->DependsOn(xPredecessor);
+		g_xEngine.Tasks().SubmitTask(apxSuccessors[u]);
+	}
+	g_xEngine.Tasks().SubmitTask(&xPredecessor);
+
+	xPredecessor.WaitUntilComplete();
+	for (u_int u = 0; u < uNUM_SUCCESSORS; u++)
+	{
+		apxSuccessors[u]->WaitUntilComplete();
+		delete apxSuccessors[u];
+	}
+
+	ZENITH_ASSERT_EQ(xData.m_uRunsAfter.load(), uNUM_SUCCESSORS, "Every successor must run, and only after the predecessor");
+}
+
+// A data-parallel task can be a successor: it is dispatched in full (every
+// invocation) when its predecessor finishes.
+ZENITH_TEST(TaskSystem, DataParallelTaskAsSuccessor)
+{
+	struct Data
+	{
+		std::atomic<u_int> m_uPredecessorDone{0};
+		std::atomic<u_int> m_uInvocationsAfter{0};
+	} xData;
+
+	Zenith_Task xPredecessor(ZENITH_PROFILE_ZONE("Unit Test Task"),
+		[](void* pData) { static_cast<Data*>(pData)->m_uPredecessorDone.store(1, std::memory_order_release); }, &xData);
+	Zenith_DataParallelTask xParallel(ZENITH_PROFILE_ZONE("Unit Test Task"),
+		[](void* pData, u_int, u_int)
+		{
+			Data* pxData = static_cast<Data*>(pData);
+			if (pxData->m_uPredecessorDone.load(std::memory_order_acquire) == 1)
+			{
+				pxData->m_uInvocationsAfter.fetch_add(1, std::memory_order_relaxed);
+			}
+		}, &xData, 16, /*bCallingThreadParticipates=*/true);
+	xParallel.DependsOn(xPredecessor);
+
+	g_xEngine.Tasks().SubmitDataParallelTask(&xParallel);
+	g_xEngine.Tasks().SubmitTask(&xPredecessor);
+	xParallel.WaitUntilComplete();
+	xPredecessor.WaitUntilComplete();
+
+	ZENITH_ASSERT_EQ(xData.m_uInvocationsAfter.load(), 16u, "Every invocation must run, and only after the predecessor");
+}
+
+// Tasks that submit children and wait on them from inside the pool. One more
+// parent than there are workers guarantees every worker ends up blocked in a
+// WaitUntilComplete; the children only run because waiters help.
+ZENITH_TEST(TaskSystem, NestedWaitInsideTaskMakesProgress)
+{
+	const u_int uNumParents = g_xEngine.Tasks().GetNumWorkerThreads() + 1;
+	NestedWaitData xData;
+
+	Zenith_Vector<Zenith_Task*> xParents;
+	for (u_int u = 0; u < uNumParents; u++)
+	{
+		xParents.PushBack(new Zenith_Task(ZENITH_PROFILE_ZONE("Unit Test Task"), NestedParentTask, &xData));
+		g_xEngine.Tasks().SubmitTask(xParents.Get(u));
+	}
+	for (u_int u = 0; u < uNumParents; u++)
+	{
+		xParents.Get(u)->WaitUntilComplete();
+		delete xParents.Get(u);
+	}
+
+	ZENITH_ASSERT_EQ(xData.m_uChildRuns.load(), uNumParents * 32u, "Every nested child task should run exactly once");
+}
+
+// Smoke-test the sweep.tasks micro-benchmark at a tiny size: every pass must
+// run every task body, so the processed count is exact.
+ZENITH_TEST(TaskSystem, BenchTaskSystemSmoke)
+{
+	const u_int64 ulExecuted = Zenith_BenchTaskSystem_RunOnce(64, 2);
+	ZENITH_ASSERT_EQ(ulExecuted, static_cast<u_int64>(64u * 2u * 3u), "Bench should execute every task body once per pass per iteration");
+}
+
+// The Jolt bridge: leaf jobs created ready to run and a join job released by
+// the last of them, all waited on through a Jolt barrier. The job count is far
+// past the slot count, so slots (and their tasks) are recycled along the way.
+// Needs Jolt's allocators, which the engine's Physics::Initialise has installed.
+ZENITH_TEST(TaskSystem, JoltJobSystemRunsJobsBehindBarrier)
+{
+	static constexpr u_int uNUM_LEAVES = 32;
+	static constexpr u_int uNUM_ROUNDS = 8;
+
+	Zenith_JoltJobSystem* pxJobs = new Zenith_JoltJobSystem(g_xEngine.Tasks(), 48, 2);
+	ZENITH_ASSERT_EQ(pxJobs->GetMaxConcurrency(), static_cast<int>(g_xEngine.Tasks().GetNumWorkerThreads() + 1), "Concurrency should be the workers plus the waiting thread");
+
+	for (u_int uRound = 0; uRound < uNUM_ROUNDS; uRound++)
+	{
+		std::atomic<u_int> uLeafRuns{0};
+		std::atomic<u_int> uLeavesSeenByJoin{UINT32_MAX};
+
+		JPH::JobSystem::Barrier* pxBarrier = pxJobs->CreateBarrier();
+		{
+			JPH::JobHandle xJoin = pxJobs->CreateJob("Join", JPH::Color::sRed,
+				[&uLeafRuns, &uLeavesSeenByJoin]() { uLeavesSeenByJoin.store(uLeafRuns.load()); }, uNUM_LEAVES);
+			for (u_int u = 0; u < uNUM_LEAVES; u++)
+			{
+				JPH::JobHandle xLeaf = pxJobs->CreateJob("Leaf", JPH::Color::sGreen,
+					[&uLeafRuns, xJoin]() { uLeafRuns.fetch_add(1); xJoin.RemoveDependency(); });
+				pxBarrier->AddJob(xLeaf);
+			}
+			pxBarrier->AddJob(xJoin);
+			pxJobs->WaitForJobs(pxBarrier);
+		}
+		pxJobs->DestroyBarrier(pxBarrier);
+
+		ZENITH_ASSERT_EQ(uLeafRuns.load(), uNUM_LEAVES, "Every leaf job should run exactly once");
+		ZENITH_ASSERT_EQ(uLeavesSeenByJoin.load(), uNUM_LEAVES, "The join job should run after every leaf");
+	}
+
+	// Waits for the tasks still holding job references; asserts none leaked.
+	delete pxJobs;
+}
+
+namespace
+{
+	struct ParallelForCoverageData
+	{
+		std::atomic<u_int>* m_puHits = nullptr;
+		std::atomic<u_int> m_uChunks{0};
+		std::atomic<u_int> m_uUndersizedChunks{0};
+		u_int m_uGrainSize = 1;
+	};
+
+	void ParallelForCoverageFunc(void* pData, u_int uBegin, u_int uEnd)
+	{
+		ParallelForCoverageData* pxData = static_cast<ParallelForCoverageData*>(pData);
+		pxData->m_uChunks.fetch_add(1, std::memory_order_relaxed);
+		if (uEnd - uBegin < pxData->m_uGrainSize)
+		{
+			pxData->m_uUndersizedChunks.fetch_add(1, std::memory_order_relaxed);
+		}
+		for (u_int u = uBegin; u < uEnd; u++)
+		{
+			pxData->m_puHits[u].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+// Every element of the range is visited exactly once, and guided chunking never
+// hands out a chunk below the grain size except for the final tail.
+ZENITH_TEST(TaskSystem, ParallelForCoversEveryElementOnce)
+{
+	constexpr u_int uNUM_ELEMENTS = 10007;
+	constexpr u_int uGRAIN_SIZE = 16;
+
+	ParallelForCoverageData xData;
+	xData.m_puHits = new std::atomic<u_int>[uNUM_ELEMENTS];
+	for (u_int u = 0; u < uNUM_ELEMENTS; u++)
+	{
+		xData.m_puHits[u].store(0, std::memory_order_relaxed);
+	}
+	xData.m_uGrainSize = uGRAIN_SIZE;
+
+	g_xEngine.Tasks().ParallelFor(ZENITH_PROFILE_ZONE("Unit Test Task"), ParallelForCoverageFunc, &xData, uNUM_ELEMENTS, uGRAIN_SIZE);
+
+	u_int uBadElements = 0;
+	for (u_int u = 0; u < uNUM_ELEMENTS; u++)
+	{
+		if (xData.m_puHits[u].load(std::memory_order_relaxed) != 1)
+		{
+			uBadElements++;
+		}
+	}
+	delete[] xData.m_puHits;
+
+	ZENITH_ASSERT_EQ(uBadElements, 0u, "Every element should be visited exactly once");
+	ZENITH_ASSERT_LE(xData.m_uUndersizedChunks.load(), 1u, "Only the final tail chunk may be smaller than the grain");
+	ZENITH_ASSERT_LE(xData.m_uChunks.load(), (uNUM_ELEMENTS + uGRAIN_SIZE - 1) / uGRAIN_SIZE, "Chunks should never be finer than the grain");
+}
+
+// A resubmitted parallel-for rewinds its range, and a grain larger than the
+// whole range collapses to a single chunk on a single runner.
+ZENITH_TEST(TaskSystem, ParallelForTaskReusableAndCoarseGrain)
+{
+	constexpr u_int uNUM_ELEMENTS = 100;
+
+	ParallelForCoverageData xData;
+	xData.m_puHits = new std::atomic<u_int>[uNUM_ELEMENTS];
+	for (u_int u = 0; u < uNUM_ELEMENTS; u++)
+	{
+		xData.m_puHits[u].store(0, std::memory_order_relaxed);
+	}
+	xData.m_uGrainSize = 1;
+
+	Zenith_ParallelForTask xTask(ZENITH_PROFILE_ZONE("Unit Test Task"), ParallelForCoverageFunc, &xData, uNUM_ELEMENTS, 1, /*bCallingThreadParticipates=*/true);
+	for (u_int uRun = 0; uRun < 3; uRun++)
+	{
+		g_xEngine.Tasks().SubmitParallelFor(&xTask);
+		xTask.WaitUntilComplete();
+	}
+
+	u_int uBadElements = 0;
+	for (u_int u = 0; u < uNUM_ELEMENTS; u++)
+	{
+		if (xData.m_puHits[u].load(std::memory_order_relaxed) != 3)
+		{
+			uBadElements++;
+		}
+	}
+	ZENITH_ASSERT_EQ(uBadElements, 0u, "Each of the three runs should visit every element once");
+
+	xData.m_uChunks.store(0, std::memory_order_relaxed);
+	Zenith_ParallelForTask xCoarse(ZENITH_PROFILE_ZONE("Unit Test Task"), ParallelForCoverageFunc, &xData, uNUM_ELEMENTS, uNUM_ELEMENTS * 4);
+	g_xEngine.Tasks().SubmitParallelFor(&xCoarse);
+	xCoarse.WaitUntilComplete();
+	delete[] xData.m_puHits;
+
+	ZENITH_ASSERT_EQ(xData.m_uChunks.load(), 1u, "A grain covering the whole range should run as one chunk");
+}
+
+namespace
+{
+	void FrameGraphNoOpSystem(void*)
+	{
+	}
+
+	// Busy-waits for m_fMilliseconds, then records its order like RecordOrderTask.
+	struct SpinSystemData
+	{
+		OrderedTaskData m_xOrder;
+		double m_fMilliseconds = 0.0;
+	};
+
+	void SpinSystem(void* pData)
+	{
+		SpinSystemData* pxData = static_cast<SpinSystemData*>(pData);
+		const double fTicksPerMs = 1.0e6 / Zenith_Profiling_Detail::GetTicksToNs();
+		const u_int64 ulEnd = Zenith_Profiling_Detail::GetTimestamp() + static_cast<u_int64>(pxData->m_fMilliseconds * fTicksPerMs);
+		while (Zenith_Profiling_Detail::GetTimestamp() < ulEnd)
+		{
+		}
+		RecordOrderTask(&pxData->m_xOrder);
+	}
+}
+
+// Edges come only from write/write and read/write overlaps, in registration
+// order, and an edge already implied by a nearer one is not added twice.
+ZENITH_TEST(TaskSystem, FrameGraphDerivesConflictEdges)
+{
+	Zenith_FrameGraph xGraph(g_xEngine.Tasks());
+	const Zenith_FrameResource xA = xGraph.RegisterResource("A");
+	const Zenith_FrameResource xB = xGraph.RegisterResource("B");
+	ZENITH_ASSERT_EQ(xGraph.RegisterResource("A"), xA, "Resource names should be interned");
+
+	Zenith_FrameGraph::SystemDesc xWriteA("WriteA", FrameGraphNoOpSystem, nullptr);
+	Zenith_FrameGraph::SystemDesc xReadA0("ReadA0", FrameGraphNoOpSystem, nullptr);
+	Zenith_FrameGraph::SystemDesc xReadA1("ReadA1", FrameGraphNoOpSystem, nullptr);
+	Zenith_FrameGraph::SystemDesc xWriteB("WriteB", FrameGraphNoOpSystem, nullptr);
+	Zenith_FrameGraph::SystemDesc xWriteAgainA("WriteAgainA", FrameGraphNoOpSystem, nullptr);
+	const u_int uWriteA = xGraph.AddSystem(xWriteA.Writes(xA));
+	const u_int uReadA0 = xGraph.AddSystem(xReadA0.Reads(xA).AnyThread());
+	const u_int uReadA1 = xGraph.AddSystem(xReadA1.Reads(xA).AnyThread());
+	const u_int uWriteB = xGraph.AddSystem(xWriteB.Writes(xB).AnyThread());
+	const u_int uWriteAgainA = xGraph.AddSystem(xWriteAgainA.Writes(xA));
+	xGraph.Build();
+
+	ZENITH_ASSERT_TRUE(xGraph.DependsOn(uReadA0, uWriteA), "A reader should wait for the earlier writer");
+	ZENITH_ASSERT_TRUE(xGraph.DependsOn(uReadA1, uWriteA), "Every reader should wait for the earlier writer");
+	ZENITH_ASSERT_FALSE(xGraph.DependsOn(uReadA1, uReadA0), "Two readers should not be ordered");
+	ZENITH_ASSERT_FALSE(xGraph.DependsOn(uWriteB, uWriteA), "Systems with disjoint resources should not be ordered");
+	ZENITH_ASSERT_TRUE(xGraph.DependsOn(uWriteAgainA, uReadA0), "A later writer should wait for earlier readers");
+	ZENITH_ASSERT_TRUE(xGraph.DependsOn(uWriteAgainA, uReadA1), "A later writer should wait for every earlier reader");
+	ZENITH_ASSERT_TRUE(xGraph.DependsOn(uWriteAgainA, uWriteA), "Ordering should be transitive");
+	ZENITH_ASSERT_FALSE(xGraph.DependsOn(uWriteAgainA, uWriteB), "Disjoint resources stay unordered across the graph");
+}
+
+// Mixed main-thread and any-thread systems run in dependency order, a disabled
+// system is skipped but still orders its neighbours, and the same graph runs
+// again on the next Execute.
+ZENITH_TEST(TaskSystem, FrameGraphExecutesInDependencyOrder)
+{
+	TaskOrderRecorder xRecorder;
+	OrderedTaskData axData[5];
+	for (u_int u = 0; u < 5; u++)
+	{
+		axData[u].m_pxRecorder = &xRecorder;
+		axData[u].m_uSlot = u;
+	}
+
+	Zenith_FrameGraph xGraph(g_xEngine.Tasks());
+	const Zenith_FrameResource xA = xGraph.RegisterResource("A");
+	const Zenith_FrameResource xB = xGraph.RegisterResource("B");
+	const Zenith_FrameResource xC = xGraph.RegisterResource("C");
+	Zenith_FrameGraph::SystemDesc xProduce("Produce", RecordOrderTask, &axData[0]);
+	Zenith_FrameGraph::SystemDesc xTransform("Transform", RecordOrderTask, &axData[1]);
+	Zenith_FrameGraph::SystemDesc xConsume("Consume", RecordOrderTask, &axData[2]);
+	Zenith_FrameGraph::SystemDesc xDisjoint("Disjoint", RecordOrderTask, &axData[3]);
+	Zenith_FrameGraph::SystemDesc xDisabled("Disabled", RecordOrderTask, &axData[4]);
+	const u_int uProduce = xGraph.AddSystem(xProduce.Writes(xA));
+	const u_int uTransform = xGraph.AddSystem(xTransform.Reads(xA).Writes(xB).AnyThread());
+	const u_int uConsume = xGraph.AddSystem(xConsume.Reads(xB));
+	const u_int uDisjoint = xGraph.AddSystem(xDisjoint.Writes(xC).AnyThread());
+	const u_int uDisabled = xGraph.AddSystem(xDisabled.Reads(xB).AnyThread());
+	xGraph.Build();
+	xGraph.SetSystemEnabled(uDisabled, false);
+
+	for (u_int uRun = 0; uRun < 2; uRun++)
+	{
+		xRecorder.m_uNextSequence.store(0, std::memory_order_relaxed);
+		xGraph.Execute();
+
+		ZENITH_ASSERT_EQ(xRecorder.m_uNextSequence.load(), 4u, "Every enabled system should run exactly once per Execute");
+		ZENITH_ASSERT_LT(xRecorder.m_auSequence[uProduce], xRecorder.m_auSequence[uTransform], "An any-thread system should wait for its main-thread predecessor");
+		ZENITH_ASSERT_LT(xRecorder.m_auSequence[uTransform], xRecorder.m_auSequence[uConsume], "A main-thread system should wait for its any-thread predecessor");
+		ZENITH_ASSERT_TRUE(xGraph.GetTiming(uDisjoint).m_bRan, "The disjoint system should have run");
+		ZENITH_ASSERT_FALSE(xGraph.GetTiming(uDisabled).m_bRan, "A disabled system should not run");
+	}
+}
+
+// The critical path follows the longest duration-weighted chain: here the two
+// dependent main-thread systems, not the short independent worker system.
+ZENITH_TEST(TaskSystem, FrameGraphCriticalPath)
+{
+	TaskOrderRecorder xRecorder;
+	SpinSystemData axData[3];
+	const double afMilliseconds[3] = { 3.0, 1.0, 0.25 };
+	for (u_int u = 0; u < 3; u++)
+	{
+		axData[u].m_xOrder.m_pxRecorder = &xRecorder;
+		axData[u].m_xOrder.m_uSlot = u;
+		axData[u].m_fMilliseconds = afMilliseconds[u];
+	}
+
+	Zenith_FrameGraph xGraph(g_xEngine.Tasks());
+	const Zenith_FrameResource xA = xGraph.RegisterResource("A");
+	const Zenith_FrameResource xB = xGraph.RegisterResource("B");
+	Zenith_FrameGraph::SystemDesc xLong("Long", SpinSystem, &axData[0]);
+	Zenith_FrameGraph::SystemDesc xAfterLong("AfterLong", SpinSystem, &axData[1]);
+	Zenith_FrameGraph::SystemDesc xShort("Short", SpinSystem, &axData[2]);
+	const u_int uLong = xGraph.AddSystem(xLong.Writes(xA));
+	const u_int uAfterLong = xGraph.AddSystem(xAfterLong.Reads(xA));
+	const u_int uShort = xGraph.AddSystem(xShort.Writes(xB).AnyThread());
+	xGraph.Build();
+	xGraph.Execute();
+
+	ZENITH_ASSERT_TRUE(xGraph.GetTiming(uLong).m_bOnCriticalPath, "The long system should be on the critical path");
+	ZENITH_ASSERT_TRUE(xGraph.GetTiming(uAfterLong).m_bOnCriticalPath, "Its dependent should be on the critical path");
+	ZENITH_ASSERT_FALSE(xGraph.GetTiming(uShort).m_bOnCriticalPath, "The short independent system should not be");
+	ZENITH_ASSERT_GE(xGraph.GetCriticalPathMs(), 4.0, "The critical path should cover both chained systems");
+	ZENITH_ASSERT_LE(xGraph.GetCriticalPathMs(), xGraph.GetWallMs(), "The critical path cannot exceed the graph's wall-clock");
+
+#if ZENITH_PROFILING_ENABLED
+	// Published into a local profiler, never the engine's.
+	Zenith_Profiling* pxProfiling = new Zenith_Profiling();
+	xGraph.PublishReport(*pxProfiling);
+	const u_int uNumPublished = pxProfiling->GetFrameSystems().GetSize();
+	const bool bLongPublishedCritical = pxProfiling->GetFrameSystems().Get(uLong).m_bOnCriticalPath;
+	const double fPublishedCriticalMs = pxProfiling->GetFrameSystemCriticalPathMs();
+	delete pxProfiling;
+	ZENITH_ASSERT_EQ(uNumPublished, 3u, "Every system that ran should be published");
+	ZENITH_ASSERT_TRUE(bLongPublishedCritical, "The published entry should carry the critical-path flag");
+	ZENITH_ASSERT_EQ_FLOAT(fPublishedCriticalMs, xGraph.GetCriticalPathMs(), 1e-9, "The published critical-path total should match the graph's");
+#endif
+}
@@ -3,7 +3,6 @@
 
 #include "TaskSystem/Zenith_TaskSystem.h"
 
-#include "Core/Zenith_ErrorCode.h"
 #include "DebugVariables/Zenith_DebugVariables.h"
 #include <thread>
 
@@ -11,33 +10,135 @@ DEBUGVAR bool dbg_bMultithreaded = true;
 
 namespace
 {
-	void ThreadFunc(const void*)
+	// Which task system (if any) owns the current thread as a worker, and its
+	// index into m_pxWorkers. Non-worker threads (main, file watcher, ...) keep
+	// the defaults and submit through the injection queue.
+	thread_local Zenith_TaskSystem* tl_pxWorkerOwner = nullptr;
+	thread_local u_int tl_uWorkerIndex = UINT32_MAX;
+
+	// Victim-selection seed for threads that steal while helping but own no deque.
+	thread_local u_int tl_uHelperStealSeed = 0x9E3779B9u;
+
+	// The initialised task system, so tasks and workers reach it without the
+	// engine singleton. Set in Initialise, cleared in Shutdown.
+	Zenith_TaskSystem*& TaskSystemSelf()
 	{
-		g_xEngine.Tasks().RunWorkerLoop();
+		static Zenith_TaskSystem* s_pxSelf = nullptr;
+		return s_pxSelf;
+	}
+
+	void ThreadFunc(const void* pUserData)
+	{
+		TaskSystemSelf()->RunWorkerLoop(static_cast<u_int>(reinterpret_cast<uintptr_t>(pUserData)));
+	}
+
+	u_int NextStealSeed(u_int& uSeed)
+	{
+		// xorshift32: cheap, and only has to spread thieves across victims.
+		uSeed ^= uSeed << 13;
+		uSeed ^= uSeed >> 17;
+		uSeed ^= uSeed << 5;
+		return uSeed;
 	}
 }
 
-void Zenith_TaskSystem::RunWorkerLoop()
+void Zenith_Task::WaitUntilComplete()
 {
-	do
+	if (!m_bSubmitted.load(std::memory_order_acquire)) return;
+	Zenith_Profiling_Detail::BeginProfileZone(ZENITH_PROFILE_ZONE("Wait for Task System"), nullptr);
+
+	// Help first: every task this thread runs is one a worker does not have to.
+	// Only once nothing is runnable does the thread actually block.
+	Zenith_TaskSystem& xTasks = *TaskSystemSelf();
+	while (!m_xSemaphore.TryWait())
 	{
-		m_pxWorkAvailableSem->Wait();
+		if (!xTasks.TryRunPendingTask())
+		{
+			m_xSemaphore.Wait();
+			break;
+		}
+	}
 
-		if (m_bTerminateThreads.load(std::memory_order_acquire)) break;
+	Zenith_Profiling_Detail::EndProfileZone(ZENITH_PROFILE_ZONE("Wait for Task System"));
+	MarkRecycled();
+}
 
-		Zenith_Task* pxTask = nullptr;
-		m_xQueueMutex.Lock();
-		bool bDequeued = m_xTaskQueue.Dequeue(pxTask);
-		m_xQueueMutex.Unlock();
+void Zenith_Task::DependsOn(Zenith_Task& xPredecessor)
+{
+	Zenith_Assert(&xPredecessor != this, "DependsOn: a task cannot depend on itself");
+	Zenith_Assert(!m_bSubmitted.load(std::memory_order_acquire) && !xPredecessor.m_bSubmitted.load(std::memory_order_acquire),
+		"DependsOn: both tasks must be unsubmitted (wait on them first) when adding an edge");
 
-		Zenith_Assert(bDequeued && pxTask != nullptr,
-			"ThreadFunc: Semaphore signaled but dequeue failed - synchronization bug");
+	xPredecessor.m_axSuccessors.PushBack(this);
+	m_uNumPredecessors++;
+	m_uPendingDependencies.fetch_add(1, std::memory_order_relaxed);
+}
 
-		if (!pxTask) continue;  // Safety fallback for release builds
+void Zenith_Task::FinishTask()
+{
+	m_uCompletedThreadID = Zenith_Multithreading_Detail::GetCurrentThreadID();
 
-		pxTask->DoTask();
+	// Successors first: once the semaphore is signalled the waiter owns this
+	// task again and may reuse or delete it, successor list included.
+	for (u_int u = 0; u < m_axSuccessors.GetSize(); u++)
+	{
+		TaskSystemSelf()->OnDependencySatisfied(m_axSuccessors.Get(u));
+	}
+
+	m_xSemaphore.Signal();
+}
+
+// Sleep protocol. An idle worker ADVERTISES (m_uSleepingWorkers++) and then
+// re-checks every queue before blocking. A submitter publishes its work and then
+// CLAIMS (m_uSleepingWorkers--) one advertised sleeper per semaphore Signal. With
+// both sides fenced seq_cst, either the submitter sees the advertisement or the
+// worker sees the work, so no wakeup is lost. A worker that finds work after
+// advertising withdraws its own advertisement; if a submitter got there first the
+// matching Signal is already in flight and the worker consumes it, keeping the
+// semaphore count bounded by the worker count.
+void Zenith_TaskSystem::RunWorkerLoop(u_int uWorkerIndex)
+{
+	tl_pxWorkerOwner = this;
+	tl_uWorkerIndex = uWorkerIndex;
+
+	while (!m_bTerminateThreads.load(std::memory_order_acquire))
+	{
+		Zenith_Task* pxTask = FindTask(uWorkerIndex);
+		if (pxTask != nullptr)
+		{
+			pxTask->DoTask();
+			continue;
+		}
+
+		m_uSleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		pxTask = FindTask(uWorkerIndex);
+		if (pxTask == nullptr && !m_bTerminateThreads.load(std::memory_order_seq_cst))
+		{
+			m_pxWorkAvailableSem->Wait();
+			continue;
+		}
+
+		u_int uSleeping = m_uSleepingWorkers.load(std::memory_order_seq_cst);
+		bool bWithdrawn = false;
+		while (uSleeping > 0 && !bWithdrawn)
+		{
+			bWithdrawn = m_uSleepingWorkers.compare_exchange_weak(uSleeping, uSleeping - 1, std::memory_order_seq_cst);
+		}
+		if (!bWithdrawn)
+		{
+			m_pxWorkAvailableSem->Wait();
+		}
+
+		if (pxTask != nullptr)
+		{
+			pxTask->DoTask();
+		}
+	}
 
-	} while (!m_bTerminateThreads.load(std::memory_order_acquire));
+	tl_pxWorkerOwner = nullptr;
+	tl_uWorkerIndex = UINT32_MAX;
 
 	// Thread-exit unregister: free this worker's profiling ring + clear its TLS
 	// before signalling termination, so Profiling::Shutdown (which runs after the
@@ -64,14 +165,24 @@ void Zenith_TaskSystem::Initialise()
 
 	Zenith_Log(LOG_CATEGORY_TASKSYSTEM, "Creating %u worker threads (hardware reports %u threads)", uNumThreads, uHardwareThreads);
 
-	m_pxWorkAvailableSem = new Zenith_Semaphore(0, uMAX_TASKS);
+	m_pxWorkers = new WorkerState[uNumThreads];
+	for (u_int u = 0; u < uNumThreads; u++)
+	{
+		m_pxWorkers[u].m_uStealSeed = 0x9E3779B9u * (u + 1);
+	}
+
+	// At most one outstanding Signal per advertised sleeper (see RunWorkerLoop).
+	m_pxWorkAvailableSem = new Zenith_Semaphore(0, uNumThreads);
 	m_pxThreadsTerminatedSem = new Zenith_Semaphore(0, uNumThreads);
 
+	// Before the workers start: ThreadFunc reads it.
+	TaskSystemSelf() = this;
+
 	for (u_int u = 0; u < uNumThreads; u++)
 	{
 		char acName[Zenith_Multithreading::uMAX_THREAD_NAME_LENGTH];
 		snprintf(acName, Zenith_Multithreading::uMAX_THREAD_NAME_LENGTH, "Zenith_TaskSystem %u", u);
-		g_xEngine.Threading().CreateThread(acName, ThreadFunc, nullptr);
+		g_xEngine.Threading().CreateThread(acName, ThreadFunc, reinterpret_cast<const void*>(static_cast<uintptr_t>(u)));
 	}
 
 #ifdef ZENITH_DEBUG_VARIABLES
@@ -90,16 +201,14 @@ void Zenith_TaskSystem::Shutdown()
 
 	Zenith_Log(LOG_CATEGORY_TASKSYSTEM, "Shutting down task system...");
 
-	m_bTerminateThreads.store(true, std::memory_order_release);
+	m_bTerminateThreads.store(true, std::memory_order_seq_cst);
 
-	// Fence ensures the terminate flag is visible before workers are woken
+	// Fence ensures the terminate flag is visible before sleepers are claimed:
+	// a worker that advertises after this point re-reads the flag and exits.
 	std::atomic_thread_fence(std::memory_order_seq_cst);
 
 	Zenith_Assert(m_pxWorkAvailableSem != nullptr, "Shutdown: Semaphore is null");
-	for (u_int u = 0; u < m_uNumWorkerThreads; u++)
-	{
-		m_pxWorkAvailableSem->Signal();
-	}
+	WakeWorkers(m_uNumWorkerThreads);
 
 	Zenith_Assert(m_pxThreadsTerminatedSem != nullptr, "Shutdown: Termination semaphore is null");
 	for (u_int u = 0; u < m_uNumWorkerThreads; u++)
@@ -108,18 +217,30 @@ void Zenith_TaskSystem::Shutdown()
 	}
 
 	{
-		Zenith_ScopedMutexLock xLock(m_xQueueMutex);
-		Zenith_Assert(m_xTaskQueue.IsEmpty(),
-			"Shutdown: Task queue not empty - %u tasks will be dropped!", m_xTaskQueue.GetSize());
+		Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xInjectionMutex);
+		Zenith_Assert(m_uInjectedHead == m_xInjectedTasks.GetSize(),
+			"Shutdown: Injection queue not empty - %u tasks will be dropped!", m_xInjectedTasks.GetSize() - m_uInjectedHead);
+		m_xInjectedTasks.Clear();
+		m_uInjectedHead = 0;
+		m_uInjectedCount.store(0, std::memory_order_relaxed);
+	}
+	for (u_int u = 0; u < m_uNumWorkerThreads; u++)
+	{
+		Zenith_Assert(m_pxWorkers[u].m_xDeque.IsEmpty(),
+			"Shutdown: Worker %u deque not empty - %u tasks will be dropped!", u, m_pxWorkers[u].m_xDeque.GetSize());
 	}
 
+	delete[] m_pxWorkers;
 	delete m_pxWorkAvailableSem;
 	delete m_pxThreadsTerminatedSem;
+	m_pxWorkers = nullptr;
 	m_pxWorkAvailableSem = nullptr;
 	m_pxThreadsTerminatedSem = nullptr;
 	m_uNumWorkerThreads = 0;
+	m_uSleepingWorkers.store(0, std::memory_order_relaxed);
 	m_bTerminateThreads.store(false, std::memory_order_release);
 	m_bInitialized.store(false, std::memory_order_release);
+	TaskSystemSelf() = nullptr;
 
 	Zenith_Log(LOG_CATEGORY_TASKSYSTEM, "Task system shutdown complete");
 }
@@ -138,95 +259,244 @@ bool Zenith_TaskSystem::TryClaimTask(Zenith_Task* pxTask, const char* szCallerNa
 	return true;
 }
 
-u_int Zenith_TaskSystem::EnqueueAndSignal(Zenith_Task* pxTask, u_int uCount)
+void Zenith_TaskSystem::PushTasks(Zenith_Task* pxTask, u_int uCount)
 {
-	u_int uEnqueuedCount = 0;
+	// A worker feeds its own deque (no lock, and it will likely pop the work
+	// back itself while the cache is warm); anything else - or whatever does
+	// not fit - goes through the injection queue.
+	u_int uPushed = 0;
+	if (tl_pxWorkerOwner == this)
 	{
-		Zenith_ScopedMutexLock xLock(m_xQueueMutex);
-		for (u_int u = 0; u < uCount; u++)
+		WorkerState& xSelf = m_pxWorkers[tl_uWorkerIndex];
+		while (uPushed < uCount && xSelf.m_xDeque.Push(pxTask))
 		{
-			if (!m_xTaskQueue.Enqueue(pxTask))
-			{
-				break;
-			}
-			uEnqueuedCount++;
+			uPushed++;
 		}
 	}
 
-	// Overflow is recoverable back-pressure, not a crash: log QUEUE_FULL and
-	// let the caller absorb the shortfall (RecoverFromShortEnqueue /
-	// RunInvocationsOnCallingThread).
-	Zenith_Check(uEnqueuedCount == uCount,
-		"EnqueueAndSignal: Only enqueued %u/%u tasks - queue full (Zenith_ErrorCode::QUEUE_FULL)!", uEnqueuedCount, uCount);
+	if (uPushed < uCount)
+	{
+		Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xInjectionMutex);
+		for (u_int u = uPushed; u < uCount; u++)
+		{
+			m_xInjectedTasks.PushBack(pxTask);
+		}
+		m_uInjectedCount.fetch_add(uCount - uPushed, std::memory_order_release);
+	}
 
-	for (u_int u = 0; u < uEnqueuedCount; u++)
+	// Publish-then-claim half of the sleep protocol (see RunWorkerLoop).
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	WakeWorkers(uCount);
+}
+
+bool Zenith_TaskSystem::PopInjected(Zenith_Task*& pxTaskOut)
+{
+	if (m_uInjectedCount.load(std::memory_order_acquire) == 0)
 	{
-		m_pxWorkAvailableSem->Signal();
+		return false;
+	}
+
+	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xInjectionMutex);
+	const u_int uSize = m_xInjectedTasks.GetSize();
+	if (m_uInjectedHead == uSize)
+	{
+		return false;
 	}
 
-	return uEnqueuedCount;
+	pxTaskOut = m_xInjectedTasks.Get(m_uInjectedHead++);
+	m_uInjectedCount.fetch_sub(1, std::memory_order_relaxed);
+
+	if (m_uInjectedHead == uSize)
+	{
+		// Drained: rewind in place, keeping the capacity for the next burst.
+		m_xInjectedTasks.Clear();
+		m_uInjectedHead = 0;
+	}
+	else if (m_uInjectedHead >= uWORKER_DEQUE_CAPACITY && m_uInjectedHead * 2 >= uSize)
+	{
+		// Never fully drained under a steady stream: slide the live tail down so
+		// the consumed prefix does not grow without bound.
+		const u_int uLive = uSize - m_uInjectedHead;
+		for (u_int u = 0; u < uLive; u++)
+		{
+			m_xInjectedTasks.Get(u) = m_xInjectedTasks.Get(m_uInjectedHead + u);
+		}
+		m_xInjectedTasks.Resize(uLive);
+		m_uInjectedHead = 0;
+	}
+	return true;
 }
 
-// A task the queue refused was never handed to a worker: recycle it so the
-// caller can resubmit and its WaitUntilComplete() is a no-op.
-void Zenith_TaskSystem::RecoverFromShortEnqueue(Zenith_Task* pxTask)
+bool Zenith_TaskSystem::TrySteal(u_int uThiefIndex, Zenith_Task*& pxTaskOut)
 {
-	pxTask->MarkRecycled();
+	const u_int uNumWorkers = m_uNumWorkerThreads;
+	if (uNumWorkers == 0)
+	{
+		return false;
+	}
+
+	u_int& uSeed = (uThiefIndex < uNumWorkers) ? m_pxWorkers[uThiefIndex].m_uStealSeed : tl_uHelperStealSeed;
+	const u_int uStart = NextStealSeed(uSeed) % uNumWorkers;
+	for (u_int u = 0; u < uNumWorkers; u++)
+	{
+		const u_int uVictim = (uStart + u) % uNumWorkers;
+		if (uVictim == uThiefIndex)
+		{
+			continue;
+		}
+		if (m_pxWorkers[uVictim].m_xDeque.Steal(pxTaskOut))
+		{
+			m_ulStealCount.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	return false;
 }
 
-// The completion semaphore fires only after EXACTLY GetNumInvocations() DoTask()
-// calls, so every invocation that did not reach a worker (the calling thread's
-// participation slot, plus any a full queue dropped) must run here or
-// WaitUntilComplete() blocks forever.
-void Zenith_TaskSystem::RunInvocationsOnCallingThread(Zenith_DataParallelTask* pxTask, u_int uCount)
+Zenith_Task* Zenith_TaskSystem::FindTask(u_int uWorkerIndex)
 {
-	for (u_int u = 0; u < uCount; u++)
+	Zenith_Task* pxTask = nullptr;
+	if (uWorkerIndex < m_uNumWorkerThreads && m_pxWorkers[uWorkerIndex].m_xDeque.Pop(pxTask))
+	{
+		return pxTask;
+	}
+	if (PopInjected(pxTask))
+	{
+		return pxTask;
+	}
+	if (TrySteal(uWorkerIndex, pxTask))
 	{
-		pxTask->DoTask();
+		return pxTask;
 	}
+	return nullptr;
 }
 
-void Zenith_TaskSystem::SubmitTask(Zenith_Task* pxTask)
+bool Zenith_TaskSystem::TryRunPendingTask()
 {
-	if (!TryClaimTask(pxTask, "SubmitTask"))
+	if (!m_bInitialized.load(std::memory_order_acquire))
 	{
-		return;
+		return false;
+	}
+
+	const u_int uWorkerIndex = (tl_pxWorkerOwner == this) ? tl_uWorkerIndex : UINT32_MAX;
+	Zenith_Task* pxTask = FindTask(uWorkerIndex);
+	if (pxTask == nullptr)
+	{
+		return false;
 	}
 
+	pxTask->DoTask();
+	return true;
+}
+
+void Zenith_TaskSystem::WakeWorkers(u_int uCount)
+{
+	u_int uSleeping = m_uSleepingWorkers.load(std::memory_order_seq_cst);
+	while (uCount > 0 && uSleeping > 0)
+	{
+		if (m_uSleepingWorkers.compare_exchange_weak(uSleeping, uSleeping - 1, std::memory_order_seq_cst))
+		{
+			m_pxWorkAvailableSem->Signal();
+			uCount--;
+			uSleeping--;
+		}
+	}
+}
+
+void Zenith_TaskSystem::Dispatch(Zenith_Task* pxTask, u_int uCount)
+{
 	if (!dbg_bMultithreaded)
 	{
-		pxTask->DoTask();
+		for (u_int u = 0; u < uCount; u++)
+		{
+			pxTask->DoTask();
+		}
 		return;
 	}
 
-	if (EnqueueAndSignal(pxTask, 1) == 0)
+	PushTasks(pxTask, uCount);
+}
+
+void Zenith_TaskSystem::OnDependencySatisfied(Zenith_Task* pxTask)
+{
+	if (pxTask->ReleaseDependency())
 	{
-		RecoverFromShortEnqueue(pxTask);
+		Dispatch(pxTask, pxTask->GetDispatchCount());
 	}
 }
 
-void Zenith_TaskSystem::SubmitDataParallelTask(Zenith_DataParallelTask* pxTask)
+void Zenith_TaskSystem::SubmitTask(Zenith_Task* pxTask)
 {
-	if (!TryClaimTask(pxTask, "SubmitDataParallelTask"))
+	if (!TryClaimTask(pxTask, "SubmitTask"))
 	{
 		return;
 	}
 
-	// Safe to reset only while claimed: the submitted flag serializes resubmission
-	pxTask->ResetCounters();
+	// Not ready yet: the last predecessor to finish dispatches it.
+	if (!pxTask->ReleaseDependency())
+	{
+		return;
+	}
 
-	const u_int uNumInvocations = pxTask->GetNumInvocations();
+	Dispatch(pxTask, 1);
+}
 
-	if (!dbg_bMultithreaded)
+void Zenith_TaskSystem::SubmitParallelFor(Zenith_ParallelForTask* pxTask)
+{
+	if (!TryClaimTask(pxTask, "SubmitParallelFor"))
+	{
+		return;
+	}
+
+	// Safe to reset only while claimed: the submitted flag serializes
+	// resubmission. One runner per worker, plus the submitting thread when it
+	// participates; never more runners than there are grain-sized chunks.
+	const u_int uMaxRunners = m_uNumWorkerThreads + (pxTask->GetCallingThreadParticipates() ? 1 : 0);
+	pxTask->ResetForSubmit(uMaxRunners);
+
+	// A task still waiting on predecessors is dispatched in full by the last of
+	// them; the submitting thread has returned by then and cannot participate.
+	if (!pxTask->ReleaseDependency())
+	{
+		return;
+	}
+
+	const u_int uNumRunners = pxTask->GetDispatchCount();
+	if (!dbg_bMultithreaded || !pxTask->GetCallingThreadParticipates())
 	{
-		RunInvocationsOnCallingThread(pxTask, uNumInvocations);
+		Dispatch(pxTask, uNumRunners);
 		return;
 	}
 
-	const u_int uTasksForWorkers = pxTask->GetCallingThreadParticipates()
-		? (uNumInvocations > 0 ? uNumInvocations - 1 : 0)
-		: uNumInvocations;
+	// Claim the first chunk before any worker can see the task, so the calling
+	// thread is guaranteed a share of the range however fast the workers are.
+	u_int uBegin = 0;
+	u_int uEnd = 0;
+	const bool bClaimed = pxTask->TryClaimRange(uBegin, uEnd);
 
-	const u_int uEnqueuedForWorkers = EnqueueAndSignal(pxTask, uTasksForWorkers);
-	RunInvocationsOnCallingThread(pxTask, uNumInvocations - uEnqueuedForWorkers);
+	if (uNumRunners > 1)
+	{
+		PushTasks(pxTask, uNumRunners - 1);
+	}
+	if (bClaimed)
+	{
+		pxTask->RunRange(uBegin, uEnd);
+	}
+	pxTask->DoTask();
 }
+
+void Zenith_TaskSystem::ParallelFor(Zenith_ProfileZoneID uProfileZoneID, Zenith_ParallelForFunction pfnFunc, void* pData, u_int uNumElements, u_int uGrainSize)
+{
+	if (uNumElements == 0)
+	{
+		return;
+	}
+
+	Zenith_ParallelForTask xTask(uProfileZoneID, pfnFunc, pData, uNumElements, uGrainSize, /*bCallingThreadParticipates=*/true);
+	SubmitParallelFor(&xTask);
+	xTask.WaitUntilComplete();
+}
+
+// Zenith_TaskSystem.obj is always linked (Zenith_Engine owns the task system),
+// so MSVC cannot dead-strip the static test registrars in this include.
+#include "TaskSystem/Zenith_TaskSystem.Tests.inl"
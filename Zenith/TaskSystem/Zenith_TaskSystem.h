@@ -1,17 +1,26 @@
 #pragma once
 
-#include "Collections/Zenith_CircularQueue.h"
+#include "Collections/Zenith_InlineVector.h"
+#include "Collections/Zenith_Vector.h"
+#include "Collections/Zenith_WorkStealingDeque.h"
 #include "Core/Multithreading/Zenith_Multithreading.h"
 #include "Profiling/Zenith_Profiling.h"
 
 #include <atomic>
 
-// TaskSystem is a FLAT task pool, NOT a dependency graph (no DependsOn API). To
-// order work, block on a task's WaitUntilComplete() before submitting its
-// successor. Use Zenith_DataParallelTask for independent parallel invocations.
+// TaskSystem is a work-stealing pool with task dependencies. Each worker owns a
+// Chase-Lev deque; submits from a worker go to its own deque, submits from any
+// other thread go to a shared injection queue, and idle workers steal. Order work
+// with Zenith_Task::DependsOn (a successor is only dispatched once every
+// predecessor has completed) rather than blocking between submits. A thread
+// blocked in WaitUntilComplete runs other ready tasks instead of sleeping. Use
+// Zenith_ParallelForTask (or the blocking ParallelFor helper) to split a range of
+// elements into chunks, and Zenith_DataParallelTask for a handful of coarse
+// invocations.
 
 using Zenith_TaskFunction = void(*)(void* pData);
 using Zenith_DataParallelTaskFunction = void(*)(void* pData, u_int uInvocationIndex, u_int uNumInvocations);
+using Zenith_ParallelForFunction = void(*)(void* pData, u_int uBegin, u_int uEnd);
 
 class Zenith_Task
 {
@@ -39,18 +48,19 @@ public:
 #else
 		m_pfnFunc(m_pData);
 #endif
-		m_uCompletedThreadID = Zenith_Multithreading_Detail::GetCurrentThreadID();
-		m_xSemaphore.Signal();
+		FinishTask();
 	}
 
-	void WaitUntilComplete()
-	{
-		if (!m_bSubmitted.load(std::memory_order_acquire)) return;
-		Zenith_Profiling_Detail::BeginProfileZone(ZENITH_PROFILE_ZONE("Wait for Task System"), nullptr);
-		m_xSemaphore.Wait();
-		Zenith_Profiling_Detail::EndProfileZone(ZENITH_PROFILE_ZONE("Wait for Task System"));
-		MarkRecycled();
-	}
+	// Blocks until the task has completed, running other ready tasks on this
+	// thread while it waits (it only sleeps once there is nothing left to help
+	// with). Recycles the task so it may be submitted again.
+	void WaitUntilComplete();
+
+	// This task will not be dispatched until xPredecessor has completed. Both
+	// tasks must be unsubmitted when the edge is added; edges persist across
+	// resubmission, so a reused graph is declared once. Before resubmitting any
+	// task of a graph, wait on every task of the previous run.
+	void DependsOn(Zenith_Task& xPredecessor);
 
 	const Zenith_ProfileZoneID GetProfileZoneID() const
 	{
@@ -74,6 +84,14 @@ protected:
 	{
 	}
 
+	// How many times the task system hands this task to DoTask per submit.
+	virtual u_int GetDispatchCount() const { return 1; }
+
+	// Releases successors whose last dependency this was, then signals
+	// completion. Must be the LAST thing DoTask does: a waiter may recycle or
+	// destroy the task the moment the semaphore is signalled.
+	void FinishTask();
+
 	Zenith_ProfileZoneID m_uProfileZoneID;
 	Zenith_TaskFunction m_pfnFunc;
 	Zenith_Semaphore m_xSemaphore;
@@ -82,9 +100,9 @@ protected:
 
 private:
 	// m_bSubmitted lifecycle: a submit claims the task exactly once via
-	// TryMarkSubmitted; it becomes resubmittable again via MarkRecycled —
-	// either by WaitUntilComplete observing completion, or by a failed
-	// submit handing the task back to the caller.
+	// TryMarkSubmitted; it becomes resubmittable again via MarkRecycled when
+	// WaitUntilComplete observes completion. Recycling also re-arms the
+	// dependency counter for the next submit.
 	bool TryMarkSubmitted()
 	{
 		bool bExpected = false;
@@ -93,86 +111,209 @@ private:
 
 	void MarkRecycled()
 	{
+		m_uPendingDependencies.store(m_uNumPredecessors + 1, std::memory_order_relaxed);
 		m_bSubmitted.store(false, std::memory_order_release);
 	}
 
+	// Consumes one dependency token; true when this was the last one and the
+	// task is now ready to dispatch. The extra "+1" token is the submit itself,
+	// so a task is never dispatched before it has been submitted AND every
+	// predecessor has finished, whichever happens last.
+	bool ReleaseDependency()
+	{
+		return m_uPendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1;
+	}
+
 	std::atomic<bool> m_bSubmitted;
 
+	// Most tasks fan out to a handful of successors, which fit inline; a wider
+	// fan-out spills to the heap when the edge is added, never while running.
+	static constexpr u_int uINLINE_SUCCESSORS = 16;
+	Zenith_InlineVector<Zenith_Task*, uINLINE_SUCCESSORS> m_axSuccessors;
+	u_int m_uNumPredecessors = 0;
+	std::atomic<u_int> m_uPendingDependencies{1};
+
 	friend class Zenith_TaskSystem;
 };
 
-// ONE task executed uNumInvocations times: worker threads (and optionally the
-// submitting thread) claim invocation indices via atomic fetch-add.
-class Zenith_DataParallelTask : public Zenith_Task
+// ONE descriptor covering the element range [0, uNumElements). Submitting it
+// pushes at most one runner entry per worker rather than one per element; each
+// runner repeatedly claims a chunk with guided scheduling (chunk size is the
+// larger of uGrainSize and remaining / (2 * runners), so chunks start large and
+// shrink towards the grain as the range drains) and calls pfnFunc on it. The
+// task completes when every runner has drained out.
+class Zenith_ParallelForTask : public Zenith_Task
 {
 public:
-	Zenith_DataParallelTask() = delete;
-	Zenith_DataParallelTask(Zenith_ProfileZoneID uProfileZoneID, Zenith_DataParallelTaskFunction pfnFunc, void* pData, u_int uNumInvocations, bool bCallingThreadParticipates = false)
+	Zenith_ParallelForTask() = delete;
+	Zenith_ParallelForTask(Zenith_ProfileZoneID uProfileZoneID, Zenith_ParallelForFunction pfnFunc, void* pData, u_int uNumElements, u_int uGrainSize = 1, bool bCallingThreadParticipates = false)
+		: Zenith_ParallelForTask(uProfileZoneID, pData, uNumElements, uGrainSize, bCallingThreadParticipates)
+	{
+		Zenith_Assert(pfnFunc != nullptr, "ParallelForTask function pointer cannot be null");
+		m_pfnRangeFunc = pfnFunc;
+	}
+
+	// Runs ONE runner: claims and executes chunks until the range is exhausted.
+	virtual void DoTask() override
+	{
+		u_int uBegin = 0;
+		u_int uEnd = 0;
+		while (TryClaimRange(uBegin, uEnd))
+		{
+			RunRange(uBegin, uEnd);
+		}
+		FinishRunner();
+	}
+
+	const u_int GetNumElements() const
+	{
+		return m_uNumElements;
+	}
+
+	const u_int GetGrainSize() const
+	{
+		return m_uGrainSize;
+	}
+
+	// If true, the thread that submits the task claims the first chunk and runs
+	// as one of the runners instead of returning immediately — useful when it
+	// would otherwise idle waiting for completion.
+	const bool GetCallingThreadParticipates() const
+	{
+		return m_bCallingThreadParticipates;
+	}
+
+protected:
+	// For derived tasks that execute a claimed range through their own function.
+	Zenith_ParallelForTask(Zenith_ProfileZoneID uProfileZoneID, void* pData, u_int uNumElements, u_int uGrainSize, bool bCallingThreadParticipates)
 		: Zenith_Task(uProfileZoneID, pData)
-		, m_pfnInvocationFunc(pfnFunc)
-		, m_uNumInvocations(uNumInvocations)
+		, m_pfnRangeFunc(nullptr)
+		, m_uNumElements(uNumElements)
+		, m_uGrainSize(uGrainSize > 0 ? uGrainSize : 1)
 		, m_bCallingThreadParticipates(bCallingThreadParticipates)
-		, m_uInvocationCounter(0)
-		, m_uCompletionCounter(0)
+		, m_uNumRunners(1)
+		, m_uNextElement(0)
+		, m_uRunnersFinished(0)
 	{
-		Zenith_Assert(pfnFunc != nullptr, "DataParallelTask function pointer cannot be null");
-		Zenith_Assert(uNumInvocations > 0, "DataParallelTask must have at least 1 invocation");
+		Zenith_Assert(uNumElements > 0, "ParallelForTask must have at least 1 element");
 	}
 
-	virtual void DoTask() override
+	virtual void ExecuteRange(u_int uBegin, u_int uEnd)
+	{
+		m_pfnRangeFunc(m_pData, uBegin, uEnd);
+	}
+
+	virtual u_int GetDispatchCount() const override { return m_uNumRunners; }
+
+private:
+	// Sizes the runner count for this submit and rewinds the range. Safe only
+	// while the task is claimed for submission and not yet dispatched.
+	void ResetForSubmit(u_int uMaxRunners)
+	{
+		const u_int uMaxChunks = (m_uNumElements + m_uGrainSize - 1) / m_uGrainSize;
+		u_int uRunners = uMaxRunners < uMaxChunks ? uMaxRunners : uMaxChunks;
+		m_uNumRunners = uRunners > 0 ? uRunners : 1;
+		m_uNextElement.store(0, std::memory_order_relaxed);
+		m_uRunnersFinished.store(0, std::memory_order_relaxed);
+	}
+
+	bool TryClaimRange(u_int& uBeginOut, u_int& uEndOut)
 	{
-		u_int uInvocationIndex = m_uInvocationCounter.fetch_add(1);
+		u_int uCurrent = m_uNextElement.load(std::memory_order_relaxed);
+		while (uCurrent < m_uNumElements)
+		{
+			const u_int uRemaining = m_uNumElements - uCurrent;
+			u_int uChunk = uRemaining / (2 * m_uNumRunners);
+			if (uChunk < m_uGrainSize)
+			{
+				uChunk = m_uGrainSize;
+			}
+			if (uChunk > uRemaining)
+			{
+				uChunk = uRemaining;
+			}
+			if (m_uNextElement.compare_exchange_weak(uCurrent, uCurrent + uChunk, std::memory_order_relaxed))
+			{
+				uBeginOut = uCurrent;
+				uEndOut = uCurrent + uChunk;
+				return true;
+			}
+		}
+		return false;
+	}
 
+	void RunRange(u_int uBegin, u_int uEnd)
+	{
 #if ZENITH_PROFILING_ENABLED
 		Zenith_Profiling_Detail::BeginProfileZone(m_uProfileZoneID, nullptr);
-		m_pfnInvocationFunc(m_pData, uInvocationIndex, m_uNumInvocations);
+		ExecuteRange(uBegin, uEnd);
 		Zenith_Profiling_Detail::EndProfileZone(m_uProfileZoneID);
 #else
-		m_pfnInvocationFunc(m_pData, uInvocationIndex, m_uNumInvocations);
+		ExecuteRange(uBegin, uEnd);
 #endif
+	}
 
-		Zenith_Assert(uInvocationIndex < m_uNumInvocations, "We have done this task too many times");
-		u_int uCompletedCount = m_uCompletionCounter.fetch_add(1) + 1;
-		if (uCompletedCount == m_uNumInvocations)
+	// Every claimed chunk has run by the time its runner gets here, so the last
+	// runner out knows the whole range is done.
+	void FinishRunner()
+	{
+		const u_int uFinished = m_uRunnersFinished.fetch_add(1, std::memory_order_acq_rel) + 1;
+		Zenith_Assert(uFinished <= m_uNumRunners, "ParallelForTask ran more runners than were dispatched");
+		if (uFinished == m_uNumRunners)
 		{
-			m_uCompletedThreadID = Zenith_Multithreading_Detail::GetCurrentThreadID();
-			m_xSemaphore.Signal();
+			FinishTask();
 		}
 	}
 
-	const u_int GetNumInvocations() const
+	Zenith_ParallelForFunction m_pfnRangeFunc;
+	u_int m_uNumElements;
+	u_int m_uGrainSize;
+	bool m_bCallingThreadParticipates;
+	u_int m_uNumRunners;
+	std::atomic<u_int> m_uNextElement;
+	std::atomic<u_int> m_uRunnersFinished;
+
+	friend class Zenith_TaskSystem;
+};
+
+// ONE task executed uNumInvocations times, once per invocation index. A
+// parallel-for with a grain of one invocation: runners claim indices instead of
+// the pool queueing an entry per invocation.
+class Zenith_DataParallelTask : public Zenith_ParallelForTask
+{
+public:
+	Zenith_DataParallelTask() = delete;
+	Zenith_DataParallelTask(Zenith_ProfileZoneID uProfileZoneID, Zenith_DataParallelTaskFunction pfnFunc, void* pData, u_int uNumInvocations, bool bCallingThreadParticipates = false)
+		: Zenith_ParallelForTask(uProfileZoneID, pData, uNumInvocations, 1, bCallingThreadParticipates)
+		, m_pfnInvocationFunc(pfnFunc)
 	{
-		return m_uNumInvocations;
+		Zenith_Assert(pfnFunc != nullptr, "DataParallelTask function pointer cannot be null");
 	}
 
-	// If true, the thread that calls SubmitDataParallelTask() runs invocations
-	// itself instead of returning immediately — useful when it would otherwise
-	// idle waiting for completion.
-	const bool GetCallingThreadParticipates() const
+	const u_int GetNumInvocations() const
 	{
-		return m_bCallingThreadParticipates;
+		return GetNumElements();
 	}
 
-private:
-	void ResetCounters()
+protected:
+	virtual void ExecuteRange(u_int uBegin, u_int uEnd) override
 	{
-		m_uInvocationCounter.store(0, std::memory_order_release);
-		m_uCompletionCounter.store(0, std::memory_order_release);
+		const u_int uNumInvocations = GetNumElements();
+		for (u_int uInvocationIndex = uBegin; uInvocationIndex < uEnd; uInvocationIndex++)
+		{
+			m_pfnInvocationFunc(m_pData, uInvocationIndex, uNumInvocations);
+		}
 	}
 
+private:
 	Zenith_DataParallelTaskFunction m_pfnInvocationFunc;
-	u_int m_uNumInvocations;
-	bool m_bCallingThreadParticipates;
-	std::atomic<u_int> m_uInvocationCounter;
-	std::atomic<u_int> m_uCompletionCounter;
-
-	friend class Zenith_TaskSystem;
 };
 
-// Per-Engine task-system state. Owns the worker-thread pool + the
-// shared task queue. Accessed via g_xEngine.Tasks(); worker threads
-// also reach in through g_xEngine.Tasks() since Engine is the
-// canonical single owner.
+// Per-Engine task-system state. Owns the worker-thread pool, one work-stealing
+// deque per worker and the shared injection queue for submits from non-worker
+// threads. Accessed via g_xEngine.Tasks(); each worker thread records its
+// owning instance in a thread_local when it starts, so nothing on a worker
+// reaches back through the engine.
 class Zenith_TaskSystem
 {
 public:
@@ -182,13 +323,26 @@ public:
 	Zenith_TaskSystem(const Zenith_TaskSystem&) = delete;
 	Zenith_TaskSystem& operator=(const Zenith_TaskSystem&) = delete;
 
-	static constexpr u_int uMAX_TASKS = 128;
+	// Per-worker deque capacity. A worker that outruns it spills the remainder
+	// into the (unbounded) injection queue, so submission never fails.
+	static constexpr u_int uWORKER_DEQUE_CAPACITY = 1024;
 
 	void Initialise();
 	void Shutdown();
 
 	void SubmitTask(Zenith_Task* pxTask);
-	void SubmitDataParallelTask(Zenith_DataParallelTask* pxTask);
+	void SubmitParallelFor(Zenith_ParallelForTask* pxTask);
+	void SubmitDataParallelTask(Zenith_DataParallelTask* pxTask) { SubmitParallelFor(pxTask); }
+
+	// Blocking parallel-for over [0, uNumElements): the calling thread runs
+	// chunks alongside the workers and returns once every element is done.
+	void ParallelFor(Zenith_ProfileZoneID uProfileZoneID, Zenith_ParallelForFunction pfnFunc, void* pData, u_int uNumElements, u_int uGrainSize = 1);
+
+	// Runs at most one ready task on the calling thread: the caller's own deque
+	// first (if it is a worker), then the injection queue, then a steal. Returns
+	// false if no work was found. Used by WaitUntilComplete to help instead of
+	// sleeping; safe to call from any registered thread.
+	bool TryRunPendingTask();
 
 	// Number of worker threads created at Initialise (min(hw_concurrency-1, 16)).
 	// Used by data-parallel callers to size a Zenith_DataParallelTask's
@@ -196,25 +350,56 @@ public:
 	// callers must clamp to at least 1.
 	u_int GetNumWorkerThreads() const { return m_uNumWorkerThreads; }
 
+	// Successful steals since Initialise. Diagnostic only (scheduler benchmark).
+	u_int64 GetStealCount() const { return m_ulStealCount.load(std::memory_order_relaxed); }
+
 	// Called by the static worker thread function. Public so the
 	// free-function ThreadFunc in the .cpp can reach in.
-	void RunWorkerLoop();
+	void RunWorkerLoop(u_int uWorkerIndex);
 
 private:
+	friend class Zenith_Task;
+
+	struct WorkerState
+	{
+		Zenith_WorkStealingDeque<Zenith_Task*, uWORKER_DEQUE_CAPACITY> m_xDeque;
+		u_int m_uStealSeed = 0;
+	};
+
 	// CAS-claims the task for submission; false if already submitted.
 	bool TryClaimTask(Zenith_Task* pxTask, const char* szCallerName);
 
-	// Enqueue a task pointer uCount times under the queue lock, then signal
-	// workers. Returns how many were actually enqueued (the queue may fill).
-	u_int EnqueueAndSignal(Zenith_Task* pxTask, u_int uCount);
+	// Hands a ready task (no pending dependencies) to the workers: uCount
+	// queue entries, each of which runs DoTask once.
+	void Dispatch(Zenith_Task* pxTask, u_int uCount);
+
+	// Called by a finishing predecessor for each of its successors.
+	void OnDependencySatisfied(Zenith_Task* pxTask);
+
+	void PushTasks(Zenith_Task* pxTask, u_int uCount);
+	bool PopInjected(Zenith_Task*& pxTaskOut);
+	bool TrySteal(u_int uThiefIndex, Zenith_Task*& pxTaskOut);
+	Zenith_Task* FindTask(u_int uWorkerIndex);
+	void WakeWorkers(u_int uCount);
+
+	WorkerState*      m_pxWorkers             = nullptr;
+
+	// Injection queue: FIFO for tasks submitted from non-worker threads (and
+	// worker-deque overflow). m_uInjectedCount lets idle workers skip the lock
+	// when it is empty.
+	Zenith_Vector<Zenith_Task*> m_xInjectedTasks;
+	u_int             m_uInjectedHead         = 0;
+	std::atomic<u_int> m_uInjectedCount       {0};
+	Zenith_Mutex_NoProfiling m_xInjectionMutex;
 
-	void RecoverFromShortEnqueue(Zenith_Task* pxTask);
-	void RunInvocationsOnCallingThread(Zenith_DataParallelTask* pxTask, u_int uCount);
+	// Workers that have advertised they are about to sleep. A submitter claims
+	// (decrements) one per semaphore Signal, so the semaphore count never exceeds
+	// the worker count. See RunWorkerLoop for the sleep protocol.
+	std::atomic<u_int> m_uSleepingWorkers     {0};
+	std::atomic<u_int64> m_ulStealCount       {0};
 
-	Zenith_CircularQueue<Zenith_Task*, uMAX_TASKS> m_xTaskQueue;
 	Zenith_Semaphore* m_pxWorkAvailableSem    = nullptr;
 	Zenith_Semaphore* m_pxThreadsTerminatedSem = nullptr;
-	Zenith_Mutex      m_xQueueMutex;
 	std::atomic<bool> m_bTerminateThreads     {false};
 	std::atomic<bool> m_bInitialized          {false};
 	u_int             m_uNumWorkerThreads     = 0;
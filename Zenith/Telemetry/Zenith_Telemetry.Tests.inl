@@ -1,5 +1,6 @@
 #include "UnitTests/Zenith_UnitTests.h"
 #include "Telemetry/Zenith_Telemetry.h"
+#include "Profiling/Zenith_PerfCounters.h"
 
 // ============================================================================
 // Telemetry Recorder Tests
@@ -61,3 +62,46 @@ ZENITH_TEST(Telemetry, RecorderFlushSnapshotIsKillSafe)
 	// After End, FlushSnapshot is a no-op again.
 	ZENITH_ASSERT_FALSE(xRec.FlushSnapshot(szBin), "FlushSnapshot must fail after End");
 }
+
+// v4: every recorded frame carries the perf counters' last merged values, and the
+// header names them in registry order. Counters registered after recording began
+// still get a column; earlier frames simply have fewer values.
+ZENITH_TEST(Telemetry, RecorderStoresPerfCounterColumns)
+{
+	using namespace Zenith_Telemetry;
+
+	const Zenith_PerfCounterID uEarly = Zenith_PerfCounters::Register("Test.Telemetry.EarlyCounter", Zenith_PerfCounterKind::Counter);
+	Zenith_PerfCounters::EndFrame();
+	Zenith_PerfCounters::Add(uEarly, 7);
+	Zenith_PerfCounters::EndFrame();
+
+	Recorder xRec;
+	const char* szBin = "ztlm_perfcounters_test.ztlm";
+	xRec.Begin(Header{});
+	xRec.RecordFrame(FrameSample{});
+
+	const Zenith_PerfCounterID uLate = Zenith_PerfCounters::Register("Test.Telemetry.LateGauge", Zenith_PerfCounterKind::Gauge);
+	Zenith_PerfCounters::Set(uLate, 3.5);
+	Zenith_PerfCounters::EndFrame();
+	xRec.NextFrame();
+	xRec.RecordFrame(FrameSample{});
+	ZENITH_ASSERT_TRUE(xRec.End(szBin));
+
+	Reader xReader;
+	ZENITH_ASSERT_TRUE(xReader.LoadFromFile(szBin), "v4 file must load");
+	const Header& xHeader = xReader.GetHeader();
+	ZENITH_ASSERT_EQ(xHeader.uVersion, 4u);
+	ZENITH_ASSERT_EQ(xHeader.astrCounterNames.GetSize(), Zenith_PerfCounters::GetCount());
+	ZENITH_ASSERT_TRUE(xHeader.astrCounterNames.Get(uEarly) == "Test.Telemetry.EarlyCounter");
+	ZENITH_ASSERT_TRUE(xHeader.astrCounterNames.Get(uLate) == "Test.Telemetry.LateGauge");
+
+	ZENITH_ASSERT_EQ(xReader.GetFrames().GetSize(), 2u);
+	const FrameSample& xFirst = xReader.GetFrames().Get(0);
+	const FrameSample& xSecond = xReader.GetFrames().Get(1);
+	ZENITH_ASSERT_EQ_FLOAT(xFirst.afCounters.Get(uEarly), 7.0f, 1e-6f, "the first frame sees the merge before it");
+	ZENITH_ASSERT_TRUE(xFirst.afCounters.GetSize() <= uLate, "the late gauge did not exist yet");
+	ZENITH_ASSERT_EQ_FLOAT(xSecond.afCounters.Get(uEarly), 0.0f, 1e-6f, "a counter column is a per-frame delta");
+	ZENITH_ASSERT_EQ_FLOAT(xSecond.afCounters.Get(uLate), 3.5f, 1e-6f);
+
+	ZENITH_ASSERT_TRUE(xReader.ExportCountersCsv("ztlm_perfcounters_test.csv"));
+}
@@ -1,5 +1,6 @@
 #include "Zenith.h"
 #include "Telemetry/Zenith_Telemetry.h"
+#include "Profiling/Zenith_PerfCounters.h"
 
 #include <cstdio>
 #include <cstring>
@@ -117,6 +118,13 @@ namespace Zenith_Telemetry
 		// v3 trailing block. Older Readers pass uVersion < 3 and skip.
 		xCamera.WriteToDataStream(xS);
 		xS << fFrameWallMs;
+		// v4 trailing block.
+		const uint32_t uNC = afCounters.GetSize();
+		xS << uNC;
+		for (uint32_t i = 0; i < uNC; ++i)
+		{
+			xS << afCounters.Get(i);
+		}
 	}
 	void FrameSample::ReadFromDataStream(Zenith_DataStream& xS, uint32_t uVersion)
 	{
@@ -143,6 +151,20 @@ namespace Zenith_Telemetry
 			xCamera      = CameraState{};
 			fFrameWallMs = 0.0f;
 		}
+		afCounters.Clear();
+		if (uVersion >= 4u)
+		{
+			uint32_t uNC = 0;
+			xS >> uNC;
+			// Same cap as the header's name list.
+			if (uNC > 4096u) uNC = 0;
+			for (uint32_t i = 0; i < uNC; ++i)
+			{
+				float fValue = 0.0f;
+				xS >> fValue;
+				afCounters.PushBack(fValue);
+			}
+		}
 	}
 
 	// =========================================================
@@ -237,6 +259,13 @@ namespace Zenith_Telemetry
 		WriteString(xS, strBuildConfig);
 		WriteString(xS, strBuildHash);
 		WriteString(xS, strPersonalityName);
+		// v4+ perf-counter names.
+		const uint32_t uNumCounters = astrCounterNames.GetSize();
+		xS << uNumCounters;
+		for (uint32_t i = 0; i < uNumCounters; ++i)
+		{
+			WriteString(xS, astrCounterNames.Get(i));
+		}
 	}
 	void Header::ReadFromDataStream(Zenith_DataStream& xS)
 	{
@@ -277,6 +306,21 @@ namespace Zenith_Telemetry
 			ReadString(xS, strBuildHash);
 			ReadString(xS, strPersonalityName);
 		}
+		// v4+ perf-counter names.
+		astrCounterNames.Clear();
+		if (uVersion >= 4u)
+		{
+			uint32_t uNumCounters = 0;
+			xS >> uNumCounters;
+			// Zenith_PerfCounters holds far fewer; anything huge is corrupt.
+			if (uNumCounters > 4096u) uNumCounters = 0;
+			for (uint32_t i = 0; i < uNumCounters; ++i)
+			{
+				std::string strName;
+				ReadString(xS, strName);
+				astrCounterNames.PushBack(strName);
+			}
+		}
 	}
 
 	// =========================================================
@@ -305,6 +349,23 @@ namespace Zenith_Telemetry
 		// xSample and rely on the recorder to assign uFrameIdx.
 		FrameSample xCopy = xSample;
 		xCopy.uFrameIdx = m_uFrameIdx;
+
+		// Perf counters only ever append, so the header's name list grows with
+		// the registry and earlier samples stay valid as a prefix. The header is
+		// written at End / FlushSnapshot, so late registrations still get a name.
+		const u_int uCounters = Zenith_PerfCounters::GetCount();
+		for (u_int u = m_xHeader.astrCounterNames.GetSize(); u < uCounters; ++u)
+		{
+			m_xHeader.astrCounterNames.PushBack(Zenith_PerfCounters::GetStats(u).m_szName);
+		}
+		if (xCopy.afCounters.GetSize() == 0)
+		{
+			xCopy.afCounters.Reserve(uCounters);
+			for (u_int u = 0; u < uCounters; ++u)
+			{
+				xCopy.afCounters.PushBack(static_cast<float>(Zenith_PerfCounters::GetStats(u).m_fLastFrame));
+			}
+		}
 		m_axFrames.PushBack(xCopy);
 	}
 
@@ -429,12 +490,12 @@ namespace Zenith_Telemetry
 				"Zenith_Telemetry::Reader: bad magic 0x%08X in %s", m_xHeader.uMagic, szBinaryPath);
 			return false;
 		}
-		// Accept v1 (legacy, no obstacles), v2 (obstacles), and v3 (current --
-		// extended EntitySnapshot / CameraState / EventPayload.szSource +
-		// build metadata in Header). Anything else is a forward-incompat
-		// file produced by a newer writer than this reader knows how to
-		// parse.
-		if (m_xHeader.uVersion != 1u && m_xHeader.uVersion != 2u && m_xHeader.uVersion != 3u)
+		// Accept v1 (legacy, no obstacles), v2 (obstacles), v3 (extended
+		// EntitySnapshot / CameraState / EventPayload.szSource + build
+		// metadata in Header) and v4 (current -- perf-counter columns).
+		// Anything else is a forward-incompat file produced by a newer
+		// writer than this reader knows how to parse.
+		if (m_xHeader.uVersion < 1u || m_xHeader.uVersion > 4u)
 		{
 			Zenith_Error(LOG_CATEGORY_CORE,
 				"Zenith_Telemetry::Reader: unknown version %u in %s", m_xHeader.uVersion, szBinaryPath);
@@ -507,6 +568,15 @@ namespace Zenith_Telemetry
 		xOut << "    \"buildConfig\": \""     << m_xHeader.strBuildConfig     << "\",\n";
 		xOut << "    \"buildHash\": \""       << m_xHeader.strBuildHash       << "\",\n";
 		xOut << "    \"personalityName\": \"" << m_xHeader.strPersonalityName << "\",\n";
+		// v4 perf-counter names; each frame's "counters" array is in this order.
+		xOut << "    \"counters\": [";
+		const uint32_t uNumCounters = m_xHeader.astrCounterNames.GetSize();
+		for (uint32_t i = 0; i < uNumCounters; ++i)
+		{
+			xOut << "\"" << m_xHeader.astrCounterNames.Get(i) << "\"";
+			if (i + 1 < uNumCounters) xOut << ",";
+		}
+		xOut << "],\n";
 		// Static-scene obstacles. Always emitted (empty array if none) so
 		// downstream readers (visualiser, etc.) don't need a fallback path
 		// when the writer was older or didn't populate them.
@@ -569,6 +639,14 @@ namespace Zenith_Telemetry
 			     << ",\"valid\":"    << static_cast<int>(xS.xCamera.bValid)
 			     << "}";
 			xOut << ",\"frameMs\":" << xS.fFrameWallMs;
+			xOut << ",\"counters\":[";
+			const uint32_t uNC = xS.afCounters.GetSize();
+			for (uint32_t j = 0; j < uNC; ++j)
+			{
+				xOut << xS.afCounters.Get(j);
+				if (j + 1 < uNC) xOut << ",";
+			}
+			xOut << "]";
 			xOut << "}";
 			if (i + 1 < uNF) xOut << ",";
 			xOut << "\n";
@@ -745,6 +823,41 @@ namespace Zenith_Telemetry
 		return true;
 	}
 
+	bool Reader::ExportCountersCsv(const char* szCountersCsvPath) const
+	{
+		std::ofstream xOut(szCountersCsvPath);
+		if (!xOut.is_open()) return false;
+
+		xOut << "frame,t";
+		const uint32_t uNumCounters = m_xHeader.astrCounterNames.GetSize();
+		for (uint32_t i = 0; i < uNumCounters; ++i)
+		{
+			xOut << ",";
+			WriteCsvString(xOut, m_xHeader.astrCounterNames.Get(i).c_str(), m_xHeader.astrCounterNames.Get(i).size());
+		}
+		xOut << "\n";
+
+		const uint32_t uNF = m_axFrames.GetSize();
+		for (uint32_t i = 0; i < uNF; ++i)
+		{
+			const FrameSample& xS = m_axFrames.Get(i);
+			char buf[64];
+			std::snprintf(buf, sizeof(buf), "%u,%.4f", xS.uFrameIdx, xS.fTimeS);
+			xOut << buf;
+			for (uint32_t j = 0; j < uNumCounters; ++j)
+			{
+				xOut << ",";
+				if (j < xS.afCounters.GetSize())
+				{
+					std::snprintf(buf, sizeof(buf), "%.9g", xS.afCounters.Get(j));
+					xOut << buf;
+				}
+			}
+			xOut << "\n";
+		}
+		return true;
+	}
+
 	// =========================================================
 	// Singleton
 	// =========================================================
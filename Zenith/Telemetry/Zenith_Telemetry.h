@@ -99,6 +99,10 @@ namespace Zenith_Telemetry
 		// v3 additions:
 		CameraState                    xCamera;
 		float                          fFrameWallMs  = 0.0f;  // wall-clock ms (0 if not measured)
+		// v4 addition: one value per Header::astrCounterNames entry, from the
+		// last Zenith_PerfCounters merge. Left empty, RecordFrame fills it in.
+		// May be shorter than the name list when counters registered later.
+		Zenith_Vector<float>           afCounters;
 
 		void WriteToDataStream(Zenith_DataStream& xStream) const;
 		void ReadFromDataStream(Zenith_DataStream& xStream, uint32_t uVersion);
@@ -171,7 +175,9 @@ namespace Zenith_Telemetry
 		// and added build-info / personality strings to the Header.
 		// Reader accepts v1 / v2 / v3; older recordings load with
 		// new fields defaulted.
-		uint32_t    uVersion      = 3;
+		// Version 4: Zenith_PerfCounters names in the Header and their
+		// per-frame values in each FrameSample. Reader accepts v1 - v4.
+		uint32_t    uVersion      = 4;
 		uint64_t    uSeed         = 0;
 		uint64_t    uStartUTCMs   = 0;
 		std::string strSceneName;
@@ -187,6 +193,9 @@ namespace Zenith_Telemetry
 		std::string strBuildConfig;     // e.g. "vs2022_Debug_Win64_True"
 		std::string strBuildHash;       // short git hash if available
 		std::string strPersonalityName; // bot personality the run was driven by
+		// v4 perf-counter column names, in Zenith_PerfCounters id order.
+		// Filled by the Recorder as counters register; callers leave it empty.
+		Zenith_Vector<std::string> astrCounterNames;
 
 		void WriteToDataStream(Zenith_DataStream& xStream) const;
 		void ReadFromDataStream(Zenith_DataStream& xStream);
@@ -220,7 +229,8 @@ namespace Zenith_Telemetry
 		uint32_t GetFrameIdx() const { return m_uFrameIdx; }
 
 		// Record a position sample. Caller fills in xSample.uFrameIdx as
-		// GetFrameIdx() (or the recorder overrides it).
+		// GetFrameIdx() (or the recorder overrides it). An empty
+		// xSample.afCounters is filled with the perf counters' last-frame values.
 		void RecordFrame(const FrameSample& xSample);
 
 		// Record an event immediately. xEvt.uFrameIdx is overridden to
@@ -300,6 +310,11 @@ namespace Zenith_Telemetry
 		               const char* szEventsCsvPath,
 		               const char* (*pfnEventTypeToString)(uint16_t) = nullptr) const;
 
+		// Write the v4 perf-counter columns as CSV: one row per sampled frame
+		// (frame, t, then one column per Header::astrCounterNames entry).
+		// Frames recorded before a counter registered leave its cell empty.
+		bool ExportCountersCsv(const char* szCountersCsvPath) const;
+
 	private:
 		Header                        m_xHeader;
 		Zenith_Vector<FrameSample>    m_axFrames;
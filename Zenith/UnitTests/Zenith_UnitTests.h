@@ -44,6 +44,10 @@ public:
 	static void TestVectorZeroCapacityResize();
 	static void TestMemoryPool();
 	static void TestMemoryPoolExhaustion();
+	static void TestConcurrentMemoryPool();
+	static void TestConcurrentMemoryPoolExhaustion();
+	static void TestConcurrentMemoryPoolThreads();
+	static void TestConcurrentMemoryPoolThreadExit();
 
 	// CircularQueue tests
 	static void TestCircularQueueBasic();
@@ -55,6 +59,11 @@ public:
 	static void TestVectorSelfAssignment();
 	static void TestVectorRemoveSwap();
 
+	// InlineVector tests
+	static void TestInlineVectorInlineAndSpill();
+	static void TestInlineVectorCopyAndMove();
+	static void TestInlineVectorDataStreamMatchesVector();
+
 	// HashMap / HashSet tests
 	static void TestHashMapBasic();
 	static void TestHashMapCollisions();
@@ -67,10 +76,14 @@ public:
 	static void TestHashMapCopyMove();
 	static void TestHashMapSerialization();
 	static void TestHashMapOperatorBracket();
+	static void TestHashMapCollisionsSpanGroups();
+	static void TestHashMapStringChurn();
 	static void TestHashSetBasic();
 
 	// DataStream edge case tests
 	static void TestDataStreamBoundsCheck();
+	static void TestFileAccessMapFile();
+	static void TestDataStreamMapFromFile();
 
 	// Stream envelope (reusable DataStream header) tests
 	static void TestStreamEnvelopeRoundTrip();
@@ -183,8 +196,19 @@ public:
 	static void TestComponentRemovalIndexUpdate();
 	static void TestComponentSwapAndPop();
 	static void TestSwapAndPopMovesIndex();
+	static void TestRecycledSlotHasNoStaleComponents();
 	static void TestQueryNestedReentrancy();
 	static void TestBenchECSSmoke();
+	static void TestBenchECSParallelSmoke();
+	static void TestBenchECSGroupedSmoke();
+	static void TestBenchECSChangedSmoke();
+	static void TestBenchPhysicsSmoke();
+	static void TestBenchMemoryPoolSmoke();
+	static void TestBenchHashMapSmoke();
+	static void TestBenchEngineSmoke();
+#ifdef ZENITH_WINDOWS
+	static void TestLogSinkFlushesEveryThreadsLines();
+#endif
 	static void TestMultipleComponentRemoval();
 	static void TestComponentRemovalWithManyEntities();
 	static void TestEntityNameFromScene();
@@ -222,6 +246,27 @@ public:
 	static void TestQueryCount();
 	static void TestQueryFirstAndAny();
 
+	// Parallel query iteration: ForEachParallel / ForEachConst coverage, deferred
+	// structural changes, and the access-claim tracker's reader/writer rules, on
+	// their own and between queries in flight on two threads.
+	static void TestQueryForEachParallelVisitsEachOnce();
+	static void TestQueryForEachConstMatchesForEach();
+	static void TestQueryForEachParallelDeferredOps();
+	static void TestQueryAccessTrackerConflicts();
+	static void TestQueryParallelConflictAcrossThreads();
+
+	// Cached query groups: incremental maintenance across mid-ForEach removals
+	// and additions, and signature sharing between reordered queries.
+	static void TestQueryGroupTracksMutationDuringForEach();
+
+	// Change detection: add / MarkChanged / Transform stamps, the Changed<T>
+	// filter on every read path, and ticks following pool swap-and-pop.
+	static void TestQueryChangedFilter();
+
+	// Zenith_ECSCommandBuffer: record-order playback, pending-entity targets,
+	// skipped stale targets and per-thread buffers recorded from workers.
+	static void TestCommandBufferPlayback();
+
 	// WS10 sparse-set keystone: fuzz cross-check that the sparse-set query read
 	// path returns the EXACT same matched-entity set as the legacy scan path
 	// (and matches an independent ground-truth oracle), across ~5000 random
@@ -342,7 +387,7 @@ public:
 
 	// Wave 8.3 - release-survivable check tier + task-queue overflow grace
 	static void TestCheckTierReleaseSurvivable();
-	static void TestQueueFullSurfacesError();
+	static void TestSubmitOverflowRunsEveryTask();
 
 	// RenderGraph diagnostic accessor
 	static void TestRenderGraphPassOrderDescription();
@@ -360,6 +405,8 @@ public:
 	static void TestNavMeshIsPointOnMesh();
 	static void TestNavMeshRaycast();
 	static void TestNavMeshFindNearestPolygonInCell();
+	static void TestNavMeshFlatGridMatchesBruteForce();
+	static void TestNavMeshSearchLayoutTracksMutations();
 	static void TestNavMeshComputePolygonBounds();
 	static void TestNavMeshGetRandomReachablePointInRadius();
 	static void TestNavMeshRandomPointSamplingIsDeterministic();
@@ -831,6 +878,8 @@ public:
 	static void TestCommandLineParseEveryValueFlag();
 	static void TestCommandLineParsePrefixedFlags();
 	static void TestCommandLineParseArgvEdgeCases();
+	static void TestCommandLineParseBenchFlags();
+	static void TestCommandLineParseHeapSample();
 
 	// --indirect-count-mode=auto|native|padded|single (Phase 1 of the terrain
 	// indirect-count compatibility plan). Four spellings + the bare form +
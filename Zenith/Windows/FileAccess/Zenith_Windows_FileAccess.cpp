@@ -1,6 +1,8 @@
 #include "Zenith.h"
 #include "FileAccess/Zenith_FileAccess.h"
 
+#include "Core/Zenith_Win32.h"
+
 #include <filesystem>
 #include <fstream>
 
@@ -77,6 +79,62 @@ namespace Zenith_FileAccess
 		Zenith_MemoryManagement::Deallocate(pData);
 	}
 
+	bool MapFile(const char* szFilename, MappedFile& xOut)
+	{
+		xOut = MappedFile();
+
+		// FILE_SHARE_READ only: other readers may map the same asset, but a
+		// writer cannot truncate it under the view.
+		HANDLE hFile = CreateFileA(szFilename, GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (hFile == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER xSize = {};
+		if (!GetFileSizeEx(hFile, &xSize))
+		{
+			CloseHandle(hFile);
+			return false;
+		}
+		if (xSize.QuadPart == 0)
+		{
+			// CreateFileMapping rejects a zero-length file; an empty view needs no mapping.
+			CloseHandle(hFile);
+			return true;
+		}
+
+		HANDLE hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(hFile);
+		if (hMapping == nullptr)
+		{
+			return false;
+		}
+
+		// The view holds its own reference to the section, so the mapping
+		// handle can go now and UnmapFile only needs the base address.
+		const void* pView = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(hMapping);
+		if (pView == nullptr)
+		{
+			return false;
+		}
+
+		xOut.m_pcData = static_cast<const char*>(pView);
+		xOut.m_ulSize = static_cast<uint64_t>(xSize.QuadPart);
+		return true;
+	}
+
+	void UnmapFile(MappedFile& xFile)
+	{
+		if (xFile.m_pcData != nullptr)
+		{
+			UnmapViewOfFile(xFile.m_pcData);
+		}
+		xFile = MappedFile();
+	}
+
 	void WriteFile(const char* szFilename, const void* const pData, const uint64_t ulSize)
 	{
 		char acFixedFilename[ZENITH_MAX_PATH_LENGTH]{ 0 };
@@ -115,13 +115,14 @@ struct ThreadParams
 
 unsigned long ThreadInit(void* pParams)
 {
-	g_xEngine.Threading().RegisterThread();
-
 	// Take ownership of heap-allocated params - we are responsible for deleting
 	ThreadParams* pxParams = static_cast<ThreadParams*>(pParams);
 
-	// Copy data to local/thread-local storage
+	// Name first: RegisterThread hands it to the profiler.
 	memcpy(tl_g_acThreadName, pxParams->m_acName, Zenith_Multithreading::uMAX_THREAD_NAME_LENGTH);
+	g_xEngine.Threading().RegisterThread();
+
+	// Copy data to local storage
 	Zenith_ThreadFunction pfnFunc = pxParams->m_pfnFunc;
 	const void* pUserData = pxParams->m_pUserData;
 
@@ -165,3 +166,8 @@ bool Zenith_Multithreading::Platform_IsMainThread()
 {
 	return tl_g_uThreadID == g_xEngine.Threading().GetMainThreadID();
 }
+
+const char* Zenith_Multithreading::Platform_GetCurrentThreadName()
+{
+	return tl_g_acThreadName;
+}
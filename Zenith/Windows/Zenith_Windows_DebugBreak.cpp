@@ -12,5 +12,10 @@ void Zenith_DebugBreak()
 		g_uAssertCaptureHitCount.fetch_add(1, std::memory_order_acq_rel);
 		return;
 	}
+#ifdef ZENITH_LOG
+	// Whatever is still queued reaches the file before the debugger (or, with no
+	// debugger attached, the crash) gets the process.
+	Zenith_LogFlushForCrash();
+#endif
 	__debugbreak();
 }
@@ -12,12 +12,75 @@
 #include "Collections/Zenith_Vector.h"
 #include "ZenithECS/Zenith_Entity.h"
 #include "Core/Memory/Zenith_MemoryManagement.h"
+// Zenith_ECS_ChangeTick(), the stamp written into m_xChangeTicks.
+#include "ZenithECS/Internal/Zenith_RenderTaskState.h"
 
-// Component pool base class
+// Component pool base class. Holds the type-independent half of the pool: the
+// dense owner array and the sparse-set index over it, so SceneData can answer
+// "does entity E own anything in this pool?" without knowing T.
 class Zenith_ComponentPoolBase
 {
 public:
 	virtual ~Zenith_ComponentPoolBase() = default;
+
+	// One owner EntityID per live dense slot; size always tracks the pool's m_uSize.
+	Zenith_Vector<Zenith_EntityID> m_xOwningEntities;
+
+	// Sparse-set index: the AUTHORITATIVE component index. Maps an entity SLOT
+	// index (Zenith_EntityID::m_uIndex) -> the DENSE pool index that holds that
+	// entity's component, or uINVALID_DENSE when the entity has no component of
+	// this type. There is no other per-entity component map: EntityHasComponent /
+	// GetComponentFromEntity / RemoveComponentFromEntity / TransferComponent all
+	// resolve through FindDense below, an O(1) array read with no per-entity
+	// allocation. Maintained by the pool mutators (EmplaceBack / MoveEmplaceBack /
+	// MoveConstructAt / RemoveAtSwapAndPop), never by callers.
+	Zenith_Vector<u_int> m_xSparse;
+	static constexpr u_int uINVALID_DENSE = 0xFFFFFFFFu;
+
+	// Point entity slot uSlot at dense index uDense. Zenith_Vector has no
+	// fill-resize (the doubling Resize is private; Reserve grows capacity but
+	// not size), so grow the logical size with a PushBack(uINVALID_DENSE) loop
+	// until uSlot is addressable, then write the entry. Newly grown slots in
+	// between default to uINVALID_DENSE (no component), which is exactly the
+	// "absent" sentinel GetSparseDense returns.
+	void SetSparse(u_int uSlot, u_int uDense)
+	{
+		while (m_xSparse.GetSize() <= uSlot)
+		{
+			m_xSparse.PushBack(uINVALID_DENSE);
+		}
+		m_xSparse.Get(uSlot) = uDense;
+	}
+
+	// Dense index for entity slot uSlot, or uINVALID_DENSE if the slot has never
+	// been pointed at this pool (sparse array shorter than uSlot) or was cleared.
+	// NON-asserting: an out-of-range slot is simply "absent".
+	u_int GetSparseDense(u_int uSlot) const
+	{
+		return (uSlot < m_xSparse.GetSize()) ? m_xSparse.Get(uSlot) : uINVALID_DENSE;
+	}
+
+	// Dense index of xID's component, or uINVALID_DENSE. Round-trips the full
+	// EntityID (index AND generation) through the owner array, so a stale sparse
+	// entry left behind by a recycled slot reads as absent.
+	u_int FindDense(Zenith_EntityID xID) const
+	{
+		const u_int uDense = GetSparseDense(xID.m_uIndex);
+		if (uDense == uINVALID_DENSE) return uINVALID_DENSE;
+		return (m_xOwningEntities.Get(uDense) == xID) ? uDense : uINVALID_DENSE;
+	}
+
+	// Change detection: one tick per live dense slot (parallel to
+	// m_xOwningEntities), holding the scene system's change tick
+	// (Zenith_ECS_ChangeTick) at the slot's last recorded write. Stamped when
+	// the component is added or moved in from another scene, and on every
+	// Zenith_Entity::MarkChanged<T>(); follows its component through
+	// swap-and-pop. Ticks start
+	// at 1, so every stamp is newer than 0 and Changed<T>(0) matches all.
+	Zenith_Vector<u_int> m_xChangeTicks;
+
+	u_int GetChangeTick(u_int uDense) const { return m_xChangeTicks.Get(uDense); }
+	void MarkChanged(u_int uDense, u_int uTick) { m_xChangeTicks.Get(uDense) = uTick; }
 };
 
 // Templated component pool with explicit lifetime management
@@ -26,9 +89,10 @@ public:
 // The pool is DENSE: live components occupy slots [0, m_uSize) with no holes.
 // Removal is a real swap-and-pop (see RemoveAtSwapAndPop) — the last live
 // element is move-constructed into the vacated slot, so the pool stays
-// contiguous. This contiguity is the precondition for the future sparse-set
-// index. m_xOwningEntities is a parallel array whose size always tracks
-// m_uSize (one owner EntityID per live slot).
+// contiguous, which is what lets the sparse-set index in the base class map
+// entity slots straight to dense indices. m_xOwningEntities and m_xChangeTicks
+// (base) are parallel arrays whose sizes always track m_uSize (one owner
+// EntityID and one change tick per live slot).
 template<typename T>
 class Zenith_ComponentPool : public Zenith_ComponentPoolBase
 {
@@ -36,20 +100,6 @@ public:
 	T* m_pxData = nullptr;
 	u_int m_uSize = 0;      // Number of live, contiguous slots
 	u_int m_uCapacity = 0;  // Allocated capacity
-	Zenith_Vector<Zenith_EntityID> m_xOwningEntities;
-
-	// Sparse-set index (WS10 keystone). Maps an entity SLOT index
-	// (Zenith_EntityID::m_uIndex) -> the DENSE pool index that holds that
-	// entity's component, or uINVALID_DENSE when the entity has no component of
-	// this type. This is the O(1) "does entity E have component T, and where?"
-	// lookup the sparse-set query fast path walks instead of the per-entity
-	// component map. It is maintained ADDITIVELY by the pool mutators below
-	// (EmplaceBack / MoveEmplaceBack / MoveConstructAt / RemoveAtSwapAndPop) so
-	// every existing call site dual-writes it automatically — no SceneData /
-	// Entity call-site edits are needed. The legacy m_axEntityComponents map
-	// stays authoritative for the public accessors; this is a parallel index.
-	Zenith_Vector<u_int> m_xSparse;
-	static constexpr u_int uINVALID_DENSE = 0xFFFFFFFFu;
 
 	static constexpr u_int uINITIAL_CAPACITY = 16;
 
@@ -88,33 +138,6 @@ public:
 
 	u_int GetSize() const { return m_uSize; }
 
-	//--------------------------------------------------------------------------
-	// Sparse-set index maintenance (WS10)
-	//--------------------------------------------------------------------------
-
-	// Point entity slot uSlot at dense index uDense. Zenith_Vector has no
-	// fill-resize (the doubling Resize is private; Reserve grows capacity but
-	// not size), so grow the logical size with a PushBack(uINVALID_DENSE) loop
-	// until uSlot is addressable, then write the entry. Newly grown slots in
-	// between default to uINVALID_DENSE (no component), which is exactly the
-	// "absent" sentinel GetSparseDense returns.
-	void SetSparse(u_int uSlot, u_int uDense)
-	{
-		while (m_xSparse.GetSize() <= uSlot)
-		{
-			m_xSparse.PushBack(uINVALID_DENSE);
-		}
-		m_xSparse.Get(uSlot) = uDense;
-	}
-
-	// Dense index for entity slot uSlot, or uINVALID_DENSE if the slot has never
-	// been pointed at this pool (sparse array shorter than uSlot) or was cleared.
-	// NON-asserting: an out-of-range slot is simply "absent".
-	u_int GetSparseDense(u_int uSlot) const
-	{
-		return (uSlot < m_xSparse.GetSize()) ? m_xSparse.Get(uSlot) : uINVALID_DENSE;
-	}
-
 	// Allocate a new slot at the end and construct component in-place
 	template<typename... Args>
 	u_int EmplaceBack(Zenith_EntityID xOwner, Args&&... args)
@@ -126,7 +149,8 @@ public:
 		u_int uIndex = m_uSize++;
 		new (&m_pxData[uIndex]) T(std::forward<Args>(args)...);
 		m_xOwningEntities.PushBack(xOwner);
-		// Sparse dual-write: entity slot -> this new dense index.
+		m_xChangeTicks.PushBack(Zenith_ECS_ChangeTick());
+		// Sparse index: entity slot -> this new dense index.
 		SetSparse(xOwner.m_uIndex, uIndex);
 		return uIndex;
 	}
@@ -139,9 +163,9 @@ public:
 	// slot is destructed, and uIndex's owner is repointed to the moved element's
 	// owner. m_uSize is decremented either way.
 	//
-	// Returns the EntityID that owned the MOVED element (so the caller can
-	// repoint that entity's stored component index to uIndex), or
-	// INVALID_ENTITY_ID when uIndex was the last/only slot (no move happened).
+	// Returns the EntityID that owned the MOVED element (its sparse entry has
+	// already been repointed to uIndex), or INVALID_ENTITY_ID when uIndex was the
+	// last/only slot (no move happened).
 	Zenith_EntityID RemoveAtSwapAndPop(u_int uIndex)
 	{
 		Zenith_Assert(uIndex < m_uSize, "RemoveAtSwapAndPop: Index %u out of range (size=%u)", uIndex, m_uSize);
@@ -155,7 +179,7 @@ public:
 		// Destruct the component being removed.
 		m_pxData[uIndex].~T();
 
-		// Sparse dual-write, step 1: the removed entity no longer has this
+		// Sparse index, step 1: the removed entity no longer has this
 		// component. Clear it FIRST so the clear-then-repoint order is correct
 		// even when uIndex == uLastIndex (removed == tail): the single tail entry
 		// is cleared and nothing repoints it back. When uIndex != uLastIndex and
@@ -174,8 +198,10 @@ public:
 			m_pxData[uLastIndex].~T();
 			m_xOwningEntities.Get(uIndex) = xMovedOwner;
 			m_xOwningEntities.PopBack();  // POD EntityID — drops the now-duplicated tail entry, keeps size == m_uSize
+			m_xChangeTicks.Get(uIndex) = m_xChangeTicks.Get(uLastIndex);
+			m_xChangeTicks.PopBack();
 			m_uSize--;
-			// Sparse dual-write, step 2: the tail element now lives at uIndex.
+			// Sparse index, step 2: the tail element now lives at uIndex.
 			// Repoint its owner's sparse entry. (Safe even if xMovedOwner ==
 			// xRemovedOwner is impossible here — they are different live slots.)
 			SetSparse(xMovedOwner.m_uIndex, uIndex);
@@ -185,6 +211,7 @@ public:
 		// uIndex was the last/only slot: nothing moved. Sparse was already
 		// cleared above; do ONLY the clear (no repoint).
 		m_xOwningEntities.PopBack();
+		m_xChangeTicks.PopBack();
 		m_uSize--;
 		return INVALID_ENTITY_ID;
 	}
@@ -196,7 +223,8 @@ public:
 		Zenith_Assert(uIndex < m_uSize, "MoveConstructAt: Index out of range");
 		new (&m_pxData[uIndex]) T(std::move(xSource));
 		m_xOwningEntities.Get(uIndex) = xOwner;
-		// Sparse dual-write: entity slot -> this (existing) dense index.
+		m_xChangeTicks.Get(uIndex) = Zenith_ECS_ChangeTick();
+		// Sparse index: entity slot -> this (existing) dense index.
 		SetSparse(xOwner.m_uIndex, uIndex);
 	}
 
@@ -210,7 +238,8 @@ public:
 		u_int uIndex = m_uSize++;
 		new (&m_pxData[uIndex]) T(std::move(xSource));
 		m_xOwningEntities.PushBack(xOwner);
-		// Sparse dual-write: entity slot -> this new dense index.
+		m_xChangeTicks.PushBack(Zenith_ECS_ChangeTick());
+		// Sparse index: entity slot -> this new dense index.
 		SetSparse(xOwner.m_uIndex, uIndex);
 		return uIndex;
 	}
@@ -0,0 +1,97 @@
+#include "Zenith.h"
+
+#include "ZenithECS/Zenith_ECSCommandBuffer.h"
+
+Zenith_ECSCommandBuffer::PendingEntity Zenith_ECSCommandBuffer::CreateEntity(Zenith_Scene xScene, const std::string& strName)
+{
+	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xMutex);
+	PendingEntity xPending;
+	xPending.m_uIndex = m_xRecorded.m_xCreates.GetSize();
+	m_xRecorded.m_xCreates.PushBack({ xScene, strName });
+	m_xRecorded.m_xCommands.PushBack({ nullptr, Zenith_EntityID(), xPending.m_uIndex, xPending.m_uIndex });
+	return xPending;
+}
+
+void Zenith_ECSCommandBuffer::Destroy(Zenith_EntityID xID)
+{
+	Record(&ApplyDestroy, xID, uINVALID_PENDING, 0);
+}
+
+void Zenith_ECSCommandBuffer::Destroy(PendingEntity xPending)
+{
+	Record(&ApplyDestroy, Zenith_EntityID(), xPending.m_uIndex, 0);
+}
+
+void Zenith_ECSCommandBuffer::Record(ApplyFunc pfnApply, Zenith_EntityID xID, u_int uPendingIndex, u_int uPayload)
+{
+	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xMutex);
+	Zenith_Assert(uPendingIndex == uINVALID_PENDING || uPendingIndex < m_xRecorded.m_xCreates.GetSize(),
+		"Zenith_ECSCommandBuffer: PendingEntity %u was not created by this buffer (or the buffer has been played back since)", uPendingIndex);
+	m_xRecorded.m_xCommands.PushBack({ pfnApply, xID, uPendingIndex, uPayload });
+}
+
+u_int Zenith_ECSCommandBuffer::GetNumCommands() const
+{
+	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xMutex);
+	return m_xRecorded.m_xCommands.GetSize();
+}
+
+void Zenith_ECSCommandBuffer::Discard()
+{
+	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xMutex);
+	m_xRecorded.m_xCommands.Clear();
+	m_xRecorded.m_xCreates.Clear();
+	m_xRecorded.m_xPayload.Clear();
+}
+
+void Zenith_ECSCommandBuffer::Playback()
+{
+	Zenith_Assert(Zenith_ECS_IsMainThread(), "Zenith_ECSCommandBuffer::Playback must be called from the main thread");
+	Zenith_Assert(!Zenith_AreRenderTasksActive(), "Zenith_ECSCommandBuffer::Playback during render tasks - structural changes would race the render readers");
+	Zenith_Assert(!Zenith_ECS_IsParallelQueryActive(), "Zenith_ECSCommandBuffer::Playback during a parallel query");
+
+	// Take the commands so the lock is not held while they run: applying one can
+	// re-enter this buffer (an OnAwake recording into the thread's buffer).
+	Recorded xTaken;
+	{
+		Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xMutex);
+		if (m_xRecorded.m_xCommands.GetSize() == 0) return;
+		xTaken.m_xCommands = std::move(m_xRecorded.m_xCommands);
+		xTaken.m_xCreates = std::move(m_xRecorded.m_xCreates);
+		xTaken.m_xPayload = std::move(m_xRecorded.m_xPayload);
+	}
+	xTaken.m_xCreated.Resize(xTaken.m_xCreates.GetSize(), Zenith_EntityID());
+
+	Zenith_SceneSystem& xScenes = Zenith_SceneSystem::Get();
+	for (u_int u = 0; u < xTaken.m_xCommands.GetSize(); ++u)
+	{
+		const Command& xCommand = xTaken.m_xCommands.Get(u);
+
+		if (xCommand.m_pfnApply == nullptr)
+		{
+			const CreateRecord& xCreate = xTaken.m_xCreates.Get(xCommand.m_uPayload);
+			if (xScenes.GetSceneData(xCreate.m_xScene) != nullptr)
+			{
+				xTaken.m_xCreated.Get(xCommand.m_uPayload) = xScenes.CreateEntity(xCreate.m_xScene, xCreate.m_strName).GetEntityID();
+			}
+			continue;
+		}
+
+		const Zenith_EntityID xTarget = (xCommand.m_uPendingIndex != uINVALID_PENDING)
+			? xTaken.m_xCreated.Get(xCommand.m_uPendingIndex)
+			: xCommand.m_xEntityID;
+		if (!xTarget.IsValid()) continue;
+
+		// Re-resolved per command: an earlier command (or the OnAwake/OnDestroy it
+		// ran) may have destroyed the target or unloaded its scene.
+		const Zenith_Entity xEntity = xScenes.ResolveEntity(xTarget);
+		if (!xEntity.IsValid()) continue;
+
+		xCommand.m_pfnApply(xTaken, xEntity, xCommand.m_uPayload);
+	}
+}
+
+void Zenith_ECSCommandBuffer::ApplyDestroy(const Recorded&, Zenith_Entity xEntity, u_int)
+{
+	xEntity.Destroy();
+}
@@ -57,4 +57,10 @@ struct Zenith_ECSRuntimeHooks
 	// DontDestroyOnLoad'd agent is genuinely owned by the persistent scene.
 	// null => no-op.
 	void (*m_pfnEntityOwnerSceneChanged)(Zenith_EntityID xEntityID, Zenith_Scene xOldScene, Zenith_Scene xNewScene) = nullptr;
+
+	// Runs pfnRange over [0, uCount) in chunks of at least uGrainSize on the
+	// engine's worker threads, blocking until every chunk has run. Backs
+	// Zenith_Query::ForEachParallel / ForEachConst. null => the whole range runs
+	// as one chunk on the calling thread.
+	void (*m_pfnRunParallelFor)(void (*pfnRange)(void* pData, u_int uBegin, u_int uEnd), void* pData, u_int uCount, u_int uGrainSize) = nullptr;
 };
@@ -26,6 +26,8 @@
 //                         |  always safe)    |                      |
 //   TryGetComponent       | soft (nullptr on | soft                 | soft
 //                         |  fail)           |                      |
+//   MarkChanged /         | soft (no-op / 0  | soft                 | soft
+//   GetChangeTick         |  without a T)    |                      |
 //
 // Why the divergence: AddComponent / GetComponent want a fully usable scene
 // to operate against; RemoveComponent has to keep working during the unload
@@ -47,10 +49,7 @@ T& Zenith_Entity::AddComponent(Args&&... args)
 	Zenith_Assert(pxSceneData->IsLoaded(), "AddComponent: Entity's scene is not loaded");
 	Zenith_Assert(pxSceneData->EntityExists(m_xEntityID), "AddComponent: Entity (idx=%u, gen=%u) is stale", m_xEntityID.m_uIndex, m_xEntityID.m_uGeneration);
 
-	const Zenith_SceneData::TypeID uTypeID = Zenith_SceneData::TypeIDGenerator::GetTypeID<T>();
-	const Zenith_HashMap<Zenith_SceneData::TypeID, u_int>& xComponentsForThisEntity =
-		Zenith_ECS_EntityStore().m_axEntityComponents.Get(m_xEntityID.m_uIndex);
-	Zenith_Assert(!xComponentsForThisEntity.Contains(uTypeID), "AddComponent: Entity already has this component type");
+	Zenith_Assert(!pxSceneData->EntityHasComponent<T>(m_xEntityID), "AddComponent: Entity already has this component type");
 
 	return pxSceneData->CreateComponent<T>(m_xEntityID, std::forward<Args>(args)..., *this);
 }
@@ -85,6 +84,22 @@ T* Zenith_Entity::TryGetComponent() const
 	return &pxSceneData->GetComponentFromEntity<T>(m_xEntityID);
 }
 
+template<typename T>
+void Zenith_Entity::MarkChanged() const
+{
+	Zenith_SceneData* pxSceneData = GetSceneData();
+	if (pxSceneData == nullptr) return;
+	pxSceneData->MarkComponentChanged<T>(m_xEntityID);
+}
+
+template<typename T>
+u_int Zenith_Entity::GetChangeTick() const
+{
+	Zenith_SceneData* pxSceneData = GetSceneData();
+	if (pxSceneData == nullptr) return 0;
+	return pxSceneData->GetComponentChangeTick<T>(m_xEntityID);
+}
+
 template<typename T>
 void Zenith_Entity::RemoveComponent()
 {
@@ -17,6 +17,8 @@
 // Zenith_ECS_EntityStore()); Zenith_SceneData keeps using-aliases for back-compat
 // so the qualified type names (Zenith_SceneData::Zenith_EntitySlot etc.) keep
 // resolving.
+// The per-entity component map (s_axEntityComponents, later m_axEntityComponents)
+// has since been dropped: the component pools' sparse-set index is authoritative.
 
 // Entity lifecycle state. Was Zenith_SceneData::EntityLifecycleState.
 enum class Zenith_EntityLifecycleState : uint8_t
@@ -173,7 +175,7 @@ struct Zenith_EntitySlot
 	}
 };
 
-// Engine-owned holder for the three global entity arrays. Public members --
+// Engine-owned holder for the global entity arrays. Public members --
 // every former Zenith_SceneData::s_axXxx call site now reads
 // g_xEngine.EntityStore().m_axXxx directly. Reset() replaces the former
 // Zenith_SceneData::ResetGlobalEntityStorage helper.
@@ -186,20 +188,18 @@ public:
 	Zenith_EntityStore(const Zenith_EntityStore&) = delete;
 	Zenith_EntityStore& operator=(const Zenith_EntityStore&) = delete;
 
-	// TypeID type used by per-entity component-index maps. Mirrors
-	// Zenith_SceneData::TypeID, kept as a free typedef so this header
-	// doesn't have to include Zenith_SceneData.h (which would cycle).
-	using TypeID = u_int;
-
 	Zenith_Vector<Zenith_EntitySlot>                               m_axEntitySlots;
 	Zenith_Vector<uint32_t>                                        m_axFreeEntityIndices;
-	Zenith_Vector<Zenith_HashMap<TypeID, u_int>>                   m_axEntityComponents;
+
+	// There is deliberately no per-entity component map here: which components
+	// an entity owns is answered by each scene's component pools through their
+	// sparse-set index (Zenith_ComponentPoolBase::FindDense), so creating an
+	// entity allocates nothing beyond its slot.
 
 	void Reset()
 	{
 		m_axEntitySlots.Clear();
 		m_axFreeEntityIndices.Clear();
-		m_axEntityComponents.Clear();
 	}
 };
 
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+//------------------------------------------------------------------------------
+// Zenith_QueryAccessTracker - component access claims of in-flight parallel queries
+//------------------------------------------------------------------------------
+//
+// Zenith_Query::ForEachParallel / ForEachConst run their callback on worker
+// threads, so two of them in flight at once (e.g. two systems scheduled side by
+// side) must not touch the same component type unless both only read it. Before
+// dispatching, a parallel query claims every queried component type: READ for
+// const-qualified query types (and for every type under ForEachConst), WRITE for
+// the rest. Claims follow reader/writer rules per type — any number of readers,
+// or exactly one writer — and a claim that would break them is refused, which the
+// query turns into an assert naming the conflict instead of a silent data race.
+//
+// While any parallel query is in flight, structural changes (CreateComponent /
+// RemoveComponentFromEntity) assert: the worker threads are walking the dense
+// pools, so swap-and-pop underneath them is never safe. Request them through the
+// Zenith_QueryDeferredOps the callback can take instead.
+//
+// Owned by Zenith_SceneSystem; the ECS headers reach it through the leaf
+// forwarder Zenith_ECS_QueryAccess() (Zenith_RenderTaskState.h).
+//------------------------------------------------------------------------------
+class Zenith_QueryAccessTracker
+{
+public:
+	// Component TypeIDs at or above this are not tracked (claims always succeed).
+	// Far above the number of registered component types.
+	static constexpr u_int uMAX_TRACKED_TYPES = 512;
+
+	Zenith_QueryAccessTracker() = default;
+	Zenith_QueryAccessTracker(const Zenith_QueryAccessTracker&) = delete;
+	Zenith_QueryAccessTracker& operator=(const Zenith_QueryAccessTracker&) = delete;
+
+	// Claim read (bWrite == false) or write access to uTypeID. Returns false and
+	// claims nothing when the claim conflicts with one already held.
+	bool TryAcquire(u_int uTypeID, bool bWrite)
+	{
+		if (uTypeID >= uMAX_TRACKED_TYPES)
+		{
+			return true;
+		}
+
+		std::atomic<int32_t>& xState = m_aiState[uTypeID];
+		int32_t iCurrent = xState.load(std::memory_order_relaxed);
+		while (true)
+		{
+			if (bWrite ? (iCurrent != 0) : (iCurrent < 0))
+			{
+				return false;
+			}
+			const int32_t iDesired = bWrite ? iWRITER : iCurrent + 1;
+			if (xState.compare_exchange_weak(iCurrent, iDesired, std::memory_order_acq_rel, std::memory_order_relaxed))
+			{
+				return true;
+			}
+		}
+	}
+
+	void Release(u_int uTypeID, bool bWrite)
+	{
+		if (uTypeID >= uMAX_TRACKED_TYPES)
+		{
+			return;
+		}
+
+		if (bWrite)
+		{
+			Zenith_Assert(m_aiState[uTypeID].load(std::memory_order_relaxed) == iWRITER, "QueryAccessTracker: releasing a write claim that is not held (type %u)", uTypeID);
+			m_aiState[uTypeID].store(0, std::memory_order_release);
+		}
+		else
+		{
+			const int32_t iPrevious = m_aiState[uTypeID].fetch_sub(1, std::memory_order_acq_rel);
+			Zenith_Assert(iPrevious > 0, "QueryAccessTracker: releasing a read claim that is not held (type %u)", uTypeID);
+		}
+	}
+
+	// True if uTypeID is currently claimed for write by some parallel query.
+	bool IsWriteClaimed(u_int uTypeID) const
+	{
+		return uTypeID < uMAX_TRACKED_TYPES && m_aiState[uTypeID].load(std::memory_order_acquire) == iWRITER;
+	}
+
+	void BeginParallelQuery() { m_uActiveQueries.fetch_add(1, std::memory_order_acq_rel); }
+	void EndParallelQuery() { m_uActiveQueries.fetch_sub(1, std::memory_order_acq_rel); }
+	bool IsParallelQueryActive() const { return m_uActiveQueries.load(std::memory_order_acquire) > 0; }
+
+private:
+	static constexpr int32_t iWRITER = -1;
+
+	// Per type: 0 = unclaimed, > 0 = that many readers, iWRITER = one writer.
+	std::atomic<int32_t> m_aiState[uMAX_TRACKED_TYPES] {};
+	std::atomic<u_int> m_uActiveQueries {0};
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Collections/Zenith_Vector.h"
+#include "ZenithECS/Zenith_Entity.h"
+
+#include <algorithm>
+
+class Zenith_SceneData;
+
+//------------------------------------------------------------------------------
+// Zenith_QueryDeferredOps - structural changes requested from a parallel query
+//------------------------------------------------------------------------------
+//
+// PRIVATE detail of Zenith_Query.h (included from there). A ForEachParallel /
+// ForEachConst callback runs on worker threads while other workers walk the same
+// dense pools, so it must never add/remove components or destroy entities
+// directly. A callback that takes a leading Zenith_QueryDeferredOps& records the
+// change here instead; the query plays every recorded op back on the calling
+// (main) thread once all chunks have finished, in driver-pool order regardless
+// of which worker ran which chunk, so the result is deterministic.
+//
+// Ops are type-erased as (entity, apply function pointer) — the apply functions
+// are per-component-type template instantiations, so there is no allocation per
+// op beyond the vector's amortised growth.
+//------------------------------------------------------------------------------
+class Zenith_QueryDeferredOps
+{
+public:
+	// Zenith_Entity::Destroy at playback (itself deferred to the next Update).
+	void Destroy(Zenith_EntityID xID)
+	{
+		Record(xID, &ApplyDestroy);
+	}
+
+	// Default-constructed AddComponent<T> at playback. No-op if the entity already
+	// has T (or no longer exists) by then.
+	template<typename T>
+	void AddComponent(Zenith_EntityID xID)
+	{
+		Record(xID, &ApplyAddComponent<T>);
+	}
+
+	// RemoveComponent<T> at playback. No-op if the entity no longer has T.
+	template<typename T>
+	void RemoveComponent(Zenith_EntityID xID)
+	{
+		Record(xID, &ApplyRemoveComponent<T>);
+	}
+
+	u_int GetNumOps() const { return m_xOps.GetSize(); }
+
+private:
+	template<typename... Ts> friend class Zenith_Query;
+
+	using ApplyFunc = void(*)(Zenith_SceneData& xSceneData, Zenith_EntityID xID);
+
+	struct Op
+	{
+		Zenith_EntityID m_xEntityID;
+		ApplyFunc m_pfnApply;
+		u_int m_uOrder;  // driver-pool index of the element whose callback recorded it
+	};
+
+	void Record(Zenith_EntityID xID, ApplyFunc pfnApply)
+	{
+		m_xOps.PushBack({ xID, pfnApply, m_uCurrentOrder });
+	}
+
+	void SetCurrentOrder(u_int uOrder) { m_uCurrentOrder = uOrder; }
+
+	void AppendFrom(const Zenith_QueryDeferredOps& xOther)
+	{
+		for (u_int u = 0; u < xOther.m_xOps.GetSize(); ++u)
+		{
+			m_xOps.PushBack(xOther.m_xOps.Get(u));
+		}
+	}
+
+	// Main thread only. Chunks append in completion order, so restore pool order
+	// first; stable so one element's ops keep the order its callback issued them.
+	void Playback(Zenith_SceneData& xSceneData)
+	{
+		std::stable_sort(m_xOps.GetDataPointer(), m_xOps.GetDataPointer() + m_xOps.GetSize(),
+			[](const Op& xA, const Op& xB) { return xA.m_uOrder < xB.m_uOrder; });
+		for (u_int u = 0; u < m_xOps.GetSize(); ++u)
+		{
+			const Op& xOp = m_xOps.Get(u);
+			xOp.m_pfnApply(xSceneData, xOp.m_xEntityID);
+		}
+		m_xOps.Clear();
+	}
+
+	static void ApplyDestroy(Zenith_SceneData& xSceneData, Zenith_EntityID xID);
+
+	template<typename T>
+	static void ApplyAddComponent(Zenith_SceneData& xSceneData, Zenith_EntityID xID);
+
+	template<typename T>
+	static void ApplyRemoveComponent(Zenith_SceneData& xSceneData, Zenith_EntityID xID);
+
+	Zenith_Vector<Op> m_xOps;
+	u_int m_uCurrentOrder = 0;
+};
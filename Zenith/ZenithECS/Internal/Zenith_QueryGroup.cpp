@@ -0,0 +1,216 @@
+#include "Zenith.h"
+
+#include "ZenithECS/Internal/Zenith_QueryGroup.h"
+#include "ZenithECS/Internal/Zenith_ComponentPool.h"
+
+namespace
+{
+	const Zenith_ComponentPoolBase* GetPool(const Zenith_Vector<Zenith_ComponentPoolBase*>& xPools, u_int uTypeID)
+	{
+		return uTypeID < xPools.GetSize() ? xPools.Get(uTypeID) : nullptr;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Zenith_QueryGroup
+//------------------------------------------------------------------------------
+
+bool Zenith_QueryGroup::HasSignature(const u_int* puSortedTypeIDs, u_int uNumTypes) const
+{
+	if (uNumTypes != m_uNumTypes) return false;
+	for (u_int u = 0; u < uNumTypes; ++u)
+	{
+		if (m_auTypeIDs[u] != puSortedTypeIDs[u]) return false;
+	}
+	return true;
+}
+
+u_int Zenith_QueryGroup::FindColumn(u_int uTypeID) const
+{
+	for (u_int u = 0; u < m_uNumTypes; ++u)
+	{
+		if (m_auTypeIDs[u] == uTypeID) return u;
+	}
+	return uMAX_TYPES;
+}
+
+u_int Zenith_QueryGroup::FindMember(Zenith_EntityID xID) const
+{
+	if (xID.m_uIndex >= m_xSlotToMember.GetSize()) return uINVALID_MEMBER;
+	const u_int uMember = m_xSlotToMember.Get(xID.m_uIndex);
+	if (uMember == uINVALID_MEMBER) return uINVALID_MEMBER;
+	return (m_xMembers.Get(uMember) == xID) ? uMember : uINVALID_MEMBER;
+}
+
+void Zenith_QueryGroup::AddMember(Zenith_EntityID xID, const u_int* puDenseRow)
+{
+	Zenith_Assert(FindMember(xID) == uINVALID_MEMBER, "QueryGroup::AddMember: entity (idx=%u, gen=%u) is already a member", xID.m_uIndex, xID.m_uGeneration);
+
+	if (m_xSlotToMember.GetSize() <= xID.m_uIndex)
+	{
+		m_xSlotToMember.Resize(xID.m_uIndex + 1, uINVALID_MEMBER);
+	}
+	m_xSlotToMember.Get(xID.m_uIndex) = m_xMembers.GetSize();
+
+	m_xMembers.PushBack(xID);
+	for (u_int u = 0; u < m_uNumTypes; ++u)
+	{
+		m_xDenseRows.PushBack(puDenseRow[u]);
+	}
+}
+
+void Zenith_QueryGroup::RemoveMember(u_int uMember)
+{
+	Zenith_Assert(uMember < m_xMembers.GetSize(), "QueryGroup::RemoveMember: member %u out of range (size=%u)", uMember, m_xMembers.GetSize());
+
+	const u_int uLast = m_xMembers.GetSize() - 1;
+	m_xSlotToMember.Get(m_xMembers.Get(uMember).m_uIndex) = uINVALID_MEMBER;
+
+	// Swap-and-pop, mirroring the component pools: the last row moves into the
+	// vacated one and its slot entry is repointed.
+	if (uMember != uLast)
+	{
+		const Zenith_EntityID xMoved = m_xMembers.Get(uLast);
+		m_xMembers.Get(uMember) = xMoved;
+		for (u_int u = 0; u < m_uNumTypes; ++u)
+		{
+			m_xDenseRows.Get(uMember * m_uNumTypes + u) = m_xDenseRows.Get(uLast * m_uNumTypes + u);
+		}
+		m_xSlotToMember.Get(xMoved.m_uIndex) = uMember;
+	}
+
+	m_xMembers.PopBack();
+	for (u_int u = 0; u < m_uNumTypes; ++u)
+	{
+		m_xDenseRows.PopBack();
+	}
+}
+
+//------------------------------------------------------------------------------
+// Zenith_QueryGroupRegistry
+//------------------------------------------------------------------------------
+
+Zenith_QueryGroup* Zenith_QueryGroupRegistry::Find(const u_int* puSortedTypeIDs, u_int uNumTypes) const
+{
+	for (u_int u = 0; u < m_xGroups.GetSize(); ++u)
+	{
+		if (m_xGroups.Get(u)->HasSignature(puSortedTypeIDs, uNumTypes))
+		{
+			return m_xGroups.Get(u);
+		}
+	}
+	return nullptr;
+}
+
+Zenith_QueryGroup* Zenith_QueryGroupRegistry::FindOrCreate(const u_int* puSortedTypeIDs, u_int uNumTypes, const Zenith_Vector<Zenith_ComponentPoolBase*>& xPools)
+{
+	Zenith_Assert(uNumTypes >= 2 && uNumTypes <= Zenith_QueryGroup::uMAX_TYPES, "QueryGroupRegistry::FindOrCreate: unsupported signature size %u", uNumTypes);
+
+	Zenith_QueryGroup* pxGroup = Find(puSortedTypeIDs, uNumTypes);
+	if (pxGroup != nullptr) return pxGroup;
+
+	// Every pool must exist before the group can be populated; the smallest one
+	// drives the initial scan.
+	const Zenith_ComponentPoolBase* pxDriver = nullptr;
+	for (u_int u = 0; u < uNumTypes; ++u)
+	{
+		const Zenith_ComponentPoolBase* pxPool = GetPool(xPools, puSortedTypeIDs[u]);
+		if (pxPool == nullptr) return nullptr;
+		if (pxDriver == nullptr || pxPool->m_xOwningEntities.GetSize() < pxDriver->m_xOwningEntities.GetSize())
+		{
+			pxDriver = pxPool;
+		}
+	}
+
+	pxGroup = new Zenith_QueryGroup;
+	pxGroup->m_uNumTypes = uNumTypes;
+	for (u_int u = 0; u < uNumTypes; ++u)
+	{
+		pxGroup->m_auTypeIDs[u] = puSortedTypeIDs[u];
+	}
+
+	u_int auRow[Zenith_QueryGroup::uMAX_TYPES];
+	for (u_int uOwner = 0; uOwner < pxDriver->m_xOwningEntities.GetSize(); ++uOwner)
+	{
+		const Zenith_EntityID xID = pxDriver->m_xOwningEntities.Get(uOwner);
+		bool bAll = true;
+		for (u_int u = 0; u < uNumTypes && bAll; ++u)
+		{
+			auRow[u] = GetPool(xPools, puSortedTypeIDs[u])->FindDense(xID);
+			bAll = auRow[u] != Zenith_ComponentPoolBase::uINVALID_DENSE;
+		}
+		if (bAll)
+		{
+			pxGroup->AddMember(xID, auRow);
+		}
+	}
+
+	m_xGroups.PushBack(pxGroup);
+	return pxGroup;
+}
+
+void Zenith_QueryGroupRegistry::OnComponentAdded(Zenith_EntityID xID, u_int uTypeID, u_int uDense, const Zenith_Vector<Zenith_ComponentPoolBase*>& xPools)
+{
+	u_int auRow[Zenith_QueryGroup::uMAX_TYPES];
+	for (u_int uGroup = 0; uGroup < m_xGroups.GetSize(); ++uGroup)
+	{
+		Zenith_QueryGroup* pxGroup = m_xGroups.Get(uGroup);
+		const u_int uColumn = pxGroup->FindColumn(uTypeID);
+		if (uColumn == Zenith_QueryGroup::uMAX_TYPES) continue;
+
+		// Joins only once the entity owns every other type in the signature.
+		bool bAll = true;
+		for (u_int u = 0; u < pxGroup->m_uNumTypes && bAll; ++u)
+		{
+			if (u == uColumn)
+			{
+				auRow[u] = uDense;
+				continue;
+			}
+			const Zenith_ComponentPoolBase* pxPool = GetPool(xPools, pxGroup->m_auTypeIDs[u]);
+			auRow[u] = pxPool ? pxPool->FindDense(xID) : Zenith_ComponentPoolBase::uINVALID_DENSE;
+			bAll = auRow[u] != Zenith_ComponentPoolBase::uINVALID_DENSE;
+		}
+		if (bAll)
+		{
+			pxGroup->AddMember(xID, auRow);
+		}
+	}
+}
+
+void Zenith_QueryGroupRegistry::OnComponentRemoved(Zenith_EntityID xID, u_int uTypeID, Zenith_EntityID xMovedOwner, u_int uDense)
+{
+	++m_uLayoutVersion;
+
+	for (u_int uGroup = 0; uGroup < m_xGroups.GetSize(); ++uGroup)
+	{
+		Zenith_QueryGroup* pxGroup = m_xGroups.Get(uGroup);
+		const u_int uColumn = pxGroup->FindColumn(uTypeID);
+		if (uColumn == Zenith_QueryGroup::uMAX_TYPES) continue;
+
+		if (xMovedOwner.IsValid())
+		{
+			const u_int uMoved = pxGroup->FindMember(xMovedOwner);
+			if (uMoved != Zenith_QueryGroup::uINVALID_MEMBER)
+			{
+				pxGroup->SetDense(uMoved, uColumn, uDense);
+			}
+		}
+
+		const u_int uMember = pxGroup->FindMember(xID);
+		if (uMember != Zenith_QueryGroup::uINVALID_MEMBER)
+		{
+			pxGroup->RemoveMember(uMember);
+		}
+	}
+}
+
+void Zenith_QueryGroupRegistry::Clear()
+{
+	for (u_int u = 0; u < m_xGroups.GetSize(); ++u)
+	{
+		delete m_xGroups.Get(u);
+	}
+	m_xGroups.Clear();
+	++m_uLayoutVersion;
+}
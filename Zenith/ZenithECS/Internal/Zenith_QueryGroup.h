@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Collections/Zenith_Vector.h"
+#include "ZenithECS/Zenith_Entity.h"
+
+class Zenith_ComponentPoolBase;
+
+//------------------------------------------------------------------------------
+// Zenith_QueryGroup - persistent matched-entity list for one component signature
+//------------------------------------------------------------------------------
+//
+// A group caches the answer to "which entities own ALL of these component
+// types?" for one signature (a set of TypeIDs, stored sorted so Query<A, B> and
+// Query<B, A> share a group). Members are packed; each member row also carries
+// the dense pool index of every component in the signature, so a grouped
+// ForEach walks the rows and indexes the pools directly, with no per-entity
+// sparse probe or presence pass.
+//
+// Groups are maintained incrementally by Zenith_SceneData: every component add,
+// remove and cross-scene transfer is reported to the owning scene's
+// Zenith_QueryGroupRegistry (OnComponentAdded / OnComponentRemoved), which
+// joins/leaves the affected groups and repoints the dense column of whichever
+// component a pool swap-and-pop moved. Groups are created on first use by a
+// multi-type Zenith_Query (see Zenith_Query::ResolveGroup) and destroyed with
+// the scene's component pools.
+//
+// Main-thread only for mutation. Reads (grouped ForEach during render tasks,
+// ForEachParallel chunks) rely on the same "no structural change while readers
+// are in flight" rules as the pools themselves.
+//------------------------------------------------------------------------------
+class Zenith_QueryGroup
+{
+public:
+	static constexpr u_int uMAX_TYPES = 8;
+	static constexpr u_int uINVALID_MEMBER = 0xFFFFFFFFu;
+
+	// Sorted, duplicate-free TypeIDs; column c of every dense row belongs to
+	// m_auTypeIDs[c].
+	u_int m_auTypeIDs[uMAX_TYPES] = {};
+	u_int m_uNumTypes = 0;
+
+	// Packed member list and the matching dense rows (m_uNumTypes entries per
+	// member, row-major). Kept in lock-step by AddMember / RemoveMember.
+	Zenith_Vector<Zenith_EntityID> m_xMembers;
+	Zenith_Vector<u_int> m_xDenseRows;
+
+	// Entity slot -> member index (uINVALID_MEMBER when not a member). Validated
+	// against m_xMembers so a recycled slot never aliases an old member.
+	Zenith_Vector<u_int> m_xSlotToMember;
+
+	u_int GetNumMembers() const { return m_xMembers.GetSize(); }
+	Zenith_EntityID GetMember(u_int uMember) const { return m_xMembers.Get(uMember); }
+	const u_int* GetDenseRow(u_int uMember) const { return m_xDenseRows.GetDataPointer() + uMember * m_uNumTypes; }
+
+	bool HasSignature(const u_int* puSortedTypeIDs, u_int uNumTypes) const;
+
+	// Column of uTypeID in this signature, or uMAX_TYPES if the group does not
+	// include that type.
+	u_int FindColumn(u_int uTypeID) const;
+
+	// Member index of xID, or uINVALID_MEMBER.
+	u_int FindMember(Zenith_EntityID xID) const;
+
+	void AddMember(Zenith_EntityID xID, const u_int* puDenseRow);
+	void RemoveMember(u_int uMember);
+	void SetDense(u_int uMember, u_int uColumn, u_int uDense) { m_xDenseRows.Get(uMember * m_uNumTypes + uColumn) = uDense; }
+};
+
+//------------------------------------------------------------------------------
+// Zenith_QueryGroupRegistry - the per-scene set of query groups
+//------------------------------------------------------------------------------
+//
+// Owned by Zenith_SceneData. Groups are heap-allocated so a Zenith_Query can
+// keep a group pointer across a callback that creates further groups.
+//
+// m_uLayoutVersion is bumped whenever a removal may have moved a member row or
+// a dense index. A grouped ForEach records it before iterating and drops back to
+// re-probing (the sparse path) for the rest of the walk as soon as it changes, so
+// callbacks keep their freedom to add/remove/destroy mid-iteration.
+//------------------------------------------------------------------------------
+class Zenith_QueryGroupRegistry
+{
+public:
+	Zenith_QueryGroupRegistry() = default;
+	~Zenith_QueryGroupRegistry() { Clear(); }
+
+	Zenith_QueryGroupRegistry(const Zenith_QueryGroupRegistry&) = delete;
+	Zenith_QueryGroupRegistry& operator=(const Zenith_QueryGroupRegistry&) = delete;
+
+	u_int GetNumGroups() const { return m_xGroups.GetSize(); }
+	u_int GetLayoutVersion() const { return m_uLayoutVersion; }
+
+	// Existing group for a sorted signature, or nullptr.
+	Zenith_QueryGroup* Find(const u_int* puSortedTypeIDs, u_int uNumTypes) const;
+
+	// Find, or create and populate from the scene's current pools. Population
+	// walks the smallest of the signature's pools; returns nullptr (and creates
+	// nothing) while any of the pools is missing, so Query<NeverAdded, X> does not
+	// leave an empty group behind.
+	Zenith_QueryGroup* FindOrCreate(const u_int* puSortedTypeIDs, u_int uNumTypes, const Zenith_Vector<Zenith_ComponentPoolBase*>& xPools);
+
+	// Incremental maintenance, called by Zenith_SceneData after the pool has been
+	// mutated. OnComponentAdded: xID gained uTypeID at uDense. OnComponentRemoved:
+	// xID lost uTypeID; if the pool's swap-and-pop moved xMovedOwner's component
+	// into uDense, its column is repointed.
+	void OnComponentAdded(Zenith_EntityID xID, u_int uTypeID, u_int uDense, const Zenith_Vector<Zenith_ComponentPoolBase*>& xPools);
+	void OnComponentRemoved(Zenith_EntityID xID, u_int uTypeID, Zenith_EntityID xMovedOwner, u_int uDense);
+
+	void Clear();
+
+private:
+	Zenith_Vector<Zenith_QueryGroup*> m_xGroups;
+	u_int m_uLayoutVersion = 0;
+};
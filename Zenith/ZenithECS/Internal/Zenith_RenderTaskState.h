@@ -24,6 +24,10 @@ bool Zenith_AreRenderTasksActive();
 // Defined in Internal/Zenith_SceneSystem_Lifecycle.cpp, beside the one above.
 bool Zenith_AreSparseQueryReadsEnabled();
 
+// Same again for the cached query-group read toggle
+// (g_xEngine.Scenes().AreQueryGroupsEnabled()).
+bool Zenith_AreQueryGroupsEnabled();
+
 // Main-thread predicate for the ECS core's thread-affinity asserts. Forwards to
 // the ECS runtime hook (Zenith_ECSRuntimeHooks::m_pfnIsMainThread); returns true
 // when no hook is installed (permissive, so an un-bootstrapped ECS asserts as if
@@ -42,3 +46,25 @@ bool Zenith_ECS_IsMainThread();
 // Defined in Internal/Zenith_SceneSystem_Lifecycle.cpp, beside the ones above.
 class Zenith_EntityStore;
 Zenith_EntityStore& Zenith_ECS_EntityStore();
+
+// Parallel-query forwarders (Zenith_Query::ForEachParallel / ForEachConst), same
+// cycle-break pattern. Zenith_ECS_QueryAccess() returns the SceneSystem-owned
+// access-claim tracker; Zenith_ECS_IsParallelQueryActive() is its in-flight flag,
+// read by SceneData.h's structural-change asserts. Zenith_ECS_RunParallelFor()
+// splits [0, uCount) into chunks of at least uGrainSize and runs pfnRange on
+// each, blocking until all are done — through the runtime hook
+// (Zenith_ECSRuntimeHooks::m_pfnRunParallelFor) when installed, otherwise as a
+// single chunk on the calling thread.
+//
+// Defined in Internal/Zenith_SceneSystem_Lifecycle.cpp, beside the ones above.
+class Zenith_QueryAccessTracker;
+Zenith_QueryAccessTracker& Zenith_ECS_QueryAccess();
+bool Zenith_ECS_IsParallelQueryActive();
+void Zenith_ECS_RunParallelFor(void (*pfnRange)(void* pData, u_int uBegin, u_int uEnd), void* pData, u_int uCount, u_int uGrainSize);
+
+// Component change-detection tick (Zenith_SceneSystem::GetChangeTick), stamped
+// into a pool slot whenever its component is added or written. Same cycle-break
+// pattern: Zenith_ComponentPool.h and Zenith_SceneData.h stamp through this.
+//
+// Defined in Internal/Zenith_SceneSystem_Lifecycle.cpp, beside the ones above.
+u_int Zenith_ECS_ChangeTick();
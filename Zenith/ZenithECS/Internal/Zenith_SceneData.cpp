@@ -144,6 +144,7 @@ void Zenith_SceneData::CollectResetHierarchy(Zenith_Vector<Zenith_EntityID>& axH
 
 void Zenith_SceneData::DestroyComponentPools()
 {
+	m_xQueryGroups.Clear();
 	for (Zenith_Vector<Zenith_ComponentPoolBase*>::Iterator xIt(m_xComponents); !xIt.Done(); xIt.Next())
 	{
 		Zenith_ComponentPoolBase* pxPool = xIt.GetData();
@@ -152,6 +153,19 @@ void Zenith_SceneData::DestroyComponentPools()
 	m_xComponents.Clear();
 }
 
+bool Zenith_SceneData::EntityOwnsAnyComponent(Zenith_EntityID xID) const
+{
+	for (u_int u = 0; u < m_xComponents.GetSize(); ++u)
+	{
+		const Zenith_ComponentPoolBase* pxPool = m_xComponents.Get(u);
+		if (pxPool != nullptr && pxPool->FindDense(xID) != Zenith_ComponentPoolBase::uINVALID_DENSE)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 void Zenith_SceneData::FreeGlobalSlotsForActiveEntities()
 {
 	for (u_int i = 0; i < m_xActiveEntities.GetSize(); ++i)
@@ -160,7 +174,6 @@ void Zenith_SceneData::FreeGlobalSlotsForActiveEntities()
 		if (xID.m_uIndex >= Zenith_ECS_EntityStore().m_axEntitySlots.GetSize()) continue;
 		Zenith_EntitySlot& xSlot = Zenith_ECS_EntityStore().m_axEntitySlots.Get(xID.m_uIndex);
 		if (!xSlot.IsOccupied() || xSlot.m_uGeneration != xID.m_uGeneration) continue;
-		Zenith_ECS_EntityStore().m_axEntityComponents.Get(xID.m_uIndex).Clear();
 		xSlot.ReleaseSlot();
 		Zenith_ECS_EntityStore().m_axFreeEntityIndices.PushBack(xID.m_uIndex);
 	}
@@ -270,6 +283,9 @@ void Zenith_SceneData::Reset()
 
 	// Pass 2: OnDestroy + component removal in hierarchy-depth order. Components
 	// are removed in dependency-safe serialization order inside RemoveAllComponents.
+	// The query groups are dropped first so the removals don't maintain them
+	// one member at a time; a query run from an OnDestroy rebuilds what it needs.
+	m_xQueryGroups.Clear();
 	for (u_int u = 0; u < axHierarchy.GetSize(); ++u)
 	{
 		DestroyEntityComponents(axHierarchy.Get(u));
@@ -378,11 +394,6 @@ Zenith_EntityID Zenith_SceneData::CreateEntity()
 		Zenith_ECS_EntityStore().m_axEntitySlots.PushBack(std::move(xNewSlot));
 	}
 
-	while (Zenith_ECS_EntityStore().m_axEntityComponents.GetSize() <= uIndex)
-	{
-		Zenith_ECS_EntityStore().m_axEntityComponents.PushBack({});
-	}
-
 	Zenith_EntityID xNewID = { uIndex, uGeneration };
 	m_xActiveEntities.PushBack(xNewID);
 	m_axNewlyCreatedEntities.PushBack(xNewID);
@@ -453,8 +464,6 @@ void Zenith_SceneData::RemoveEntity(Zenith_EntityID xID)
 		DestroyEntityComponents(xEntityID);
 		Zenith_EntitySlot& xSlot = Zenith_ECS_EntityStore().m_axEntitySlots.Get(xEntityID.m_uIndex);
 
-		Zenith_ECS_EntityStore().m_axEntityComponents.Get(xEntityID.m_uIndex).Clear();
-
 		// Cancel any pending start before releasing the slot
 		if (xSlot.IsPendingStart())
 		{
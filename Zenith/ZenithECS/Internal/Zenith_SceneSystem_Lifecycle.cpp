@@ -2,6 +2,7 @@
 
 #include "ZenithECS/Zenith_SceneSystem.h"
 #include "ZenithECS/Zenith_Entity.h"
+#include "ZenithECS/Zenith_ECSCommandBuffer.h"
 
 #include <algorithm>
 
@@ -151,9 +152,10 @@ void Zenith_SceneSystem::ResetWorldForNextTest()
 	// (the harness reloads by build index straight after), m_xRuntimeHooks,
 	// m_fFixedTimestep, m_uRenderMutationEpoch (monotonic — resetting it to 1
 	// would make a stale render snapshot compare CURRENT and dereference freed
-	// instances), m_bIsMainLoopRunning (the main loop IS still running),
+	// instances), m_uChangeTick (monotonic for the same reason: a consumer's
+	// remembered tick must never run ahead of new stamps), m_bIsMainLoopRunning (the main loop IS still running),
 	// m_ulNextLoadTimestamp (monotonic; SelectNewActiveScene's tie-break),
-	// m_bUseSparseQueryReads (a pin-and-restore test contract), m_axScenes /
+	// m_bUseSparseQueryReads / m_bUseQueryGroups (pin-and-restore test contracts), m_axScenes /
 	// m_axSceneGenerations (see step 6) and the entity store all stay.
 	xScn.m_fFixedTimeAccumulator = 0.0f;
 	xScn.m_axCurrentlyLoadingPaths.Clear();
@@ -174,6 +176,7 @@ void Zenith_SceneSystem::ResetWorldForNextTest()
 	xScn.m_xPendingLoad.m_iBuildIndex = -1;
 	xScn.m_xPendingLoad.m_strPath.clear();
 	xScn.m_xPendingLoad.m_uMode       = 0;
+	xScn.DiscardCommandBuffers();
 
 	// -- 5. Entity slots ---------------------------------------------------
 	// Scene teardown ALREADY released every live slot (each ~Zenith_SceneData ->
@@ -285,6 +288,9 @@ void Zenith_SceneSystem::Shutdown()
 	m_xPendingLoad.m_strPath.clear();
 	m_xPendingLoad.m_uMode = 0;
 
+	// Recorded structural changes name entities and scenes that are about to go.
+	DiscardCommandBuffers();
+
 	// (Phase 7b-2: the scene-callback lists / handle allocator / pending-removal
 	// queue / firing-depth counter are gone — scene-lifecycle dispatch is now
 	// Zenith_EventDispatcher, which is a process-level singleton not owned by the
@@ -397,6 +403,11 @@ void Zenith_SceneSystem::Update(float fDt)
 		return pxData;
 	};
 
+	// Command-buffer sync point 1: changes recorded since the previous frame
+	// (async jobs, last frame's render-side work) land before anything runs, so
+	// entities they create get their Start below.
+	PlaybackCommandBuffers();
+
 	// HIGH-1: Unity execution order is Awake -> OnEnable -> Start -> FixedUpdate
 	// -> Update -> LateUpdate. Flush pending Starts BEFORE the FixedUpdate
 	// accumulator.
@@ -423,6 +434,9 @@ void Zenith_SceneSystem::Update(float fDt)
 		m_fFixedTimeAccumulator -= m_fFixedTimestep;
 	}
 
+	// Sync point 2: physics-rate systems' recorded changes are visible to Update.
+	PlaybackCommandBuffers();
+
 	for (u_int i = 0; i < axUpdatable.GetSize(); ++i)
 	{
 		if (Zenith_SceneData* pxData = ResolveUpdatable(axUpdatable.Get(i)))
@@ -431,6 +445,9 @@ void Zenith_SceneSystem::Update(float fDt)
 		}
 	}
 
+	// Sync point 3: Update's recorded changes land before the frame renders.
+	PlaybackCommandBuffers();
+
 	// Skeletal animation is dispatched by Zenith_AnimatorComponent::OnUpdate
 	// above — there is no separate scene-driven animation task.
 
@@ -445,6 +462,67 @@ void Zenith_SceneSystem::Update(float fDt)
 	}
 }
 
+//=============================================================================
+// Command buffers
+//=============================================================================
+
+namespace
+{
+	// The calling thread's buffer, and the instance ID of the scene system it was
+	// registered with. A test harness may construct a fresh scene system in the
+	// same process, possibly at the address of one it destroyed (which freed the
+	// buffer), so the owner is matched by ID, never by pointer.
+	thread_local Zenith_ECSCommandBuffer* tl_pxCommandBuffer = nullptr;
+	thread_local u_int64 tl_ulCommandBufferOwnerID = 0;
+}
+
+Zenith_ECSCommandBuffer& Zenith_SceneSystem::GetThreadCommandBuffer()
+{
+	if (tl_pxCommandBuffer == nullptr || tl_ulCommandBufferOwnerID != m_ulInstanceID)
+	{
+		Zenith_ECSCommandBuffer* pxBuffer = new Zenith_ECSCommandBuffer;
+		{
+			Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xThreadCommandBufferMutex);
+			m_axThreadCommandBuffers.PushBack(pxBuffer);
+		}
+		tl_pxCommandBuffer = pxBuffer;
+		tl_ulCommandBufferOwnerID = m_ulInstanceID;
+	}
+	return *tl_pxCommandBuffer;
+}
+
+void Zenith_SceneSystem::PlaybackCommandBuffers()
+{
+	Zenith_Assert(Zenith_ECS_IsMainThread(), "PlaybackCommandBuffers must be called from main thread");
+
+	// Only the list is locked; each buffer takes its own commands under its own
+	// lock, so workers keep recording while earlier commands are applied. A
+	// thread registering mid-playback is picked up at the next sync point.
+	u_int uNumBuffers = 0;
+	{
+		Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xThreadCommandBufferMutex);
+		uNumBuffers = m_axThreadCommandBuffers.GetSize();
+	}
+	for (u_int u = 0; u < uNumBuffers; ++u)
+	{
+		Zenith_ECSCommandBuffer* pxBuffer = nullptr;
+		{
+			Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xThreadCommandBufferMutex);
+			pxBuffer = m_axThreadCommandBuffers.Get(u);
+		}
+		pxBuffer->Playback();
+	}
+}
+
+void Zenith_SceneSystem::DiscardCommandBuffers()
+{
+	Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xThreadCommandBufferMutex);
+	for (u_int u = 0; u < m_axThreadCommandBuffers.GetSize(); ++u)
+	{
+		m_axThreadCommandBuffers.Get(u)->Discard();
+	}
+}
+
 //=============================================================================
 // Circular-load detection
 //=============================================================================
@@ -522,6 +600,10 @@ Zenith_EntityStore& Zenith_ECS_EntityStore() { return Zenith_SceneSystem::Get().
 // WS10: forwards the sparse-set query read toggle to Zenith_Query.h without the
 // header cycle (see Zenith_RenderTaskState.h for the rationale).
 bool Zenith_AreSparseQueryReadsEnabled() { return Zenith_SceneSystem::Get().AreSparseQueryReadsEnabled(); }
+bool Zenith_AreQueryGroupsEnabled() { return Zenith_SceneSystem::Get().AreQueryGroupsEnabled(); }
+
+// Component change-detection tick (see Zenith_RenderTaskState.h).
+u_int Zenith_ECS_ChangeTick() { return Zenith_SceneSystem::Get().GetChangeTick(); }
 
 // Main-thread predicate for the ECS-leaf thread-affinity asserts (Zenith_Query.h,
 // Zenith_EventSystem.h). Forwards to the installed ECS runtime hook; returns true
@@ -533,3 +615,24 @@ bool Zenith_ECS_IsMainThread()
 	const Zenith_ECSRuntimeHooks& xHooks = Zenith_SceneSystem::Get().GetRuntimeHooks();
 	return xHooks.m_pfnIsMainThread ? xHooks.m_pfnIsMainThread() : true;
 }
+
+// Parallel-query forwarders (Zenith_Query::ForEachParallel / ForEachConst); see
+// Zenith_RenderTaskState.h.
+Zenith_QueryAccessTracker& Zenith_ECS_QueryAccess() { return Zenith_SceneSystem::Get().m_xQueryAccess; }
+
+bool Zenith_ECS_IsParallelQueryActive() { return Zenith_ECS_QueryAccess().IsParallelQueryActive(); }
+
+void Zenith_ECS_RunParallelFor(void (*pfnRange)(void*, u_int, u_int), void* pData, u_int uCount, u_int uGrainSize)
+{
+	if (uCount == 0)
+	{
+		return;
+	}
+	const Zenith_ECSRuntimeHooks& xHooks = Zenith_SceneSystem::Get().GetRuntimeHooks();
+	if (xHooks.m_pfnRunParallelFor)
+	{
+		xHooks.m_pfnRunParallelFor(pfnRange, pData, uCount, uGrainSize);
+		return;
+	}
+	pfnRange(pData, 0, uCount);
+}
@@ -1,6 +1,7 @@
 #include "Zenith.h"
 
 #include "ZenithECS/Zenith_SceneSystem.h"
+#include "ZenithECS/Zenith_ECSCommandBuffer.h"
 
 //=============================================================================
 // Phase 2.1 (ECS leaf-extraction): process-wide singleton pointer + lifetime.
@@ -17,7 +18,14 @@
 //=============================================================================
 Zenith_SceneSystem* Zenith_SceneSystem::s_pxInstance = nullptr;
 
+namespace
+{
+	// Source of Zenith_SceneSystem::m_ulInstanceID. Starts at 1: 0 means "no owner".
+	std::atomic<u_int64> s_ulNextSceneSystemID{ 1 };
+}
+
 Zenith_SceneSystem::Zenith_SceneSystem()
+	: m_ulInstanceID(s_ulNextSceneSystemID.fetch_add(1, std::memory_order_relaxed))
 {
 	m_pxEntityStore = new Zenith_EntityStore();
 	s_pxInstance = this;
@@ -27,6 +35,11 @@ Zenith_SceneSystem::~Zenith_SceneSystem()
 {
 	delete m_pxEntityStore;
 	m_pxEntityStore = nullptr;
+	for (u_int u = 0; u < m_axThreadCommandBuffers.GetSize(); ++u)
+	{
+		delete m_axThreadCommandBuffers.Get(u);
+	}
+	m_axThreadCommandBuffers.Clear();
 	if (s_pxInstance == this)
 	{
 		s_pxInstance = nullptr;
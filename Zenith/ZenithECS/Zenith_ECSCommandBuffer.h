@@ -0,0 +1,200 @@
+#pragma once
+
+#include "Collections/Zenith_Vector.h"
+#include "ZenithECS/Zenith_SceneSystem.h"
+
+#include <cstring>
+#include <new>
+#include <string>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// Zenith_ECSCommandBuffer - recorded structural changes, played back later
+//------------------------------------------------------------------------------
+//
+// Structural changes (entity create/destroy, component add/remove) are only
+// legal on the main thread outside a parallel query. Code that wants to make
+// them from anywhere else - a task-system job, a ForEachParallel callback, a
+// system that should not invalidate the query it is walking - records them
+// here and has them applied at a sync point.
+//
+// Usage:
+//   // Any thread: the calling thread's own buffer, played back by
+//   // Zenith_SceneSystem::Update at its next sync point.
+//   Zenith_ECSCommandBuffer& xCmds = Scenes().GetThreadCommandBuffer();
+//   const Zenith_ECSCommandBuffer::PendingEntity xNew = xCmds.CreateEntity(xScene, "Spark");
+//   xCmds.AddComponent<Zenith_LightComponent>(xNew, [](Zenith_LightComponent& xLight) { xLight.SetIntensity(4.0f); });
+//   xCmds.RemoveComponent<Zenith_ColliderComponent>(xOtherID);
+//   xCmds.Destroy(xDeadID);
+//
+//   // Or an owned buffer, played back wherever its owner chooses (main thread).
+//   Zenith_ECSCommandBuffer xLocal;
+//   ...
+//   xLocal.Playback();
+//
+// Playback applies commands in record order. Commands naming an entity that
+// no longer exists, or a scene that has been unloaded, are skipped; AddComponent
+// of a type the entity already has and RemoveComponent of one it lacks are
+// no-ops, matching Zenith_QueryDeferredOps. Destroy is Zenith_Entity::Destroy,
+// so the entity itself goes at the end of the frame like any other Destroy.
+//
+// Recording is thread-safe per buffer (a short uncontended lock, since the main
+// thread may be taking the commands out at a sync point), but a buffer is meant
+// to have ONE recording thread: commands from different threads have no
+// defined relative order. Jobs that need a deterministic result record into one
+// owned buffer per job and play them back in job order.
+//
+// A PendingEntity is only meaningful to the buffer that returned it.
+//------------------------------------------------------------------------------
+class Zenith_ECSCommandBuffer
+{
+public:
+	// An entity this buffer will create at playback; later commands in the same
+	// buffer may target it before it exists.
+	struct PendingEntity
+	{
+		u_int m_uIndex = uINVALID_PENDING;
+		bool IsValid() const { return m_uIndex != uINVALID_PENDING; }
+	};
+
+	Zenith_ECSCommandBuffer() = default;
+	Zenith_ECSCommandBuffer(const Zenith_ECSCommandBuffer&) = delete;
+	Zenith_ECSCommandBuffer& operator=(const Zenith_ECSCommandBuffer&) = delete;
+
+	// Zenith_SceneSystem::CreateEntity(xScene, strName) at playback (default
+	// components included). Skipped if the scene has been unloaded by then, in
+	// which case every command targeting the pending entity is skipped too.
+	PendingEntity CreateEntity(Zenith_Scene xScene, const std::string& strName);
+
+	void Destroy(Zenith_EntityID xID);
+	void Destroy(PendingEntity xPending);
+
+	// Default-constructed AddComponent<T> at playback.
+	template<typename T>
+	void AddComponent(Zenith_EntityID xID)
+	{
+		Record(&ApplyAddComponent<T>, xID, uINVALID_PENDING, 0);
+	}
+	template<typename T>
+	void AddComponent(PendingEntity xPending)
+	{
+		Record(&ApplyAddComponent<T>, Zenith_EntityID(), xPending.m_uIndex, 0);
+	}
+
+	// AddComponent<T> followed by xInit(T&) at playback. xInit is copied into the
+	// buffer, so it must be trivially copyable (a lambda capturing values, not
+	// references to things that may be gone by playback). Not called if the
+	// entity already had a T.
+	template<typename T, typename Init>
+	void AddComponent(Zenith_EntityID xID, const Init& xInit)
+	{
+		RecordWithInit<T>(xID, uINVALID_PENDING, xInit);
+	}
+	template<typename T, typename Init>
+	void AddComponent(PendingEntity xPending, const Init& xInit)
+	{
+		RecordWithInit<T>(Zenith_EntityID(), xPending.m_uIndex, xInit);
+	}
+
+	template<typename T>
+	void RemoveComponent(Zenith_EntityID xID)
+	{
+		Record(&ApplyRemoveComponent<T>, xID, uINVALID_PENDING, 0);
+	}
+	template<typename T>
+	void RemoveComponent(PendingEntity xPending)
+	{
+		Record(&ApplyRemoveComponent<T>, Zenith_EntityID(), xPending.m_uIndex, 0);
+	}
+
+	// Main thread only, outside render tasks and parallel queries. Takes every
+	// command recorded so far and applies it; commands recorded while playback
+	// runs (e.g. from an OnAwake it triggers) stay for the next playback.
+	void Playback();
+
+	// Drop every recorded command without applying it.
+	void Discard();
+
+	u_int GetNumCommands() const;
+	bool IsEmpty() const { return GetNumCommands() == 0; }
+
+private:
+	static constexpr u_int uINVALID_PENDING = 0xFFFFFFFFu;
+
+	struct CreateRecord
+	{
+		Zenith_Scene m_xScene;
+		std::string m_strName;
+	};
+
+	// What one Playback() works from: the taken commands plus the entities the
+	// creates produced, indexed by PendingEntity::m_uIndex.
+	struct Recorded;
+
+	using ApplyFunc = void(*)(const Recorded& xRecorded, Zenith_Entity xEntity, u_int uPayload);
+
+	struct Command
+	{
+		ApplyFunc m_pfnApply;  // nullptr for a CreateEntity
+		Zenith_EntityID m_xEntityID;
+		u_int m_uPendingIndex;
+		u_int m_uPayload;  // word offset into m_xPayload (init functors), or the create index
+	};
+
+	struct Recorded
+	{
+		Zenith_Vector<Command> m_xCommands;
+		Zenith_Vector<CreateRecord> m_xCreates;
+		Zenith_Vector<u_int64> m_xPayload;
+		Zenith_Vector<Zenith_EntityID> m_xCreated;
+	};
+
+	void Record(ApplyFunc pfnApply, Zenith_EntityID xID, u_int uPendingIndex, u_int uPayload);
+
+	template<typename T, typename Init>
+	void RecordWithInit(Zenith_EntityID xID, u_int uPendingIndex, const Init& xInit)
+	{
+		static_assert(std::is_trivially_copyable_v<Init>, "Zenith_ECSCommandBuffer::AddComponent: the init functor is stored by copy and must be trivially copyable");
+		static_assert(alignof(Init) <= alignof(u_int64), "Zenith_ECSCommandBuffer::AddComponent: init functor is over-aligned");
+		static_assert(std::is_invocable_v<const Init&, T&>, "Zenith_ECSCommandBuffer::AddComponent: init functor must be callable as void(T&)");
+
+		constexpr u_int uWORDS = static_cast<u_int>((sizeof(Init) + sizeof(u_int64) - 1) / sizeof(u_int64));
+		Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(m_xMutex);
+		const u_int uOffset = m_xRecorded.m_xPayload.GetSize();
+		m_xRecorded.m_xPayload.Resize(uOffset + uWORDS, 0);
+		std::memcpy(m_xRecorded.m_xPayload.GetDataPointer() + uOffset, &xInit, sizeof(Init));
+		m_xRecorded.m_xCommands.PushBack({ &ApplyAddComponentInit<T, Init>, xID, uPendingIndex, uOffset });
+	}
+
+	static void ApplyDestroy(const Recorded& xRecorded, Zenith_Entity xEntity, u_int uPayload);
+
+	template<typename T>
+	static void ApplyAddComponent(const Recorded&, Zenith_Entity xEntity, u_int)
+	{
+		if (!xEntity.HasComponent<T>())
+		{
+			xEntity.AddComponent<T>();
+		}
+	}
+
+	template<typename T, typename Init>
+	static void ApplyAddComponentInit(const Recorded& xRecorded, Zenith_Entity xEntity, u_int uPayload)
+	{
+		if (xEntity.HasComponent<T>()) return;
+		T& xComponent = xEntity.AddComponent<T>();
+		const Init* pxInit = std::launder(reinterpret_cast<const Init*>(xRecorded.m_xPayload.GetDataPointer() + uPayload));
+		(*pxInit)(xComponent);
+	}
+
+	template<typename T>
+	static void ApplyRemoveComponent(const Recorded&, Zenith_Entity xEntity, u_int)
+	{
+		if (xEntity.HasComponent<T>())
+		{
+			xEntity.RemoveComponent<T>();
+		}
+	}
+
+	Recorded m_xRecorded;
+	mutable Zenith_Mutex_NoProfiling m_xMutex;
+};
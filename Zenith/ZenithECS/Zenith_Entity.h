@@ -155,6 +155,17 @@ public:
 	template<typename T>
 	void RemoveComponent();
 
+	// Change detection: record a write to this entity's T, so queries filtered
+	// with Changed<T>(uSinceTick) pick it up. GetComponent does not stamp (it
+	// serves reads as often as writes); call this where the component is
+	// actually modified. GetChangeTick returns the tick of the last recorded
+	// write, or 0 when the entity has no T. See Zenith_SceneSystem::GetChangeTick.
+	template<typename T>
+	void MarkChanged() const;
+
+	template<typename T>
+	u_int GetChangeTick() const;
+
 	//--------------------------------------------------------------------------
 	// Entity State Accessors (delegate to EntitySlot)
 	//--------------------------------------------------------------------------
@@ -25,6 +25,22 @@
 //       });
 //
 // The query iterates only over entities that have ALL specified component types.
+//
+// Changed<T>(uSinceTick) narrows a query to entities whose T was written after
+// uSinceTick (see Zenith_SceneSystem::GetChangeTick for the tick contract):
+//   pxSceneData->Query<const Transform>().Changed<Transform>(uLastSeen).ForEach(...)
+// The filter reads the pool's per-slot change ticks, so entities that did not
+// change cost a tick compare and their component data is never touched.
+//
+// A query over two or more types reads through its scene's cached query group
+// for that signature (Zenith_QueryGroup.h): a persistent, incrementally
+// maintained list of matching entities and their dense indices, created by the
+// first such query on the main thread. Single-type queries, the legacy path and
+// First/Any keep probing the pools.
+//
+// A query type may be const-qualified (Query<const ComponentA, ComponentB>): the
+// callback then receives a const reference, and ForEachParallel claims that type
+// for READ rather than WRITE (see Zenith_QueryAccess.h).
 //------------------------------------------------------------------------------
 
 // Per-thread scratch-pool machinery used by the ForEach/ForEach_Sparse snapshot
@@ -33,6 +49,14 @@
 // this public header see only Zenith_Query<Ts...>.
 #include "ZenithECS/Internal/Zenith_QueryScratch.h"
 
+// Deferred structural-change buffer handed to ForEachParallel / ForEachConst
+// callbacks, and the access-claim tracker those queries register with.
+#include "ZenithECS/Internal/Zenith_QueryDeferred.h"
+#include "ZenithECS/Internal/Zenith_QueryAccess.h"
+
+#include <type_traits>
+#include <utility>
+
 template<typename... Ts>
 class Zenith_Query
 {
@@ -51,6 +75,15 @@ public:
 		Zenith_Assert(Zenith_ECS_IsMainThread() || Zenith_AreRenderTasksActive(), "Query::ForEach must be called from main thread or during render task execution");
 		if (Zenith_AreSparseQueryReadsEnabled())
 		{
+			if constexpr (bGROUPABLE)
+			{
+				GroupBinding xBinding;
+				if (ResolveGroup(xBinding))
+				{
+					ForEach_Grouped(xBinding, fn);
+					return;
+				}
+			}
 			ForEach_Sparse(std::forward<Func>(fn));
 		}
 		else
@@ -59,6 +92,55 @@ public:
 		}
 	}
 
+	// ForEachParallel - ForEach split across the task system. The driver pool's
+	// dense owner range is cut into chunks of at least uGrainSize entities, and
+	// workers (plus the calling thread) run the callback on them concurrently.
+	// Callback signature: void(Zenith_EntityID, T1&, T2&, ...), or with a leading
+	// Zenith_QueryDeferredOps& to request structural changes — those are played
+	// back on the calling thread, in pool order, after every chunk has finished.
+	//
+	// The callback may write ONLY the components it is handed (const-qualified
+	// query types are read-only) and must not touch the ECS structurally. The
+	// query claims its access set before dispatching and asserts if that set
+	// conflicts with another parallel query already in flight. Visits the same
+	// entities as ForEach, in unspecified order.
+	//
+	// May be called from the main thread or from a task the main thread is
+	// waiting on (two systems scheduled side by side), so several parallel
+	// queries can be in flight at once; the access claims are what keep them
+	// apart. A callback that takes Zenith_QueryDeferredOps& needs the main
+	// thread, because playback makes structural changes.
+	template<typename Func>
+	void ForEachParallel(Func&& fn, u_int uGrainSize = uDEFAULT_PARALLEL_GRAIN_SIZE)
+	{
+		RunParallel<false>(fn, uGrainSize);
+	}
+
+	// ForEachConst - read-only ForEachParallel: every queried type is claimed for
+	// READ and the callback receives const references, so ForEachConst passes
+	// over the same types may run together from different threads. Same thread
+	// rules as ForEachParallel.
+	template<typename Func>
+	void ForEachConst(Func&& fn, u_int uGrainSize = uDEFAULT_PARALLEL_GRAIN_SIZE)
+	{
+		RunParallel<true>(fn, uGrainSize);
+	}
+
+	// Changed - keep only entities whose U (one of the queried types, const or
+	// not) was stamped after uSinceTick. Chains, so several types can be
+	// filtered at once (an entity must pass all of them). uSinceTick == 0 matches
+	// every entity. Applies to every read: ForEach / ForEachParallel /
+	// ForEachConst / Count / First / Any.
+	template<typename U>
+	Zenith_Query& Changed(u_int uSinceTick)
+	{
+		constexpr u_int uPosition = PositionOf<U>();
+		static_assert(uPosition < uNUM_TYPES, "Query::Changed<U>: U must be one of the query's component types");
+		m_auChangedSince[uPosition] = uSinceTick;
+		m_bHasChangeFilter = m_bHasChangeFilter || uSinceTick != 0;
+		return *this;
+	}
+
 	// Count - returns the number of entities matching the query
 	u_int Count()
 	{
@@ -88,7 +170,60 @@ public:
 		return First().IsValid();
 	}
 
+	static constexpr u_int uDEFAULT_PARALLEL_GRAIN_SIZE = 64;
+
 private:
+	// Pool / TypeID lookups always use the unqualified component type; const only
+	// changes what the callback is handed (and the declared access).
+	template<typename T>
+	using StorageType = std::remove_const_t<T>;
+
+	// Reference type handed to parallel callbacks: const under ForEachConst.
+	template<typename T, bool bConst>
+	using ParallelRef = std::conditional_t<bConst, const StorageType<T>&, T&>;
+
+	static constexpr u_int uNUM_TYPES = sizeof...(Ts);
+	static constexpr bool bGROUPABLE = uNUM_TYPES >= 2 && uNUM_TYPES <= Zenith_QueryGroup::uMAX_TYPES;
+
+	// Position of U in Ts..., ignoring const; uNUM_TYPES if absent.
+	template<typename U>
+	static constexpr u_int PositionOf()
+	{
+		constexpr bool abMatch[] = { std::is_same_v<StorageType<U>, StorageType<Ts>>... };
+		for (u_int u = 0; u < uNUM_TYPES; ++u)
+		{
+			if (abMatch[u]) return u;
+		}
+		return uNUM_TYPES;
+	}
+
+	//==========================================================================
+	// Change filter (Changed<U>). m_auChangedSince[i] is the since-tick for
+	// query position i, 0 = unfiltered. Checked after the entity is known to
+	// match, before any component is fetched.
+	//==========================================================================
+
+	template<typename T>
+	bool PassesChangeFilterFor(Zenith_EntityID xId, u_int uSinceTick) const
+	{
+		if (uSinceTick == 0) return true;
+		const Zenith_ComponentPool<StorageType<T>>* pxPool = m_pxSceneData->template TryGetComponentPool<StorageType<T>>();
+		if (pxPool == nullptr) return false;
+		const u_int uDense = pxPool->FindDense(xId);
+		return uDense != Zenith_ComponentPoolBase::uINVALID_DENSE && pxPool->GetChangeTick(uDense) > uSinceTick;
+	}
+
+	template<size_t... Is>
+	bool PassesChangeFilterImpl(Zenith_EntityID xId, std::index_sequence<Is...>) const
+	{
+		return (PassesChangeFilterFor<Ts>(xId, m_auChangedSince[Is]) && ...);
+	}
+
+	bool PassesChangeFilter(Zenith_EntityID xId) const
+	{
+		return !m_bHasChangeFilter || PassesChangeFilterImpl(xId, std::index_sequence_for<Ts...>{});
+	}
+
 	//==========================================================================
 	// LEGACY read path (toggle OFF) — byte-for-byte the pre-WS10 implementation.
 	//==========================================================================
@@ -120,9 +255,9 @@ private:
 			// Skip entities pending destruction (Unity-style)
 			if (m_pxSceneData->IsMarkedForDestruction(xEntityID)) continue;
 
-			if (HasAllComponents<Ts...>(xEntityID))
+			if (HasAllComponents<Ts...>(xEntityID) && PassesChangeFilter(xEntityID))
 			{
-				fn(xEntityID, m_pxSceneData->GetComponentFromEntity<Ts>(xEntityID)...);
+				fn(xEntityID, m_pxSceneData->template GetComponentFromEntity<StorageType<Ts>>(xEntityID)...);
 			}
 		}
 	}
@@ -136,7 +271,7 @@ private:
 			// Skip entities pending destruction
 			if (m_pxSceneData->IsMarkedForDestruction(xEntityID)) continue;
 
-			if (HasAllComponents<Ts...>(xEntityID))
+			if (HasAllComponents<Ts...>(xEntityID) && PassesChangeFilter(xEntityID))
 			{
 				return xEntityID;
 			}
@@ -147,8 +282,8 @@ private:
 	//==========================================================================
 	// SPARSE-SET read path (toggle ON) — WS10 keystone.
 	//
-	// Instead of scanning every active entity and probing the per-entity
-	// component map once per queried type (O(entities x types)), pick the
+	// Instead of scanning every active entity and probing each queried type's
+	// pool once per entity (O(entities x types)), pick the
 	// SMALLEST queried pool as the DRIVER and walk its dense owner array. For
 	// each driver owner, probe the OTHER pools' sparse index in O(1) and skip
 	// unless all are present. Result is O(min-pool-size x types).
@@ -181,7 +316,7 @@ private:
 			[&]
 			{
 				if (bAnyMissingOrEmpty) return; // short-circuit once known empty
-				Zenith_ComponentPool<Ts>* pxPool = m_pxSceneData->TryGetComponentPool<Ts>();
+				Zenith_ComponentPool<StorageType<Ts>>* pxPool = m_pxSceneData->template TryGetComponentPool<StorageType<Ts>>();
 				if (pxPool == nullptr || pxPool->GetSize() == 0u)
 				{
 					bAnyMissingOrEmpty = true;
@@ -208,11 +343,10 @@ private:
 	template<typename U>
 	bool ProbeComponent(Zenith_EntityID xId, Zenith_ComponentPool<U>* pxPool, u_int& uDenseOut) const
 	{
-		const u_int uDense = pxPool->GetSparseDense(xId.m_uIndex);
-		if (uDense == Zenith_ComponentPool<U>::uINVALID_DENSE) return false;
-		// Round-trip the full EntityID (index AND generation) to reject a stale
-		// sparse entry left by a recycled slot.
-		if (pxPool->m_xOwningEntities.Get(uDense) != xId) return false;
+		// FindDense round-trips the full EntityID (index AND generation) to reject
+		// a stale sparse entry left by a recycled slot.
+		const u_int uDense = pxPool->FindDense(xId);
+		if (uDense == Zenith_ComponentPoolBase::uINVALID_DENSE) return false;
 		uDenseOut = uDense;
 		return true;
 	}
@@ -242,6 +376,7 @@ private:
 			// destroyed-during-iteration and pending-destruction are skipped.
 			if (!m_pxSceneData->EntityExists(xEntityID)) continue;
 			if (m_pxSceneData->IsMarkedForDestruction(xEntityID)) continue;
+			if (!PassesChangeFilter(xEntityID)) continue;
 
 			// Probe + dispatch. AllPresentInvoke re-resolves EVERY dense index
 			// (driver included) inside this loop body and never caches across fn.
@@ -262,7 +397,7 @@ private:
 
 			if (m_pxSceneData->IsMarkedForDestruction(xEntityID)) continue;
 
-			if (HasAllComponentsSparse(xEntityID))
+			if (HasAllComponentsSparse(xEntityID) && PassesChangeFilter(xEntityID))
 			{
 				return xEntityID;
 			}
@@ -284,10 +419,10 @@ private:
 			[&]
 			{
 				if (!bAll) return;
-				Zenith_ComponentPool<Ts>* pxPool = m_pxSceneData->TryGetComponentPool<Ts>();
+				Zenith_ComponentPool<StorageType<Ts>>* pxPool = m_pxSceneData->template TryGetComponentPool<StorageType<Ts>>();
 				if (pxPool == nullptr) { bAll = false; return; }
 				u_int uDense = 0;
-				if (!ProbeComponent<Ts>(xId, pxPool, uDense)) { bAll = false; }
+				if (!ProbeComponent<StorageType<Ts>>(xId, pxPool, uDense)) { bAll = false; }
 			}(),
 			...
 		);
@@ -310,10 +445,10 @@ private:
 			[&]
 			{
 				if (!bAll) return;
-				Zenith_ComponentPool<Ts>* pxPool = m_pxSceneData->TryGetComponentPool<Ts>();
+				Zenith_ComponentPool<StorageType<Ts>>* pxPool = m_pxSceneData->template TryGetComponentPool<StorageType<Ts>>();
 				if (pxPool == nullptr) { bAll = false; return; }
 				u_int uDense = 0;
-				if (!ProbeComponent<Ts>(xId, pxPool, uDense)) { bAll = false; }
+				if (!ProbeComponent<StorageType<Ts>>(xId, pxPool, uDense)) { bAll = false; }
 			}(),
 			...
 		);
@@ -333,20 +468,306 @@ private:
 	template<typename T>
 	T& FetchComponentRef(Zenith_EntityID xId)
 	{
-		Zenith_ComponentPool<T>* pxPool = m_pxSceneData->TryGetComponentPool<T>();
+		Zenith_ComponentPool<StorageType<T>>* pxPool = m_pxSceneData->template TryGetComponentPool<StorageType<T>>();
 		const u_int uDense = pxPool->GetSparseDense(xId.m_uIndex);
 		return pxPool->Get(uDense);
 	}
 
 	// Helper to check if entity has all component types using fold expression
-	// (LEGACY path only — reads the per-entity component map via EntityHasComponent).
+	// (LEGACY path only — one EntityHasComponent pool probe per type).
 	template<typename... Us>
 	bool HasAllComponents(Zenith_EntityID xEntityID)
 	{
-		return (m_pxSceneData->EntityHasComponent<Us>(xEntityID) && ...);
+		return (m_pxSceneData->template EntityHasComponent<StorageType<Us>>(xEntityID) && ...);
+	}
+
+	//==========================================================================
+	// GROUPED read path — multi-type queries with a cached query group.
+	//
+	// The group's rows already hold every queried type's dense index, so a visit
+	// is a row read plus one pool Get per type. Rows only move when a component
+	// is removed (the registry bumps its layout version); adds append past the
+	// rows being walked. So the walk trusts the rows until the version changes,
+	// then finishes from its snapshot with the sparse path's re-probe.
+	//==========================================================================
+
+	// The group a call reads through, plus per query position the group column
+	// holding that type's dense index and the type's pool.
+	struct GroupBinding
+	{
+		Zenith_QueryGroup* m_pxGroup = nullptr;
+		u_int m_auColumns[uNUM_TYPES] = {};
+		Zenith_ComponentPoolBase* m_apxPools[uNUM_TYPES] = {};
+	};
+
+	// Bind this query's signature to its group. A main-thread caller with no
+	// concurrent readers (render tasks, parallel query) creates the group on
+	// first use; anyone else only reuses an existing one. Returns false when the
+	// query should take the sparse path instead: groups disabled, a repeated
+	// type, or a queried pool that does not exist yet.
+	bool ResolveGroup(GroupBinding& xBindingOut)
+	{
+		if (!Zenith_AreQueryGroupsEnabled()) return false;
+
+		const u_int auTypeIDs[] = { Zenith_SceneData::TypeIDGenerator::GetTypeID<StorageType<Ts>>()... };
+		u_int auSorted[uNUM_TYPES];
+		for (u_int u = 0; u < uNUM_TYPES; ++u)
+		{
+			u_int uInsert = u;
+			while (uInsert > 0 && auSorted[uInsert - 1] > auTypeIDs[u])
+			{
+				auSorted[uInsert] = auSorted[uInsert - 1];
+				--uInsert;
+			}
+			auSorted[uInsert] = auTypeIDs[u];
+		}
+		for (u_int u = 1; u < uNUM_TYPES; ++u)
+		{
+			if (auSorted[u] == auSorted[u - 1]) return false;
+		}
+
+		Zenith_QueryGroupRegistry& xRegistry = m_pxSceneData->m_xQueryGroups;
+		const bool bMayCreate = Zenith_ECS_IsMainThread() && !Zenith_AreRenderTasksActive() && !Zenith_ECS_IsParallelQueryActive();
+		Zenith_QueryGroup* pxGroup = bMayCreate
+			? xRegistry.FindOrCreate(auSorted, uNUM_TYPES, m_pxSceneData->m_xComponents)
+			: xRegistry.Find(auSorted, uNUM_TYPES);
+		if (pxGroup == nullptr) return false;
+
+		// A live group implies every one of its pools exists (both go away
+		// together in DestroyComponentPools).
+		for (u_int u = 0; u < uNUM_TYPES; ++u)
+		{
+			xBindingOut.m_auColumns[u] = pxGroup->FindColumn(auTypeIDs[u]);
+			xBindingOut.m_apxPools[u] = m_pxSceneData->m_xComponents.Get(auTypeIDs[u]);
+		}
+		xBindingOut.m_pxGroup = pxGroup;
+		return true;
+	}
+
+	// Component for query position uPos of a group row.
+	template<typename T>
+	static T& GroupedRef(const GroupBinding& xBinding, const u_int* puRow, u_int uPos)
+	{
+		Zenith_ComponentPool<StorageType<T>>* pxPool = static_cast<Zenith_ComponentPool<StorageType<T>>*>(xBinding.m_apxPools[uPos]);
+		return pxPool->Get(puRow[xBinding.m_auColumns[uPos]]);
+	}
+
+	// Change filter against a group row: the dense indices are already there.
+	bool GroupRowPassesChangeFilter(const GroupBinding& xBinding, u_int uMember) const
+	{
+		if (!m_bHasChangeFilter) return true;
+		const u_int* puRow = xBinding.m_pxGroup->GetDenseRow(uMember);
+		for (u_int u = 0; u < uNUM_TYPES; ++u)
+		{
+			if (m_auChangedSince[u] != 0 && xBinding.m_apxPools[u]->GetChangeTick(puRow[xBinding.m_auColumns[u]]) <= m_auChangedSince[u])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename Func, size_t... Is>
+	static void InvokeGrouped(Func& fn, const GroupBinding& xBinding, u_int uMember, std::index_sequence<Is...>)
+	{
+		const u_int* puRow = xBinding.m_pxGroup->GetDenseRow(uMember);
+		fn(xBinding.m_pxGroup->GetMember(uMember), GroupedRef<Ts>(xBinding, puRow, Is)...);
+	}
+
+	template<typename Func>
+	void ForEach_Grouped(const GroupBinding& xBinding, Func& fn)
+	{
+		const Zenith_QueryGroupRegistry& xRegistry = m_pxSceneData->m_xQueryGroups;
+
+		// Snapshot the members for the fallback half of the walk; while the
+		// layout version holds, snapshot index u IS group row u.
+		Zenith_QueryScratchCheckout xCheckout(Zenith_GetQueryScratchPool());
+		Zenith_Vector<Zenith_EntityID>& xSnapshot = xCheckout.Buffer();
+		xSnapshot.Reserve(xBinding.m_pxGroup->GetNumMembers());
+		for (u_int u = 0; u < xBinding.m_pxGroup->GetNumMembers(); ++u)
+		{
+			xSnapshot.PushBack(xBinding.m_pxGroup->GetMember(u));
+		}
+
+		const u_int uLayoutVersion = xRegistry.GetLayoutVersion();
+		for (u_int u = 0; u < xSnapshot.GetSize(); ++u)
+		{
+			Zenith_EntityID xEntityID = xSnapshot.Get(u);
+
+			if (xRegistry.GetLayoutVersion() == uLayoutVersion)
+			{
+				// Row u is untouched, so its entity still exists: destroying it
+				// would have removed its components and bumped the version.
+				if (m_pxSceneData->IsMarkedForDestruction(xEntityID)) continue;
+				if (!GroupRowPassesChangeFilter(xBinding, u)) continue;
+				InvokeGrouped(fn, xBinding, u, std::index_sequence_for<Ts...>{});
+			}
+			else
+			{
+				// Same skip semantics and re-probe as ForEach_Sparse.
+				if (!m_pxSceneData->EntityExists(xEntityID)) continue;
+				if (m_pxSceneData->IsMarkedForDestruction(xEntityID)) continue;
+				if (!PassesChangeFilter(xEntityID)) continue;
+				AllPresentInvoke(xEntityID, fn);
+			}
+		}
+	}
+
+	//==========================================================================
+	// PARALLEL path (ForEachParallel / ForEachConst).
+	//
+	// Walks the query group's rows when there is one, otherwise the driver pool
+	// (the legacy path scans the scene's active entity list, which is
+	// main-thread state). No snapshot: while the query is in flight, structural changes
+	// assert (see Zenith_QueryAccess.h) and the calling thread is busy running
+	// chunks, so the driver pool's owner array cannot move underneath the
+	// workers. Chunks index straight into it.
+	//==========================================================================
+
+	template<typename Func>
+	struct ParallelContext
+	{
+		Zenith_Query* m_pxQuery;
+		Func* m_pfnCallback;
+		const Zenith_Vector<Zenith_EntityID>* m_pxDriverOwners;
+		GroupBinding m_xGroup;
+		Zenith_QueryDeferredOps m_xDeferred;
+		Zenith_Mutex_NoProfiling m_xDeferredMutex;
+	};
+
+	template<bool bConst>
+	static constexpr bool IsWriteAccess(bool bTypeIsConst)
+	{
+		return !bConst && !bTypeIsConst;
+	}
+
+	// Claim every queried type. On a conflict, roll back the claims already made
+	// and return false.
+	template<bool bConst>
+	bool AcquireAccess(Zenith_QueryAccessTracker& xTracker)
+	{
+		const u_int auTypeIDs[] = { Zenith_SceneData::TypeIDGenerator::GetTypeID<StorageType<Ts>>()... };
+		const bool abWrite[] = { IsWriteAccess<bConst>(std::is_const_v<Ts>)... };
+		constexpr u_int uNumTypes = sizeof...(Ts);
+		for (u_int u = 0; u < uNumTypes; ++u)
+		{
+			if (!xTracker.TryAcquire(auTypeIDs[u], abWrite[u]))
+			{
+				Zenith_Assert(false, "Query::ForEachParallel: component type %u is already claimed by a parallel query in flight (%s access conflicts)",
+					auTypeIDs[u], abWrite[u] ? "write" : "read");
+				for (u_int uUndo = 0; uUndo < u; ++uUndo)
+				{
+					xTracker.Release(auTypeIDs[uUndo], abWrite[uUndo]);
+				}
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<bool bConst>
+	void ReleaseAccess(Zenith_QueryAccessTracker& xTracker)
+	{
+		(xTracker.Release(Zenith_SceneData::TypeIDGenerator::GetTypeID<StorageType<Ts>>(), IsWriteAccess<bConst>(std::is_const_v<Ts>)), ...);
+	}
+
+	template<bool bConst, typename Func>
+	void RunParallel(Func& fn, u_int uGrainSize)
+	{
+		constexpr bool bTAKES_DEFERRED = std::is_invocable_v<Func&, Zenith_QueryDeferredOps&, Zenith_EntityID, ParallelRef<Ts, bConst>...>;
+		Zenith_Assert(!bTAKES_DEFERRED || Zenith_ECS_IsMainThread(), "Query::ForEachParallel: a callback taking Zenith_QueryDeferredOps must run from the main thread");
+
+		const Zenith_Vector<Zenith_EntityID>* pxDriverOwners = PickDriverOwners();
+		if (pxDriverOwners == nullptr) return; // some queried pool missing/empty
+
+		Zenith_QueryAccessTracker& xTracker = Zenith_ECS_QueryAccess();
+		if (!AcquireAccess<bConst>(xTracker)) return;
+
+		ParallelContext<Func> xContext{ this, &fn, pxDriverOwners, {}, {}, {} };
+		u_int uCount = pxDriverOwners->GetSize();
+		if constexpr (bGROUPABLE)
+		{
+			if (ResolveGroup(xContext.m_xGroup))
+			{
+				uCount = xContext.m_xGroup.m_pxGroup->GetNumMembers();
+			}
+		}
+
+		xTracker.BeginParallelQuery();
+		Zenith_ECS_RunParallelFor(&RunParallelRange<bConst, Func>, &xContext, uCount, uGrainSize);
+		xTracker.EndParallelQuery();
+		ReleaseAccess<bConst>(xTracker);
+
+		if (xContext.m_xDeferred.GetNumOps() > 0)
+		{
+			xContext.m_xDeferred.Playback(*m_pxSceneData);
+		}
+	}
+
+	// Hand one matched entity to a parallel callback, with the deferred buffer
+	// when the callback asks for it. uOrder is the entity's driver/group index,
+	// which orders its deferred ops at playback.
+	template<bool bConst, typename Func>
+	static void InvokeParallel(Func& xCallback, Zenith_QueryDeferredOps& xDeferred, u_int uOrder, Zenith_EntityID xEntityID, ParallelRef<Ts, bConst>... xComponents)
+	{
+		if constexpr (std::is_invocable_v<Func&, Zenith_QueryDeferredOps&, Zenith_EntityID, ParallelRef<Ts, bConst>...>)
+		{
+			xDeferred.SetCurrentOrder(uOrder);
+			xCallback(xDeferred, xEntityID, xComponents...);
+		}
+		else
+		{
+			xCallback(xEntityID, xComponents...);
+		}
+	}
+
+	template<bool bConst, typename Func, size_t... Is>
+	static void InvokeParallelGrouped(Func& xCallback, Zenith_QueryDeferredOps& xDeferred, const GroupBinding& xBinding, u_int uMember, Zenith_EntityID xEntityID, std::index_sequence<Is...>)
+	{
+		const u_int* puRow = xBinding.m_pxGroup->GetDenseRow(uMember);
+		InvokeParallel<bConst>(xCallback, xDeferred, uMember, xEntityID, GroupedRef<Ts>(xBinding, puRow, Is)...);
+	}
+
+	// One chunk [uBegin, uEnd) of the group rows or driver pool, on whichever
+	// thread claimed it. Same skip semantics as ForEach_Sparse.
+	template<bool bConst, typename Func>
+	static void RunParallelRange(void* pData, u_int uBegin, u_int uEnd)
+	{
+		ParallelContext<Func>* pxContext = static_cast<ParallelContext<Func>*>(pData);
+		Zenith_Query* pxQuery = pxContext->m_pxQuery;
+		Zenith_SceneData* pxSceneData = pxQuery->m_pxSceneData;
+		const Zenith_QueryGroup* pxGroup = pxContext->m_xGroup.m_pxGroup;
+		Func& xCallback = *pxContext->m_pfnCallback;
+		Zenith_QueryDeferredOps xLocalDeferred;
+
+		for (u_int u = uBegin; u < uEnd; ++u)
+		{
+			const Zenith_EntityID xEntityID = pxGroup ? pxGroup->GetMember(u) : pxContext->m_pxDriverOwners->Get(u);
+			if (!pxSceneData->EntityExists(xEntityID)) continue;
+			if (pxSceneData->IsMarkedForDestruction(xEntityID)) continue;
+
+			if (pxGroup)
+			{
+				if (!pxQuery->GroupRowPassesChangeFilter(pxContext->m_xGroup, u)) continue;
+				InvokeParallelGrouped<bConst>(xCallback, xLocalDeferred, pxContext->m_xGroup, u, xEntityID, std::index_sequence_for<Ts...>{});
+				continue;
+			}
+
+			if (!pxQuery->HasAllComponentsSparse(xEntityID)) continue;
+			if (!pxQuery->PassesChangeFilter(xEntityID)) continue;
+			InvokeParallel<bConst>(xCallback, xLocalDeferred, u, xEntityID, pxQuery->template FetchComponentRef<Ts>(xEntityID)...);
+		}
+
+		if (xLocalDeferred.GetNumOps() > 0)
+		{
+			Zenith_ScopedMutexLock_T<Zenith_Mutex_NoProfiling> xLock(pxContext->m_xDeferredMutex);
+			pxContext->m_xDeferred.AppendFrom(xLocalDeferred);
+		}
 	}
 
 	Zenith_SceneData* m_pxSceneData;
+	u_int m_auChangedSince[uNUM_TYPES] = {};
+	bool m_bHasChangeFilter = false;
 };
 
 //------------------------------------------------------------------------------
@@ -358,3 +779,36 @@ Zenith_Query<Ts...> Zenith_SceneData::Query()
 {
 	return Zenith_Query<Ts...>(*this);
 }
+
+//------------------------------------------------------------------------------
+// Zenith_QueryDeferredOps playback bodies (need Zenith_Entity's templates, which
+// Zenith_SceneData.h pulls in via Zenith_Entity.inl)
+//------------------------------------------------------------------------------
+
+inline void Zenith_QueryDeferredOps::ApplyDestroy(Zenith_SceneData& xSceneData, Zenith_EntityID xID)
+{
+	if (!xSceneData.EntityExists(xID)) return;
+	Zenith_Entity(&xSceneData, xID).Destroy();
+}
+
+template<typename T>
+void Zenith_QueryDeferredOps::ApplyAddComponent(Zenith_SceneData& xSceneData, Zenith_EntityID xID)
+{
+	if (!xSceneData.EntityExists(xID)) return;
+	Zenith_Entity xEntity(&xSceneData, xID);
+	if (!xEntity.HasComponent<T>())
+	{
+		xEntity.AddComponent<T>();
+	}
+}
+
+template<typename T>
+void Zenith_QueryDeferredOps::ApplyRemoveComponent(Zenith_SceneData& xSceneData, Zenith_EntityID xID)
+{
+	if (!xSceneData.EntityExists(xID)) return;
+	Zenith_Entity xEntity(&xSceneData, xID);
+	if (xEntity.HasComponent<T>())
+	{
+		xEntity.RemoveComponent<T>();
+	}
+}
@@ -31,6 +31,10 @@ class Zenith_SceneData;
 // placement-new guard and is fully self-contained.
 #include "ZenithECS/Internal/Zenith_ComponentPool.h"
 
+// Cached multi-type query groups, kept in step with the pools by the component
+// mutators below (CreateComponent / RemoveComponentFromEntity / TransferComponent).
+#include "ZenithECS/Internal/Zenith_QueryGroup.h"
+
 // Leaf free-function forwarder Zenith_AreRenderTasksActive() (forwards to the
 // SceneSystem's render-tasks-active flag). Used in SceneData.h's template
 // assertion bodies so we don't have to drag the full SceneSystem.h include in
@@ -205,12 +209,20 @@ public:
 
 private:
 	// Private shared-lookup primitive — the SINGLE component-fetch implementation
-	// (TypeID -> per-entity map -> pool). The public component getter is
+	// (TypeID -> pool -> sparse index -> dense slot). The public component getter is
 	// Zenith_Entity::GetComponent<T>(), which (with TryGetComponent) forwards here;
 	// the Query hot path (a friend) also calls it directly to avoid a per-entity
 	// scene re-resolution. NOT part of the public API.
 	template<typename T>
 	T& GetComponentFromEntity(Zenith_EntityID xID) const;
+
+	// Change-detection stamp / read for xID's T (Zenith_Entity::MarkChanged /
+	// GetChangeTick forward here). Both are soft: an entity without a T is not
+	// stamped and reads tick 0.
+	template<typename T>
+	void MarkComponentChanged(Zenith_EntityID xID);
+	template<typename T>
+	u_int GetComponentChangeTick(Zenith_EntityID xID) const;
 public:
 
 	template<typename... Ts>
@@ -639,6 +651,10 @@ private:
 	// Internal Helpers
 	//==========================================================================
 
+	// True if any of this scene's component pools holds a component owned by xID.
+	// Type-erased walk over every pool's sparse index; debug/assert use only.
+	bool EntityOwnsAnyComponent(Zenith_EntityID xID) const;
+
 	// Collect entity and all descendants depth-first (children before parent)
 	void CollectHierarchyDepthFirst(Zenith_EntityID xID, Zenith_Vector<Zenith_EntityID>& axOut);
 
@@ -650,7 +666,7 @@ private:
 	// Builds the destruction-order hierarchy: roots first (via depth-first expansion),
 	// then any active entities the walk missed (no-transform or detached).
 	void CollectResetHierarchy(Zenith_Vector<Zenith_EntityID>& axHierarchyOut);
-	// Deletes pool objects and clears the pool registry.
+	// Deletes the query groups and pool objects and clears the pool registry.
 	void DestroyComponentPools();
 	// Releases global entity slots allocated to this scene back to the free list.
 	void FreeGlobalSlotsForActiveEntities();
@@ -742,6 +758,10 @@ private:
 
 	// Component pools (per-scene)
 	Zenith_Vector<Zenith_ComponentPoolBase*> m_xComponents;
+
+	// Cached multi-type query groups over m_xComponents (see Zenith_QueryGroup.h).
+	// Destroyed with the pools.
+	Zenith_QueryGroupRegistry m_xQueryGroups;
 };
 
 // Structural note: the SceneData.h ↔ scene-system-header textual cycle was
@@ -764,16 +784,20 @@ template<typename T, typename... Args>
 T& Zenith_SceneData::CreateComponent(Zenith_EntityID xID, Args&&... args)
 {
 	Zenith_Assert(Zenith_ECS_IsMainThread(), "CreateComponent must be called from main thread");
+	Zenith_Assert(!Zenith_ECS_IsParallelQueryActive(), "CreateComponent during a parallel query - record it on the callback's Zenith_QueryDeferredOps instead");
 	Zenith_Assert(EntityExists(xID), "CreateComponent: Entity (idx=%u, gen=%u) does not exist", xID.m_uIndex, xID.m_uGeneration);
 
 	Zenith_ComponentPool<T>* pxPool = GetOrCreateComponentPool<T>();
-	const TypeID uTypeID = TypeIDGenerator::GetTypeID<T>();
 
 	// Dense pool: always append at the end. Removal (RemoveComponentFromEntity)
 	// keeps the pool contiguous via swap-and-pop, so there are no holes to reuse.
+	// EmplaceBack also points the pool's sparse index at the new slot.
 	const u_int uComponentIndex = pxPool->EmplaceBack(xID, std::forward<Args>(args)...);
+	if (m_xQueryGroups.GetNumGroups() > 0)
+	{
+		m_xQueryGroups.OnComponentAdded(xID, TypeIDGenerator::GetTypeID<T>(), uComponentIndex, m_xComponents);
+	}
 
-	Zenith_ECS_EntityStore().m_axEntityComponents.Get(xID.m_uIndex)[uTypeID] = uComponentIndex;
 	MarkDirty();
 	return pxPool->Get(uComponentIndex);
 }
@@ -781,42 +805,60 @@ T& Zenith_SceneData::CreateComponent(Zenith_EntityID xID, Args&&... args)
 template<typename T>
 bool Zenith_SceneData::EntityHasComponent(Zenith_EntityID xID) const
 {
-	Zenith_Assert(Zenith_ECS_IsMainThread() || Zenith_AreRenderTasksActive(),
+	Zenith_Assert(Zenith_ECS_IsMainThread() || Zenith_AreRenderTasksActive() || Zenith_ECS_IsParallelQueryActive(),
 		"EntityHasComponent must be called from main thread");
 	if (!EntityExists(xID)) return false;
-	const TypeID uTypeID = TypeIDGenerator::GetTypeID<T>();
-	const auto& xMap = Zenith_ECS_EntityStore().m_axEntityComponents.Get(xID.m_uIndex);
-	return xMap.Contains(uTypeID);
+	const Zenith_ComponentPool<T>* pxPool = TryGetComponentPool<T>();
+	return pxPool != nullptr && pxPool->FindDense(xID) != Zenith_ComponentPoolBase::uINVALID_DENSE;
 }
 
 template<typename T>
 T& Zenith_SceneData::GetComponentFromEntity(Zenith_EntityID xID) const
 {
-	Zenith_Assert(Zenith_ECS_IsMainThread() || Zenith_AreRenderTasksActive(),
+	Zenith_Assert(Zenith_ECS_IsMainThread() || Zenith_AreRenderTasksActive() || Zenith_ECS_IsParallelQueryActive(),
 		"GetComponentFromEntity must be called from main thread");
 	Zenith_Assert(EntityExists(xID), "GetComponentFromEntity: Entity (idx=%u, gen=%u) does not exist", xID.m_uIndex, xID.m_uGeneration);
 
-	const TypeID uTypeID = TypeIDGenerator::GetTypeID<T>();
-	const auto& xMap = Zenith_ECS_EntityStore().m_axEntityComponents.Get(xID.m_uIndex);
-	const u_int* puIndex = xMap.TryGet(uTypeID);
-	Zenith_Assert(puIndex != nullptr, "GetComponentFromEntity: Entity does not have component");
-	const u_int uIndex = *puIndex;
-	return GetComponentPool<T>()->Get(uIndex);
+	Zenith_ComponentPool<T>* pxPool = TryGetComponentPool<T>();
+	Zenith_Assert(pxPool != nullptr, "GetComponentFromEntity: Entity does not have component");
+	const u_int uIndex = pxPool->FindDense(xID);
+	Zenith_Assert(uIndex != Zenith_ComponentPoolBase::uINVALID_DENSE, "GetComponentFromEntity: Entity does not have component");
+	return pxPool->Get(uIndex);
+}
+
+template<typename T>
+void Zenith_SceneData::MarkComponentChanged(Zenith_EntityID xID)
+{
+	// A parallel-query callback may stamp the entity it was handed; each
+	// entity is visited by exactly one worker, so the slot writes never overlap.
+	Zenith_Assert(Zenith_ECS_IsMainThread() || Zenith_ECS_IsParallelQueryActive(), "MarkComponentChanged must be called from main thread or a parallel query callback");
+	Zenith_ComponentPool<T>* pxPool = TryGetComponentPool<T>();
+	if (pxPool == nullptr) return;
+	const u_int uIndex = pxPool->FindDense(xID);
+	if (uIndex == Zenith_ComponentPoolBase::uINVALID_DENSE) return;
+	pxPool->MarkChanged(uIndex, Zenith_ECS_ChangeTick());
+}
+
+template<typename T>
+u_int Zenith_SceneData::GetComponentChangeTick(Zenith_EntityID xID) const
+{
+	const Zenith_ComponentPool<T>* pxPool = TryGetComponentPool<T>();
+	if (pxPool == nullptr) return 0;
+	const u_int uIndex = pxPool->FindDense(xID);
+	return (uIndex != Zenith_ComponentPoolBase::uINVALID_DENSE) ? pxPool->GetChangeTick(uIndex) : 0;
 }
 
 template<typename T>
 bool Zenith_SceneData::RemoveComponentFromEntity(Zenith_EntityID xID)
 {
 	Zenith_Assert(Zenith_ECS_IsMainThread(), "RemoveComponentFromEntity must be called from main thread");
+	Zenith_Assert(!Zenith_ECS_IsParallelQueryActive(), "RemoveComponentFromEntity during a parallel query - record it on the callback's Zenith_QueryDeferredOps instead");
 	if (!EntityExists(xID)) return false;
 
-	const TypeID uTypeID = TypeIDGenerator::GetTypeID<T>();
-	auto& xMap = Zenith_ECS_EntityStore().m_axEntityComponents.Get(xID.m_uIndex);
-	const u_int* puComponentIndex = xMap.TryGet(uTypeID);
-	if (puComponentIndex == nullptr) return false;
-
-	u_int uComponentIndex = *puComponentIndex;
-	Zenith_ComponentPool<T>* pxPool = GetOrCreateComponentPool<T>();
+	Zenith_ComponentPool<T>* pxPool = TryGetComponentPool<T>();
+	if (pxPool == nullptr) return false;
+	const u_int uComponentIndex = pxPool->FindDense(xID);
+	if (uComponentIndex == Zenith_ComponentPoolBase::uINVALID_DENSE) return false;
 
 	// Call OnRemove lifecycle if the component type has it (C++20 requires clause)
 	if constexpr (requires(T& t) { t.OnRemove(); })
@@ -825,19 +867,11 @@ bool Zenith_SceneData::RemoveComponentFromEntity(Zenith_EntityID xID)
 	}
 
 	// Real swap-and-pop: destruct this slot and, unless it was the last one,
-	// move the last live element into it. RemoveAtSwapAndPop returns the owner
-	// of the moved element so we can repoint its stored component index.
+	// move the last live element into it. The pool clears the removed entity's
+	// sparse entry and repoints the moved element's owner itself. The query
+	// groups drop xID and follow the moved element to its new dense slot.
 	const Zenith_EntityID xMovedOwner = pxPool->RemoveAtSwapAndPop(uComponentIndex);
-
-	// Erase the removed entity's entry BEFORE repointing the moved owner — the
-	// moved owner may be a different entity, and (in the last-element case) is
-	// INVALID_ENTITY_ID, so its branch is skipped.
-	xMap.Remove(uTypeID);
-
-	if (xMovedOwner.IsValid() && xMovedOwner != xID)
-	{
-		Zenith_ECS_EntityStore().m_axEntityComponents.Get(xMovedOwner.m_uIndex)[uTypeID] = uComponentIndex;
-	}
+	m_xQueryGroups.OnComponentRemoved(xID, TypeIDGenerator::GetTypeID<T>(), xMovedOwner, uComponentIndex);
 
 	MarkDirty();
 	return true;
@@ -873,31 +907,31 @@ void Zenith_SceneData::AppendAllOfComponentType(Zenith_Vector<T*>& xOut) const
 template<typename T>
 void Zenith_SceneData::TransferComponent(Zenith_EntityID xEntityID, Zenith_SceneData* pxSource, Zenith_SceneData* pxTarget)
 {
-	const TypeID uTypeID = TypeIDGenerator::GetTypeID<T>();
-	auto& xMap = Zenith_ECS_EntityStore().m_axEntityComponents.Get(xEntityID.m_uIndex);
-	const u_int* puSourcePoolIndex = xMap.TryGet(uTypeID);
-	if (puSourcePoolIndex == nullptr) return;
-
-	u_int uSourcePoolIndex = *puSourcePoolIndex;
+	Zenith_ComponentPool<T>* pxSourcePool = pxSource->TryGetComponentPool<T>();
+	if (pxSourcePool == nullptr) return;
+	const u_int uSourcePoolIndex = pxSourcePool->FindDense(xEntityID);
+	if (uSourcePoolIndex == Zenith_ComponentPoolBase::uINVALID_DENSE) return;
 
-	Zenith_ComponentPool<T>* pxSourcePool = pxSource->GetComponentPool<T>();
 	Zenith_ComponentPool<T>* pxTargetPool = pxTarget->GetOrCreateComponentPool<T>();
 
-	// Move the component into the target pool (appended at its end).
+	// Move the component into the target pool (appended at its end; the target
+	// pool's sparse index now points the entity there).
 	T& xSourceComponent = pxSourcePool->Get(uSourcePoolIndex);
-	u_int uNewPoolIndex = pxTargetPool->MoveEmplaceBack(xEntityID, std::move(xSourceComponent));
+	const u_int uTargetPoolIndex = pxTargetPool->MoveEmplaceBack(xEntityID, std::move(xSourceComponent));
 
 	// Remove the (now moved-from) source slot with a real swap-and-pop so the
-	// SOURCE pool stays dense. If a different entity's component was moved into
-	// uSourcePoolIndex to fill the gap, repoint THAT entity's stored index.
+	// SOURCE pool stays dense; it clears the entity's source sparse entry and
+	// repoints whichever entity's component was moved into the gap.
 	const Zenith_EntityID xMovedOwner = pxSourcePool->RemoveAtSwapAndPop(uSourcePoolIndex);
-	if (xMovedOwner.IsValid() && xMovedOwner != xEntityID)
+
+	// The entity leaves the source scene's groups on its first transferred
+	// component and joins the target's once the last one it needs arrives.
+	const TypeID uTypeID = TypeIDGenerator::GetTypeID<T>();
+	pxSource->m_xQueryGroups.OnComponentRemoved(xEntityID, uTypeID, xMovedOwner, uSourcePoolIndex);
+	if (pxTarget->m_xQueryGroups.GetNumGroups() > 0)
 	{
-		Zenith_ECS_EntityStore().m_axEntityComponents.Get(xMovedOwner.m_uIndex)[uTypeID] = uSourcePoolIndex;
+		pxTarget->m_xQueryGroups.OnComponentAdded(xEntityID, uTypeID, uTargetPoolIndex, pxTarget->m_xComponents);
 	}
-
-	// Update the transferred entity's mapping to point at the target pool index.
-	xMap[uTypeID] = uNewPoolIndex;
 }
 
 
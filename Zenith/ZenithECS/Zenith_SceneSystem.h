@@ -17,12 +17,14 @@
 // =============================================================================
 
 #include "Collections/Zenith_Vector.h"
+#include "Core/Multithreading/Zenith_Multithreading.h"
 #include "ZenithECS/Zenith_Scene.h"
 #include "ZenithECS/Internal/Zenith_ECSRuntimeHooks.h"
 // Zenith_SceneSystem owns the process-wide Zenith_EntityStore. Include the full
 // type here so GetEntityStore() can return a reference and the ctor/dtor see the
 // complete type.
 #include "ZenithECS/Internal/Zenith_EntityStore.h"
+#include "ZenithECS/Internal/Zenith_QueryAccess.h"
 #include <atomic>
 #include <cstdint>
 #include <string>
@@ -32,6 +34,7 @@ struct Zenith_EntityID;
 class Zenith_Entity;
 class Zenith_SceneData;
 class Zenith_DataStream;
+class Zenith_ECSCommandBuffer;
 
 //==============================================================================
 // Scene-load mode
@@ -306,6 +309,42 @@ public:
 	}
 	void SetSparseQueryReads(bool b) { m_bUseSparseQueryReads.store(b, std::memory_order_release); }
 
+	// Cached query groups (Zenith_QueryGroup.h). When true (the default), a
+	// multi-type Query on the sparse read path walks its scene's persistent
+	// matched-entity group instead of probing every queried pool per driver
+	// entity. Groups are maintained either way once created; the toggle only
+	// picks the read, so tests/bench can pin and restore it like the sparse one.
+	bool AreQueryGroupsEnabled() const
+	{
+		return m_bUseQueryGroups.load(std::memory_order_acquire);
+	}
+	void SetQueryGroupsEnabled(bool b) { m_bUseQueryGroups.store(b, std::memory_order_release); }
+
+	// Component change detection. Every component pool slot carries the change
+	// tick of its last recorded write (see Zenith_ComponentPoolBase::
+	// m_xChangeTicks), and Query<...>().Changed<T>(uSinceTick) keeps only
+	// entities whose T was stamped after uSinceTick. An incremental consumer
+	// closes its window with AdvanceChangeTick(), which returns the current tick
+	// and moves later stamps past it:
+	//
+	//   const u_int uNow = Scenes().AdvanceChangeTick();
+	//   pxSceneData->Query<const T>().Changed<T>(m_uLastSeenTick).ForEach(...);
+	//   m_uLastSeenTick = uNow;
+	//
+	// Writes made before the call are seen by this pass, writes during or after
+	// it by the next. Starts at 1 and never resets.
+	u_int GetChangeTick() const { return m_uChangeTick.load(std::memory_order_acquire); }
+	u_int AdvanceChangeTick() { return m_uChangeTick.fetch_add(1, std::memory_order_acq_rel); }
+
+	// Deferred structural changes (Zenith_ECSCommandBuffer.h). Any thread may
+	// record into its own buffer, created on first use. Update plays every
+	// thread's buffer back on the main thread at three sync points: before the
+	// pending Starts, after the fixed-update steps and after the per-scene
+	// Update. PlaybackCommandBuffers is the same playback on demand (main thread
+	// only). Buffers play back in first-use order, each in record order.
+	Zenith_ECSCommandBuffer& GetThreadCommandBuffer();
+	void PlaybackCommandBuffers();
+
 	//==========================================================================
 	// Entity creation — the ONLY public entity-construction entry points.
 	// CreateEntity runs the engine-installed default-components hook after the
@@ -347,6 +386,8 @@ private:
 	// they can call the now-private GetEntityStore() / GetRuntimeHooks() accessors.
 	friend Zenith_EntityStore& Zenith_ECS_EntityStore();
 	friend bool Zenith_ECS_IsMainThread();
+	friend Zenith_QueryAccessTracker& Zenith_ECS_QueryAccess();
+	friend void Zenith_ECS_RunParallelFor(void (*)(void*, u_int, u_int), void*, u_int, u_int);
 
 	// Engine-only hook install (friend Zenith_Engine).
 	void SetRuntimeHooks(const Zenith_ECSRuntimeHooks& xHooks) { m_xRuntimeHooks = xHooks; }
@@ -375,6 +416,10 @@ private:
 	void Shutdown();
 	int  AllocateSceneHandle();
 
+	// Empties every thread's command buffer without applying it (Shutdown /
+	// ResetWorldForNextTest: the commands name a world that is going away).
+	void DiscardCommandBuffers();
+
 	// Raw handle of the persistent ("DontDestroyOnLoad") scene, for internal
 	// collaborators (e.g. Zenith_SceneData asserts, a friend) that only need to
 	// compare handles.
@@ -564,6 +609,9 @@ private:
 	// Plain std::atomic (NOT #ifdef-d) so it compiles + works in *_False configs.
 	std::atomic<bool>             m_bUseSparseQueryReads { true };
 
+	// Cached query-group read path (see AreQueryGroupsEnabled).
+	std::atomic<bool>             m_bUseQueryGroups { true };
+
 	// Scene-graph render-mutation epoch (Phase 2). Bumped by NotifyRenderMutation()
 	// whenever a renderable Flux_ModelInstance is created or destroyed (incl. scene
 	// load/unload + entity destroy). The Flux_RenderSceneSnapshot stamps the epoch it
@@ -573,10 +621,29 @@ private:
 	// queued from teardown paths; mirrors the other atomics here.
 	std::atomic<uint64_t>         m_uRenderMutationEpoch { 1 };
 
+	// Component change-detection tick (see GetChangeTick). Monotonic like the
+	// epoch above; atomic because ForEachParallel workers stamp with it.
+	std::atomic<u_int>            m_uChangeTick { 1 };
+
 	// Leaf-safe runtime hooks installed by the engine bootstrap (all nullptr
 	// until SetRuntimeHooks is called; the documented null-semantics make every
 	// hook a safe no-op before installation). See Zenith_ECSRuntimeHooks.h.
 	Zenith_ECSRuntimeHooks        m_xRuntimeHooks;
+
+	// Access claims of the parallel queries currently in flight (see
+	// Zenith_QueryAccess.h). Reached via the leaf forwarder Zenith_ECS_QueryAccess().
+	Zenith_QueryAccessTracker     m_xQueryAccess;
+
+	// Per-thread command buffers (see GetThreadCommandBuffer), in first-use
+	// order. Owned here and freed in the dtor; Shutdown only empties them, since
+	// each thread keeps a cached pointer to its own.
+	Zenith_Vector<Zenith_ECSCommandBuffer*> m_axThreadCommandBuffers;
+	Zenith_Mutex_NoProfiling      m_xThreadCommandBufferMutex;
+
+	// Process-unique, never reused (unlike the address, which a later instance
+	// may be allocated at). A thread's cached buffer is tagged with it, so a
+	// buffer freed with an earlier instance is never handed out again.
+	const u_int64                 m_ulInstanceID;
 };
 
 //==========================================================================